@@ -0,0 +1,78 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#ifndef ASSETS_H
+#define ASSETS_H
+
+#include <lvgl.h>
+
+/*
+  Handles for the images main.cpp picks at runtime. These images, and the ones ui.c shows, are the only
+  ones linked, --gc-sections drops the rest of src/ui/ui_img_*.c. tools/prune_assets.py also leaves the
+  images nothing mentions out of the compile and prints the image data the firmware links.
+  Add an image here before using it from code.
+  assetImage() gives the image from the resource pack (res_pack.h) when there is one, else the compiled one.
+*/
+
+#define ASSET_LIST(X)                                \
+  X(ASSET_CLOCK_LARGE_BG, ui_img_clock_large_bg_png) \
+  X(ASSET_CLOCK_ROUND_BG, ui_img_clock_round_bg_png) \
+  X(ASSET_SMS, ui_img_sms_png)                       \
+  X(ASSET_MAIL, ui_img_mail_png)                     \
+  X(ASSET_PENGUIN, ui_img_penguin_png)               \
+  X(ASSET_SKYPE, ui_img_skype_png)                   \
+  X(ASSET_WHATSAPP, ui_img_whatsapp_png)             \
+  X(ASSET_LINE, ui_img_line_png)                     \
+  X(ASSET_TWITTER, ui_img_twitter_png)               \
+  X(ASSET_FACEBOOK, ui_img_facebook_png)             \
+  X(ASSET_MESSENGER, ui_img_messenger_png)           \
+  X(ASSET_INSTAGRAM, ui_img_instagram_png)           \
+  X(ASSET_WEIBO, ui_img_weibo_png)                   \
+  X(ASSET_KAKAO, ui_img_kakao_png)                   \
+  X(ASSET_VIBER, ui_img_viber_png)                   \
+  X(ASSET_VKONTAKTE, ui_img_vkontakte_png)           \
+  X(ASSET_TELEGRAM, ui_img_telegram_png)             \
+  X(ASSET_WECHAT, ui_img_wechat_png)                 \
+  X(ASSET_WEATHER_0, ui_img_602206286)               \
+  X(ASSET_WEATHER_1, ui_img_602205261)               \
+  X(ASSET_WEATHER_2, ui_img_602199888)               \
+  X(ASSET_WEATHER_3, ui_img_602207311)               \
+  X(ASSET_WEATHER_4, ui_img_dy4_png)                 \
+  X(ASSET_WEATHER_5, ui_img_602200913)               \
+  X(ASSET_WEATHER_6, ui_img_602195540)               \
+  X(ASSET_WEATHER_7, ui_img_602202963)
+
+#define ASSET_ENUM(id, img) id,
+
+enum Asset : uint8_t
+{
+  ASSET_LIST(ASSET_ENUM) ASSET_COUNT
+};
+
+/* Look up the images in the resource pack, call after resPackBegin() */
+void assetsBegin();
+const lv_img_dsc_t *assetImage(Asset id);
+
+#endif
@@ -0,0 +1,58 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#ifndef BLEND_H
+#define BLEND_H
+
+#include <lvgl.h>
+
+/*
+  Software blend kernels for the 16 bit swapped color of this display (LV_COLOR_DEPTH 16, LV_COLOR_16_SWAP 1,
+  LV_COLOR_MIX_ROUND_OFS 0). They load and store two RGB565 pixels per 32 bit word and keep the red, green and
+  blue channels of both pixels in the two 16 bit lanes of a word. The results are the ones of lvgl's kernels
+  for this configuration, where lv_color_mix mixes with a 5 bit factor and a translucent fill premultiplies
+  the color with the opacity cut to the same 5 bits; test/test_blend checks them against lvgl.
+
+  blendAttach() installs them as the blend callback of the software draw context, before
+  lv_disp_drv_register. They handle the normal blend mode:
+  - fills, with an opacity or with a mask (panels, backgrounds, anti-aliased edges, text)
+  - images, with an opacity or with a mask (alpha images like the icons and hands)
+  Other blend modes, a mask together with an opacity (lvgl scales the mask by (mask * opa) >> 8) and the
+  opacities lvgl rounds to cover go to lv_draw_sw_blend_basic.
+*/
+
+void blendAttach(lv_disp_drv_t *drv);
+void blendPrintStats();
+
+/* The kernels, on lv_color_t.full pixels, strides in pixels */
+void blendFill(uint16_t *dest, int32_t destStride, int32_t w, int32_t h, uint16_t color, lv_opa_t opa);
+void blendFillMask(uint16_t *dest, int32_t destStride, int32_t w, int32_t h, uint16_t color,
+                   const lv_opa_t *mask, int32_t maskStride);
+void blendMap(uint16_t *dest, int32_t destStride, int32_t w, int32_t h, const uint16_t *src, int32_t srcStride,
+              lv_opa_t opa);
+void blendMapMask(uint16_t *dest, int32_t destStride, int32_t w, int32_t h, const uint16_t *src,
+                  int32_t srcStride, const lv_opa_t *mask, int32_t maskStride);
+
+#endif
@@ -0,0 +1,70 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#ifndef CLOCK_FACE_H
+#define CLOCK_FACE_H
+
+#include <lvgl.h>
+
+/*
+  Digits and hour/minute hands of the clock faces.
+  The displayed state is computed once per tick and only the widgets of the loaded screen
+  whose value changed are written, widgets of the other screen catch up when it is loaded.
+  Widgets on a page suspended by the pager (pager.h) are skipped the same way until it is restored.
+  Screens may be built again (screens.h), clockAttach() sets up the widgets of each new one.
+  The second hand is not animated, its angle is computed from the RTC time every frame
+  so it can not drift, and the next frame is due when it reaches its next visible angle.
+  The digits are alpha only images drawn in white (include/digit_atlas.h).
+  The face backgrounds are opaque true color images (tools/asset_compiler.py), so lvgl copies
+  them instead of blending, and the large face covers whatever is behind it.
+*/
+
+/* Widget writes done by clockUpdate, reset by the caller */
+extern uint32_t clockWrites;
+
+void clockBegin(const lv_img_dsc_t *digits);
+/* Set up the clock widgets of `screen` after it is built */
+void clockAttach(lv_obj_t *screen);
+/* Write the widgets of `screen` instead of the loaded screen, NULL to follow the loaded screen again */
+void clockFollow(lv_obj_t *screen);
+void clockUpdate(int hour, int minute);
+/* Set the second hand for `ms` into the minute, returns [ms] until it or the minute changes */
+uint32_t clockSweep(uint32_t ms);
+void clockPrintStats();
+
+/* Second hand angle [0.1 deg] at `ms` into the minute, floored to a multiple of `resolution` */
+inline uint32_t sweepAngle(uint32_t ms, uint32_t resolution)
+{
+  return ms * 3 / 50 / resolution * resolution; // 3600 tenths of a degree per 60000 ms
+}
+
+/* First millisecond of the minute at which the hand shows the angle after `angle`, 60000 at most */
+inline uint32_t sweepNextMs(uint32_t angle, uint32_t resolution)
+{
+  uint32_t next = ((angle + resolution) * 50 + 2) / 3;
+  return next < 60000 ? next : 60000;
+}
+
+#endif
@@ -0,0 +1,77 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#ifndef HAND_BLIT_H
+#define HAND_BLIT_H
+
+#include <stdint.h>
+#include <lvgl.h>
+
+/*
+  Geometry of the analog clock hands, shared by the sprite renderer and the blitter in hand_cache.cpp.
+  A hand is rotated clockwise about its pivot without zoom: the rows it covers at an angle are narrowed
+  to the pixels whose samples fall inside the hand's alpha plane, and each row is stepped through the
+  plane in 16.16 fixed point. No Arduino or ESP-IDF dependency, the host benchmark in test/test_hand_blit
+  builds it as is.
+
+  lv_img_set_src moves the pivot to the centre of the new image, a hand leaving a sprite for its source
+  image goes through handShowSource to rotate about its own pivot again.
+*/
+
+#ifndef HAND_ANTIALIAS
+#define HAND_ANTIALIAS 1 // bilinear filtering when rendering the sprites and blitting
+#endif
+
+/* Alpha of the visible part of a hand image inside a transparent border, what the sprites and the blitter sample */
+struct AlphaPlane
+{
+  const lv_img_dsc_t *src;
+  uint8_t *data;
+  lv_coord_t x; // position of data[0] in the source image
+  lv_coord_t y;
+  lv_coord_t w;
+  lv_coord_t h;
+};
+
+bool handAlphaOnly(const lv_img_dsc_t *img);
+bool handHasAlpha(const lv_img_dsc_t *img);
+/* Non transparent part of an image, the whole image without alpha */
+void handImageBounds(const lv_img_dsc_t *src, lv_area_t *bounds);
+/* Bounding box of the pixels x1..x2, y1..y2 (relative to the pivot) rotated clockwise by `rad` */
+void handRotateBox(float x1, float y1, float x2, float y2, float rad, lv_area_t *box);
+/* Samples src into the plane's w x h data, from x, y on */
+void handPlaneFill(AlphaPlane *plane);
+/* [1/65536] cos and sin of `rad` */
+void handFixedRotation(float rad, int32_t *c, int32_t *s);
+/* Narrow u1..u2 of row v to the pixels whose samples lie inside the plane, false when none do */
+bool handRowSpan(const AlphaPlane *plane, const lv_point_t &pivot, int32_t c, int32_t s, int32_t v, int32_t *u1,
+                 int32_t *u2);
+/* Alpha of n pixels of row v starting at u, all inside the plane */
+void handSampleRow(const AlphaPlane *plane, const lv_point_t &pivot, int32_t c, int32_t s, int32_t u, int32_t v,
+                   uint8_t *out, int32_t n);
+/* Show src on the hand's image object, rotated about pivot */
+void handShowSource(lv_obj_t *obj, const lv_img_dsc_t *src, const lv_point_t &pivot);
+
+#endif
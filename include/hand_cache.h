@@ -0,0 +1,93 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#ifndef HAND_CACHE_H
+#define HAND_CACHE_H
+
+#include <lvgl.h>
+
+/*
+  Pre-rotated sprites for the analog clock hands.
+  Each hand image is rendered lazily at `steps` quantized angles into PSRAM as an alpha only (A8) sprite
+  cropped to the hand, so drawing a hand is a plain alpha blit instead of lvgl's per pixel transform.
+  The hand color comes from the img_recolor style, white unless set, which also applies to alpha only
+  hand images (tools/asset_compiler.py). Hands sharing an image and step count share sprites.
+  Without HAND_CACHE (main.h) the hands keep using lv_img_set_angle, for comparing draw times.
+
+  With HAND_BLIT (main.h) a hand without a sprite, because HAND_CACHE is off or the budget is used up, is
+  not drawn by lvgl's generic transform but by a blitter made for hands: no zoom, a fixed pivot and
+  thin. The rows the rotated hand covers are precomputed per angle, each draw clips them to its area
+  and steps through the image in 16.16 fixed point (hand_blit.h). It draws in the recolor color like the
+  sprites.
+
+  The sprite budget is HAND_CACHE_SHARE of the PSRAM free when the first hand is attached, at most
+  HAND_CACHE_BUDGET, so the image cache (img_cache.h), the slide snapshots and lvgl's PSRAM tier keep
+  their room on boards with 2 MB. Sprites are not evicted, angles rendered after the budget is used up
+  take the blitter or the transform.
+
+  Angle changes too small to move the tip of a hand by a pixel are dropped. With HAND_TIGHT_INV (main.h)
+  a moving hand invalidates a few boxes along its old and new positions instead of the bounding box
+  of the whole rotated image, which for a diagonal hand is mostly background.
+*/
+
+#ifndef HAND_STEPS_HOUR
+#define HAND_STEPS_HOUR 60
+#endif
+
+#ifndef HAND_STEPS_MINUTE
+#define HAND_STEPS_MINUTE 60
+#endif
+
+#ifndef HAND_STEPS_SECOND
+#define HAND_STEPS_SECOND 360
+#endif
+
+#ifndef HAND_CACHE_BUDGET
+#define HAND_CACHE_BUDGET (1536U * 1024U) // [bytes] most sprite memory, uncached angles fall back to the transform
+#endif
+
+#ifndef HAND_CACHE_SHARE
+#define HAND_CACHE_SHARE 35 // [%] of the free PSRAM at the first handAttach
+#endif
+
+#ifndef HAND_BLIT_ROW
+#define HAND_BLIT_ROW 256 // [px] longest run the blitter samples at once
+#endif
+
+#ifndef HAND_INV_SEGMENTS
+#define HAND_INV_SEGMENTS 3 // boxes per hand footprint, two footprints per hand update (lvgl keeps 32 areas)
+#endif
+
+#ifndef HAND_INV_MARGIN
+#define HAND_INV_MARGIN 2 // [px] around each box for the anti-aliased edge
+#endif
+
+void handAttach(lv_obj_t *hand, uint16_t steps);
+void handSetAngle(lv_obj_t *hand, int32_t angle);
+/* Smallest angle change [0.1 deg] that shows on screen, multiples of it are shown exactly */
+uint16_t handResolution(lv_obj_t *hand);
+void handPrintStats();
+
+#endif
@@ -0,0 +1,58 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#ifndef IMG_CACHE_H
+#define IMG_CACHE_H
+
+#include <lvgl.h>
+
+/*
+  lvgl image decoder for the run length encoded images written by tools/asset_compiler.py
+  (LV_IMG_CF_USER_ENCODED_0 true color, LV_IMG_CF_USER_ENCODED_1 true color alpha).
+  Decoded images are kept in PSRAM in an LRU cache bounded by IMG_CACHE_SHARE of the PSRAM free at
+  imgCacheBegin(), at most IMG_CACHE_BUDGET bytes, lvgl then draws them like plain true color images.
+  When PSRAM runs out before the budget does, unpinned images are evicted until the new one fits. Pinned images (the clock faces) are never evicted,
+  the rest, like notification and weather icons, are decoded again when needed after eviction.
+  Register the decoder with imgCacheBegin() before creating widgets that use these images.
+*/
+
+#ifndef IMG_CACHE_BUDGET
+#define IMG_CACHE_BUDGET (512U * 1024U) // [bytes] most decoded images, pinned ones included
+#endif
+
+#ifndef IMG_CACHE_SHARE
+#define IMG_CACHE_SHARE 25 // [%] of the free PSRAM at imgCacheBegin
+#endif
+
+#ifndef IMG_CACHE_ENTRIES
+#define IMG_CACHE_ENTRIES 32
+#endif
+
+void imgCacheBegin();
+/* Decode `img` now and keep it decoded, does nothing for images that are not encoded */
+void imgCachePin(const lv_img_dsc_t *img);
+void imgCachePrintStats();
+
+#endif
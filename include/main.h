@@ -34,6 +34,23 @@
 // #define PORTRAIT // comment for landscape
 #define USE_UI  // uncomment to use ui files exported on /ui/ folder from squareline studio
 
+#define FLUSH_STATS_INTERVAL 10000 // [ms] print display flush timing, comment to disable
+#define CPU_STATS_INTERVAL 10000   // [ms] print render/loop task cpu time, comment to disable
+#define CLOCK_STATS_INTERVAL 60000 // [ms] print clock widget writes and redrawn pixels, comment to disable
+#define MEM_STATS_INTERVAL 60000   // [ms] print lvgl memory per allocator tier, comment to disable
+#define TELEMETRY_INTERVAL 1000    // [ms] telemetry record period when streaming (telemetry.h), comment to disable
+#define FONT_STATS                 // print glyph lookup time of the label fonts at boot, comment to disable
+
+#define HAND_CACHE // draw clock hands from pre-rotated sprites, comment to use lvgl's image transform
+#define HAND_BLIT // draw hands without a sprite with the rotated blit instead of lvgl's transform, comment to compare
+#define HAND_TIGHT_INV // invalidate only the hand footprints instead of their rotated boxes, comment to compare
+#define PAIR_BLEND // blend with the two pixels per word kernels (blend.h), comment to use lvgl's
+#define NOTIFY_HISTORY // keep notifications in a list page of the home screen (notify_list.h), comment to disable
+#define PAGE_SUSPEND // suspend the scroll panel pages out of reach (pager.h), comment to compare
+#define SNAPSHOT_SLIDE // slide between screens from snapshots (slide.h), comment to slide the live screens
+#define LAZY_SCREENS SCREEN_KEEP // build screens on first use, then keep (SCREEN_KEEP) or delete (SCREEN_DESTROY) them on exit (screens.h), comment to build all at boot
+#define TOUCH_TASK // sample the touch controller from its own task on INT (touch.h), comment to read it on lvgl's read timer
+
 
 
 /* Change to your screen resolution */
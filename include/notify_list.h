@@ -0,0 +1,61 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#ifndef NOTIFY_LIST_H
+#define NOTIFY_LIST_H
+
+#include <lvgl.h>
+
+/*
+  Notification history page, the last one in the info panel of the home screen.
+  Notifications are kept in a NotifyStore (notify_store.h) with its arena in PSRAM. The list is
+  virtualized: NOTIFY_LIST_ROWS row widgets are created once and rebound to whichever notifications
+  scroll into view, their labels point into the arena (lv_label_set_text_static) so neither adding nor
+  scrolling allocates. Runs on the render task, like applyUiCommand.
+  The page is deleted with its screen, notifyListBegin() builds it again and the history is kept.
+*/
+
+#ifndef NOTIFY_ARENA_SIZE
+#define NOTIFY_ARENA_SIZE (16U * 1024U) // [bytes] record arena, a record takes 16 bytes plus its texts
+#endif
+
+#ifndef NOTIFY_MAX_AGE
+#define NOTIFY_MAX_AGE (24U * 3600U) // [s] older notifications are dropped
+#endif
+
+#ifndef NOTIFY_ROW_HEIGHT
+#define NOTIFY_ROW_HEIGHT 80 // [px] including the gap to the next row
+#endif
+
+#ifndef NOTIFY_LIST_ROWS
+#define NOTIFY_LIST_ROWS 6 // row widgets, the rows that fit the page plus one partly shown at each end
+#endif
+
+void notifyListBegin(lv_obj_t *parent);
+/* `time` [s] epoch for the age, `clock` [min] local time of day shown in the row */
+void notifyListAdd(uint8_t icon, const char *title, const char *text, uint32_t time, uint16_t clock);
+void notifyListPrintStats();
+
+#endif
@@ -0,0 +1,98 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#ifndef NOTIFY_STORE_H
+#define NOTIFY_STORE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+  Notification history in a fixed byte arena, newest first.
+  Each notification is one record: a header followed by the title and text with their terminators,
+  cut to NOTIFY_TITLE_MAX / NOTIFY_TEXT_MAX bytes on a UTF-8 character boundary and padded to 4 bytes.
+  Records are written one after another and wrap to the start of the arena. Adding one evicts the
+  oldest records until it fits, prune() evicts the ones older than maxAge.
+  Nothing is allocated after begin(), the title and text pointers stay valid until the record is evicted.
+  Not thread safe, the render task owns it (notify_list.h).
+*/
+
+#ifndef NOTIFY_TITLE_MAX
+#define NOTIFY_TITLE_MAX 31 // [bytes] without the terminator
+#endif
+
+#ifndef NOTIFY_TEXT_MAX
+#define NOTIFY_TEXT_MAX 255 // [bytes] without the terminator
+#endif
+
+#ifndef NOTIFY_MAX_RECORDS
+#define NOTIFY_MAX_RECORDS 128 // records kept at most, whatever the arena size
+#endif
+
+struct NotifyEntry
+{
+  const char *title;
+  const char *text;
+  uint32_t time;  // [s] epoch when received, for the age
+  uint32_t seq;   // counts up with every notification added, tells entries apart when the list shifts
+  uint16_t clock; // [min] local time of day when received, for display
+  uint8_t icon;
+};
+
+class NotifyStore
+{
+public:
+  /* `arena` of `size` bytes holds the records, it is not freed */
+  void begin(uint8_t *arena, uint32_t size, uint32_t maxAge);
+  /* False when the record can never fit the arena */
+  bool add(uint8_t icon, const char *title, const char *text, uint32_t time, uint16_t clock);
+  /* Evict the records older than maxAge seconds at `now` */
+  void prune(uint32_t now);
+  void clear();
+
+  /* 0 is the newest */
+  bool get(uint32_t i, NotifyEntry &entry) const;
+  uint32_t count() const { return _count; }
+  uint32_t bytes() const { return _used; }    // arena bytes taken by records
+  uint32_t size() const { return _size; }
+  uint32_t evicted() const { return _evicted; }
+
+private:
+  bool reserve(uint32_t bytes, uint32_t *offset);
+  void evictOldest();
+
+  uint8_t *_arena = nullptr;
+  uint32_t _size = 0;
+  uint32_t _maxAge = 0;
+  uint32_t _head = 0; // where the next record goes
+  uint32_t _used = 0;
+  uint32_t _offsets[NOTIFY_MAX_RECORDS]; // of the records, oldest at _first
+  uint32_t _first = 0;
+  uint32_t _count = 0;
+  uint32_t _seq = 0;
+  uint32_t _evicted = 0;
+};
+
+#endif
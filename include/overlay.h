@@ -0,0 +1,62 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#ifndef OVERLAY_H
+#define OVERLAY_H
+
+#include <lvgl.h>
+
+/*
+  Transient panels (alert, incoming call, toasts) drawn above whatever screen is loaded.
+  overlayAdd() moves a panel once onto lv_layer_top(), into a full screen container per priority
+  created in priority order, so the stacking never changes and no panel follows the screen loads.
+  The containers draw nothing and let touches through to the screen outside the panels. A swipe over
+  a shown panel is passed on to the loaded screen, so it still changes screens.
+  A shown panel waits, hidden, while one of a higher priority is shown and comes back after it, panels
+  of the same priority show together. Showing or hiding only flips the panel's hidden flag, which
+  invalidates the panel's own area.
+*/
+
+#ifndef OVERLAY_MAX
+#define OVERLAY_MAX 8
+#endif
+
+enum OverlayPriority : uint8_t
+{
+  OVERLAY_TOAST,
+  OVERLAY_ALERT,
+  OVERLAY_CALL,
+  OVERLAY_LEVELS
+};
+
+void overlayBegin();
+/* The panel keeps its position, taken relative to the display instead of its screen */
+void overlayAdd(lv_obj_t *panel, OverlayPriority priority);
+void overlayShow(lv_obj_t *panel);
+void overlayHide(lv_obj_t *panel);
+/* Shown or waiting for a higher priority panel */
+bool overlayShown(lv_obj_t *panel);
+
+#endif
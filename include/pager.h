@@ -0,0 +1,61 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#ifndef PAGER_H
+#define PAGER_H
+
+#include <lvgl.h>
+
+/*
+  Suspends the pages of a snapping scroll panel (ui_clockPanel, ui_infoPanel) that are out of reach.
+  Only the page under the middle of the panel and its neighbors stay live, the others are hidden so
+  lvgl skips them in layout, events and drawing, and their animations are held where they are.
+  A page is restored when its neighbor reaches the middle, a full page before it can scroll in.
+  pagerAttach() turns the panel's flex layout into fixed positions first, hidden pages would
+  otherwise drop out of the flex flow and move the others, and adds a spacer holding the scroll range.
+  Widget updates check pagerSuspended() and skip suspended pages, catching up once they are restored.
+*/
+
+#ifndef PAGER_MAX_PAGES
+#define PAGER_MAX_PAGES 6
+#endif
+
+#ifndef PAGER_MAX_PANELS
+#define PAGER_MAX_PANELS 2
+#endif
+
+#ifndef PAGER_MAX_PAUSED
+#define PAGER_MAX_PAUSED 16 // animations held at once, further ones keep running
+#endif
+
+/* Call after the pages are created, pages hidden at this point are left alone */
+void pagerAttach(lv_obj_t *panel);
+/* True when `obj` is on a suspended page */
+bool pagerSuspended(lv_obj_t *obj);
+/* Animations held by the pager, lv_anim_count_running() still counts them. Renews the hold, call every frame */
+uint16_t pagerPausedAnims();
+void pagerPrintStats();
+
+#endif
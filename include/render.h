@@ -0,0 +1,105 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#ifndef RENDER_H
+#define RENDER_H
+
+#include <Arduino.h>
+
+/*
+  The render task owns lvgl. It runs lv_timer_handler and the clock updates alone on APP_CPU.
+  The loop task runs watch.loop() and the telemetry polling on PRO_CPU, next to the BLE host, so a
+  long frame does not delay Chronos and a BLE burst does not delay frames. The Arduino loop task
+  shares APP_CPU with the render task, it only starts the loop task and then ends.
+
+  Handoff rules:
+  - lvgl calls made from the render task (frame callback, lvgl event callbacks) need no locking
+  - other tasks post widget updates through the ui command queue (ui_queue.h), which the
+    frame callback drains before running lvgl
+  - code that cannot use the queue must wrap lvgl calls in renderLock() / renderUnlock()
+  - the lock is recursive, keep the locked section short as it stalls the next frame
+  - after posting work call renderWake() (renderWakeFromISR() in interrupts), the render task
+    otherwise sleeps until the next lvgl timer is due
+*/
+
+#ifndef RENDER_TASK_CORE
+#define RENDER_TASK_CORE 1 // APP_CPU, the BLE host stays on PRO_CPU
+#endif
+
+#ifndef RENDER_TASK_STACK
+#define RENDER_TASK_STACK (8 * 1024)
+#endif
+
+#ifndef RENDER_TASK_PRIORITY
+#define RENDER_TASK_PRIORITY 2
+#endif
+
+#ifndef LOOP_TASK_CORE
+#define LOOP_TASK_CORE 0 // PRO_CPU, with the BLE host
+#endif
+
+#ifndef LOOP_TASK_STACK
+#define LOOP_TASK_STACK (8 * 1024) // same as the Arduino loop task it replaces
+#endif
+
+#ifndef LOOP_TASK_PRIORITY
+#define LOOP_TASK_PRIORITY 1
+#endif
+
+#ifndef RENDER_IDLE_MAX
+#define RENDER_IDLE_MAX 1000 // [ms] longest the render task sleeps without a wake up
+#endif
+
+/* Runs one frame, returns the time in ms until the next frame is needed */
+typedef uint32_t (*RenderCallback)(void);
+/* One pass of the loop task, called again as soon as it returns */
+typedef void (*LoopCallback)(void);
+
+/* CPU time spent by a task, reset by renderPrintCpu */
+struct TaskCpu
+{
+  const char *name;
+  uint8_t core;
+  uint32_t busyUs;
+  uint32_t idleUs; // time spent sleeping until the next timer or event
+  uint32_t wakeups;
+  uint32_t start;
+};
+
+extern TaskCpu renderCpu;
+extern TaskCpu loopCpu;
+
+void renderBegin(RenderCallback frame);
+void loopBegin(LoopCallback work);
+bool renderLock(TickType_t timeout = portMAX_DELAY);
+void renderUnlock();
+void renderWake();
+void renderWakeFromISR();
+
+void cpuBegin(TaskCpu &task);
+void cpuEnd(TaskCpu &task);
+void renderPrintCpu();
+
+#endif
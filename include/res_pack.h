@@ -0,0 +1,48 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#ifndef RES_PACK_H
+#define RES_PACK_H
+
+#include <lvgl.h>
+
+/*
+  Images from a resource pack written by tools/asset_compiler.py --pack.
+  On the board the pack lives in the "assets" data partition (assets_4MB.csv, assets_8MB.csv) and is
+  memory mapped, so the descriptors point straight into flash like the compiled images do. On a host
+  the same loader maps a pack file instead. Images are found by the name of the compiled symbol they
+  replace (see assets.h), `fallback` is returned when there is no pack or the pack does not have it.
+  Encoded images are decoded by img_cache.h like the compiled ones.
+*/
+
+#ifndef RES_PACK_PARTITION
+#define RES_PACK_PARTITION "assets"
+#endif
+
+/* Map the partition with label `name`, or the file at path `name` off the board */
+bool resPackBegin(const char *name = RES_PACK_PARTITION);
+const lv_img_dsc_t *resPackImage(const char *name, const lv_img_dsc_t *fallback = NULL);
+
+#endif
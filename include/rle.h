@@ -0,0 +1,40 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#ifndef RLE_H
+#define RLE_H
+
+#include <stdint.h>
+
+/*
+  Run length encoding of the USER_ENCODED images written by tools/asset_compiler.py (rle()).
+  Runs of 2 to 128 equal pixels are a control byte 0x80 | (count - 1) and the pixel, anything else is
+  a control byte (count - 1) and up to 128 literal pixels. Pixels are `px` bytes.
+*/
+
+/* Decode into `size` bytes of `out`, returns the bytes written, less than `size` when `in` runs out */
+uint32_t rleDecode(const uint8_t *in, const uint8_t *inEnd, uint8_t *out, uint32_t size, uint8_t px);
+
+#endif
@@ -0,0 +1,77 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#ifndef SCREENS_H
+#define SCREENS_H
+
+#include <lvgl.h>
+
+/*
+  Screen lifecycle. ui_init() builds every screen at boot and keeps them all; with screensBegin() a
+  screen is built when it is first navigated to, from the SquareLine screen init function.
+  Its built hook then sets it up like setup() did and replays the Chronos state shown on it.
+  On leaving a screen the policy keeps it for the next visit (SCREEN_KEEP) or tears it down and
+  deletes it once the next screen is loaded (SCREEN_DESTROY). The screen pointer is then NULL, the
+  other SquareLine widget pointers of the screen dangle until it is built again.
+  Modules holding on to widgets drop them on LV_EVENT_DELETE and are attached again by the hooks.
+  Navigation goes through screenRoute(), which takes over the swipe of the SquareLine screen event
+  so the target screen can be built first.
+*/
+
+#ifndef SCREENS_MAX
+#define SCREENS_MAX 4
+#endif
+
+#ifndef SCREENS_MAX_ROUTES
+#define SCREENS_MAX_ROUTES 4
+#endif
+
+enum ScreenPolicy
+{
+  SCREEN_KEEP,
+  SCREEN_DESTROY
+};
+
+struct ScreenDef
+{
+  lv_obj_t **obj;
+  void (*build)();                    // creates *obj, like the SquareLine screen init functions
+  void (*built)(lv_obj_t *screen);    // after each build
+  void (*teardown)(lv_obj_t *screen); // before the screen is deleted, may be NULL
+  ScreenPolicy policy;
+};
+
+typedef void (*ScreenLoadCb)(lv_obj_t *screen, lv_scr_load_anim_t anim, uint32_t time);
+
+/* `defs` by screen id, `load` runs the transitions, lv_scr_load_anim when NULL */
+void screensBegin(const ScreenDef *defs, uint8_t count, ScreenLoadCb load);
+/* The screen, built first if needed */
+lv_obj_t *screenGet(uint8_t id);
+/* Replace the `dir` swipe of `uiEvent` on screen `from` with a transition to screen `to` */
+void screenRoute(uint8_t from, lv_event_cb_t uiEvent, lv_dir_t dir, uint8_t to, lv_scr_load_anim_t anim,
+                 uint32_t time);
+void screensPrintStats();
+
+#endif
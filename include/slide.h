@@ -0,0 +1,51 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#ifndef SLIDE_H
+#define SLIDE_H
+
+#include <lvgl.h>
+
+/*
+  Screen slides from snapshots.
+  lv_scr_load_anim redraws both live screens every frame of the slide, hands, clock face and all.
+  slideTo() instead renders the outgoing and the incoming screen once into PSRAM images
+  (lv_snapshot_take_to_buf) and moves those on a screen of their own, the incoming screen is loaded
+  live when the move ends. The snapshot buffers are allocated for each slide and freed when it ends.
+  The prepare callback runs before the incoming screen is rendered, to bring its widgets up to date.
+  slideTo() matches ScreenLoadCb, screensBegin() (screens.h) takes it to run the swipes.
+
+  slideMonitor() measures slides of both kinds, for comparing with and without SNAPSHOT_SLIDE (main.h):
+  frames drawn, render time per frame, and frames dropped against the refresh period.
+*/
+
+void slideBegin(void (*prepare)(lv_obj_t *screen));
+/* Slide to `screen`, LV_SCR_LOAD_ANIM_MOVE_LEFT/RIGHT from snapshots, other animations live */
+void slideTo(lv_obj_t *screen, lv_scr_load_anim_t anim, uint32_t time);
+/* Call from the display monitor callback with the refresh time [ms] */
+void slideMonitor(uint32_t ms);
+void slidePrintStats();
+
+#endif
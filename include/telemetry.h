@@ -0,0 +1,95 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <Arduino.h>
+
+/*
+  Performance telemetry streamed over Serial on request, nothing is drawn on screen.
+  Send 'c' for CSV records, 'b' for binary records, 'x' to stop. tools/telemetry.py decodes both
+  from the serial port or a capture and plots them.
+
+  The counters only ever grow, each one is written by a single task (render task, loop task or the
+  Chronos callbacks), and telemetrySample() reports the change since the last record, so nothing is
+  reset across tasks. Max values are reset by the sampler, a sample may miss one that races it.
+
+  Binary record, little endian: sync 0xA5 0x5A, version, number of fields, the uint32 fields in
+  TELEMETRY_FIELDS order, then an 8 bit sum of the field bytes. CSV records start with "T," and
+  follow a "T,<field names>" header line.
+*/
+
+#ifndef TELEMETRY_SYNC
+#define TELEMETRY_SYNC 0x5AA5
+#endif
+
+#define TELEMETRY_VERSION 1
+
+// field order of the records, keep in sync with tools/telemetry.py
+#define TELEMETRY_FIELDS(X) \
+  X(timeMs)                 \
+  X(intervalMs)             \
+  X(refreshes)              \
+  X(renderUs)               \
+  X(renderUsMax)            \
+  X(flushes)                \
+  X(flushBytes)             \
+  X(flushUs)                \
+  X(loops)                  \
+  X(loopUs)                 \
+  X(loopUsMax)              \
+  X(bleEvents)              \
+  X(uiDropped)              \
+  X(lvMemUsed)              \
+  X(lvMemPeak)              \
+  X(heapInternal)           \
+  X(heapInternalMin)        \
+  X(heapPsram)              \
+  X(heapDma)
+
+struct TelemetryCounters
+{
+  uint32_t refreshes;   // lvgl display refreshes (render task)
+  uint32_t renderUs;    // time in lv_timer_handler (render task)
+  uint32_t renderUsMax; // longest lv_timer_handler call
+  uint32_t flushes;     // strips sent to the display (render task)
+  uint32_t flushBytes;
+  uint32_t flushUs;     // bus time of the strips
+  uint32_t loops;       // watch.loop() iterations (loop task)
+  uint32_t loopUs;      // busy time of the iterations
+  uint32_t loopUsMax;
+  uint32_t bleEvents;   // Chronos callbacks
+};
+
+extern TelemetryCounters telemetry;
+
+/* Read the Serial commands, call from the loop task */
+void telemetryPoll();
+/* Send a record when one is due, call from the render task, returns the ms until the next one
+   or UINT32_MAX when not streaming */
+uint32_t telemetrySample(uint32_t uiDropped);
+
+#endif
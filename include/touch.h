@@ -0,0 +1,71 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#ifndef TOUCH_H
+#define TOUCH_H
+
+#include <lvgl.h>
+
+/*
+  Touch input driven by the controller's INT pin instead of lvgl's 30 ms read timer.
+  The falling edge of INT wakes a small task that reads the controller over I2C every
+  TOUCH_SAMPLE_PERIOD until the finger lifts, then sleeps again, so an idle panel costs no bus traffic.
+  The samples go through a lock-free queue (ui_queue.h) to the render task, which is woken on
+  touch-down and on every new sample. A tap shorter than the read timer period therefore still
+  reaches lvgl as a press followed by a release.
+
+  touchRead() is the indev read callback. It hands lvgl the queued samples in order, repeats the
+  last point while the finger rests and pauses the read timer once a released scroll has come to rest,
+  touchPending() tells the frame callback to resume it.
+*/
+
+#ifndef TOUCH_QUEUE_SIZE
+#define TOUCH_QUEUE_SIZE 16 // samples, must be a power of two
+#endif
+
+#ifndef TOUCH_SAMPLE_PERIOD
+#define TOUCH_SAMPLE_PERIOD 10 // [ms] I2C reads while a finger is down
+#endif
+
+#ifndef TOUCH_TASK_PRIORITY
+#define TOUCH_TASK_PRIORITY 3 // above the render task, a sample is taken as soon as INT falls
+#endif
+
+#ifndef TOUCH_LATENCY_MAX
+#define TOUCH_LATENCY_MAX 500 // [ms] longer gaps to the next refresh are taps that redrew nothing
+#endif
+
+/* Reads the controller, true while touched */
+typedef bool (*TouchReadCb)(uint16_t *x, uint16_t *y);
+
+void touchBegin(uint8_t intPin, TouchReadCb read);
+void touchRead(lv_indev_drv_t *drv, lv_indev_data_t *data);
+/* Samples are waiting for the read timer */
+bool touchPending();
+/* Call from the display monitor callback, times the redraw after a touch-down */
+void touchRefreshed();
+void touchPrintStats();
+
+#endif
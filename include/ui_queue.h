@@ -0,0 +1,155 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#ifndef UI_QUEUE_H
+#define UI_QUEUE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <atomic>
+
+#define UI_QUEUE_SIZE 8        // commands, must be a power of two
+#define UI_ALERT_TITLE_LEN 32  // bytes including the terminator
+#define UI_ALERT_TEXT_LEN 256  // bytes including the terminator
+#define UI_NAME_LEN 48         // caller and city names
+
+/*
+  Fixed capacity single producer / single consumer ring.
+  push() is only called from one task and pop() from another, no locks or allocation.
+  When full, push() drops the new item and counts it, the consumer always sees the oldest items first.
+*/
+template <typename T, size_t N>
+class SpscQueue
+{
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscQueue size must be a power of two");
+
+public:
+  bool push(const T &item)
+  {
+    uint32_t head = _head.load(std::memory_order_relaxed);
+    if (head - _tail.load(std::memory_order_acquire) == N)
+    {
+      _dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    _items[head & (N - 1)] = item;
+    _head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool pop(T &item)
+  {
+    uint32_t tail = _tail.load(std::memory_order_relaxed);
+    if (_head.load(std::memory_order_acquire) == tail)
+    {
+      return false;
+    }
+    item = _items[tail & (N - 1)];
+    _tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  size_t size() const
+  {
+    return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire);
+  }
+
+  uint32_t dropped() const
+  {
+    return _dropped.load(std::memory_order_relaxed);
+  }
+
+private:
+  T _items[N];
+  std::atomic<uint32_t> _head{0}; // written by the producer only
+  std::atomic<uint32_t> _tail{0}; // written by the consumer only
+  std::atomic<uint32_t> _dropped{0};
+};
+
+enum UiCommandType : uint8_t
+{
+  UI_SET_ALERT,
+  UI_SHOW_CALLER,
+  UI_HIDE_CALLER,
+  UI_SET_WEATHER,
+  UI_SET_CITY,
+  UI_SET_TIME
+};
+
+/* Widget update posted from the Chronos callbacks, applied by the render task */
+struct UiCommand
+{
+  UiCommandType type;
+  union
+  {
+    struct
+    {
+      int icon;
+      char title[UI_ALERT_TITLE_LEN];
+      char text[UI_ALERT_TEXT_LEN];
+    } alert;
+    struct
+    {
+      char name[UI_NAME_LEN];
+    } caller;
+    struct
+    {
+      int temp;
+      int high;
+      int low;
+      int icon;
+    } weather;
+    struct
+    {
+      char name[UI_NAME_LEN];
+    } city;
+  };
+};
+
+/* Length of a UTF-8 string cut to at most `max` bytes, on a character boundary */
+inline size_t uiTextLength(const char *src, size_t max)
+{
+  size_t len = strlen(src);
+  if (len > max)
+  {
+    len = max;
+    while (len > 0 && ((uint8_t)src[len] & 0xC0) == 0x80)
+    {
+      len--; // do not split a multi-byte sequence
+    }
+  }
+  return len;
+}
+
+/* Copy a UTF-8 string, truncating on a character boundary */
+inline void uiCopyText(char *dest, size_t size, const char *src)
+{
+  size_t len = uiTextLength(src, size - 1);
+  memcpy(dest, src, len);
+  dest[len] = '\0';
+}
+
+#endif
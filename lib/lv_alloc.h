@@ -0,0 +1,72 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#ifndef LV_ALLOC_H
+#define LV_ALLOC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+  lvgl's allocator (LV_MEM_CUSTOM in lv_conf.h), in three tiers:
+  - slab: blocks of up to LV_ALLOC_SLAB_MAX bytes from size class free lists in internal RAM, for the
+    objects, styles and animation data lvgl allocates and frees all the time
+  - internal: larger blocks below LV_ALLOC_PSRAM_MIN from the internal heap, like lvgl's draw buffers
+  - psram: LV_ALLOC_PSRAM_MIN bytes and up from PSRAM, like long label texts and snapshots
+  A full tier hands the request to the next one. In lib/ so lvgl's sources find it next to lv_conf.h.
+
+  The slab class counts come from a recorded allocation trace: with LV_ALLOC_TRACE every call is
+  printed, tools/alloc_trace.py turns the log of a boot and a few screen changes into the fixture
+  test/test_lv_alloc replays and prints the most blocks each size class held at once.
+*/
+
+// #define LV_ALLOC_TRACE // print every lvAlloc, lvFree and lvRealloc over Serial, uncomment to record a trace
+
+#ifndef LV_ALLOC_SLAB_MAX
+#define LV_ALLOC_SLAB_MAX 256 // [bytes] largest slab block, see the size classes in lv_alloc.cpp
+#endif
+
+#ifndef LV_ALLOC_PSRAM_MIN
+#define LV_ALLOC_PSRAM_MIN 4096 // [bytes] smallest block taken from PSRAM
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+  void *lvAlloc(size_t size);
+  void lvFree(void *p);
+  void *lvRealloc(void *p, size_t size);
+  /* Per tier use, high water mark and fragmentation */
+  void lvAllocPrintStats(void);
+  /* [bytes] asked for and not freed yet, and the most that ever was, all tiers */
+  void lvAllocUsage(uint32_t *inUse, uint32_t *peak);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,56 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include "assets.h"
+#include "res_pack.h"
+#include "ui/ui.h"
+
+#define ASSET_ENTRY(id, img) {#img, &img},
+
+struct AssetEntry
+{
+  const char *name;
+  const lv_img_dsc_t *img;
+};
+
+static const AssetEntry compiled[ASSET_COUNT] = {ASSET_LIST(ASSET_ENTRY)};
+static const lv_img_dsc_t *resolved[ASSET_COUNT];
+
+void assetsBegin()
+{
+  for (uint8_t i = 0; i < ASSET_COUNT; i++)
+  {
+    resolved[i] = resPackImage(compiled[i].name, compiled[i].img);
+  }
+}
+
+const lv_img_dsc_t *assetImage(Asset id)
+{
+  if (id >= ASSET_COUNT)
+  {
+    return NULL;
+  }
+  return resolved[id] ? resolved[id] : compiled[id].img;
+}
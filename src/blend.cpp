@@ -0,0 +1,432 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <string.h>
+#include "blend.h"
+
+#ifdef ESP_PLATFORM
+#include <Arduino.h>
+#include <Timber.h>
+#define BLEND_LOG(...) Timber.i(__VA_ARGS__)
+#define BLEND_WARN(...) Timber.w(__VA_ARGS__)
+#else
+// host builds (the exactness test and benchmark in test/test_blend)
+#include <stdio.h>
+#define BLEND_LOG(...) (printf(__VA_ARGS__), putchar('\n'))
+#define BLEND_WARN(...) BLEND_LOG(__VA_ARGS__)
+#endif
+
+// the same condition as lv_color_mix's 5 bit path
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 1 && LV_COLOR_MIX_ROUND_OFS == 0
+
+#define LANE5 0x001F001FU
+#define LANE6 0x003F003FU
+#define SPREAD 0x07E0F81FU
+
+/* Pixels drawn by the kernels and by lvgl, reset by blendPrintStats */
+static uint32_t fastPixels = 0;
+static uint32_t lvglPixels = 0;
+
+/* Byte swaps both pixels of a pair, between lv_color_t.full and RGB565 */
+static inline uint32_t swap2(uint32_t pair)
+{
+  return ((pair >> 8) & 0x00FF00FFU) | ((pair & 0x00FF00FFU) << 8);
+}
+
+static inline uint16_t swap1(uint32_t px)
+{
+  return (uint16_t)((px >> 8) | (px << 8));
+}
+
+/* Both 16 bit lanes divided by 255 and rounded down, same as LV_UDIV255 below 65280 */
+static inline uint32_t div255x2(uint32_t x)
+{
+  return ((x + 0x00010001U + ((x >> 8) & 0x00FF00FFU)) >> 8) & 0x00FF00FFU;
+}
+
+/* The 0..32 mix factor of lv_color_mix */
+static inline uint32_t mix5(lv_opa_t mix)
+{
+  return (mix + 4) >> 3;
+}
+
+/*
+  lv_color_mix of two RGB565 pixel pairs, m from mix5. lvgl mixes a pixel spread to 0x07E0F81F with
+  (fg - bg) * m >> 5, which is bg + floor((fg - bg) * m / 32) per channel. Here that is bg * 32 + (fg - bg) * m
+  per lane: a lane of fg - bg can borrow from the next one, the sum puts it back as every lane ends up in
+  0..2016.
+*/
+static inline uint32_t mix2(uint32_t fg, uint32_t bg, uint32_t m)
+{
+  uint32_t bgR = (bg >> 11) & LANE5, bgG = (bg >> 5) & LANE6, bgB = bg & LANE5;
+  uint32_t r = (((bgR << 5) + (((fg >> 11) & LANE5) - bgR) * m) >> 5) & LANE5;
+  uint32_t g = (((bgG << 5) + (((fg >> 5) & LANE6) - bgG) * m) >> 5) & LANE6;
+  uint32_t b = (((bgB << 5) + ((fg & LANE5) - bgB) * m) >> 5) & LANE5;
+  return (r << 11) | (g << 5) | b;
+}
+
+/* lv_color_mix of two RGB565 pixels, lvgl's own arithmetic */
+static inline uint32_t mix1(uint32_t fg, uint32_t bg, uint32_t m)
+{
+  fg = (fg | (fg << 16)) & SPREAD;
+  bg = (bg | (bg << 16)) & SPREAD;
+  uint32_t result = ((((fg - bg) * m) >> 5) + bg) & SPREAD;
+  return (result >> 16 | result) & 0xFFFFU;
+}
+
+/* lv_color_t.full pixels */
+static inline uint16_t mixPx(uint16_t fg, uint16_t bg, lv_opa_t mix)
+{
+  return swap1(mix1(swap1(fg), swap1(bg), mix5(mix)));
+}
+
+/* lv_color_premult of the fill color in both lanes, and the opacity lv_color_mix_premult adds the background with */
+struct Premult
+{
+  uint32_t r, g, b;
+  uint32_t inv;
+};
+
+/* lv_color_mix_premult of a pair of lv_color_t.full pixels */
+static inline uint32_t premultMix2(const Premult &fg, uint32_t pair)
+{
+  uint32_t bg = swap2(pair);
+  uint32_t r = div255x2(fg.r + ((bg >> 11) & LANE5) * fg.inv);
+  uint32_t g = div255x2(fg.g + ((bg >> 5) & LANE6) * fg.inv);
+  uint32_t b = div255x2(fg.b + (bg & LANE5) * fg.inv);
+  return swap2((r << 11) | (g << 5) | b);
+}
+
+static inline uint16_t premultMix1(const Premult &fg, uint16_t px)
+{
+  return (uint16_t)premultMix2(fg, px | ((uint32_t)px << 16));
+}
+
+void blendFill(uint16_t *dest, int32_t destStride, int32_t w, int32_t h, uint16_t color, lv_opa_t opa)
+{
+  uint32_t color2 = color | ((uint32_t)color << 16);
+
+  if (opa == LV_OPA_COVER)
+  {
+    for (int32_t y = 0; y < h; y++, dest += destStride)
+    {
+      int32_t x = 0;
+      if (((uintptr_t)dest & 2) && w > 0)
+      {
+        dest[x++] = color;
+      }
+      uint32_t *dest2 = (uint32_t *)(dest + x);
+      for (; x + 8 <= w; x += 8, dest2 += 4)
+      {
+        dest2[0] = color2;
+        dest2[1] = color2;
+        dest2[2] = color2;
+        dest2[3] = color2;
+      }
+      for (; x + 2 <= w; x += 2)
+      {
+        *dest2++ = color2;
+      }
+      if (x < w)
+      {
+        dest[x] = color;
+      }
+    }
+    return;
+  }
+
+  /*
+    Like lvgl: the color is premultiplied with opa cut to the 5 bits lv_color_mix keeps (252 and up wrap to 0
+    in the lv_opa_t), except for the black pixels before the first other one, which lv_color_mix blends.
+  */
+  lv_opa_t opa5 = mix5(opa) << 3;
+  uint32_t fg = swap2(color2);
+  Premult premult = {((fg >> 11) & LANE5) * opa5, ((fg >> 5) & LANE6) * opa5, (fg & LANE5) * opa5,
+                     (uint32_t)(255 - opa5)};
+  uint16_t black = mixPx(color, 0, opa);
+  bool leading = true;
+
+  // backgrounds repeat, keep the last result
+  uint32_t lastIn = 0;
+  uint32_t lastOut = premultMix2(premult, lastIn);
+
+  for (int32_t y = 0; y < h; y++, dest += destStride)
+  {
+    int32_t x = 0;
+    if (leading)
+    {
+      for (; x < w && dest[x] == 0; x++)
+      {
+        dest[x] = black;
+      }
+      leading = x == w;
+    }
+    if (((uintptr_t)(dest + x) & 2) && x < w)
+    {
+      dest[x] = premultMix1(premult, dest[x]);
+      x++;
+    }
+    uint32_t *dest2 = (uint32_t *)(dest + x);
+    for (; x + 2 <= w; x += 2, dest2++)
+    {
+      uint32_t in = *dest2;
+      if (in != lastIn)
+      {
+        lastIn = in;
+        lastOut = premultMix2(premult, in);
+      }
+      *dest2 = lastOut;
+    }
+    if (x < w)
+    {
+      dest[x] = premultMix1(premult, dest[x]);
+    }
+  }
+}
+
+void blendFillMask(uint16_t *dest, int32_t destStride, int32_t w, int32_t h, uint16_t color,
+                   const lv_opa_t *mask, int32_t maskStride)
+{
+  uint32_t color2 = color | ((uint32_t)color << 16);
+  uint32_t fg = swap1(color);
+
+  for (int32_t y = 0; y < h; y++, dest += destStride, mask += maskStride)
+  {
+    int32_t x = 0;
+    if (((uintptr_t)dest & 2) && w > 0)
+    {
+      if (mask[0])
+      {
+        dest[0] = mask[0] == LV_OPA_COVER ? color : mixPx(color, dest[0], mask[0]);
+      }
+      x++;
+    }
+    for (; x + 2 <= w; x += 2)
+    {
+      uint32_t m = mask[x] | (mask[x + 1] << 8);
+      if (m == 0)
+      {
+        continue;
+      }
+      uint32_t *dest2 = (uint32_t *)(dest + x);
+      if (m == 0xFFFF)
+      {
+        *dest2 = color2;
+        continue;
+      }
+      uint32_t bg = swap2(*dest2);
+      uint32_t lo = mix1(fg, bg & 0xFFFF, mix5(mask[x]));
+      uint32_t hi = mix1(fg, bg >> 16, mix5(mask[x + 1]));
+      *dest2 = swap2(lo | (hi << 16));
+    }
+    if (x < w && mask[x])
+    {
+      dest[x] = mask[x] == LV_OPA_COVER ? color : mixPx(color, dest[x], mask[x]);
+    }
+  }
+}
+
+void blendMap(uint16_t *dest, int32_t destStride, int32_t w, int32_t h, const uint16_t *src, int32_t srcStride,
+              lv_opa_t opa)
+{
+  if (opa == LV_OPA_COVER)
+  {
+    for (int32_t y = 0; y < h; y++, dest += destStride, src += srcStride)
+    {
+      memcpy(dest, src, w * sizeof(uint16_t));
+    }
+    return;
+  }
+
+  uint32_t m = mix5(opa);
+  for (int32_t y = 0; y < h; y++, dest += destStride, src += srcStride)
+  {
+    int32_t x = 0;
+    if (((uintptr_t)dest & 2) && w > 0)
+    {
+      dest[x] = mixPx(src[x], dest[x], opa);
+      x++;
+    }
+    for (; x + 2 <= w; x += 2)
+    {
+      uint32_t *dest2 = (uint32_t *)(dest + x);
+      uint32_t fg = src[x] | ((uint32_t)src[x + 1] << 16); // src may be off by a pixel from dest
+      *dest2 = swap2(mix2(swap2(fg), swap2(*dest2), m));
+    }
+    if (x < w)
+    {
+      dest[x] = mixPx(src[x], dest[x], opa);
+    }
+  }
+}
+
+void blendMapMask(uint16_t *dest, int32_t destStride, int32_t w, int32_t h, const uint16_t *src,
+                  int32_t srcStride, const lv_opa_t *mask, int32_t maskStride)
+{
+  for (int32_t y = 0; y < h; y++, dest += destStride, src += srcStride, mask += maskStride)
+  {
+    int32_t x = 0;
+    if (((uintptr_t)dest & 2) && w > 0)
+    {
+      if (mask[0])
+      {
+        dest[0] = mask[0] == LV_OPA_COVER ? src[0] : mixPx(src[0], dest[0], mask[0]);
+      }
+      x++;
+    }
+    for (; x + 2 <= w; x += 2)
+    {
+      uint32_t m = mask[x] | (mask[x + 1] << 8);
+      if (m == 0)
+      {
+        continue;
+      }
+      uint32_t *dest2 = (uint32_t *)(dest + x);
+      uint32_t fg = src[x] | ((uint32_t)src[x + 1] << 16);
+      if (m == 0xFFFF)
+      {
+        *dest2 = fg;
+        continue;
+      }
+      fg = swap2(fg);
+      uint32_t bg = swap2(*dest2);
+      uint32_t lo = mix1(fg & 0xFFFF, bg & 0xFFFF, mix5(mask[x]));
+      uint32_t hi = mix1(fg >> 16, bg >> 16, mix5(mask[x + 1]));
+      *dest2 = swap2(lo | (hi << 16));
+    }
+    if (x < w && mask[x])
+    {
+      dest[x] = mask[x] == LV_OPA_COVER ? src[x] : mixPx(src[x], dest[x], mask[x]);
+    }
+  }
+}
+
+/* lv_draw_sw_blend_basic for the cases above, the clipping and offsets are the same */
+static void blendSwar(lv_draw_ctx_t *draw_ctx, const lv_draw_sw_blend_dsc_t *dsc)
+{
+  lv_disp_t *disp = _lv_refr_get_disp_refreshing();
+  const lv_opa_t *mask = dsc->mask_buf;
+  if (mask && dsc->mask_res == LV_DRAW_MASK_RES_TRANSP)
+  {
+    return;
+  }
+  if (dsc->mask_res == LV_DRAW_MASK_RES_FULL_COVER)
+  {
+    mask = NULL;
+  }
+
+  // lvgl treats LV_OPA_MAX and up as cover in some of its kernels but not in others
+  if (dsc->blend_mode != LV_BLEND_MODE_NORMAL || disp->driver->set_px_cb || disp->driver->screen_transp ||
+      (dsc->opa >= LV_OPA_MAX && dsc->opa < LV_OPA_COVER) || (mask && dsc->opa != LV_OPA_COVER))
+  {
+    lv_area_t area;
+    if (_lv_area_intersect(&area, dsc->blend_area, draw_ctx->clip_area))
+    {
+      lvglPixels += lv_area_get_size(&area);
+    }
+    lv_draw_sw_blend_basic(draw_ctx, dsc);
+    return;
+  }
+
+  lv_area_t area;
+  if (!_lv_area_intersect(&area, dsc->blend_area, draw_ctx->clip_area))
+  {
+    return;
+  }
+  int32_t w = lv_area_get_width(&area);
+  int32_t h = lv_area_get_height(&area);
+  fastPixels += w * h;
+
+  int32_t destStride = lv_area_get_width(draw_ctx->buf_area);
+  uint16_t *dest = (uint16_t *)draw_ctx->buf + destStride * (area.y1 - draw_ctx->buf_area->y1) +
+                   (area.x1 - draw_ctx->buf_area->x1);
+
+  int32_t maskStride = 0;
+  if (mask)
+  {
+    maskStride = lv_area_get_width(dsc->mask_area);
+    mask += maskStride * (area.y1 - dsc->mask_area->y1) + (area.x1 - dsc->mask_area->x1);
+  }
+
+  if (dsc->src_buf == NULL)
+  {
+    if (mask)
+    {
+      blendFillMask(dest, destStride, w, h, dsc->color.full, mask, maskStride);
+    }
+    else
+    {
+      blendFill(dest, destStride, w, h, dsc->color.full, dsc->opa);
+    }
+    return;
+  }
+
+  int32_t srcStride = lv_area_get_width(dsc->blend_area);
+  const uint16_t *src = (const uint16_t *)dsc->src_buf + srcStride * (area.y1 - dsc->blend_area->y1) +
+                        (area.x1 - dsc->blend_area->x1);
+  if (mask)
+  {
+    blendMapMask(dest, destStride, w, h, src, srcStride, mask, maskStride);
+  }
+  else
+  {
+    blendMap(dest, destStride, w, h, src, srcStride, dsc->opa);
+  }
+}
+
+static void blendInitCtx(lv_disp_drv_t *drv, lv_draw_ctx_t *draw_ctx)
+{
+  lv_draw_sw_init_ctx(drv, draw_ctx);
+  ((lv_draw_sw_ctx_t *)draw_ctx)->blend = blendSwar;
+}
+
+void blendAttach(lv_disp_drv_t *drv)
+{
+  drv->draw_ctx_init = blendInitCtx;
+  drv->draw_ctx_deinit = lv_draw_sw_deinit_ctx;
+  drv->draw_ctx_size = sizeof(lv_draw_sw_ctx_t);
+}
+
+void blendPrintStats()
+{
+  uint32_t total = fastPixels + lvglPixels;
+  BLEND_LOG("Blend: %u kpx, %u%% by the pair kernels", total / 1000,
+           total ? (uint32_t)(100ULL * fastPixels / total) : 0);
+  fastPixels = 0;
+  lvglPixels = 0;
+}
+
+#else
+
+void blendAttach(lv_disp_drv_t *drv)
+{
+  BLEND_WARN("Blend kernels need LV_COLOR_DEPTH 16, LV_COLOR_16_SWAP and LV_COLOR_MIX_ROUND_OFS 0, using lvgl's");
+}
+
+void blendPrintStats()
+{
+}
+
+#endif
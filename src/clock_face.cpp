@@ -0,0 +1,296 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <Arduino.h>
+#include <Timber.h>
+#include "clock_face.h"
+#include "hand_cache.h"
+#include "img_cache.h"
+#include "pager.h"
+#include "ui/ui.h"
+
+uint32_t clockWrites = 0;
+
+/* Last value written to a widget, -1 forces the next write */
+struct Shown
+{
+  lv_obj_t **obj;
+  int value;
+};
+
+static const lv_img_dsc_t *digitImages;
+
+static lv_obj_t **digitWidgets[] = {&ui_hour1, &ui_hour2, &ui_minute1, &ui_minute2};
+
+static Shown hour1 = {&ui_hour1, -1};
+static Shown hour2 = {&ui_hour2, -1};
+static Shown minute1 = {&ui_minute1, -1};
+static Shown minute2 = {&ui_minute2, -1};
+
+static Shown hourHand = {&ui_hourHand, -1};
+static Shown minuteHand = {&ui_minuteHand, -1};
+static Shown hourHand1 = {&ui_hourHand1, -1};
+static Shown secondHand = {&ui_secondHand, -1};
+static Shown secondHand1 = {&ui_secondHand1, -1};
+static Shown minuteHand1 = {&ui_minuteHand1, -1};
+
+static Shown *homeWidgets[] = {&hourHand, &minuteHand, &secondHand};
+static Shown *clockWidgets[] = {&hour1, &hour2, &minute1, &minute2, &hourHand1, &minuteHand1, &secondHand1};
+
+/* Draw time of a face background, without the widgets above it */
+struct Background
+{
+  lv_obj_t **screen;
+  lv_obj_t **obj;
+  const char *name;
+  uint32_t drawStart;
+  uint32_t drawUs;
+  uint32_t draws;
+};
+
+static Background backgrounds[] = {
+    {&ui_clockScreen, &ui_analogClock, "Large face"},
+    {&ui_homeScreen, &ui_clockSmallBackground, "Round face"},
+};
+
+static lv_obj_t *shownScreen;
+static lv_obj_t *followed; // written instead of the loaded screen
+static int shownHour = -1;
+static int shownMinute = -1;
+static bool stale = false; // a write was skipped on a suspended page
+
+static void setDigit(Shown &w, int digit)
+{
+  if (pagerSuspended(*w.obj))
+  {
+    stale = true;
+    return;
+  }
+  if (w.value != digit)
+  {
+    w.value = digit;
+    lv_img_set_src(*w.obj, &digitImages[digit]);
+    clockWrites++;
+  }
+}
+
+static void setAngle(Shown &w, int angle)
+{
+  if (pagerSuspended(*w.obj))
+  {
+    stale = true;
+    return;
+  }
+  if (w.value != angle)
+  {
+    w.value = angle;
+    handSetAngle(*w.obj, angle);
+    clockWrites++;
+  }
+}
+
+static void backgroundDrawEvent(lv_event_t *e)
+{
+  Background *bg = (Background *)lv_event_get_user_data(e);
+  if (lv_event_get_code(e) == LV_EVENT_DRAW_MAIN_BEGIN)
+  {
+    bg->drawStart = micros();
+  }
+  else
+  {
+    bg->drawUs += micros() - bg->drawStart;
+    bg->draws++;
+  }
+}
+
+/*
+  lvgl only looks at bg_opa when checking if an object covers an area, so everything
+  behind the large face was drawn first. An opaque bg image covers its area by itself.
+*/
+static void opaqueBackgroundEvent(lv_event_t *e)
+{
+  lv_obj_t *obj = lv_event_get_target(e);
+  lv_cover_check_info_t *info = (lv_cover_check_info_t *)lv_event_get_param(e);
+  if (info->res == LV_COVER_RES_MASKED)
+  {
+    return;
+  }
+
+  const void *src = lv_obj_get_style_bg_img_src(obj, LV_PART_MAIN);
+  if (!src || lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE)
+  {
+    return;
+  }
+  // the decoded format, the image may be stored run length encoded (img_cache.h)
+  lv_img_header_t header;
+  if (lv_img_decoder_get_info(src, &header) != LV_RES_OK || header.cf != LV_IMG_CF_TRUE_COLOR ||
+      lv_obj_get_style_bg_img_tiled(obj, LV_PART_MAIN) ||
+      lv_obj_get_style_bg_img_opa(obj, LV_PART_MAIN) < LV_OPA_MAX ||
+      lv_obj_get_style_opa(obj, LV_PART_MAIN) < LV_OPA_MAX)
+  {
+    return;
+  }
+
+  // a bg image that is not tiled is centered on the object
+  lv_area_t coords;
+  lv_obj_get_coords(obj, &coords);
+  lv_area_t area;
+  area.x1 = coords.x1 + (lv_area_get_width(&coords) - header.w) / 2;
+  area.y1 = coords.y1 + (lv_area_get_height(&coords) - header.h) / 2;
+  area.x2 = area.x1 + header.w - 1;
+  area.y2 = area.y1 + header.h - 1;
+  if (_lv_area_is_in(info->area, &area, 0))
+  {
+    info->res = LV_COVER_RES_COVER;
+  }
+}
+
+void clockBegin(const lv_img_dsc_t *digits)
+{
+  digitImages = digits;
+}
+
+void clockAttach(lv_obj_t *screen)
+{
+  // widgets of a screen built again start out with the values of the UI export, write them all
+  shownScreen = NULL;
+  if (screen == ui_homeScreen)
+  {
+    for (Shown *w : homeWidgets)
+    {
+      w->value = -1;
+    }
+  }
+  if (screen == ui_clockScreen)
+  {
+    for (Shown *w : clockWidgets)
+    {
+      w->value = -1;
+    }
+    // alpha only digits take their color from the recolor style
+    for (lv_obj_t **digit : digitWidgets)
+    {
+      lv_obj_set_style_img_recolor(*digit, lv_color_white(), LV_PART_MAIN | LV_STATE_DEFAULT);
+      lv_obj_set_style_img_recolor_opa(*digit, LV_OPA_COVER, LV_PART_MAIN | LV_STATE_DEFAULT);
+    }
+  }
+
+  for (Background &bg : backgrounds)
+  {
+    if (*bg.screen == screen)
+    {
+      lv_obj_add_event_cb(*bg.obj, backgroundDrawEvent, LV_EVENT_DRAW_MAIN_BEGIN, &bg);
+      lv_obj_add_event_cb(*bg.obj, backgroundDrawEvent, LV_EVENT_DRAW_MAIN_END, &bg);
+    }
+  }
+
+  // the faces are drawn every second, keep them decoded
+  if (screen == ui_homeScreen)
+  {
+    imgCachePin((const lv_img_dsc_t *)lv_img_get_src(ui_clockSmallBackground));
+    return;
+  }
+  if (screen != ui_clockScreen)
+  {
+    return;
+  }
+  const void *src = lv_obj_get_style_bg_img_src(ui_analogClock, LV_PART_MAIN);
+  imgCachePin((const lv_img_dsc_t *)src);
+
+  // the opaque bg image is drawn over the bg color, skip filling it first
+  lv_img_header_t header;
+  if (src && lv_img_src_get_type(src) == LV_IMG_SRC_VARIABLE && lv_img_decoder_get_info(src, &header) == LV_RES_OK &&
+      header.cf == LV_IMG_CF_TRUE_COLOR)
+  {
+    lv_obj_set_style_bg_opa(ui_analogClock, LV_OPA_TRANSP, LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_add_event_cb(ui_analogClock, opaqueBackgroundEvent, LV_EVENT_COVER_CHECK, NULL);
+  }
+}
+
+void clockFollow(lv_obj_t *screen)
+{
+  followed = screen;
+}
+
+void clockUpdate(int hour, int minute)
+{
+  lv_obj_t *screen = followed ? followed : lv_scr_act();
+  if (hour == shownHour && minute == shownMinute && screen == shownScreen && !stale)
+  {
+    return;
+  }
+  stale = false;
+  shownHour = hour;
+  shownMinute = minute;
+  shownScreen = screen;
+
+  int minuteAngle = minute * 60;
+  int hourAngle = hour * 300 + minute * 5;
+
+  if (screen == ui_clockScreen)
+  {
+    setDigit(hour1, hour / 10);
+    setDigit(hour2, hour % 10);
+    setDigit(minute1, minute / 10);
+    setDigit(minute2, minute % 10);
+
+    setAngle(minuteHand1, minuteAngle);
+    setAngle(hourHand1, hourAngle);
+  }
+  else if (screen == ui_homeScreen)
+  {
+    setAngle(minuteHand, minuteAngle);
+    setAngle(hourHand, hourAngle);
+  }
+}
+
+uint32_t clockSweep(uint32_t ms)
+{
+  lv_obj_t *screen = followed ? followed : lv_scr_act();
+  Shown *hand = screen == ui_clockScreen ? &secondHand1 : screen == ui_homeScreen ? &secondHand : NULL;
+  if (!hand || pagerSuspended(*hand->obj))
+  {
+    return 60000 - ms;
+  }
+
+  // floored to what the hand can show, the next frame is due at the next visible angle
+  uint32_t resolution = handResolution(*hand->obj);
+  uint32_t angle = sweepAngle(ms, resolution);
+  setAngle(*hand, angle);
+  return sweepNextMs(angle, resolution) - ms;
+}
+
+void clockPrintStats()
+{
+  for (Background &bg : backgrounds)
+  {
+    if (bg.draws)
+    {
+      Timber.i("%s: %u draws, %u us per draw", bg.name, bg.draws, bg.drawUs / bg.draws);
+    }
+    bg.drawUs = 0;
+    bg.draws = 0;
+  }
+}
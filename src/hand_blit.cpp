@@ -0,0 +1,209 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <math.h>
+#include <algorithm>
+#include "hand_blit.h"
+
+bool handAlphaOnly(const lv_img_dsc_t *img)
+{
+  return img->header.cf >= LV_IMG_CF_ALPHA_1BIT && img->header.cf <= LV_IMG_CF_ALPHA_8BIT;
+}
+
+bool handHasAlpha(const lv_img_dsc_t *img)
+{
+  return img->header.cf == LV_IMG_CF_TRUE_COLOR_ALPHA || handAlphaOnly(img);
+}
+
+static uint8_t alphaAt(const lv_img_dsc_t *img, int32_t x, int32_t y)
+{
+  if (x < 0 || y < 0 || x >= img->header.w || y >= img->header.h)
+  {
+    return 0;
+  }
+  if (img->header.cf == LV_IMG_CF_TRUE_COLOR_ALPHA)
+  {
+    uint32_t i = y * img->header.w + x;
+    return img->data[i * LV_IMG_PX_SIZE_ALPHA_BYTE + LV_IMG_PX_SIZE_ALPHA_BYTE - 1];
+  }
+
+  // alpha only, rows start on a byte with the first pixel in the high bits
+  uint8_t bpp = lv_img_cf_get_px_size(img->header.cf);
+  uint8_t mask = (1 << bpp) - 1;
+  uint32_t stride = (img->header.w * bpp + 7) / 8;
+  uint8_t byte = img->data[y * stride + x * bpp / 8];
+  return ((byte >> (8 - bpp - x * bpp % 8)) & mask) * 255 / mask;
+}
+
+void handImageBounds(const lv_img_dsc_t *src, lv_area_t *bounds)
+{
+  if (!handHasAlpha(src))
+  {
+    lv_area_set(bounds, 0, 0, src->header.w - 1, src->header.h - 1);
+    return;
+  }
+
+  bounds->x1 = src->header.w;
+  bounds->y1 = src->header.h;
+  bounds->x2 = -1;
+  bounds->y2 = -1;
+  for (lv_coord_t y = 0; y < src->header.h; y++)
+  {
+    for (lv_coord_t x = 0; x < src->header.w; x++)
+    {
+      if (alphaAt(src, x, y))
+      {
+        bounds->x1 = std::min(bounds->x1, x);
+        bounds->y1 = std::min(bounds->y1, y);
+        bounds->x2 = std::max(bounds->x2, x);
+        bounds->y2 = std::max(bounds->y2, y);
+      }
+    }
+  }
+}
+
+void handRotateBox(float x1, float y1, float x2, float y2, float rad, lv_area_t *box)
+{
+  float c = cosf(rad);
+  float s = sinf(rad);
+
+  float minX = 1e6f, minY = 1e6f, maxX = -1e6f, maxY = -1e6f;
+  float cornersX[] = {x1, x2};
+  float cornersY[] = {y1, y2};
+  for (float dx : cornersX)
+  {
+    for (float dy : cornersY)
+    {
+      float rx = dx * c - dy * s;
+      float ry = dx * s + dy * c;
+      minX = std::min(minX, rx);
+      maxX = std::max(maxX, rx);
+      minY = std::min(minY, ry);
+      maxY = std::max(maxY, ry);
+    }
+  }
+
+  box->x1 = (lv_coord_t)floorf(minX);
+  box->y1 = (lv_coord_t)floorf(minY);
+  box->x2 = (lv_coord_t)ceilf(maxX);
+  box->y2 = (lv_coord_t)ceilf(maxY);
+}
+
+void handPlaneFill(AlphaPlane *plane)
+{
+  for (lv_coord_t y = 0; y < plane->h; y++)
+  {
+    for (lv_coord_t x = 0; x < plane->w; x++)
+    {
+      plane->data[y * plane->w + x] = alphaAt(plane->src, plane->x + x, plane->y + y);
+    }
+  }
+}
+
+/*
+  Rotation in 16.16 fixed point. Pixel (u, v) relative to the pivot samples the plane at
+  qx = v * sin + (pivot.x - plane.x) + u * cos, qy = v * cos + (pivot.y - plane.y) - u * sin,
+  stepping along a row is two additions. Bilinear filtering reads the pixel right and below too.
+*/
+#if HAND_ANTIALIAS
+#define SAMPLE_ROUND 0
+#define SAMPLE_EDGE 2
+#else
+#define SAMPLE_ROUND 0x8000
+#define SAMPLE_EDGE 1
+#endif
+
+static int32_t floorDiv(int64_t n, int64_t d)
+{
+  return n >= 0 ? n / d : -((-n + d - 1) / d);
+}
+
+/* Narrow u1..u2 to the u with lo <= a + b * u <= hi */
+static void clampAxis(int64_t a, int64_t b, int64_t lo, int64_t hi, int32_t *u1, int32_t *u2)
+{
+  if (b == 0)
+  {
+    if (a < lo || a > hi)
+    {
+      *u2 = *u1 - 1;
+    }
+    return;
+  }
+  if (b < 0)
+  {
+    int64_t t = lo;
+    lo = -hi;
+    hi = -t;
+    a = -a;
+    b = -b;
+  }
+  *u1 = std::max(*u1, -floorDiv(a - lo, b));
+  *u2 = std::min(*u2, floorDiv(hi - a, b));
+}
+
+bool handRowSpan(const AlphaPlane *plane, const lv_point_t &pivot, int32_t c, int32_t s, int32_t v, int32_t *u1,
+                 int32_t *u2)
+{
+  int64_t qx = (int64_t)v * s + ((int64_t)(pivot.x - plane->x) << 16);
+  int64_t qy = (int64_t)v * c + ((int64_t)(pivot.y - plane->y) << 16);
+  clampAxis(qx, c, -SAMPLE_ROUND, ((int64_t)(plane->w - SAMPLE_EDGE + 1) << 16) - 1 - SAMPLE_ROUND, u1, u2);
+  clampAxis(qy, -s, -SAMPLE_ROUND, ((int64_t)(plane->h - SAMPLE_EDGE + 1) << 16) - 1 - SAMPLE_ROUND, u1, u2);
+  return *u1 <= *u2;
+}
+
+void handSampleRow(const AlphaPlane *plane, const lv_point_t &pivot, int32_t c, int32_t s, int32_t u, int32_t v,
+                   uint8_t *out, int32_t n)
+{
+  int32_t qx = v * s + ((pivot.x - plane->x) << 16) + u * c + SAMPLE_ROUND;
+  int32_t qy = v * c + ((pivot.y - plane->y) << 16) - u * s + SAMPLE_ROUND;
+  const uint8_t *data = plane->data;
+  int32_t w = plane->w;
+
+  for (int32_t i = 0; i < n; i++, qx += c, qy -= s)
+  {
+#if HAND_ANTIALIAS
+    const uint8_t *p = data + (qy >> 16) * w + (qx >> 16);
+    uint32_t fx = (qx >> 8) & 0xFF;
+    uint32_t fy = (qy >> 8) & 0xFF;
+    uint32_t top = p[0] * (256 - fx) + p[1] * fx;
+    uint32_t bottom = p[w] * (256 - fx) + p[w + 1] * fx;
+    out[i] = (top * (256 - fy) + bottom * fy + 0x8000) >> 16;
+#else
+    out[i] = data[(qy >> 16) * w + (qx >> 16)];
+#endif
+  }
+}
+
+void handFixedRotation(float rad, int32_t *c, int32_t *s)
+{
+  *c = lroundf(cosf(rad) * 65536);
+  *s = lroundf(sinf(rad) * 65536);
+}
+
+void handShowSource(lv_obj_t *obj, const lv_img_dsc_t *src, const lv_point_t &pivot)
+{
+  lv_img_set_src(obj, src);
+  lv_img_set_pivot(obj, pivot.x, pivot.y);
+}
@@ -0,0 +1,702 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <Arduino.h>
+#include <Timber.h>
+#include <esp_heap_caps.h>
+#include "main.h"
+#include "hand_cache.h"
+#include "hand_blit.h"
+
+#define MAX_HANDS 6
+#define MAX_SPRITE_SETS 4
+
+struct Sprite
+{
+  lv_img_dsc_t dsc; // data is NULL until rendered
+  lv_coord_t x;     // top left corner relative to the unrotated image
+  lv_coord_t y;
+};
+
+struct SpriteSet
+{
+  const lv_img_dsc_t *src;
+  lv_point_t pivot;
+  uint16_t steps;
+  lv_area_t bounds; // non transparent part of src
+  Sprite *sprites;
+};
+
+/* Pixels x1..x2 of a row relative to the pivot, empty when x1 > x2 */
+struct Span
+{
+  int16_t x1;
+  int16_t x2;
+};
+
+struct Hand
+{
+  lv_obj_t *obj;
+  const lv_img_dsc_t *src; // NULL when the hand geometry is unknown
+  lv_point_t pivot;
+  lv_area_t bounds;  // non transparent part of src
+  uint16_t minDelta; // [0.1 deg] smallest angle change that moves the tip by a pixel
+  int32_t angle;     // last angle set, after dropping invisible changes
+  SpriteSet *set;    // NULL when the image can not be cached
+  lv_coord_t x;   // position of the unrotated image in its parent
+  lv_coord_t y;
+  int32_t step;   // sprite shown, -1 while lvgl transforms or the blitter draws the source image
+  AlphaPlane *plane; // NULL when lvgl transforms the image instead of the blitter
+  lv_opa_t opa;      // img_opa style, cleared while blitting so lvgl draws nothing
+  int32_t cos;       // [1/65536] rotation the spans were made for
+  int32_t sin;
+  lv_coord_t spanY;  // row of spans[0] relative to the pivot
+  uint16_t spanRows;
+  uint16_t spanMax;
+  Span *spans;
+  uint32_t drawStart;
+  uint32_t drawUs;
+  uint32_t draws;
+};
+
+static Hand hands[MAX_HANDS];
+static uint8_t handCount = 0;
+
+static SpriteSet spriteSets[MAX_SPRITE_SETS];
+static uint8_t spriteSetCount = 0;
+
+static AlphaPlane planes[MAX_HANDS];
+static uint8_t planeCount = 0;
+
+static uint32_t cacheBytes = 0;
+static uint32_t cacheBudget = 0;
+static bool budgetSet = false; // by the first handAttach
+static uint32_t spriteCount = 0;
+static uint32_t spriteRenderUs = 0;
+
+static AlphaPlane *getPlane(const lv_img_dsc_t *src, const lv_area_t &bounds)
+{
+  for (uint8_t i = 0; i < planeCount; i++)
+  {
+    if (planes[i].src == src)
+    {
+      return &planes[i];
+    }
+  }
+  if (planeCount == MAX_HANDS || bounds.x2 < bounds.x1)
+  {
+    return NULL;
+  }
+
+  lv_coord_t w = lv_area_get_width(&bounds) + 2;
+  lv_coord_t h = lv_area_get_height(&bounds) + 2;
+  uint8_t *data = (uint8_t *)malloc(w * h); // small and sampled for every hand pixel, internal RAM first
+  if (!data)
+  {
+    data = (uint8_t *)ps_malloc(w * h);
+  }
+  if (!data)
+  {
+    return NULL;
+  }
+
+  AlphaPlane *plane = &planes[planeCount++];
+  plane->src = src;
+  plane->data = data;
+  plane->x = bounds.x1 - 1;
+  plane->y = bounds.y1 - 1;
+  plane->w = w;
+  plane->h = h;
+  handPlaneFill(plane);
+  return plane;
+}
+
+static bool renderSprite(SpriteSet *set, uint16_t step)
+{
+  uint32_t start = micros();
+
+  float rad = 2 * PI * step / set->steps; // clockwise, like lv_img_set_angle
+  AlphaPlane *plane = getPlane(set->src, set->bounds);
+  if (!plane)
+  {
+    return false;
+  }
+
+  // rotate the corners of the visible part around the pivot
+  lv_area_t box;
+  handRotateBox(set->bounds.x1 - set->pivot.x, set->bounds.y1 - set->pivot.y,
+                set->bounds.x2 - set->pivot.x, set->bounds.y2 - set->pivot.y, rad, &box);
+
+  lv_coord_t x1 = box.x1 - 1 + set->pivot.x;
+  lv_coord_t y1 = box.y1 - 1 + set->pivot.y;
+  lv_coord_t w = box.x2 + 1 + set->pivot.x - x1 + 1;
+  lv_coord_t h = box.y2 + 1 + set->pivot.y - y1 + 1;
+  uint32_t size = w * h;
+
+  if (cacheBytes + size > cacheBudget)
+  {
+    return false;
+  }
+
+  uint8_t *buf = (uint8_t *)ps_calloc(size, 1);
+  if (!buf)
+  {
+    return false;
+  }
+
+  int32_t c, s;
+  handFixedRotation(rad, &c, &s);
+  for (lv_coord_t y = 0; y < h; y++)
+  {
+    int32_t u1 = x1 - set->pivot.x;
+    int32_t u2 = u1 + w - 1;
+    int32_t v = y1 + y - set->pivot.y;
+    if (handRowSpan(plane, set->pivot, c, s, v, &u1, &u2))
+    {
+      handSampleRow(plane, set->pivot, c, s, u1, v, buf + y * w + u1 - (x1 - set->pivot.x), u2 - u1 + 1);
+    }
+  }
+
+  Sprite &sprite = set->sprites[step];
+  sprite.dsc.header.always_zero = 0;
+  sprite.dsc.header.w = w;
+  sprite.dsc.header.h = h;
+  sprite.dsc.header.cf = LV_IMG_CF_ALPHA_8BIT;
+  sprite.dsc.data_size = size;
+  sprite.dsc.data = buf;
+  sprite.x = x1;
+  sprite.y = y1;
+
+  cacheBytes += size;
+  spriteCount++;
+  spriteRenderUs += micros() - start;
+  return true;
+}
+
+static SpriteSet *getSpriteSet(const lv_img_dsc_t *src, const lv_point_t &pivot, uint16_t steps)
+{
+  for (uint8_t i = 0; i < spriteSetCount; i++)
+  {
+    SpriteSet *set = &spriteSets[i];
+    if (set->src == src && set->steps == steps && set->pivot.x == pivot.x && set->pivot.y == pivot.y)
+    {
+      return set;
+    }
+  }
+
+  if (spriteSetCount == MAX_SPRITE_SETS || steps == 0)
+  {
+    return NULL;
+  }
+  if (!handHasAlpha(src))
+  {
+    return NULL;
+  }
+
+  Sprite *sprites = (Sprite *)ps_calloc(steps, sizeof(Sprite));
+  if (!sprites)
+  {
+    sprites = (Sprite *)calloc(steps, sizeof(Sprite));
+  }
+  if (!sprites)
+  {
+    return NULL;
+  }
+
+  SpriteSet *set = &spriteSets[spriteSetCount++];
+  set->src = src;
+  set->pivot = pivot;
+  set->steps = steps;
+  set->sprites = sprites;
+  handImageBounds(src, &set->bounds);
+  return set;
+}
+
+static Hand *findHand(lv_obj_t *obj)
+{
+  for (uint8_t i = 0; i < handCount; i++)
+  {
+    if (hands[i].obj == obj)
+    {
+      return &hands[i];
+    }
+  }
+  return NULL;
+}
+
+static void handDrawEvent(lv_event_t *e)
+{
+  Hand *hand = (Hand *)lv_event_get_user_data(e);
+  if (lv_event_get_code(e) == LV_EVENT_DRAW_MAIN_BEGIN)
+  {
+    hand->drawStart = micros();
+  }
+  else
+  {
+    hand->drawUs += micros() - hand->drawStart;
+    hand->draws++;
+  }
+}
+
+/* Alpha only images are drawn in the recolor color, without a recolor style lvgl draws them black */
+static void setRecolor(lv_obj_t *obj)
+{
+  if (lv_obj_get_style_img_recolor_opa(obj, LV_PART_MAIN) == LV_OPA_TRANSP)
+  {
+    lv_obj_set_style_img_recolor(obj, lv_color_white(), LV_PART_MAIN | LV_STATE_DEFAULT);
+    lv_obj_set_style_img_recolor_opa(obj, LV_OPA_COVER, LV_PART_MAIN | LV_STATE_DEFAULT);
+  }
+}
+
+/* Precompute the row spans of the hand rotated by `angle`, the blitter clips them to each draw area */
+static void setSpans(Hand *hand, int32_t angle)
+{
+  AlphaPlane *plane = hand->plane;
+  float rad = angle * PI / 1800;
+  handFixedRotation(rad, &hand->cos, &hand->sin);
+
+  lv_area_t box;
+  handRotateBox(plane->x - hand->pivot.x, plane->y - hand->pivot.y, plane->x + plane->w - 1 - hand->pivot.x,
+                plane->y + plane->h - 1 - hand->pivot.y, rad, &box);
+  hand->spanY = box.y1;
+  hand->spanRows = min((int)lv_area_get_height(&box), (int)hand->spanMax);
+
+  for (uint16_t i = 0; i < hand->spanRows; i++)
+  {
+    int32_t u1 = box.x1;
+    int32_t u2 = box.x2;
+    if (!handRowSpan(plane, hand->pivot, hand->cos, hand->sin, box.y1 + i, &u1, &u2))
+    {
+      u1 = 0;
+      u2 = -1;
+    }
+    hand->spans[i].x1 = u1;
+    hand->spans[i].x2 = u2;
+  }
+}
+
+/* Draws the hand at lv_img_get_angle, lvgl has drawn nothing as the img_opa style is cleared */
+static void handBlitEvent(lv_event_t *e)
+{
+  static uint8_t row[HAND_BLIT_ROW];
+
+  Hand *hand = (Hand *)lv_event_get_user_data(e);
+  if (hand->step >= 0 || !hand->plane)
+  {
+    return;
+  }
+
+  lv_draw_ctx_t *draw_ctx = lv_event_get_draw_ctx(e);
+  const lv_area_t *clip = draw_ctx->clip_area;
+  lv_area_t coords;
+  lv_obj_get_coords(hand->obj, &coords);
+  lv_coord_t pivotX = coords.x1 + hand->pivot.x;
+  lv_coord_t pivotY = coords.y1 + hand->pivot.y;
+
+  lv_opa_t opa = hand->opa;
+  lv_opa_t objOpa = lv_obj_get_style_opa(hand->obj, LV_PART_MAIN);
+  if (objOpa < LV_OPA_MAX)
+  {
+    opa = (uint16_t)opa * objOpa >> 8;
+  }
+  if (opa <= LV_OPA_MIN)
+  {
+    return;
+  }
+  bool masked = lv_draw_mask_is_any(clip);
+
+  lv_area_t area;
+  lv_draw_sw_blend_dsc_t dsc;
+  lv_memset_00(&dsc, sizeof(dsc));
+  dsc.blend_area = &area;
+  dsc.mask_area = &area;
+  dsc.mask_buf = row;
+  dsc.color = lv_obj_get_style_img_recolor_filtered(hand->obj, LV_PART_MAIN);
+  dsc.opa = opa;
+  dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+
+  lv_coord_t y1 = max(clip->y1, (lv_coord_t)(pivotY + hand->spanY));
+  lv_coord_t y2 = min(clip->y2, (lv_coord_t)(pivotY + hand->spanY + hand->spanRows - 1));
+  for (lv_coord_t y = y1; y <= y2; y++)
+  {
+    const Span &span = hand->spans[y - pivotY - hand->spanY];
+    lv_coord_t x1 = max(clip->x1, (lv_coord_t)(pivotX + span.x1));
+    lv_coord_t x2 = min(clip->x2, (lv_coord_t)(pivotX + span.x2));
+
+    for (; x1 <= x2; x1 += HAND_BLIT_ROW)
+    {
+      int32_t n = min(x2 - x1 + 1, HAND_BLIT_ROW);
+      handSampleRow(hand->plane, hand->pivot, hand->cos, hand->sin, x1 - pivotX, y - pivotY, row, n);
+
+      dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+      if (masked)
+      {
+        dsc.mask_res = lv_draw_mask_apply(row, x1, y, n);
+        if (dsc.mask_res == LV_DRAW_MASK_RES_TRANSP)
+        {
+          continue;
+        }
+      }
+      lv_area_set(&area, x1, y, x1 + n - 1, y);
+      lv_draw_sw_blend(draw_ctx, &dsc);
+    }
+  }
+}
+
+/* While blitting lvgl keeps the angle for its invalidation and extra draw size, but draws nothing itself */
+static void setBlitting(Hand *hand, bool on)
+{
+  lv_opa_t opa = on ? LV_OPA_TRANSP : hand->opa;
+  if (lv_obj_get_style_img_opa(hand->obj, LV_PART_MAIN) != opa)
+  {
+    lv_obj_set_style_img_opa(hand->obj, opa, LV_PART_MAIN | LV_STATE_DEFAULT);
+  }
+}
+
+static void showTransformed(Hand *hand, int32_t angle)
+{
+  if (hand->step >= 0)
+  {
+    handShowSource(hand->obj, hand->set->src, hand->pivot);
+    lv_obj_set_pos(hand->obj, hand->x, hand->y);
+    hand->step = -1;
+  }
+  if (hand->plane)
+  {
+    setBlitting(hand, true);
+    setSpans(hand, angle);
+  }
+  lv_img_set_angle(hand->obj, angle);
+}
+
+static void showSprite(Hand *hand, int32_t angle)
+{
+  SpriteSet *set = hand->set;
+  int32_t step = (angle * set->steps + 1800) / 3600 % set->steps;
+  if (step == hand->step)
+  {
+    return;
+  }
+
+  Sprite &sprite = set->sprites[step];
+  if (!sprite.dsc.data && !renderSprite(set, step))
+  {
+    showTransformed(hand, angle);
+    return;
+  }
+
+  if (hand->step < 0)
+  {
+    lv_img_set_angle(hand->obj, 0);
+    if (hand->plane)
+    {
+      setBlitting(hand, false);
+    }
+  }
+  lv_img_set_src(hand->obj, &sprite.dsc);
+  lv_obj_set_pos(hand->obj, hand->x + sprite.x, hand->y + sprite.y);
+  hand->step = step;
+}
+
+static void showAngle(Hand *hand, int32_t angle)
+{
+  if (hand->set)
+  {
+    showSprite(hand, angle);
+    return;
+  }
+  showTransformed(hand, angle);
+}
+
+/* Angle actually on screen, sprites are quantized to their steps */
+static int32_t shownAngle(Hand *hand)
+{
+  if (hand->step >= 0)
+  {
+    return hand->step * 3600 / hand->set->steps;
+  }
+  return lv_img_get_angle(hand->obj);
+}
+
+/* Screen position of the pivot, the point the hand rotates around */
+static lv_point_t shownPivot(Hand *hand)
+{
+  lv_area_t coords;
+  lv_obj_get_coords(hand->obj, &coords);
+
+  lv_point_t pivot;
+  pivot.x = coords.x1 + hand->pivot.x;
+  pivot.y = coords.y1 + hand->pivot.y;
+  if (hand->step >= 0)
+  {
+    const Sprite &sprite = hand->set->sprites[hand->step];
+    pivot.x -= sprite.x;
+    pivot.y -= sprite.y;
+  }
+  return pivot;
+}
+
+/* Invalidate the hand at `angle` as a few boxes along its length */
+static void invalidateFootprint(Hand *hand, int32_t angle, const lv_point_t &pivot)
+{
+  lv_obj_t *parent = lv_obj_get_parent(hand->obj);
+  float rad = angle * PI / 1800;
+  float x1 = hand->bounds.x1 - hand->pivot.x;
+  float x2 = hand->bounds.x2 - hand->pivot.x;
+  float length = hand->bounds.y2 - hand->bounds.y1;
+
+  for (uint8_t i = 0; i < HAND_INV_SEGMENTS; i++)
+  {
+    float y1 = hand->bounds.y1 - hand->pivot.y + length * i / HAND_INV_SEGMENTS;
+    float y2 = hand->bounds.y1 - hand->pivot.y + length * (i + 1) / HAND_INV_SEGMENTS;
+
+    lv_area_t box;
+    handRotateBox(x1, y1, x2, y2, rad, &box);
+    box.x1 += pivot.x - HAND_INV_MARGIN;
+    box.y1 += pivot.y - HAND_INV_MARGIN;
+    box.x2 += pivot.x + HAND_INV_MARGIN;
+    box.y2 += pivot.y + HAND_INV_MARGIN;
+    lv_obj_invalidate_area(parent, &box);
+  }
+}
+
+/* Change the angle with lvgl's own invalidation disabled and invalidate only the old and new footprints */
+static void showTight(Hand *hand, int32_t angle)
+{
+  lv_disp_t *disp = lv_obj_get_disp(hand->obj);
+
+  // pending layout changes of other widgets still invalidate normally
+  lv_obj_update_layout(hand->obj);
+  int32_t oldAngle = shownAngle(hand);
+  lv_point_t oldPivot = shownPivot(hand);
+
+  lv_disp_enable_invalidation(disp, false);
+  showAngle(hand, angle);
+  lv_obj_update_layout(hand->obj); // the sprite moves here, not at the next refresh
+  lv_disp_enable_invalidation(disp, true);
+
+  int32_t newAngle = shownAngle(hand);
+  lv_point_t newPivot = shownPivot(hand);
+  if (newAngle != oldAngle || newPivot.x != oldPivot.x || newPivot.y != oldPivot.y)
+  {
+    invalidateFootprint(hand, oldAngle, oldPivot);
+    invalidateFootprint(hand, newAngle, newPivot);
+  }
+}
+
+/* Draw the hand with the blitter whenever no sprite is shown */
+static void blitAttach(Hand *hand)
+{
+  if (!handHasAlpha(hand->src))
+  {
+    return;
+  }
+  AlphaPlane *plane = getPlane(hand->src, hand->bounds);
+  if (!plane)
+  {
+    Timber.w("Hand %d can not be blitted", (int)(hand - hands));
+    return;
+  }
+
+  // rows of the plane rotated to any angle
+  float radius = 1;
+  lv_coord_t cornersX[] = {plane->x, (lv_coord_t)(plane->x + plane->w - 1)};
+  lv_coord_t cornersY[] = {plane->y, (lv_coord_t)(plane->y + plane->h - 1)};
+  for (lv_coord_t cx : cornersX)
+  {
+    for (lv_coord_t cy : cornersY)
+    {
+      radius = max(radius, hypotf(cx - hand->pivot.x, cy - hand->pivot.y));
+    }
+  }
+  hand->spanMax = 2 * (uint16_t)ceilf(radius) + 3;
+  hand->spans = (Span *)malloc(hand->spanMax * sizeof(Span));
+  if (!hand->spans)
+  {
+    return;
+  }
+
+  hand->plane = plane;
+  hand->opa = lv_obj_get_style_img_opa(hand->obj, LV_PART_MAIN);
+  setRecolor(hand->obj); // drawn in the recolor color like the sprites
+  lv_obj_add_event_cb(hand->obj, handBlitEvent, LV_EVENT_DRAW_MAIN, hand);
+  showTransformed(hand, hand->angle);
+}
+
+/* The screen of the hand was deleted, its slot is free for the hand of the next one */
+static void handDeleteEvent(lv_event_t *e)
+{
+  Hand *hand = (Hand *)lv_event_get_user_data(e);
+  free(hand->spans);
+  *hand = Hand(); // sprites and planes stay cached for the same image
+}
+
+void handAttach(lv_obj_t *obj, uint16_t steps)
+{
+  if (!budgetSet)
+  {
+    budgetSet = true;
+    cacheBudget = min((uint32_t)HAND_CACHE_BUDGET,
+                      (uint32_t)(heap_caps_get_free_size(MALLOC_CAP_SPIRAM) / 100 * HAND_CACHE_SHARE));
+    Timber.i("Hands: %u KB sprite budget", cacheBudget / 1024);
+  }
+  if (findHand(obj))
+  {
+    return;
+  }
+  Hand *hand = findHand(NULL);
+  if (!hand)
+  {
+    if (handCount == MAX_HANDS)
+    {
+      return;
+    }
+    hand = &hands[handCount++];
+  }
+  hand->obj = obj;
+  hand->minDelta = 1;
+  hand->angle = lv_img_get_angle(obj);
+  hand->step = -1;
+
+  lv_obj_add_event_cb(obj, handDrawEvent, LV_EVENT_DRAW_MAIN_BEGIN, hand);
+  lv_obj_add_event_cb(obj, handDrawEvent, LV_EVENT_DRAW_MAIN_END, hand);
+  lv_obj_add_event_cb(obj, handDeleteEvent, LV_EVENT_DELETE, hand);
+
+  if (lv_img_src_get_type(lv_img_get_src(obj)) != LV_IMG_SRC_VARIABLE)
+  {
+    return;
+  }
+
+  hand->src = (const lv_img_dsc_t *)lv_img_get_src(obj);
+  lv_img_get_pivot(obj, &hand->pivot);
+  handImageBounds(hand->src, &hand->bounds);
+  if (handAlphaOnly(hand->src))
+  {
+    setRecolor(obj);
+  }
+
+  // the tip is the visible corner farthest from the pivot
+  float radius = 1;
+  lv_coord_t cornersX[] = {hand->bounds.x1, hand->bounds.x2};
+  lv_coord_t cornersY[] = {hand->bounds.y1, hand->bounds.y2};
+  for (lv_coord_t cx : cornersX)
+  {
+    for (lv_coord_t cy : cornersY)
+    {
+      radius = max(radius, hypotf(cx - hand->pivot.x, cy - hand->pivot.y));
+    }
+  }
+  hand->minDelta = max(1, (int)ceilf(3600 / (2 * PI * radius)));
+
+#ifdef HAND_BLIT
+  blitAttach(hand);
+#endif
+
+#ifdef HAND_CACHE
+  hand->set = getSpriteSet(hand->src, hand->pivot, steps);
+  if (!hand->set)
+  {
+    Timber.w("Hand %d can not be cached", (int)(hand - hands));
+    return;
+  }
+
+  setRecolor(obj); // sprites are alpha only
+
+  // sprites are placed by their top left corner instead of the alignment
+  lv_obj_update_layout(obj);
+  hand->x = lv_obj_get_x(obj);
+  hand->y = lv_obj_get_y(obj);
+  lv_obj_set_align(obj, LV_ALIGN_TOP_LEFT);
+  lv_obj_set_pos(obj, hand->x, hand->y);
+
+  showSprite(hand, lv_img_get_angle(obj));
+#endif
+}
+
+void handSetAngle(lv_obj_t *obj, int32_t angle)
+{
+  angle %= 3600;
+  if (angle < 0)
+  {
+    angle += 3600;
+  }
+
+  Hand *hand = findHand(obj);
+  if (!hand)
+  {
+    lv_img_set_angle(obj, angle);
+    return;
+  }
+
+  // round to the smallest visible change
+  angle = (angle + hand->minDelta / 2) / hand->minDelta * hand->minDelta % 3600;
+  if (angle == hand->angle)
+  {
+    return;
+  }
+  hand->angle = angle;
+
+#ifdef HAND_TIGHT_INV
+  if (hand->src)
+  {
+    showTight(hand, angle);
+    return;
+  }
+#endif
+  showAngle(hand, angle);
+}
+
+uint16_t handResolution(lv_obj_t *obj)
+{
+  Hand *hand = findHand(obj);
+  if (!hand)
+  {
+    return 1;
+  }
+  if (hand->set)
+  {
+    return max(hand->minDelta, (uint16_t)(3600 / hand->set->steps));
+  }
+  return hand->minDelta;
+}
+
+void handPrintStats()
+{
+  Timber.i("Hands: %u sprites, %u of %u KB, %u us rendering", spriteCount, cacheBytes / 1024, cacheBudget / 1024,
+           spriteRenderUs);
+  spriteRenderUs = 0;
+
+  for (uint8_t i = 0; i < handCount; i++)
+  {
+    Hand *hand = &hands[i];
+    if (hand->draws)
+    {
+      Timber.i("Hand %d: %u draws, %u us per draw (%s)", i, hand->draws, hand->drawUs / hand->draws,
+               hand->step >= 0 ? "sprite" : hand->plane ? "blit" : "transform");
+    }
+    hand->drawUs = 0;
+    hand->draws = 0;
+  }
+}
@@ -0,0 +1,264 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <Arduino.h>
+#include <Timber.h>
+#include <esp_heap_caps.h>
+#include "img_cache.h"
+#include "rle.h"
+
+#define IMG_CF_RLE_TRUE_COLOR LV_IMG_CF_USER_ENCODED_0
+#define IMG_CF_RLE_TRUE_COLOR_ALPHA LV_IMG_CF_USER_ENCODED_1
+
+struct CacheEntry
+{
+  const lv_img_dsc_t *src; // NULL when free
+  uint8_t *data;
+  uint32_t size;
+  uint32_t lastUse;
+  uint16_t users; // open decoder descriptors, not evicted while drawing
+  bool pinned;
+};
+
+static CacheEntry entries[IMG_CACHE_ENTRIES];
+static uint32_t cacheBytes = 0;
+static uint32_t cacheBudget = 0; // set by imgCacheBegin
+static uint32_t useCounter = 0;
+
+static uint32_t hits = 0;
+static uint32_t misses = 0;
+static uint32_t evictions = 0;
+static uint32_t decodeUs = 0;
+
+static lv_img_cf_t decodedFormat(const lv_img_dsc_t *img)
+{
+  switch (img->header.cf)
+  {
+  case IMG_CF_RLE_TRUE_COLOR:
+    return LV_IMG_CF_TRUE_COLOR;
+  case IMG_CF_RLE_TRUE_COLOR_ALPHA:
+    return LV_IMG_CF_TRUE_COLOR_ALPHA;
+  default:
+    return LV_IMG_CF_UNKNOWN;
+  }
+}
+
+static CacheEntry *findEntry(const lv_img_dsc_t *img)
+{
+  for (CacheEntry &entry : entries)
+  {
+    if (entry.src == img)
+    {
+      return &entry;
+    }
+  }
+  return NULL;
+}
+
+static void evict(CacheEntry *entry)
+{
+  free(entry->data);
+  cacheBytes -= entry->size;
+  entry->src = NULL;
+  entry->data = NULL;
+  evictions++;
+}
+
+/* Evict the least recently used image that is not pinned or drawn, false when there is none */
+static bool evictOldest()
+{
+  CacheEntry *oldest = NULL;
+  for (CacheEntry &entry : entries)
+  {
+    if (entry.src && !entry.pinned && !entry.users && (!oldest || entry.lastUse < oldest->lastUse))
+    {
+      oldest = &entry;
+    }
+  }
+  if (oldest)
+  {
+    evict(oldest);
+  }
+  return oldest != NULL;
+}
+
+/* Evict least recently used images until `size` more bytes fit, returns a free entry */
+static CacheEntry *makeRoom(uint32_t size)
+{
+  for (;;)
+  {
+    CacheEntry *slot = NULL;
+    for (CacheEntry &entry : entries)
+    {
+      if (!entry.src)
+      {
+        slot = &entry;
+        break;
+      }
+    }
+    if (slot && cacheBytes + size <= cacheBudget)
+    {
+      return slot;
+    }
+    if (!evictOldest())
+    {
+      return NULL;
+    }
+  }
+}
+
+static CacheEntry *decode(const lv_img_dsc_t *img)
+{
+  CacheEntry *entry = findEntry(img);
+  if (entry)
+  {
+    hits++;
+    entry->lastUse = ++useCounter;
+    return entry;
+  }
+  misses++;
+
+  uint8_t px = lv_img_cf_get_px_size(decodedFormat(img)) / 8;
+  uint32_t size = (uint32_t)img->header.w * img->header.h * px;
+  entry = makeRoom(size);
+  uint8_t *data = entry ? (uint8_t *)ps_malloc(size) : NULL;
+  while (entry && !data && evictOldest())
+  {
+    data = (uint8_t *)ps_malloc(size); // PSRAM is shared with the hand sprites and snapshots
+  }
+  if (!data)
+  {
+    Timber.w("Image %dx%d (%u bytes) does not fit the image cache", img->header.w, img->header.h, size);
+    return NULL;
+  }
+
+  uint32_t start = micros();
+  uint32_t decoded = rleDecode(img->data, img->data + img->data_size, data, size, px);
+  uint32_t us = micros() - start;
+  if (decoded < size)
+  {
+    Timber.w("Image %dx%d is truncated, %u of %u bytes decoded", img->header.w, img->header.h, decoded, size);
+    memset(data + decoded, 0, size - decoded);
+  }
+  decodeUs += us;
+  Timber.i("Image %dx%d decoded in %u us, %u -> %u bytes", img->header.w, img->header.h, us, img->data_size, size);
+
+  entry->src = img;
+  entry->data = data;
+  entry->size = size;
+  entry->lastUse = ++useCounter;
+  entry->users = 0;
+  entry->pinned = false;
+  cacheBytes += size;
+  return entry;
+}
+
+static lv_res_t decoderInfo(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header)
+{
+  if (lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE)
+  {
+    return LV_RES_INV;
+  }
+  const lv_img_dsc_t *img = (const lv_img_dsc_t *)src;
+  lv_img_cf_t cf = decodedFormat(img);
+  if (cf == LV_IMG_CF_UNKNOWN)
+  {
+    return LV_RES_INV;
+  }
+
+  *header = img->header;
+  header->cf = cf;
+  return LV_RES_OK;
+}
+
+static lv_res_t decoderOpen(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc)
+{
+  if (dsc->src_type != LV_IMG_SRC_VARIABLE)
+  {
+    return LV_RES_INV;
+  }
+  CacheEntry *entry = decode((const lv_img_dsc_t *)dsc->src);
+  if (!entry)
+  {
+    return LV_RES_INV;
+  }
+
+  entry->users++;
+  dsc->user_data = entry;
+  dsc->img_data = entry->data;
+  dsc->time_to_open = 0; // the cache is ours, keep lvgl from caching it again
+  return LV_RES_OK;
+}
+
+static void decoderClose(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc)
+{
+  CacheEntry *entry = (CacheEntry *)dsc->user_data;
+  if (entry && entry->users)
+  {
+    entry->users--;
+  }
+  dsc->user_data = NULL;
+}
+
+void imgCacheBegin()
+{
+  cacheBudget = min((uint32_t)IMG_CACHE_BUDGET,
+                    (uint32_t)(heap_caps_get_free_size(MALLOC_CAP_SPIRAM) / 100 * IMG_CACHE_SHARE));
+  Timber.i("Image cache: %u KB budget", cacheBudget / 1024);
+
+  lv_img_decoder_t *decoder = lv_img_decoder_create();
+  lv_img_decoder_set_info_cb(decoder, decoderInfo);
+  lv_img_decoder_set_open_cb(decoder, decoderOpen);
+  lv_img_decoder_set_close_cb(decoder, decoderClose);
+}
+
+void imgCachePin(const lv_img_dsc_t *img)
+{
+  if (!img || lv_img_src_get_type(img) != LV_IMG_SRC_VARIABLE || decodedFormat(img) == LV_IMG_CF_UNKNOWN)
+  {
+    return;
+  }
+  CacheEntry *entry = decode(img);
+  if (entry)
+  {
+    entry->pinned = true;
+  }
+}
+
+void imgCachePrintStats()
+{
+  uint8_t count = 0;
+  for (CacheEntry &entry : entries)
+  {
+    count += entry.src != NULL;
+  }
+
+  Timber.i("Image cache: %u hits, %u misses, %u evictions, %u images, %u of %u KB, %u us decoding", hits, misses,
+           evictions, count, cacheBytes / 1024, cacheBudget / 1024, decodeUs);
+  hits = 0;
+  misses = 0;
+  evictions = 0;
+  decodeUs = 0;
+}
@@ -0,0 +1,393 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <string.h>
+#include <stdint.h>
+#include "lv_alloc.h"
+
+#ifdef ESP_PLATFORM
+#include <Arduino.h>
+#include <Timber.h>
+#include <esp_heap_caps.h>
+#define TIER_ALLOC(size, caps) heap_caps_malloc(size, caps)
+#define TIER_REALLOC(p, size, caps) heap_caps_realloc(p, size, caps)
+#define TIER_FREE(p) heap_caps_free(p)
+#define TIER_LARGEST_FREE(caps) heap_caps_get_largest_free_block(caps)
+#define TIER_FREE_SIZE(caps) heap_caps_get_free_size(caps)
+#define ALLOC_LOG(...) Timber.i(__VA_ARGS__)
+#define ALLOC_TRACE(...) Serial.printf(__VA_ARGS__)
+#define SLAB_CAPS (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+#define INTERNAL_CAPS (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+#define PSRAM_CAPS (MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT)
+#else
+// host builds (allocation trace replays) use the C heap for every tier
+#include <stdio.h>
+#include <stdlib.h>
+#define TIER_ALLOC(size, caps) malloc(size)
+#define TIER_REALLOC(p, size, caps) realloc(p, size)
+#define TIER_FREE(p) free(p)
+#define TIER_LARGEST_FREE(caps) 0
+#define TIER_FREE_SIZE(caps) 0
+#define ALLOC_LOG(...) (printf(__VA_ARGS__), putchar('\n'))
+#define ALLOC_TRACE(...) printf(__VA_ARGS__)
+#define SLAB_CAPS 0
+#define INTERNAL_CAPS 0
+#define PSRAM_CAPS 0
+#endif
+
+/* Slab size classes, 44 KB of internal RAM taken on the first allocation. Size the counts with tools/alloc_trace.py */
+struct SlabClass
+{
+  uint16_t size;       // [bytes] block size, a multiple of 8
+  uint16_t blocks;     // block count
+  uint8_t *base;
+  void *freeList;      // the first word of a free block points to the next one
+  uint16_t *requested; // [bytes] asked for, per block, 0 when free
+  uint16_t used;
+  uint16_t peak;
+  uint32_t requestedBytes;
+};
+
+static SlabClass slabs[] = {
+    {16, 256},
+    {32, 384},
+    {64, 192},
+    {128, 64},
+    {LV_ALLOC_SLAB_MAX, 32},
+};
+
+#define SLAB_CLASSES (sizeof(slabs) / sizeof(slabs[0]))
+
+static uint8_t *slabStart = NULL;
+static uint8_t *slabEnd = NULL;
+static bool slabReady = false;
+
+/* Heap backed tiers keep the block size in front of the block */
+struct BlockHeader
+{
+  uint32_t size;
+  uint32_t tier;
+};
+
+enum Tier
+{
+  TIER_SLAB,
+  TIER_INTERNAL,
+  TIER_PSRAM,
+  TIER_COUNT
+};
+
+struct TierStats
+{
+  uint32_t inUse; // [bytes] asked for
+  uint32_t peak;
+  uint32_t allocs;
+  uint32_t overflows; // requests handed to the next tier
+};
+
+static TierStats tiers[TIER_COUNT];
+static const char *tierNames[TIER_COUNT] = {"slab", "internal", "psram"};
+static const uint32_t tierCaps[TIER_COUNT] = {SLAB_CAPS, INTERNAL_CAPS, PSRAM_CAPS};
+
+static uint32_t totalInUse = 0;
+static uint32_t totalPeak = 0;
+
+static void account(Tier tier, int32_t bytes)
+{
+  TierStats &stats = tiers[tier];
+  stats.inUse += bytes;
+  if (stats.inUse > stats.peak)
+  {
+    stats.peak = stats.inUse;
+  }
+  totalInUse += bytes;
+  if (totalInUse > totalPeak)
+  {
+    totalPeak = totalInUse;
+  }
+}
+
+static void slabBegin()
+{
+  slabReady = true;
+
+  size_t total = 0;
+  size_t sizes = 0;
+  for (SlabClass &slab : slabs)
+  {
+    total += (size_t)slab.size * slab.blocks;
+    sizes += slab.blocks * sizeof(uint16_t);
+  }
+  slabStart = (uint8_t *)TIER_ALLOC(total + sizes, SLAB_CAPS);
+  if (!slabStart)
+  {
+    return; // everything goes to the heap tiers
+  }
+  slabEnd = slabStart + total;
+
+  uint8_t *block = slabStart;
+  uint16_t *requested = (uint16_t *)slabEnd;
+  for (SlabClass &slab : slabs)
+  {
+    slab.base = block;
+    slab.requested = requested;
+    requested += slab.blocks;
+    for (uint16_t i = 0; i < slab.blocks; i++)
+    {
+      *(void **)block = slab.freeList;
+      slab.freeList = block;
+      slab.requested[i] = 0;
+      block += slab.size;
+    }
+  }
+}
+
+static SlabClass *slabOf(void *p)
+{
+  if ((uint8_t *)p < slabStart || (uint8_t *)p >= slabEnd)
+  {
+    return NULL;
+  }
+  for (SlabClass &slab : slabs)
+  {
+    if ((uint8_t *)p < slab.base + (size_t)slab.size * slab.blocks)
+    {
+      return &slab;
+    }
+  }
+  return NULL;
+}
+
+static void *slabAlloc(size_t size)
+{
+  if (!slabReady)
+  {
+    slabBegin();
+  }
+  for (SlabClass &slab : slabs)
+  {
+    if (size > slab.size)
+    {
+      continue;
+    }
+    if (!slab.freeList)
+    {
+      continue; // a bigger class wastes some bytes but stays in internal RAM
+    }
+    void *p = slab.freeList;
+    slab.freeList = *(void **)p;
+    slab.requested[((uint8_t *)p - slab.base) / slab.size] = size;
+    slab.requestedBytes += size;
+    if (++slab.used > slab.peak)
+    {
+      slab.peak = slab.used;
+    }
+    account(TIER_SLAB, size);
+    tiers[TIER_SLAB].allocs++;
+    return p;
+  }
+  tiers[TIER_SLAB].overflows++;
+  return NULL;
+}
+
+static size_t slabFree(SlabClass *slab, void *p)
+{
+  uint16_t &requested = slab->requested[((uint8_t *)p - slab->base) / slab->size];
+  size_t size = requested;
+  slab->requestedBytes -= size;
+  requested = 0;
+  slab->used--;
+  *(void **)p = slab->freeList;
+  slab->freeList = p;
+  account(TIER_SLAB, -(int32_t)size);
+  return size;
+}
+
+static void *heapAlloc(Tier tier, size_t size)
+{
+  BlockHeader *header = (BlockHeader *)TIER_ALLOC(sizeof(BlockHeader) + size, tierCaps[tier]);
+  if (!header)
+  {
+    tiers[tier].overflows++;
+    return NULL;
+  }
+  header->size = size;
+  header->tier = tier;
+  account(tier, size);
+  tiers[tier].allocs++;
+  return header + 1;
+}
+
+static void *allocBlock(size_t size)
+{
+  void *p = NULL;
+  if (size <= LV_ALLOC_SLAB_MAX)
+  {
+    p = slabAlloc(size);
+  }
+  if (!p && size < LV_ALLOC_PSRAM_MIN)
+  {
+    p = heapAlloc(TIER_INTERNAL, size);
+  }
+  if (!p)
+  {
+    p = heapAlloc(TIER_PSRAM, size);
+  }
+  if (!p && size >= LV_ALLOC_PSRAM_MIN)
+  {
+    p = heapAlloc(TIER_INTERNAL, size);
+  }
+  return p;
+}
+
+static void freeBlock(void *p)
+{
+  if (!p)
+  {
+    return;
+  }
+  SlabClass *slab = slabOf(p);
+  if (slab)
+  {
+    slabFree(slab, p);
+    return;
+  }
+  BlockHeader *header = (BlockHeader *)p - 1;
+  account((Tier)header->tier, -(int32_t)header->size);
+  TIER_FREE(header);
+}
+
+static void *reallocBlock(void *p, size_t size)
+{
+  if (!p)
+  {
+    return allocBlock(size);
+  }
+
+  SlabClass *slab = slabOf(p);
+  if (slab)
+  {
+    uint16_t &requested = slab->requested[((uint8_t *)p - slab->base) / slab->size];
+    if (size <= slab->size)
+    {
+      slab->requestedBytes += size - requested;
+      account(TIER_SLAB, (int32_t)size - requested);
+      requested = size;
+      return p;
+    }
+    void *moved = allocBlock(size);
+    if (moved)
+    {
+      memcpy(moved, p, requested);
+      slabFree(slab, p);
+    }
+    return moved;
+  }
+
+  // stay in the tier the block came from, lvgl mostly grows label texts a little
+  BlockHeader *header = (BlockHeader *)p - 1;
+  Tier tier = (Tier)header->tier;
+  uint32_t oldSize = header->size;
+  BlockHeader *grown = (BlockHeader *)TIER_REALLOC(header, sizeof(BlockHeader) + size, tierCaps[tier]);
+  if (!grown)
+  {
+    void *moved = allocBlock(size);
+    if (moved)
+    {
+      memcpy(moved, p, oldSize < size ? oldSize : size);
+      freeBlock(p);
+    }
+    return moved;
+  }
+  grown->size = size;
+  account(tier, (int32_t)size - (int32_t)oldSize);
+  return grown + 1;
+}
+
+extern "C" void *lvAlloc(size_t size)
+{
+  void *p = allocBlock(size);
+#ifdef LV_ALLOC_TRACE
+  ALLOC_TRACE("lvmem a %p %u\n", p, (unsigned)size);
+#endif
+  return p;
+}
+
+extern "C" void lvFree(void *p)
+{
+#ifdef LV_ALLOC_TRACE
+  if (p)
+  {
+    ALLOC_TRACE("lvmem f %p\n", p);
+  }
+#endif
+  freeBlock(p);
+}
+
+extern "C" void *lvRealloc(void *p, size_t size)
+{
+  void *moved = reallocBlock(p, size);
+#ifdef LV_ALLOC_TRACE
+  ALLOC_TRACE("lvmem r %p %p %u\n", p, moved, (unsigned)size);
+#endif
+  return moved;
+}
+
+extern "C" void lvAllocUsage(uint32_t *inUse, uint32_t *peak)
+{
+  *inUse = totalInUse;
+  *peak = totalPeak;
+}
+
+extern "C" void lvAllocPrintStats(void)
+{
+  for (uint8_t i = 0; i < TIER_COUNT; i++)
+  {
+    const TierStats &stats = tiers[i];
+    uint32_t fragmentation = 0; // [%]
+    if (i == TIER_SLAB)
+    {
+      // bytes lost to rounding up to the size class
+      uint32_t blockBytes = 0;
+      for (const SlabClass &slab : slabs)
+      {
+        blockBytes += (uint32_t)slab.used * slab.size;
+      }
+      fragmentation = blockBytes ? 100 - stats.inUse * 100 / blockBytes : 0;
+    }
+    else
+    {
+      // free memory not usable for one block
+      uint32_t freeBytes = TIER_FREE_SIZE(tierCaps[i]);
+      fragmentation = freeBytes ? 100 - TIER_LARGEST_FREE(tierCaps[i]) * 100 / freeBytes : 0;
+    }
+    ALLOC_LOG("LVGL mem %s: %u B in use, %u B peak, %u allocs, %u overflows, %u%% fragmented", tierNames[i],
+              stats.inUse, stats.peak, stats.allocs, stats.overflows, fragmentation);
+  }
+  for (const SlabClass &slab : slabs)
+  {
+    ALLOC_LOG("LVGL mem slab %u B: %u/%u blocks, %u peak", slab.size, slab.used, slab.blocks, slab.peak);
+  }
+}
@@ -38,13 +38,34 @@
 #include <LovyanGFX.hpp>
 #include <ChronosESP32.h>
 #include <Timber.h>
+#include "render.h"
+#include "ui_queue.h"
+#include "clock_face.h"
+#include "hand_cache.h"
+#include "digit_atlas.h"
+#include "img_cache.h"
+#include "res_pack.h"
+#include "assets.h"
+#include "lv_alloc.h"
+#include "telemetry.h"
+#include "blend.h"
+#include "notify_list.h"
+#include "pager.h"
+#include "slide.h"
+#include "screens.h"
+#include "overlay.h"
+#include "touch.h"
 
 #ifdef USE_UI
 #include "ui/ui.h"
+extern "C" void ui_homeScreen_screen_init(void);
+extern "C" void ui_clockScreen_screen_init(void);
 #endif
 
 #ifdef PLUS
 #define SCR 30
+#define FLUSH_BUS_NAME "Parallel8"
+#define TOUCH_INT 7
 class LGFX : public lgfx::LGFX_Device
 {
 
@@ -130,7 +151,7 @@ public:
       cfg.x_max = 319; // Maximum X value (raw value) obtained from the touchscreen
       cfg.y_min = 0;   // Minimum Y value obtained from touchscreen (raw value)
       cfg.y_max = 479; // Maximum Y value (raw value) obtained from the touchscreen
-      cfg.pin_int = 7; // pin number to which INT is connected
+      cfg.pin_int = TOUCH_INT; // pin number to which INT is connected
       cfg.bus_shared = false;
       cfg.offset_rotation = 0;
 
@@ -151,6 +172,8 @@ public:
 
 #else
 #define SCR 8
+#define FLUSH_BUS_NAME "SPI"
+#define TOUCH_INT 39
 class LGFX : public lgfx::LGFX_Device
 {
 
@@ -237,7 +260,7 @@ public:
       cfg.x_max = 319;  // Maximum X value (raw value) obtained from the touchscreen
       cfg.y_min = 0;    // Minimum Y value obtained from touchscreen (raw value)
       cfg.y_max = 479;  // Maximum Y value (raw value) obtained from the touchscreen
-      cfg.pin_int = 39; // pin number to which INT is connected
+      cfg.pin_int = TOUCH_INT; // pin number to which INT is connected
       cfg.bus_shared = false;
       cfg.offset_rotation = 0;
 
@@ -270,43 +293,86 @@ static lv_disp_drv_t disp_drv;
 static lv_color_t disp_draw_buf[screenWidth * SCR];
 static lv_color_t disp_draw_buf2[screenWidth * SCR];
 
-lv_img_dsc_t digits[10] = {ui_img_zero_png, ui_img_one_png, ui_img_two_png, ui_img_three_png, ui_img_four_png,
-                           ui_img_five_png, ui_img_six_png, ui_img_seven_png, ui_img_eight_png, ui_img_nine_png};
-
-lv_img_dsc_t notificationIcons[] = {
-    ui_img_sms_png,       // SMS
-    ui_img_mail_png,      // Mail
-    ui_img_penguin_png,   // Penguin
-    ui_img_skype_png,     // Skype
-    ui_img_whatsapp_png,  // WhatsApp
-    ui_img_mail_png,      // Mail2
-    ui_img_line_png,      // Line
-    ui_img_twitter_png,   // Twitter
-    ui_img_facebook_png,  // Facebook
-    ui_img_messenger_png, // Messenger
-    ui_img_instagram_png, // Instagram
-    ui_img_weibo_png,     // Weibo
-    ui_img_kakao_png,     // Kakao
-    ui_img_viber_png,     // Viber
-    ui_img_vkontakte_png, // Vkontakte
-    ui_img_telegram_png,  // Telegram
-    ui_img_wechat_png     // Wechat
+/* Flush timing, reset every FLUSH_STATS_INTERVAL ms */
+struct FlushStats
+{
+  uint32_t strips; // areas handed to the bus
+  uint32_t bytes;  // pixel bytes transferred
+  uint32_t busyUs; // time from DMA start until the buffer was released
+  uint32_t waitUs; // time lvgl was blocked waiting for a free buffer
+};
+
+static FlushStats flushStats;
+static uint32_t flushStart;
+static volatile bool flushPending = false;
+static uint32_t flushStatsTime;
+static uint32_t cpuStatsTime;
+static uint32_t clockStatsTime;
+static uint32_t memStatsTime;
+static uint32_t refrPixels;
+
+static lv_indev_t *touchIndev;
+#ifndef TOUCH_TASK
+static volatile bool touchIrq = false;
+#endif
+
+/* Chronos callbacks -> render task */
+static SpscQueue<UiCommand, UI_QUEUE_SIZE> uiQueue;
+
+/* Chronos state shown on the home screen, applied again when the screen is built */
+static UiCommand lastWeather;
+static UiCommand lastCity;
+static bool hasWeather = false;
+static bool hasCity = false;
+static bool hasTime = false;
+
+enum ScreenId : uint8_t
+{
+  SCREEN_HOME,
+  SCREEN_CLOCK
+};
+
+const Asset notificationIcons[] = {
+    ASSET_SMS,       // SMS
+    ASSET_MAIL,      // Mail
+    ASSET_PENGUIN,   // Penguin
+    ASSET_SKYPE,     // Skype
+    ASSET_WHATSAPP,  // WhatsApp
+    ASSET_MAIL,      // Mail2
+    ASSET_LINE,      // Line
+    ASSET_TWITTER,   // Twitter
+    ASSET_FACEBOOK,  // Facebook
+    ASSET_MESSENGER, // Messenger
+    ASSET_INSTAGRAM, // Instagram
+    ASSET_WEIBO,     // Weibo
+    ASSET_KAKAO,     // Kakao
+    ASSET_VIBER,     // Viber
+    ASSET_VKONTAKTE, // Vkontakte
+    ASSET_TELEGRAM,  // Telegram
+    ASSET_WECHAT     // Wechat
 };
 
-lv_img_dsc_t weatherIcons[] = {
-    ui_img_602206286,
-    ui_img_602205261,
-    ui_img_602199888,
-    ui_img_602207311,
-    ui_img_dy4_png,
-    ui_img_602200913,
-    ui_img_602195540,
-    ui_img_602202963};
+const Asset weatherIcons[] = {
+    ASSET_WEATHER_0,
+    ASSET_WEATHER_1,
+    ASSET_WEATHER_2,
+    ASSET_WEATHER_3,
+    ASSET_WEATHER_4,
+    ASSET_WEATHER_5,
+    ASSET_WEATHER_6,
+    ASSET_WEATHER_7};
 
 String weatherConditions[] = {"Partial Clouds", "Sunny", "Snow", "Rain", "Cloudy", "Tornado", "Windy", "Haze"};
 
 int getNotificationIconIndex(int id);
 int getWeatherIconIndex(int id);
+uint32_t renderFrame();
+void chronosLoop();
+void applyUiCommand(const UiCommand &cmd);
+void slidePrepare(lv_obj_t *screen);
+void buildHome();
+void homeBuilt(lv_obj_t *screen);
+void clockBuilt(lv_obj_t *screen);
 
 
 int getWeatherIconIndex(int id)
@@ -384,9 +450,126 @@ void my_disp_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color
     tft.endWrite();
   }
 
-  tft.pushImageDMA(area->x1, area->y1, area->x2 - area->x1 + 1, area->y2 - area->y1 + 1, (lgfx::swap565_t *)&color_p->full);
+  uint32_t w = area->x2 - area->x1 + 1;
+  uint32_t h = area->y2 - area->y1 + 1;
+
+  flushStats.strips++;
+  flushStats.bytes += w * h * sizeof(lv_color_t);
+  telemetry.flushes++;
+  telemetry.flushBytes += w * h * sizeof(lv_color_t);
+  flushStart = micros();
+  flushPending = true;
+
+  tft.pushImageDMA(area->x1, area->y1, w, h, (lgfx::swap565_t *)&color_p->full);
+
+  // lv_disp_flush_ready is called by my_disp_flush_poll once the transfer is done,
+  // so LVGL keeps rendering into the other buffer while this one is on the bus
+}
 
-  lv_disp_flush_ready(disp); /* tell lvgl that flushing is done */
+/* Release the buffer to lvgl once its DMA transfer has completed */
+void my_disp_flush_poll(lv_disp_drv_t *disp)
+{
+  if (flushPending && !tft.dmaBusy())
+  {
+    flushPending = false;
+    uint32_t busy = micros() - flushStart;
+    flushStats.busyUs += busy;
+    telemetry.flushUs += busy;
+    lv_disp_flush_ready(disp); /* tell lvgl that flushing is done */
+  }
+}
+
+/* Called by lvgl after every refresh with the number of pixels redrawn */
+void my_disp_monitor(lv_disp_drv_t *disp, uint32_t time, uint32_t px)
+{
+  refrPixels += px;
+  telemetry.refreshes++;
+  slideMonitor(time);
+#ifdef TOUCH_TASK
+  touchRefreshed();
+#endif
+
+  static bool firstFrame = true;
+  if (firstFrame)
+  {
+    firstFrame = false;
+    uint32_t inUse, peak;
+    lvAllocUsage(&inUse, &peak);
+    Timber.i("First frame after %u ms, lv_mem %u bytes, peak %u", millis(), inUse, peak);
+  }
+}
+
+/* Called by lvgl while both draw buffers are in use */
+void my_disp_wait(lv_disp_drv_t *disp)
+{
+  uint32_t start = micros();
+  tft.waitDMA();
+  flushStats.waitUs += micros() - start;
+
+  my_disp_flush_poll(disp);
+}
+
+void printFlushStats()
+{
+  uint32_t overlap = flushStats.busyUs > flushStats.waitUs ? flushStats.busyUs - flushStats.waitUs : 0;
+
+  Timber.i("Flush [%s]: %u strips, %u KB, bus %u us, blocked %u us, overlap %u%%", FLUSH_BUS_NAME,
+           flushStats.strips, flushStats.bytes / 1024, flushStats.busyUs, flushStats.waitUs,
+           flushStats.busyUs ? (uint32_t)(100ULL * overlap / flushStats.busyUs) : 0);
+
+  flushStats = {};
+}
+
+#ifdef FONT_STATS
+/* Glyph lookup time of the label fonts, FONT_SUBSET builds use the glyph subsets of tools/font_subset.py */
+void printFontStats()
+{
+  static const char sample[] = "0123456789 Hello, World! -12\xC2\xB0";
+  const struct
+  {
+    const lv_font_t *font;
+    uint8_t size;
+  } fonts[] = {{&lv_font_montserrat_16, 16}, {&lv_font_montserrat_24, 24}, {&lv_font_montserrat_28, 28},
+               {&lv_font_montserrat_34, 34}, {&lv_font_montserrat_48, 48}};
+
+  for (const auto &f : fonts)
+  {
+    lv_font_glyph_dsc_t dsc;
+    uint32_t lookups = 0, found = 0;
+    uint32_t start = micros();
+    for (int i = 0; i < 100; i++)
+    {
+      uint32_t pos = 0;
+      uint32_t letter;
+      while ((letter = _lv_txt_encoded_next(sample, &pos)) != 0)
+      {
+        found += lv_font_get_glyph_dsc(f.font, &dsc, letter, 0);
+        lookups++;
+      }
+    }
+    uint32_t us = micros() - start;
+    Timber.i("Font %u: %u ns/glyph, %u/%u found", f.size, us * 1000 / lookups, found / 100, lookups / 100);
+  }
+#ifdef FONT_SUBSET
+  Timber.i("Fonts: glyph subsets");
+#else
+  Timber.i("Fonts: lvgl's complete fonts");
+#endif
+}
+#endif
+
+#ifdef TOUCH_TASK
+/* Reads the controller from the touch task */
+bool readTouch(uint16_t *x, uint16_t *y)
+{
+  return tft.getTouch(x, y);
+}
+#else
+/* Touch controller INT, wakes the render task and resumes touch polling */
+void IRAM_ATTR touchInterrupt()
+{
+  touchIrq = true;
+  renderWakeFromISR();
 }
 
 /*Read the touchpad*/
@@ -399,6 +582,11 @@ void my_touchpad_read(lv_indev_drv_t *indev_driver, lv_indev_data_t *data)
   if (!touched)
   {
     data->state = LV_INDEV_STATE_REL;
+    // lvgl runs the scroll throw and the snap on the reads after the release
+    if (!touchIndev->proc.types.pointer.scroll_obj)
+    {
+      lv_timer_pause(indev_driver->read_timer); // until the next touch interrupt
+    }
   }
   else
   {
@@ -409,9 +597,11 @@ void my_touchpad_read(lv_indev_drv_t *indev_driver, lv_indev_data_t *data)
     data->point.y = touchY;
   }
 }
+#endif
 
 void connectionCallback(bool state)
 {
+  telemetry.bleEvents++;
   Serial.print("Connection state: ");
   Serial.println(state ? "Connected" : "Disconnected");
   // bool connected = watch.isConnected();
@@ -419,6 +609,7 @@ void connectionCallback(bool state)
 
 void notificationCallback(Notification notification)
 {
+  telemetry.bleEvents++;
   Serial.print("Notification received at ");
   Serial.println(notification.time);
   Serial.print("From: ");
@@ -427,39 +618,39 @@ void notificationCallback(Notification notification)
   Serial.println(notification.icon);
   Serial.println(notification.message);
 
-  lv_label_set_text(ui_alertTitle, notification.app.c_str());
-  lv_label_set_text(ui_alertText, notification.message.c_str());
-  lv_img_set_src(ui_alertIcon, &notificationIcons[getNotificationIconIndex(notification.icon)]);
-
-  alertTimer.time = millis();
-  alertTimer.active = true;
-  lv_obj_clear_flag(ui_alertPanel, LV_OBJ_FLAG_HIDDEN);
+  UiCommand cmd;
+  cmd.type = UI_SET_ALERT;
+  cmd.alert.icon = notification.icon;
+  uiCopyText(cmd.alert.title, sizeof(cmd.alert.title), notification.app.c_str());
+  uiCopyText(cmd.alert.text, sizeof(cmd.alert.text), notification.message.c_str());
+  uiQueue.push(cmd);
+  renderWake();
 }
 
 void ringerCallback(String caller, bool state)
 {
+  telemetry.bleEvents++;
+  UiCommand cmd;
   if (state)
   {
     Serial.print("Ringer: Incoming call from ");
     Serial.println(caller);
-    lv_label_set_text(ui_callerName, caller.c_str());
-    pulseCall_Animation(ui_callIcon, 0);
-    textUpDown_Animation(ui_callText, 0);
-    textSide_Animation(ui_callerName, 0);
-    lv_obj_clear_flag(ui_callPanel, LV_OBJ_FLAG_HIDDEN);
+    cmd.type = UI_SHOW_CALLER;
+    uiCopyText(cmd.caller.name, sizeof(cmd.caller.name), caller.c_str());
   }
   else
   {
     Timber.i("Ringer dismissed");
-    lv_obj_add_flag(ui_callPanel, LV_OBJ_FLAG_HIDDEN);
-    lv_anim_del(ui_callerName, NULL);
-    lv_anim_del(ui_callIcon, NULL);
-    lv_anim_del(ui_callText, NULL);
+    cmd.type = UI_HIDE_CALLER;
   }
+  uiQueue.push(cmd);
+  renderWake();
 }
 
 void configCallback(Config config, uint32_t a, uint32_t b)
 {
+  telemetry.bleEvents++;
+  UiCommand cmd;
   switch (config)
   {
   case CF_TIME:
@@ -468,14 +659,9 @@ void configCallback(Config config, uint32_t a, uint32_t b)
     Timber.i("The time has been set");
     Timber.i(watch.getTimeDate());
 
-    lv_anim_del_all();
-    lv_img_set_angle(ui_secondHand, watch.getSecond() * 60);
-    lv_img_set_angle(ui_secondHand1, watch.getSecond() * 60);
-    clockWise_Animation(ui_secondHand, 0);
-    clockWise_Animation(ui_secondHand1, 0);
-
-    lv_calendar_set_today_date(ui_calendar, watch.getYear(), watch.getMonth() + 1, watch.getDay());
-    lv_calendar_set_showed_date(ui_calendar, watch.getYear(), watch.getMonth() + 1);
+    cmd.type = UI_SET_TIME;
+    uiQueue.push(cmd);
+    renderWake();
 
     break;
   case CF_WEATHER:
@@ -486,13 +672,13 @@ void configCallback(Config config, uint32_t a, uint32_t b)
       // if a == 1, high & low temperature values might not yet be updated
       if (a == 2)
       {
-        String temp = String(watch.getWeatherAt(0).temp) + "°";
-        String range = "H:" + String(watch.getWeatherAt(0).high) + "°  L:" + String(watch.getWeatherAt(0).low) + "°";
-
-        lv_label_set_text(ui_weatherTemperature, temp.c_str());
-        lv_label_set_text(ui_weatherRange, range.c_str());
-        lv_label_set_text(ui_weatherCondition, weatherConditions[getWeatherIconIndex(watch.getWeatherAt(0).icon)].c_str());
-        lv_img_set_src(ui_weatherIcon, &weatherIcons[getWeatherIconIndex(watch.getWeatherAt(0).icon)]);
+        cmd.type = UI_SET_WEATHER;
+        cmd.weather.temp = watch.getWeatherAt(0).temp;
+        cmd.weather.high = watch.getWeatherAt(0).high;
+        cmd.weather.low = watch.getWeatherAt(0).low;
+        cmd.weather.icon = watch.getWeatherAt(0).icon;
+        uiQueue.push(cmd);
+        renderWake();
       }
     }
     if (b)
@@ -500,13 +686,116 @@ void configCallback(Config config, uint32_t a, uint32_t b)
       Serial.print("City name: ");
       String city = watch.getWeatherCity(); //
       Serial.print(city);
-      lv_label_set_text(ui_weatherCity, city.c_str());
+      cmd.type = UI_SET_CITY;
+      uiCopyText(cmd.city.name, sizeof(cmd.city.name), city.c_str());
+      uiQueue.push(cmd);
+      renderWake();
     }
     Serial.println();
     break;
   }
 }
 
+/* Keep the state a command sets, for home screens built later */
+void rememberUiCommand(const UiCommand &cmd)
+{
+  switch (cmd.type)
+  {
+  case UI_SET_WEATHER:
+    lastWeather = cmd;
+    hasWeather = true;
+    break;
+  case UI_SET_CITY:
+    lastCity = cmd;
+    hasCity = true;
+    break;
+  case UI_SET_TIME:
+    hasTime = true;
+    break;
+  default:
+    break; // the overlays outlive the screens (overlay.h)
+  }
+}
+
+/* Apply the Chronos state to the widgets of a home screen just built */
+void replayUiState()
+{
+  if (hasTime)
+  {
+    UiCommand cmd;
+    cmd.type = UI_SET_TIME;
+    applyUiCommand(cmd);
+  }
+  if (hasWeather)
+  {
+    applyUiCommand(lastWeather);
+  }
+  if (hasCity)
+  {
+    applyUiCommand(lastCity);
+  }
+}
+
+/* Apply a widget update posted by the Chronos callbacks, runs on the render task */
+void applyUiCommand(const UiCommand &cmd)
+{
+  rememberUiCommand(cmd);
+
+  switch (cmd.type)
+  {
+  case UI_SET_ALERT:
+    lv_label_set_text(ui_alertTitle, cmd.alert.title);
+    lv_label_set_text(ui_alertText, cmd.alert.text);
+    lv_img_set_src(ui_alertIcon, assetImage(notificationIcons[getNotificationIconIndex(cmd.alert.icon)]));
+#ifdef NOTIFY_HISTORY
+    notifyListAdd(cmd.alert.icon, cmd.alert.title, cmd.alert.text, watch.getEpoch(),
+                  watch.getHour(true) * 60 + watch.getMinute());
+#endif
+
+    alertTimer.time = millis();
+    alertTimer.active = true;
+    overlayShow(ui_alertPanel);
+    break;
+  case UI_SHOW_CALLER:
+    lv_label_set_text(ui_callerName, cmd.caller.name);
+    pulseCall_Animation(ui_callIcon, 0);
+    textUpDown_Animation(ui_callText, 0);
+    textSide_Animation(ui_callerName, 0);
+    overlayShow(ui_callPanel);
+    break;
+  case UI_HIDE_CALLER:
+    overlayHide(ui_callPanel);
+    lv_anim_del(ui_callerName, NULL);
+    lv_anim_del(ui_callIcon, NULL);
+    lv_anim_del(ui_callText, NULL);
+    break;
+  case UI_SET_WEATHER:
+    if (!ui_homeScreen)
+    {
+      break; // applied when the screen is built
+    }
+    lv_label_set_text_fmt(ui_weatherTemperature, "%d°", cmd.weather.temp);
+    lv_label_set_text_fmt(ui_weatherRange, "H:%d°  L:%d°", cmd.weather.high, cmd.weather.low);
+    lv_label_set_text(ui_weatherCondition, weatherConditions[getWeatherIconIndex(cmd.weather.icon)].c_str());
+    lv_img_set_src(ui_weatherIcon, assetImage(weatherIcons[getWeatherIconIndex(cmd.weather.icon)]));
+    break;
+  case UI_SET_CITY:
+    if (ui_homeScreen)
+    {
+      lv_label_set_text(ui_weatherCity, cmd.city.name);
+    }
+    break;
+  case UI_SET_TIME:
+    if (!ui_homeScreen)
+    {
+      break;
+    }
+    lv_calendar_set_today_date(ui_calendar, watch.getYear(), watch.getMonth() + 1, watch.getDay());
+    lv_calendar_set_showed_date(ui_calendar, watch.getYear(), watch.getMonth() + 1);
+    break;
+  }
+}
+
 void logCallback(Level level, unsigned long time, String message)
 {
   Serial.print(message);
@@ -519,26 +808,74 @@ void logCallback(Level level, unsigned long time, String message)
   }
 }
 
-void homeScreenLoaded(lv_event_t *e)
+/*
+  Home screen build. The overlays created with the first home screen stay on the top layer with
+  whatever they show, the copies a later build creates are dropped.
+*/
+void buildHome()
 {
-  lv_obj_set_parent(ui_alertPanel, ui_homeScreen);
-  lv_obj_set_parent(ui_callPanel, ui_homeScreen);
+  static lv_obj_t **const overlayWidgets[] = {&ui_alertPanel, &ui_alertTitle, &ui_alertIcon, &ui_alertText,
+                                              &ui_callPanel,  &ui_callIcon,   &ui_callText,  &ui_callerName};
+  lv_obj_t *kept[sizeof(overlayWidgets) / sizeof(overlayWidgets[0])];
+  for (size_t i = 0; i < sizeof(kept) / sizeof(kept[0]); i++)
+  {
+    kept[i] = *overlayWidgets[i];
+  }
 
-  lv_anim_del_all();
-  int angle = watch.getSecond() * 60;
-  lv_img_set_angle(ui_secondHand, angle);
-  clockWise_Animation(ui_secondHand, 0);
+  ui_homeScreen_screen_init();
+  if (!kept[0])
+  {
+    return;
+  }
+  lv_obj_del(ui_alertPanel);
+  lv_obj_del(ui_callPanel);
+  for (size_t i = 0; i < sizeof(kept) / sizeof(kept[0]); i++)
+  {
+    *overlayWidgets[i] = kept[i];
+  }
 }
 
-void clockScreenLoaded(lv_event_t *e)
+void homeBuilt(lv_obj_t *screen)
 {
-  lv_obj_set_parent(ui_alertPanel, ui_clockScreen);
-  lv_obj_set_parent(ui_callPanel, ui_clockScreen);
+  overlayAdd(ui_alertPanel, OVERLAY_ALERT);
+  overlayAdd(ui_callPanel, OVERLAY_CALL);
+  lv_img_set_src(ui_clockSmallBackground, assetImage(ASSET_CLOCK_ROUND_BG));
+  clockAttach(screen);
+  handAttach(ui_hourHand, HAND_STEPS_HOUR);
+  handAttach(ui_minuteHand, HAND_STEPS_MINUTE);
+  handAttach(ui_secondHand, HAND_STEPS_SECOND);
+
+  lv_obj_set_scroll_snap_y(ui_infoPanel, LV_SCROLL_SNAP_CENTER);
+#ifdef NOTIFY_HISTORY
+  notifyListBegin(ui_infoPanel);
+#endif
+#ifdef PAGE_SUSPEND
+  pagerAttach(ui_infoPanel);
+#endif
+  replayUiState();
+}
 
-  lv_anim_del_all();
-  int angle = watch.getSecond() * 60;
-  lv_img_set_angle(ui_secondHand1, angle);
-  clockWise_Animation(ui_secondHand1, 0);
+void clockBuilt(lv_obj_t *screen)
+{
+  lv_obj_set_style_bg_img_src(ui_analogClock, assetImage(ASSET_CLOCK_LARGE_BG), LV_PART_MAIN | LV_STATE_DEFAULT);
+  clockAttach(screen);
+  handAttach(ui_hourHand1, HAND_STEPS_HOUR);
+  handAttach(ui_minuteHand1, HAND_STEPS_MINUTE);
+  handAttach(ui_secondHand1, HAND_STEPS_SECOND);
+
+  lv_obj_set_scroll_snap_y(ui_clockPanel, LV_SCROLL_SNAP_CENTER);
+#ifdef PAGE_SUSPEND
+  pagerAttach(ui_clockPanel);
+#endif
+}
+
+/* The overlays are on the top layer (overlay.h), nothing moves with the screen loads */
+void homeScreenLoaded(lv_event_t *e)
+{
+}
+
+void clockScreenLoaded(lv_event_t *e)
+{
 }
 
 void musicPrevious(lv_event_t *e)
@@ -591,21 +928,75 @@ void setup()
     disp_drv.hor_res = screenWidth;
     disp_drv.ver_res = screenHeight;
     disp_drv.flush_cb = my_disp_flush;
+    disp_drv.wait_cb = my_disp_wait;
+    disp_drv.monitor_cb = my_disp_monitor;
     disp_drv.draw_buf = &draw_buf;
+#ifdef PAIR_BLEND
+    blendAttach(&disp_drv);
+#endif
     lv_disp_drv_register(&disp_drv);
 
     /* Initialize the input device driver */
     static lv_indev_drv_t indev_drv;
     lv_indev_drv_init(&indev_drv);
     indev_drv.type = LV_INDEV_TYPE_POINTER;
+#ifdef TOUCH_TASK
+    indev_drv.read_cb = touchRead;
+    touchIndev = lv_indev_drv_register(&indev_drv);
+    lv_timer_pause(touchIndev->driver->read_timer); // until the first touch
+
+    touchBegin(TOUCH_INT, readTouch);
+#else
     indev_drv.read_cb = my_touchpad_read;
-    lv_indev_drv_register(&indev_drv);
+    touchIndev = lv_indev_drv_register(&indev_drv);
+
+    pinMode(TOUCH_INT, INPUT);
+    attachInterrupt(digitalPinToInterrupt(TOUCH_INT), touchInterrupt, FALLING);
+#endif
 
 #ifdef USE_UI
+    imgCacheBegin();
+
+    // watch faces flashed to the assets partition replace the built in ones
+    resPackBegin();
+    assetsBegin();
+    clockBegin(digit_atlas);
+    overlayBegin();
+#ifdef SNAPSHOT_SLIDE
+    slideBegin(slidePrepare);
+    ScreenLoadCb load = slideTo;
+#else
+    ScreenLoadCb load = NULL;
+#endif
+
+#ifdef LAZY_SCREENS
+    static const ScreenDef screenDefs[] = {
+        {&ui_homeScreen, buildHome, homeBuilt, NULL, LAZY_SCREENS},
+        {&ui_clockScreen, ui_clockScreen_screen_init, clockBuilt, NULL, LAZY_SCREENS},
+    };
+    screensBegin(screenDefs, 2, load);
+    // what ui_init does besides building the screens
+    lv_disp_t *dispp = lv_disp_get_default();
+    lv_theme_t *theme = lv_theme_default_init(dispp, lv_palette_main(LV_PALETTE_BLUE),
+                                              lv_palette_main(LV_PALETTE_RED), true, LV_FONT_DEFAULT);
+    lv_disp_set_theme(dispp, theme);
+    lv_disp_load_scr(screenGet(SCREEN_HOME));
+#else
+    static const ScreenDef screenDefs[] = {
+        {&ui_homeScreen, NULL, homeBuilt, NULL, SCREEN_KEEP},
+        {&ui_clockScreen, NULL, clockBuilt, NULL, SCREEN_KEEP},
+    };
+    screensBegin(screenDefs, 2, load);
     ui_init();
+    homeBuilt(ui_homeScreen);
+    clockBuilt(ui_clockScreen);
+#endif
+    screenRoute(SCREEN_HOME, ui_event_homeScreen, LV_DIR_LEFT, SCREEN_CLOCK, LV_SCR_LOAD_ANIM_MOVE_LEFT, 500);
+    screenRoute(SCREEN_CLOCK, ui_event_clockScreen, LV_DIR_RIGHT, SCREEN_HOME, LV_SCR_LOAD_ANIM_MOVE_RIGHT, 500);
 
-    lv_obj_set_scroll_snap_y(ui_infoPanel, LV_SCROLL_SNAP_CENTER);
-    lv_obj_set_scroll_snap_y(ui_clockPanel, LV_SCROLL_SNAP_CENTER);
+#ifdef FONT_STATS
+    printFontStats();
+#endif
 
 #else
     lv_obj_t *label1 = lv_label_create(lv_scr_act());
@@ -632,34 +1023,182 @@ void setup()
     watch.clearNotifications();
     watch.set24Hour(true);
 
+    renderBegin(renderFrame);
+    loopBegin(chronosLoop);
+
     Timber.i("Setup done");
   }
 }
 
-void loop()
+/* Milliseconds into the current minute, the second is read again in case it rolled over */
+uint32_t minuteMillis()
 {
-  lv_timer_handler(); /* let the GUI do its work */
-  watch.loop();
+  int second, ms;
+  do
+  {
+    second = watch.getSecond();
+    ms = watch.getMillis();
+  } while (second != watch.getSecond());
+  return second * 1000 + ms;
+}
 
-  int hour = watch.getHourC();
-  int minute = watch.getMinute();
+/* Bring the clock of `screen` up to date before a slide snapshots it */
+void slidePrepare(lv_obj_t *screen)
+{
+  clockFollow(screen);
+  clockUpdate(watch.getHourC(), watch.getMinute());
+  clockSweep(minuteMillis());
+  clockFollow(NULL);
+}
 
-  lv_img_set_src(ui_hour1, &digits[hour / 10]);
-  lv_img_set_src(ui_hour2, &digits[hour % 10]);
-  lv_img_set_src(ui_minute1, &digits[minute / 10]);
-  lv_img_set_src(ui_minute2, &digits[minute % 10]);
+/* Runs on the render task with the lvgl lock held, returns the ms until the next frame is due */
+uint32_t renderFrame()
+{
+  lv_disp_t *disp = lv_disp_get_default();
+  lv_timer_resume(disp->refr_timer);
 
-  lv_img_set_angle(ui_minuteHand, minute * 60);
-  lv_img_set_angle(ui_hourHand, hour * 300 + minute * 5);
-  lv_img_set_angle(ui_minuteHand1, minute * 60);
-  lv_img_set_angle(ui_hourHand1, hour * 300 + minute * 5);
+#ifdef TOUCH_TASK
+  if (touchPending())
+  {
+#else
+  if (touchIrq)
+  {
+    touchIrq = false;
+#endif
+    lv_timer_resume(touchIndev->driver->read_timer);
+    lv_timer_ready(touchIndev->driver->read_timer);
+  }
+
+  UiCommand cmd;
+  while (uiQueue.pop(cmd))
+  {
+    applyUiCommand(cmd);
+  }
+
+  clockUpdate(watch.getHourC(), watch.getMinute());
+  uint32_t sweepTime = millis() + clockSweep(minuteMillis());
 
   if (alertTimer.active)
   {
     if (alertTimer.time + alertTimer.duration < millis())
     {
       alertTimer.active = false;
-      lv_obj_add_flag(ui_alertPanel, LV_OBJ_FLAG_HIDDEN);
+      overlayHide(ui_alertPanel);
     }
   }
-}
\ No newline at end of file
+
+  uint32_t renderStart = micros();
+  uint32_t next = lv_timer_handler(); /* let the GUI do its work */
+  uint32_t renderUs = micros() - renderStart;
+  telemetry.renderUs += renderUs;
+  telemetry.renderUsMax = max(telemetry.renderUsMax, renderUs);
+  my_disp_flush_poll(&disp_drv);
+
+  // nothing left to draw, stop the refresh timer until the next frame, animations held by the pager do not draw
+  // (pagerPausedAnims() also renews their hold, so it runs on every frame)
+  if (lv_anim_count_running() == pagerPausedAnims() && disp->inv_p == 0)
+  {
+    lv_timer_pause(disp->refr_timer);
+  }
+
+  // the second hand moves next, or the minute changes
+  int32_t sweepIn = sweepTime - millis();
+  next = min(next, (uint32_t)max(sweepIn, (int32_t)0));
+
+  if (alertTimer.active)
+  {
+    uint32_t elapsed = millis() - alertTimer.time;
+    uint32_t duration = alertTimer.duration;
+    next = min(next, duration > elapsed ? duration - elapsed : (uint32_t)0);
+  }
+
+  if (flushPending)
+  {
+    next = min(next, (uint32_t)1); // release the last strip as soon as its transfer is done
+  }
+
+#ifdef FLUSH_STATS_INTERVAL
+  if (millis() - flushStatsTime > FLUSH_STATS_INTERVAL)
+  {
+    flushStatsTime = millis();
+    printFlushStats();
+#ifdef PAIR_BLEND
+    blendPrintStats();
+#endif
+    slidePrintStats();
+#ifdef TOUCH_TASK
+    touchPrintStats();
+#endif
+  }
+#endif
+
+#ifdef CLOCK_STATS_INTERVAL
+  if (millis() - clockStatsTime > CLOCK_STATS_INTERVAL)
+  {
+    uint32_t elapsed = millis() - clockStatsTime;
+    clockStatsTime = millis();
+    Timber.i("Clock: %u widget writes, %u px redrawn (%u px/s)", clockWrites, refrPixels,
+             (uint32_t)((uint64_t)refrPixels * 1000 / elapsed));
+    clockWrites = 0;
+    refrPixels = 0;
+    clockPrintStats();
+    handPrintStats();
+    imgCachePrintStats();
+  }
+#endif
+
+#ifdef MEM_STATS_INTERVAL
+  if (millis() - memStatsTime > MEM_STATS_INTERVAL)
+  {
+    memStatsTime = millis();
+    lvAllocPrintStats();
+#ifdef NOTIFY_HISTORY
+    notifyListPrintStats();
+#endif
+#ifdef PAGE_SUSPEND
+    pagerPrintStats();
+#endif
+    screensPrintStats();
+  }
+#endif
+
+#ifdef TELEMETRY_INTERVAL
+  next = min(next, telemetrySample(uiQueue.dropped()));
+#endif
+
+  return next;
+}
+
+/* Runs on the loop task on PRO_CPU, next to the BLE host */
+void chronosLoop()
+{
+  cpuBegin(loopCpu);
+  watch.loop();
+  uint32_t loopUs = micros() - loopCpu.start;
+  cpuEnd(loopCpu);
+
+  telemetry.loops++;
+  telemetry.loopUs += loopUs;
+  telemetry.loopUsMax = max(telemetry.loopUsMax, loopUs);
+#ifdef TELEMETRY_INTERVAL
+  telemetryPoll();
+#endif
+
+#ifdef CPU_STATS_INTERVAL
+  if (millis() - cpuStatsTime > CPU_STATS_INTERVAL)
+  {
+    cpuStatsTime = millis();
+    renderPrintCpu();
+  }
+#endif
+
+  uint32_t start = micros();
+  delay(5);
+  loopCpu.idleUs += micros() - start;
+  loopCpu.wakeups++;
+}
+
+void loop()
+{
+  vTaskDelete(NULL); // the render and loop tasks took over, see render.h
+}
@@ -0,0 +1,231 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <Arduino.h>
+#include <Timber.h>
+#include "notify_list.h"
+#include "notify_store.h"
+
+#define NO_ENTRY UINT32_MAX
+
+struct Row
+{
+  lv_obj_t *obj;
+  lv_obj_t *title;
+  lv_obj_t *clock;
+  lv_obj_t *text;
+  uint32_t seq; // of the notification shown, NO_ENTRY when hidden
+  char clockText[6];
+};
+
+static NotifyStore store;
+static uint8_t *arena;
+static lv_obj_t *list; // NULL while its screen is not built
+static lv_obj_t *spacer; // sets the scroll height to all the rows
+static lv_obj_t *emptyLabel;
+static Row rows[NOTIFY_LIST_ROWS];
+static uint32_t rowBinds = 0;
+
+static void hideRow(Row &row)
+{
+  if (row.seq == NO_ENTRY)
+  {
+    return;
+  }
+  // the arena behind the old texts gets reused
+  lv_label_set_text_static(row.title, "");
+  lv_label_set_text_static(row.text, "");
+  lv_obj_add_flag(row.obj, LV_OBJ_FLAG_HIDDEN);
+  row.seq = NO_ENTRY;
+}
+
+static void bindRow(Row &row, uint32_t index, const NotifyEntry &entry)
+{
+  if (row.seq != entry.seq)
+  {
+    snprintf(row.clockText, sizeof(row.clockText), "%02u:%02u", entry.clock / 60 % 24, entry.clock % 60);
+    lv_label_set_text_static(row.title, entry.title);
+    lv_label_set_text_static(row.text, entry.text);
+    lv_label_set_text_static(row.clock, row.clockText);
+    lv_obj_clear_flag(row.obj, LV_OBJ_FLAG_HIDDEN);
+    row.seq = entry.seq;
+    rowBinds++;
+  }
+  lv_coord_t y = index * NOTIFY_ROW_HEIGHT;
+  if (lv_obj_get_y(row.obj) != y)
+  {
+    lv_obj_set_y(row.obj, y);
+  }
+}
+
+/* Bind the rows to the notifications in view, a notification keeps its row while it stays in view */
+static void updateRows()
+{
+  int32_t first = max(0, (int)(lv_obj_get_scroll_y(list) / NOTIFY_ROW_HEIGHT));
+  for (int32_t index = first; index < first + NOTIFY_LIST_ROWS; index++)
+  {
+    Row &row = rows[index % NOTIFY_LIST_ROWS];
+    NotifyEntry entry;
+    if (store.get(index, entry))
+    {
+      bindRow(row, index, entry);
+    }
+    else
+    {
+      hideRow(row);
+    }
+  }
+}
+
+static void scrollEvent(lv_event_t *e)
+{
+  updateRows();
+}
+
+static Row createRow(lv_obj_t *parent)
+{
+  Row row;
+  row.seq = 0;
+  row.obj = lv_obj_create(parent);
+  lv_obj_set_size(row.obj, 190, NOTIFY_ROW_HEIGHT - 8);
+  lv_obj_clear_flag(row.obj, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+  lv_obj_set_style_radius(row.obj, 10, LV_PART_MAIN | LV_STATE_DEFAULT);
+  lv_obj_set_style_bg_color(row.obj, lv_color_hex(0x171717), LV_PART_MAIN | LV_STATE_DEFAULT);
+  lv_obj_set_style_bg_opa(row.obj, 255, LV_PART_MAIN | LV_STATE_DEFAULT);
+  lv_obj_set_style_border_width(row.obj, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+  lv_obj_set_style_pad_all(row.obj, 8, LV_PART_MAIN | LV_STATE_DEFAULT);
+
+  // clipped instead of dotted, lvgl allocates the text under the dots
+  row.title = lv_label_create(row.obj);
+  lv_label_set_long_mode(row.title, LV_LABEL_LONG_CLIP);
+  lv_obj_set_size(row.title, 120, 20);
+  lv_obj_set_style_text_color(row.title, lv_color_hex(0xFFFFFF), LV_PART_MAIN | LV_STATE_DEFAULT);
+
+  row.clock = lv_label_create(row.obj);
+  lv_obj_set_align(row.clock, LV_ALIGN_TOP_RIGHT);
+  lv_obj_set_style_text_color(row.clock, lv_color_hex(0x808080), LV_PART_MAIN | LV_STATE_DEFAULT);
+
+  row.text = lv_label_create(row.obj);
+  lv_label_set_long_mode(row.text, LV_LABEL_LONG_CLIP);
+  lv_obj_set_size(row.text, lv_pct(100), NOTIFY_ROW_HEIGHT - 8 - 16 - 22);
+  lv_obj_set_y(row.text, 22);
+  lv_obj_set_style_text_color(row.text, lv_color_hex(0xB0B0B0), LV_PART_MAIN | LV_STATE_DEFAULT);
+
+  hideRow(row);
+  return row;
+}
+
+/* Rebind the rows after the history changed */
+static void refresh()
+{
+  // rows still point at texts that may just have been overwritten, rebind them all before the next draw
+  for (Row &row : rows)
+  {
+    hideRow(row);
+  }
+  lv_obj_set_height(spacer, store.count() * NOTIFY_ROW_HEIGHT);
+  if (store.count())
+  {
+    lv_obj_add_flag(emptyLabel, LV_OBJ_FLAG_HIDDEN);
+  }
+  else
+  {
+    lv_obj_clear_flag(emptyLabel, LV_OBJ_FLAG_HIDDEN);
+  }
+  lv_obj_scroll_to_y(list, 0, LV_ANIM_OFF); // newest first
+  updateRows();
+}
+
+static void deleteEvent(lv_event_t *e)
+{
+  list = NULL;
+}
+
+void notifyListBegin(lv_obj_t *parent)
+{
+  // the history outlives the page, it is built again with its screen
+  if (!arena)
+  {
+    arena = (uint8_t *)ps_malloc(NOTIFY_ARENA_SIZE);
+    if (!arena)
+    {
+      Timber.w("Notification history disabled, no memory for the arena");
+    }
+    store.begin(arena, NOTIFY_ARENA_SIZE, NOTIFY_MAX_AGE);
+  }
+
+  // a page like the weather and music panels
+  list = lv_obj_create(parent);
+  lv_obj_set_size(list, 234, 320);
+  lv_obj_set_align(list, LV_ALIGN_RIGHT_MID);
+  lv_obj_set_scrollbar_mode(list, LV_SCROLLBAR_MODE_OFF);
+  lv_obj_set_scroll_dir(list, LV_DIR_VER);
+  lv_obj_set_style_radius(list, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+  lv_obj_set_style_bg_opa(list, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+  lv_obj_set_style_border_width(list, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+  lv_obj_set_style_pad_left(list, 40, LV_PART_MAIN | LV_STATE_DEFAULT);
+  lv_obj_set_style_pad_right(list, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+  lv_obj_set_style_pad_top(list, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+  lv_obj_set_style_pad_bottom(list, 0, LV_PART_MAIN | LV_STATE_DEFAULT);
+  lv_obj_add_event_cb(list, scrollEvent, LV_EVENT_SCROLL, NULL);
+  lv_obj_add_event_cb(list, deleteEvent, LV_EVENT_DELETE, NULL);
+
+  spacer = lv_obj_create(list);
+  lv_obj_remove_style_all(spacer);
+  lv_obj_clear_flag(spacer, LV_OBJ_FLAG_CLICKABLE);
+  lv_obj_set_size(spacer, 1, 0);
+
+  emptyLabel = lv_label_create(list);
+  lv_label_set_text_static(emptyLabel, "No notifications");
+  lv_obj_set_align(emptyLabel, LV_ALIGN_CENTER);
+  lv_obj_set_style_text_color(emptyLabel, lv_color_hex(0x808080), LV_PART_MAIN | LV_STATE_DEFAULT);
+
+  for (Row &row : rows)
+  {
+    row = createRow(list);
+  }
+  refresh();
+}
+
+void notifyListAdd(uint8_t icon, const char *title, const char *text, uint32_t time, uint16_t clock)
+{
+  if (!arena)
+  {
+    return;
+  }
+  store.prune(time);
+  store.add(icon, title, text, time, clock);
+  if (list)
+  {
+    refresh();
+  }
+}
+
+void notifyListPrintStats()
+{
+  Timber.i("Notifications: %u kept, %u of %u bytes, %u evicted, %u row binds", store.count(), store.bytes(),
+           store.size(), store.evicted(), rowBinds);
+  rowBinds = 0;
+}
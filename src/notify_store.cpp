@@ -0,0 +1,172 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <string.h>
+#include "notify_store.h"
+#include "ui_queue.h"
+
+struct RecordHeader
+{
+  uint16_t size; // bytes including the header and the padding
+  uint16_t clock;
+  uint16_t textLen;
+  uint8_t titleLen;
+  uint8_t icon;
+  uint32_t time;
+  uint32_t seq;
+};
+
+void NotifyStore::begin(uint8_t *arena, uint32_t size, uint32_t maxAge)
+{
+  _arena = arena;
+  _size = arena ? size & ~3U : 0;
+  _maxAge = maxAge;
+  clear();
+}
+
+void NotifyStore::clear()
+{
+  _head = 0;
+  _used = 0;
+  _first = 0;
+  _count = 0;
+}
+
+void NotifyStore::evictOldest()
+{
+  const RecordHeader *record = (const RecordHeader *)(_arena + _offsets[_first]);
+  _used -= record->size;
+  _first = (_first + 1) % NOTIFY_MAX_RECORDS;
+  _count--;
+  _evicted++;
+  if (_count == 0)
+  {
+    _head = 0;
+  }
+}
+
+/* Free space for `bytes` at _head, or at the start of the arena when the end is too short */
+bool NotifyStore::reserve(uint32_t bytes, uint32_t *offset)
+{
+  while (true)
+  {
+    if (_count == NOTIFY_MAX_RECORDS)
+    {
+      evictOldest();
+      continue;
+    }
+    if (_count == 0)
+    {
+      *offset = 0;
+      return true;
+    }
+
+    uint32_t tail = _offsets[_first];
+    if (_head > tail)
+    {
+      // oldest..newest in one piece, free space after it and before it
+      if (_size - _head >= bytes)
+      {
+        *offset = _head;
+        return true;
+      }
+      if (tail >= bytes)
+      {
+        *offset = 0;
+        return true;
+      }
+    }
+    else if (tail - _head >= bytes)
+    {
+      // wrapped, free space between the newest and the oldest
+      *offset = _head;
+      return true;
+    }
+    evictOldest();
+  }
+}
+
+bool NotifyStore::add(uint8_t icon, const char *title, const char *text, uint32_t time, uint16_t clock)
+{
+  uint32_t titleLen = uiTextLength(title, NOTIFY_TITLE_MAX);
+  uint32_t textLen = uiTextLength(text, NOTIFY_TEXT_MAX);
+  uint32_t bytes = (sizeof(RecordHeader) + titleLen + 1 + textLen + 1 + 3) & ~3U;
+  uint32_t offset;
+  if (bytes > _size || !reserve(bytes, &offset))
+  {
+    return false;
+  }
+
+  RecordHeader *record = (RecordHeader *)(_arena + offset);
+  record->size = bytes;
+  record->clock = clock;
+  record->textLen = textLen;
+  record->titleLen = titleLen;
+  record->icon = icon;
+  record->time = time;
+  record->seq = _seq++;
+
+  char *data = (char *)(record + 1);
+  memcpy(data, title, titleLen);
+  data[titleLen] = '\0';
+  memcpy(data + titleLen + 1, text, textLen);
+  data[titleLen + 1 + textLen] = '\0';
+
+  _offsets[(_first + _count) % NOTIFY_MAX_RECORDS] = offset;
+  _count++;
+  _used += bytes;
+  _head = offset + bytes;
+  return true;
+}
+
+void NotifyStore::prune(uint32_t now)
+{
+  while (_count)
+  {
+    const RecordHeader *record = (const RecordHeader *)(_arena + _offsets[_first]);
+    if ((int32_t)(now - record->time) <= (int32_t)_maxAge)
+    {
+      break; // the rest is newer, or received before the clock moved back
+    }
+    evictOldest();
+  }
+}
+
+bool NotifyStore::get(uint32_t i, NotifyEntry &entry) const
+{
+  if (i >= _count)
+  {
+    return false;
+  }
+  const RecordHeader *record = (const RecordHeader *)(_arena + _offsets[(_first + _count - 1 - i) % NOTIFY_MAX_RECORDS]);
+  const char *data = (const char *)(record + 1);
+  entry.title = data;
+  entry.text = data + record->titleLen + 1;
+  entry.time = record->time;
+  entry.seq = record->seq;
+  entry.clock = record->clock;
+  entry.icon = record->icon;
+  return true;
+}
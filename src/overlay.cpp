@@ -0,0 +1,154 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <Arduino.h>
+#include <Timber.h>
+#include "overlay.h"
+
+struct Overlay
+{
+  lv_obj_t *panel; // NULL for a free slot
+  OverlayPriority priority;
+  bool shown; // asked for, the panel may still wait
+};
+
+static lv_obj_t *levels[OVERLAY_LEVELS];
+static Overlay overlays[OVERLAY_MAX];
+
+static Overlay *findOverlay(lv_obj_t *panel)
+{
+  for (Overlay &o : overlays)
+  {
+    if (o.panel == panel)
+    {
+      return &o;
+    }
+  }
+  return NULL;
+}
+
+/* Show the wanted panels of the highest priority wanted, touching only panels that change */
+static void update()
+{
+  int top = -1;
+  for (Overlay &o : overlays)
+  {
+    if (o.panel && o.shown)
+    {
+      top = max(top, (int)o.priority);
+    }
+  }
+  for (Overlay &o : overlays)
+  {
+    if (!o.panel)
+    {
+      continue;
+    }
+    bool visible = o.shown && o.priority == top;
+    if (visible == lv_obj_has_flag(o.panel, LV_OBJ_FLAG_HIDDEN))
+    {
+      if (visible)
+      {
+        lv_obj_clear_flag(o.panel, LV_OBJ_FLAG_HIDDEN);
+      }
+      else
+      {
+        lv_obj_add_flag(o.panel, LV_OBJ_FLAG_HIDDEN);
+      }
+    }
+  }
+}
+
+static void deleteEvent(lv_event_t *e)
+{
+  Overlay *o = (Overlay *)lv_event_get_user_data(e);
+  o->panel = NULL;
+  o->shown = false;
+  update();
+}
+
+/* A swipe over a panel bubbles up to its level, pass it on to the screen like when the panel was on it */
+static void gestureEvent(lv_event_t *e)
+{
+  lv_event_send(lv_scr_act(), LV_EVENT_GESTURE, NULL);
+}
+
+void overlayBegin()
+{
+  for (lv_obj_t *&level : levels)
+  {
+    level = lv_obj_create(lv_layer_top());
+    lv_obj_remove_style_all(level);
+    lv_obj_set_size(level, lv_pct(100), lv_pct(100));
+    lv_obj_clear_flag(level, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_event_cb(level, gestureEvent, LV_EVENT_GESTURE, NULL);
+  }
+}
+
+void overlayAdd(lv_obj_t *panel, OverlayPriority priority)
+{
+  if (findOverlay(panel))
+  {
+    return;
+  }
+  Overlay *o = findOverlay(NULL);
+  if (!o)
+  {
+    Timber.w("Overlay: no room for another panel, raise OVERLAY_MAX");
+    return;
+  }
+  o->panel = panel;
+  o->priority = priority;
+  o->shown = !lv_obj_has_flag(panel, LV_OBJ_FLAG_HIDDEN);
+  lv_obj_set_parent(panel, levels[priority]);
+  lv_obj_add_event_cb(panel, deleteEvent, LV_EVENT_DELETE, o);
+  update();
+}
+
+void overlayShow(lv_obj_t *panel)
+{
+  Overlay *o = findOverlay(panel);
+  if (o && !o->shown)
+  {
+    o->shown = true;
+    update();
+  }
+}
+
+void overlayHide(lv_obj_t *panel)
+{
+  Overlay *o = findOverlay(panel);
+  if (o && o->shown)
+  {
+    o->shown = false;
+    update();
+  }
+}
+
+bool overlayShown(lv_obj_t *panel)
+{
+  Overlay *o = findOverlay(panel);
+  return o && o->shown;
+}
@@ -0,0 +1,335 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <Arduino.h>
+#include <Timber.h>
+#include <src/misc/lv_gc.h>
+#include "pager.h"
+
+// set on a page while it is suspended
+#define SUSPENDED_FLAG LV_OBJ_FLAG_USER_1
+
+// anim_timer only runs an animation once its act_time is positive, this holds it for days
+#define HELD_ACT_TIME (-0x40000000)
+// anim_timer still adds the elapsed time to a held act_time, prunePaused() puts it back every frame
+#define HELD_ACT_MAX (HELD_ACT_TIME / 2)
+
+struct Pager
+{
+  lv_obj_t *panel;
+  lv_obj_t *pages[PAGER_MAX_PAGES];
+  uint8_t count;
+  uint8_t center; // page under the middle of the panel
+};
+
+/* An animation of a suspended page, with the time it had reached */
+struct PausedAnim
+{
+  lv_anim_t *anim;
+  void *var;
+  lv_obj_t *page;
+  int32_t actTime;
+};
+
+static Pager pagers[PAGER_MAX_PANELS];
+static uint8_t pagerCount = 0;
+static PausedAnim paused[PAGER_MAX_PAUSED];
+static uint16_t pausedCount = 0;
+
+static uint32_t suspends = 0;
+static uint32_t resumes = 0;
+
+/* Compares pointers only, the var of an animation is not always an object */
+static bool inTree(lv_obj_t *root, const void *var)
+{
+  if (root == var)
+  {
+    return true;
+  }
+  uint32_t children = lv_obj_get_child_cnt(root);
+  for (uint32_t i = 0; i < children; i++)
+  {
+    if (inTree(lv_obj_get_child(root, i), var))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+static void pauseAnims(lv_obj_t *page)
+{
+  lv_ll_t *anims = &LV_GC_ROOT(_lv_anim_ll);
+  for (lv_anim_t *a = (lv_anim_t *)_lv_ll_get_head(anims); a; a = (lv_anim_t *)_lv_ll_get_next(anims, a))
+  {
+    if (pausedCount == PAGER_MAX_PAUSED)
+    {
+      return;
+    }
+    if (a->act_time <= HELD_ACT_MAX || !inTree(page, a->var))
+    {
+      continue;
+    }
+    paused[pausedCount++] = {a, a->var, page, a->act_time};
+    a->act_time = HELD_ACT_TIME;
+  }
+}
+
+/* Still held, a new animation may have taken the memory of a deleted one */
+static bool animExists(const PausedAnim &p)
+{
+  lv_ll_t *anims = &LV_GC_ROOT(_lv_anim_ll);
+  for (lv_anim_t *a = (lv_anim_t *)_lv_ll_get_head(anims); a; a = (lv_anim_t *)_lv_ll_get_next(anims, a))
+  {
+    if (a == p.anim && a->var == p.var && a->act_time <= HELD_ACT_MAX)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+/* Forget the held animations lvgl deleted meanwhile, with their object or by lv_anim_del, and renew the hold of the rest */
+static void prunePaused()
+{
+  uint16_t kept = 0;
+  for (uint16_t i = 0; i < pausedCount; i++)
+  {
+    if (animExists(paused[i]))
+    {
+      paused[i].anim->act_time = HELD_ACT_TIME;
+      paused[kept++] = paused[i];
+    }
+  }
+  pausedCount = kept;
+}
+
+static void resumeAnims(lv_obj_t *page)
+{
+  uint16_t kept = 0;
+  for (uint16_t i = 0; i < pausedCount; i++)
+  {
+    PausedAnim &p = paused[i];
+    if (p.page != page)
+    {
+      paused[kept++] = p;
+    }
+    else if (animExists(p)) // it may have been deleted with its object meanwhile
+    {
+      p.anim->act_time = p.actTime;
+    }
+  }
+  pausedCount = kept;
+}
+
+static void setLive(lv_obj_t *page, bool live)
+{
+  if (live != lv_obj_has_flag(page, SUSPENDED_FLAG))
+  {
+    return;
+  }
+  if (live)
+  {
+    lv_obj_clear_flag(page, LV_OBJ_FLAG_HIDDEN | SUSPENDED_FLAG);
+    resumeAnims(page);
+    resumes++;
+  }
+  else
+  {
+    lv_obj_add_flag(page, LV_OBJ_FLAG_HIDDEN | SUSPENDED_FLAG);
+    pauseAnims(page);
+    suspends++;
+  }
+}
+
+static void update(Pager &p)
+{
+  lv_coord_t middle = lv_obj_get_scroll_y(p.panel) + lv_obj_get_content_height(p.panel) / 2;
+  uint8_t center = 0;
+  lv_coord_t best = LV_COORD_MAX;
+  for (uint8_t i = 0; i < p.count; i++)
+  {
+    lv_coord_t distance = LV_ABS(lv_obj_get_y(p.pages[i]) + lv_obj_get_height(p.pages[i]) / 2 - middle);
+    if (distance < best)
+    {
+      best = distance;
+      center = i;
+    }
+  }
+  p.center = center;
+
+  // restore before suspending, a page is never left without both neighbors
+  for (uint8_t i = 0; i < p.count; i++)
+  {
+    if (LV_ABS(i - center) <= 1)
+    {
+      setLive(p.pages[i], true);
+    }
+  }
+  for (uint8_t i = 0; i < p.count; i++)
+  {
+    if (LV_ABS(i - center) > 1)
+    {
+      setLive(p.pages[i], false);
+    }
+  }
+}
+
+static void scrollEvent(lv_event_t *e)
+{
+  update(*(Pager *)lv_event_get_user_data(e));
+}
+
+/* The screen of the panel was deleted, forget its held animations and free the slot */
+static void deleteEvent(lv_event_t *e)
+{
+  Pager &p = *(Pager *)lv_event_get_user_data(e);
+  uint16_t kept = 0;
+  for (uint16_t i = 0; i < pausedCount; i++)
+  {
+    bool ours = false;
+    for (uint8_t j = 0; j < p.count; j++)
+    {
+      ours |= paused[i].page == p.pages[j];
+    }
+    if (!ours)
+    {
+      paused[kept++] = paused[i];
+    }
+  }
+  pausedCount = kept;
+  p.panel = NULL;
+  p.count = 0;
+}
+
+static Pager *freePager()
+{
+  for (uint8_t i = 0; i < pagerCount; i++)
+  {
+    if (!pagers[i].panel)
+    {
+      return &pagers[i];
+    }
+  }
+  return pagerCount < PAGER_MAX_PANELS ? &pagers[pagerCount++] : NULL;
+}
+
+void pagerAttach(lv_obj_t *panel)
+{
+  Pager *slot = freePager();
+  if (!slot)
+  {
+    Timber.w("Pager: no room for another panel, raise PAGER_MAX_PANELS");
+    return;
+  }
+  Pager &p = *slot;
+  p.panel = panel;
+  p.count = 0;
+  p.center = 0;
+
+  // pin the pages where the flex layout put them
+  lv_obj_update_layout(panel);
+  lv_coord_t bottom = 0;
+  uint32_t children = lv_obj_get_child_cnt(panel);
+  for (uint32_t i = 0; i < children; i++)
+  {
+    lv_obj_t *page = lv_obj_get_child(panel, i);
+    if (lv_obj_has_flag(page, LV_OBJ_FLAG_HIDDEN))
+    {
+      continue;
+    }
+    lv_coord_t x = lv_obj_get_x(page);
+    lv_coord_t y = lv_obj_get_y(page);
+    lv_obj_set_align(page, LV_ALIGN_TOP_LEFT);
+    lv_obj_set_pos(page, x, y);
+    bottom = max(bottom, (lv_coord_t)(y + lv_obj_get_height(page)));
+    if (p.count < PAGER_MAX_PAGES)
+    {
+      p.pages[p.count++] = page;
+    }
+  }
+  lv_obj_set_layout(panel, 0);
+
+  // hidden pages do not count for the scroll range
+  lv_obj_t *spacer = lv_obj_create(panel);
+  lv_obj_remove_style_all(spacer);
+  lv_obj_clear_flag(spacer, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SNAPPABLE | LV_OBJ_FLAG_SCROLLABLE);
+  lv_obj_set_size(spacer, 1, 1);
+  lv_obj_set_pos(spacer, 0, bottom - 1);
+
+  // pages are sorted by position, column reverse lists them bottom up
+  for (uint8_t i = 1; i < p.count; i++)
+  {
+    for (uint8_t j = i; j > 0 && lv_obj_get_y(p.pages[j - 1]) > lv_obj_get_y(p.pages[j]); j--)
+    {
+      lv_obj_t *page = p.pages[j];
+      p.pages[j] = p.pages[j - 1];
+      p.pages[j - 1] = page;
+    }
+  }
+
+  lv_obj_add_event_cb(panel, scrollEvent, LV_EVENT_SCROLL, &p);
+  lv_obj_add_event_cb(panel, deleteEvent, LV_EVENT_DELETE, &p);
+  update(p);
+}
+
+bool pagerSuspended(lv_obj_t *obj)
+{
+  for (; obj; obj = lv_obj_get_parent(obj))
+  {
+    if (lv_obj_has_flag(obj, SUSPENDED_FLAG))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+uint16_t pagerPausedAnims()
+{
+  prunePaused(); // lv_anim_count_running() no longer counts the deleted ones
+  return pausedCount;
+}
+
+void pagerPrintStats()
+{
+  for (uint8_t i = 0; i < pagerCount; i++)
+  {
+    Pager &p = pagers[i];
+    if (!p.panel)
+    {
+      continue;
+    }
+    uint8_t live = 0;
+    for (uint8_t j = 0; j < p.count; j++)
+    {
+      live += !lv_obj_has_flag(p.pages[j], SUSPENDED_FLAG);
+    }
+    Timber.i("Pager %u: page %u of %u, %u live", i, p.center, p.count, live);
+  }
+  Timber.i("Pager: %u suspends, %u resumes, %u animations held", suspends, resumes, pagerPausedAnims());
+  suspends = 0;
+  resumes = 0;
+}
@@ -0,0 +1,156 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include "render.h"
+#include <Timber.h>
+
+TaskCpu renderCpu = {"render"};
+TaskCpu loopCpu = {"loop"};
+
+static SemaphoreHandle_t lvglMutex;
+static TaskHandle_t renderHandle;
+static RenderCallback frameCallback;
+static LoopCallback loopCallback;
+static uint32_t cpuWindowStart;
+
+static void renderTask(void *param)
+{
+  renderCpu.core = xPortGetCoreID();
+
+  for (;;)
+  {
+    cpuBegin(renderCpu);
+    renderLock();
+    uint32_t next = frameCallback();
+    renderUnlock();
+    cpuEnd(renderCpu);
+
+    if (next > RENDER_IDLE_MAX)
+    {
+      next = RENDER_IDLE_MAX;
+    }
+
+    // sleep until the next lvgl timer, or earlier when woken by an event
+    uint32_t start = micros();
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(next));
+    renderCpu.idleUs += micros() - start;
+    renderCpu.wakeups++;
+  }
+}
+
+void renderBegin(RenderCallback frame)
+{
+  frameCallback = frame;
+  lvglMutex = xSemaphoreCreateRecursiveMutex();
+  cpuWindowStart = micros();
+
+  xTaskCreatePinnedToCore(renderTask, "render", RENDER_TASK_STACK, NULL, RENDER_TASK_PRIORITY, &renderHandle, RENDER_TASK_CORE);
+
+  Timber.i("Render task on core %d, priority %d", RENDER_TASK_CORE, RENDER_TASK_PRIORITY);
+}
+
+static void loopTask(void *param)
+{
+  loopCpu.core = xPortGetCoreID();
+
+  for (;;)
+  {
+    loopCallback();
+  }
+}
+
+void loopBegin(LoopCallback work)
+{
+  loopCallback = work;
+
+  xTaskCreatePinnedToCore(loopTask, "loop", LOOP_TASK_STACK, NULL, LOOP_TASK_PRIORITY, NULL, LOOP_TASK_CORE);
+
+  Timber.i("Loop task on core %d, priority %d", LOOP_TASK_CORE, LOOP_TASK_PRIORITY);
+}
+
+bool renderLock(TickType_t timeout)
+{
+  if (!lvglMutex)
+  {
+    return true; // render task not started yet, setup owns lvgl
+  }
+  return xSemaphoreTakeRecursive(lvglMutex, timeout) == pdTRUE;
+}
+
+void renderUnlock()
+{
+  if (lvglMutex)
+  {
+    xSemaphoreGiveRecursive(lvglMutex);
+  }
+}
+
+void renderWake()
+{
+  if (renderHandle)
+  {
+    xTaskNotifyGive(renderHandle);
+  }
+}
+
+void IRAM_ATTR renderWakeFromISR()
+{
+  if (renderHandle)
+  {
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(renderHandle, &woken);
+    portYIELD_FROM_ISR(woken);
+  }
+}
+
+void cpuBegin(TaskCpu &task)
+{
+  task.start = micros();
+}
+
+void cpuEnd(TaskCpu &task)
+{
+  task.busyUs += micros() - task.start;
+}
+
+void renderPrintCpu()
+{
+  uint32_t window = micros() - cpuWindowStart;
+  if (window == 0)
+  {
+    return;
+  }
+
+  TaskCpu *tasks[] = {&renderCpu, &loopCpu};
+  for (TaskCpu *task : tasks)
+  {
+    Timber.i("CPU %s (core %d): active %u us %u%%, idle %u%%, %u wakeups", task->name, task->core, task->busyUs,
+             (uint32_t)(100ULL * task->busyUs / window), (uint32_t)(100ULL * task->idleUs / window), task->wakeups);
+    task->busyUs = 0;
+    task->idleUs = 0;
+    task->wakeups = 0;
+  }
+  cpuWindowStart = micros();
+}
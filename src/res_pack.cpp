@@ -0,0 +1,228 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include "res_pack.h"
+#include <string.h>
+#include <stdlib.h>
+
+#ifdef ESP_PLATFORM
+#include <Arduino.h>
+#include <Timber.h>
+#include <esp_partition.h>
+#define PACK_LOG(...) Timber.i(__VA_ARGS__)
+#define PACK_ERROR(...) Timber.w(__VA_ARGS__)
+#else
+#include <stdio.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define PACK_LOG(...)
+#define PACK_ERROR(...) (fprintf(stderr, __VA_ARGS__), fputc('\n', stderr))
+#endif
+
+#define PACK_MAGIC 0x50415457 // "WTAP"
+#define PACK_VERSION 1
+#define PACK_NAME_SIZE 32
+
+struct PackHeader
+{
+  uint32_t magic;
+  uint16_t version;
+  uint16_t count;
+  uint32_t size; // [bytes] whole pack
+  uint32_t reserved;
+};
+
+struct PackEntry
+{
+  char name[PACK_NAME_SIZE]; // NUL padded, sorted
+  uint8_t format;
+  uint8_t reserved0;
+  uint16_t w;
+  uint16_t h;
+  uint16_t reserved1;
+  uint32_t offset; // [bytes] from the start of the pack
+  uint32_t size;
+};
+
+static_assert(sizeof(PackHeader) == 16, "pack header layout");
+static_assert(sizeof(PackEntry) == 48, "pack index layout");
+
+// PACK_FORMATS in tools/asset_compiler.py
+static const lv_img_cf_t formats[] = {
+    LV_IMG_CF_TRUE_COLOR, LV_IMG_CF_TRUE_COLOR_ALPHA,
+    LV_IMG_CF_INDEXED_1BIT, LV_IMG_CF_INDEXED_2BIT, LV_IMG_CF_INDEXED_4BIT, LV_IMG_CF_INDEXED_8BIT,
+    LV_IMG_CF_ALPHA_1BIT, LV_IMG_CF_ALPHA_2BIT, LV_IMG_CF_ALPHA_4BIT, LV_IMG_CF_ALPHA_8BIT,
+    LV_IMG_CF_USER_ENCODED_0, LV_IMG_CF_USER_ENCODED_1,
+};
+
+static const PackEntry *packIndex = NULL;
+static lv_img_dsc_t *packImages = NULL;
+static uint16_t packCount = 0;
+
+/* Check the mapped pack and build a descriptor per image, returns NULL or what is wrong */
+static const char *load(const uint8_t *base, size_t size)
+{
+  const PackHeader *header = (const PackHeader *)base;
+  if (size < sizeof(PackHeader) || header->magic != PACK_MAGIC)
+  {
+    return "not a resource pack";
+  }
+  if (header->version != PACK_VERSION)
+  {
+    return "unsupported pack version";
+  }
+  if (header->size > size || sizeof(PackHeader) + (size_t)header->count * sizeof(PackEntry) > header->size)
+  {
+    return "truncated pack";
+  }
+
+  const PackEntry *index = (const PackEntry *)(base + sizeof(PackHeader));
+  for (uint16_t i = 0; i < header->count; i++)
+  {
+    const PackEntry &entry = index[i];
+    if (entry.format >= sizeof(formats) / sizeof(formats[0]) || entry.offset > header->size ||
+        entry.size > header->size - entry.offset || entry.name[PACK_NAME_SIZE - 1] ||
+        (i && strncmp(index[i - 1].name, entry.name, PACK_NAME_SIZE) >= 0))
+    {
+      return "corrupt pack index";
+    }
+  }
+
+  lv_img_dsc_t *images = (lv_img_dsc_t *)calloc(header->count, sizeof(lv_img_dsc_t));
+  if (header->count && !images)
+  {
+    return "no memory for the pack index";
+  }
+  for (uint16_t i = 0; i < header->count; i++)
+  {
+    images[i].header.always_zero = 0;
+    images[i].header.cf = formats[index[i].format];
+    images[i].header.w = index[i].w;
+    images[i].header.h = index[i].h;
+    images[i].data_size = index[i].size;
+    images[i].data = base + index[i].offset;
+  }
+
+  // descriptors of an earlier pack stay valid, widgets may still show them
+  packImages = images;
+  packIndex = index;
+  packCount = header->count;
+  return NULL;
+}
+
+#ifdef ESP_PLATFORM
+bool resPackBegin(const char *name)
+{
+  const esp_partition_t *partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, name);
+  PackHeader header;
+  if (!partition || esp_partition_read(partition, 0, &header, sizeof(header)) != ESP_OK)
+  {
+    PACK_ERROR("Resource pack: no %s partition", name);
+    return false;
+  }
+  if (header.magic != PACK_MAGIC || header.size > partition->size)
+  {
+    PACK_ERROR("Resource pack: %s partition is empty", name);
+    return false;
+  }
+
+  // map only the pack, the data window is shared with the app's constants
+  const void *base;
+  spi_flash_mmap_handle_t handle;
+  if (esp_partition_mmap(partition, 0, header.size, ESP_PARTITION_MMAP_DATA, &base, &handle) != ESP_OK)
+  {
+    PACK_ERROR("Resource pack: can not map %u bytes", header.size);
+    return false;
+  }
+
+  const char *error = load((const uint8_t *)base, header.size);
+  if (error)
+  {
+    PACK_ERROR("Resource pack: %s", error);
+    spi_flash_munmap(handle);
+    return false;
+  }
+  PACK_LOG("Resource pack: %u images, %u bytes mapped at 0x%x", packCount, header.size, partition->address);
+  return true;
+}
+#else
+bool resPackBegin(const char *name)
+{
+  int fd = open(name, O_RDONLY);
+  struct stat st;
+  if (fd < 0 || fstat(fd, &st) != 0)
+  {
+    PACK_ERROR("Resource pack: can not open %s", name);
+    if (fd >= 0)
+    {
+      close(fd);
+    }
+    return false;
+  }
+
+  void *base = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (base == MAP_FAILED)
+  {
+    PACK_ERROR("Resource pack: can not map %s", name);
+    return false;
+  }
+
+  const char *error = load((const uint8_t *)base, st.st_size);
+  if (error)
+  {
+    PACK_ERROR("Resource pack: %s: %s", name, error);
+    munmap(base, st.st_size);
+    return false;
+  }
+  return true;
+}
+#endif
+
+const lv_img_dsc_t *resPackImage(const char *name, const lv_img_dsc_t *fallback)
+{
+  int lo = 0;
+  int hi = (int)packCount - 1;
+  while (lo <= hi)
+  {
+    int mid = (lo + hi) / 2;
+    int cmp = strncmp(name, packIndex[mid].name, PACK_NAME_SIZE);
+    if (cmp == 0)
+    {
+      return &packImages[mid];
+    }
+    if (cmp < 0)
+    {
+      hi = mid - 1;
+    }
+    else
+    {
+      lo = mid + 1;
+    }
+  }
+  return fallback;
+}
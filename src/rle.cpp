@@ -0,0 +1,62 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <string.h>
+#include "rle.h"
+
+uint32_t rleDecode(const uint8_t *in, const uint8_t *inEnd, uint8_t *out, uint32_t size, uint8_t px)
+{
+  uint8_t *start = out;
+  uint8_t *end = out + size;
+  while (out < end && in < inEnd)
+  {
+    uint8_t ctrl = *in++;
+    uint32_t count = (ctrl & 0x7F) + 1;
+    uint32_t room = (end - out) / px;
+    count = count < room ? count : room;
+    if (ctrl & 0x80)
+    {
+      if (in + px > inEnd)
+      {
+        break;
+      }
+      for (uint32_t i = 0; i < count; i++)
+      {
+        memcpy(out, in, px);
+        out += px;
+      }
+      in += px;
+    }
+    else
+    {
+      uint32_t avail = (inEnd - in) / px;
+      count = count < avail ? count : avail;
+      memcpy(out, in, count * px);
+      out += count * px;
+      in += count * px;
+    }
+  }
+  return out - start;
+}
@@ -0,0 +1,175 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <Arduino.h>
+#include <Timber.h>
+#include "screens.h"
+#include "lv_alloc.h"
+
+struct Screen
+{
+  ScreenDef def;
+  uint32_t builds;
+  uint32_t buildUs;
+  uint32_t memBuilt; // [bytes] lvgl memory the last build took
+};
+
+/* A swipe taken over from a SquareLine screen event */
+struct Route
+{
+  uint8_t from;
+  lv_event_cb_t uiEvent;
+  lv_dir_t dir;
+  uint8_t to;
+  lv_scr_load_anim_t anim;
+  uint32_t time;
+};
+
+static Screen screens[SCREENS_MAX];
+static uint8_t screenCount = 0;
+static Route routes[SCREENS_MAX_ROUTES];
+static uint8_t routeCount = 0;
+static ScreenLoadCb loadScreen;
+
+static uint32_t deletes = 0;
+
+static void routeEvent(lv_event_t *e)
+{
+  Route *route = (Route *)lv_event_get_user_data(e);
+  if (lv_event_get_code(e) == LV_EVENT_GESTURE && lv_indev_get_gesture_dir(lv_indev_get_act()) == route->dir)
+  {
+    lv_obj_t *target = screenGet(route->to);
+    if (loadScreen)
+    {
+      loadScreen(target, route->anim, route->time);
+    }
+    else
+    {
+      lv_scr_load_anim(target, route->anim, route->time, 0, false);
+    }
+  }
+  else
+  {
+    route->uiEvent(e);
+  }
+}
+
+static void addRoute(lv_obj_t *screen, Route &route)
+{
+  lv_obj_remove_event_cb(screen, route.uiEvent);
+  lv_obj_add_event_cb(screen, routeEvent, LV_EVENT_ALL, &route);
+}
+
+/* The next screen is loaded, the transition is over */
+static void unloadedEvent(lv_event_t *e)
+{
+  Screen &s = *(Screen *)lv_event_get_user_data(e);
+  if (s.def.policy != SCREEN_DESTROY)
+  {
+    return;
+  }
+  lv_obj_t *screen = *s.def.obj;
+  if (s.def.teardown)
+  {
+    s.def.teardown(screen);
+  }
+  *s.def.obj = NULL;
+  lv_obj_del_async(screen); // not from its own event
+  deletes++;
+}
+
+void screensBegin(const ScreenDef *defs, uint8_t count, ScreenLoadCb load)
+{
+  screenCount = min(count, (uint8_t)SCREENS_MAX);
+  for (uint8_t i = 0; i < screenCount; i++)
+  {
+    screens[i] = {defs[i], 0, 0, 0};
+  }
+  loadScreen = load;
+}
+
+lv_obj_t *screenGet(uint8_t id)
+{
+  Screen &s = screens[id];
+  if (*s.def.obj)
+  {
+    return *s.def.obj;
+  }
+
+  uint32_t inUse, peak;
+  lvAllocUsage(&inUse, &peak);
+  uint32_t start = micros();
+  s.def.build();
+  lv_obj_t *screen = *s.def.obj;
+  s.def.built(screen);
+  for (uint8_t i = 0; i < routeCount; i++)
+  {
+    if (routes[i].from == id)
+    {
+      addRoute(screen, routes[i]);
+    }
+  }
+  lv_obj_add_event_cb(screen, unloadedEvent, LV_EVENT_SCREEN_UNLOADED, &s);
+  s.buildUs += micros() - start;
+  s.builds++;
+
+  uint32_t built;
+  lvAllocUsage(&built, &peak);
+  s.memBuilt = built - inUse;
+  return screen;
+}
+
+void screenRoute(uint8_t from, lv_event_cb_t uiEvent, lv_dir_t dir, uint8_t to, lv_scr_load_anim_t anim,
+                 uint32_t time)
+{
+  if (routeCount == SCREENS_MAX_ROUTES)
+  {
+    Timber.w("Screens: no room for another route, raise SCREENS_MAX_ROUTES");
+    return;
+  }
+  Route &route = routes[routeCount++];
+  route = {from, uiEvent, dir, to, anim, time};
+  if (*screens[from].def.obj)
+  {
+    addRoute(*screens[from].def.obj, route);
+  }
+}
+
+void screensPrintStats()
+{
+  for (uint8_t i = 0; i < screenCount; i++)
+  {
+    Screen &s = screens[i];
+    if (s.builds)
+    {
+      Timber.i("Screen %u: %s, %u builds, %u us per build, %u bytes of lv_mem", i, *s.def.obj ? "built" : "deleted",
+               s.builds, s.buildUs / s.builds, s.memBuilt);
+    }
+  }
+  uint32_t inUse, peak;
+  lvAllocUsage(&inUse, &peak);
+  Timber.i("Screens: %u deleted, lv_mem %u bytes, peak %u", deletes, inUse, peak);
+  deletes = 0;
+}
@@ -0,0 +1,224 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <Arduino.h>
+#include <Timber.h>
+#include "slide.h"
+
+struct Snapshot
+{
+  lv_img_dsc_t dsc;
+  uint8_t *buf;
+  uint32_t size;
+};
+
+static void (*prepareScreen)(lv_obj_t *screen);
+static lv_obj_t *slideScreen;
+static lv_obj_t *outImg;
+static lv_obj_t *inImg;
+static Snapshot outShot;
+static Snapshot inShot;
+
+static lv_obj_t *slideTarget;
+static lv_scr_load_anim_t slideAnim;
+static bool active = false;
+
+static bool measuring = false;
+static uint32_t measureStart;
+static uint32_t measureFrames;
+
+static uint32_t slides = 0;
+static uint32_t frames = 0;
+static uint32_t elapsedMs = 0;
+static uint32_t renderMs = 0;
+static uint32_t renderMsMax = 0;
+static uint32_t dropped = 0;
+static uint32_t snapshotUs = 0;
+
+static bool take(Snapshot &shot, lv_obj_t *screen)
+{
+  lv_obj_update_layout(screen);
+  uint32_t size = lv_snapshot_buf_size_needed(screen, LV_IMG_CF_TRUE_COLOR);
+  if (size > shot.size)
+  {
+    free(shot.buf);
+    shot.buf = (uint8_t *)ps_malloc(size);
+    shot.size = shot.buf ? size : 0;
+  }
+  if (!shot.buf)
+  {
+    return false;
+  }
+  // the image keeps its address, drop what lvgl knows about the last one
+  lv_img_cache_invalidate_src(&shot.dsc);
+  return lv_snapshot_take_to_buf(screen, LV_IMG_CF_TRUE_COLOR, &shot.dsc, shot.buf, shot.size) == LV_RES_OK;
+}
+
+/* Two screens worth of PSRAM, only held while a slide moves */
+static void release(Snapshot &shot, lv_obj_t *img)
+{
+  lv_img_set_src(img, NULL);
+  lv_img_cache_invalidate_src(&shot.dsc);
+  free(shot.buf);
+  shot.buf = NULL;
+  shot.size = 0;
+}
+
+/* `v` runs from 0 to the screen width */
+static void slideExec(void *var, int32_t v)
+{
+  lv_coord_t width = lv_obj_get_width(slideScreen);
+  if (slideAnim == LV_SCR_LOAD_ANIM_MOVE_LEFT)
+  {
+    lv_obj_set_x(outImg, -v);
+    lv_obj_set_x(inImg, width - v);
+  }
+  else
+  {
+    lv_obj_set_x(outImg, v);
+    lv_obj_set_x(inImg, v - width);
+  }
+}
+
+static void slideReady(lv_anim_t *a)
+{
+  active = false;
+  lv_scr_load(slideTarget);
+  release(outShot, outImg);
+  release(inShot, inImg);
+}
+
+void slideBegin(void (*prepare)(lv_obj_t *screen))
+{
+  prepareScreen = prepare;
+
+  slideScreen = lv_obj_create(NULL);
+  lv_obj_clear_flag(slideScreen, LV_OBJ_FLAG_SCROLLABLE);
+  outImg = lv_img_create(slideScreen);
+  inImg = lv_img_create(slideScreen);
+}
+
+void slideTo(lv_obj_t *screen, lv_scr_load_anim_t anim, uint32_t time)
+{
+  lv_obj_t *from = lv_scr_act();
+  if (active || screen == from)
+  {
+    return;
+  }
+  measuring = true;
+  measureStart = millis();
+  measureFrames = 0;
+
+  if (!slideScreen || (anim != LV_SCR_LOAD_ANIM_MOVE_LEFT && anim != LV_SCR_LOAD_ANIM_MOVE_RIGHT))
+  {
+    lv_scr_load_anim(screen, anim, time, 0, false);
+    return;
+  }
+
+  if (prepareScreen)
+  {
+    prepareScreen(screen);
+  }
+  uint32_t start = micros();
+  if (!take(outShot, from) || !take(inShot, screen))
+  {
+    Timber.w("Slide: no snapshot, sliding live");
+    release(outShot, outImg);
+    release(inShot, inImg);
+    lv_scr_load_anim(screen, anim, time, 0, false);
+    return;
+  }
+  snapshotUs += micros() - start;
+
+  lv_img_set_src(outImg, &outShot.dsc);
+  lv_img_set_src(inImg, &inShot.dsc);
+  slideTarget = screen;
+  slideAnim = anim;
+  active = true;
+  slideExec(NULL, 0);
+  lv_scr_load(slideScreen);
+
+  lv_anim_t a;
+  lv_anim_init(&a);
+  lv_anim_set_var(&a, slideScreen);
+  lv_anim_set_exec_cb(&a, slideExec);
+  lv_anim_set_values(&a, 0, lv_obj_get_width(slideScreen));
+  lv_anim_set_time(&a, time);
+  lv_anim_set_ready_cb(&a, slideReady);
+  lv_anim_start(&a);
+}
+
+void slideMonitor(uint32_t ms)
+{
+  lv_disp_t *disp = lv_disp_get_default();
+  if (active || disp->scr_to_load)
+  {
+    // lvgl's own slides start here, snapshot slides when they are requested
+    if (!measuring)
+    {
+      measuring = true;
+      measureStart = millis();
+      measureFrames = 0;
+    }
+    measureFrames++;
+    renderMs += ms;
+    renderMsMax = max(renderMsMax, ms);
+    return;
+  }
+  if (!measuring)
+  {
+    return;
+  }
+
+  // the first frame after the slide
+  measuring = false;
+  uint32_t elapsed = millis() - measureStart;
+  uint32_t expected = elapsed / disp->refr_timer->period;
+  slides++;
+  frames += measureFrames;
+  elapsedMs += elapsed;
+  dropped += expected > measureFrames ? expected - measureFrames : 0;
+}
+
+void slidePrintStats()
+{
+  if (!slides)
+  {
+    return;
+  }
+  Timber.i("Slide: %u slides, %u frames in %u ms, %u ms per frame render (max %u), %u frames dropped", slides,
+           frames, elapsedMs, frames ? renderMs / frames : 0, renderMsMax, dropped);
+  if (snapshotUs)
+  {
+    Timber.i("Slide: %u us per snapshot pair", snapshotUs / slides);
+  }
+  slides = 0;
+  frames = 0;
+  elapsedMs = 0;
+  renderMs = 0;
+  renderMsMax = 0;
+  dropped = 0;
+  snapshotUs = 0;
+}
@@ -0,0 +1,163 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include "telemetry.h"
+#include "main.h"
+#include "lv_alloc.h"
+#include <esp_heap_caps.h>
+
+#ifndef TELEMETRY_INTERVAL
+#define TELEMETRY_INTERVAL 1000
+#endif
+
+TelemetryCounters telemetry;
+
+enum TelemetryMode
+{
+  TELEMETRY_OFF,
+  TELEMETRY_CSV,
+  TELEMETRY_BINARY,
+};
+
+#define TELEMETRY_FIELD(name) uint32_t name;
+#define TELEMETRY_NAME(name) "," #name
+
+struct TelemetryRecord
+{
+  TELEMETRY_FIELDS(TELEMETRY_FIELD)
+};
+
+#define TELEMETRY_COUNT (sizeof(TelemetryRecord) / sizeof(uint32_t))
+
+static volatile TelemetryMode mode = TELEMETRY_OFF;
+static volatile bool headerDue = false;
+static TelemetryCounters last;
+static uint32_t lastTime;
+
+void telemetryPoll()
+{
+  while (Serial.available())
+  {
+    switch (Serial.read())
+    {
+    case 'c':
+      headerDue = true;
+      mode = TELEMETRY_CSV;
+      break;
+    case 'b':
+      mode = TELEMETRY_BINARY;
+      break;
+    case 'x':
+      mode = TELEMETRY_OFF;
+      break;
+    }
+  }
+}
+
+static void sendCsv(const TelemetryRecord &record)
+{
+  if (headerDue)
+  {
+    headerDue = false;
+    Serial.println("T" TELEMETRY_FIELDS(TELEMETRY_NAME));
+  }
+
+  char line[TELEMETRY_COUNT * 11 + 4];
+  int len = snprintf(line, sizeof(line), "T");
+  const uint32_t *fields = (const uint32_t *)&record;
+  for (uint8_t i = 0; i < TELEMETRY_COUNT; i++)
+  {
+    len += snprintf(line + len, sizeof(line) - len, ",%u", fields[i]);
+  }
+  Serial.println(line);
+}
+
+static void sendBinary(const TelemetryRecord &record)
+{
+  uint8_t frame[4 + sizeof(TelemetryRecord) + 1];
+  frame[0] = TELEMETRY_SYNC & 0xFF;
+  frame[1] = TELEMETRY_SYNC >> 8;
+  frame[2] = TELEMETRY_VERSION;
+  frame[3] = TELEMETRY_COUNT;
+  memcpy(frame + 4, &record, sizeof(record)); // the ESP32 is little endian
+
+  uint8_t sum = 0;
+  for (size_t i = 0; i < sizeof(record); i++)
+  {
+    sum += frame[4 + i];
+  }
+  frame[sizeof(frame) - 1] = sum;
+  Serial.write(frame, sizeof(frame));
+}
+
+uint32_t telemetrySample(uint32_t uiDropped)
+{
+  uint32_t now = millis();
+  uint32_t elapsed = now - lastTime;
+  if (elapsed < TELEMETRY_INTERVAL)
+  {
+    return mode == TELEMETRY_OFF ? UINT32_MAX : TELEMETRY_INTERVAL - elapsed;
+  }
+
+  TelemetryCounters counters = telemetry;
+  telemetry.renderUsMax = 0;
+  telemetry.loopUsMax = 0;
+
+  if (mode != TELEMETRY_OFF)
+  {
+    TelemetryRecord record;
+    record.timeMs = now;
+    record.intervalMs = elapsed;
+    record.refreshes = counters.refreshes - last.refreshes;
+    record.renderUs = counters.renderUs - last.renderUs;
+    record.renderUsMax = counters.renderUsMax;
+    record.flushes = counters.flushes - last.flushes;
+    record.flushBytes = counters.flushBytes - last.flushBytes;
+    record.flushUs = counters.flushUs - last.flushUs;
+    record.loops = counters.loops - last.loops;
+    record.loopUs = counters.loopUs - last.loopUs;
+    record.loopUsMax = counters.loopUsMax;
+    record.bleEvents = counters.bleEvents - last.bleEvents;
+    record.uiDropped = uiDropped;
+    lvAllocUsage(&record.lvMemUsed, &record.lvMemPeak);
+    record.heapInternal = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    record.heapInternalMin = heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL);
+    record.heapPsram = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+    record.heapDma = heap_caps_get_free_size(MALLOC_CAP_DMA);
+
+    if (mode == TELEMETRY_CSV)
+    {
+      sendCsv(record);
+    }
+    else
+    {
+      sendBinary(record);
+    }
+  }
+
+  last = counters;
+  lastTime = now;
+  return mode == TELEMETRY_OFF ? UINT32_MAX : TELEMETRY_INTERVAL;
+}
@@ -0,0 +1,212 @@
+/*
+   MIT License
+
+  Copyright (c) 2022 Felix Biego
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+
+*/
+
+#include <Arduino.h>
+#include <Timber.h>
+#include "touch.h"
+#include "render.h"
+#include "ui_queue.h"
+
+struct TouchSample
+{
+  uint16_t x;
+  uint16_t y;
+  bool pressed;
+  bool down;       // first sample of a touch
+  uint32_t downUs; // INT edge of the touch-down
+};
+
+static SpscQueue<TouchSample, TOUCH_QUEUE_SIZE> touchQueue;
+static TaskHandle_t touchHandle;
+static TouchReadCb readTouch;
+static volatile uint32_t irqUs;
+
+// written by the touch task only, touchPrintStats() reports the change since the last call
+static volatile uint32_t reads = 0;
+static volatile uint32_t touches = 0;
+static volatile uint32_t idleReads = 0; // INT without a finger down
+static uint32_t lastReads = 0;
+static uint32_t lastTouches = 0;
+static uint32_t lastIdleReads = 0;
+static uint32_t lastDropped = 0;
+static uint32_t statsTime = 0;
+
+// render task
+static TouchSample last;
+static bool tapPending = false;
+static uint32_t tapStart;
+static uint32_t taps = 0;
+static uint32_t tapMs = 0;
+static uint32_t tapMsMax = 0;
+static uint32_t tapsNoRedraw = 0;
+
+static void IRAM_ATTR touchInterrupt()
+{
+  irqUs = micros();
+  BaseType_t woken = pdFALSE;
+  vTaskNotifyGiveFromISR(touchHandle, &woken);
+  portYIELD_FROM_ISR(woken);
+}
+
+static void touchTask(void *param)
+{
+  for (;;)
+  {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    TouchSample prev = {0, 0, false, false, 0};
+    for (;;)
+    {
+      TouchSample s = {0, 0, false, false, 0};
+      s.pressed = readTouch(&s.x, &s.y);
+      reads++;
+
+      if (!prev.pressed)
+      {
+        if (!s.pressed)
+        {
+          idleReads++; // the controller also pulses INT on release and on noise
+          break;
+        }
+        s.down = true;
+        s.downUs = irqUs;
+        touches++;
+      }
+      else if (s.pressed && s.x == prev.x && s.y == prev.y)
+      {
+        vTaskDelay(pdMS_TO_TICKS(TOUCH_SAMPLE_PERIOD)); // resting finger, lvgl repeats the last point
+        continue;
+      }
+
+      if (!s.pressed)
+      {
+        // a lost release would leave lvgl pressed, wait for room instead of dropping it
+        while (touchQueue.size() == TOUCH_QUEUE_SIZE)
+        {
+          vTaskDelay(1);
+        }
+      }
+      touchQueue.push(s);
+      renderWake();
+
+      if (!s.pressed)
+      {
+        break;
+      }
+      prev = s;
+      vTaskDelay(pdMS_TO_TICKS(TOUCH_SAMPLE_PERIOD));
+    }
+
+    ulTaskNotifyTake(pdTRUE, 0); // INT pulses of the touch just sampled
+  }
+}
+
+void touchBegin(uint8_t intPin, TouchReadCb read)
+{
+  readTouch = read;
+  statsTime = millis();
+
+  xTaskCreatePinnedToCore(touchTask, "touch", 3 * 1024, NULL, TOUCH_TASK_PRIORITY, &touchHandle, RENDER_TASK_CORE);
+
+  pinMode(intPin, INPUT);
+  attachInterrupt(digitalPinToInterrupt(intPin), touchInterrupt, FALLING);
+}
+
+void touchRead(lv_indev_drv_t *drv, lv_indev_data_t *data)
+{
+  TouchSample s;
+  if (touchQueue.pop(s))
+  {
+    last = s;
+    if (s.down)
+    {
+      tapPending = true;
+      tapStart = s.downUs;
+    }
+    data->continue_reading = touchQueue.size() > 0;
+  }
+  else if (!last.pressed && !lv_indev_get_act()->proc.types.pointer.scroll_obj)
+  {
+    // lvgl runs the scroll throw and the snap on the reads after the release
+    lv_timer_pause(drv->read_timer); // until the next sample
+  }
+
+  data->state = last.pressed ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+  data->point.x = last.x;
+  data->point.y = last.y;
+}
+
+bool touchPending()
+{
+  return touchQueue.size() > 0;
+}
+
+void touchRefreshed()
+{
+  if (!tapPending)
+  {
+    return;
+  }
+  tapPending = false;
+  uint32_t ms = (micros() - tapStart) / 1000;
+  if (ms > TOUCH_LATENCY_MAX)
+  {
+    tapsNoRedraw++;
+    return;
+  }
+  taps++;
+  tapMs += ms;
+  tapMsMax = max(tapMsMax, ms);
+}
+
+void touchPrintStats()
+{
+  uint32_t elapsed = millis() - statsTime;
+  statsTime = millis();
+  uint32_t r = reads - lastReads;
+  uint32_t t = touches - lastTouches;
+  uint32_t idle = idleReads - lastIdleReads;
+  uint32_t dropped = touchQueue.dropped() - lastDropped;
+  lastReads += r;
+  lastTouches += t;
+  lastIdleReads += idle;
+  lastDropped += dropped;
+
+  if (!elapsed)
+  {
+    return;
+  }
+  Timber.i("Touch: %u touches, %u I2C reads (%u/h), %u without a touch (%u/h), %u samples dropped", t, r,
+           (uint32_t)((uint64_t)r * 3600000 / elapsed), idle, (uint32_t)((uint64_t)idle * 3600000 / elapsed), dropped);
+  if (taps || tapsNoRedraw)
+  {
+    Timber.i("Touch: tap to redraw %u ms (max %u) over %u taps, %u taps redrew nothing", taps ? tapMs / taps : 0,
+             tapMsMax, taps, tapsNoRedraw);
+  }
+  taps = 0;
+  tapMs = 0;
+  tapMsMax = 0;
+  tapsNoRedraw = 0;
+}
@@ -10,77 +10,24 @@
 #endif
 
 // IMAGE DATA: assets\left-arrow.png
+// Run length encoded LV_IMG_CF_TRUE_COLOR_ALPHA, decoded by src/img_cache.cpp
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_1592976543_data[] = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x27,0x12,0xF2,0x06,0x4E,0xF2,0x06,0x7F,0xF2,0x06,0xA5,0xF2,0x06,0xC9,0xF2,0x06,0xE0,0xF2,0x06,0xEE,0xF2,0x06,0xFA,0xF2,0x06,0xFC,0xF2,0x06,0xEE,0xF2,0x06,0xE1,0xF2,0x06,0xCD,0xF2,0x06,0xA8,0xF2,0x06,0x84,0xF2,0x06,0x55,0xF2,0x06,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x06,0x2E,0xF2,0x06,0x87,0xF2,0x06,0xD2,0xF2,0x06,0xFD,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xD8,0xF2,0x06,0x91,0xF2,0x06,0x38,0xF8,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0x66,0x0A,0xF2,0x06,0x6B,0xF2,0x06,0xD3,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xDD,0xF2,0x06,0x79,0xEA,0x06,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEA,0x05,0x0C,0xF2,0x06,0x7E,0xF2,0x06,0xEA,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xF2,0xF2,0x06,0x8B,0xF2,0x06,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x06,0x4D,0xF2,0x06,0xE1,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xEF,0xF2,0x06,0x6F,0xFA,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x06,0x1C,0xF2,0x06,0xBD,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xCE,0xF1,0xE6,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x06,0x46,0xF2,0x06,0xE8,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xF6,0xF2,0x06,0x6F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x06,0x80,0xF2,0x06,0xFE,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0x9A,0xFA,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFA,0xAA,0x03,0xF2,0x06,0x97,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xB2,0xF9,0xC7,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFA,0xAA,0x03,0xF2,0x06,0xA8,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xC1,0xE2,0x66,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x06,0x91,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xB4,0xFA,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x06,0x7E,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x06,0x48,0xF2,0x06,0xFE,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0x66,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x06,0x17,0xF2,0x06,0xE7,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xF7,0xF2,0x06,0x2F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x06,0xB8,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xD3,0xF9,0x86,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x06,0x54,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF9,0xC7,0x09,0xF2,0x06,0xDF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xF2,0xF1,0xE6,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x06,0x75,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x47,0xFF,0xFD,0x13,0xFF,0xFD,0x95,0xFF,0xF2,0xCA,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFA,0x44,0x07,0xF2,0x06,0xE5,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xF5,0xF1,0xE6,0x15,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x06,0x62,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0xA9,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0x82,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x06,0xCA,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x38,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xE6,0xFA,0xAA,0x03,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xF2,0x06,0x23,0xF2,0x06,0xFE,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0x42,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xF2,0x06,0x7D,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0x9B,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xF2,0x06,0xC6,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xE6,0x00,0x00,0x00,
-    0xE2,0x66,0x0A,0xF2,0x06,0xF9,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0x23,
-    0xF2,0x06,0x43,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0x62,
-    0xF2,0x06,0x72,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0x90,
-    0xF2,0x06,0x97,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xB5,
-    0xF2,0x06,0xBB,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xDA,
-    0xF2,0x06,0xD2,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xF0,
-    0xF2,0x06,0xDE,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x47,0xFF,0xFE,0xBA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x99,0xFF,0xF2,0x47,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFC,
-    0xF2,0x06,0xEB,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF4,0x71,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x99,0xFF,0xF2,0x47,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,
-    0xF2,0x06,0xEA,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF4,0x70,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x99,0xFF,0xF2,0x47,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,
-    0xF2,0x06,0xDE,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x27,0xFF,0xFE,0xBA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x99,0xFF,0xF2,0x47,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFC,
-    0xF2,0x06,0xD2,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xF0,
-    0xF2,0x06,0xBB,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xD9,
-    0xF2,0x06,0x97,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xB4,
-    0xF2,0x06,0x72,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0x8F,
-    0xF2,0x06,0x42,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0x61,
-    0xE2,0x66,0x0A,0xF2,0x06,0xF9,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x26,0x22,
-    0x00,0x00,0x00,0xF2,0x06,0xC5,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xE3,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xF2,0x06,0x7B,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0x9A,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xF2,0x26,0x22,0xF2,0x06,0xFE,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0x40,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x06,0xC8,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x58,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xE5,0xFA,0xAA,0x03,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x06,0x61,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF2,0xA9,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0x80,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xF9,0x86,0x05,0xF2,0x06,0xE2,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xFF,0xF2,0x47,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xF5,0xF2,0x06,0x14,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x06,0x74,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x47,0xFF,0xFD,0x33,0xFF,0xFD,0xB6,0xFF,0xF3,0x2B,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF9,0xC7,0x09,0xF2,0x06,0xDE,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xF1,0xF1,0xE6,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x06,0x52,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x06,0xB7,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xD1,0xF9,0x86,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x06,0x17,0xF2,0x06,0xE7,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xF7,0xF2,0x06,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x06,0x47,0xF2,0x06,0xFD,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x06,0x7C,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0x9A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x06,0x90,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xB3,0xFA,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFA,0xAA,0x03,0xF2,0x06,0xA8,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xC1,0xF9,0xC7,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFA,0xAA,0x03,0xF2,0x06,0x96,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xB1,0xF9,0xC7,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x06,0x7E,0xF2,0x06,0xFE,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0x98,0xFA,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x06,0x44,0xF2,0x06,0xE7,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xF6,0xF2,0x06,0x6F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x07,0x1B,0xF2,0x06,0xBC,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xCD,0xF2,0x06,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x06,0x4D,0xF2,0x06,0xE0,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xEE,0xF2,0x06,0x6F,0xFA,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEA,0x25,0x0B,0xF2,0x06,0x7C,0xF2,0x06,0xE9,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xF1,0xF2,0x06,0x8A,0xF2,0x06,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF9,0xC7,0x09,0xF2,0x06,0x6A,0xF2,0x06,0xD2,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xDC,0xF2,0x06,0x78,0xEA,0x26,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0x06,0x2C,0xF2,0x06,0x85,0xF2,0x06,0xD0,0xF2,0x06,0xFD,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xD6,0xF2,0x06,0x8F,0xF2,0x06,0x37,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF1,0xE5,0x11,0xF2,0x06,0x4E,0xF2,0x06,0x7D,0xF2,0x06,0xA3,0xF2,0x06,0xC8,0xF2,0x06,0xDD,0xF2,0x06,0xEE,0xF2,0x06,0xF9,0xF2,0x06,0xFB,0xF2,0x06,0xEE,0xF2,0x06,0xDF,0xF2,0x06,0xCB,0xF2,0x06,0xA7,0xF2,0x06,0x82,0xF2,0x06,0x54,0xF2,0x06,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x97,0x00,0x00,0x00,0x0F,0xF2,0x27,0x12,0xF2,0x06,0x4E,0xF2,0x06,0x7F,0xF2,0x06,0xA5,0xF2,0x06,0xC9,0xF2,0x06,0xE0,0xF2,0x06,0xEE,0xF2,0x06,0xFA,0xF2,0x06,0xFC,0xF2,0x06,0xEE,0xF2,0x06,0xE1,0xF2,0x06,0xCD,0xF2,0x06,0xA8,0xF2,0x06,0x84,0xF2,0x06,0x55,0xF2,0x06,0x18,0xAC,0x00,0x00,0x00,0x03,0xF2,0x06,0x2E,0xF2,0x06,0x87,0xF2,0x06,0xD2,0xF2,0x06,0xFD,0x8E,0xF2,0x06,0xFF,0x03,0xF2,0x06,0xD8,0xF2,0x06,0x91,0xF2,0x06,0x38,0xF8,0x00,0x01,0xA5,0x00,0x00,0x00,0x02,0xE2,0x66,0x0A,0xF2,0x06,0x6B,0xF2,0x06,0xD3,0x95,0xF2,0x06,0xFF,0x02,0xF2,0x06,0xDD,0xF2,0x06,0x79,0xEA,0x06,0x10,0xA1,0x00,0x00,0x00,0x02,0xEA,0x05,0x0C,0xF2,0x06,0x7E,0xF2,0x06,0xEA,0x99,0xF2,0x06,0xFF,0x02,0xF2,0x06,0xF2,0xF2,0x06,0x8B,0xF2,0x06,0x14,0x9E,0x00,0x00,0x00,0x01,0xF2,0x06,0x4D,0xF2,0x06,0xE1,0x9D,0xF2,0x06,0xFF,0x02,0xF2,0x06,0xEF,0xF2,0x06,0x6F,0xFA,0x08,0x04,0x9A,0x00,0x00,0x00,0x01,0xF2,0x06,0x1C,0xF2,0x06,0xBD,0xA1,0xF2,0x06,0xFF,0x01,0xF2,0x06,0xCE,0xF1,0xE6,0x29,0x98,0x00,
+    0x00,0x00,0x01,0xF2,0x06,0x46,0xF2,0x06,0xE8,0xA3,0xF2,0x06,0xFF,0x01,0xF2,0x06,0xF6,0xF2,0x06,0x6F,0x96,0x00,0x00,0x00,0x01,0xF2,0x06,0x80,0xF2,0x06,0xFE,0xA6,0xF2,0x06,0xFF,0x01,0xF2,0x06,0x9A,0xFA,0xAA,0x03,0x92,0x00,0x00,0x00,0x01,0xFA,0xAA,0x03,0xF2,0x06,0x97,0xA9,0xF2,0x06,0xFF,0x01,0xF2,0x06,0xB2,0xF9,0xC7,0x09,0x90,0x00,0x00,0x00,0x01,0xFA,0xAA,0x03,0xF2,0x06,0xA8,0xAB,0xF2,0x06,0xFF,0x01,0xF2,0x06,0xC1,0xE2,0x66,0x0A,0x8F,0x00,0x00,0x00,0x00,0xF2,0x06,0x91,0xAD,0xF2,0x06,0xFF,0x01,0xF2,0x06,0xB4,0xFA,0x08,0x04,0x8D,0x00,0x00,0x00,0x00,0xF2,0x06,0x7E,0xAF,0xF2,0x06,0xFF,0x00,0xF2,0x06,0x9C,0x8C,0x00,0x00,0x00,0x01,0xF2,0x06,0x48,0xF2,0x06,0xFE,0xB0,0xF2,0x06,0xFF,0x00,0xF2,0x06,0x66,0x8A,0x00,0x00,0x00,0x01,0xF2,0x06,0x17,0xF2,0x06,0xE7,0xB1,0xF2,0x06,0xFF,0x01,0xF2,0x06,0xF7,0xF2,0x06,0x2F,0x89,0x00,0x00,0x00,0x00,0xF2,0x06,0xB8,0xB3,0xF2,0x06,0xFF,0x01,0xF2,0x06,0xD3,0xF9,0x86,0x05,0x87,0x00,0x00,0x00,0x00,0xF2,0x06,0x54,0xB5,0xF2,0x06,
+    0xFF,0x00,0xF2,0x06,0x72,0x86,0x00,0x00,0x00,0x01,0xF9,0xC7,0x09,0xF2,0x06,0xDF,0xB5,0xF2,0x06,0xFF,0x01,0xF2,0x06,0xF2,0xF1,0xE6,0x19,0x85,0x00,0x00,0x00,0x00,0xF2,0x06,0x75,0x9E,0xF2,0x06,0xFF,0x03,0xF2,0x47,0xFF,0xFD,0x13,0xFF,0xFD,0x95,0xFF,0xF2,0xCA,0xFF,0x94,0xF2,0x06,0xFF,0x00,0xF2,0x06,0x94,0x84,0x00,0x00,0x00,0x01,0xFA,0x44,0x07,0xF2,0x06,0xE5,0x9D,0xF2,0x06,0xFF,0x01,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0x81,0xFF,0xFF,0xFF,0x00,0xFF,0x3C,0xFF,0x94,0xF2,0x06,0xFF,0x01,0xF2,0x06,0xF5,0xF1,0xE6,0x15,0x83,0x00,0x00,0x00,0x00,0xF2,0x06,0x62,0x9D,0xF2,0x06,0xFF,0x01,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0x83,0xFF,0xFF,0xFF,0x00,0xF2,0xA9,0xFF,0x94,0xF2,0x06,0xFF,0x00,0xF2,0x06,0x82,0x83,0x00,0x00,0x00,0x00,0xF2,0x06,0xCA,0x9C,0xF2,0x06,0xFF,0x01,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0x83,0xFF,0xFF,0xFF,0x00,0xFE,0x38,0xFF,0x95,0xF2,0x06,0xFF,0x01,0xF2,0x06,0xE6,0xFA,0xAA,0x03,0x81,0x00,0x00,0x00,0x01,0xF2,0x06,0x23,0xF2,0x06,0xFE,0x9B,0xF2,0x06,0xFF,0x01,0xF2,0x68,
+    0xFF,0xFE,0xBA,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0x96,0xF2,0x06,0xFF,0x00,0xF2,0x06,0x42,0x81,0x00,0x00,0x00,0x00,0xF2,0x06,0x7D,0x9B,0xF2,0x06,0xFF,0x01,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0x97,0xF2,0x06,0xFF,0x00,0xF2,0x06,0x9B,0x81,0x00,0x00,0x00,0x00,0xF2,0x06,0xC6,0x9A,0xF2,0x06,0xFF,0x01,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0x98,0xF2,0x06,0xFF,0x03,0xF2,0x06,0xE6,0x00,0x00,0x00,0xE2,0x66,0x0A,0xF2,0x06,0xF9,0x99,0xF2,0x06,0xFF,0x01,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0x9A,0xF2,0x06,0xFF,0x01,0xF2,0x06,0x23,0xF2,0x06,0x43,0x99,0xF2,0x06,0xFF,0x01,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0x9B,0xF2,0x06,0xFF,0x01,0xF2,0x06,0x62,0xF2,0x06,0x72,0x98,0xF2,0x06,0xFF,0x01,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xFE,0x9A,
+    0xFF,0xF2,0x47,0xFF,0x9C,0xF2,0x06,0xFF,0x01,0xF2,0x06,0x90,0xF2,0x06,0x97,0x97,0xF2,0x06,0xFF,0x01,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0x9D,0xF2,0x06,0xFF,0x01,0xF2,0x06,0xB5,0xF2,0x06,0xBB,0x96,0xF2,0x06,0xFF,0x01,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0x9E,0xF2,0x06,0xFF,0x01,0xF2,0x06,0xDA,0xF2,0x06,0xD2,0x95,0xF2,0x06,0xFF,0x01,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0x9F,0xF2,0x06,0xFF,0x01,0xF2,0x06,0xF0,0xF2,0x06,0xDE,0x94,0xF2,0x06,0xFF,0x01,0xF2,0x47,0xFF,0xFE,0xBA,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xFE,0x99,0xFF,0xF2,0x47,0xFF,0xA0,0xF2,0x06,0xFF,0x01,0xF2,0x06,0xFC,0xF2,0x06,0xEB,0x94,0xF2,0x06,0xFF,0x00,0xF4,0x71,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xFE,0x99,0xFF,0xF2,0x47,0xFF,0xA2,0xF2,0x06,0xFF,0x00,0xF2,0x06,0xEA,0x94,0xF2,0x06,0xFF,0x00,0xF4,0x70,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xFE,0x99,0xFF,0xF2,0x47,
+    0xFF,0xA2,0xF2,0x06,0xFF,0x00,0xF2,0x06,0xDE,0x94,0xF2,0x06,0xFF,0x01,0xF2,0x27,0xFF,0xFE,0xBA,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xFE,0x99,0xFF,0xF2,0x47,0xFF,0xA0,0xF2,0x06,0xFF,0x01,0xF2,0x06,0xFC,0xF2,0x06,0xD2,0x95,0xF2,0x06,0xFF,0x01,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0x9F,0xF2,0x06,0xFF,0x01,0xF2,0x06,0xF0,0xF2,0x06,0xBB,0x96,0xF2,0x06,0xFF,0x01,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0x9E,0xF2,0x06,0xFF,0x01,0xF2,0x06,0xD9,0xF2,0x06,0x97,0x97,0xF2,0x06,0xFF,0x01,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0x9D,0xF2,0x06,0xFF,0x01,0xF2,0x06,0xB4,0xF2,0x06,0x72,0x98,0xF2,0x06,0xFF,0x01,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0x9C,0xF2,0x06,0xFF,0x01,0xF2,0x06,0x8F,0xF2,0x06,0x42,0x99,0xF2,0x06,0xFF,0x01,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xFE,0x9A,
+    0xFF,0xF2,0x47,0xFF,0x9B,0xF2,0x06,0xFF,0x02,0xF2,0x06,0x61,0xE2,0x66,0x0A,0xF2,0x06,0xF9,0x99,0xF2,0x06,0xFF,0x01,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0x9A,0xF2,0x06,0xFF,0x02,0xF2,0x26,0x22,0x00,0x00,0x00,0xF2,0x06,0xC5,0x9A,0xF2,0x06,0xFF,0x01,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0x98,0xF2,0x06,0xFF,0x00,0xF2,0x06,0xE3,0x81,0x00,0x00,0x00,0x00,0xF2,0x06,0x7B,0x9B,0xF2,0x06,0xFF,0x01,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0x97,0xF2,0x06,0xFF,0x00,0xF2,0x06,0x9A,0x81,0x00,0x00,0x00,0x01,0xF2,0x26,0x22,0xF2,0x06,0xFE,0x9B,0xF2,0x06,0xFF,0x01,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xFE,0x9A,0xFF,0xF2,0x47,0xFF,0x96,0xF2,0x06,0xFF,0x00,0xF2,0x06,0x40,0x82,0x00,0x00,0x00,0x00,0xF2,0x06,0xC8,0x9C,0xF2,0x06,0xFF,0x01,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0x83,0xFF,0xFF,0xFF,0x00,0xFE,0x58,0xFF,0x95,0xF2,
+    0x06,0xFF,0x01,0xF2,0x06,0xE5,0xFA,0xAA,0x03,0x82,0x00,0x00,0x00,0x00,0xF2,0x06,0x61,0x9D,0xF2,0x06,0xFF,0x01,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0x83,0xFF,0xFF,0xFF,0x00,0xF2,0xA9,0xFF,0x94,0xF2,0x06,0xFF,0x00,0xF2,0x06,0x80,0x83,0x00,0x00,0x00,0x01,0xF9,0x86,0x05,0xF2,0x06,0xE2,0x9D,0xF2,0x06,0xFF,0x01,0xF2,0x68,0xFF,0xFE,0xBA,0xFF,0x81,0xFF,0xFF,0xFF,0x01,0xFF,0x7D,0xFF,0xF2,0x47,0xFF,0x93,0xF2,0x06,0xFF,0x01,0xF2,0x06,0xF5,0xF2,0x06,0x14,0x84,0x00,0x00,0x00,0x00,0xF2,0x06,0x74,0x9E,0xF2,0x06,0xFF,0x03,0xF2,0x47,0xFF,0xFD,0x33,0xFF,0xFD,0xB6,0xFF,0xF3,0x2B,0xFF,0x94,0xF2,0x06,0xFF,0x00,0xF2,0x06,0x92,0x85,0x00,0x00,0x00,0x01,0xF9,0xC7,0x09,0xF2,0x06,0xDE,0xB5,0xF2,0x06,0xFF,0x01,0xF2,0x06,0xF1,0xF1,0xE6,0x19,0x86,0x00,0x00,0x00,0x00,0xF2,0x06,0x52,0xB5,0xF2,0x06,0xFF,0x00,0xF2,0x06,0x70,0x88,0x00,0x00,0x00,0x00,0xF2,0x06,0xB7,0xB3,0xF2,0x06,0xFF,0x01,0xF2,0x06,0xD1,0xF9,0x86,0x05,0x88,0x00,0x00,0x00,0x01,0xF2,0x06,0x17,0xF2,0x06,0xE7,0xB1,0xF2,0x06,
+    0xFF,0x01,0xF2,0x06,0xF7,0xF2,0x06,0x2E,0x8A,0x00,0x00,0x00,0x01,0xF2,0x06,0x47,0xF2,0x06,0xFD,0xB0,0xF2,0x06,0xFF,0x00,0xF2,0x06,0x64,0x8C,0x00,0x00,0x00,0x00,0xF2,0x06,0x7C,0xAF,0xF2,0x06,0xFF,0x00,0xF2,0x06,0x9A,0x8E,0x00,0x00,0x00,0x00,0xF2,0x06,0x90,0xAD,0xF2,0x06,0xFF,0x01,0xF2,0x06,0xB3,0xFA,0x08,0x04,0x8E,0x00,0x00,0x00,0x01,0xFA,0xAA,0x03,0xF2,0x06,0xA8,0xAB,0xF2,0x06,0xFF,0x01,0xF2,0x06,0xC1,0xF9,0xC7,0x09,0x90,0x00,0x00,0x00,0x01,0xFA,0xAA,0x03,0xF2,0x06,0x96,0xA9,0xF2,0x06,0xFF,0x01,0xF2,0x06,0xB1,0xF9,0xC7,0x09,0x93,0x00,0x00,0x00,0x01,0xF2,0x06,0x7E,0xF2,0x06,0xFE,0xA6,0xF2,0x06,0xFF,0x01,0xF2,0x06,0x98,0xFA,0xAA,0x03,0x95,0x00,0x00,0x00,0x01,0xF2,0x06,0x44,0xF2,0x06,0xE7,0xA3,0xF2,0x06,0xFF,0x01,0xF2,0x06,0xF6,0xF2,0x06,0x6F,0x98,0x00,0x00,0x00,0x01,0xF2,0x07,0x1B,0xF2,0x06,0xBC,0xA1,0xF2,0x06,0xFF,0x01,0xF2,0x06,0xCD,0xF2,0x06,0x28,0x9B,0x00,0x00,0x00,0x01,0xF2,0x06,0x4D,0xF2,0x06,0xE0,0x9D,0xF2,0x06,0xFF,0x02,0xF2,0x06,0xEE,0xF2,
+    0x06,0x6F,0xFA,0xAA,0x03,0x9D,0x00,0x00,0x00,0x02,0xEA,0x25,0x0B,0xF2,0x06,0x7C,0xF2,0x06,0xE9,0x99,0xF2,0x06,0xFF,0x02,0xF2,0x06,0xF1,0xF2,0x06,0x8A,0xF2,0x06,0x13,0xA1,0x00,0x00,0x00,0x02,0xF9,0xC7,0x09,0xF2,0x06,0x6A,0xF2,0x06,0xD2,0x95,0xF2,0x06,0xFF,0x02,0xF2,0x06,0xDC,0xF2,0x06,0x78,0xEA,0x26,0x0F,0xA6,0x00,0x00,0x00,0x03,0xF2,0x06,0x2C,0xF2,0x06,0x85,0xF2,0x06,0xD0,0xF2,0x06,0xFD,0x8E,0xF2,0x06,0xFF,0x02,0xF2,0x06,0xD6,0xF2,0x06,0x8F,0xF2,0x06,0x37,0xAC,0x00,0x00,0x00,0x0F,0xF1,0xE5,0x11,0xF2,0x06,0x4E,0xF2,0x06,0x7D,0xF2,0x06,0xA3,0xF2,0x06,0xC8,0xF2,0x06,0xDD,0xF2,0x06,0xEE,0xF2,0x06,0xF9,0xF2,0x06,0xFB,0xF2,0x06,0xEE,0xF2,0x06,0xDF,0xF2,0x06,0xCB,0xF2,0x06,0xA7,0xF2,0x06,0x82,0xF2,0x06,0x54,0xF2,0x06,0x17,0x97,0x00,0x00,0x00,
     };
 const lv_img_dsc_t ui_img_1592976543 = {
    .header.always_zero = 0,
    .header.w = 64,
    .header.h = 64,
    .data_size = sizeof(ui_img_1592976543_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+   .header.cf = LV_IMG_CF_USER_ENCODED_1,
    .data = ui_img_1592976543_data};
 
@@ -10,77 +10,24 @@
 #endif
 
 // IMAGE DATA: assets\right-arrow.png
+// Run length encoded LV_IMG_CF_TRUE_COLOR_ALPHA, decoded by src/img_cache.cpp
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_2138854088_data[] = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x28,0x12,0x8E,0x09,0x4E,0x8E,0x09,0x7F,0x8E,0x09,0xA5,0x8E,0x09,0xC9,0x8E,0x09,0xE0,0x8E,0x09,0xEE,0x8E,0x09,0xFA,0x8E,0x09,0xFC,0x8E,0x09,0xEE,0x8E,0x09,0xE1,0x8E,0x09,0xCD,0x8E,0x09,0xA8,0x8E,0x09,0x84,0x8E,0x09,0x55,0x8D,0xE9,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x09,0x2E,0x8E,0x09,0x87,0x8E,0x09,0xD2,0x8E,0x09,0xFD,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xD8,0x8E,0x09,0x91,0x8E,0x29,0x38,0xFF,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x69,0x0A,0x8E,0x09,0x6B,0x8E,0x09,0xD3,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xDD,0x8E,0x09,0x79,0x8D,0xEA,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xE8,0x0C,0x8E,0x09,0x7E,0x8E,0x09,0xEA,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xF2,0x8E,0x09,0x8B,0x8D,0xE9,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x09,0x4D,0x8E,0x09,0xE1,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xEF,0x8E,0x09,0x6F,0x85,0xE8,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8D,0xE9,0x1C,0x8E,0x09,0xBD,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xCE,0x8E,0x09,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x09,0x46,0x8E,0x09,0xE8,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xF6,0x8E,0x09,0x6F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x09,0x80,0x8E,0x09,0xFE,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0x9A,0xAD,0x4A,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x4A,0x03,0x8E,0x09,0x97,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xB2,0x8E,0x2A,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x4A,0x03,0x8E,0x09,0xA8,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xC1,0x8E,0x2A,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x09,0x91,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xB3,0x85,0xE8,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x09,0x7E,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x09,0x48,0x8E,0x09,0xFE,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0x66,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xE9,0x17,0x8E,0x09,0xE7,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xF7,0x8E,0x08,0x2F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x09,0xB9,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xD2,0x9E,0x66,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x09,0x54,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x2A,0x09,0x8E,0x09,0xDF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xF2,0x8E,0x08,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x09,0x76,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x9E,0x4C,0xFF,0xD7,0x36,0xFF,0xCF,0x36,0xFF,0x96,0x2B,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0x93,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x95,0xA9,0x07,0x8E,0x09,0xE5,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0xEF,0xBC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xBC,0xFF,0x96,0x4B,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xF5,0x86,0x09,0x15,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x09,0x63,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xBC,0xFF,0x96,0x4B,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0x81,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x09,0xCA,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0xD7,0x36,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xBC,0xFF,0x96,0x4B,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xE6,0xAD,0x4A,0x03,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x8E,0x29,0x23,0x8E,0x09,0xFE,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0xD7,0x57,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDD,0xFF,0x9E,0x4C,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0x42,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x8E,0x09,0x7D,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0xD7,0x57,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDD,0xFF,0x9E,0x4C,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0x9B,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x8E,0x09,0xC6,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0xD7,0x57,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDD,0xFF,0x9E,0x4C,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xE4,0x00,0x00,0x00,
-    0x86,0x69,0x0A,0x8E,0x09,0xF9,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0xD7,0x57,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDD,0xFF,0x9E,0x4C,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x29,0x23,
-    0x8E,0x09,0x43,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0xD7,0x57,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDD,0xFF,0x9E,0x4C,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0x61,
-    0x8E,0x09,0x72,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0xD7,0x57,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDD,0xFF,0x9E,0x4C,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0x90,
-    0x8E,0x09,0x97,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0xD7,0x57,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDD,0xFF,0x9E,0x4C,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xB4,
-    0x8E,0x09,0xBB,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0xD7,0x57,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDD,0xFF,0x9E,0x4C,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xD9,
-    0x8E,0x09,0xD2,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0xD7,0x57,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDD,0xFF,0x9E,0x4C,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xF0,
-    0x8E,0x09,0xDE,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0xDF,0x58,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xBC,0xFF,0x96,0x2B,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFC,
-    0x8E,0x09,0xEB,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0xDF,0x58,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCF,0x15,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,
-    0x8E,0x09,0xEA,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0xDF,0x58,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCF,0x15,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,
-    0x8E,0x09,0xDE,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0xDF,0x58,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xBC,0xFF,0x96,0x2B,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFC,
-    0x8E,0x09,0xD2,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0xD7,0x57,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0xFF,0x9E,0x4C,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xF0,
-    0x8E,0x09,0xBB,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0xD7,0x57,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0xFF,0x9E,0x4C,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xD9,
-    0x8E,0x09,0x97,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0xD7,0x57,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0xFF,0x9E,0x4C,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xB4,
-    0x8E,0x09,0x72,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0xD7,0x57,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0xFF,0x9E,0x4C,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0x8F,
-    0x8E,0x09,0x42,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0xD7,0x57,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0xFF,0x9E,0x4C,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0x61,
-    0x86,0x69,0x0A,0x8E,0x09,0xF9,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0xD7,0x57,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0xFF,0x9E,0x4C,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x86,0x09,0x22,
-    0x00,0x00,0x00,0x8E,0x09,0xC5,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0xD7,0x57,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0xFF,0x9E,0x4C,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xE3,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x8E,0x09,0x7B,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0xD7,0x57,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0xFF,0x9E,0x4C,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0x9A,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x86,0x09,0x22,0x8E,0x09,0xFE,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0xD7,0x57,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBD,0xFF,0x9E,0x4C,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0x40,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x09,0xC8,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0xCF,0x36,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xBC,0xFF,0x96,0x4B,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xE5,0xAD,0x4A,0x03,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x09,0x61,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xBC,0xFF,0x96,0x4B,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0x80,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x9E,0x66,0x05,0x8E,0x09,0xE2,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0xE7,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xBC,0xFF,0x96,0x4B,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xF5,0x8D,0xE9,0x14,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x09,0x74,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x96,0x2A,0xFF,0xCF,0x15,0xFF,0xCF,0x15,0xFF,0x96,0x2B,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x2A,0x09,0x8E,0x09,0xDE,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xF1,0x8E,0x08,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x09,0x52,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x09,0xB7,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xD1,0x9E,0x66,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x85,0xE9,0x17,0x8E,0x09,0xE7,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xF7,0x8E,0x09,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x09,0x47,0x8E,0x09,0xFD,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x09,0x7C,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0x9A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x09,0x90,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xB3,0x85,0xE8,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x4A,0x03,0x8E,0x09,0xA8,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xC1,0x8E,0x2A,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAD,0x4A,0x03,0x8E,0x09,0x96,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xB1,0x8E,0x2A,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x09,0x7E,0x8E,0x09,0xFE,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0x98,0xAD,0x4A,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x08,0x44,0x8E,0x09,0xE7,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xF6,0x8E,0x09,0x6F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x29,0x1B,0x8E,0x09,0xBC,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xCD,0x8D,0xE8,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x09,0x4D,0x8E,0x09,0xE0,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xEE,0x8E,0x09,0x6F,0xAD,0x4A,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8D,0xC8,0x0B,0x8E,0x09,0x7C,0x8E,0x09,0xE9,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xF1,0x8E,0x09,0x8A,0x85,0xE8,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8E,0x2A,0x09,0x8E,0x09,0x6A,0x8E,0x09,0xD2,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xDC,0x8E,0x09,0x78,0x8D,0xC8,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8D,0xE9,0x2C,0x8E,0x09,0x85,0x8E,0x09,0xD0,0x8E,0x09,0xFD,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xFF,0x8E,0x09,0xD6,0x8E,0x09,0x8F,0x8E,0x09,0x37,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x86,0x09,0x11,0x8E,0x09,0x4E,0x8E,0x09,0x7D,0x8E,0x09,0xA3,0x8E,0x09,0xC8,0x8E,0x09,0xDD,0x8E,0x09,0xEE,0x8E,0x09,0xF9,0x8E,0x09,0xFB,0x8E,0x09,0xEE,0x8E,0x09,0xDF,0x8E,0x09,0xCB,0x8E,0x09,0xA7,0x8E,0x09,0x82,0x8E,0x09,0x54,0x85,0xE9,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x97,0x00,0x00,0x00,0x0F,0x8E,0x28,0x12,0x8E,0x09,0x4E,0x8E,0x09,0x7F,0x8E,0x09,0xA5,0x8E,0x09,0xC9,0x8E,0x09,0xE0,0x8E,0x09,0xEE,0x8E,0x09,0xFA,0x8E,0x09,0xFC,0x8E,0x09,0xEE,0x8E,0x09,0xE1,0x8E,0x09,0xCD,0x8E,0x09,0xA8,0x8E,0x09,0x84,0x8E,0x09,0x55,0x8D,0xE9,0x18,0xAC,0x00,0x00,0x00,0x03,0x8E,0x09,0x2E,0x8E,0x09,0x87,0x8E,0x09,0xD2,0x8E,0x09,0xFD,0x8E,0x8E,0x09,0xFF,0x03,0x8E,0x09,0xD8,0x8E,0x09,0x91,0x8E,0x29,0x38,0xFF,0xE0,0x01,0xA5,0x00,0x00,0x00,0x02,0x86,0x69,0x0A,0x8E,0x09,0x6B,0x8E,0x09,0xD3,0x95,0x8E,0x09,0xFF,0x02,0x8E,0x09,0xDD,0x8E,0x09,0x79,0x8D,0xEA,0x10,0xA1,0x00,0x00,0x00,0x02,0x85,0xE8,0x0C,0x8E,0x09,0x7E,0x8E,0x09,0xEA,0x99,0x8E,0x09,0xFF,0x02,0x8E,0x09,0xF2,0x8E,0x09,0x8B,0x8D,0xE9,0x14,0x9E,0x00,0x00,0x00,0x01,0x8E,0x09,0x4D,0x8E,0x09,0xE1,0x9D,0x8E,0x09,0xFF,0x02,0x8E,0x09,0xEF,0x8E,0x09,0x6F,0x85,0xE8,0x04,0x9A,0x00,0x00,0x00,0x01,0x8D,0xE9,0x1C,0x8E,0x09,0xBD,0xA1,0x8E,0x09,0xFF,0x01,0x8E,0x09,0xCE,0x8E,0x09,0x29,0x98,0x00,
+    0x00,0x00,0x01,0x8E,0x09,0x46,0x8E,0x09,0xE8,0xA3,0x8E,0x09,0xFF,0x01,0x8E,0x09,0xF6,0x8E,0x09,0x6F,0x96,0x00,0x00,0x00,0x01,0x8E,0x09,0x80,0x8E,0x09,0xFE,0xA6,0x8E,0x09,0xFF,0x01,0x8E,0x09,0x9A,0xAD,0x4A,0x03,0x92,0x00,0x00,0x00,0x01,0xAD,0x4A,0x03,0x8E,0x09,0x97,0xA9,0x8E,0x09,0xFF,0x01,0x8E,0x09,0xB2,0x8E,0x2A,0x09,0x90,0x00,0x00,0x00,0x01,0xAD,0x4A,0x03,0x8E,0x09,0xA8,0xAB,0x8E,0x09,0xFF,0x01,0x8E,0x09,0xC1,0x8E,0x2A,0x09,0x8F,0x00,0x00,0x00,0x00,0x8E,0x09,0x91,0xAD,0x8E,0x09,0xFF,0x01,0x8E,0x09,0xB3,0x85,0xE8,0x04,0x8D,0x00,0x00,0x00,0x00,0x8E,0x09,0x7E,0xAF,0x8E,0x09,0xFF,0x00,0x8E,0x09,0x9C,0x8C,0x00,0x00,0x00,0x01,0x8E,0x09,0x48,0x8E,0x09,0xFE,0xB0,0x8E,0x09,0xFF,0x00,0x8E,0x09,0x66,0x8A,0x00,0x00,0x00,0x01,0x85,0xE9,0x17,0x8E,0x09,0xE7,0xB1,0x8E,0x09,0xFF,0x01,0x8E,0x09,0xF7,0x8E,0x08,0x2F,0x89,0x00,0x00,0x00,0x00,0x8E,0x09,0xB9,0xB3,0x8E,0x09,0xFF,0x01,0x8E,0x09,0xD2,0x9E,0x66,0x05,0x87,0x00,0x00,0x00,0x00,0x8E,0x09,0x54,0xB5,0x8E,0x09,
+    0xFF,0x00,0x8E,0x09,0x71,0x86,0x00,0x00,0x00,0x01,0x8E,0x2A,0x09,0x8E,0x09,0xDF,0xB5,0x8E,0x09,0xFF,0x01,0x8E,0x09,0xF2,0x8E,0x08,0x19,0x85,0x00,0x00,0x00,0x00,0x8E,0x09,0x76,0x94,0x8E,0x09,0xFF,0x03,0x9E,0x4C,0xFF,0xD7,0x36,0xFF,0xCF,0x36,0xFF,0x96,0x2B,0xFF,0x9E,0x8E,0x09,0xFF,0x00,0x8E,0x09,0x93,0x84,0x00,0x00,0x00,0x01,0x95,0xA9,0x07,0x8E,0x09,0xE5,0x94,0x8E,0x09,0xFF,0x00,0xEF,0xBC,0xFF,0x81,0xFF,0xFF,0xFF,0x01,0xEF,0xBC,0xFF,0x96,0x4B,0xFF,0x9D,0x8E,0x09,0xFF,0x01,0x8E,0x09,0xF5,0x86,0x09,0x15,0x83,0x00,0x00,0x00,0x00,0x8E,0x09,0x63,0x95,0x8E,0x09,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xEF,0xBC,0xFF,0x96,0x4B,0xFF,0x9D,0x8E,0x09,0xFF,0x00,0x8E,0x09,0x81,0x83,0x00,0x00,0x00,0x00,0x8E,0x09,0xCA,0x95,0x8E,0x09,0xFF,0x00,0xD7,0x36,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xEF,0xBC,0xFF,0x96,0x4B,0xFF,0x9C,0x8E,0x09,0xFF,0x01,0x8E,0x09,0xE6,0xAD,0x4A,0x03,0x81,0x00,0x00,0x00,0x01,0x8E,0x29,0x23,0x8E,0x09,0xFE,0x96,0x8E,0x09,0xFF,0x00,0xD7,0x57,0xFF,0x83,0xFF,0xFF,
+    0xFF,0x01,0xF7,0xDD,0xFF,0x9E,0x4C,0xFF,0x9C,0x8E,0x09,0xFF,0x00,0x8E,0x09,0x42,0x81,0x00,0x00,0x00,0x00,0x8E,0x09,0x7D,0x98,0x8E,0x09,0xFF,0x00,0xD7,0x57,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xF7,0xDD,0xFF,0x9E,0x4C,0xFF,0x9B,0x8E,0x09,0xFF,0x00,0x8E,0x09,0x9B,0x81,0x00,0x00,0x00,0x00,0x8E,0x09,0xC6,0x99,0x8E,0x09,0xFF,0x00,0xD7,0x57,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xF7,0xDD,0xFF,0x9E,0x4C,0xFF,0x9A,0x8E,0x09,0xFF,0x03,0x8E,0x09,0xE4,0x00,0x00,0x00,0x86,0x69,0x0A,0x8E,0x09,0xF9,0x9A,0x8E,0x09,0xFF,0x00,0xD7,0x57,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xF7,0xDD,0xFF,0x9E,0x4C,0xFF,0x9A,0x8E,0x09,0xFF,0x01,0x8E,0x29,0x23,0x8E,0x09,0x43,0x9C,0x8E,0x09,0xFF,0x00,0xD7,0x57,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xF7,0xDD,0xFF,0x9E,0x4C,0xFF,0x99,0x8E,0x09,0xFF,0x01,0x8E,0x09,0x61,0x8E,0x09,0x72,0x9D,0x8E,0x09,0xFF,0x00,0xD7,0x57,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xF7,0xDD,0xFF,0x9E,0x4C,0xFF,0x98,0x8E,0x09,0xFF,0x01,0x8E,0x09,0x90,0x8E,0x09,0x97,0x9E,0x8E,0x09,0xFF,0x00,0xD7,0x57,
+    0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xF7,0xDD,0xFF,0x9E,0x4C,0xFF,0x97,0x8E,0x09,0xFF,0x01,0x8E,0x09,0xB4,0x8E,0x09,0xBB,0x9F,0x8E,0x09,0xFF,0x00,0xD7,0x57,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xF7,0xDD,0xFF,0x9E,0x4C,0xFF,0x96,0x8E,0x09,0xFF,0x01,0x8E,0x09,0xD9,0x8E,0x09,0xD2,0xA0,0x8E,0x09,0xFF,0x00,0xD7,0x57,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xF7,0xDD,0xFF,0x9E,0x4C,0xFF,0x95,0x8E,0x09,0xFF,0x01,0x8E,0x09,0xF0,0x8E,0x09,0xDE,0xA1,0x8E,0x09,0xFF,0x00,0xDF,0x58,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xEF,0xBC,0xFF,0x96,0x2B,0xFF,0x94,0x8E,0x09,0xFF,0x01,0x8E,0x09,0xFC,0x8E,0x09,0xEB,0xA2,0x8E,0x09,0xFF,0x00,0xDF,0x58,0xFF,0x83,0xFF,0xFF,0xFF,0x00,0xCF,0x15,0xFF,0x95,0x8E,0x09,0xFF,0x00,0x8E,0x09,0xEA,0xA2,0x8E,0x09,0xFF,0x00,0xDF,0x58,0xFF,0x83,0xFF,0xFF,0xFF,0x00,0xCF,0x15,0xFF,0x95,0x8E,0x09,0xFF,0x00,0x8E,0x09,0xDE,0xA1,0x8E,0x09,0xFF,0x00,0xDF,0x58,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xEF,0xBC,0xFF,0x96,0x2B,0xFF,0x94,0x8E,0x09,0xFF,0x01,0x8E,0x09,0xFC,0x8E,0x09,0xD2,0xA0,
+    0x8E,0x09,0xFF,0x00,0xD7,0x57,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xF7,0xBD,0xFF,0x9E,0x4C,0xFF,0x95,0x8E,0x09,0xFF,0x01,0x8E,0x09,0xF0,0x8E,0x09,0xBB,0x9F,0x8E,0x09,0xFF,0x00,0xD7,0x57,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xF7,0xBD,0xFF,0x9E,0x4C,0xFF,0x96,0x8E,0x09,0xFF,0x01,0x8E,0x09,0xD9,0x8E,0x09,0x97,0x9E,0x8E,0x09,0xFF,0x00,0xD7,0x57,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xF7,0xBD,0xFF,0x9E,0x4C,0xFF,0x97,0x8E,0x09,0xFF,0x01,0x8E,0x09,0xB4,0x8E,0x09,0x72,0x9D,0x8E,0x09,0xFF,0x00,0xD7,0x57,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xF7,0xBD,0xFF,0x9E,0x4C,0xFF,0x98,0x8E,0x09,0xFF,0x01,0x8E,0x09,0x8F,0x8E,0x09,0x42,0x9C,0x8E,0x09,0xFF,0x00,0xD7,0x57,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xF7,0xBD,0xFF,0x9E,0x4C,0xFF,0x99,0x8E,0x09,0xFF,0x02,0x8E,0x09,0x61,0x86,0x69,0x0A,0x8E,0x09,0xF9,0x9A,0x8E,0x09,0xFF,0x00,0xD7,0x57,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xF7,0xBD,0xFF,0x9E,0x4C,0xFF,0x9A,0x8E,0x09,0xFF,0x02,0x86,0x09,0x22,0x00,0x00,0x00,0x8E,0x09,0xC5,0x99,0x8E,0x09,0xFF,0x00,0xD7,0x57,
+    0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xF7,0xBD,0xFF,0x9E,0x4C,0xFF,0x9A,0x8E,0x09,0xFF,0x00,0x8E,0x09,0xE3,0x81,0x00,0x00,0x00,0x00,0x8E,0x09,0x7B,0x98,0x8E,0x09,0xFF,0x00,0xD7,0x57,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xF7,0xBD,0xFF,0x9E,0x4C,0xFF,0x9B,0x8E,0x09,0xFF,0x00,0x8E,0x09,0x9A,0x81,0x00,0x00,0x00,0x01,0x86,0x09,0x22,0x8E,0x09,0xFE,0x96,0x8E,0x09,0xFF,0x00,0xD7,0x57,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xF7,0xBD,0xFF,0x9E,0x4C,0xFF,0x9C,0x8E,0x09,0xFF,0x00,0x8E,0x09,0x40,0x82,0x00,0x00,0x00,0x00,0x8E,0x09,0xC8,0x95,0x8E,0x09,0xFF,0x00,0xCF,0x36,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xEF,0xBC,0xFF,0x96,0x4B,0xFF,0x9C,0x8E,0x09,0xFF,0x01,0x8E,0x09,0xE5,0xAD,0x4A,0x03,0x82,0x00,0x00,0x00,0x00,0x8E,0x09,0x61,0x95,0x8E,0x09,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xEF,0xBC,0xFF,0x96,0x4B,0xFF,0x9D,0x8E,0x09,0xFF,0x00,0x8E,0x09,0x80,0x83,0x00,0x00,0x00,0x01,0x9E,0x66,0x05,0x8E,0x09,0xE2,0x94,0x8E,0x09,0xFF,0x00,0xE7,0x9A,0xFF,0x81,0xFF,0xFF,0xFF,0x01,0xEF,0xBC,0xFF,0x96,0x4B,0xFF,
+    0x9D,0x8E,0x09,0xFF,0x01,0x8E,0x09,0xF5,0x8D,0xE9,0x14,0x84,0x00,0x00,0x00,0x00,0x8E,0x09,0x74,0x94,0x8E,0x09,0xFF,0x00,0x96,0x2A,0xFF,0x81,0xCF,0x15,0xFF,0x00,0x96,0x2B,0xFF,0x9E,0x8E,0x09,0xFF,0x00,0x8E,0x09,0x92,0x85,0x00,0x00,0x00,0x01,0x8E,0x2A,0x09,0x8E,0x09,0xDE,0xB5,0x8E,0x09,0xFF,0x01,0x8E,0x09,0xF1,0x8E,0x08,0x19,0x86,0x00,0x00,0x00,0x00,0x8E,0x09,0x52,0xB5,0x8E,0x09,0xFF,0x00,0x8E,0x09,0x70,0x88,0x00,0x00,0x00,0x00,0x8E,0x09,0xB7,0xB3,0x8E,0x09,0xFF,0x01,0x8E,0x09,0xD1,0x9E,0x66,0x05,0x88,0x00,0x00,0x00,0x01,0x85,0xE9,0x17,0x8E,0x09,0xE7,0xB1,0x8E,0x09,0xFF,0x01,0x8E,0x09,0xF7,0x8E,0x09,0x2E,0x8A,0x00,0x00,0x00,0x01,0x8E,0x09,0x47,0x8E,0x09,0xFD,0xB0,0x8E,0x09,0xFF,0x00,0x8E,0x09,0x64,0x8C,0x00,0x00,0x00,0x00,0x8E,0x09,0x7C,0xAF,0x8E,0x09,0xFF,0x00,0x8E,0x09,0x9A,0x8E,0x00,0x00,0x00,0x00,0x8E,0x09,0x90,0xAD,0x8E,0x09,0xFF,0x01,0x8E,0x09,0xB3,0x85,0xE8,0x04,0x8E,0x00,0x00,0x00,0x01,0xAD,0x4A,0x03,0x8E,0x09,0xA8,0xAB,0x8E,0x09,0xFF,0x01,
+    0x8E,0x09,0xC1,0x8E,0x2A,0x09,0x90,0x00,0x00,0x00,0x01,0xAD,0x4A,0x03,0x8E,0x09,0x96,0xA9,0x8E,0x09,0xFF,0x01,0x8E,0x09,0xB1,0x8E,0x2A,0x09,0x93,0x00,0x00,0x00,0x01,0x8E,0x09,0x7E,0x8E,0x09,0xFE,0xA6,0x8E,0x09,0xFF,0x01,0x8E,0x09,0x98,0xAD,0x4A,0x03,0x95,0x00,0x00,0x00,0x01,0x8E,0x08,0x44,0x8E,0x09,0xE7,0xA3,0x8E,0x09,0xFF,0x01,0x8E,0x09,0xF6,0x8E,0x09,0x6F,0x98,0x00,0x00,0x00,0x01,0x8E,0x29,0x1B,0x8E,0x09,0xBC,0xA1,0x8E,0x09,0xFF,0x01,0x8E,0x09,0xCD,0x8D,0xE8,0x28,0x9B,0x00,0x00,0x00,0x01,0x8E,0x09,0x4D,0x8E,0x09,0xE0,0x9D,0x8E,0x09,0xFF,0x02,0x8E,0x09,0xEE,0x8E,0x09,0x6F,0xAD,0x4A,0x03,0x9D,0x00,0x00,0x00,0x02,0x8D,0xC8,0x0B,0x8E,0x09,0x7C,0x8E,0x09,0xE9,0x99,0x8E,0x09,0xFF,0x02,0x8E,0x09,0xF1,0x8E,0x09,0x8A,0x85,0xE8,0x13,0xA1,0x00,0x00,0x00,0x02,0x8E,0x2A,0x09,0x8E,0x09,0x6A,0x8E,0x09,0xD2,0x95,0x8E,0x09,0xFF,0x02,0x8E,0x09,0xDC,0x8E,0x09,0x78,0x8D,0xC8,0x0F,0xA6,0x00,0x00,0x00,0x03,0x8D,0xE9,0x2C,0x8E,0x09,0x85,0x8E,0x09,0xD0,0x8E,0x09,0xFD,
+    0x8E,0x8E,0x09,0xFF,0x02,0x8E,0x09,0xD6,0x8E,0x09,0x8F,0x8E,0x09,0x37,0xAC,0x00,0x00,0x00,0x0F,0x86,0x09,0x11,0x8E,0x09,0x4E,0x8E,0x09,0x7D,0x8E,0x09,0xA3,0x8E,0x09,0xC8,0x8E,0x09,0xDD,0x8E,0x09,0xEE,0x8E,0x09,0xF9,0x8E,0x09,0xFB,0x8E,0x09,0xEE,0x8E,0x09,0xDF,0x8E,0x09,0xCB,0x8E,0x09,0xA7,0x8E,0x09,0x82,0x8E,0x09,0x54,0x85,0xE9,0x17,0x97,0x00,0x00,0x00,
     };
 const lv_img_dsc_t ui_img_2138854088 = {
    .header.always_zero = 0,
    .header.w = 64,
    .header.h = 64,
    .data_size = sizeof(ui_img_2138854088_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+   .header.cf = LV_IMG_CF_USER_ENCODED_1,
    .data = ui_img_2138854088_data};
 
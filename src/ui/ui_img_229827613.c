@@ -10,77 +10,23 @@
 #endif
 
 // IMAGE DATA: assets\nt-2.png
+// Run length encoded LV_IMG_CF_TRUE_COLOR_ALPHA, decoded by src/img_cache.cpp
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_229827613_data[] = {
-0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xB2,0x10,0x94,0xB2,0x2D,0x94,0xB2,0x3F,0x94,0xB2,0x39,0x94,0xB2,0x1F,0x94,0xB2,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xB2,0x28,0x94,0xB2,0x8A,0x94,0xB2,0xD7,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xEE,0x94,0xB2,0xAB,0x94,0xB2,0x4F,0x94,0xB2,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xB2,0x1B,0x94,0xB2,0xA3,0x94,0xB2,0xFE,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xD5,0x94,0xB2,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xB2,0x49,0x94,0xB2,0xEC,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xD3,0xFF,0xA5,0x35,0xFF,0xAD,0x75,0xFF,0xAD,0x55,0xFF,0x9C,0xF4,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0x8F,0x94,0xB2,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xB2,0x5B,0x94,0xB2,0xFD,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0xAD,0x76,0xFF,0xD6,0x9A,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xDE,0xFB,0xFF,0xBD,0xF8,0xFF,0x9C,0xD3,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xAA,0x94,0xB2,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xB2,0x3F,0x94,0xB2,0xFD,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x9C,0xF4,0xFF,0xD6,0xBA,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x1C,0xFF,0xAD,0x96,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0x93,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xB2,0x11,0x94,0xB2,0xE5,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0xA5,0x35,0xFF,0xE7,0x1C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xBD,0xD7,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0x4C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xB2,0x8B,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x9C,0xF3,0xFF,0xDF,0x1C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xB5,0x96,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xE0,0x94,0xB2,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xB2,0x07,0x94,0xB2,0x4D,0x94,0xB2,0x8E,0x94,0xB2,0xB3,0x94,0xB2,0xC4,0x94,0xB2,0xF8,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0xCE,0x7A,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x1C,0xFF,0x9C,0xF3,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0x5D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xB2,0x04,0x94,0xB2,0x74,0x94,0xB2,0xE8,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0xA5,0x35,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xC6,0x18,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xBE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xB2,0x1F,0x94,0xB2,0xCC,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0xC6,0x38,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x1C,0xFF,0x94,0xB3,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFA,0x94,0xB2,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xB2,0x20,0x94,0xB2,0xE4,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x9D,0x14,0xFF,0xBD,0xF7,0xFF,0xCE,0x9A,0xFF,0xD6,0xBB,0xFF,0xD6,0x9A,0xFF,0xC6,0x18,0xFF,0xDE,0xFB,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xA5,0x35,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xB2,0x06,0x94,0xB2,0xCA,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB3,0xFF,0xC6,0x38,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xB5,0x96,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xB2,0x76,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB3,0xFF,0xD6,0x9A,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xB5,0xB7,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xB2,0x09,0x94,0xB2,0xEF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0xC6,0x38,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xAD,0x96,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xAA,0x94,0xB2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xB2,0x53,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0xA5,0x14,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xAD,0x55,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xD3,0x94,0xB2,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xB2,0x01,0x94,0xB2,0x62,0x94,0xB2,0xE0,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0xBE,0x18,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xDE,0xDB,0xFF,0xB5,0xB6,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xC2,0x94,0xB2,0x03,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xB2,0x0D,0x94,0xB2,0xB8,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0xD6,0x9A,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xCE,0x59,0xFF,0x94,0xB3,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0x63,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x94,0xB2,0x03,0x94,0xB2,0xBC,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xD3,0xFF,0xAD,0x55,0xFF,0xDE,0xFC,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xBD,0xF8,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xDB,0x94,0xB2,0x01,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x94,0xB2,0x6E,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0xBD,0xF7,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0x9C,0xD3,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0x30,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x94,0xB2,0x04,0x94,0xB2,0xE5,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0xBD,0xF8,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xB5,0xB6,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0x68,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x94,0xB2,0x38,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x9C,0xF4,0xFF,0xE7,0x3C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xBE,0x18,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0x80,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x94,0xB2,0x65,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0xB5,0xB6,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xBD,0xF8,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0x79,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x94,0xB2,0x6D,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0xBD,0xD7,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xAD,0x76,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0x5E,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x94,0xB2,0x56,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0xAD,0x76,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xDE,0xFC,0xFF,0x94,0xB3,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0x1D,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x94,0xB2,0x1B,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB3,0xFF,0xDE,0xFB,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xAD,0x96,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xC5,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x94,0xB2,0xBB,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0xA5,0x35,0xFF,0xE7,0x1C,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3D,0xFF,0xE7,0x3C,0xFF,0xB5,0xB7,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0x44,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x94,0xB2,0x32,0x94,0xB2,0xFA,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x9D,0x14,0xFF,0xCE,0x59,0xFF,0xDE,0xFC,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xE7,0x1C,0xFF,0xDE,0xFB,0xFF,0xC6,0x39,0xFF,0x9D,0x14,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xB2,0x63,0x94,0xB2,0xFE,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xA2,0x94,0xB2,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xB2,0x4F,0x94,0xB2,0xE9,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xF0,0x94,0xB2,0x68,0x94,0xB2,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xB2,0x0C,0x94,0xB2,0x6C,0x94,0xB2,0xB7,0x94,0xB2,0xD9,0x94,0xB2,0xE0,0x94,0xB2,0xE0,0x94,0xB2,0xE0,0x94,0xB2,0xE0,0x94,0xB2,0xE0,0x94,0xB2,0xE0,0x94,0xB2,0xE0,0x94,0xB2,0xE0,0x94,0xB2,0xE0,0x94,0xB2,0xE0,0x94,0xB2,0xE0,0x94,0xB2,0xE0,0x94,0xB2,0xE0,0x94,0xB2,0xE0,0x94,0xB2,0xE0,0x94,0xB2,0xE0,0x94,0xB2,0xE0,0x94,0xB2,0xE0,0x94,0xB2,0xE0,0x94,0xB2,0xE0,0x94,0xB2,0xE0,0x94,0xB2,0xE0,0x94,0xB2,0xE0,0x94,0xB2,0xE0,0x94,0xB2,0xE0,0x94,0xB2,0xE0,0x94,0xB2,0xE0,0x94,0xB2,0xE0,0x94,0xB2,0xE0,0x94,0xB2,0xDA,0x94,0xB2,0xAE,0x94,0xB2,0x60,0x94,0xB2,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x01,0xD6,0x9A,0x5A,0xD6,0x9A,0xC6,0xD6,0x9A,0x0A,0xD6,0x9A,0x15,0xD6,0x9A,0xCC,0xD6,0x9A,0x4E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x01,0xD6,0x9A,0x5A,0xD6,0x9A,0xC6,0xD6,0x9A,0x0A,0xD6,0x9A,0x15,0xD6,0x9A,0xCC,0xD6,0x9A,0x4E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x1E,0xD6,0x9A,0xF8,0xD6,0x9A,0xFF,0xD6,0x9A,0x80,0xD6,0x9A,0x97,0xD6,0x9A,0xFF,0xD6,0x9A,0xEF,0xD6,0x9A,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x1E,0xD6,0x9A,0xF8,0xD6,0x9A,0xFF,0xD6,0x9A,0x80,0xD6,0x9A,0x97,0xD6,0x9A,0xFF,0xD6,0x9A,0xEF,0xD6,0x9A,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x86,0xD6,0x9A,0xFF,0xD6,0x9A,0xF7,0xD6,0x9A,0xFD,0xD6,0x9A,0xFF,0xD6,0x9A,0x6F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x86,0xD6,0x9A,0xFF,0xD6,0x9A,0xF7,0xD6,0x9A,0xFD,0xD6,0x9A,0xFF,0xD6,0x9A,0x6F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x5A,0xD6,0x9A,0x90,0xD6,0x9A,0x9B,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFD,0xD6,0x9A,0x94,0xD6,0x9A,0x90,0xD6,0x9A,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x5A,0xD6,0x9A,0x90,0xD6,0x9A,0x9B,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFD,0xD6,0x9A,0x94,0xD6,0x9A,0x90,0xD6,0x9A,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0xA0,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0xA0,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x6E,0xD6,0x9A,0xB0,0xD6,0x9A,0xB7,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFE,0xD6,0x9A,0xAE,0xD6,0x9A,0xA0,0xD6,0x9A,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x6E,0xD6,0x9A,0xB0,0xD6,0x9A,0xB7,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFE,0xD6,0x9A,0xAE,0xD6,0x9A,0xA0,0xD6,0x9A,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x77,0xD6,0x9A,0xFF,0xD6,0x9A,0xFB,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0x65,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x77,0xD6,0x9A,0xFF,0xD6,0x9A,0xFB,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0x65,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x18,0xD6,0x9A,0xF3,0xD6,0x9A,0xFF,0xD6,0x9A,0x8E,0xD6,0x9A,0xA1,0xD6,0x9A,0xFF,0xD6,0x9A,0xEA,0xD6,0x9A,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x18,0xD6,0x9A,0xF3,0xD6,0x9A,0xFF,0xD6,0x9A,0x8E,0xD6,0x9A,0xA1,0xD6,0x9A,0xFF,0xD6,0x9A,0xEA,0xD6,0x9A,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x04,0xD6,0x9A,0x70,0xD6,0x9A,0xDA,0xD6,0x9A,0x10,0xD6,0x9A,0x1A,0xD6,0x9A,0xDC,0xD6,0x9A,0x63,0xD6,0x9A,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x04,0xD6,0x9A,0x70,0xD6,0x9A,0xDA,0xD6,0x9A,0x10,0xD6,0x9A,0x1A,0xD6,0x9A,0xDC,0xD6,0x9A,0x63,0xD6,0x9A,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
+    0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xA1,0x00,0x00,0x00,0x05,0x94,0xB2,0x10,0x94,0xB2,0x2D,0x94,0xB2,0x3F,0x94,0xB2,0x39,0x94,0xB2,0x1F,0x94,0xB2,0x01,0xB6,0x00,0x00,0x00,0x02,0x94,0xB2,0x28,0x94,0xB2,0x8A,0x94,0xB2,0xD7,0x84,0x94,0xB2,0xFF,0x03,0x94,0xB2,0xEE,0x94,0xB2,0xAB,0x94,0xB2,0x4F,0x94,0xB2,0x02,0xB1,0x00,0x00,0x00,0x02,0x94,0xB2,0x1B,0x94,0xB2,0xA3,0x94,0xB2,0xFE,0x89,0x94,0xB2,0xFF,0x01,0x94,0xB2,0xD5,0x94,0xB2,0x45,0xAF,0x00,0x00,0x00,0x01,0x94,0xB2,0x49,0x94,0xB2,0xEC,0x83,0x94,0xB2,0xFF,0x04,0x94,0xD3,0xFF,0xA5,0x35,0xFF,0xAD,0x75,0xFF,0xAD,0x55,0xFF,0x9C,0xF4,0xFF,0x84,0x94,0xB2,0xFF,0x01,0x94,0xB2,0x8F,0x94,0xB2,0x03,0xAC,0x00,0x00,0x00,0x01,0x94,0xB2,0x5B,0x94,0xB2,0xFD,0x82,0x94,0xB2,0xFF,0x02,0xAD,0x76,0xFF,0xD6,0x9A,0xFF,0xE7,0x3C,0xFF,0x83,0xE7,0x3D,0xFF,0x02,0xDE,0xFB,0xFF,0xBD,0xF8,0xFF,0x9C,0xD3,0xFF,
+    0x82,0x94,0xB2,0xFF,0x01,0x94,0xB2,0xAA,0x94,0xB2,0x03,0xAA,0x00,0x00,0x00,0x01,0x94,0xB2,0x3F,0x94,0xB2,0xFD,0x81,0x94,0xB2,0xFF,0x01,0x9C,0xF4,0xFF,0xD6,0xBA,0xFF,0x88,0xE7,0x3D,0xFF,0x01,0xE7,0x1C,0xFF,0xAD,0x96,0xFF,0x82,0x94,0xB2,0xFF,0x00,0x94,0xB2,0x93,0xA9,0x00,0x00,0x00,0x01,0x94,0xB2,0x11,0x94,0xB2,0xE5,0x81,0x94,0xB2,0xFF,0x01,0xA5,0x35,0xFF,0xE7,0x1C,0xFF,0x8B,0xE7,0x3D,0xFF,0x00,0xBD,0xD7,0xFF,0x82,0x94,0xB2,0xFF,0x00,0x94,0xB2,0x4C,0xA8,0x00,0x00,0x00,0x00,0x94,0xB2,0x8B,0x81,0x94,0xB2,0xFF,0x01,0x9C,0xF3,0xFF,0xDF,0x1C,0xFF,0x8D,0xE7,0x3D,0xFF,0x00,0xB5,0x96,0xFF,0x81,0x94,0xB2,0xFF,0x01,0x94,0xB2,0xE0,0x94,0xB2,0x06,0xA2,0x00,0x00,0x00,0x05,0x94,0xB2,0x07,0x94,0xB2,0x4D,0x94,0xB2,0x8E,0x94,0xB2,0xB3,0x94,0xB2,0xC4,0x94,0xB2,0xF8,0x81,0x94,0xB2,0xFF,0x00,0xCE,0x7A,0xFF,0x8E,0xE7,0x3D,0xFF,0x01,0xE7,0x1C,0xFF,0x9C,0xF3,0xFF,0x81,0x94,0xB2,0xFF,0x00,0x94,0xB2,0x5D,0xA0,0x00,0x00,0x00,0x02,0x94,0xB2,0x04,0x94,0xB2,0x74,0x94,0xB2,0xE8,
+    0x85,0x94,0xB2,0xFF,0x00,0xA5,0x35,0xFF,0x90,0xE7,0x3D,0xFF,0x00,0xC6,0x18,0xFF,0x81,0x94,0xB2,0xFF,0x00,0x94,0xB2,0xBE,0x9F,0x00,0x00,0x00,0x01,0x94,0xB2,0x1F,0x94,0xB2,0xCC,0x87,0x94,0xB2,0xFF,0x00,0xC6,0x38,0xFF,0x90,0xE7,0x3D,0xFF,0x04,0xE7,0x1C,0xFF,0x94,0xB3,0xFF,0x94,0xB2,0xFF,0x94,0xB2,0xFA,0x94,0xB2,0x0B,0x9D,0x00,0x00,0x00,0x01,0x94,0xB2,0x20,0x94,0xB2,0xE4,0x82,0x94,0xB2,0xFF,0x06,0x9D,0x14,0xFF,0xBD,0xF7,0xFF,0xCE,0x9A,0xFF,0xD6,0xBB,0xFF,0xD6,0x9A,0xFF,0xC6,0x18,0xFF,0xDE,0xFB,0xFF,0x91,0xE7,0x3D,0xFF,0x00,0xA5,0x35,0xFF,0x81,0x94,0xB2,0xFF,0x00,0x94,0xB2,0x36,0x9C,0x00,0x00,0x00,0x01,0x94,0xB2,0x06,0x94,0xB2,0xCA,0x81,0x94,0xB2,0xFF,0x02,0x94,0xB3,0xFF,0xC6,0x38,0xFF,0xE7,0x3C,0xFF,0x97,0xE7,0x3D,0xFF,0x00,0xB5,0x96,0xFF,0x81,0x94,0xB2,0xFF,0x00,0x94,0xB2,0x53,0x9C,0x00,0x00,0x00,0x00,0x94,0xB2,0x76,0x81,0x94,0xB2,0xFF,0x01,0x94,0xB3,0xFF,0xD6,0x9A,0xFF,0x99,0xE7,0x3D,0xFF,0x00,0xB5,0xB7,0xFF,0x81,0x94,0xB2,0xFF,0x00,0x94,0xB2,0x79,
+    0x9B,0x00,0x00,0x00,0x01,0x94,0xB2,0x09,0x94,0xB2,0xEF,0x81,0x94,0xB2,0xFF,0x00,0xC6,0x38,0xFF,0x9A,0xE7,0x3D,0xFF,0x00,0xAD,0x96,0xFF,0x82,0x94,0xB2,0xFF,0x01,0x94,0xB2,0xAA,0x94,0xB2,0x10,0x99,0x00,0x00,0x00,0x00,0x94,0xB2,0x53,0x81,0x94,0xB2,0xFF,0x01,0xA5,0x14,0xFF,0xE7,0x3C,0xFF,0x9A,0xE7,0x3D,0xFF,0x00,0xAD,0x55,0xFF,0x83,0x94,0xB2,0xFF,0x01,0x94,0xB2,0xD3,0x94,0xB2,0x15,0x96,0x00,0x00,0x00,0x02,0x94,0xB2,0x01,0x94,0xB2,0x62,0x94,0xB2,0xE0,0x81,0x94,0xB2,0xFF,0x00,0xBE,0x18,0xFF,0x9C,0xE7,0x3D,0xFF,0x01,0xDE,0xDB,0xFF,0xB5,0xB6,0xFF,0x82,0x94,0xB2,0xFF,0x01,0x94,0xB2,0xC2,0x94,0xB2,0x03,0x94,0x00,0x00,0x00,0x01,0x94,0xB2,0x0D,0x94,0xB2,0xB8,0x83,0x94,0xB2,0xFF,0x00,0xD6,0x9A,0xFF,0x9E,0xE7,0x3D,0xFF,0x01,0xCE,0x59,0xFF,0x94,0xB3,0xFF,0x81,0x94,0xB2,0xFF,0x00,0x94,0xB2,0x63,0x93,0x00,0x00,0x00,0x01,0x94,0xB2,0x03,0x94,0xB2,0xBC,0x82,0x94,0xB2,0xFF,0x02,0x94,0xD3,0xFF,0xAD,0x55,0xFF,0xDE,0xFC,0xFF,0x9F,0xE7,0x3D,0xFF,0x00,0xBD,0xF8,0xFF,0x81,
+    0x94,0xB2,0xFF,0x01,0x94,0xB2,0xDB,0x94,0xB2,0x01,0x92,0x00,0x00,0x00,0x00,0x94,0xB2,0x6E,0x82,0x94,0xB2,0xFF,0x01,0xBD,0xF7,0xFF,0xE7,0x3C,0xFF,0xA1,0xE7,0x3D,0xFF,0x01,0xE7,0x3C,0xFF,0x9C,0xD3,0xFF,0x81,0x94,0xB2,0xFF,0x00,0x94,0xB2,0x30,0x91,0x00,0x00,0x00,0x01,0x94,0xB2,0x04,0x94,0xB2,0xE5,0x81,0x94,0xB2,0xFF,0x00,0xBD,0xF8,0xFF,0xA4,0xE7,0x3D,0xFF,0x00,0xB5,0xB6,0xFF,0x81,0x94,0xB2,0xFF,0x00,0x94,0xB2,0x68,0x91,0x00,0x00,0x00,0x00,0x94,0xB2,0x38,0x81,0x94,0xB2,0xFF,0x01,0x9C,0xF4,0xFF,0xE7,0x3C,0xFF,0xA4,0xE7,0x3D,0xFF,0x00,0xBE,0x18,0xFF,0x81,0x94,0xB2,0xFF,0x00,0x94,0xB2,0x80,0x91,0x00,0x00,0x00,0x00,0x94,0xB2,0x65,0x81,0x94,0xB2,0xFF,0x00,0xB5,0xB6,0xFF,0xA5,0xE7,0x3D,0xFF,0x00,0xBD,0xF8,0xFF,0x81,0x94,0xB2,0xFF,0x00,0x94,0xB2,0x79,0x91,0x00,0x00,0x00,0x00,0x94,0xB2,0x6D,0x81,0x94,0xB2,0xFF,0x00,0xBD,0xD7,0xFF,0xA5,0xE7,0x3D,0xFF,0x00,0xAD,0x76,0xFF,0x81,0x94,0xB2,0xFF,0x00,0x94,0xB2,0x5E,0x91,0x00,0x00,0x00,0x00,0x94,0xB2,0x56,0x81,0x94,
+    0xB2,0xFF,0x00,0xAD,0x76,0xFF,0xA4,0xE7,0x3D,0xFF,0x01,0xDE,0xFC,0xFF,0x94,0xB3,0xFF,0x81,0x94,0xB2,0xFF,0x00,0x94,0xB2,0x1D,0x91,0x00,0x00,0x00,0x00,0x94,0xB2,0x1B,0x81,0x94,0xB2,0xFF,0x01,0x94,0xB3,0xFF,0xDE,0xFB,0xFF,0xA3,0xE7,0x3D,0xFF,0x00,0xAD,0x96,0xFF,0x81,0x94,0xB2,0xFF,0x00,0x94,0xB2,0xC5,0x93,0x00,0x00,0x00,0x00,0x94,0xB2,0xBB,0x81,0x94,0xB2,0xFF,0x01,0xA5,0x35,0xFF,0xE7,0x1C,0xFF,0xA0,0xE7,0x3D,0xFF,0x01,0xE7,0x3C,0xFF,0xB5,0xB7,0xFF,0x82,0x94,0xB2,0xFF,0x00,0x94,0xB2,0x44,0x93,0x00,0x00,0x00,0x01,0x94,0xB2,0x32,0x94,0xB2,0xFA,0x81,0x94,0xB2,0xFF,0x02,0x9D,0x14,0xFF,0xCE,0x59,0xFF,0xDE,0xFC,0xFF,0x9C,0xE7,0x1C,0xFF,0x02,0xDE,0xFB,0xFF,0xC6,0x39,0xFF,0x9D,0x14,0xFF,0x82,0x94,0xB2,0xFF,0x00,0x94,0xB2,0x92,0x95,0x00,0x00,0x00,0x01,0x94,0xB2,0x63,0x94,0xB2,0xFE,0xA5,0x94,0xB2,0xFF,0x01,0x94,0xB2,0xA2,0x94,0xB2,0x03,0x96,0x00,0x00,0x00,0x01,0x94,0xB2,0x4F,0x94,0xB2,0xE9,0xA2,0x94,0xB2,0xFF,0x02,0x94,0xB2,0xF0,0x94,0xB2,0x68,0x94,0xB2,0x01,
+    0x98,0x00,0x00,0x00,0x03,0x94,0xB2,0x0C,0x94,0xB2,0x6C,0x94,0xB2,0xB7,0x94,0xB2,0xD9,0x9C,0x94,0xB2,0xE0,0x03,0x94,0xB2,0xDA,0x94,0xB2,0xAE,0x94,0xB2,0x60,0x94,0xB2,0x0E,0xFF,0x00,0x00,0x00,0xE2,0x00,0x00,0x00,0x06,0xD6,0x9A,0x01,0xD6,0x9A,0x5A,0xD6,0x9A,0xC6,0xD6,0x9A,0x0A,0xD6,0x9A,0x15,0xD6,0x9A,0xCC,0xD6,0x9A,0x4E,0x84,0x00,0x00,0x00,0x06,0xD6,0x9A,0x01,0xD6,0x9A,0x5A,0xD6,0x9A,0xC6,0xD6,0x9A,0x0A,0xD6,0x9A,0x15,0xD6,0x9A,0xCC,0xD6,0x9A,0x4E,0xAC,0x00,0x00,0x00,0x07,0xD6,0x9A,0x1E,0xD6,0x9A,0xF8,0xD6,0x9A,0xFF,0xD6,0x9A,0x80,0xD6,0x9A,0x97,0xD6,0x9A,0xFF,0xD6,0x9A,0xEF,0xD6,0x9A,0x0F,0x83,0x00,0x00,0x00,0x07,0xD6,0x9A,0x1E,0xD6,0x9A,0xF8,0xD6,0x9A,0xFF,0xD6,0x9A,0x80,0xD6,0x9A,0x97,0xD6,0x9A,0xFF,0xD6,0x9A,0xEF,0xD6,0x9A,0x0F,0xAC,0x00,0x00,0x00,0x05,0xD6,0x9A,0x86,0xD6,0x9A,0xFF,0xD6,0x9A,0xF7,0xD6,0x9A,0xFD,0xD6,0x9A,0xFF,0xD6,0x9A,0x6F,0x85,0x00,0x00,0x00,0x05,0xD6,0x9A,0x86,0xD6,0x9A,0xFF,0xD6,0x9A,0xF7,0xD6,0x9A,0xFD,0xD6,0x9A,0xFF,0xD6,
+    0x9A,0x6F,0xAB,0x00,0x00,0x00,0x02,0xD6,0x9A,0x5A,0xD6,0x9A,0x90,0xD6,0x9A,0x9B,0x82,0xD6,0x9A,0xFF,0x03,0xD6,0x9A,0xFD,0xD6,0x9A,0x94,0xD6,0x9A,0x90,0xD6,0x9A,0x51,0x81,0x00,0x00,0x00,0x02,0xD6,0x9A,0x5A,0xD6,0x9A,0x90,0xD6,0x9A,0x9B,0x82,0xD6,0x9A,0xFF,0x03,0xD6,0x9A,0xFD,0xD6,0x9A,0x94,0xD6,0x9A,0x90,0xD6,0x9A,0x51,0xA9,0x00,0x00,0x00,0x00,0xD6,0x9A,0xA0,0x87,0xD6,0x9A,0xFF,0x00,0xD6,0x9A,0x90,0x81,0x00,0x00,0x00,0x00,0xD6,0x9A,0xA0,0x87,0xD6,0x9A,0xFF,0x00,0xD6,0x9A,0x90,0xA9,0x00,0x00,0x00,0x02,0xD6,0x9A,0x6E,0xD6,0x9A,0xB0,0xD6,0x9A,0xB7,0x82,0xD6,0x9A,0xFF,0x03,0xD6,0x9A,0xFE,0xD6,0x9A,0xAE,0xD6,0x9A,0xA0,0xD6,0x9A,0x5A,0x81,0x00,0x00,0x00,0x02,0xD6,0x9A,0x6E,0xD6,0x9A,0xB0,0xD6,0x9A,0xB7,0x82,0xD6,0x9A,0xFF,0x03,0xD6,0x9A,0xFE,0xD6,0x9A,0xAE,0xD6,0x9A,0xA0,0xD6,0x9A,0x5A,0xAB,0x00,0x00,0x00,0x02,0xD6,0x9A,0x77,0xD6,0x9A,0xFF,0xD6,0x9A,0xFB,0x81,0xD6,0x9A,0xFF,0x00,0xD6,0x9A,0x65,0x85,0x00,0x00,0x00,0x02,0xD6,0x9A,0x77,0xD6,0x9A,0xFF,0xD6,
+    0x9A,0xFB,0x81,0xD6,0x9A,0xFF,0x00,0xD6,0x9A,0x65,0xAC,0x00,0x00,0x00,0x07,0xD6,0x9A,0x18,0xD6,0x9A,0xF3,0xD6,0x9A,0xFF,0xD6,0x9A,0x8E,0xD6,0x9A,0xA1,0xD6,0x9A,0xFF,0xD6,0x9A,0xEA,0xD6,0x9A,0x0E,0x83,0x00,0x00,0x00,0x07,0xD6,0x9A,0x18,0xD6,0x9A,0xF3,0xD6,0x9A,0xFF,0xD6,0x9A,0x8E,0xD6,0x9A,0xA1,0xD6,0x9A,0xFF,0xD6,0x9A,0xEA,0xD6,0x9A,0x0E,0xAB,0x00,0x00,0x00,0x07,0xD6,0x9A,0x04,0xD6,0x9A,0x70,0xD6,0x9A,0xDA,0xD6,0x9A,0x10,0xD6,0x9A,0x1A,0xD6,0x9A,0xDC,0xD6,0x9A,0x63,0xD6,0x9A,0x02,0x83,0x00,0x00,0x00,0x07,0xD6,0x9A,0x04,0xD6,0x9A,0x70,0xD6,0x9A,0xDA,0xD6,0x9A,0x10,0xD6,0x9A,0x1A,0xD6,0x9A,0xDC,0xD6,0x9A,0x63,0xD6,0x9A,0x02,0xAD,0x00,0x00,0x00,0x00,0xD6,0x9A,0x02,0x81,0x00,0x00,0x00,0x00,0xD6,0x9A,0x02,0x87,0x00,0x00,0x00,0x00,0xD6,0x9A,0x02,0x81,0x00,0x00,0x00,0x00,0xD6,0x9A,0x02,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x98,0x00,0x00,0x00,
     };
 const lv_img_dsc_t ui_img_229827613 = {
    .header.always_zero = 0,
    .header.w = 64,
    .header.h = 64,
    .data_size = sizeof(ui_img_229827613_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+   .header.cf = LV_IMG_CF_USER_ENCODED_1,
    .data = ui_img_229827613_data};
 
@@ -10,77 +10,21 @@
 #endif
 
 // IMAGE DATA: assets\nt-6.png
+// Run length encoded LV_IMG_CF_TRUE_COLOR_ALPHA, decoded by src/img_cache.cpp
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_229831961_data[] = {
-0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x10,0xD6,0x9A,0x2D,0xD6,0x9A,0x3F,0xD6,0x9A,0x39,0xD6,0x9A,0x1F,0xD6,0x9A,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x28,0xD6,0x9A,0x8A,0xD6,0x9A,0xD7,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xEE,0xD6,0x9A,0xAB,0xD6,0x9A,0x4F,0xD6,0x9A,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x1B,0xD6,0x9A,0xA3,0xD6,0x9A,0xFE,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xD5,0xD6,0x9A,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x49,0xD6,0x9A,0xEC,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xF7,0xD6,0xBA,0xDA,0xD6,0xBB,0xCC,0xD6,0xBA,0xD1,0xD6,0xBA,0xEA,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0x8F,0xD6,0x9A,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x5B,0xD6,0x9A,0xFD,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFE,0xD6,0xDB,0xC5,0xE7,0x3D,0x7A,0xFF,0xFF,0x50,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xF7,0x9E,0x63,0xDE,0xFB,0xA4,0xD6,0x9A,0xF2,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xAA,0xD6,0x9A,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x3F,0xD6,0x9A,0xFD,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xE7,0xEF,0x5D,0x75,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xF7,0xBE,0x5A,0xD6,0xDB,0xC2,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0x93,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x11,0xD6,0x9A,0xE5,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xD9,0xF7,0xBE,0x59,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xDE,0xFB,0xAB,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0x4C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x8B,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xEE,0xF7,0xBE,0x5C,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xDE,0xDB,0xBD,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xE0,0xD6,0x9A,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x07,0xD6,0x9A,0x4D,0xD6,0x9A,0x8E,0xD6,0x9A,0xB3,0xD6,0x9A,0xC4,0xD6,0x9A,0xF8,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xE7,0x3C,0x83,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xDF,0x56,0xD6,0xBA,0xED,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0x5D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x04,0xD6,0x9A,0x74,0xD6,0x9A,0xE8,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xD9,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xDE,0xFC,0x9A,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xBE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x1F,0xD6,0x9A,0xCC,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xDE,0xFC,0x96,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xF7,0xBE,0x59,0xD6,0x9A,0xFD,0xD6,0x9A,0xFF,0xD6,0x9A,0xFA,0xD6,0x9A,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x20,0xD6,0x9A,0xE4,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xE6,0xDE,0xFB,0xA7,0xE7,0x3C,0x7F,0xEF,0x5D,0x70,0xE7,0x3D,0x7A,0xDE,0xFB,0x9E,0xF7,0x9E,0x61,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xD6,0xBA,0xDA,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x06,0xD6,0x9A,0xCA,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFC,0xDE,0xFC,0x99,0xFF,0xFF,0x50,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xD6,0xDB,0xBF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x76,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFB,0xE7,0x3D,0x7A,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xDE,0xDB,0xB6,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x09,0xD6,0x9A,0xEF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xDE,0xFC,0x96,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xD6,0xDB,0xC1,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xAA,0xD6,0x9A,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x53,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xE2,0xFF,0xFF,0x4E,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xD6,0xBA,0xCD,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xD3,0xD6,0x9A,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x01,0xD6,0x9A,0x62,0xD6,0x9A,0xE0,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xDE,0xFB,0xA1,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xEF,0x7D,0x66,0xDE,0xDB,0xB8,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xC2,0xD6,0x9A,0x03,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x0D,0xD6,0x9A,0xB8,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xEF,0x5D,0x78,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xE7,0x1C,0x89,0xD6,0x9A,0xFD,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0x63,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xD6,0x9A,0x03,0xD6,0x9A,0xBC,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xF5,0xD6,0xBA,0xCE,0xF7,0x9E,0x5F,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xDE,0xFB,0xA4,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xDB,0xD6,0x9A,0x01,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xD6,0x9A,0x6E,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xDE,0xFB,0xAA,0xFF,0xDF,0x53,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xDF,0x53,0xD6,0x9A,0xF0,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0x30,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xD6,0x9A,0x04,0xD6,0x9A,0xE5,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xDE,0xFB,0xA4,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xDE,0xDB,0xB8,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0x68,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xD6,0x9A,0x38,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xEB,0xFF,0xFF,0x50,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xDE,0xFB,0x9F,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0x80,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xD6,0x9A,0x65,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xDE,0xDB,0xB8,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xDE,0xFB,0xA2,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0x79,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xD6,0x9A,0x6D,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xDE,0xFB,0xAB,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xD6,0xDB,0xC6,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0x5E,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xD6,0x9A,0x56,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0xBB,0xC7,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xF7,0xBE,0x5E,0xD6,0x9A,0xF8,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0x1D,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xD6,0x9A,0x1B,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFA,0xF7,0x9E,0x63,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xD6,0xDB,0xC2,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xC5,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xD6,0x9A,0xBB,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xD7,0xFF,0xDF,0x56,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x4D,0xFF,0xFF,0x50,0xDE,0xDB,0xB4,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0x44,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0xD6,0x9A,0x32,0xD6,0x9A,0xFA,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0xBA,0xE5,0xE7,0x1C,0x8D,0xF7,0x9E,0x5F,0xF7,0xBE,0x58,0xF7,0xBE,0x58,0xF7,0xBE,0x58,0xF7,0xBE,0x58,0xF7,0xBE,0x58,0xF7,0xBE,0x58,0xF7,0xBE,0x58,0xF7,0xBE,0x58,0xF7,0xBE,0x58,0xF7,0xBE,0x58,0xF7,0xBE,0x58,0xF7,0xBE,0x58,0xF7,0xBE,0x58,0xF7,0xBE,0x58,0xF7,0xBE,0x58,0xF7,0xBE,0x58,0xF7,0xBE,0x58,0xF7,0xBE,0x58,0xF7,0xBE,0x58,0xF7,0xBE,0x58,0xF7,0xBE,0x58,0xF7,0xBE,0x58,0xF7,0xBE,0x58,0xF7,0xBE,0x58,0xF7,0xBE,0x58,0xF7,0xBE,0x58,0xF7,0xBE,0x58,0xF7,0xBE,0x58,0xF7,0xBE,0x58,0xEF,0x7E,0x65,0xE7,0x1C,0x94,0xD6,0xBA,0xE4,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x63,0xD6,0x9A,0xFE,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xA2,0xD6,0x9A,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x4F,0xD6,0x9A,0xE9,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xF0,0xD6,0x9A,0x68,0xD6,0x9A,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0x0C,0xD6,0x9A,0x6C,0xD6,0x9A,0xB7,0xD6,0x9A,0xD9,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xDA,0xD6,0x9A,0xAE,0xD6,0x9A,0x60,0xD6,0x9A,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0xD6,0x9A,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0xD6,0x9A,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
+    0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xA1,0x00,0x00,0x00,0x05,0xD6,0x9A,0x10,0xD6,0x9A,0x2D,0xD6,0x9A,0x3F,0xD6,0x9A,0x39,0xD6,0x9A,0x1F,0xD6,0x9A,0x01,0xB6,0x00,0x00,0x00,0x02,0xD6,0x9A,0x28,0xD6,0x9A,0x8A,0xD6,0x9A,0xD7,0x84,0xD6,0x9A,0xFF,0x03,0xD6,0x9A,0xEE,0xD6,0x9A,0xAB,0xD6,0x9A,0x4F,0xD6,0x9A,0x02,0xB1,0x00,0x00,0x00,0x02,0xD6,0x9A,0x1B,0xD6,0x9A,0xA3,0xD6,0x9A,0xFE,0x89,0xD6,0x9A,0xFF,0x01,0xD6,0x9A,0xD5,0xD6,0x9A,0x45,0xAF,0x00,0x00,0x00,0x01,0xD6,0x9A,0x49,0xD6,0x9A,0xEC,0x83,0xD6,0x9A,0xFF,0x04,0xD6,0x9A,0xF7,0xD6,0xBA,0xDA,0xD6,0xBB,0xCC,0xD6,0xBA,0xD1,0xD6,0xBA,0xEA,0x84,0xD6,0x9A,0xFF,0x01,0xD6,0x9A,0x8F,0xD6,0x9A,0x03,0xAC,0x00,0x00,0x00,0x01,0xD6,0x9A,0x5B,0xD6,0x9A,0xFD,0x81,0xD6,0x9A,0xFF,0x03,0xD6,0x9A,0xFE,0xD6,0xDB,0xC5,0xE7,0x3D,0x7A,0xFF,0xFF,0x50,0x83,0xFF,0xFF,0x4D,0x02,0xF7,0x9E,0x63,0xDE,0xFB,0xA4,
+    0xD6,0x9A,0xF2,0x82,0xD6,0x9A,0xFF,0x01,0xD6,0x9A,0xAA,0xD6,0x9A,0x03,0xAA,0x00,0x00,0x00,0x01,0xD6,0x9A,0x3F,0xD6,0x9A,0xFD,0x81,0xD6,0x9A,0xFF,0x01,0xD6,0xBA,0xE7,0xEF,0x5D,0x75,0x88,0xFF,0xFF,0x4D,0x01,0xF7,0xBE,0x5A,0xD6,0xDB,0xC2,0x82,0xD6,0x9A,0xFF,0x00,0xD6,0x9A,0x93,0xA9,0x00,0x00,0x00,0x01,0xD6,0x9A,0x11,0xD6,0x9A,0xE5,0x81,0xD6,0x9A,0xFF,0x01,0xD6,0xBA,0xD9,0xF7,0xBE,0x59,0x8B,0xFF,0xFF,0x4D,0x00,0xDE,0xFB,0xAB,0x82,0xD6,0x9A,0xFF,0x00,0xD6,0x9A,0x4C,0xA8,0x00,0x00,0x00,0x00,0xD6,0x9A,0x8B,0x81,0xD6,0x9A,0xFF,0x01,0xD6,0x9A,0xEE,0xF7,0xBE,0x5C,0x8D,0xFF,0xFF,0x4D,0x00,0xDE,0xDB,0xBD,0x81,0xD6,0x9A,0xFF,0x01,0xD6,0x9A,0xE0,0xD6,0x9A,0x06,0xA2,0x00,0x00,0x00,0x05,0xD6,0x9A,0x07,0xD6,0x9A,0x4D,0xD6,0x9A,0x8E,0xD6,0x9A,0xB3,0xD6,0x9A,0xC4,0xD6,0x9A,0xF8,0x81,0xD6,0x9A,0xFF,0x00,0xE7,0x3C,0x83,0x8E,0xFF,0xFF,0x4D,0x01,0xFF,0xDF,0x56,0xD6,0xBA,0xED,0x81,0xD6,0x9A,0xFF,0x00,0xD6,0x9A,0x5D,0xA0,0x00,0x00,0x00,0x02,0xD6,0x9A,0x04,0xD6,0x9A,0x74,
+    0xD6,0x9A,0xE8,0x85,0xD6,0x9A,0xFF,0x00,0xD6,0xBA,0xD9,0x90,0xFF,0xFF,0x4D,0x00,0xDE,0xFC,0x9A,0x81,0xD6,0x9A,0xFF,0x00,0xD6,0x9A,0xBE,0x9F,0x00,0x00,0x00,0x01,0xD6,0x9A,0x1F,0xD6,0x9A,0xCC,0x87,0xD6,0x9A,0xFF,0x00,0xDE,0xFC,0x96,0x90,0xFF,0xFF,0x4D,0x04,0xF7,0xBE,0x59,0xD6,0x9A,0xFD,0xD6,0x9A,0xFF,0xD6,0x9A,0xFA,0xD6,0x9A,0x0B,0x9D,0x00,0x00,0x00,0x01,0xD6,0x9A,0x20,0xD6,0x9A,0xE4,0x82,0xD6,0x9A,0xFF,0x06,0xD6,0xBA,0xE6,0xDE,0xFB,0xA7,0xE7,0x3C,0x7F,0xEF,0x5D,0x70,0xE7,0x3D,0x7A,0xDE,0xFB,0x9E,0xF7,0x9E,0x61,0x91,0xFF,0xFF,0x4D,0x00,0xD6,0xBA,0xDA,0x81,0xD6,0x9A,0xFF,0x00,0xD6,0x9A,0x36,0x9C,0x00,0x00,0x00,0x01,0xD6,0x9A,0x06,0xD6,0x9A,0xCA,0x81,0xD6,0x9A,0xFF,0x02,0xD6,0x9A,0xFC,0xDE,0xFC,0x99,0xFF,0xFF,0x50,0x97,0xFF,0xFF,0x4D,0x00,0xD6,0xDB,0xBF,0x81,0xD6,0x9A,0xFF,0x00,0xD6,0x9A,0x53,0x9C,0x00,0x00,0x00,0x00,0xD6,0x9A,0x76,0x81,0xD6,0x9A,0xFF,0x01,0xD6,0x9A,0xFB,0xE7,0x3D,0x7A,0x99,0xFF,0xFF,0x4D,0x00,0xDE,0xDB,0xB6,0x81,0xD6,0x9A,0xFF,0x00,
+    0xD6,0x9A,0x79,0x9B,0x00,0x00,0x00,0x01,0xD6,0x9A,0x09,0xD6,0x9A,0xEF,0x81,0xD6,0x9A,0xFF,0x00,0xDE,0xFC,0x96,0x9A,0xFF,0xFF,0x4D,0x00,0xD6,0xDB,0xC1,0x82,0xD6,0x9A,0xFF,0x01,0xD6,0x9A,0xAA,0xD6,0x9A,0x10,0x99,0x00,0x00,0x00,0x00,0xD6,0x9A,0x53,0x81,0xD6,0x9A,0xFF,0x01,0xD6,0xBA,0xE2,0xFF,0xFF,0x4E,0x9A,0xFF,0xFF,0x4D,0x00,0xD6,0xBA,0xCD,0x83,0xD6,0x9A,0xFF,0x01,0xD6,0x9A,0xD3,0xD6,0x9A,0x15,0x96,0x00,0x00,0x00,0x02,0xD6,0x9A,0x01,0xD6,0x9A,0x62,0xD6,0x9A,0xE0,0x81,0xD6,0x9A,0xFF,0x00,0xDE,0xFB,0xA1,0x9C,0xFF,0xFF,0x4D,0x01,0xEF,0x7D,0x66,0xDE,0xDB,0xB8,0x82,0xD6,0x9A,0xFF,0x01,0xD6,0x9A,0xC2,0xD6,0x9A,0x03,0x94,0x00,0x00,0x00,0x01,0xD6,0x9A,0x0D,0xD6,0x9A,0xB8,0x83,0xD6,0x9A,0xFF,0x00,0xEF,0x5D,0x78,0x9E,0xFF,0xFF,0x4D,0x01,0xE7,0x1C,0x89,0xD6,0x9A,0xFD,0x81,0xD6,0x9A,0xFF,0x00,0xD6,0x9A,0x63,0x93,0x00,0x00,0x00,0x01,0xD6,0x9A,0x03,0xD6,0x9A,0xBC,0x82,0xD6,0x9A,0xFF,0x02,0xD6,0x9A,0xF5,0xD6,0xBA,0xCE,0xF7,0x9E,0x5F,0x9F,0xFF,0xFF,0x4D,0x00,0xDE,
+    0xFB,0xA4,0x81,0xD6,0x9A,0xFF,0x01,0xD6,0x9A,0xDB,0xD6,0x9A,0x01,0x92,0x00,0x00,0x00,0x00,0xD6,0x9A,0x6E,0x82,0xD6,0x9A,0xFF,0x01,0xDE,0xFB,0xAA,0xFF,0xDF,0x53,0xA1,0xFF,0xFF,0x4D,0x01,0xFF,0xDF,0x53,0xD6,0x9A,0xF0,0x81,0xD6,0x9A,0xFF,0x00,0xD6,0x9A,0x30,0x91,0x00,0x00,0x00,0x01,0xD6,0x9A,0x04,0xD6,0x9A,0xE5,0x81,0xD6,0x9A,0xFF,0x00,0xDE,0xFB,0xA4,0xA4,0xFF,0xFF,0x4D,0x00,0xDE,0xDB,0xB8,0x81,0xD6,0x9A,0xFF,0x00,0xD6,0x9A,0x68,0x91,0x00,0x00,0x00,0x00,0xD6,0x9A,0x38,0x81,0xD6,0x9A,0xFF,0x01,0xD6,0xBA,0xEB,0xFF,0xFF,0x50,0xA4,0xFF,0xFF,0x4D,0x00,0xDE,0xFB,0x9F,0x81,0xD6,0x9A,0xFF,0x00,0xD6,0x9A,0x80,0x91,0x00,0x00,0x00,0x00,0xD6,0x9A,0x65,0x81,0xD6,0x9A,0xFF,0x00,0xDE,0xDB,0xB8,0xA5,0xFF,0xFF,0x4D,0x00,0xDE,0xFB,0xA2,0x81,0xD6,0x9A,0xFF,0x00,0xD6,0x9A,0x79,0x91,0x00,0x00,0x00,0x00,0xD6,0x9A,0x6D,0x81,0xD6,0x9A,0xFF,0x00,0xDE,0xFB,0xAB,0xA5,0xFF,0xFF,0x4D,0x00,0xD6,0xDB,0xC6,0x81,0xD6,0x9A,0xFF,0x00,0xD6,0x9A,0x5E,0x91,0x00,0x00,0x00,0x00,0xD6,0x9A,
+    0x56,0x81,0xD6,0x9A,0xFF,0x00,0xD6,0xBB,0xC7,0xA4,0xFF,0xFF,0x4D,0x01,0xF7,0xBE,0x5E,0xD6,0x9A,0xF8,0x81,0xD6,0x9A,0xFF,0x00,0xD6,0x9A,0x1D,0x91,0x00,0x00,0x00,0x00,0xD6,0x9A,0x1B,0x81,0xD6,0x9A,0xFF,0x01,0xD6,0x9A,0xFA,0xF7,0x9E,0x63,0xA3,0xFF,0xFF,0x4D,0x00,0xD6,0xDB,0xC2,0x81,0xD6,0x9A,0xFF,0x00,0xD6,0x9A,0xC5,0x93,0x00,0x00,0x00,0x00,0xD6,0x9A,0xBB,0x81,0xD6,0x9A,0xFF,0x01,0xD6,0xBA,0xD7,0xFF,0xDF,0x56,0xA0,0xFF,0xFF,0x4D,0x01,0xFF,0xFF,0x50,0xDE,0xDB,0xB4,0x82,0xD6,0x9A,0xFF,0x00,0xD6,0x9A,0x44,0x93,0x00,0x00,0x00,0x01,0xD6,0x9A,0x32,0xD6,0x9A,0xFA,0x81,0xD6,0x9A,0xFF,0x02,0xD6,0xBA,0xE5,0xE7,0x1C,0x8D,0xF7,0x9E,0x5F,0x9C,0xF7,0xBE,0x58,0x02,0xEF,0x7E,0x65,0xE7,0x1C,0x94,0xD6,0xBA,0xE4,0x82,0xD6,0x9A,0xFF,0x00,0xD6,0x9A,0x92,0x95,0x00,0x00,0x00,0x01,0xD6,0x9A,0x63,0xD6,0x9A,0xFE,0xA5,0xD6,0x9A,0xFF,0x01,0xD6,0x9A,0xA2,0xD6,0x9A,0x03,0x96,0x00,0x00,0x00,0x01,0xD6,0x9A,0x4F,0xD6,0x9A,0xE9,0xA2,0xD6,0x9A,0xFF,0x02,0xD6,0x9A,0xF0,0xD6,0x9A,0x68,
+    0xD6,0x9A,0x01,0x98,0x00,0x00,0x00,0x03,0xD6,0x9A,0x0C,0xD6,0x9A,0x6C,0xD6,0x9A,0xB7,0xD6,0x9A,0xD9,0x9C,0xD6,0x9A,0xE0,0x03,0xD6,0x9A,0xDA,0xD6,0x9A,0xAE,0xD6,0x9A,0x60,0xD6,0x9A,0x0E,0xFF,0x00,0x00,0x00,0x9C,0x00,0x00,0x00,0xA1,0xD6,0x9A,0xE0,0x9D,0x00,0x00,0x00,0xA1,0xD6,0x9A,0xFF,0x9D,0x00,0x00,0x00,0xA1,0xD6,0x9A,0xFF,0xFF,0x00,0x00,0x00,0x9D,0x00,0x00,0x00,0xA1,0xD6,0x9A,0xFF,0x9D,0x00,0x00,0x00,0xA1,0xD6,0x9A,0xFF,0x9D,0x00,0x00,0x00,0xA1,0xD6,0x9A,0xF0,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xCE,0x00,0x00,0x00,
     };
 const lv_img_dsc_t ui_img_229831961 = {
    .header.always_zero = 0,
    .header.w = 64,
    .header.h = 64,
    .data_size = sizeof(ui_img_229831961_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+   .header.cf = LV_IMG_CF_USER_ENCODED_1,
    .data = ui_img_229831961_data};
 
@@ -10,77 +10,23 @@
 #endif
 
 // IMAGE DATA: assets\nt-5.png
+// Run length encoded LV_IMG_CF_TRUE_COLOR_ALPHA, decoded by src/img_cache.cpp
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_229839384_data[] = {
-0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x10,0x31,0x86,0x2D,0x31,0x86,0x3F,0x31,0x86,0x39,0x31,0x86,0x1F,0x31,0x86,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x28,0x31,0x86,0x8A,0x31,0x86,0xD7,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xEE,0x31,0x86,0xAB,0x31,0x86,0x4F,0x31,0x86,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x1B,0x31,0x86,0xA3,0x31,0x86,0xFE,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xD5,0x31,0x86,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x49,0x31,0x86,0xEC,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0xA6,0xFF,0x42,0x08,0xFF,0x4A,0x49,0xFF,0x42,0x29,0xFF,0x39,0xE7,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0x8F,0x31,0x86,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x5B,0x31,0x86,0xFD,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x4A,0x69,0xFF,0x6B,0x6E,0xFF,0x7C,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x73,0xCF,0xFF,0x5A,0xCB,0xFF,0x39,0xC7,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xAA,0x31,0x86,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x3F,0x31,0x86,0xFD,0x31,0x86,0xFF,0x31,0x86,0xFF,0x39,0xE7,0xFF,0x6B,0x8E,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x7B,0xEF,0xFF,0x4A,0x69,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0x93,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x11,0x31,0x86,0xE5,0x31,0x86,0xFF,0x31,0x86,0xFF,0x42,0x28,0xFF,0x7B,0xF0,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x5A,0xCB,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0x4C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x8B,0x31,0x86,0xFF,0x31,0x86,0xFF,0x39,0xC7,0xFF,0x7B,0xCF,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x52,0x8A,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xE0,0x31,0x86,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x07,0x31,0x86,0x4D,0x31,0x86,0x8E,0x31,0x86,0xB3,0x31,0x86,0xC4,0x31,0x86,0xF8,0x31,0x86,0xFF,0x31,0x86,0xFF,0x6B,0x4D,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x7B,0xF0,0xFF,0x39,0xC7,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0x5D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x04,0x31,0x86,0x74,0x31,0x86,0xE8,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x42,0x28,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x5B,0x0C,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xBE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x1F,0x31,0x86,0xCC,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x63,0x0C,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x7B,0xF0,0xFF,0x31,0xA6,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFA,0x31,0x86,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x20,0x31,0x86,0xE4,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x39,0xE7,0xFF,0x5A,0xCB,0xFF,0x6B,0x6D,0xFF,0x73,0x8E,0xFF,0x6B,0x6E,0xFF,0x5A,0xEC,0xFF,0x73,0xCF,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x42,0x08,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x06,0x31,0x86,0xCA,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0xA6,0xFF,0x5B,0x0C,0xFF,0x7C,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x4A,0x6A,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0x53,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x76,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0xA6,0xFF,0x6B,0x6E,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x52,0xAA,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x09,0x31,0x86,0xEF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x63,0x0C,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x4A,0x6A,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xAA,0x31,0x86,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x53,0x31,0x86,0xFF,0x31,0x86,0xFF,0x42,0x08,0xFF,0x7C,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x4A,0x49,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xD3,0x31,0x86,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x01,0x31,0x86,0x62,0x31,0x86,0xE0,0x31,0x86,0xFF,0x31,0x86,0xFF,0x5A,0xEB,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x73,0xAF,0xFF,0x52,0x8A,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xC2,0x31,0x86,0x03,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x0D,0x31,0x86,0xB8,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x6B,0x6E,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x63,0x2D,0xFF,0x31,0xA6,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0x63,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x31,0x86,0x03,0x31,0x86,0xBC,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0xA7,0xFF,0x4A,0x49,0xFF,0x7B,0xCF,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x5A,0xEB,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xDB,0x31,0x86,0x01,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x31,0x86,0x6E,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x5A,0xCB,0xFF,0x7B,0xF0,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x7B,0xF0,0xFF,0x39,0xC7,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0x30,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x31,0x86,0x04,0x31,0x86,0xE5,0x31,0x86,0xFF,0x31,0x86,0xFF,0x5A,0xCB,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x52,0x8A,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0x68,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x31,0x86,0x38,0x31,0x86,0xFF,0x31,0x86,0xFF,0x39,0xE7,0xFF,0x7C,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x2F,0xFF,0x94,0x4E,0xFF,0x94,0x4E,0xFF,0x8C,0x2F,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x5A,0xEB,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0x80,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x31,0x86,0x65,0x31,0x86,0xFF,0x31,0x86,0xFF,0x52,0x8A,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0xDD,0x24,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xB4,0xAA,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x5A,0xEB,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0x79,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x31,0x86,0x6D,0x31,0x86,0xFF,0x31,0x86,0xFF,0x5A,0xCB,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x9C,0x6D,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xED,0x42,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x4A,0x69,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0x5E,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x31,0x86,0x56,0x31,0x86,0xFF,0x31,0x86,0xFF,0x4A,0x69,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0xDD,0x24,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xB4,0xAA,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x7B,0xCF,0xFF,0x31,0xA6,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0x1D,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x31,0x86,0x1B,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0xA6,0xFF,0x73,0xCF,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x9C,0x6D,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xED,0x42,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x4A,0x69,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xC5,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x31,0x86,0xBB,0x31,0x86,0xFF,0x31,0x86,0xFF,0x42,0x28,0xFF,0x7B,0xF0,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0xDD,0x24,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xB4,0xAA,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x84,0x10,0xFF,0x7C,0x10,0xFF,0x52,0xAA,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0x44,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x31,0x86,0x32,0x31,0x86,0xFA,0x31,0x86,0xFF,0x31,0x86,0xFF,0x39,0xE7,0xFF,0x63,0x2D,0xFF,0x7B,0xCF,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x9C,0x4C,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xED,0x42,0xFF,0x7B,0xEF,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x7B,0xF0,0xFF,0x73,0xAF,0xFF,0x63,0x0C,0xFF,0x39,0xE8,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0x92,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x63,0x31,0x86,0xFE,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0xC4,0x61,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0x72,0xC4,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xA2,0x31,0x86,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x4F,0x31,0x86,0xE9,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x62,0x65,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xDC,0xC1,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFF,0x31,0x86,0xF0,0x31,0x86,0x68,0x31,0x86,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x86,0x0C,0x31,0x86,0x6C,0x31,0x86,0xB7,0x31,0x86,0xD9,0x31,0x86,0xE0,0x31,0x86,0xE0,0x31,0x86,0xE0,0x31,0x86,0xE0,0x31,0x86,0xE0,0x31,0x86,0xE0,0x31,0x86,0xE0,0x31,0x86,0xE0,0x31,0x86,0xE0,0x31,0x86,0xE0,0x31,0x86,0xE0,0x31,0x86,0xE0,0xC4,0x42,0xF4,0xF5,0x40,0xFD,0xF5,0x40,0xFD,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0x7A,0xE4,0xEA,0x31,0x86,0xE0,0x31,0x86,0xE0,0x31,0x86,0xE0,0x31,0x86,0xE0,0x31,0x86,0xE0,0x31,0x86,0xE0,0x31,0x86,0xE0,0x31,0x86,0xE0,0x31,0x86,0xE0,0x31,0x86,0xE0,0x31,0x86,0xDA,0x31,0x86,0xAE,0x31,0x86,0x60,0x31,0x86,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x80,0x48,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0xCF,0xFD,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x80,0xC8,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x80,0x48,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0xCF,0xFD,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x80,0xC8,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x80,0x48,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0xCF,0xFD,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x80,0xC8,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x80,0x10,0xFD,0x80,0x10,0xFD,0x80,0x57,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0xCF,0xFD,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x80,0xC8,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x80,0x48,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0xCF,0xFD,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x80,0xC8,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x80,0x48,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0xCF,0xFD,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x80,0xC8,0xFD,0x80,0xFF,0xFD,0x80,0xFF,0xFD,0x80,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
+    0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xA1,0x00,0x00,0x00,0x05,0x31,0x86,0x10,0x31,0x86,0x2D,0x31,0x86,0x3F,0x31,0x86,0x39,0x31,0x86,0x1F,0x31,0x86,0x01,0xB6,0x00,0x00,0x00,0x02,0x31,0x86,0x28,0x31,0x86,0x8A,0x31,0x86,0xD7,0x84,0x31,0x86,0xFF,0x03,0x31,0x86,0xEE,0x31,0x86,0xAB,0x31,0x86,0x4F,0x31,0x86,0x02,0xB1,0x00,0x00,0x00,0x02,0x31,0x86,0x1B,0x31,0x86,0xA3,0x31,0x86,0xFE,0x89,0x31,0x86,0xFF,0x01,0x31,0x86,0xD5,0x31,0x86,0x45,0xAF,0x00,0x00,0x00,0x01,0x31,0x86,0x49,0x31,0x86,0xEC,0x83,0x31,0x86,0xFF,0x04,0x31,0xA6,0xFF,0x42,0x08,0xFF,0x4A,0x49,0xFF,0x42,0x29,0xFF,0x39,0xE7,0xFF,0x84,0x31,0x86,0xFF,0x01,0x31,0x86,0x8F,0x31,0x86,0x03,0xAC,0x00,0x00,0x00,0x01,0x31,0x86,0x5B,0x31,0x86,0xFD,0x82,0x31,0x86,0xFF,0x02,0x4A,0x69,0xFF,0x6B,0x6E,0xFF,0x7C,0x10,0xFF,0x83,0x84,0x10,0xFF,0x02,0x73,0xCF,0xFF,0x5A,0xCB,0xFF,0x39,0xC7,0xFF,
+    0x82,0x31,0x86,0xFF,0x01,0x31,0x86,0xAA,0x31,0x86,0x03,0xAA,0x00,0x00,0x00,0x01,0x31,0x86,0x3F,0x31,0x86,0xFD,0x81,0x31,0x86,0xFF,0x01,0x39,0xE7,0xFF,0x6B,0x8E,0xFF,0x88,0x84,0x10,0xFF,0x01,0x7B,0xEF,0xFF,0x4A,0x69,0xFF,0x82,0x31,0x86,0xFF,0x00,0x31,0x86,0x93,0xA9,0x00,0x00,0x00,0x01,0x31,0x86,0x11,0x31,0x86,0xE5,0x81,0x31,0x86,0xFF,0x01,0x42,0x28,0xFF,0x7B,0xF0,0xFF,0x8B,0x84,0x10,0xFF,0x00,0x5A,0xCB,0xFF,0x82,0x31,0x86,0xFF,0x00,0x31,0x86,0x4C,0xA8,0x00,0x00,0x00,0x00,0x31,0x86,0x8B,0x81,0x31,0x86,0xFF,0x01,0x39,0xC7,0xFF,0x7B,0xCF,0xFF,0x8D,0x84,0x10,0xFF,0x00,0x52,0x8A,0xFF,0x81,0x31,0x86,0xFF,0x01,0x31,0x86,0xE0,0x31,0x86,0x06,0xA2,0x00,0x00,0x00,0x05,0x31,0x86,0x07,0x31,0x86,0x4D,0x31,0x86,0x8E,0x31,0x86,0xB3,0x31,0x86,0xC4,0x31,0x86,0xF8,0x81,0x31,0x86,0xFF,0x00,0x6B,0x4D,0xFF,0x8E,0x84,0x10,0xFF,0x01,0x7B,0xF0,0xFF,0x39,0xC7,0xFF,0x81,0x31,0x86,0xFF,0x00,0x31,0x86,0x5D,0xA0,0x00,0x00,0x00,0x02,0x31,0x86,0x04,0x31,0x86,0x74,0x31,0x86,0xE8,
+    0x85,0x31,0x86,0xFF,0x00,0x42,0x28,0xFF,0x90,0x84,0x10,0xFF,0x00,0x5B,0x0C,0xFF,0x81,0x31,0x86,0xFF,0x00,0x31,0x86,0xBE,0x9F,0x00,0x00,0x00,0x01,0x31,0x86,0x1F,0x31,0x86,0xCC,0x87,0x31,0x86,0xFF,0x00,0x63,0x0C,0xFF,0x90,0x84,0x10,0xFF,0x04,0x7B,0xF0,0xFF,0x31,0xA6,0xFF,0x31,0x86,0xFF,0x31,0x86,0xFA,0x31,0x86,0x0B,0x9D,0x00,0x00,0x00,0x01,0x31,0x86,0x20,0x31,0x86,0xE4,0x82,0x31,0x86,0xFF,0x06,0x39,0xE7,0xFF,0x5A,0xCB,0xFF,0x6B,0x6D,0xFF,0x73,0x8E,0xFF,0x6B,0x6E,0xFF,0x5A,0xEC,0xFF,0x73,0xCF,0xFF,0x91,0x84,0x10,0xFF,0x00,0x42,0x08,0xFF,0x81,0x31,0x86,0xFF,0x00,0x31,0x86,0x36,0x9C,0x00,0x00,0x00,0x01,0x31,0x86,0x06,0x31,0x86,0xCA,0x81,0x31,0x86,0xFF,0x02,0x31,0xA6,0xFF,0x5B,0x0C,0xFF,0x7C,0x10,0xFF,0x97,0x84,0x10,0xFF,0x00,0x4A,0x6A,0xFF,0x81,0x31,0x86,0xFF,0x00,0x31,0x86,0x53,0x9C,0x00,0x00,0x00,0x00,0x31,0x86,0x76,0x81,0x31,0x86,0xFF,0x01,0x31,0xA6,0xFF,0x6B,0x6E,0xFF,0x99,0x84,0x10,0xFF,0x00,0x52,0xAA,0xFF,0x81,0x31,0x86,0xFF,0x00,0x31,0x86,0x79,
+    0x9B,0x00,0x00,0x00,0x01,0x31,0x86,0x09,0x31,0x86,0xEF,0x81,0x31,0x86,0xFF,0x00,0x63,0x0C,0xFF,0x9A,0x84,0x10,0xFF,0x00,0x4A,0x6A,0xFF,0x82,0x31,0x86,0xFF,0x01,0x31,0x86,0xAA,0x31,0x86,0x10,0x99,0x00,0x00,0x00,0x00,0x31,0x86,0x53,0x81,0x31,0x86,0xFF,0x01,0x42,0x08,0xFF,0x7C,0x10,0xFF,0x9A,0x84,0x10,0xFF,0x00,0x4A,0x49,0xFF,0x83,0x31,0x86,0xFF,0x01,0x31,0x86,0xD3,0x31,0x86,0x15,0x96,0x00,0x00,0x00,0x02,0x31,0x86,0x01,0x31,0x86,0x62,0x31,0x86,0xE0,0x81,0x31,0x86,0xFF,0x00,0x5A,0xEB,0xFF,0x9C,0x84,0x10,0xFF,0x01,0x73,0xAF,0xFF,0x52,0x8A,0xFF,0x82,0x31,0x86,0xFF,0x01,0x31,0x86,0xC2,0x31,0x86,0x03,0x94,0x00,0x00,0x00,0x01,0x31,0x86,0x0D,0x31,0x86,0xB8,0x83,0x31,0x86,0xFF,0x00,0x6B,0x6E,0xFF,0x9E,0x84,0x10,0xFF,0x01,0x63,0x2D,0xFF,0x31,0xA6,0xFF,0x81,0x31,0x86,0xFF,0x00,0x31,0x86,0x63,0x93,0x00,0x00,0x00,0x01,0x31,0x86,0x03,0x31,0x86,0xBC,0x82,0x31,0x86,0xFF,0x02,0x31,0xA7,0xFF,0x4A,0x49,0xFF,0x7B,0xCF,0xFF,0x9F,0x84,0x10,0xFF,0x00,0x5A,0xEB,0xFF,0x81,
+    0x31,0x86,0xFF,0x01,0x31,0x86,0xDB,0x31,0x86,0x01,0x92,0x00,0x00,0x00,0x00,0x31,0x86,0x6E,0x82,0x31,0x86,0xFF,0x01,0x5A,0xCB,0xFF,0x7B,0xF0,0xFF,0xA1,0x84,0x10,0xFF,0x01,0x7B,0xF0,0xFF,0x39,0xC7,0xFF,0x81,0x31,0x86,0xFF,0x00,0x31,0x86,0x30,0x91,0x00,0x00,0x00,0x01,0x31,0x86,0x04,0x31,0x86,0xE5,0x81,0x31,0x86,0xFF,0x00,0x5A,0xCB,0xFF,0xA4,0x84,0x10,0xFF,0x00,0x52,0x8A,0xFF,0x81,0x31,0x86,0xFF,0x00,0x31,0x86,0x68,0x91,0x00,0x00,0x00,0x00,0x31,0x86,0x38,0x81,0x31,0x86,0xFF,0x01,0x39,0xE7,0xFF,0x7C,0x10,0xFF,0x92,0x84,0x10,0xFF,0x00,0x84,0x2F,0xFF,0x81,0x94,0x4E,0xFF,0x00,0x8C,0x2F,0xFF,0x8D,0x84,0x10,0xFF,0x00,0x5A,0xEB,0xFF,0x81,0x31,0x86,0xFF,0x00,0x31,0x86,0x80,0x91,0x00,0x00,0x00,0x00,0x31,0x86,0x65,0x81,0x31,0x86,0xFF,0x00,0x52,0x8A,0xFF,0x93,0x84,0x10,0xFF,0x00,0xDD,0x24,0xFF,0x81,0xFD,0x80,0xFF,0x00,0xB4,0xAA,0xFF,0x8D,0x84,0x10,0xFF,0x00,0x5A,0xEB,0xFF,0x81,0x31,0x86,0xFF,0x00,0x31,0x86,0x79,0x91,0x00,0x00,0x00,0x00,0x31,0x86,0x6D,0x81,0x31,
+    0x86,0xFF,0x00,0x5A,0xCB,0xFF,0x92,0x84,0x10,0xFF,0x00,0x9C,0x6D,0xFF,0x81,0xFD,0x80,0xFF,0x00,0xED,0x42,0xFF,0x8E,0x84,0x10,0xFF,0x00,0x4A,0x69,0xFF,0x81,0x31,0x86,0xFF,0x00,0x31,0x86,0x5E,0x91,0x00,0x00,0x00,0x00,0x31,0x86,0x56,0x81,0x31,0x86,0xFF,0x00,0x4A,0x69,0xFF,0x92,0x84,0x10,0xFF,0x00,0xDD,0x24,0xFF,0x81,0xFD,0x80,0xFF,0x00,0xB4,0xAA,0xFF,0x8D,0x84,0x10,0xFF,0x01,0x7B,0xCF,0xFF,0x31,0xA6,0xFF,0x81,0x31,0x86,0xFF,0x00,0x31,0x86,0x1D,0x91,0x00,0x00,0x00,0x00,0x31,0x86,0x1B,0x81,0x31,0x86,0xFF,0x01,0x31,0xA6,0xFF,0x73,0xCF,0xFF,0x90,0x84,0x10,0xFF,0x00,0x9C,0x6D,0xFF,0x81,0xFD,0x80,0xFF,0x00,0xED,0x42,0xFF,0x8E,0x84,0x10,0xFF,0x00,0x4A,0x69,0xFF,0x81,0x31,0x86,0xFF,0x00,0x31,0x86,0xC5,0x93,0x00,0x00,0x00,0x00,0x31,0x86,0xBB,0x81,0x31,0x86,0xFF,0x01,0x42,0x28,0xFF,0x7B,0xF0,0xFF,0x8F,0x84,0x10,0xFF,0x00,0xDD,0x24,0xFF,0x81,0xFD,0x80,0xFF,0x00,0xB4,0xAA,0xFF,0x8C,0x84,0x10,0xFF,0x01,0x7C,0x10,0xFF,0x52,0xAA,0xFF,0x82,0x31,0x86,0xFF,0x00,0x31,
+    0x86,0x44,0x93,0x00,0x00,0x00,0x01,0x31,0x86,0x32,0x31,0x86,0xFA,0x81,0x31,0x86,0xFF,0x02,0x39,0xE7,0xFF,0x63,0x2D,0xFF,0x7B,0xCF,0xFF,0x8C,0x7B,0xF0,0xFF,0x00,0x9C,0x4C,0xFF,0x81,0xFD,0x80,0xFF,0x01,0xED,0x42,0xFF,0x7B,0xEF,0xFF,0x8A,0x7B,0xF0,0xFF,0x02,0x73,0xAF,0xFF,0x63,0x0C,0xFF,0x39,0xE8,0xFF,0x82,0x31,0x86,0xFF,0x00,0x31,0x86,0x92,0x95,0x00,0x00,0x00,0x01,0x31,0x86,0x63,0x31,0x86,0xFE,0x90,0x31,0x86,0xFF,0x00,0xC4,0x61,0xFF,0x84,0xFD,0x80,0xFF,0x00,0x72,0xC4,0xFF,0x8D,0x31,0x86,0xFF,0x01,0x31,0x86,0xA2,0x31,0x86,0x03,0x96,0x00,0x00,0x00,0x01,0x31,0x86,0x4F,0x31,0x86,0xE9,0x8E,0x31,0x86,0xFF,0x00,0x62,0x65,0xFF,0x84,0xFD,0x80,0xFF,0x00,0xDC,0xC1,0xFF,0x8C,0x31,0x86,0xFF,0x02,0x31,0x86,0xF0,0x31,0x86,0x68,0x31,0x86,0x01,0x98,0x00,0x00,0x00,0x03,0x31,0x86,0x0C,0x31,0x86,0x6C,0x31,0x86,0xB7,0x31,0x86,0xD9,0x8B,0x31,0x86,0xE0,0x00,0xC4,0x42,0xF4,0x81,0xF5,0x40,0xFD,0x82,0xFD,0x80,0xFF,0x00,0x7A,0xE4,0xEA,0x89,0x31,0x86,0xE0,0x03,0x31,0x86,0xDA,
+    0x31,0x86,0xAE,0x31,0x86,0x60,0x31,0x86,0x0E,0xAC,0x00,0x00,0x00,0x00,0xFD,0x80,0x48,0x81,0xFD,0x80,0xFF,0x01,0xFD,0x80,0xCF,0xFD,0x80,0x01,0xBA,0x00,0x00,0x00,0x00,0xFD,0x80,0xC8,0x81,0xFD,0x80,0xFF,0x00,0xFD,0x80,0x50,0xBA,0x00,0x00,0x00,0x00,0xFD,0x80,0x48,0x81,0xFD,0x80,0xFF,0x01,0xFD,0x80,0xCF,0xFD,0x80,0x01,0xBA,0x00,0x00,0x00,0x00,0xFD,0x80,0xC8,0x84,0xFD,0x80,0xFF,0x00,0xFD,0x80,0x50,0xB7,0x00,0x00,0x00,0x00,0xFD,0x80,0x48,0x84,0xFD,0x80,0xFF,0x01,0xFD,0x80,0xCF,0xFD,0x80,0x01,0xB7,0x00,0x00,0x00,0x00,0xFD,0x80,0xC8,0x84,0xFD,0x80,0xFF,0x00,0xFD,0x80,0x50,0xB8,0x00,0x00,0x00,0x81,0xFD,0x80,0x10,0x00,0xFD,0x80,0x57,0x81,0xFD,0x80,0xFF,0x01,0xFD,0x80,0xCF,0xFD,0x80,0x01,0xBA,0x00,0x00,0x00,0x00,0xFD,0x80,0xC8,0x81,0xFD,0x80,0xFF,0x00,0xFD,0x80,0x50,0xBA,0x00,0x00,0x00,0x00,0xFD,0x80,0x48,0x81,0xFD,0x80,0xFF,0x01,0xFD,0x80,0xCF,0xFD,0x80,0x01,0xBA,0x00,0x00,0x00,0x00,0xFD,0x80,0xC8,0x81,0xFD,0x80,0xFF,0x00,0xFD,0x80,0x50,0xBA,0x00,0x00,0x00,
+    0x00,0xFD,0x80,0x48,0x81,0xFD,0x80,0xFF,0x01,0xFD,0x80,0xCF,0xFD,0x80,0x01,0xBA,0x00,0x00,0x00,0x00,0xFD,0x80,0xC8,0x81,0xFD,0x80,0xFF,0x00,0xFD,0x80,0x50,0xFF,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0xDE,0x00,0x00,0x00,
     };
 const lv_img_dsc_t ui_img_229839384 = {
    .header.always_zero = 0,
    .header.w = 64,
    .header.h = 64,
    .data_size = sizeof(ui_img_229839384_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+   .header.cf = LV_IMG_CF_USER_ENCODED_1,
    .data = ui_img_229839384_data};
 
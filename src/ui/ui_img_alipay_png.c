@@ -11,28 +11,13 @@
 
 // IMAGE DATA: assets\alipay.png
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_alipay_png_data[] = {
-0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,
-    0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,
-    0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,
-    0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,
-    0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,
-    0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,
-    0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,
-    0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,
-    0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x3D,0x05,0x3D,0x43,0x89,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,
-    0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,
-    0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x05,0x3D,0x05,0x3D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,
-    0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x43,0x89,
-    0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,
-    0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,
-    0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,0x05,0x3D,
+    0xEF,0xA6,0x00,0xFF,0x4A,0x71,0x42,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x00,0x00,0x01,0x80,0x00,0x00,0x01,0x80,0x00,0x00,0x01,0x80,0x00,0x00,0x01,0x80,0x00,0x00,0x01,0x80,0x00,0x00,0x01,0x80,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x0C,0x00,0x03,0xF8,0x08,0x00,0x0E,0x03,0x98,0x00,0x1C,0x00,0x78,0x00,0x18,0x00,0x3E,0x00,0x18,0x00,0x27,0xC0,0x18,0x00,0x41,0xF8,0x18,0x00,0x80,0x7F,0x0C,0x01,0x00,0x1F,0x06,0x04,0x00,0x07,0x01,0xE0,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
     };
 const lv_img_dsc_t ui_img_alipay_png = {
    .header.always_zero = 0,
    .header.w = 32,
    .header.h = 32,
    .data_size = sizeof(ui_img_alipay_png_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR,
+   .header.cf = LV_IMG_CF_INDEXED_1BIT,
    .data = ui_img_alipay_png_data};
 
@@ -10,77 +10,25 @@
 #endif
 
 // IMAGE DATA: assets\answer.png
+// Run length encoded LV_IMG_CF_TRUE_COLOR_ALPHA, decoded by src/img_cache.cpp
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_answer_png_data[] = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x61,0x16,0x25,0x41,0x54,0x25,0x41,0x7F,0x25,0x41,0xA7,0x25,0x41,0xCD,0x25,0x41,0xDE,0x25,0x61,0xEE,0x25,0x61,0xFA,0x25,0x61,0xFA,0x25,0x61,0xEE,0x25,0x41,0xDE,0x25,0x41,0xCD,0x25,0x41,0xA6,0x25,0x41,0x7E,0x2D,0x61,0x53,0x25,0x61,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x61,0x35,0x25,0x41,0x8E,0x25,0x41,0xD3,0x25,0x41,0xFE,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFE,0x25,0x41,0xD3,0x25,0x61,0x8D,0x25,0x61,0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x22,0x0E,0x25,0x61,0x74,0x25,0x61,0xD6,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xD5,0x25,0x61,0x74,0x25,0x82,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2D,0x41,0x12,0x25,0x61,0x81,0x25,0x61,0xEE,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x61,0xEE,0x25,0x41,0x80,0x2D,0x21,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xE0,0x01,0x25,0x41,0x5E,0x25,0x41,0xEA,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xED,0x25,0x41,0x6F,0x03,0xE0,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2D,0x41,0x24,0x25,0x41,0xC5,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xC4,0x25,0x41,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x41,0x51,0x25,0x41,0xEF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xF2,0x25,0x41,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xE0,0x02,0x25,0x41,0x8F,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x61,0x8D,0x03,0xE0,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2D,0x40,0x06,0x25,0x41,0xA6,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x61,0xA5,0x34,0xC0,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2D,0x40,0x06,0x25,0x41,0xB5,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x61,0xB4,0x34,0xC0,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xE0,0x01,0x25,0x41,0xA1,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xA6,0x03,0xE0,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x41,0x8F,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0x8B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x41,0x55,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x2D,0x61,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x41,0x23,0x25,0x41,0xF0,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xF0,0x25,0x61,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xE0,0x01,0x25,0x41,0xC5,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x66,0x0A,0xFF,0xE7,0x9C,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xF7,0xBE,0xFF,0xA6,0xD3,0xFF,0x2D,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xC2,0x07,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x41,0x64,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0xE7,0x9C,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0x66,0x09,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x2D,0x61,0x5F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2D,0x41,0x12,0x25,0x61,0xEB,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0xF7,0xDE,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0x7E,0x4D,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xE9,0x1D,0x61,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x41,0x82,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0xEF,0xBD,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0x8E,0x8F,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x22,0x0E,0x25,0x61,0xEE,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0xE7,0x9B,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0x96,0xB1,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xED,0x25,0x82,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x61,0x74,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0xD7,0x59,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xB7,0x15,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0x72,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x41,0xD3,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0xB7,0x15,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xDF,0x7A,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xD5,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x25,0x61,0x35,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x96,0x90,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0x3D,0x84,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x61,0x31,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x25,0x41,0x8E,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x76,0x2C,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0x76,0x4C,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0x8B,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x25,0x41,0xD4,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x45,0xA5,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xB7,0x15,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xCF,0x00,0x00,0x00,
-    0x25,0x61,0x16,0x25,0x41,0xFE,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0xE7,0x9B,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xF7,0xDE,0xFF,0x3D,0x84,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFE,0x25,0x21,0x14,
-    0x25,0x41,0x54,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0xAE,0xF4,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0x96,0x90,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x2D,0x41,0x52,
-    0x25,0x41,0x80,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x6E,0x2B,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xCF,0x58,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x61,0x7D,
-    0x25,0x41,0xA7,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x2D,0x62,0xFF,0xEF,0xBD,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xA6,0xD2,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xA4,
-    0x25,0x41,0xCC,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0xA6,0xD3,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xF7,0xBE,0xFF,0x9E,0xB1,0xFF,0x2D,0x62,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xCA,
-    0x25,0x41,0xE0,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x4D,0xC7,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xF7,0xBD,0xFF,0x96,0x90,0xFF,0x3D,0x84,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xDE,
-    0x25,0x41,0xED,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0xBF,0x16,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xF7,0xBE,0xFF,0x4D,0xC6,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x61,0xEB,
-    0x25,0x41,0xF9,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x55,0xE8,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xCF,0x58,0xFF,0x2D,0x62,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xF8,
-    0x25,0x41,0xF9,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0xBF,0x16,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0x86,0x6E,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xF8,
-    0x25,0x41,0xED,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x3D,0xA5,0xFF,0xF7,0xBE,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xF7,0xDE,0xFF,0x5E,0x09,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x61,0xEB,
-    0x25,0x41,0xE0,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x8E,0x90,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xEF,0xBD,0xFF,0x4D,0xC6,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xDE,
-    0x25,0x41,0xCC,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x2D,0x62,0xFF,0xCF,0x58,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xE7,0x9B,0xFF,0x3D,0x84,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xCA,
-    0x25,0x41,0xA6,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x45,0xA5,0xFF,0xEF,0xBD,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xE7,0x9B,0xFF,0x4D,0xC6,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x2D,0x62,0xFF,0xA6,0xD2,0xFF,0xCF,0x58,0xFF,0x96,0x90,0xFF,0x3D,0x84,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xA3,
-    0x25,0x41,0x7F,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x6E,0x0A,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xEF,0xBD,0xFF,0x5D,0xE8,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x9E,0xB1,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xF7,0xDE,0xFF,0xB7,0x15,0xFF,0x76,0x4C,0xFF,0x3D,0x84,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0x7C,
-    0x2D,0x61,0x53,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x86,0x6E,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xF7,0xDE,0xFF,0x86,0x6E,0xFF,0x2D,0x61,0xFF,0x25,0x41,0xFF,0x3D,0x84,0xFF,0xF7,0xBE,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xDF,0x7B,0xFF,0xB7,0x15,0xFF,0x9E,0xB1,0xFF,0x8E,0x8F,0xFF,0x7E,0x4D,0xFF,0x66,0x09,0xFF,0x2D,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0x51,
-    0x25,0x61,0x16,0x25,0x41,0xFE,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x96,0x90,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xCF,0x58,0xFF,0x45,0xA6,0xFF,0x96,0x90,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xA6,0xD3,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x61,0xFD,0x25,0x21,0x14,
-    0x00,0x00,0x00,0x25,0x41,0xD3,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x96,0x90,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xF7,0xBE,0xFF,0xF7,0xBD,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xF7,0xBE,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xCE,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x25,0x41,0x8E,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x86,0x6E,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x61,0x8A,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x25,0x61,0x34,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x66,0x0A,0xFF,0xEF,0xBD,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0x30,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x41,0xD3,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x3D,0xA5,0xFF,0xCF,0x58,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xD5,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x61,0x74,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x2D,0x62,0xFF,0x8E,0x90,0xFF,0xF7,0xBE,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0x72,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x82,0x0D,0x25,0x61,0xEE,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x45,0xA5,0xFF,0xBF,0x16,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xED,0x25,0x82,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x61,0x81,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x55,0xC7,0xFF,0xB7,0x15,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x61,0x7D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2D,0x21,0x11,0x25,0x41,0xEA,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x4D,0xC7,0xFF,0xA6,0xD2,0xFF,0xEF,0xBD,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x61,0xE8,0x25,0x42,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x61,0x62,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x2D,0x62,0xFF,0x6E,0x0A,0xFF,0xAE,0xF4,0xFF,0xE7,0x9B,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xE7,0x9B,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0x5D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xE0,0x01,0x25,0x41,0xC4,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x45,0xA5,0xFF,0x76,0x2C,0xFF,0x96,0x90,0xFF,0xB7,0x15,0xFF,0xD7,0x59,0xFF,0xDF,0x9B,0xFF,0xEF,0xBD,0xFF,0xF7,0xDE,0xFF,0xE7,0x9B,0xFF,0x66,0x0A,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xC1,0x07,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x41,0x23,0x25,0x41,0xF0,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xEF,0x25,0x61,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x41,0x54,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x2D,0x41,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x61,0x8D,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xE0,0x01,0x25,0x61,0x9F,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x61,0xA5,0x03,0xE0,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xC0,0x05,0x25,0x41,0xB5,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xB3,0x34,0xC0,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3D,0xE0,0x04,0x25,0x41,0x9D,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xA3,0x34,0xC0,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xE0,0x01,0x25,0x41,0x8B,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFE,0x25,0x41,0x89,0x07,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x61,0x50,0x25,0x61,0xEE,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x61,0xF1,0x25,0x61,0x56,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x61,0x22,0x25,0x41,0xC2,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xC1,0x25,0x41,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xE0,0x01,0x25,0x41,0x5E,0x25,0x41,0xE9,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xED,0x2D,0x41,0x66,0x07,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1D,0x61,0x10,0x25,0x41,0x7E,0x25,0x41,0xED,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xEC,0x25,0x61,0x7D,0x25,0x42,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2D,0x42,0x0C,0x25,0x41,0x72,0x25,0x41,0xD4,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xD3,0x25,0x61,0x71,0x2D,0x42,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x61,0x31,0x25,0x41,0x8B,0x25,0x41,0xD0,0x25,0x61,0xFD,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x41,0xFF,0x25,0x61,0xFD,0x25,0x41,0xCF,0x25,0x61,0x8A,0x25,0x41,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x21,0x14,0x2D,0x41,0x52,0x25,0x41,0x7C,0x25,0x61,0xA5,0x25,0x41,0xCB,0x25,0x41,0xDD,0x25,0x41,0xED,0x25,0x41,0xF9,0x25,0x41,0xF9,0x25,0x41,0xED,0x25,0x41,0xDD,0x25,0x41,0xCB,0x25,0x41,0xA4,0x25,0x41,0x7C,0x25,0x41,0x51,0x25,0x21,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x97,0x00,0x00,0x00,0x06,0x25,0x61,0x16,0x25,0x41,0x54,0x25,0x41,0x7F,0x25,0x41,0xA7,0x25,0x41,0xCD,0x25,0x41,0xDE,0x25,0x61,0xEE,0x81,0x25,0x61,0xFA,0x06,0x25,0x61,0xEE,0x25,0x41,0xDE,0x25,0x41,0xCD,0x25,0x41,0xA6,0x25,0x41,0x7E,0x2D,0x61,0x53,0x25,0x61,0x16,0xAC,0x00,0x00,0x00,0x03,0x25,0x61,0x35,0x25,0x41,0x8E,0x25,0x41,0xD3,0x25,0x41,0xFE,0x8D,0x25,0x41,0xFF,0x03,0x25,0x41,0xFE,0x25,0x41,0xD3,0x25,0x61,0x8D,0x25,0x61,0x34,0xA6,0x00,0x00,0x00,0x02,0x25,0x22,0x0E,0x25,0x61,0x74,0x25,0x61,0xD6,0x95,0x25,0x41,0xFF,0x02,0x25,0x41,0xD5,0x25,0x61,0x74,0x25,0x82,0x0D,0xA1,0x00,0x00,0x00,0x02,0x2D,0x41,0x12,0x25,0x61,0x81,0x25,0x61,0xEE,0x99,0x25,0x41,0xFF,0x02,0x25,0x61,0xEE,0x25,0x41,0x80,0x2D,0x21,0x11,0x9D,0x00,0x00,0x00,0x02,0x07,0xE0,0x01,0x25,0x41,0x5E,0x25,0x41,0xEA,0x9D,0x25,0x41,0xFF,0x02,0x25,0x41,0xED,0x25,0x41,0x6F,0x03,0xE0,0x02,0x9A,0x00,0x00,0x00,0x01,0x2D,0x41,0x24,0x25,0x41,0xC5,0xA1,0x25,0x41,0xFF,0x01,0x25,0x41,0xC4,0x25,0x41,0x23,
+    0x98,0x00,0x00,0x00,0x01,0x25,0x41,0x51,0x25,0x41,0xEF,0xA3,0x25,0x41,0xFF,0x01,0x25,0x41,0xF2,0x25,0x41,0x58,0x95,0x00,0x00,0x00,0x01,0x03,0xE0,0x02,0x25,0x41,0x8F,0xA7,0x25,0x41,0xFF,0x01,0x25,0x61,0x8D,0x03,0xE0,0x02,0x92,0x00,0x00,0x00,0x01,0x2D,0x40,0x06,0x25,0x41,0xA6,0xA9,0x25,0x41,0xFF,0x01,0x25,0x61,0xA5,0x34,0xC0,0x05,0x90,0x00,0x00,0x00,0x01,0x2D,0x40,0x06,0x25,0x41,0xB5,0xAB,0x25,0x41,0xFF,0x01,0x25,0x61,0xB4,0x34,0xC0,0x05,0x8E,0x00,0x00,0x00,0x01,0x07,0xE0,0x01,0x25,0x41,0xA1,0xAD,0x25,0x41,0xFF,0x01,0x25,0x41,0xA6,0x03,0xE0,0x02,0x8D,0x00,0x00,0x00,0x00,0x25,0x41,0x8F,0xAF,0x25,0x41,0xFF,0x00,0x25,0x41,0x8B,0x8C,0x00,0x00,0x00,0x00,0x25,0x41,0x55,0xB1,0x25,0x41,0xFF,0x00,0x2D,0x61,0x59,0x8A,0x00,0x00,0x00,0x01,0x25,0x41,0x23,0x25,0x41,0xF0,0xB1,0x25,0x41,0xFF,0x01,0x25,0x41,0xF0,0x25,0x61,0x22,0x88,0x00,0x00,0x00,0x01,0x07,0xE0,0x01,0x25,0x41,0xC5,0x87,0x25,0x41,0xFF,0x01,0x66,0x0A,0xFF,0xE7,0x9C,0xFF,0x86,0xFF,0xDF,0xFF,0x02,0xF7,
+    0xBE,0xFF,0xA6,0xD3,0xFF,0x2D,0x41,0xFF,0x9F,0x25,0x41,0xFF,0x01,0x25,0x41,0xC2,0x07,0xE0,0x01,0x87,0x00,0x00,0x00,0x00,0x25,0x41,0x64,0x88,0x25,0x41,0xFF,0x00,0xE7,0x9C,0xFF,0x89,0xFF,0xDF,0xFF,0x00,0x66,0x09,0xFF,0xA0,0x25,0x41,0xFF,0x00,0x2D,0x61,0x5F,0x86,0x00,0x00,0x00,0x01,0x2D,0x41,0x12,0x25,0x61,0xEB,0x88,0x25,0x41,0xFF,0x00,0xF7,0xDE,0xFF,0x89,0xFF,0xDF,0xFF,0x00,0x7E,0x4D,0xFF,0xA0,0x25,0x41,0xFF,0x01,0x25,0x41,0xE9,0x1D,0x61,0x10,0x85,0x00,0x00,0x00,0x00,0x25,0x41,0x82,0x89,0x25,0x41,0xFF,0x00,0xEF,0xBD,0xFF,0x89,0xFF,0xDF,0xFF,0x00,0x8E,0x8F,0xFF,0xA1,0x25,0x41,0xFF,0x00,0x25,0x41,0x7E,0x84,0x00,0x00,0x00,0x01,0x25,0x22,0x0E,0x25,0x61,0xEE,0x89,0x25,0x41,0xFF,0x00,0xE7,0x9B,0xFF,0x89,0xFF,0xDF,0xFF,0x00,0x96,0xB1,0xFF,0xA1,0x25,0x41,0xFF,0x01,0x25,0x41,0xED,0x25,0x82,0x0D,0x83,0x00,0x00,0x00,0x00,0x25,0x61,0x74,0x8A,0x25,0x41,0xFF,0x00,0xD7,0x59,0xFF,0x89,0xFF,0xDF,0xFF,0x00,0xB7,0x15,0xFF,0xA2,0x25,0x41,0xFF,0x00,0x25,0x41,0x72,0x83,
+    0x00,0x00,0x00,0x00,0x25,0x41,0xD3,0x8A,0x25,0x41,0xFF,0x00,0xB7,0x15,0xFF,0x89,0xFF,0xDF,0xFF,0x00,0xDF,0x7A,0xFF,0xA2,0x25,0x41,0xFF,0x00,0x25,0x41,0xD5,0x82,0x00,0x00,0x00,0x00,0x25,0x61,0x35,0x8B,0x25,0x41,0xFF,0x00,0x96,0x90,0xFF,0x8A,0xFF,0xDF,0xFF,0x00,0x3D,0x84,0xFF,0xA2,0x25,0x41,0xFF,0x00,0x25,0x61,0x31,0x81,0x00,0x00,0x00,0x00,0x25,0x41,0x8E,0x8B,0x25,0x41,0xFF,0x00,0x76,0x2C,0xFF,0x8A,0xFF,0xDF,0xFF,0x00,0x76,0x4C,0xFF,0xA2,0x25,0x41,0xFF,0x00,0x25,0x41,0x8B,0x81,0x00,0x00,0x00,0x00,0x25,0x41,0xD4,0x8B,0x25,0x41,0xFF,0x00,0x45,0xA5,0xFF,0x8A,0xFF,0xDF,0xFF,0x00,0xB7,0x15,0xFF,0xA2,0x25,0x41,0xFF,0x03,0x25,0x41,0xCF,0x00,0x00,0x00,0x25,0x61,0x16,0x25,0x41,0xFE,0x8C,0x25,0x41,0xFF,0x00,0xE7,0x9B,0xFF,0x89,0xFF,0xDF,0xFF,0x01,0xF7,0xDE,0xFF,0x3D,0x84,0xFF,0xA1,0x25,0x41,0xFF,0x02,0x25,0x41,0xFE,0x25,0x21,0x14,0x25,0x41,0x54,0x8D,0x25,0x41,0xFF,0x00,0xAE,0xF4,0xFF,0x8A,0xFF,0xDF,0xFF,0x00,0x96,0x90,0xFF,0xA2,0x25,0x41,0xFF,0x01,0x2D,0x41,
+    0x52,0x25,0x41,0x80,0x8D,0x25,0x41,0xFF,0x00,0x6E,0x2B,0xFF,0x8A,0xFF,0xDF,0xFF,0x00,0xCF,0x58,0xFF,0xA2,0x25,0x41,0xFF,0x01,0x25,0x61,0x7D,0x25,0x41,0xA7,0x8D,0x25,0x41,0xFF,0x01,0x2D,0x62,0xFF,0xEF,0xBD,0xFF,0x89,0xFF,0xDF,0xFF,0x00,0xA6,0xD2,0xFF,0xA2,0x25,0x41,0xFF,0x01,0x25,0x41,0xA4,0x25,0x41,0xCC,0x8E,0x25,0x41,0xFF,0x00,0xA6,0xD3,0xFF,0x87,0xFF,0xDF,0xFF,0x02,0xF7,0xBE,0xFF,0x9E,0xB1,0xFF,0x2D,0x62,0xFF,0xA2,0x25,0x41,0xFF,0x01,0x25,0x41,0xCA,0x25,0x41,0xE0,0x8E,0x25,0x41,0xFF,0x00,0x4D,0xC7,0xFF,0x85,0xFF,0xDF,0xFF,0x02,0xF7,0xBD,0xFF,0x96,0x90,0xFF,0x3D,0x84,0xFF,0xA4,0x25,0x41,0xFF,0x01,0x25,0x41,0xDE,0x25,0x41,0xED,0x8F,0x25,0x41,0xFF,0x00,0xBF,0x16,0xFF,0x84,0xFF,0xDF,0xFF,0x01,0xF7,0xBE,0xFF,0x4D,0xC6,0xFF,0xA5,0x25,0x41,0xFF,0x01,0x25,0x61,0xEB,0x25,0x41,0xF9,0x8F,0x25,0x41,0xFF,0x00,0x55,0xE8,0xFF,0x85,0xFF,0xDF,0xFF,0x01,0xCF,0x58,0xFF,0x2D,0x62,0xFF,0xA4,0x25,0x41,0xFF,0x01,0x25,0x41,0xF8,0x25,0x41,0xF9,0x90,0x25,0x41,0xFF,0x00,
+    0xBF,0x16,0xFF,0x85,0xFF,0xDF,0xFF,0x00,0x86,0x6E,0xFF,0xA4,0x25,0x41,0xFF,0x01,0x25,0x41,0xF8,0x25,0x41,0xED,0x90,0x25,0x41,0xFF,0x01,0x3D,0xA5,0xFF,0xF7,0xBE,0xFF,0x84,0xFF,0xDF,0xFF,0x01,0xF7,0xDE,0xFF,0x5E,0x09,0xFF,0xA3,0x25,0x41,0xFF,0x01,0x25,0x61,0xEB,0x25,0x41,0xE0,0x91,0x25,0x41,0xFF,0x00,0x8E,0x90,0xFF,0x85,0xFF,0xDF,0xFF,0x01,0xEF,0xBD,0xFF,0x4D,0xC6,0xFF,0xA2,0x25,0x41,0xFF,0x01,0x25,0x41,0xDE,0x25,0x41,0xCC,0x91,0x25,0x41,0xFF,0x01,0x2D,0x62,0xFF,0xCF,0x58,0xFF,0x85,0xFF,0xDF,0xFF,0x01,0xE7,0x9B,0xFF,0x3D,0x84,0xFF,0xA1,0x25,0x41,0xFF,0x01,0x25,0x41,0xCA,0x25,0x41,0xA6,0x92,0x25,0x41,0xFF,0x01,0x45,0xA5,0xFF,0xEF,0xBD,0xFF,0x85,0xFF,0xDF,0xFF,0x01,0xE7,0x9B,0xFF,0x4D,0xC6,0xFF,0x84,0x25,0x41,0xFF,0x04,0x2D,0x62,0xFF,0xA6,0xD2,0xFF,0xCF,0x58,0xFF,0x96,0x90,0xFF,0x3D,0x84,0xFF,0x96,0x25,0x41,0xFF,0x01,0x25,0x41,0xA3,0x25,0x41,0x7F,0x93,0x25,0x41,0xFF,0x00,0x6E,0x0A,0xFF,0x86,0xFF,0xDF,0xFF,0x01,0xEF,0xBD,0xFF,0x5D,0xE8,0xFF,0x83,0x25,
+    0x41,0xFF,0x00,0x9E,0xB1,0xFF,0x82,0xFF,0xDF,0xFF,0x03,0xF7,0xDE,0xFF,0xB7,0x15,0xFF,0x76,0x4C,0xFF,0x3D,0x84,0xFF,0x93,0x25,0x41,0xFF,0x01,0x25,0x41,0x7C,0x2D,0x61,0x53,0x94,0x25,0x41,0xFF,0x00,0x86,0x6E,0xFF,0x86,0xFF,0xDF,0xFF,0x05,0xF7,0xDE,0xFF,0x86,0x6E,0xFF,0x2D,0x61,0xFF,0x25,0x41,0xFF,0x3D,0x84,0xFF,0xF7,0xBE,0xFF,0x86,0xFF,0xDF,0xFF,0x06,0xDF,0x7B,0xFF,0xB7,0x15,0xFF,0x9E,0xB1,0xFF,0x8E,0x8F,0xFF,0x7E,0x4D,0xFF,0x66,0x09,0xFF,0x2D,0x41,0xFF,0x8C,0x25,0x41,0xFF,0x02,0x25,0x41,0x51,0x25,0x61,0x16,0x25,0x41,0xFE,0x94,0x25,0x41,0xFF,0x00,0x96,0x90,0xFF,0x87,0xFF,0xDF,0xFF,0x02,0xCF,0x58,0xFF,0x45,0xA6,0xFF,0x96,0x90,0xFF,0x8D,0xFF,0xDF,0xFF,0x00,0xA6,0xD3,0xFF,0x8B,0x25,0x41,0xFF,0x03,0x25,0x61,0xFD,0x25,0x21,0x14,0x00,0x00,0x00,0x25,0x41,0xD3,0x95,0x25,0x41,0xFF,0x00,0x96,0x90,0xFF,0x87,0xFF,0xDF,0xFF,0x01,0xF7,0xBE,0xFF,0xF7,0xBD,0xFF,0x8D,0xFF,0xDF,0xFF,0x00,0xF7,0xBE,0xFF,0x8B,0x25,0x41,0xFF,0x00,0x25,0x41,0xCE,0x81,0x00,0x00,0x00,0x00,
+    0x25,0x41,0x8E,0x96,0x25,0x41,0xFF,0x00,0x86,0x6E,0xFF,0x97,0xFF,0xDF,0xFF,0x8B,0x25,0x41,0xFF,0x00,0x25,0x61,0x8A,0x81,0x00,0x00,0x00,0x00,0x25,0x61,0x34,0x97,0x25,0x41,0xFF,0x01,0x66,0x0A,0xFF,0xEF,0xBD,0xFF,0x95,0xFF,0xDF,0xFF,0x8B,0x25,0x41,0xFF,0x00,0x25,0x41,0x30,0x82,0x00,0x00,0x00,0x00,0x25,0x41,0xD3,0x97,0x25,0x41,0xFF,0x01,0x3D,0xA5,0xFF,0xCF,0x58,0xFF,0x94,0xFF,0xDF,0xFF,0x8A,0x25,0x41,0xFF,0x00,0x25,0x41,0xD5,0x83,0x00,0x00,0x00,0x00,0x25,0x61,0x74,0x98,0x25,0x41,0xFF,0x02,0x2D,0x62,0xFF,0x8E,0x90,0xFF,0xF7,0xBE,0xFF,0x92,0xFF,0xDF,0xFF,0x8A,0x25,0x41,0xFF,0x00,0x25,0x41,0x72,0x83,0x00,0x00,0x00,0x01,0x25,0x82,0x0D,0x25,0x61,0xEE,0x99,0x25,0x41,0xFF,0x01,0x45,0xA5,0xFF,0xBF,0x16,0xFF,0x91,0xFF,0xDF,0xFF,0x89,0x25,0x41,0xFF,0x01,0x25,0x41,0xED,0x25,0x82,0x0D,0x84,0x00,0x00,0x00,0x00,0x25,0x61,0x81,0x9B,0x25,0x41,0xFF,0x01,0x55,0xC7,0xFF,0xB7,0x15,0xFF,0x8F,0xFF,0xDF,0xFF,0x89,0x25,0x41,0xFF,0x00,0x25,0x61,0x7D,0x85,0x00,0x00,0x00,0x01,
+    0x2D,0x21,0x11,0x25,0x41,0xEA,0x9C,0x25,0x41,0xFF,0x02,0x4D,0xC7,0xFF,0xA6,0xD2,0xFF,0xEF,0xBD,0xFF,0x8C,0xFF,0xDF,0xFF,0x88,0x25,0x41,0xFF,0x01,0x25,0x61,0xE8,0x25,0x42,0x0F,0x86,0x00,0x00,0x00,0x00,0x25,0x61,0x62,0x9E,0x25,0x41,0xFF,0x03,0x2D,0x62,0xFF,0x6E,0x0A,0xFF,0xAE,0xF4,0xFF,0xE7,0x9B,0xFF,0x88,0xFF,0xDF,0xFF,0x00,0xE7,0x9B,0xFF,0x88,0x25,0x41,0xFF,0x00,0x25,0x41,0x5D,0x87,0x00,0x00,0x00,0x01,0x07,0xE0,0x01,0x25,0x41,0xC4,0xA1,0x25,0x41,0xFF,0x09,0x45,0xA5,0xFF,0x76,0x2C,0xFF,0x96,0x90,0xFF,0xB7,0x15,0xFF,0xD7,0x59,0xFF,0xDF,0x9B,0xFF,0xEF,0xBD,0xFF,0xF7,0xDE,0xFF,0xE7,0x9B,0xFF,0x66,0x0A,0xFF,0x87,0x25,0x41,0xFF,0x01,0x25,0x41,0xC1,0x07,0xE0,0x01,0x88,0x00,0x00,0x00,0x01,0x25,0x41,0x23,0x25,0x41,0xF0,0xB1,0x25,0x41,0xFF,0x01,0x25,0x41,0xEF,0x25,0x61,0x22,0x8A,0x00,0x00,0x00,0x00,0x25,0x41,0x54,0xB1,0x25,0x41,0xFF,0x00,0x2D,0x41,0x52,0x8C,0x00,0x00,0x00,0x00,0x25,0x61,0x8D,0xAF,0x25,0x41,0xFF,0x00,0x25,0x41,0x89,0x8D,0x00,0x00,0x00,0x01,
+    0x07,0xE0,0x01,0x25,0x61,0x9F,0xAD,0x25,0x41,0xFF,0x01,0x25,0x61,0xA5,0x03,0xE0,0x02,0x8E,0x00,0x00,0x00,0x01,0x34,0xC0,0x05,0x25,0x41,0xB5,0xAB,0x25,0x41,0xFF,0x01,0x25,0x41,0xB3,0x34,0xC0,0x05,0x90,0x00,0x00,0x00,0x01,0x3D,0xE0,0x04,0x25,0x41,0x9D,0xA9,0x25,0x41,0xFF,0x01,0x25,0x41,0xA3,0x34,0xC0,0x05,0x92,0x00,0x00,0x00,0x01,0x07,0xE0,0x01,0x25,0x41,0x8B,0xA6,0x25,0x41,0xFF,0x02,0x25,0x41,0xFE,0x25,0x41,0x89,0x07,0xE0,0x01,0x95,0x00,0x00,0x00,0x01,0x25,0x61,0x50,0x25,0x61,0xEE,0xA3,0x25,0x41,0xFF,0x01,0x25,0x61,0xF1,0x25,0x61,0x56,0x98,0x00,0x00,0x00,0x01,0x25,0x61,0x22,0x25,0x41,0xC2,0xA1,0x25,0x41,0xFF,0x01,0x25,0x41,0xC1,0x25,0x41,0x21,0x9A,0x00,0x00,0x00,0x02,0x07,0xE0,0x01,0x25,0x41,0x5E,0x25,0x41,0xE9,0x9D,0x25,0x41,0xFF,0x02,0x25,0x41,0xED,0x2D,0x41,0x66,0x07,0xE0,0x01,0x9D,0x00,0x00,0x00,0x02,0x1D,0x61,0x10,0x25,0x41,0x7E,0x25,0x41,0xED,0x99,0x25,0x41,0xFF,0x02,0x25,0x41,0xEC,0x25,0x61,0x7D,0x25,0x42,0x0F,0xA1,0x00,0x00,0x00,0x02,0x2D,
+    0x42,0x0C,0x25,0x41,0x72,0x25,0x41,0xD4,0x95,0x25,0x41,0xFF,0x02,0x25,0x41,0xD3,0x25,0x61,0x71,0x2D,0x42,0x0C,0xA6,0x00,0x00,0x00,0x03,0x25,0x61,0x31,0x25,0x41,0x8B,0x25,0x41,0xD0,0x25,0x61,0xFD,0x8D,0x25,0x41,0xFF,0x03,0x25,0x61,0xFD,0x25,0x41,0xCF,0x25,0x61,0x8A,0x25,0x41,0x30,0xAC,0x00,0x00,0x00,0x06,0x25,0x21,0x14,0x2D,0x41,0x52,0x25,0x41,0x7C,0x25,0x61,0xA5,0x25,0x41,0xCB,0x25,0x41,0xDD,0x25,0x41,0xED,0x81,0x25,0x41,0xF9,0x06,0x25,0x41,0xED,0x25,0x41,0xDD,0x25,0x41,0xCB,0x25,0x41,0xA4,0x25,0x41,0x7C,0x25,0x41,0x51,0x25,0x21,0x14,0x97,0x00,0x00,0x00,
     };
 const lv_img_dsc_t ui_img_answer_png = {
    .header.always_zero = 0,
    .header.w = 64,
    .header.h = 64,
    .data_size = sizeof(ui_img_answer_png_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+   .header.cf = LV_IMG_CF_USER_ENCODED_1,
    .data = ui_img_answer_png_data};
 
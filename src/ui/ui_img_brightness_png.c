@@ -10,77 +10,26 @@
 #endif
 
 // IMAGE DATA: assets\brightness.png
+// Run length encoded LV_IMG_CF_TRUE_COLOR_ALPHA, decoded by src/img_cache.cpp
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_brightness_png_data[] = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0x41,0xFE,0xC8,0xE2,0xFE,0x06,0xFA,0xFE,0x46,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0xCB,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x06,0xF4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0xDF,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0xDF,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0xDF,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0xDF,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0xDF,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0xDF,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xE0,0x01,0xFE,0xA8,0x20,0xFF,0x07,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0xD4,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x27,0x09,0xF5,0xE6,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xE0,0x01,0xFE,0xC8,0xA8,0xFE,0xC8,0xFF,0xFE,0xC8,0xE7,0xFE,0xC8,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xA8,0x66,0xFE,0xC8,0xFC,0xFD,0xE5,0xFF,0xFE,0x46,0xA1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0xE5,0x36,0xFD,0xE5,0xE7,0xFD,0xE5,0xFF,0xFD,0xE5,0xA7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xA8,0x20,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xF0,0xFE,0xC8,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0x1A,0xFE,0x46,0x2F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0xE5,0x36,0xFD,0xE5,0xF0,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xF5,0xC5,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x07,0x09,0xFE,0xC8,0xE7,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xF0,0xFE,0xC8,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0xE5,0x36,0xFD,0xE5,0xF0,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xE6,0xFD,0xE4,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xA8,0x32,0xFE,0xC8,0xED,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xF0,0xFE,0xC8,0x37,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0xE5,0x32,0xFD,0xE5,0xED,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xF0,0xFD,0xE5,0x37,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0x36,0xFE,0xC8,0xF0,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xF0,0xFE,0xC8,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0xE5,0x36,0xFD,0xE5,0xF0,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xF0,0xFD,0xE5,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0x36,0xFE,0xC8,0xF0,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xE5,0xFE,0x66,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC9,0x07,0xFE,0xC8,0x3B,0xFE,0xC8,0x65,0xFE,0xC8,0x85,0xFE,0xA8,0x92,0xFE,0x26,0xCF,0xFE,0x26,0xC5,0xFE,0x46,0xA2,0xFE,0x46,0x68,0xFE,0x27,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x45,0x06,0xFD,0xE5,0xE6,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xF0,0xFD,0xE5,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0x36,0xFE,0xC8,0xF0,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x66,0x05,0xFE,0xC8,0x56,0xFE,0xA8,0xB4,0xFE,0xC8,0xF6,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x26,0xE8,0xFE,0x46,0x8E,0xFE,0x27,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0xC5,0x16,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xF0,0xFD,0xE5,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0x36,0xFE,0xC8,0xE5,0xFE,0xC8,0xFF,0xFE,0xA8,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xF0,0x02,0xFE,0xA8,0x66,0xFE,0xC8,0xE0,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFB,0xFE,0x46,0x9E,0xFF,0xEA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0xE5,0x96,0xFD,0xE5,0xFF,0xFD,0xE5,0xE5,0xFD,0xE5,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x66,0x05,0xFE,0xC9,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xA8,0x26,0xFE,0xC8,0xC9,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x06,0xF2,0xFE,0x46,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x06,0x15,0xFE,0x66,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0x50,0xFE,0xC8,0xF2,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFE,0xFE,0x46,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xA8,0x5F,0xFE,0xC8,0xFC,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x46,0x97,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0x50,0xFE,0xC8,0xFC,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x46,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xA8,0x24,0xFE,0xC8,0xF1,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFE,0xFE,0x47,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xF0,0x02,0xFE,0xC8,0xC9,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x06,0xF2,0xFD,0xE8,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xA8,0x66,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x46,0x9E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x66,0x05,0xFE,0xC8,0xE0,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFB,0xFE,0x69,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0x57,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x46,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xA8,0xB4,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x26,0xE7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC9,0x07,0xFE,0xC8,0xF6,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x27,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0x3B,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x46,0x66,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xA8,0x66,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x26,0xA0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xFE,0xC8,0x41,0xFE,0xC8,0xCB,0xFE,0xC8,0xDD,0xFE,0xC8,0xDD,0xFE,0xC8,0xDD,0xFE,0xC8,0xDD,0xFE,0xC8,0xDD,0xFE,0xC8,0xDD,0xFE,0xC8,0xD3,0xFE,0xA8,0x66,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0x84,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x26,0xC2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0xE5,0x67,0xFD,0xE5,0xD3,0xFD,0xE5,0xDD,0xFD,0xE5,0xDD,0xFD,0xE5,0xDD,0xFD,0xE5,0xDD,0xFD,0xE5,0xDD,0xFD,0xE5,0xDD,0xFD,0xE5,0xCA,0xFD,0xE5,0x40,
-    0xFE,0xC8,0xE2,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFC,0xFE,0xC8,0x1A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0x90,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x26,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF5,0xE5,0x1B,0xFD,0xE5,0xFD,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xE0,
-    0xFE,0xC8,0xE1,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFC,0xFE,0xC8,0x1A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0x90,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x26,0xCE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF5,0xC4,0x1A,0xFD,0xE5,0xFC,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xE0,
-    0xFE,0xA8,0x40,0xFE,0xC8,0xCA,0xFE,0xC8,0xDD,0xFE,0xC8,0xDD,0xFE,0xC8,0xDD,0xFE,0xC8,0xDD,0xFE,0xC8,0xDD,0xFE,0xC8,0xDD,0xFE,0xC8,0xD3,0xFE,0xC8,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0x83,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x26,0xC2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0xE5,0x65,0xFD,0xE5,0xD3,0xFD,0xE5,0xDD,0xFD,0xE5,0xDD,0xFD,0xE5,0xDD,0xFD,0xE5,0xDD,0xFD,0xE5,0xDD,0xFD,0xE5,0xDD,0xFD,0xE5,0xC9,0xFD,0xE5,0x3F,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0x65,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x46,0x9E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0x3B,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x47,0x65,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xAA,0x06,0xFE,0xC8,0xF5,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x27,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0xB3,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x06,0xE7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0x55,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x46,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x66,0x05,0xFE,0xC8,0xDF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFB,0xFE,0x27,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0x63,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x26,0x9B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xF0,0x02,0xFE,0xC8,0xC7,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x06,0xF1,0xFF,0xE0,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xA8,0x24,0xFE,0xC8,0xF1,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFE,0xFE,0x47,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xA8,0x4D,0xFE,0xC8,0xFB,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x46,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0x5E,0xFE,0xC8,0xFB,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x46,0x96,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xA8,0x4D,0xFE,0xC8,0xF1,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFE,0xFE,0x46,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xAA,0x06,0xFE,0x88,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xA8,0x25,0xFE,0xC8,0xC7,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x06,0xF1,0xFE,0x67,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0xE5,0x17,0xFE,0x66,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0x36,0xFE,0xC8,0xE6,0xFE,0xC8,0xFF,0xFE,0xC8,0x95,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xF0,0x02,0xFE,0xC8,0x63,0xFE,0xC8,0xDF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFA,0xFE,0x26,0x9B,0xFF,0xE0,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0xE5,0x97,0xFD,0xE5,0xFF,0xFD,0xE5,0xE6,0xFD,0xE5,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0x36,0xFE,0xC8,0xF0,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x66,0x05,0xFE,0xC8,0x55,0xFE,0xC8,0xB2,0xFE,0xC8,0xF5,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xA8,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFE,0x06,0xE7,0xFE,0x46,0x8B,0xFD,0xE8,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0xC5,0x16,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xF0,0xFD,0xE5,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0x36,0xFE,0xC8,0xF0,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xE5,0xFE,0x66,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xAA,0x06,0xFE,0xA8,0x3A,0xFE,0xC8,0x64,0xFE,0xC8,0x83,0xFE,0xA8,0x92,0xFE,0x26,0xCF,0xFE,0x26,0xC3,0xFE,0x26,0xA0,0xFE,0x47,0x65,0xFE,0x88,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0x45,0x06,0xFD,0xE5,0xE5,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xF0,0xFD,0xE5,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0x36,0xFE,0xC8,0xF0,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xF0,0xFE,0xC8,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0xE5,0x36,0xFD,0xE5,0xF0,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xF0,0xFD,0xE5,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xA8,0x32,0xFE,0xC8,0xED,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xF0,0xFE,0xC8,0x37,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0xE5,0x32,0xFD,0xE5,0xED,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xF0,0xFD,0xE5,0x37,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x07,0x09,0xFE,0xC8,0xE7,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xF0,0xFE,0xC8,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0xE5,0x36,0xFD,0xE5,0xF0,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xE7,0xFD,0xE4,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xA8,0x20,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xFF,0xFE,0xC8,0xF0,0xFE,0xC8,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0x1B,0xFE,0x46,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0xE5,0x36,0xFD,0xE5,0xF0,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xFD,0xE5,0xFF,0xF5,0xC5,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xA8,0xA7,0xFE,0xC8,0xFF,0xFE,0xC8,0xE6,0xFE,0xC8,0x36,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xA8,0x67,0xFE,0xC8,0xFD,0xFE,0x05,0xFF,0xFE,0x46,0xA2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0xE5,0x36,0xFD,0xE5,0xE7,0xFD,0xE5,0xFF,0xFD,0xE5,0xA6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xA8,0x1E,0xFE,0xE8,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0xD4,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFD,0xE4,0x08,0xF5,0xC5,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0xDF,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0xDF,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0xDF,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0xDF,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0xDF,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0xDF,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xC8,0xCA,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x06,0xF4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xA8,0x40,0xFE,0xC8,0xE0,0xFE,0x05,0xFA,0xFE,0x47,0x6E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x9D,0x00,0x00,0x00,0x03,0xFE,0xC8,0x41,0xFE,0xC8,0xE2,0xFE,0x06,0xFA,0xFE,0x46,0x70,0xBB,0x00,0x00,0x00,0x03,0xFE,0xC8,0xCB,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x06,0xF4,0xBB,0x00,0x00,0x00,0x03,0xFE,0xC8,0xDF,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFB,0xBB,0x00,0x00,0x00,0x03,0xFE,0xC8,0xDF,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFB,0xBB,0x00,0x00,0x00,0x03,0xFE,0xC8,0xDF,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFB,0xBB,0x00,0x00,0x00,0x03,0xFE,0xC8,0xDF,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFB,0xBB,0x00,0x00,0x00,0x03,0xFE,0xC8,0xDF,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFB,0xBB,0x00,0x00,0x00,0x03,0xFE,0xC8,0xDF,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFB,0xA6,0x00,0x00,0x00,0x02,0xFF,0xE0,0x01,0xFE,0xA8,0x20,0xFF,0x07,0x09,0x91,0x00,0x00,0x00,0x03,0xFE,0xC8,0xD4,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xF8,0x91,0x00,0x00,0x00,0x01,0xFE,0x27,0x09,0xF5,0xE6,0x20,0x91,0x00,0x00,0x00,0x04,0xFF,0xE0,0x01,0xFE,0xC8,0xA8,0xFE,0xC8,0xFF,
+    0xFE,0xC8,0xE7,0xFE,0xC8,0x36,0x90,0x00,0x00,0x00,0x03,0xFE,0xA8,0x66,0xFE,0xC8,0xFC,0xFD,0xE5,0xFF,0xFE,0x46,0xA1,0x90,0x00,0x00,0x00,0x03,0xFD,0xE5,0x36,0xFD,0xE5,0xE7,0xFD,0xE5,0xFF,0xFD,0xE5,0xA7,0x90,0x00,0x00,0x00,0x00,0xFE,0xA8,0x20,0x82,0xFE,0xC8,0xFF,0x01,0xFE,0xC8,0xF0,0xFE,0xC8,0x36,0x90,0x00,0x00,0x00,0x01,0xFE,0xC8,0x1A,0xFE,0x46,0x2F,0x90,0x00,0x00,0x00,0x01,0xFD,0xE5,0x36,0xFD,0xE5,0xF0,0x82,0xFD,0xE5,0xFF,0x00,0xF5,0xC5,0x1E,0x8F,0x00,0x00,0x00,0x01,0xFF,0x07,0x09,0xFE,0xC8,0xE7,0x82,0xFE,0xC8,0xFF,0x01,0xFE,0xC8,0xF0,0xFE,0xC8,0x36,0xA1,0x00,0x00,0x00,0x01,0xFD,0xE5,0x36,0xFD,0xE5,0xF0,0x82,0xFD,0xE5,0xFF,0x01,0xFD,0xE5,0xE6,0xFD,0xE4,0x08,0x90,0x00,0x00,0x00,0x01,0xFE,0xA8,0x32,0xFE,0xC8,0xED,0x82,0xFE,0xC8,0xFF,0x01,0xFE,0xC8,0xF0,0xFE,0xC8,0x37,0x9F,0x00,0x00,0x00,0x01,0xFD,0xE5,0x32,0xFD,0xE5,0xED,0x82,0xFD,0xE5,0xFF,0x01,0xFD,0xE5,0xF0,0xFD,0xE5,0x37,0x92,0x00,0x00,0x00,0x01,0xFE,0xC8,0x36,0xFE,0xC8,0xF0,0x82,0xFE,0xC8,0xFF,
+    0x01,0xFE,0xC8,0xF0,0xFE,0xC8,0x36,0x9D,0x00,0x00,0x00,0x01,0xFD,0xE5,0x36,0xFD,0xE5,0xF0,0x82,0xFD,0xE5,0xFF,0x01,0xFD,0xE5,0xF0,0xFD,0xE5,0x36,0x94,0x00,0x00,0x00,0x01,0xFE,0xC8,0x36,0xFE,0xC8,0xF0,0x82,0xFE,0xC8,0xFF,0x01,0xFE,0xC8,0xE5,0xFE,0x66,0x05,0x88,0x00,0x00,0x00,0x09,0xFE,0xC9,0x07,0xFE,0xC8,0x3B,0xFE,0xC8,0x65,0xFE,0xC8,0x85,0xFE,0xA8,0x92,0xFE,0x26,0xCF,0xFE,0x26,0xC5,0xFE,0x46,0xA2,0xFE,0x46,0x68,0xFE,0x27,0x0D,0x88,0x00,0x00,0x00,0x01,0xFD,0x45,0x06,0xFD,0xE5,0xE6,0x82,0xFD,0xE5,0xFF,0x01,0xFD,0xE5,0xF0,0xFD,0xE5,0x36,0x96,0x00,0x00,0x00,0x01,0xFE,0xC8,0x36,0xFE,0xC8,0xF0,0x82,0xFE,0xC8,0xFF,0x00,0xFE,0xC8,0x14,0x85,0x00,0x00,0x00,0x03,0xFE,0x66,0x05,0xFE,0xC8,0x56,0xFE,0xA8,0xB4,0xFE,0xC8,0xF6,0x82,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x84,0xFD,0xE5,0xFF,0x02,0xFE,0x26,0xE8,0xFE,0x46,0x8E,0xFE,0x27,0x09,0x85,0x00,0x00,0x00,0x00,0xFD,0xC5,0x16,0x82,0xFD,0xE5,0xFF,0x01,0xFD,0xE5,0xF0,0xFD,0xE5,0x36,0x98,0x00,0x00,0x00,0x03,0xFE,0xC8,
+    0x36,0xFE,0xC8,0xE5,0xFE,0xC8,0xFF,0xFE,0xA8,0x94,0x84,0x00,0x00,0x00,0x02,0xFF,0xF0,0x02,0xFE,0xA8,0x66,0xFE,0xC8,0xE0,0x85,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x86,0xFD,0xE5,0xFF,0x02,0xFE,0x05,0xFB,0xFE,0x46,0x9E,0xFF,0xEA,0x03,0x84,0x00,0x00,0x00,0x03,0xFD,0xE5,0x96,0xFD,0xE5,0xFF,0xFD,0xE5,0xE5,0xFD,0xE5,0x36,0x9A,0x00,0x00,0x00,0x01,0xFE,0x66,0x05,0xFE,0xC9,0x15,0x84,0x00,0x00,0x00,0x01,0xFE,0xA8,0x26,0xFE,0xC8,0xC9,0x87,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x88,0xFD,0xE5,0xFF,0x01,0xFE,0x06,0xF2,0xFE,0x46,0x42,0x84,0x00,0x00,0x00,0x01,0xFE,0x06,0x15,0xFE,0x66,0x05,0xA1,0x00,0x00,0x00,0x01,0xFE,0xC8,0x50,0xFE,0xC8,0xF2,0x88,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x89,0xFD,0xE5,0xFF,0x01,0xFE,0x05,0xFE,0xFE,0x46,0x81,0xA6,0x00,0x00,0x00,0x01,0xFE,0xA8,0x5F,0xFE,0xC8,0xFC,0x89,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x8B,0xFD,0xE5,0xFF,0x00,0xFE,0x46,0x97,0xA4,0x00,0x00,0x00,0x01,0xFE,0xC8,0x50,0xFE,0xC8,0xFC,0x8A,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x8C,
+    0xFD,0xE5,0xFF,0x00,0xFE,0x46,0x82,0xA2,0x00,0x00,0x00,0x01,0xFE,0xA8,0x24,0xFE,0xC8,0xF1,0x8B,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x8C,0xFD,0xE5,0xFF,0x01,0xFD,0xE5,0xFE,0xFE,0x47,0x49,0xA0,0x00,0x00,0x00,0x01,0xFF,0xF0,0x02,0xFE,0xC8,0xC9,0x8C,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x8D,0xFD,0xE5,0xFF,0x01,0xFE,0x06,0xF2,0xFD,0xE8,0x04,0x9F,0x00,0x00,0x00,0x00,0xFE,0xA8,0x66,0x8D,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x8E,0xFD,0xE5,0xFF,0x00,0xFE,0x46,0x9E,0x9E,0x00,0x00,0x00,0x01,0xFE,0x66,0x05,0xFE,0xC8,0xE0,0x8D,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x8E,0xFD,0xE5,0xFF,0x01,0xFE,0x05,0xFB,0xFE,0x69,0x0A,0x9D,0x00,0x00,0x00,0x00,0xFE,0xC8,0x57,0x8E,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x8F,0xFD,0xE5,0xFF,0x00,0xFE,0x46,0x8C,0x9D,0x00,0x00,0x00,0x00,0xFE,0xA8,0xB4,0x8E,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x8F,0xFD,0xE5,0xFF,0x00,0xFE,0x26,0xE7,0x9C,0x00,0x00,0x00,0x01,0xFE,0xC9,0x07,0xFE,0xC8,0xF6,0x8E,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x90,0xFD,0xE5,0xFF,
+    0x00,0xFE,0x27,0x0D,0x9B,0x00,0x00,0x00,0x00,0xFE,0xC8,0x3B,0x8F,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x90,0xFD,0xE5,0xFF,0x00,0xFE,0x46,0x66,0x9B,0x00,0x00,0x00,0x00,0xFE,0xA8,0x66,0x8F,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x90,0xFD,0xE5,0xFF,0x00,0xFE,0x26,0xA0,0x8D,0x00,0x00,0x00,0x01,0xFE,0xC8,0x41,0xFE,0xC8,0xCB,0x85,0xFE,0xC8,0xDD,0x01,0xFE,0xC8,0xD3,0xFE,0xA8,0x66,0x83,0x00,0x00,0x00,0x00,0xFE,0xC8,0x84,0x8F,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x90,0xFD,0xE5,0xFF,0x00,0xFE,0x26,0xC2,0x83,0x00,0x00,0x00,0x01,0xFD,0xE5,0x67,0xFD,0xE5,0xD3,0x85,0xFD,0xE5,0xDD,0x02,0xFD,0xE5,0xCA,0xFD,0xE5,0x40,0xFE,0xC8,0xE2,0x87,0xFE,0xC8,0xFF,0x01,0xFE,0xC8,0xFC,0xFE,0xC8,0x1A,0x82,0x00,0x00,0x00,0x00,0xFE,0xC8,0x90,0x8F,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x90,0xFD,0xE5,0xFF,0x00,0xFE,0x26,0xCE,0x82,0x00,0x00,0x00,0x01,0xF5,0xE5,0x1B,0xFD,0xE5,0xFD,0x87,0xFD,0xE5,0xFF,0x01,0xFD,0xE5,0xE0,0xFE,0xC8,0xE1,0x87,0xFE,0xC8,0xFF,0x01,0xFE,0xC8,0xFC,0xFE,0xC8,0x1A,0x82,
+    0x00,0x00,0x00,0x00,0xFE,0xC8,0x90,0x8F,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x90,0xFD,0xE5,0xFF,0x00,0xFE,0x26,0xCE,0x82,0x00,0x00,0x00,0x01,0xF5,0xC4,0x1A,0xFD,0xE5,0xFC,0x87,0xFD,0xE5,0xFF,0x02,0xFD,0xE5,0xE0,0xFE,0xA8,0x40,0xFE,0xC8,0xCA,0x85,0xFE,0xC8,0xDD,0x01,0xFE,0xC8,0xD3,0xFE,0xC8,0x64,0x83,0x00,0x00,0x00,0x00,0xFE,0xC8,0x83,0x8F,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x90,0xFD,0xE5,0xFF,0x00,0xFE,0x26,0xC2,0x83,0x00,0x00,0x00,0x01,0xFD,0xE5,0x65,0xFD,0xE5,0xD3,0x85,0xFD,0xE5,0xDD,0x01,0xFD,0xE5,0xC9,0xFD,0xE5,0x3F,0x8D,0x00,0x00,0x00,0x00,0xFE,0xC8,0x65,0x8F,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x90,0xFD,0xE5,0xFF,0x00,0xFE,0x46,0x9E,0x9B,0x00,0x00,0x00,0x00,0xFE,0xC8,0x3B,0x8F,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x90,0xFD,0xE5,0xFF,0x00,0xFE,0x47,0x65,0x9B,0x00,0x00,0x00,0x01,0xFE,0xAA,0x06,0xFE,0xC8,0xF5,0x8E,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x90,0xFD,0xE5,0xFF,0x00,0xFE,0x27,0x0D,0x9C,0x00,0x00,0x00,0x00,0xFE,0xC8,0xB3,0x8E,0xFE,0xC8,0xFF,
+    0x00,0xFE,0xA8,0xFF,0x8F,0xFD,0xE5,0xFF,0x00,0xFE,0x06,0xE7,0x9D,0x00,0x00,0x00,0x00,0xFE,0xC8,0x55,0x8E,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x8F,0xFD,0xE5,0xFF,0x00,0xFE,0x46,0x8C,0x9D,0x00,0x00,0x00,0x01,0xFE,0x66,0x05,0xFE,0xC8,0xDF,0x8D,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x8E,0xFD,0xE5,0xFF,0x01,0xFE,0x05,0xFB,0xFE,0x27,0x09,0x9E,0x00,0x00,0x00,0x00,0xFE,0xC8,0x63,0x8D,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x8E,0xFD,0xE5,0xFF,0x00,0xFE,0x26,0x9B,0x9F,0x00,0x00,0x00,0x01,0xFF,0xF0,0x02,0xFE,0xC8,0xC7,0x8C,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x8D,0xFD,0xE5,0xFF,0x01,0xFE,0x06,0xF1,0xFF,0xE0,0x02,0xA0,0x00,0x00,0x00,0x01,0xFE,0xA8,0x24,0xFE,0xC8,0xF1,0x8B,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x8C,0xFD,0xE5,0xFF,0x01,0xFE,0x05,0xFE,0xFE,0x47,0x44,0xA2,0x00,0x00,0x00,0x01,0xFE,0xA8,0x4D,0xFE,0xC8,0xFB,0x8A,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x8C,0xFD,0xE5,0xFF,0x00,0xFE,0x46,0x7F,0xA4,0x00,0x00,0x00,0x01,0xFE,0xC8,0x5E,0xFE,0xC8,0xFB,0x89,0xFE,0xC8,0xFF,
+    0x00,0xFE,0xA8,0xFF,0x8B,0xFD,0xE5,0xFF,0x00,0xFE,0x46,0x96,0xA6,0x00,0x00,0x00,0x01,0xFE,0xA8,0x4D,0xFE,0xC8,0xF1,0x88,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x89,0xFD,0xE5,0xFF,0x01,0xFE,0x05,0xFE,0xFE,0x46,0x7F,0xA1,0x00,0x00,0x00,0x01,0xFE,0xAA,0x06,0xFE,0x88,0x17,0x84,0x00,0x00,0x00,0x01,0xFE,0xA8,0x25,0xFE,0xC8,0xC7,0x87,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x88,0xFD,0xE5,0xFF,0x01,0xFE,0x06,0xF1,0xFE,0x67,0x3F,0x84,0x00,0x00,0x00,0x01,0xFD,0xE5,0x17,0xFE,0x66,0x05,0x9A,0x00,0x00,0x00,0x03,0xFE,0xC8,0x36,0xFE,0xC8,0xE6,0xFE,0xC8,0xFF,0xFE,0xC8,0x95,0x84,0x00,0x00,0x00,0x02,0xFF,0xF0,0x02,0xFE,0xC8,0x63,0xFE,0xC8,0xDF,0x85,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x86,0xFD,0xE5,0xFF,0x02,0xFE,0x05,0xFA,0xFE,0x26,0x9B,0xFF,0xE0,0x02,0x84,0x00,0x00,0x00,0x03,0xFD,0xE5,0x97,0xFD,0xE5,0xFF,0xFD,0xE5,0xE6,0xFD,0xE5,0x36,0x98,0x00,0x00,0x00,0x01,0xFE,0xC8,0x36,0xFE,0xC8,0xF0,0x82,0xFE,0xC8,0xFF,0x00,0xFE,0xC8,0x14,0x85,0x00,0x00,0x00,0x03,0xFE,0x66,0x05,0xFE,
+    0xC8,0x55,0xFE,0xC8,0xB2,0xFE,0xC8,0xF5,0x82,0xFE,0xC8,0xFF,0x00,0xFE,0xA8,0xFF,0x84,0xFD,0xE5,0xFF,0x02,0xFE,0x06,0xE7,0xFE,0x46,0x8B,0xFD,0xE8,0x08,0x85,0x00,0x00,0x00,0x00,0xFD,0xC5,0x16,0x82,0xFD,0xE5,0xFF,0x01,0xFD,0xE5,0xF0,0xFD,0xE5,0x36,0x96,0x00,0x00,0x00,0x01,0xFE,0xC8,0x36,0xFE,0xC8,0xF0,0x82,0xFE,0xC8,0xFF,0x01,0xFE,0xC8,0xE5,0xFE,0x66,0x05,0x88,0x00,0x00,0x00,0x09,0xFE,0xAA,0x06,0xFE,0xA8,0x3A,0xFE,0xC8,0x64,0xFE,0xC8,0x83,0xFE,0xA8,0x92,0xFE,0x26,0xCF,0xFE,0x26,0xC3,0xFE,0x26,0xA0,0xFE,0x47,0x65,0xFE,0x88,0x0B,0x88,0x00,0x00,0x00,0x01,0xFD,0x45,0x06,0xFD,0xE5,0xE5,0x82,0xFD,0xE5,0xFF,0x01,0xFD,0xE5,0xF0,0xFD,0xE5,0x36,0x94,0x00,0x00,0x00,0x01,0xFE,0xC8,0x36,0xFE,0xC8,0xF0,0x82,0xFE,0xC8,0xFF,0x01,0xFE,0xC8,0xF0,0xFE,0xC8,0x36,0x9D,0x00,0x00,0x00,0x01,0xFD,0xE5,0x36,0xFD,0xE5,0xF0,0x82,0xFD,0xE5,0xFF,0x01,0xFD,0xE5,0xF0,0xFD,0xE5,0x36,0x92,0x00,0x00,0x00,0x01,0xFE,0xA8,0x32,0xFE,0xC8,0xED,0x82,0xFE,0xC8,0xFF,0x01,0xFE,0xC8,0xF0,0xFE,
+    0xC8,0x37,0x9F,0x00,0x00,0x00,0x01,0xFD,0xE5,0x32,0xFD,0xE5,0xED,0x82,0xFD,0xE5,0xFF,0x01,0xFD,0xE5,0xF0,0xFD,0xE5,0x37,0x90,0x00,0x00,0x00,0x01,0xFF,0x07,0x09,0xFE,0xC8,0xE7,0x82,0xFE,0xC8,0xFF,0x01,0xFE,0xC8,0xF0,0xFE,0xC8,0x36,0xA1,0x00,0x00,0x00,0x01,0xFD,0xE5,0x36,0xFD,0xE5,0xF0,0x82,0xFD,0xE5,0xFF,0x01,0xFD,0xE5,0xE7,0xFD,0xE4,0x08,0x8F,0x00,0x00,0x00,0x00,0xFE,0xA8,0x20,0x82,0xFE,0xC8,0xFF,0x01,0xFE,0xC8,0xF0,0xFE,0xC8,0x36,0x90,0x00,0x00,0x00,0x01,0xFE,0xC8,0x1B,0xFE,0x46,0x30,0x90,0x00,0x00,0x00,0x01,0xFD,0xE5,0x36,0xFD,0xE5,0xF0,0x82,0xFD,0xE5,0xFF,0x00,0xF5,0xC5,0x1E,0x90,0x00,0x00,0x00,0x03,0xFE,0xA8,0xA7,0xFE,0xC8,0xFF,0xFE,0xC8,0xE6,0xFE,0xC8,0x36,0x90,0x00,0x00,0x00,0x03,0xFE,0xA8,0x67,0xFE,0xC8,0xFD,0xFE,0x05,0xFF,0xFE,0x46,0xA2,0x90,0x00,0x00,0x00,0x03,0xFD,0xE5,0x36,0xFD,0xE5,0xE7,0xFD,0xE5,0xFF,0xFD,0xE5,0xA6,0x92,0x00,0x00,0x00,0x01,0xFE,0xA8,0x1E,0xFE,0xE8,0x08,0x91,0x00,0x00,0x00,0x03,0xFE,0xC8,0xD4,0xFE,0xC8,0xFF,0xFD,0xE5,
+    0xFF,0xFE,0x05,0xF8,0x91,0x00,0x00,0x00,0x01,0xFD,0xE4,0x08,0xF5,0xC5,0x1E,0xA7,0x00,0x00,0x00,0x03,0xFE,0xC8,0xDF,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFB,0xBB,0x00,0x00,0x00,0x03,0xFE,0xC8,0xDF,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFB,0xBB,0x00,0x00,0x00,0x03,0xFE,0xC8,0xDF,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFB,0xBB,0x00,0x00,0x00,0x03,0xFE,0xC8,0xDF,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFB,0xBB,0x00,0x00,0x00,0x03,0xFE,0xC8,0xDF,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFB,0xBB,0x00,0x00,0x00,0x03,0xFE,0xC8,0xDF,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x05,0xFB,0xBB,0x00,0x00,0x00,0x03,0xFE,0xC8,0xCA,0xFE,0xC8,0xFF,0xFD,0xE5,0xFF,0xFE,0x06,0xF4,0xBB,0x00,0x00,0x00,0x03,0xFE,0xA8,0x40,0xFE,0xC8,0xE0,0xFE,0x05,0xFA,0xFE,0x47,0x6E,0x9D,0x00,0x00,0x00,
     };
 const lv_img_dsc_t ui_img_brightness_png = {
    .header.always_zero = 0,
    .header.w = 64,
    .header.h = 64,
    .data_size = sizeof(ui_img_brightness_png_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+   .header.cf = LV_IMG_CF_USER_ENCODED_1,
    .data = ui_img_brightness_png_data};
 
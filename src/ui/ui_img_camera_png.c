@@ -11,28 +11,23 @@
 
 // IMAGE DATA: assets\camera.png
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_camera_png_data[] = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x9D,0x0E,0x24,0xBE,0x59,0x24,0xBE,0x9B,0x24,0xBE,0xCA,0x24,0xBE,0xEA,0x24,0xBE,0xFA,0x24,0xBE,0xFA,0x24,0xBE,0xEA,0x24,0xBE,0xCA,0x24,0xBE,0x9A,0x24,0xBE,0x58,0x24,0xFD,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xBE,0x26,0x24,0xBE,0x9D,0x24,0xBE,0xF5,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xF5,0x24,0xBE,0x9C,0x24,0xDE,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x7F,0x09,0x24,0xBE,0x8C,0x24,0xBE,0xFB,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFA,0x24,0xBE,0x8A,0x24,0xFF,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xDE,0x25,0x24,0xBE,0xD3,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xC7,0x1C,0xDE,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xBE,0x31,0x24,0xBE,0xEA,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xE3,0x24,0xBE,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xDE,0x25,0x24,0xBE,0xEA,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xE3,0x24,0xBE,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xFF,0x08,0x24,0xBE,0xD0,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xDE,0xFF,0x3D,0x3E,0xFF,0x3D,0x3E,0xFF,0x3D,0x3E,0xFF,0x3D,0x3E,0xFF,0x3D,0x3E,0xFF,0x3D,0x3E,0xFF,0x24,0xDE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xCC,0x1C,0x7F,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xBE,0x8C,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x86,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7E,0x1F,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0x81,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x24,0xBE,0x26,0x24,0xBE,0xFB,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0xD7,0x5F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0x7F,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xF3,0x24,0xBE,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xBE,0x9D,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x45,0x3E,0xFF,0x5D,0x9E,0xFF,0x5D,0x9E,0xFF,0x5D,0x9E,0xFF,0x5D,0x9E,0xFF,0x7E,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7E,0x1F,0xFF,0x5D,0x9E,0xFF,0x5D,0x9E,0xFF,0x5D,0x9E,0xFF,0x5D,0x9E,0xFF,0x45,0x3E,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0x96,0x00,0x00,0x00,
-    0x24,0x9D,0x0E,0x24,0xBE,0xF5,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x35,0x1E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x9F,0xFF,0xBE,0xFF,0xFF,0xBF,0x1F,0xFF,0xE7,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x35,0x1E,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xF4,0x24,0xFD,0x0D,0x24,0xBE,0x59,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x45,0x3E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0x7F,0xFF,0x5D,0x9E,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x65,0xBE,0xFF,0xE7,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x45,0x3E,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0x57,
-    0x24,0xBE,0x9B,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x45,0x3E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0x7F,0xFF,0x34,0xFE,0xFF,0x45,0x3E,0xFF,0xB6,0xDF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xB6,0xDF,0xFF,0x3D,0x1E,0xFF,0x34,0xFE,0xFF,0xDF,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x45,0x3E,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0x99,0x24,0xBE,0xCA,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x45,0x3E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4D,0x5E,0xFF,0x4D,0x5E,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0x45,0x3E,0xFF,0x55,0x7E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x45,0x3E,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xC7,
-    0x24,0xBE,0xEB,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x45,0x3E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC7,0x3F,0xFF,0x24,0xBE,0xFF,0xCF,0x3F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC7,0x3F,0xFF,0x24,0xBE,0xFF,0xCF,0x5F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x45,0x3E,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xE9,0x24,0xBE,0xF9,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x45,0x3E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x96,0x7F,0xFF,0x2C,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x2C,0xFE,0xFF,0x9E,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x45,0x3E,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xF8,
-    0x24,0xBE,0xF9,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x45,0x3E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x96,0x7F,0xFF,0x35,0x1E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x34,0xFE,0xFF,0x9E,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x45,0x3E,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xF8,0x24,0xBE,0xEB,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x45,0x3E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xFF,0xFF,0x24,0xBE,0xFF,0xE7,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x9F,0xFF,0x24,0xBE,0xFF,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x45,0x3E,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xE9,
-    0x24,0xBE,0xCA,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x45,0x3E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0x34,0xFE,0xFF,0x75,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6D,0xDE,0xFF,0x34,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x45,0x3E,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xC7,0x24,0xBE,0x9A,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x45,0x3E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xDF,0xFF,0x24,0xBE,0xFF,0x75,0xFE,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0x7E,0x1F,0xFF,0x24,0xBE,0xFF,0xB6,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x45,0x3E,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0x98,
-    0x24,0xBE,0x58,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x45,0x3E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAE,0xBF,0xFF,0x2C,0xDE,0xFF,0x2C,0xDE,0xFF,0x55,0x7E,0xFF,0x55,0x7E,0xFF,0x2C,0xDE,0xFF,0x2C,0xDE,0xFF,0xAE,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x45,0x3E,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0x55,0x2C,0xBD,0x0C,0x24,0xBE,0xF4,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x45,0x3E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xBF,0xFF,0x9E,0x9F,0xFF,0x75,0xDE,0xFF,0x75,0xFF,0xFF,0x9E,0x9F,0xFF,0xEF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x45,0x3E,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xF4,0x2C,0xBD,0x0C,
-    0x00,0x00,0x00,0x24,0xBE,0x9C,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x45,0x3E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x45,0x3E,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0x9A,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xDE,0x25,0x24,0xBE,0xFA,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x2C,0xDE,0xFF,0xCF,0x3F,0xFF,0xE7,0x9F,0xFF,0xE7,0x9F,0xFF,0xE7,0x9F,0xFF,0xE7,0x9F,0xFF,0xE7,0x9F,0xFF,0xE7,0x9F,0xFF,0xE7,0x9F,0xFF,0xE7,0x9F,0xFF,0xE7,0x9F,0xFF,0xE7,0x9F,0xFF,0xE7,0x9F,0xFF,0xE7,0x9F,0xFF,0xE7,0x9F,0xFF,0xE7,0x9F,0xFF,0xE7,0x9F,0xFF,0xE7,0x9F,0xFF,0xE7,0x9F,0xFF,0xE7,0x9F,0xFF,0xC7,0x3F,0xFF,0x2C,0xDE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xF9,0x1C,0xBE,0x22,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xBE,0x8A,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0x87,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xFF,0x08,0x24,0xBE,0xC7,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xC6,0x24,0x9F,0x07,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xBE,0x18,0x24,0xBE,0xE2,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xE5,0x1C,0xBE,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xBE,0x2E,0x24,0xBE,0xE3,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xE2,0x24,0x9E,0x2D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x9E,0x15,0x24,0xBE,0xC1,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xC6,0x24,0xBE,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x9F,0x07,0x24,0xBE,0x81,0x24,0xBE,0xF4,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xF9,0x24,0xBE,0x86,0x24,0x9F,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xBE,0x18,0x24,0xBE,0x96,0x24,0xBE,0xF4,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xF4,0x24,0xBE,0x99,0x1C,0xBE,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0xBD,0x0C,0x24,0xBE,0x57,0x24,0xBE,0x98,0x24,0xBE,0xC8,0x24,0xBE,0xE9,0x24,0xBE,0xF9,0x24,0xBE,0xF9,0x24,0xBE,0xE9,0x24,0xBE,0xC8,0x24,0xBE,0x97,0x24,0xBE,0x56,0x2C,0xBD,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xFF,0x8E,0x18,0x09,0xF7,0x96,0x18,0x1B,0xF7,0x96,0x18,0x22,0xF7,0x96,0x18,0x31,0xF7,0x9A,0x18,0x19,0xEF,0x92,0x21,0x0E,0xF7,0x92,0x21,0x15,0xF7,0x92,0x21,0x2D,0xFF,0x92,0x21,0x07,0xF7,0x96,0x21,0x18,0xF7,0x96,0x21,0x26,0xF7,0x96,0x21,0x2E,0xF7,0x96,0x21,0x55,0xF7,0x96,0x21,0x56,0xF7,0x96,0x21,0x57,0xF7,0x96,0x21,0x58,0xF7,0x96,0x21,0x59,0xF7,0x96,0x21,0x81,0xF7,0x96,0x21,0x86,0xF7,0x96,0x21,0x87,0xF7,0x96,0x21,0x8A,0xF7,0x96,0x21,0x8C,0xF7,0x96,0x21,0x96,0xF7,0x96,0x21,0x97,0xF7,0x96,0x21,0x98,0xF7,0x96,0x21,0x99,0xF7,0x96,0x21,0x9A,0xF7,0x96,0x21,0x9B,0xF7,0x96,0x21,0x9C,0xF7,0x96,0x21,0x9D,0xF7,0x96,0x21,0xC1,0xF7,0x96,0x21,0xC6,0xF7,0x96,0x21,0xC7,0xF7,0x96,0x21,0xC8,0xF7,0x96,0x21,0xCA,0xF7,0x96,0x21,0xCC,0xF7,0x96,0x21,0xD0,0xF7,0x96,0x21,0xD3,0xF7,0x96,0x21,0xE2,0xF7,0x96,0x21,0xE3,0xF7,0x96,0x21,0xE5,0xF7,0x96,0x21,0xE9,0xF7,0x96,0x21,0xEA,0xF7,0x96,0x21,0xEB,0xF7,0x96,0x21,0xF3,0xF7,0x96,0x21,0xF4,0xF7,0x96,0x21,0xF5,
+    0xF7,0x96,0x21,0xF8,0xF7,0x96,0x21,0xF9,0xF7,0x96,0x21,0xFA,0xF7,0x96,0x21,0xFB,0xF7,0x96,0x21,0xFF,0xF7,0x9A,0x21,0x25,0xF7,0x9A,0x21,0xFF,0xEF,0x9E,0x21,0x0D,0xFF,0x9E,0x21,0x08,0xEF,0x96,0x29,0x0C,0xF7,0x9A,0x29,0xFF,0xF7,0x9E,0x29,0xFF,0xF7,0x9E,0x31,0xFF,0xF7,0xA2,0x31,0xFF,0xF7,0xA2,0x39,0xFF,0xF7,0xA6,0x39,0xFF,0xF7,0xA6,0x42,0xFF,0xF7,0xAA,0x4A,0xFF,0xF7,0xAE,0x52,0xFF,0xF7,0xB2,0x5A,0xFF,0xF7,0xB6,0x63,0xFF,0xF7,0xBA,0x6B,0xFF,0xF7,0xBA,0x73,0xFF,0xF7,0xBE,0x73,0xFF,0xFF,0xBE,0x73,0xFF,0xFF,0xC3,0x7B,0xFF,0xFF,0xC3,0x84,0xFF,0xFF,0xCF,0x94,0xFF,0xFF,0xCF,0x9C,0xFF,0xFF,0xD3,0x9C,0xFF,0xFF,0xD7,0xAD,0xFF,0xFF,0xDB,0xB5,0xFF,0xFF,0xDF,0xB5,0xFF,0xFF,0xDF,0xBD,0xFF,0xFF,0xE3,0xBD,0xFF,0xFF,0xE7,0xC6,0xFF,0xFF,0xE7,0xCE,0xFF,0xFF,0xEB,0xCE,0xFF,0xFF,0xEB,0xD6,0xFF,0xFF,0xEF,0xD6,0xFF,0xFF,0xEF,0xDE,0xFF,0xFF,0xF3,0xE7,0xFF,0xFF,0xF7,0xEF,0xFF,0xFF,0xFB,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x11,0x1C,0x23,0x2B,0x32,0x32,0x2B,0x23,0x1B,0x10,0x37,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x1E,0x2F,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x2F,0x1D,0x35,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x16,0x33,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x32,0x15,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0x26,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x21,0x05,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x04,0x2B,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x28,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0x2B,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x28,0x0A,0x00,0x00,0x00,0x00,0x00,0x38,0x25,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x36,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x36,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x24,0x01,0x00,0x00,0x00,0x00,0x16,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x4A,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x49,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x12,0x00,0x00,0x00,0x0B,0x33,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x56,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x57,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x2D,0x0A,0x00,0x00,0x1E,0x34,0x34,0x34,0x34,0x40,0x43,0x43,0x43,0x43,0x49,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x49,0x43,0x43,0x43,0x43,0x40,0x34,0x34,0x34,0x34,0x17,0x00,
+    0x06,0x2F,0x34,0x34,0x34,0x3D,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x59,0x51,0x52,0x59,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x3D,0x34,0x34,0x34,0x2E,0x37,0x11,0x34,0x34,0x34,0x34,0x40,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x58,0x43,0x34,0x34,0x34,0x34,0x44,0x59,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x40,0x34,0x34,0x34,0x34,0x0F,0x1C,0x34,0x34,0x34,0x34,0x40,0x5C,0x5C,0x5C,0x5C,0x5C,0x58,0x3C,0x40,0x4F,0x5A,0x5A,0x4F,0x3E,0x3C,0x58,0x5C,0x5C,0x5C,0x5C,0x5C,0x40,0x34,0x34,0x34,0x34,0x1A,0x23,0x34,0x34,0x34,0x34,0x40,0x5C,0x5C,0x5C,0x5C,0x5C,0x41,0x41,0x5B,0x5C,0x5C,0x5C,0x5C,0x5B,0x40,0x42,0x5C,0x5C,0x5C,0x5C,0x5C,0x40,0x34,0x34,0x34,0x34,0x21,0x2C,0x34,0x34,0x34,0x34,0x40,0x5C,0x5C,0x5C,0x5C,0x53,0x34,0x54,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x53,0x34,0x55,0x5C,0x5C,0x5C,0x5C,0x40,0x34,0x34,0x34,0x34,0x2A,0x31,0x34,0x34,0x34,0x34,0x40,0x5C,0x5C,0x5C,0x5C,0x4B,0x3A,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x3B,0x4D,0x5C,0x5C,0x5C,0x5C,0x40,0x34,0x34,0x34,0x34,0x30,
+    0x31,0x34,0x34,0x34,0x34,0x40,0x5C,0x5C,0x5C,0x5C,0x4B,0x3D,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x3C,0x4C,0x5C,0x5C,0x5C,0x5C,0x40,0x34,0x34,0x34,0x34,0x30,0x2C,0x34,0x34,0x34,0x34,0x40,0x5C,0x5C,0x5C,0x5C,0x50,0x34,0x59,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x59,0x34,0x51,0x5C,0x5C,0x5C,0x5C,0x40,0x34,0x34,0x34,0x34,0x2A,0x23,0x34,0x34,0x34,0x34,0x40,0x5C,0x5C,0x5C,0x5C,0x5B,0x3C,0x48,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x45,0x3C,0x5C,0x5C,0x5C,0x5C,0x5C,0x40,0x34,0x34,0x34,0x34,0x21,0x1B,0x34,0x34,0x34,0x34,0x40,0x5C,0x5C,0x5C,0x5C,0x5C,0x4F,0x34,0x47,0x5B,0x5C,0x5C,0x5B,0x49,0x34,0x4F,0x5C,0x5C,0x5C,0x5C,0x5C,0x40,0x34,0x34,0x34,0x34,0x19,0x10,0x34,0x34,0x34,0x34,0x40,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x4E,0x3A,0x3A,0x42,0x42,0x3A,0x3A,0x4E,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x40,0x34,0x34,0x34,0x34,0x0D,0x39,0x2E,0x34,0x34,0x34,0x40,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x5A,0x4D,0x46,0x48,0x4D,0x5A,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x40,0x34,0x34,0x34,0x2E,0x39,
+    0x00,0x1D,0x34,0x34,0x34,0x40,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x5C,0x40,0x34,0x34,0x34,0x1B,0x00,0x00,0x35,0x32,0x34,0x34,0x3A,0x54,0x59,0x59,0x59,0x59,0x59,0x59,0x59,0x59,0x59,0x59,0x59,0x59,0x59,0x59,0x59,0x59,0x59,0x59,0x53,0x3A,0x34,0x34,0x31,0x03,0x00,0x00,0x00,0x15,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x14,0x00,0x00,0x00,0x00,0x38,0x21,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x20,0x09,0x00,0x00,0x00,0x00,0x00,0x0A,0x27,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x29,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x28,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x27,0x08,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x07,0x1F,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x20,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x12,0x2E,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x31,0x13,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x17,0x2E,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x2E,0x1A,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0x0F,0x19,0x22,0x2A,0x31,0x31,0x2A,0x22,0x18,0x0E,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
     };
 const lv_img_dsc_t ui_img_camera_png = {
    .header.always_zero = 0,
    .header.w = 32,
    .header.h = 32,
    .data_size = sizeof(ui_img_camera_png_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+   .header.cf = LV_IMG_CF_INDEXED_8BIT,
    .data = ui_img_camera_png_data};
 
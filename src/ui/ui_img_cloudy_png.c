@@ -10,29 +10,19 @@
 #endif
 
 // IMAGE DATA: assets\cloudy.png
+// Run length encoded LV_IMG_CF_TRUE_COLOR_ALPHA, decoded by src/img_cache.cpp
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_cloudy_png_data[] = {
-0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFE,0x63,0x6B,0xFE,0x84,0x5C,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFE,0x64,0x90,0xFE,0x64,0x80,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFE,0x66,0x05,0xFE,0x83,0x21,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFE,0x64,0x85,0xFE,0x64,0x75,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFE,0x64,0x24,0xFD,0x40,0x03,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFE,0x84,0x2C,0xFE,0x84,0xF1,0xFE,0x83,0x42,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFE,0x23,0x09,0xFE,0xA5,0x06,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFE,0x84,0x4E,0xFE,0x84,0xF1,0xFE,0x83,0x23,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFE,0x84,0x54,0xFE,0x84,0xF1,0xFE,0x83,0x42,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFE,0x63,0x0A,0xFE,0xE4,0x08,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFE,0x84,0x4E,0xFE,0x84,0xF1,0xFE,0x84,0x48,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFE,0x84,0x54,0xFE,0x84,0xB0,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFE,0x83,0x41,0xFE,0x84,0x9C,0xFE,0x64,0xD1,0xFE,0x84,0xFC,0xFE,0x83,0xFB,0xFE,0x84,0xCE,0xFE,0x84,0x99,0xFE,0x63,0x39,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFE,0x84,0xBD,0xFE,0x84,0x48,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFE,0xC4,0x0D,0xFE,0x84,0x99,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFD,0xFE,0x84,0x8E,0xFE,0x23,0x09,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFE,0x64,0x0F,0xFE,0x64,0xDC,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xD2,0xFE,0x23,0x09,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFE,0x84,0x9F,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0x8F,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFE,0x63,0x4B,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFE,0xFE,0x84,0x3D,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFE,0x84,0xA8,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0x98,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFE,0x83,0xDB,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x83,0xCB,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xA6,0x9E,0x34,0xAE,0x9C,0x68,0xCE,0x91,0xFF,0xDE,0x8D,0xFF,0xF6,0x86,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xF8,0xFE,0x66,0x05,0xFE,0xA5,0x06,0xFE,0x84,0x7D,0xFE,0x84,0x88,0xFE,0x64,0x5F,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xA6,0xBF,0x2B,0xA6,0x9E,0xC1,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xC6,0x95,0xFF,0xFE,0x85,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xF9,0xFE,0xA5,0x06,0xFE,0x23,0x09,0xFE,0x64,0x85,0xFE,0x64,0x90,0xFE,0x84,0x69,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xA6,0x9F,0x4B,0xA6,0xBE,0xFB,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xAE,0x9B,0xFF,0xF6,0x87,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xCD,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xA6,0xDE,0x1A,0xA6,0xBE,0xEB,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xBE,0x97,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x83,0x9A,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xA6,0xBE,0x99,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xD6,0x91,0xFF,0xD6,0x91,0xFF,0xC6,0x95,0xFF,0xD6,0x91,0xFF,0xEE,0x89,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFE,0xFE,0x83,0x41,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xA6,0xBE,0xDA,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xCE,0x92,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0xFF,0xFE,0x84,0x95,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xAE,0xBE,0x12,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xCE,0x92,0xFF,0xFE,0x84,0xD8,0xFE,0x82,0x0B,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xAD,0x5F,0x03,0xA6,0xBE,0xFA,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xF9,0xCE,0xB3,0x19,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xA6,0xBE,0xD8,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xE3,0xA6,0xBE,0xE5,0xA6,0x9E,0xBB,0xA6,0xBE,0x85,0x9E,0x7E,0x15,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x9E,0xFF,0x08,0xA6,0x9F,0x69,0xA6,0xBE,0xA9,0xA6,0xBE,0xF4,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xE9,0xA6,0xBF,0x4D,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xA6,0xBF,0x2C,0xA6,0x9E,0xD3,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xF9,0xA6,0xBF,0x2C,0xFF,0xFF,0x00,0xAE,0xBF,0x0C,0xA6,0xBE,0xE1,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0x9F,0xCD,0xFF,0xFF,0x00,
-    0xA6,0xBF,0x89,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0x9E,0xBE,0x20,0xA6,0xBE,0xCA,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0x54,
-    0xA6,0xBE,0xF2,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0x9E,0x57,0xA6,0xBE,0xD2,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0x9F,0x23,
-    0xA6,0xBE,0x99,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xD5,0xFF,0xFF,0x00,0xA6,0x9E,0x1B,0xA6,0xBE,0xED,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFC,0xA6,0xBE,0x35,0xFF,0xFF,0x00,
-    0xFF,0xFF,0x00,0xA6,0xBF,0x47,0xA6,0xBF,0xEE,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xF1,0xA6,0xBE,0x5A,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xA6,0xDE,0x1A,0xA6,0xBE,0x9B,0xA6,0xBE,0xD2,0xA6,0xBE,0xFB,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xFF,0xA6,0xBE,0xF8,0xA6,0xBE,0xCB,0xA6,0xBE,0x95,0xA6,0xBE,0x1E,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,
+    0x91,0x00,0x00,0x00,0x01,0xFE,0x63,0x6B,0xFE,0x84,0x5C,0x9D,0x00,0x00,0x00,0x01,0xFE,0x64,0x90,0xFE,0x64,0x80,0x93,0x00,0x00,0x00,0x01,0xFE,0x66,0x05,0xFE,0x83,0x21,0x87,0x00,0x00,0x00,0x01,0xFE,0x64,0x85,0xFE,0x64,0x75,0x87,0x00,0x00,0x00,0x01,0xFE,0x64,0x24,0xFD,0x40,0x03,0x89,0x00,0x00,0x00,0x02,0xFE,0x84,0x2C,0xFE,0x84,0xF1,0xFE,0x83,0x42,0x86,0x00,0x00,0x00,0x01,0xFE,0x23,0x09,0xFE,0xA5,0x06,0x86,0x00,0x00,0x00,0x02,0xFE,0x84,0x4E,0xFE,0x84,0xF1,0xFE,0x83,0x23,0x8A,0x00,0x00,0x00,0x02,0xFE,0x84,0x54,0xFE,0x84,0xF1,0xFE,0x83,0x42,0x85,0x00,0x00,0x00,0x01,0xFE,0x63,0x0A,0xFE,0xE4,0x08,0x85,0x00,0x00,0x00,0x02,0xFE,0x84,0x4E,0xFE,0x84,0xF1,0xFE,0x84,0x48,0x8C,0x00,0x00,0x00,0x01,0xFE,0x84,0x54,0xFE,0x84,0xB0,0x82,0x00,0x00,0x00,0x07,0xFE,0x83,0x41,0xFE,0x84,0x9C,0xFE,0x64,0xD1,0xFE,0x84,0xFC,0xFE,0x83,0xFB,0xFE,0x84,0xCE,0xFE,0x84,0x99,0xFE,0x63,0x39,0x82,0x00,0x00,0x00,0x01,0xFE,0x84,0xBD,0xFE,0x84,0x48,0x90,0x00,0x00,0x00,0x01,0xFE,0xC4,0x0D,
+    0xFE,0x84,0x99,0x86,0xFE,0x84,0xFF,0x02,0xFE,0x84,0xFD,0xFE,0x84,0x8E,0xFE,0x23,0x09,0x92,0x00,0x00,0x00,0x01,0xFE,0x64,0x0F,0xFE,0x64,0xDC,0x89,0xFE,0x84,0xFF,0x01,0xFE,0x84,0xD2,0xFE,0x23,0x09,0x91,0x00,0x00,0x00,0x00,0xFE,0x84,0x9F,0x8B,0xFE,0x84,0xFF,0x00,0xFE,0x84,0x8F,0x90,0x00,0x00,0x00,0x00,0xFE,0x63,0x4B,0x8C,0xFE,0x84,0xFF,0x01,0xFE,0x84,0xFE,0xFE,0x84,0x3D,0x8F,0x00,0x00,0x00,0x00,0xFE,0x84,0xA8,0x8D,0xFE,0x84,0xFF,0x00,0xFE,0x84,0x98,0x8F,0x00,0x00,0x00,0x00,0xFE,0x83,0xDB,0x8D,0xFE,0x84,0xFF,0x00,0xFE,0x83,0xCB,0x8D,0x00,0x00,0x00,0x04,0xA6,0x9E,0x34,0xAE,0x9C,0x68,0xCE,0x91,0xFF,0xDE,0x8D,0xFF,0xF6,0x86,0xFF,0x8B,0xFE,0x84,0xFF,0x05,0xFE,0x84,0xF8,0xFE,0x66,0x05,0xFE,0xA5,0x06,0xFE,0x84,0x7D,0xFE,0x84,0x88,0xFE,0x64,0x5F,0x86,0x00,0x00,0x00,0x01,0xA6,0xBF,0x2B,0xA6,0x9E,0xC1,0x84,0xA6,0xBE,0xFF,0x01,0xC6,0x95,0xFF,0xFE,0x85,0xFF,0x89,0xFE,0x84,0xFF,0x05,0xFE,0x84,0xF9,0xFE,0xA5,0x06,0xFE,0x23,0x09,0xFE,0x64,0x85,0xFE,0x64,0x90,0xFE,
+    0x84,0x69,0x85,0x00,0x00,0x00,0x01,0xA6,0x9F,0x4B,0xA6,0xBE,0xFB,0x86,0xA6,0xBE,0xFF,0x01,0xAE,0x9B,0xFF,0xF6,0x87,0xFF,0x88,0xFE,0x84,0xFF,0x00,0xFE,0x84,0xCD,0x89,0x00,0x00,0x00,0x01,0xA6,0xDE,0x1A,0xA6,0xBE,0xEB,0x88,0xA6,0xBE,0xFF,0x00,0xBE,0x97,0xFF,0x88,0xFE,0x84,0xFF,0x00,0xFE,0x83,0x9A,0x89,0x00,0x00,0x00,0x00,0xA6,0xBE,0x99,0x8A,0xA6,0xBE,0xFF,0x81,0xD6,0x91,0xFF,0x02,0xC6,0x95,0xFF,0xD6,0x91,0xFF,0xEE,0x89,0xFF,0x82,0xFE,0x84,0xFF,0x01,0xFE,0x84,0xFE,0xFE,0x83,0x41,0x89,0x00,0x00,0x00,0x00,0xA6,0xBE,0xDA,0x8F,0xA6,0xBE,0xFF,0x00,0xCE,0x92,0xFF,0x81,0xFE,0x84,0xFF,0x00,0xFE,0x84,0x95,0x89,0x00,0x00,0x00,0x00,0xAE,0xBE,0x12,0x91,0xA6,0xBE,0xFF,0x02,0xCE,0x92,0xFF,0xFE,0x84,0xD8,0xFE,0x82,0x0B,0x89,0x00,0x00,0x00,0x01,0xAD,0x5F,0x03,0xA6,0xBE,0xFA,0x90,0xA6,0xBE,0xFF,0x01,0xA6,0xBE,0xF9,0xCE,0xB3,0x19,0x8B,0x00,0x00,0x00,0x00,0xA6,0xBE,0xD8,0x91,0xA6,0xBE,0xFF,0x04,0xA6,0xBE,0xE3,0xA6,0xBE,0xE5,0xA6,0x9E,0xBB,0xA6,0xBE,0x85,0x9E,0x7E,0x15,
+    0x84,0x00,0x00,0x00,0x03,0x9E,0xFF,0x08,0xA6,0x9F,0x69,0xA6,0xBE,0xA9,0xA6,0xBE,0xF4,0x95,0xA6,0xBE,0xFF,0x01,0xA6,0xBE,0xE9,0xA6,0xBF,0x4D,0x82,0x00,0x00,0x00,0x01,0xA6,0xBF,0x2C,0xA6,0x9E,0xD3,0x99,0xA6,0xBE,0xFF,0x04,0xA6,0xBE,0xF9,0xA6,0xBF,0x2C,0x00,0x00,0x00,0xAE,0xBF,0x0C,0xA6,0xBE,0xE1,0x9B,0xA6,0xBE,0xFF,0x02,0xA6,0x9F,0xCD,0x00,0x00,0x00,0xA6,0xBF,0x89,0x9D,0xA6,0xBE,0xFF,0x01,0x9E,0xBE,0x20,0xA6,0xBE,0xCA,0x9D,0xA6,0xBE,0xFF,0x01,0xA6,0xBE,0x54,0xA6,0xBE,0xF2,0x9D,0xA6,0xBE,0xFF,0x01,0xA6,0x9E,0x57,0xA6,0xBE,0xD2,0x9D,0xA6,0xBE,0xFF,0x01,0xA6,0x9F,0x23,0xA6,0xBE,0x99,0x9C,0xA6,0xBE,0xFF,0x03,0xA6,0xBE,0xD5,0x00,0x00,0x00,0xA6,0x9E,0x1B,0xA6,0xBE,0xED,0x9A,0xA6,0xBE,0xFF,0x01,0xA6,0xBE,0xFC,0xA6,0xBE,0x35,0x81,0x00,0x00,0x00,0x01,0xA6,0xBF,0x47,0xA6,0xBF,0xEE,0x98,0xA6,0xBE,0xFF,0x01,0xA6,0xBE,0xF1,0xA6,0xBE,0x5A,0x83,0x00,0x00,0x00,0x03,0xA6,0xDE,0x1A,0xA6,0xBE,0x9B,0xA6,0xBE,0xD2,0xA6,0xBE,0xFB,0x92,0xA6,0xBE,0xFF,0x03,0xA6,0xBE,0xF8,
+    0xA6,0xBE,0xCB,0xA6,0xBE,0x95,0xA6,0xBE,0x1E,0x82,0x00,0x00,0x00,
     };
 const lv_img_dsc_t ui_img_cloudy_png = {
    .header.always_zero = 0,
    .header.w = 32,
    .header.h = 32,
    .data_size = sizeof(ui_img_cloudy_png_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+   .header.cf = LV_IMG_CF_USER_ENCODED_1,
    .data = ui_img_cloudy_png_data};
 
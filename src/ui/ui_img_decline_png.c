@@ -10,77 +10,25 @@
 #endif
 
 // IMAGE DATA: assets\decline.png
+// Run length encoded LV_IMG_CF_TRUE_COLOR_ALPHA, decoded by src/img_cache.cpp
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_decline_png_data[] = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDA,0x25,0x16,0xDA,0x05,0x54,0xDA,0x25,0x7F,0xDA,0x25,0xA7,0xDA,0x25,0xCD,0xDA,0x25,0xDE,0xDA,0x05,0xEE,0xDA,0x25,0xFA,0xDA,0x25,0xFA,0xDA,0x05,0xEE,0xDA,0x25,0xDE,0xDA,0x25,0xCD,0xDA,0x05,0xA6,0xDA,0x25,0x7E,0xDA,0x05,0x53,0xDA,0x25,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDA,0x05,0x35,0xDA,0x25,0x8E,0xDA,0x05,0xD3,0xDA,0x25,0xFE,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFE,0xDA,0x05,0xD3,0xDA,0x25,0x8D,0xDA,0x24,0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDA,0x44,0x0E,0xDA,0x25,0x74,0xDA,0x25,0xD6,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xD5,0xDA,0x25,0x74,0xD9,0xC4,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0x25,0x12,0xDA,0x05,0x81,0xDA,0x05,0xEE,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x05,0xEE,0xDA,0x05,0x80,0xE2,0x45,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0xDA,0x25,0x5E,0xDA,0x05,0xEA,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xED,0xDA,0x25,0x6F,0xFB,0xE0,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDA,0x25,0x24,0xDA,0x25,0xC5,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x05,0xC4,0xDA,0x05,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDA,0x25,0x51,0xDA,0x25,0xEF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xF2,0xDA,0x05,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0xE0,0x02,0xDA,0x25,0x8F,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0x8D,0xFB,0xE0,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD2,0xA5,0x06,0xDA,0x05,0xA6,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xA5,0xC9,0x86,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD2,0xA5,0x06,0xDA,0x05,0xB5,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xB4,0xC9,0x86,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0xDA,0x25,0xA1,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x05,0xA6,0xFB,0xE0,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDA,0x25,0x8F,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0x8B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDA,0x25,0x55,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDA,0x05,0x23,0xDA,0x25,0xF0,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xF0,0xDA,0x04,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0xDA,0x25,0xC5,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xE3,0xCC,0xFF,0xF7,0x3C,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0x9E,0xFF,0xED,0x94,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xC2,0xF8,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDA,0x25,0x64,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xF7,0x3C,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xE3,0xAC,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x05,0x5F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0x25,0x12,0xDA,0x25,0xEB,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xFF,0xBE,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xEC,0x6F,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xE9,0xD9,0xE5,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDA,0x25,0x82,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xFF,0x7D,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xEC,0xD1,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xDA,0x44,0x0E,0xDA,0x05,0xEE,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xF7,0x3C,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xED,0x32,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xED,0xD9,0xC4,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xDA,0x25,0x74,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xF6,0xDA,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xF6,0x16,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x05,0x72,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xDA,0x05,0xD3,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xF5,0xF6,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xF6,0xFB,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xD5,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xDA,0x05,0x35,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xED,0x12,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xE2,0x87,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x05,0x31,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xDA,0x25,0x8E,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xE4,0x2E,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xE4,0x2E,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0x8B,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xDA,0x25,0xD4,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xE2,0xE8,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xF5,0xF6,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xCF,0x00,0x00,0x00,
-    0xDA,0x25,0x16,0xDA,0x25,0xFE,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xF7,0x3C,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xBE,0xFF,0xE2,0xA7,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFE,0xD9,0xE4,0x14,
-    0xDA,0x05,0x54,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xED,0xB5,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xEC,0xF2,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0x52,
-    0xDA,0x05,0x80,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xE3,0xED,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xF6,0x99,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x05,0x7D,
-    0xDA,0x25,0xA7,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x45,0xFF,0xFF,0x7D,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xED,0x74,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xA4,
-    0xDA,0x05,0xCC,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xED,0x74,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0x9E,0xFF,0xED,0x33,0xFF,0xDA,0x46,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xCA,
-    0xDA,0x25,0xE0,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xE3,0x2A,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0x9E,0xFF,0xED,0x12,0xFF,0xE2,0x87,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xDE,
-    0xDA,0x25,0xED,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xF6,0x37,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xBE,0xFF,0xE3,0x09,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xEB,
-    0xDA,0x05,0xF9,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xE3,0x6A,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xF6,0x99,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xF8,
-    0xDA,0x05,0xF9,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xF6,0x17,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xEC,0xB0,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xF8,
-    0xDA,0x25,0xED,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xE2,0xC8,0xFF,0xFF,0x9E,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xBE,0xFF,0xE3,0xAC,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xEB,
-    0xDA,0x25,0xE0,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xEC,0xF2,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0x7D,0xFF,0xE3,0x29,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xDE,
-    0xDA,0x05,0xCC,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x45,0xFF,0xF6,0x99,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xF7,0x3C,0xFF,0xDA,0xA7,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xCA,
-    0xDA,0x05,0xA6,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xE2,0xC8,0xFF,0xFF,0x7D,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xF7,0x3C,0xFF,0xE3,0x09,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x46,0xFF,0xED,0x74,0xFF,0xF6,0x99,0xFF,0xEC,0xF2,0xFF,0xDA,0xA7,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x05,0xA3,
-    0xDA,0x25,0x7F,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xE3,0xED,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0x7D,0xFF,0xE3,0x8B,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xED,0x33,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xBE,0xFF,0xF6,0x16,0xFF,0xEC,0x2E,0xFF,0xE2,0xA7,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0x7C,
-    0xDA,0x05,0x53,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xEC,0x90,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xBE,0xFF,0xEC,0xB0,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xE2,0x87,0xFF,0xFF,0x9E,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xF7,0x1B,0xFF,0xF6,0x17,0xFF,0xED,0x33,0xFF,0xEC,0xD1,0xFF,0xEC,0x6F,0xFF,0xE3,0xAC,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0x51,
-    0xDA,0x25,0x16,0xDA,0x25,0xFE,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xED,0x12,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xF6,0x99,0xFF,0xE2,0xE9,0xFF,0xED,0x12,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xED,0x94,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x05,0xFD,0xD9,0xE4,0x14,
-    0x00,0x00,0x00,0xDA,0x05,0xD3,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xED,0x12,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0x9E,0xFF,0xFF,0x9E,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0x9E,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xCE,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xDA,0x25,0x8E,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xEC,0x90,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0x8A,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xDA,0x24,0x34,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xE3,0xCD,0xFF,0xFF,0x7D,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0x30,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xDA,0x05,0xD3,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xE2,0xC8,0xFF,0xF6,0x99,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xD5,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xDA,0x25,0x74,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x45,0xFF,0xEC,0xF1,0xFF,0xFF,0x9E,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x05,0x72,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xD9,0xC4,0x0D,0xDA,0x05,0xEE,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xE2,0xC8,0xFF,0xF6,0x37,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xED,0xD9,0xC4,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDA,0x05,0x81,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xE3,0x2A,0xFF,0xF5,0xF6,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x05,0x7D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0x45,0x11,0xDA,0x05,0xEA,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xE3,0x2A,0xFF,0xED,0x74,0xFF,0xFF,0x7D,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xE8,0xDA,0x24,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDA,0x05,0x62,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x45,0xFF,0xE3,0xED,0xFF,0xED,0xB5,0xFF,0xF7,0x3C,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xF7,0x3C,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0x5D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0xDA,0x05,0xC4,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xE2,0xE8,0xFF,0xE4,0x2E,0xFF,0xED,0x12,0xFF,0xF5,0xF6,0xFF,0xF6,0xBA,0xFF,0xF7,0x1B,0xFF,0xFF,0x7D,0xFF,0xFF,0xBE,0xFF,0xF7,0x3C,0xFF,0xE3,0xCC,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x05,0xC1,0xF8,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDA,0x05,0x23,0xDA,0x25,0xF0,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xEF,0xDA,0x04,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDA,0x05,0x54,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDA,0x25,0x8D,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0xDA,0x05,0x9F,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xA5,0xFB,0xE0,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC9,0x86,0x05,0xDA,0x05,0xB5,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xB3,0xC9,0x86,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xB9,0xE7,0x04,0xDA,0x25,0x9D,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x05,0xA3,0xC9,0x86,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0xDA,0x25,0x8B,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFE,0xDA,0x25,0x89,0xF8,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDA,0x05,0x50,0xDA,0x05,0xEE,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x05,0xF1,0xDA,0x25,0x56,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDA,0x04,0x22,0xDA,0x25,0xC2,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x05,0xC1,0xE2,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0xDA,0x25,0x5E,0xDA,0x25,0xE9,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xED,0xDA,0x05,0x66,0xF8,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD9,0xE5,0x10,0xDA,0x25,0x7E,0xDA,0x25,0xED,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xEC,0xDA,0x05,0x7D,0xDA,0x24,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD1,0xE5,0x0C,0xDA,0x05,0x72,0xDA,0x25,0xD4,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x05,0xD3,0xDA,0x05,0x71,0xD1,0xE5,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDA,0x05,0x31,0xDA,0x25,0x8B,0xDA,0x05,0xD0,0xDA,0x05,0xFD,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x25,0xFF,0xDA,0x05,0xFD,0xDA,0x25,0xCF,0xDA,0x25,0x8A,0xDA,0x25,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD9,0xE4,0x14,0xDA,0x25,0x52,0xDA,0x25,0x7C,0xDA,0x25,0xA5,0xDA,0x25,0xCB,0xDA,0x25,0xDD,0xDA,0x25,0xED,0xDA,0x05,0xF9,0xDA,0x05,0xF9,0xDA,0x25,0xED,0xDA,0x25,0xDD,0xDA,0x25,0xCB,0xDA,0x25,0xA4,0xDA,0x25,0x7C,0xDA,0x25,0x51,0xD9,0xE4,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x97,0x00,0x00,0x00,0x06,0xDA,0x25,0x16,0xDA,0x05,0x54,0xDA,0x25,0x7F,0xDA,0x25,0xA7,0xDA,0x25,0xCD,0xDA,0x25,0xDE,0xDA,0x05,0xEE,0x81,0xDA,0x25,0xFA,0x06,0xDA,0x05,0xEE,0xDA,0x25,0xDE,0xDA,0x25,0xCD,0xDA,0x05,0xA6,0xDA,0x25,0x7E,0xDA,0x05,0x53,0xDA,0x25,0x16,0xAC,0x00,0x00,0x00,0x03,0xDA,0x05,0x35,0xDA,0x25,0x8E,0xDA,0x05,0xD3,0xDA,0x25,0xFE,0x8D,0xDA,0x25,0xFF,0x03,0xDA,0x25,0xFE,0xDA,0x05,0xD3,0xDA,0x25,0x8D,0xDA,0x24,0x34,0xA6,0x00,0x00,0x00,0x02,0xDA,0x44,0x0E,0xDA,0x25,0x74,0xDA,0x25,0xD6,0x95,0xDA,0x25,0xFF,0x02,0xDA,0x25,0xD5,0xDA,0x25,0x74,0xD9,0xC4,0x0D,0xA1,0x00,0x00,0x00,0x02,0xE2,0x25,0x12,0xDA,0x05,0x81,0xDA,0x05,0xEE,0x99,0xDA,0x25,0xFF,0x02,0xDA,0x05,0xEE,0xDA,0x05,0x80,0xE2,0x45,0x11,0x9D,0x00,0x00,0x00,0x02,0xF8,0x00,0x01,0xDA,0x25,0x5E,0xDA,0x05,0xEA,0x9D,0xDA,0x25,0xFF,0x02,0xDA,0x25,0xED,0xDA,0x25,0x6F,0xFB,0xE0,0x02,0x9A,0x00,0x00,0x00,0x01,0xDA,0x25,0x24,0xDA,0x25,0xC5,0xA1,0xDA,0x25,0xFF,0x01,0xDA,0x05,0xC4,0xDA,0x05,0x23,
+    0x98,0x00,0x00,0x00,0x01,0xDA,0x25,0x51,0xDA,0x25,0xEF,0xA3,0xDA,0x25,0xFF,0x01,0xDA,0x25,0xF2,0xDA,0x05,0x58,0x95,0x00,0x00,0x00,0x01,0xFB,0xE0,0x02,0xDA,0x25,0x8F,0xA7,0xDA,0x25,0xFF,0x01,0xDA,0x25,0x8D,0xFB,0xE0,0x02,0x92,0x00,0x00,0x00,0x01,0xD2,0xA5,0x06,0xDA,0x05,0xA6,0xA9,0xDA,0x25,0xFF,0x01,0xDA,0x25,0xA5,0xC9,0x86,0x05,0x90,0x00,0x00,0x00,0x01,0xD2,0xA5,0x06,0xDA,0x05,0xB5,0xAB,0xDA,0x25,0xFF,0x01,0xDA,0x25,0xB4,0xC9,0x86,0x05,0x8E,0x00,0x00,0x00,0x01,0xF8,0x00,0x01,0xDA,0x25,0xA1,0xAD,0xDA,0x25,0xFF,0x01,0xDA,0x05,0xA6,0xFB,0xE0,0x02,0x8D,0x00,0x00,0x00,0x00,0xDA,0x25,0x8F,0xAF,0xDA,0x25,0xFF,0x00,0xDA,0x25,0x8B,0x8C,0x00,0x00,0x00,0x00,0xDA,0x25,0x55,0xB1,0xDA,0x25,0xFF,0x00,0xDA,0x25,0x59,0x8A,0x00,0x00,0x00,0x01,0xDA,0x05,0x23,0xDA,0x25,0xF0,0xB1,0xDA,0x25,0xFF,0x01,0xDA,0x25,0xF0,0xDA,0x04,0x22,0x88,0x00,0x00,0x00,0x01,0xF8,0x00,0x01,0xDA,0x25,0xC5,0x87,0xDA,0x25,0xFF,0x01,0xE3,0xCC,0xFF,0xF7,0x3C,0xFF,0x86,0xFF,0xDF,0xFF,0x01,0xFF,
+    0x9E,0xFF,0xED,0x94,0xFF,0xA0,0xDA,0x25,0xFF,0x01,0xDA,0x25,0xC2,0xF8,0x00,0x01,0x87,0x00,0x00,0x00,0x00,0xDA,0x25,0x64,0x88,0xDA,0x25,0xFF,0x00,0xF7,0x3C,0xFF,0x89,0xFF,0xDF,0xFF,0x00,0xE3,0xAC,0xFF,0xA0,0xDA,0x25,0xFF,0x00,0xDA,0x05,0x5F,0x86,0x00,0x00,0x00,0x01,0xE2,0x25,0x12,0xDA,0x25,0xEB,0x88,0xDA,0x25,0xFF,0x00,0xFF,0xBE,0xFF,0x89,0xFF,0xDF,0xFF,0x00,0xEC,0x6F,0xFF,0xA0,0xDA,0x25,0xFF,0x01,0xDA,0x25,0xE9,0xD9,0xE5,0x10,0x85,0x00,0x00,0x00,0x00,0xDA,0x25,0x82,0x89,0xDA,0x25,0xFF,0x00,0xFF,0x7D,0xFF,0x89,0xFF,0xDF,0xFF,0x00,0xEC,0xD1,0xFF,0xA1,0xDA,0x25,0xFF,0x00,0xDA,0x25,0x7E,0x84,0x00,0x00,0x00,0x01,0xDA,0x44,0x0E,0xDA,0x05,0xEE,0x89,0xDA,0x25,0xFF,0x00,0xF7,0x3C,0xFF,0x89,0xFF,0xDF,0xFF,0x00,0xED,0x32,0xFF,0xA1,0xDA,0x25,0xFF,0x01,0xDA,0x25,0xED,0xD9,0xC4,0x0D,0x83,0x00,0x00,0x00,0x00,0xDA,0x25,0x74,0x8A,0xDA,0x25,0xFF,0x00,0xF6,0xDA,0xFF,0x89,0xFF,0xDF,0xFF,0x00,0xF6,0x16,0xFF,0xA2,0xDA,0x25,0xFF,0x00,0xDA,0x05,0x72,0x83,0x00,0x00,0x00,
+    0x00,0xDA,0x05,0xD3,0x8A,0xDA,0x25,0xFF,0x00,0xF5,0xF6,0xFF,0x89,0xFF,0xDF,0xFF,0x00,0xF6,0xFB,0xFF,0xA2,0xDA,0x25,0xFF,0x00,0xDA,0x25,0xD5,0x82,0x00,0x00,0x00,0x00,0xDA,0x05,0x35,0x8B,0xDA,0x25,0xFF,0x00,0xED,0x12,0xFF,0x8A,0xFF,0xDF,0xFF,0x00,0xE2,0x87,0xFF,0xA2,0xDA,0x25,0xFF,0x00,0xDA,0x05,0x31,0x81,0x00,0x00,0x00,0x00,0xDA,0x25,0x8E,0x8B,0xDA,0x25,0xFF,0x00,0xE4,0x2E,0xFF,0x8A,0xFF,0xDF,0xFF,0x00,0xE4,0x2E,0xFF,0xA2,0xDA,0x25,0xFF,0x00,0xDA,0x25,0x8B,0x81,0x00,0x00,0x00,0x00,0xDA,0x25,0xD4,0x8B,0xDA,0x25,0xFF,0x00,0xE2,0xE8,0xFF,0x8A,0xFF,0xDF,0xFF,0x00,0xF5,0xF6,0xFF,0xA2,0xDA,0x25,0xFF,0x03,0xDA,0x25,0xCF,0x00,0x00,0x00,0xDA,0x25,0x16,0xDA,0x25,0xFE,0x8C,0xDA,0x25,0xFF,0x00,0xF7,0x3C,0xFF,0x89,0xFF,0xDF,0xFF,0x01,0xFF,0xBE,0xFF,0xE2,0xA7,0xFF,0xA1,0xDA,0x25,0xFF,0x02,0xDA,0x25,0xFE,0xD9,0xE4,0x14,0xDA,0x05,0x54,0x8D,0xDA,0x25,0xFF,0x00,0xED,0xB5,0xFF,0x8A,0xFF,0xDF,0xFF,0x00,0xEC,0xF2,0xFF,0xA2,0xDA,0x25,0xFF,0x01,0xDA,0x25,0x52,0xDA,0x05,
+    0x80,0x8D,0xDA,0x25,0xFF,0x00,0xE3,0xED,0xFF,0x8A,0xFF,0xDF,0xFF,0x00,0xF6,0x99,0xFF,0xA2,0xDA,0x25,0xFF,0x01,0xDA,0x05,0x7D,0xDA,0x25,0xA7,0x8D,0xDA,0x25,0xFF,0x01,0xDA,0x45,0xFF,0xFF,0x7D,0xFF,0x89,0xFF,0xDF,0xFF,0x00,0xED,0x74,0xFF,0xA2,0xDA,0x25,0xFF,0x01,0xDA,0x25,0xA4,0xDA,0x05,0xCC,0x8E,0xDA,0x25,0xFF,0x00,0xED,0x74,0xFF,0x87,0xFF,0xDF,0xFF,0x02,0xFF,0x9E,0xFF,0xED,0x33,0xFF,0xDA,0x46,0xFF,0xA2,0xDA,0x25,0xFF,0x01,0xDA,0x25,0xCA,0xDA,0x25,0xE0,0x8E,0xDA,0x25,0xFF,0x00,0xE3,0x2A,0xFF,0x85,0xFF,0xDF,0xFF,0x02,0xFF,0x9E,0xFF,0xED,0x12,0xFF,0xE2,0x87,0xFF,0xA4,0xDA,0x25,0xFF,0x01,0xDA,0x25,0xDE,0xDA,0x25,0xED,0x8F,0xDA,0x25,0xFF,0x00,0xF6,0x37,0xFF,0x84,0xFF,0xDF,0xFF,0x01,0xFF,0xBE,0xFF,0xE3,0x09,0xFF,0xA5,0xDA,0x25,0xFF,0x01,0xDA,0x25,0xEB,0xDA,0x05,0xF9,0x8F,0xDA,0x25,0xFF,0x00,0xE3,0x6A,0xFF,0x85,0xFF,0xDF,0xFF,0x00,0xF6,0x99,0xFF,0xA5,0xDA,0x25,0xFF,0x01,0xDA,0x25,0xF8,0xDA,0x05,0xF9,0x90,0xDA,0x25,0xFF,0x00,0xF6,0x17,0xFF,0x85,0xFF,0xDF,
+    0xFF,0x00,0xEC,0xB0,0xFF,0xA4,0xDA,0x25,0xFF,0x01,0xDA,0x25,0xF8,0xDA,0x25,0xED,0x90,0xDA,0x25,0xFF,0x01,0xE2,0xC8,0xFF,0xFF,0x9E,0xFF,0x84,0xFF,0xDF,0xFF,0x01,0xFF,0xBE,0xFF,0xE3,0xAC,0xFF,0xA3,0xDA,0x25,0xFF,0x01,0xDA,0x25,0xEB,0xDA,0x25,0xE0,0x91,0xDA,0x25,0xFF,0x00,0xEC,0xF2,0xFF,0x85,0xFF,0xDF,0xFF,0x01,0xFF,0x7D,0xFF,0xE3,0x29,0xFF,0xA2,0xDA,0x25,0xFF,0x01,0xDA,0x25,0xDE,0xDA,0x05,0xCC,0x91,0xDA,0x25,0xFF,0x01,0xDA,0x45,0xFF,0xF6,0x99,0xFF,0x85,0xFF,0xDF,0xFF,0x01,0xF7,0x3C,0xFF,0xDA,0xA7,0xFF,0xA1,0xDA,0x25,0xFF,0x01,0xDA,0x25,0xCA,0xDA,0x05,0xA6,0x92,0xDA,0x25,0xFF,0x01,0xE2,0xC8,0xFF,0xFF,0x7D,0xFF,0x85,0xFF,0xDF,0xFF,0x01,0xF7,0x3C,0xFF,0xE3,0x09,0xFF,0x84,0xDA,0x25,0xFF,0x04,0xDA,0x46,0xFF,0xED,0x74,0xFF,0xF6,0x99,0xFF,0xEC,0xF2,0xFF,0xDA,0xA7,0xFF,0x96,0xDA,0x25,0xFF,0x01,0xDA,0x05,0xA3,0xDA,0x25,0x7F,0x93,0xDA,0x25,0xFF,0x00,0xE3,0xED,0xFF,0x86,0xFF,0xDF,0xFF,0x01,0xFF,0x7D,0xFF,0xE3,0x8B,0xFF,0x83,0xDA,0x25,0xFF,0x00,0xED,0x33,0xFF,
+    0x82,0xFF,0xDF,0xFF,0x03,0xFF,0xBE,0xFF,0xF6,0x16,0xFF,0xEC,0x2E,0xFF,0xE2,0xA7,0xFF,0x93,0xDA,0x25,0xFF,0x01,0xDA,0x25,0x7C,0xDA,0x05,0x53,0x94,0xDA,0x25,0xFF,0x00,0xEC,0x90,0xFF,0x86,0xFF,0xDF,0xFF,0x01,0xFF,0xBE,0xFF,0xEC,0xB0,0xFF,0x81,0xDA,0x25,0xFF,0x01,0xE2,0x87,0xFF,0xFF,0x9E,0xFF,0x86,0xFF,0xDF,0xFF,0x05,0xF7,0x1B,0xFF,0xF6,0x17,0xFF,0xED,0x33,0xFF,0xEC,0xD1,0xFF,0xEC,0x6F,0xFF,0xE3,0xAC,0xFF,0x8D,0xDA,0x25,0xFF,0x02,0xDA,0x25,0x51,0xDA,0x25,0x16,0xDA,0x25,0xFE,0x94,0xDA,0x25,0xFF,0x00,0xED,0x12,0xFF,0x87,0xFF,0xDF,0xFF,0x02,0xF6,0x99,0xFF,0xE2,0xE9,0xFF,0xED,0x12,0xFF,0x8D,0xFF,0xDF,0xFF,0x00,0xED,0x94,0xFF,0x8B,0xDA,0x25,0xFF,0x03,0xDA,0x05,0xFD,0xD9,0xE4,0x14,0x00,0x00,0x00,0xDA,0x05,0xD3,0x95,0xDA,0x25,0xFF,0x00,0xED,0x12,0xFF,0x87,0xFF,0xDF,0xFF,0x81,0xFF,0x9E,0xFF,0x8D,0xFF,0xDF,0xFF,0x00,0xFF,0x9E,0xFF,0x8B,0xDA,0x25,0xFF,0x00,0xDA,0x25,0xCE,0x81,0x00,0x00,0x00,0x00,0xDA,0x25,0x8E,0x96,0xDA,0x25,0xFF,0x00,0xEC,0x90,0xFF,0x97,0xFF,
+    0xDF,0xFF,0x8B,0xDA,0x25,0xFF,0x00,0xDA,0x25,0x8A,0x81,0x00,0x00,0x00,0x00,0xDA,0x24,0x34,0x97,0xDA,0x25,0xFF,0x01,0xE3,0xCD,0xFF,0xFF,0x7D,0xFF,0x95,0xFF,0xDF,0xFF,0x8B,0xDA,0x25,0xFF,0x00,0xDA,0x25,0x30,0x82,0x00,0x00,0x00,0x00,0xDA,0x05,0xD3,0x97,0xDA,0x25,0xFF,0x01,0xE2,0xC8,0xFF,0xF6,0x99,0xFF,0x94,0xFF,0xDF,0xFF,0x8A,0xDA,0x25,0xFF,0x00,0xDA,0x25,0xD5,0x83,0x00,0x00,0x00,0x00,0xDA,0x25,0x74,0x98,0xDA,0x25,0xFF,0x02,0xDA,0x45,0xFF,0xEC,0xF1,0xFF,0xFF,0x9E,0xFF,0x92,0xFF,0xDF,0xFF,0x8A,0xDA,0x25,0xFF,0x00,0xDA,0x05,0x72,0x83,0x00,0x00,0x00,0x01,0xD9,0xC4,0x0D,0xDA,0x05,0xEE,0x99,0xDA,0x25,0xFF,0x01,0xE2,0xC8,0xFF,0xF6,0x37,0xFF,0x91,0xFF,0xDF,0xFF,0x89,0xDA,0x25,0xFF,0x01,0xDA,0x25,0xED,0xD9,0xC4,0x0D,0x84,0x00,0x00,0x00,0x00,0xDA,0x05,0x81,0x9B,0xDA,0x25,0xFF,0x01,0xE3,0x2A,0xFF,0xF5,0xF6,0xFF,0x8F,0xFF,0xDF,0xFF,0x89,0xDA,0x25,0xFF,0x00,0xDA,0x05,0x7D,0x85,0x00,0x00,0x00,0x01,0xE2,0x45,0x11,0xDA,0x05,0xEA,0x9C,0xDA,0x25,0xFF,0x02,0xE3,0x2A,
+    0xFF,0xED,0x74,0xFF,0xFF,0x7D,0xFF,0x8C,0xFF,0xDF,0xFF,0x88,0xDA,0x25,0xFF,0x01,0xDA,0x25,0xE8,0xDA,0x24,0x0F,0x86,0x00,0x00,0x00,0x00,0xDA,0x05,0x62,0x9E,0xDA,0x25,0xFF,0x03,0xDA,0x45,0xFF,0xE3,0xED,0xFF,0xED,0xB5,0xFF,0xF7,0x3C,0xFF,0x88,0xFF,0xDF,0xFF,0x00,0xF7,0x3C,0xFF,0x88,0xDA,0x25,0xFF,0x00,0xDA,0x25,0x5D,0x87,0x00,0x00,0x00,0x01,0xF8,0x00,0x01,0xDA,0x05,0xC4,0xA1,0xDA,0x25,0xFF,0x09,0xE2,0xE8,0xFF,0xE4,0x2E,0xFF,0xED,0x12,0xFF,0xF5,0xF6,0xFF,0xF6,0xBA,0xFF,0xF7,0x1B,0xFF,0xFF,0x7D,0xFF,0xFF,0xBE,0xFF,0xF7,0x3C,0xFF,0xE3,0xCC,0xFF,0x87,0xDA,0x25,0xFF,0x01,0xDA,0x05,0xC1,0xF8,0x00,0x01,0x88,0x00,0x00,0x00,0x01,0xDA,0x05,0x23,0xDA,0x25,0xF0,0xB1,0xDA,0x25,0xFF,0x01,0xDA,0x25,0xEF,0xDA,0x04,0x22,0x8A,0x00,0x00,0x00,0x00,0xDA,0x05,0x54,0xB1,0xDA,0x25,0xFF,0x00,0xDA,0x25,0x52,0x8C,0x00,0x00,0x00,0x00,0xDA,0x25,0x8D,0xAF,0xDA,0x25,0xFF,0x00,0xDA,0x25,0x89,0x8D,0x00,0x00,0x00,0x01,0xF8,0x00,0x01,0xDA,0x05,0x9F,0xAD,0xDA,0x25,0xFF,0x01,0xDA,0x25,
+    0xA5,0xFB,0xE0,0x02,0x8E,0x00,0x00,0x00,0x01,0xC9,0x86,0x05,0xDA,0x05,0xB5,0xAB,0xDA,0x25,0xFF,0x01,0xDA,0x25,0xB3,0xC9,0x86,0x05,0x90,0x00,0x00,0x00,0x01,0xB9,0xE7,0x04,0xDA,0x25,0x9D,0xA9,0xDA,0x25,0xFF,0x01,0xDA,0x05,0xA3,0xC9,0x86,0x05,0x92,0x00,0x00,0x00,0x01,0xF8,0x00,0x01,0xDA,0x25,0x8B,0xA6,0xDA,0x25,0xFF,0x02,0xDA,0x25,0xFE,0xDA,0x25,0x89,0xF8,0x00,0x01,0x95,0x00,0x00,0x00,0x01,0xDA,0x05,0x50,0xDA,0x05,0xEE,0xA3,0xDA,0x25,0xFF,0x01,0xDA,0x05,0xF1,0xDA,0x25,0x56,0x98,0x00,0x00,0x00,0x01,0xDA,0x04,0x22,0xDA,0x25,0xC2,0xA1,0xDA,0x25,0xFF,0x01,0xDA,0x05,0xC1,0xE2,0x24,0x21,0x9A,0x00,0x00,0x00,0x02,0xF8,0x00,0x01,0xDA,0x25,0x5E,0xDA,0x25,0xE9,0x9D,0xDA,0x25,0xFF,0x02,0xDA,0x25,0xED,0xDA,0x05,0x66,0xF8,0x00,0x01,0x9D,0x00,0x00,0x00,0x02,0xD9,0xE5,0x10,0xDA,0x25,0x7E,0xDA,0x25,0xED,0x99,0xDA,0x25,0xFF,0x02,0xDA,0x25,0xEC,0xDA,0x05,0x7D,0xDA,0x24,0x0F,0xA1,0x00,0x00,0x00,0x02,0xD1,0xE5,0x0C,0xDA,0x05,0x72,0xDA,0x25,0xD4,0x95,0xDA,0x25,0xFF,0x02,
+    0xDA,0x05,0xD3,0xDA,0x05,0x71,0xD1,0xE5,0x0C,0xA6,0x00,0x00,0x00,0x03,0xDA,0x05,0x31,0xDA,0x25,0x8B,0xDA,0x05,0xD0,0xDA,0x05,0xFD,0x8D,0xDA,0x25,0xFF,0x03,0xDA,0x05,0xFD,0xDA,0x25,0xCF,0xDA,0x25,0x8A,0xDA,0x25,0x30,0xAC,0x00,0x00,0x00,0x06,0xD9,0xE4,0x14,0xDA,0x25,0x52,0xDA,0x25,0x7C,0xDA,0x25,0xA5,0xDA,0x25,0xCB,0xDA,0x25,0xDD,0xDA,0x25,0xED,0x81,0xDA,0x05,0xF9,0x06,0xDA,0x25,0xED,0xDA,0x25,0xDD,0xDA,0x25,0xCB,0xDA,0x25,0xA4,0xDA,0x25,0x7C,0xDA,0x25,0x51,0xD9,0xE4,0x14,0x97,0x00,0x00,0x00,
     };
 const lv_img_dsc_t ui_img_decline_png = {
    .header.always_zero = 0,
    .header.w = 64,
    .header.h = 64,
    .data_size = sizeof(ui_img_decline_png_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+   .header.cf = LV_IMG_CF_USER_ENCODED_1,
    .data = ui_img_decline_png_data};
 
@@ -11,28 +11,15 @@
 
 // IMAGE DATA: assets\facebook.png
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_facebook_png_data[] = {
-0x43,0x89,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x43,0x89,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,
-    0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,
-    0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x4B,0x54,0x53,0x74,0x53,0x74,0x53,0x74,0x4B,0x54,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,
-    0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x4B,0x54,0x95,0x18,0xD6,0xDC,0xE7,0x5E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xD6,0xDC,0x4B,0x54,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x63,0xF6,0xD6,0xDC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x7E,0x53,0x74,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,
-    0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x4B,0x54,0xD6,0xDC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x7E,0x53,0x74,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x95,0x18,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x7E,0x53,0x74,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,
-    0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0xD6,0xDC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBF,0xEF,0x7E,0xEF,0x7E,0xD6,0xDC,0x4B,0x54,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x4B,0x54,0xE7,0x5E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBF,0x7C,0x77,0x53,0x74,0x53,0x74,0x4B,0x54,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,
-    0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x53,0x74,0xEF,0x7E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x7E,0x4B,0x54,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x53,0x74,0xEF,0x7E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x7E,0x53,0x74,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,
-    0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x53,0x74,0xEF,0x7E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x7E,0x53,0x74,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x4B,0x54,0x53,0x74,0x53,0x74,0x63,0xF6,0xEF,0x7E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x7E,0x63,0xF6,0x53,0x74,0x53,0x74,0x53,0x74,0x4B,0x54,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,
-    0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x4B,0x54,0xD6,0xDC,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xB5,0xFB,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x53,0x74,0xEF,0x7E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x95,0x18,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,
-    0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x53,0x74,0xEF,0x7E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x5E,0x53,0x74,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x53,0x74,0xEF,0x7E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB5,0xFB,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,
-    0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x4B,0x54,0xD6,0xDC,0xEF,0x7E,0xEF,0x7E,0xEF,0x7E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x7E,0xEF,0x7E,0xE7,0x5E,0x63,0xF6,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x4B,0x54,0x53,0x74,0x53,0x74,0x63,0xF6,0xEF,0x7E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x7E,0x63,0xF6,0x53,0x74,0x4B,0x54,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,
-    0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x53,0x74,0xEF,0x7E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x7E,0x53,0x74,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x53,0x74,0xEF,0x7E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x7E,0x53,0x74,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,
-    0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x53,0x74,0xEF,0x7E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x7E,0x53,0x74,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x53,0x74,0xEF,0x7E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x7E,0x53,0x74,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,
-    0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x53,0x74,0xEF,0x7E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x7E,0x53,0x74,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x53,0x74,0xEF,0x7E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x7E,0x53,0x74,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,
-    0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x53,0x74,0xEF,0x7E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x7E,0x53,0x74,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x53,0x74,0xEF,0x7E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x7E,0x53,0x74,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,
-    0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x53,0x74,0xEF,0x7E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x7E,0x53,0x74,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x43,0x89,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x53,0x74,0xEF,0x7E,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x7E,0x53,0x74,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x3A,0xD3,0x43,0x89,
+    0x9C,0x59,0x39,0xFF,0x4A,0x71,0x42,0xFF,0xA5,0x69,0x4A,0xFF,0xA5,0x6D,0x52,0xFF,0xB5,0x7D,0x63,0xFF,0xBD,0x8E,0x7B,0xFF,0xC6,0xA2,0x94,0xFF,0xDE,0xBE,0xB5,0xFF,0xE7,0xDB,0xD6,0xFF,0xF7,0xEB,0xE7,0xFF,0xF7,0xEF,0xEF,0xFF,0xFF,0xF7,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x33,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x89,0xAA,0xA8,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x8C,0xCC,0xCC,0xCA,0x30,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xCC,0xCC,0xCC,0xCA,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6C,0xCC,0xCC,0xCC,0xCA,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0xCC,0xCC,0xBA,0xA8,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x9C,0xCC,0xCB,0x53,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xAC,0xCC,0xCA,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xAC,0xCC,0xCA,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xAC,0xCC,0xCA,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x34,0xAC,0xCC,0xCA,0x43,0x33,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x8A,0xAA,0xCC,0xCC,0xCC,0xAA,0xAA,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xAC,0xCC,0xCC,0xCC,0xCC,0xCC,0xCC,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xAC,0xCC,0xCC,0xCC,0xCC,0xCC,0xC9,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xAC,0xCC,0xCC,0xCC,0xCC,0xCC,0xC7,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x02,0x8A,0xAA,0xCC,0xCC,0xCC,0xAA,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0x34,0xAC,0xCC,0xCA,0x43,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xAC,0xCC,0xCA,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xAC,0xCC,0xCA,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xAC,0xCC,0xCA,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xAC,0xCC,0xCA,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xAC,0xCC,0xCA,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xAC,0xCC,0xCA,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xAC,0xCC,0xCA,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xAC,0xCC,0xCA,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xAC,0xCC,0xCA,0x30,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xAC,0xCC,0xCA,0x30,0x00,0x00,0x00,0x01,
     };
 const lv_img_dsc_t ui_img_facebook_png = {
    .header.always_zero = 0,
    .header.w = 32,
    .header.h = 32,
    .data_size = sizeof(ui_img_facebook_png_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR,
+   .header.cf = LV_IMG_CF_INDEXED_4BIT,
    .data = ui_img_facebook_png_data};
 
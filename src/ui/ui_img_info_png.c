@@ -10,77 +10,25 @@
 #endif
 
 // IMAGE DATA: assets\info.png
+// Run length encoded LV_IMG_CF_TRUE_COLOR_ALPHA, decoded by src/img_cache.cpp
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_info_png_data[] = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xDF,0x16,0x05,0xFF,0x53,0x05,0xFF,0x80,0x05,0xFF,0xA6,0x05,0xFF,0xCC,0x05,0xFF,0xDE,0x05,0xFF,0xEE,0x05,0xFF,0xFA,0x05,0xFF,0xFA,0x05,0xFF,0xEE,0x05,0xFF,0xDE,0x05,0xFF,0xCC,0x05,0xFF,0xA6,0x05,0xFF,0x80,0x05,0xFF,0x52,0x06,0x1F,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0x33,0x05,0xFF,0x8E,0x05,0xFF,0xD4,0x05,0xFF,0xFE,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFE,0x05,0xFF,0xD4,0x05,0xFF,0x8D,0x05,0xFF,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0x0C,0x05,0xDF,0x71,0x05,0xFF,0xD6,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xFF,0x05,0xFF,0xD5,0x05,0xDF,0x71,0x05,0xFF,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xDF,0x0F,0x05,0xDF,0x80,0x05,0xDF,0xEC,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xEC,0x05,0xDF,0x7F,0x05,0xDF,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xDF,0x55,0x05,0xDF,0xE8,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xFF,0x05,0xDF,0xE7,0x05,0xDF,0x5E,0x07,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0D,0xDF,0x1E,0x05,0xBF,0xC0,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xFF,0x05,0xBF,0xBF,0x0D,0xDF,0x1D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0D,0xBF,0x4D,0x0D,0xBF,0xED,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xF0,0x0D,0xBF,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0D,0xBF,0x82,0x0D,0xBF,0xFE,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFF,0x0D,0xBF,0xFE,0x0D,0xBF,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x5F,0x03,0x0D,0x9F,0x98,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0x9F,0x05,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x5F,0x03,0x0D,0x9F,0xAA,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xFF,0x0D,0x9F,0xAA,0x05,0x5F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x0D,0x9F,0x9A,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x9F,0x9A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x7F,0x82,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x1D,0x9F,0xFF,0x66,0x5F,0xFF,0x8E,0xBF,0xFF,0x8E,0xBF,0xFF,0x66,0x5F,0xFF,0x1D,0x9F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x0D,0x7F,0xFF,0x15,0x7F,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x7F,0x4B,0x15,0x7F,0xFE,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x66,0x5F,0xFF,0xDF,0x9F,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xDF,0x9F,0xFF,0x66,0x3F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFF,0x15,0x7F,0xFE,0x15,0x5F,0x4F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x3F,0x1D,0x15,0x5F,0xEC,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x66,0x3F,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0x66,0x3F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xEE,0x15,0x7F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x15,0x3F,0xC0,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x25,0x7F,0xFF,0xDF,0x9F,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xDF,0x9F,0xFF,0x25,0x7F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xFF,0x15,0x5F,0xBE,0x07,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x5F,0x5E,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x6E,0x3F,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0x6E,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x5F,0x5B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x5F,0x0F,0x15,0x3F,0xE8,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x96,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0x8E,0xBF,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xE6,0x15,0x3F,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1D,0x1F,0x80,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x96,0x9F,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0x8E,0x9F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x3F,0xFF,0x15,0x1F,0x7D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x1F,0x0B,0x1D,0x1F,0xEB,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x6E,0x1F,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0x6E,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xEC,0x15,0x5F,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x1D,0x1F,0x71,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x2D,0x3F,0xFF,0xDF,0x9F,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xDF,0x9F,0xFF,0x2D,0x3F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0xFF,0x1D,0x1F,0x6F,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xFF,0xD4,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x65,0xFF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0x65,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xD5,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x1C,0xDF,0x33,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x65,0xFF,0xFF,0xDF,0x9F,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xDF,0x9F,0xFF,0x65,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0xFF,0x1C,0xFF,0x2F,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x1C,0xDF,0x8E,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x2D,0x1F,0xFF,0x6D,0xFF,0xFF,0x96,0x7F,0xFF,0x96,0x7F,0xFF,0x6D,0xFF,0xFF,0x2D,0x1F,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0x8A,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x1C,0xDF,0xD5,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xFF,0x1C,0xDF,0xD0,0x00,0x00,0x00,
-    0x24,0xFF,0x15,0x24,0xDF,0xFE,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFE,0x24,0xDF,0x14,
-    0x24,0xDF,0x54,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0x51,
-    0x24,0xBF,0x80,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x75,0xFF,0xFF,0x9E,0x9F,0xFF,0x9E,0x9F,0xFF,0x9E,0x9F,0xFF,0x9E,0x9F,0xFF,0x9E,0x9F,0xFF,0x9E,0x9F,0xFF,0x9E,0x9F,0xFF,0x9E,0x9F,0xFF,0x75,0xFF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0x7E,
-    0x24,0x9F,0xA6,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x75,0xDF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0x75,0xDF,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xA3,
-    0x24,0x9F,0xCB,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x9E,0x9F,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0x9E,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xC9,
-    0x24,0x9F,0xE1,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0xA6,0x7F,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xA6,0x7F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xFF,0x24,0x9F,0xDF,
-    0x2C,0x7F,0xED,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0xA6,0x7F,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xA6,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xEC,
-    0x2C,0x7F,0xF9,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0xA6,0x7F,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xA6,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xF9,
-    0x2C,0x5F,0xFA,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0xA6,0x7F,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xEF,0xBF,0xFF,0xA6,0x7F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xF9,
-    0x2C,0x5F,0xEF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0xA6,0x7F,0xFF,0xE7,0xBF,0xFF,0xE7,0xBF,0xFF,0xE7,0xBF,0xFF,0xE7,0xBF,0xFF,0xE7,0xBF,0xFF,0xE7,0xBF,0xFF,0xE7,0xBF,0xFF,0xE7,0xBF,0xFF,0xE7,0xBF,0xFF,0xE7,0xBF,0xFF,0xA6,0x7F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xEC,
-    0x2C,0x5F,0xE2,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x9E,0x5F,0xFF,0xE7,0x9F,0xFF,0xE7,0x9F,0xFF,0xE7,0x9F,0xFF,0xE7,0x9F,0xFF,0xE7,0x9F,0xFF,0xE7,0x9F,0xFF,0xE7,0x9F,0xFF,0xE7,0x9F,0xFF,0xE7,0x9F,0xFF,0xE7,0x9F,0xFF,0x9E,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xFF,0x2C,0x5F,0xDF,
-    0x2C,0x3F,0xC7,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x9E,0x5F,0xFF,0xDF,0x9F,0xFF,0xDF,0x9F,0xFF,0xDF,0x9F,0xFF,0xDF,0x9F,0xFF,0xDF,0x9F,0xFF,0xDF,0x9F,0xFF,0xDF,0x9F,0xFF,0xDF,0x9F,0xFF,0xDF,0x9F,0xFF,0xDF,0x9F,0xFF,0x9E,0x5F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xFF,0x2C,0x3F,0xC9,
-    0x34,0x3F,0xA4,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x9E,0x5F,0xFF,0xDF,0x9F,0xFF,0xDF,0x9F,0xFF,0xDF,0x9F,0xFF,0xDF,0x9F,0xFF,0xDF,0x9F,0xFF,0xDF,0x9F,0xFF,0xDF,0x9F,0xFF,0xDF,0x9F,0xFF,0xDF,0x9F,0xFF,0xDF,0x9F,0xFF,0x9E,0x5F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xA3,
-    0x34,0x3F,0x7E,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x9E,0x3F,0xFF,0xDF,0x7F,0xFF,0xDF,0x7F,0xFF,0xDF,0x7F,0xFF,0xDF,0x7F,0xFF,0xDF,0x7F,0xFF,0xDF,0x7F,0xFF,0xDF,0x7F,0xFF,0xDF,0x7F,0xFF,0xDF,0x7F,0xFF,0xDF,0x7F,0xFF,0x9E,0x3F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x3F,0x7E,
-    0x34,0x1F,0x47,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x9E,0x3F,0xFF,0xD7,0x7F,0xFF,0xD7,0x7F,0xFF,0xD7,0x7F,0xFF,0xD7,0x7F,0xFF,0xD7,0x7F,0xFF,0xD7,0x7F,0xFF,0xD7,0x7F,0xFF,0xD7,0x7F,0xFF,0xD7,0x7F,0xFF,0xD7,0x7F,0xFF,0x9E,0x3F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0x51,
-    0x34,0x1F,0x0E,0x34,0x1F,0xFC,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x9E,0x1F,0xFF,0xD7,0x7F,0xFF,0xD7,0x7F,0xFF,0xD7,0x7F,0xFF,0xD7,0x7F,0xFF,0xD7,0x7F,0xFF,0xD7,0x7F,0xFF,0xD7,0x7F,0xFF,0xD7,0x7F,0xFF,0xD7,0x7F,0xFF,0xD7,0x7F,0xFF,0x9E,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFE,0x34,0x1F,0x14,
-    0x00,0x00,0x00,0x33,0xFF,0xC9,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x96,0x1F,0xFF,0xD7,0x5F,0xFF,0xD7,0x5F,0xFF,0xD7,0x5F,0xFF,0xD7,0x5F,0xFF,0xD7,0x5F,0xFF,0xD7,0x5F,0xFF,0xD7,0x5F,0xFF,0xD7,0x5F,0xFF,0xD7,0x5F,0xFF,0xD7,0x5F,0xFF,0x96,0x1F,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xD0,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x3B,0xFF,0x77,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x96,0x1F,0xFF,0xCF,0x5F,0xFF,0xCF,0x5F,0xFF,0xCF,0x5F,0xFF,0xCF,0x5F,0xFF,0xCF,0x5F,0xFF,0xCF,0x5F,0xFF,0xCF,0x5F,0xFF,0xCF,0x5F,0xFF,0xCF,0x5F,0xFF,0xCF,0x5F,0xFF,0x96,0x1F,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x3B,0xFF,0x89,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x33,0xFF,0x25,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x95,0xFF,0xFF,0xCF,0x5F,0xFF,0xCF,0x5F,0xFF,0xCF,0x5F,0xFF,0xCF,0x5F,0xFF,0xCF,0x5F,0xFF,0xCF,0x5F,0xFF,0xCF,0x5F,0xFF,0xCF,0x5F,0xFF,0xCF,0x5F,0xFF,0xCF,0x5F,0xFF,0x95,0xFF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x33,0xFF,0x2F,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x3B,0xDF,0xC0,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x95,0xFF,0xFF,0xCF,0x3F,0xFF,0xCF,0x3F,0xFF,0xCF,0x3F,0xFF,0xCF,0x3F,0xFF,0xCF,0x3F,0xFF,0xCF,0x3F,0xFF,0xCF,0x3F,0xFF,0xCF,0x3F,0xFF,0xCF,0x3F,0xFF,0xCF,0x3F,0xFF,0x95,0xFF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xD5,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x3B,0xDF,0x55,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x95,0xFF,0xFF,0xC7,0x3F,0xFF,0xC7,0x3F,0xFF,0xC7,0x3F,0xFF,0xC7,0x3F,0xFF,0xC7,0x3F,0xFF,0xC7,0x3F,0xFF,0xC7,0x3F,0xFF,0xC7,0x3F,0xFF,0xC7,0x3F,0xFF,0xC7,0x3F,0xFF,0x95,0xFF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xBF,0x6F,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x1F,0x04,0x3B,0xBF,0xDF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x95,0xDF,0xFF,0xC7,0x3F,0xFF,0xC7,0x3F,0xFF,0xC7,0x3F,0xFF,0xC7,0x3F,0xFF,0xC7,0x3F,0xFF,0xC7,0x3F,0xFF,0xC7,0x3F,0xFF,0xC7,0x3F,0xFF,0xC7,0x3F,0xFF,0xC7,0x3F,0xFF,0x95,0xDF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xEA,0x43,0xBF,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3B,0xBF,0x5E,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x8D,0xDF,0xFF,0xBF,0x3F,0xFF,0xBF,0x3F,0xFF,0xBF,0x3F,0xFF,0xBF,0x3F,0xFF,0xBF,0x3F,0xFF,0xBF,0x3F,0xFF,0xBF,0x3F,0xFF,0xBF,0x3F,0xFF,0xBF,0x3F,0xFF,0xBF,0x3F,0xFF,0x8D,0xDF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0x9F,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xBF,0x03,0x3B,0x9F,0xD3,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x8D,0xDF,0xFF,0xBF,0x1F,0xFF,0xBF,0x1F,0xFF,0xBF,0x1F,0xFF,0xBF,0x1F,0xFF,0xBF,0x1F,0xFF,0xBF,0x1F,0xFF,0xBF,0x1F,0xFF,0xBF,0x1F,0xFF,0xBF,0x1F,0xFF,0xBF,0x1F,0xFF,0x8D,0xDF,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xE5,0x3B,0xBF,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x7F,0x3E,0x43,0x9F,0xFE,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x8D,0xBF,0xFF,0xBF,0x1F,0xFF,0xBF,0x1F,0xFF,0xBF,0x1F,0xFF,0xBF,0x1F,0xFF,0xBF,0x1F,0xFF,0xBF,0x1F,0xFF,0xBF,0x1F,0xFF,0xBF,0x1F,0xFF,0xBF,0x1F,0xFF,0xBF,0x1F,0xFF,0x8D,0xBF,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x3B,0x9F,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x7F,0x97,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x8D,0xBF,0xFF,0xB7,0x1F,0xFF,0xB7,0x1F,0xFF,0xB7,0x1F,0xFF,0xB7,0x1F,0xFF,0xB7,0x1F,0xFF,0xB7,0x1F,0xFF,0xB7,0x1F,0xFF,0xB7,0x1F,0xFF,0xB7,0x1F,0xFF,0xB7,0x1F,0xFF,0x8D,0xBF,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xBD,0x00,0x1F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4B,0x7F,0x0E,0x43,0x7F,0xDA,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x8D,0xBF,0xFF,0xB6,0xFF,0xFF,0xB6,0xFF,0xFF,0xB6,0xFF,0xFF,0xB6,0xFF,0xFF,0xB6,0xFF,0xFF,0xB6,0xFF,0xFF,0xB6,0xFF,0xFF,0xB6,0xFF,0xFF,0xB6,0xFF,0xFF,0xB6,0xFF,0xFF,0x8D,0xBF,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xEB,0x43,0x7F,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x7F,0x2D,0x43,0x7F,0xF5,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x74,0xDF,0xFF,0xB6,0xFF,0xFF,0xB6,0xFF,0xFF,0xB6,0xFF,0xFF,0xB6,0xFF,0xFF,0xB6,0xFF,0xFF,0xB6,0xFF,0xFF,0xB6,0xFF,0xFF,0xB6,0xFF,0xFF,0xB6,0xFF,0xFF,0xB6,0xFF,0xFF,0x74,0xDF,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFE,0x43,0x5F,0x4F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x5F,0x77,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x7F,0xFF,0x74,0xDF,0xFF,0x85,0x7F,0xFF,0x85,0x7F,0xFF,0x85,0x7F,0xFF,0x85,0x7F,0xFF,0x85,0x7F,0xFF,0x85,0x7F,0xFF,0x85,0x7F,0xFF,0x85,0x7F,0xFF,0x74,0xDF,0xFF,0x43,0x7F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4B,0x5F,0x60,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x4B,0x5F,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4B,0x3F,0x63,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x5F,0xAA,0x52,0xBF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4B,0x3F,0x7F,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0x98,0x52,0xBF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4B,0x1F,0xC8,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFE,0x4B,0x3F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4B,0x3F,0x4A,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xEB,0x4B,0x1F,0x4B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0xFF,0x2B,0x4B,0x1F,0xEB,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xBD,0x53,0x3F,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4A,0xDF,0x0E,0x4A,0xFF,0x71,0x4A,0xFF,0xF2,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFA,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xFF,0x4A,0xFF,0xE5,0x52,0xFF,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x4B,0x1F,0x2D,0x52,0xFF,0xAA,0x52,0xFF,0xD2,0x52,0xFF,0xF8,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xB1,0x52,0xFF,0x16,0x52,0xFF,0x4F,0x52,0xFF,0xC9,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xEB,0x52,0xFF,0x7C,0x4B,0x1F,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x52,0xFF,0xD6,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xEA,0x52,0xFF,0x66,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xFF,0x45,0x52,0xFF,0xB7,0x52,0xFF,0xFB,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xFF,0x52,0xFF,0xD3,0x52,0xFF,0x6F,0x5A,0xFF,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x52,0xDF,0xEA,0x52,0xDF,0xFF,0x52,0xDF,0xFF,0x52,0xDF,0xFF,0x52,0xDF,0xFF,0x52,0xDF,0xFF,0x52,0xDF,0xFF,0x52,0xDF,0xFF,0x52,0xDF,0xFF,0x52,0xDF,0xFF,0x52,0xDF,0xFF,0x52,0xDF,0xE1,0x52,0xDF,0x6E,0x4B,0x3F,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5A,0xDF,0x14,0x52,0xDF,0x65,0x52,0xDF,0xBB,0x52,0xDF,0xFB,0x52,0xDF,0xFF,0x52,0xDF,0xFF,0x52,0xDF,0xFF,0x52,0xDF,0xFF,0x52,0xDF,0xFF,0x52,0xDF,0xFF,0x52,0xDF,0xFF,0x52,0xDF,0xFF,0x52,0xDF,0xFF,0x52,0xDF,0xFF,0x52,0xDF,0xFF,0x52,0xDF,0xFF,0x52,0xDF,0xFF,0x52,0xDF,0xFF,0x52,0xDF,0xFD,0x52,0xDF,0xD0,0x52,0xDF,0x89,0x52,0xFF,0x2F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x52,0xDF,0x57,0x52,0xDF,0xEA,0x52,0xDF,0xFF,0x52,0xDF,0xFF,0x52,0xDF,0xFF,0x52,0xDF,0xFF,0x52,0xDF,0xE9,0x52,0xDF,0xD3,0x52,0xDF,0xB6,0x52,0xDF,0x78,0x52,0xBF,0x32,0x00,0x1F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xBF,0x09,0x52,0xDF,0x39,0x52,0xDF,0x6C,0x52,0xDF,0x9F,0x52,0xDF,0xC3,0x52,0xDF,0xD4,0x52,0xDF,0xE5,0x52,0xDF,0xF6,0x52,0xDF,0xF9,0x52,0xDF,0xEE,0x52,0xDF,0xDD,0x52,0xDF,0xCA,0x52,0xDF,0xA4,0x52,0xDF,0x7D,0x52,0xDF,0x51,0x52,0xFF,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x97,0x00,0x00,0x00,0x06,0x05,0xDF,0x16,0x05,0xFF,0x53,0x05,0xFF,0x80,0x05,0xFF,0xA6,0x05,0xFF,0xCC,0x05,0xFF,0xDE,0x05,0xFF,0xEE,0x81,0x05,0xFF,0xFA,0x06,0x05,0xFF,0xEE,0x05,0xFF,0xDE,0x05,0xFF,0xCC,0x05,0xFF,0xA6,0x05,0xFF,0x80,0x05,0xFF,0x52,0x06,0x1F,0x15,0xAC,0x00,0x00,0x00,0x03,0x05,0xFF,0x33,0x05,0xFF,0x8E,0x05,0xFF,0xD4,0x05,0xFF,0xFE,0x8D,0x05,0xFF,0xFF,0x03,0x05,0xFF,0xFE,0x05,0xFF,0xD4,0x05,0xFF,0x8D,0x05,0xFF,0x32,0xA6,0x00,0x00,0x00,0x02,0x05,0xFF,0x0C,0x05,0xDF,0x71,0x05,0xFF,0xD6,0x95,0x05,0xFF,0xFF,0x02,0x05,0xFF,0xD5,0x05,0xDF,0x71,0x05,0xFF,0x0C,0xA1,0x00,0x00,0x00,0x02,0x05,0xDF,0x0F,0x05,0xDF,0x80,0x05,0xDF,0xEC,0x99,0x05,0xDF,0xFF,0x02,0x05,0xDF,0xEC,0x05,0xDF,0x7F,0x05,0xDF,0x0F,0x9E,0x00,0x00,0x00,0x01,0x05,0xDF,0x55,0x05,0xDF,0xE8,0x9D,0x05,0xDF,0xFF,0x02,0x05,0xDF,0xE7,0x05,0xDF,0x5E,0x07,0xFF,0x01,0x9A,0x00,0x00,0x00,0x01,0x0D,0xDF,0x1E,0x05,0xBF,0xC0,0xA1,0x05,0xBF,0xFF,0x01,0x05,0xBF,0xBF,0x0D,0xDF,0x1D,0x98,0x00,0x00,
+    0x00,0x01,0x0D,0xBF,0x4D,0x0D,0xBF,0xED,0xA3,0x0D,0xBF,0xFF,0x01,0x0D,0xBF,0xF0,0x0D,0xBF,0x54,0x96,0x00,0x00,0x00,0x01,0x0D,0xBF,0x82,0x0D,0xBF,0xFE,0xA5,0x0D,0xBF,0xFF,0x01,0x0D,0xBF,0xFE,0x0D,0xBF,0x81,0x93,0x00,0x00,0x00,0x01,0x05,0x5F,0x03,0x0D,0x9F,0x98,0xA9,0x0D,0x9F,0xFF,0x01,0x0D,0x9F,0x9F,0x05,0xFF,0x04,0x90,0x00,0x00,0x00,0x01,0x05,0x5F,0x03,0x0D,0x9F,0xAA,0xAB,0x0D,0x9F,0xFF,0x01,0x0D,0x9F,0xAA,0x05,0x5F,0x03,0x8E,0x00,0x00,0x00,0x01,0x07,0xFF,0x01,0x0D,0x9F,0x9A,0xAD,0x0D,0x7F,0xFF,0x00,0x0D,0x9F,0x9A,0x8E,0x00,0x00,0x00,0x00,0x15,0x7F,0x82,0x94,0x0D,0x7F,0xFF,0x01,0x1D,0x9F,0xFF,0x66,0x5F,0xFF,0x81,0x8E,0xBF,0xFF,0x01,0x66,0x5F,0xFF,0x1D,0x9F,0xFF,0x94,0x0D,0x7F,0xFF,0x00,0x15,0x7F,0x80,0x8C,0x00,0x00,0x00,0x01,0x15,0x7F,0x4B,0x15,0x7F,0xFE,0x93,0x15,0x7F,0xFF,0x01,0x66,0x5F,0xFF,0xDF,0x9F,0xFF,0x83,0xEF,0xBF,0xFF,0x01,0xDF,0x9F,0xFF,0x66,0x3F,0xFF,0x93,0x15,0x7F,0xFF,0x01,0x15,0x7F,0xFE,0x15,0x5F,0x4F,0x8A,0x00,0x00,0x00,0x01,0x15,
+    0x3F,0x1D,0x15,0x5F,0xEC,0x93,0x15,0x5F,0xFF,0x00,0x66,0x3F,0xFF,0x87,0xEF,0xBF,0xFF,0x00,0x66,0x3F,0xFF,0x93,0x15,0x5F,0xFF,0x01,0x15,0x5F,0xEE,0x15,0x7F,0x1F,0x88,0x00,0x00,0x00,0x01,0x07,0xFF,0x01,0x15,0x3F,0xC0,0x93,0x15,0x5F,0xFF,0x01,0x25,0x7F,0xFF,0xDF,0x9F,0xFF,0x87,0xEF,0xBF,0xFF,0x01,0xDF,0x9F,0xFF,0x25,0x7F,0xFF,0x93,0x15,0x5F,0xFF,0x01,0x15,0x5F,0xBE,0x07,0xFF,0x01,0x87,0x00,0x00,0x00,0x00,0x15,0x5F,0x5E,0x94,0x15,0x3F,0xFF,0x00,0x6E,0x3F,0xFF,0x89,0xEF,0xBF,0xFF,0x00,0x6E,0x3F,0xFF,0x94,0x15,0x3F,0xFF,0x00,0x15,0x5F,0x5B,0x86,0x00,0x00,0x00,0x01,0x15,0x5F,0x0F,0x15,0x3F,0xE8,0x94,0x15,0x3F,0xFF,0x00,0x96,0xBF,0xFF,0x89,0xEF,0xBF,0xFF,0x00,0x8E,0xBF,0xFF,0x94,0x15,0x3F,0xFF,0x01,0x15,0x3F,0xE6,0x15,0x3F,0x0E,0x85,0x00,0x00,0x00,0x00,0x1D,0x1F,0x80,0x95,0x15,0x3F,0xFF,0x00,0x96,0x9F,0xFF,0x89,0xEF,0xBF,0xFF,0x00,0x8E,0x9F,0xFF,0x95,0x15,0x3F,0xFF,0x00,0x15,0x1F,0x7D,0x84,0x00,0x00,0x00,0x01,0x15,0x1F,0x0B,0x1D,0x1F,0xEB,0x95,0x1D,0x1F,
+    0xFF,0x00,0x6E,0x1F,0xFF,0x89,0xEF,0xBF,0xFF,0x00,0x6E,0x1F,0xFF,0x95,0x1D,0x1F,0xFF,0x01,0x1D,0x1F,0xEC,0x15,0x5F,0x0C,0x83,0x00,0x00,0x00,0x00,0x1D,0x1F,0x71,0x96,0x1D,0x1F,0xFF,0x01,0x2D,0x3F,0xFF,0xDF,0x9F,0xFF,0x87,0xEF,0xBF,0xFF,0x01,0xDF,0x9F,0xFF,0x2D,0x3F,0xFF,0x96,0x1D,0x1F,0xFF,0x00,0x1D,0x1F,0x6F,0x83,0x00,0x00,0x00,0x00,0x1C,0xFF,0xD4,0x97,0x1C,0xFF,0xFF,0x00,0x65,0xFF,0xFF,0x87,0xEF,0xBF,0xFF,0x00,0x65,0xFF,0xFF,0x97,0x1C,0xFF,0xFF,0x00,0x1C,0xFF,0xD5,0x82,0x00,0x00,0x00,0x00,0x1C,0xDF,0x33,0x99,0x1C,0xFF,0xFF,0x01,0x65,0xFF,0xFF,0xDF,0x9F,0xFF,0x83,0xEF,0xBF,0xFF,0x01,0xDF,0x9F,0xFF,0x65,0xFF,0xFF,0x99,0x1C,0xFF,0xFF,0x00,0x1C,0xFF,0x2F,0x81,0x00,0x00,0x00,0x00,0x1C,0xDF,0x8E,0x9A,0x1C,0xDF,0xFF,0x01,0x2D,0x1F,0xFF,0x6D,0xFF,0xFF,0x81,0x96,0x7F,0xFF,0x01,0x6D,0xFF,0xFF,0x2D,0x1F,0xFF,0x9A,0x1C,0xDF,0xFF,0x00,0x1C,0xDF,0x8A,0x81,0x00,0x00,0x00,0x00,0x1C,0xDF,0xD5,0xBB,0x1C,0xDF,0xFF,0x03,0x1C,0xDF,0xD0,0x00,0x00,0x00,0x24,0xFF,0x15,
+    0x24,0xDF,0xFE,0xBB,0x24,0xDF,0xFF,0x02,0x24,0xDF,0xFE,0x24,0xDF,0x14,0x24,0xDF,0x54,0xBD,0x24,0xBF,0xFF,0x01,0x24,0xBF,0x51,0x24,0xBF,0x80,0x99,0x24,0xBF,0xFF,0x00,0x75,0xFF,0xFF,0x87,0x9E,0x9F,0xFF,0x00,0x75,0xFF,0xFF,0x99,0x24,0xBF,0xFF,0x01,0x24,0xBF,0x7E,0x24,0x9F,0xA6,0x98,0x24,0x9F,0xFF,0x00,0x75,0xDF,0xFF,0x89,0xEF,0xBF,0xFF,0x00,0x75,0xDF,0xFF,0x98,0x24,0x9F,0xFF,0x01,0x24,0x9F,0xA3,0x24,0x9F,0xCB,0x98,0x24,0x9F,0xFF,0x00,0x9E,0x9F,0xFF,0x89,0xEF,0xBF,0xFF,0x00,0x9E,0x9F,0xFF,0x98,0x24,0x9F,0xFF,0x01,0x24,0x9F,0xC9,0x24,0x9F,0xE1,0x98,0x24,0x9F,0xFF,0x00,0xA6,0x7F,0xFF,0x89,0xEF,0xBF,0xFF,0x00,0xA6,0x7F,0xFF,0x98,0x24,0x9F,0xFF,0x01,0x24,0x9F,0xDF,0x2C,0x7F,0xED,0x98,0x2C,0x7F,0xFF,0x00,0xA6,0x7F,0xFF,0x89,0xEF,0xBF,0xFF,0x00,0xA6,0x7F,0xFF,0x98,0x2C,0x7F,0xFF,0x01,0x2C,0x7F,0xEC,0x2C,0x7F,0xF9,0x98,0x2C,0x7F,0xFF,0x00,0xA6,0x7F,0xFF,0x89,0xEF,0xBF,0xFF,0x00,0xA6,0x7F,0xFF,0x98,0x2C,0x7F,0xFF,0x01,0x2C,0x7F,0xF9,0x2C,0x5F,0xFA,0x98,0x2C,
+    0x5F,0xFF,0x00,0xA6,0x7F,0xFF,0x89,0xEF,0xBF,0xFF,0x00,0xA6,0x7F,0xFF,0x98,0x2C,0x5F,0xFF,0x01,0x2C,0x5F,0xF9,0x2C,0x5F,0xEF,0x98,0x2C,0x5F,0xFF,0x00,0xA6,0x7F,0xFF,0x89,0xE7,0xBF,0xFF,0x00,0xA6,0x7F,0xFF,0x98,0x2C,0x5F,0xFF,0x01,0x2C,0x5F,0xEC,0x2C,0x5F,0xE2,0x98,0x2C,0x5F,0xFF,0x00,0x9E,0x5F,0xFF,0x89,0xE7,0x9F,0xFF,0x00,0x9E,0x5F,0xFF,0x98,0x2C,0x5F,0xFF,0x01,0x2C,0x5F,0xDF,0x2C,0x3F,0xC7,0x98,0x2C,0x3F,0xFF,0x00,0x9E,0x5F,0xFF,0x89,0xDF,0x9F,0xFF,0x00,0x9E,0x5F,0xFF,0x98,0x2C,0x3F,0xFF,0x01,0x2C,0x3F,0xC9,0x34,0x3F,0xA4,0x98,0x34,0x3F,0xFF,0x00,0x9E,0x5F,0xFF,0x89,0xDF,0x9F,0xFF,0x00,0x9E,0x5F,0xFF,0x98,0x34,0x3F,0xFF,0x01,0x34,0x3F,0xA3,0x34,0x3F,0x7E,0x98,0x34,0x1F,0xFF,0x00,0x9E,0x3F,0xFF,0x89,0xDF,0x7F,0xFF,0x00,0x9E,0x3F,0xFF,0x98,0x34,0x1F,0xFF,0x01,0x34,0x3F,0x7E,0x34,0x1F,0x47,0x98,0x34,0x1F,0xFF,0x00,0x9E,0x3F,0xFF,0x89,0xD7,0x7F,0xFF,0x00,0x9E,0x3F,0xFF,0x98,0x34,0x1F,0xFF,0x02,0x34,0x1F,0x51,0x34,0x1F,0x0E,0x34,0x1F,0xFC,0x97,0x34,
+    0x1F,0xFF,0x00,0x9E,0x1F,0xFF,0x89,0xD7,0x7F,0xFF,0x00,0x9E,0x1F,0xFF,0x97,0x34,0x1F,0xFF,0x03,0x34,0x1F,0xFE,0x34,0x1F,0x14,0x00,0x00,0x00,0x33,0xFF,0xC9,0x97,0x33,0xFF,0xFF,0x00,0x96,0x1F,0xFF,0x89,0xD7,0x5F,0xFF,0x00,0x96,0x1F,0xFF,0x97,0x33,0xFF,0xFF,0x00,0x33,0xFF,0xD0,0x81,0x00,0x00,0x00,0x00,0x3B,0xFF,0x77,0x97,0x33,0xFF,0xFF,0x00,0x96,0x1F,0xFF,0x89,0xCF,0x5F,0xFF,0x00,0x96,0x1F,0xFF,0x97,0x33,0xFF,0xFF,0x00,0x3B,0xFF,0x89,0x81,0x00,0x00,0x00,0x00,0x33,0xFF,0x25,0x97,0x3B,0xDF,0xFF,0x00,0x95,0xFF,0xFF,0x89,0xCF,0x5F,0xFF,0x00,0x95,0xFF,0xFF,0x97,0x3B,0xDF,0xFF,0x00,0x33,0xFF,0x2F,0x82,0x00,0x00,0x00,0x00,0x3B,0xDF,0xC0,0x96,0x3B,0xDF,0xFF,0x00,0x95,0xFF,0xFF,0x89,0xCF,0x3F,0xFF,0x00,0x95,0xFF,0xFF,0x96,0x3B,0xDF,0xFF,0x00,0x3B,0xDF,0xD5,0x83,0x00,0x00,0x00,0x00,0x3B,0xDF,0x55,0x96,0x3B,0xDF,0xFF,0x00,0x95,0xFF,0xFF,0x89,0xC7,0x3F,0xFF,0x00,0x95,0xFF,0xFF,0x96,0x3B,0xDF,0xFF,0x00,0x3B,0xBF,0x6F,0x83,0x00,0x00,0x00,0x01,0x44,0x1F,0x04,0x3B,
+    0xBF,0xDF,0x95,0x3B,0xBF,0xFF,0x00,0x95,0xDF,0xFF,0x89,0xC7,0x3F,0xFF,0x00,0x95,0xDF,0xFF,0x95,0x3B,0xBF,0xFF,0x01,0x3B,0xBF,0xEA,0x43,0xBF,0x0B,0x84,0x00,0x00,0x00,0x00,0x3B,0xBF,0x5E,0x95,0x3B,0xBF,0xFF,0x00,0x8D,0xDF,0xFF,0x89,0xBF,0x3F,0xFF,0x00,0x8D,0xDF,0xFF,0x95,0x3B,0xBF,0xFF,0x00,0x3B,0x9F,0x7C,0x85,0x00,0x00,0x00,0x01,0x52,0xBF,0x03,0x3B,0x9F,0xD3,0x94,0x3B,0x9F,0xFF,0x00,0x8D,0xDF,0xFF,0x89,0xBF,0x1F,0xFF,0x00,0x8D,0xDF,0xFF,0x94,0x3B,0x9F,0xFF,0x01,0x3B,0x9F,0xE5,0x3B,0xBF,0x0D,0x86,0x00,0x00,0x00,0x01,0x43,0x7F,0x3E,0x43,0x9F,0xFE,0x93,0x43,0x9F,0xFF,0x00,0x8D,0xBF,0xFF,0x89,0xBF,0x1F,0xFF,0x00,0x8D,0xBF,0xFF,0x94,0x43,0x9F,0xFF,0x00,0x3B,0x9F,0x59,0x88,0x00,0x00,0x00,0x00,0x43,0x7F,0x97,0x93,0x43,0x9F,0xFF,0x00,0x8D,0xBF,0xFF,0x89,0xB7,0x1F,0xFF,0x00,0x8D,0xBF,0xFF,0x93,0x43,0x9F,0xFF,0x01,0x43,0x9F,0xBD,0x00,0x1F,0x01,0x88,0x00,0x00,0x00,0x01,0x4B,0x7F,0x0E,0x43,0x7F,0xDA,0x92,0x43,0x7F,0xFF,0x00,0x8D,0xBF,0xFF,0x89,0xB6,0xFF,0xFF,
+    0x00,0x8D,0xBF,0xFF,0x92,0x43,0x7F,0xFF,0x01,0x43,0x7F,0xEB,0x43,0x7F,0x1C,0x8A,0x00,0x00,0x00,0x01,0x43,0x7F,0x2D,0x43,0x7F,0xF5,0x91,0x43,0x7F,0xFF,0x00,0x74,0xDF,0xFF,0x89,0xB6,0xFF,0xFF,0x00,0x74,0xDF,0xFF,0x91,0x43,0x7F,0xFF,0x01,0x43,0x7F,0xFE,0x43,0x5F,0x4F,0x8C,0x00,0x00,0x00,0x00,0x43,0x5F,0x77,0x91,0x43,0x5F,0xFF,0x01,0x43,0x7F,0xFF,0x74,0xDF,0xFF,0x87,0x85,0x7F,0xFF,0x01,0x74,0xDF,0xFF,0x43,0x7F,0xFF,0x91,0x43,0x5F,0xFF,0x00,0x43,0x5F,0x7F,0x8D,0x00,0x00,0x00,0x00,0x4B,0x5F,0x60,0xAE,0x43,0x5F,0xFF,0x00,0x4B,0x5F,0x99,0x8E,0x00,0x00,0x00,0x00,0x4B,0x3F,0x63,0xAD,0x4B,0x3F,0xFF,0x01,0x4B,0x5F,0xAA,0x52,0xBF,0x03,0x8E,0x00,0x00,0x00,0x00,0x4B,0x3F,0x7F,0xAC,0x4B,0x3F,0xFF,0x01,0x4B,0x3F,0x98,0x52,0xBF,0x03,0x8F,0x00,0x00,0x00,0x00,0x4B,0x1F,0xC8,0xAA,0x4B,0x3F,0xFF,0x01,0x4B,0x3F,0xFE,0x4B,0x3F,0x7F,0x90,0x00,0x00,0x00,0x00,0x4B,0x3F,0x4A,0xAA,0x4B,0x1F,0xFF,0x01,0x4B,0x1F,0xEB,0x4B,0x1F,0x4B,0x90,0x00,0x00,0x00,0x01,0x4A,0xFF,0x2B,0x4B,
+    0x1F,0xEB,0xA9,0x4B,0x1F,0xFF,0x01,0x4B,0x1F,0xBD,0x53,0x3F,0x1C,0x8F,0x00,0x00,0x00,0x02,0x4A,0xDF,0x0E,0x4A,0xFF,0x71,0x4A,0xFF,0xF2,0x89,0x4A,0xFF,0xFF,0x00,0x4A,0xFF,0xFA,0x9D,0x4A,0xFF,0xFF,0x01,0x4A,0xFF,0xE5,0x52,0xFF,0x59,0x8E,0x00,0x00,0x00,0x03,0x4B,0x1F,0x2D,0x52,0xFF,0xAA,0x52,0xFF,0xD2,0x52,0xFF,0xF8,0x8A,0x52,0xFF,0xFF,0x03,0x52,0xFF,0xB1,0x52,0xFF,0x16,0x52,0xFF,0x4F,0x52,0xFF,0xC9,0x99,0x52,0xFF,0xFF,0x02,0x52,0xFF,0xEB,0x52,0xFF,0x7C,0x4B,0x1F,0x0D,0x8F,0x00,0x00,0x00,0x00,0x52,0xFF,0xD6,0x8B,0x52,0xFF,0xFF,0x01,0x52,0xFF,0xEA,0x52,0xFF,0x66,0x83,0x00,0x00,0x00,0x02,0x52,0xFF,0x45,0x52,0xFF,0xB7,0x52,0xFF,0xFB,0x94,0x52,0xFF,0xFF,0x02,0x52,0xFF,0xD3,0x52,0xFF,0x6F,0x5A,0xFF,0x0B,0x91,0x00,0x00,0x00,0x00,0x52,0xDF,0xEA,0x89,0x52,0xDF,0xFF,0x02,0x52,0xDF,0xE1,0x52,0xDF,0x6E,0x4B,0x3F,0x0A,0x86,0x00,0x00,0x00,0x03,0x5A,0xDF,0x14,0x52,0xDF,0x65,0x52,0xDF,0xBB,0x52,0xDF,0xFB,0x8D,0x52,0xDF,0xFF,0x03,0x52,0xDF,0xFD,0x52,0xDF,0xD0,0x52,
+    0xDF,0x89,0x52,0xFF,0x2F,0x94,0x00,0x00,0x00,0x01,0x52,0xDF,0x57,0x52,0xDF,0xEA,0x83,0x52,0xDF,0xFF,0x05,0x52,0xDF,0xE9,0x52,0xDF,0xD3,0x52,0xDF,0xB6,0x52,0xDF,0x78,0x52,0xBF,0x32,0x00,0x1F,0x01,0x8B,0x00,0x00,0x00,0x0F,0x52,0xBF,0x09,0x52,0xDF,0x39,0x52,0xDF,0x6C,0x52,0xDF,0x9F,0x52,0xDF,0xC3,0x52,0xDF,0xD4,0x52,0xDF,0xE5,0x52,0xDF,0xF6,0x52,0xDF,0xF9,0x52,0xDF,0xEE,0x52,0xDF,0xDD,0x52,0xDF,0xCA,0x52,0xDF,0xA4,0x52,0xDF,0x7D,0x52,0xDF,0x51,0x52,0xFF,0x13,0x97,0x00,0x00,0x00,
     };
 const lv_img_dsc_t ui_img_info_png = {
    .header.always_zero = 0,
    .header.w = 64,
    .header.h = 64,
    .data_size = sizeof(ui_img_info_png_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+   .header.cf = LV_IMG_CF_USER_ENCODED_1,
    .data = ui_img_info_png_data};
 
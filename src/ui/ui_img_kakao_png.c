@@ -11,28 +11,13 @@
 
 // IMAGE DATA: assets\kakao.png
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_kakao_png_data[] = {
-0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0x43,0x89,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,
-    0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,
-    0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,
-    0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,
-    0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,
-    0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,
-    0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,
-    0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0x43,0x89,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xCF,0x0B,0xCF,0x0B,0xCF,0x0B,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
+    0x4A,0x71,0x42,0xFF,0x5A,0xE3,0xCE,0xFF,0x00,0x00,0x00,0x00,0x00,0x3F,0xFC,0x00,0x01,0xFF,0xFF,0x80,0x07,0xFF,0xFF,0xE0,0x0F,0xFF,0xFF,0xF0,0x1F,0xFF,0xFF,0xF8,0x3F,0xFF,0xFF,0xFC,0x7F,0xFF,0xFF,0xFE,0x7F,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xF7,0xBD,0xDF,0xFF,0xFF,0xBD,0xFF,0xFF,0xFF,0xBF,0x7F,0xFF,0xFF,0xBF,0x7F,0xFF,0xFD,0xBD,0xBF,0xFF,0xFF,0xBD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0xFF,0xFF,0xFE,0x7F,0xFF,0xFF,0xFE,0x3F,0xFF,0xFF,0xFC,0x1F,0xFF,0xFF,0xF8,0x0F,0xFF,0xFF,0xF0,0x03,0xFF,0xFF,0xC0,0x03,0xFF,0xFF,0x00,0x03,0xFF,0xF8,0x00,0x03,0xF8,0x00,0x00,0x03,0xE0,0x00,0x00,0x07,0xC0,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
     };
 const lv_img_dsc_t ui_img_kakao_png = {
    .header.always_zero = 0,
    .header.w = 32,
    .header.h = 32,
    .data_size = sizeof(ui_img_kakao_png_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR,
+   .header.cf = LV_IMG_CF_INDEXED_1BIT,
    .data = ui_img_kakao_png_data};
 
@@ -11,28 +11,13 @@
 
 // IMAGE DATA: assets\mail.png
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_mail_png_data[] = {
-0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
+    0xF7,0x96,0x21,0xFF,0x4A,0x71,0x42,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x03,0xFF,0xFF,0xC0,0x00,0xFF,0xFF,0x80,0x00,0x7F,0xFF,0x01,0xC0,0x3F,0xFE,0x0F,0xF8,0x3F,0xFC,0x1E,0x1C,0x1F,0xFC,0x38,0x06,0x1F,0xF8,0x30,0x02,0x0F,0xF8,0x70,0x03,0x0F,0xF8,0x60,0x83,0x0F,0xF0,0x61,0x83,0x0F,0xF0,0xC1,0x83,0x0F,0xF0,0xC1,0x83,0x0F,0xF0,0xC1,0x87,0x0F,0xF0,0xC3,0x87,0x0F,0xF0,0xC1,0x86,0x0F,0xF0,0xC1,0x06,0x1F,0xF0,0x40,0x00,0x1F,0xF0,0x60,0x00,0x3F,0xF8,0x30,0x00,0x7F,0xF8,0x3D,0xF1,0xFF,0xFC,0x0F,0xFF,0xFF,0xFC,0x00,0x07,0xFF,0xFE,0x00,0x07,0xFF,0xFF,0x80,0x07,0xFF,0xFF,0xC0,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
     };
 const lv_img_dsc_t ui_img_mail_png = {
    .header.always_zero = 0,
    .header.w = 32,
    .header.h = 32,
    .data_size = sizeof(ui_img_mail_png_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR,
+   .header.cf = LV_IMG_CF_INDEXED_1BIT,
    .data = ui_img_mail_png_data};
 
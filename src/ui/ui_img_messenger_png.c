@@ -10,29 +10,17 @@
 #endif
 
 // IMAGE DATA: assets\messenger.png
+// Run length encoded LV_IMG_CF_TRUE_COLOR, decoded by src/img_cache.cpp
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_messenger_png_data[] = {
-0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,
-    0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x1C,0xBE,0x1C,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x1C,0xBE,0x1C,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,
-    0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x1C,0xBE,0x4D,0x5E,0x4D,0x5E,0x1C,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x1C,0xBE,0x24,0xBE,0x4D,0x5E,0x4D,0x5E,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x1C,0xBE,0x55,0x7E,0xDF,0x7F,0xDF,0x7F,0x65,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x1C,0xBE,0x24,0xBE,0x4D,0x5E,0xA6,0x9E,0xEF,0x9F,0x96,0x5E,0x1C,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,
-    0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x1C,0xBE,0x55,0x7E,0xDF,0x7F,0xFF,0xFF,0xFF,0xFF,0xEF,0x9F,0x86,0x1E,0x24,0xBE,0x1C,0xBE,0x1C,0xBE,0x1C,0xBE,0x35,0x1E,0x96,0x5E,0xDF,0x7F,0xFF,0xFF,0xB6,0xDF,0x35,0x1E,0x1C,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x1C,0xBE,0x55,0x7E,0xDF,0x7F,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xF7,0xDF,0x96,0x5E,0x2C,0xDE,0x35,0x1E,0x86,0x1E,0xDF,0x7F,0xFF,0xFF,0xFF,0xFF,0xB6,0xDF,0x35,0x1E,0x1C,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,
-    0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x1C,0xBE,0x55,0x7E,0xDF,0x7F,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xB6,0xDF,0xCF,0x3F,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xB6,0xDF,0x35,0x1E,0x1C,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x1C,0xBE,0x55,0x7E,0xDF,0x7F,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xB6,0xDF,0x35,0x1E,0x1C,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,
-    0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x1C,0xBE,0x55,0x7E,0xDF,0x7F,0xFF,0xFF,0xFF,0xFF,0xEF,0x9F,0x96,0x5E,0x86,0x1E,0xEF,0x9F,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xB6,0xDF,0x35,0x1E,0x1C,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x1C,0xBE,0x55,0x7E,0xDF,0x7F,0xFF,0xFF,0xEF,0x9F,0xA6,0x9E,0x4D,0x5E,0x24,0xBE,0x1C,0xBE,0x65,0xBE,0xDF,0x7F,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xB6,0xDF,0x35,0x1E,0x1C,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,
-    0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x1C,0xBE,0x55,0x7E,0xDF,0x7F,0xF7,0xDF,0xB6,0xDF,0x55,0x7E,0x24,0xBE,0x1C,0xBE,0x24,0xBE,0x24,0xBE,0x1C,0xBE,0x4D,0x5E,0xCF,0x3F,0xFF,0xFF,0xFF,0xFF,0xB6,0xDF,0x35,0x1E,0x1C,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x1C,0xBE,0x96,0x5E,0xC7,0x1F,0x65,0xBE,0x2C,0xDE,0x1C,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x35,0x1E,0xB6,0xDF,0xB6,0xDF,0x35,0x1E,0x1C,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,
-    0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x2C,0xDE,0x2C,0xDE,0x1C,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x2C,0xDE,0x2C,0xDE,0x1C,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,
-    0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0xBE,0x24,0xBE,0x24,0xBE,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
+    0x88,0x43,0x89,0x8D,0x24,0xBE,0x8F,0x43,0x89,0x91,0x24,0xBE,0x8C,0x43,0x89,0x93,0x24,0xBE,0x8A,0x43,0x89,0x95,0x24,0xBE,0x88,0x43,0x89,0x97,0x24,0xBE,0x86,0x43,0x89,0x99,0x24,0xBE,0x84,0x43,0x89,0x9B,0x24,0xBE,0x82,0x43,0x89,0x9D,0x24,0xBE,0x81,0x43,0x89,0x9D,0x24,0xBE,0x00,0x43,0x89,0x8C,0x24,0xBE,0x81,0x1C,0xBE,0x89,0x24,0xBE,0x81,0x1C,0xBE,0x90,0x24,0xBE,0x00,0x1C,0xBE,0x81,0x4D,0x5E,0x00,0x1C,0xBE,0x86,0x24,0xBE,0x01,0x1C,0xBE,0x24,0xBE,0x81,0x4D,0x5E,0x8F,0x24,0xBE,0x01,0x1C,0xBE,0x55,0x7E,0x81,0xDF,0x7F,0x00,0x65,0xBE,0x84,0x24,0xBE,0x06,0x1C,0xBE,0x24,0xBE,0x4D,0x5E,0xA6,0x9E,0xEF,0x9F,0x96,0x5E,0x1C,0xBE,0x8D,0x24,0xBE,0x02,0x1C,0xBE,0x55,0x7E,0xDF,0x7F,0x81,0xFF,0xFF,0x02,0xEF,0x9F,0x86,0x1E,0x24,0xBE,0x82,0x1C,0xBE,0x06,0x35,0x1E,0x96,0x5E,0xDF,0x7F,0xFF,0xFF,0xB6,0xDF,0x35,0x1E,0x1C,0xBE,0x8C,0x24,0xBE,0x03,0x1C,0xBE,0x55,0x7E,0xDF,0x7F,0xFF,0xFF,0x81,0xFF,0xDF,0x06,0xFF,0xFF,0xF7,0xDF,0x96,0x5E,0x2C,0xDE,0x35,0x1E,0x86,0x1E,0xDF,0x7F,
+    0x81,0xFF,0xFF,0x02,0xB6,0xDF,0x35,0x1E,0x1C,0xBE,0x8C,0x24,0xBE,0x03,0x1C,0xBE,0x55,0x7E,0xDF,0x7F,0xFF,0xFF,0x85,0xFF,0xDF,0x02,0xB6,0xDF,0xCF,0x3F,0xFF,0xDF,0x81,0xFF,0xFF,0x02,0xB6,0xDF,0x35,0x1E,0x1C,0xBE,0x8C,0x24,0xBE,0x03,0x1C,0xBE,0x55,0x7E,0xDF,0x7F,0xFF,0xFF,0x86,0xFF,0xDF,0x81,0xFF,0xFF,0x04,0xFF,0xDF,0xFF,0xFF,0xB6,0xDF,0x35,0x1E,0x1C,0xBE,0x8C,0x24,0xBE,0x02,0x1C,0xBE,0x55,0x7E,0xDF,0x7F,0x81,0xFF,0xFF,0x04,0xEF,0x9F,0x96,0x5E,0x86,0x1E,0xEF,0x9F,0xFF,0xFF,0x83,0xFF,0xDF,0x03,0xFF,0xFF,0xB6,0xDF,0x35,0x1E,0x1C,0xBE,0x8C,0x24,0xBE,0x0B,0x1C,0xBE,0x55,0x7E,0xDF,0x7F,0xFF,0xFF,0xEF,0x9F,0xA6,0x9E,0x4D,0x5E,0x24,0xBE,0x1C,0xBE,0x65,0xBE,0xDF,0x7F,0xFF,0xFF,0x81,0xFF,0xDF,0x03,0xFF,0xFF,0xB6,0xDF,0x35,0x1E,0x1C,0xBE,0x8C,0x24,0xBE,0x07,0x1C,0xBE,0x55,0x7E,0xDF,0x7F,0xF7,0xDF,0xB6,0xDF,0x55,0x7E,0x24,0xBE,0x1C,0xBE,0x81,0x24,0xBE,0x02,0x1C,0xBE,0x4D,0x5E,0xCF,0x3F,0x81,0xFF,0xFF,0x02,0xB6,0xDF,0x35,0x1E,0x1C,0xBE,0x8D,0x24,0xBE,0x05,0x1C,
+    0xBE,0x96,0x5E,0xC7,0x1F,0x65,0xBE,0x2C,0xDE,0x1C,0xBE,0x85,0x24,0xBE,0x00,0x35,0x1E,0x81,0xB6,0xDF,0x01,0x35,0x1E,0x1C,0xBE,0x8F,0x24,0xBE,0x81,0x2C,0xDE,0x00,0x1C,0xBE,0x88,0x24,0xBE,0x81,0x2C,0xDE,0x00,0x1C,0xBE,0xAA,0x24,0xBE,0x81,0x43,0x89,0x9D,0x24,0xBE,0x82,0x43,0x89,0x9B,0x24,0xBE,0x83,0x43,0x89,0x9B,0x24,0xBE,0x84,0x43,0x89,0x99,0x24,0xBE,0x86,0x43,0x89,0x97,0x24,0xBE,0x88,0x43,0x89,0x95,0x24,0xBE,0x89,0x43,0x89,0x94,0x24,0xBE,0x8A,0x43,0x89,0x92,0x24,0xBE,0x8C,0x43,0x89,0x90,0x24,0xBE,0x8E,0x43,0x89,0x82,0x24,0xBE,0x97,0x43,0x89,
     };
 const lv_img_dsc_t ui_img_messenger_png = {
    .header.always_zero = 0,
    .header.w = 32,
    .header.h = 32,
    .data_size = sizeof(ui_img_messenger_png_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR,
+   .header.cf = LV_IMG_CF_USER_ENCODED_0,
    .data = ui_img_messenger_png_data};
 
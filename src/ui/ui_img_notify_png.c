@@ -10,77 +10,34 @@
 #endif
 
 // IMAGE DATA: assets\notify.png
+// Run length encoded LV_IMG_CF_TRUE_COLOR_ALPHA, decoded by src/img_cache.cpp
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_notify_png_data[] = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC9,0xA5,0x18,0xD1,0xC5,0x53,0xD1,0xC5,0x82,0xC9,0xC5,0xAB,0xD1,0xC5,0xCD,0xD1,0xC5,0xE3,0xD1,0xC5,0xF7,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xF2,0xD1,0xC5,0xE3,0xD1,0xC5,0xCB,0xD1,0xC5,0xAA,0xD1,0xC5,0x84,0xD1,0xE5,0x50,0xD9,0xC6,0x1A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0xC9,0xC5,0x3B,0xC9,0xC5,0x8B,0xC9,0xC5,0xD9,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xD4,0xD1,0xC6,0x8B,0xD1,0xE5,0x37,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD1,0xE5,0x11,0xC9,0xC5,0x76,0xC9,0xC5,0xDA,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xE5,0xD6,0xD9,0xC5,0x71,0xD9,0xC4,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD1,0xE5,0x11,0xC9,0xC5,0x85,0xC9,0xC5,0xF1,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xEF,0xD9,0xE5,0x84,0xD9,0xA6,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0xAA,0x03,0xC9,0xA5,0x6A,0xC9,0xC5,0xEC,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xEA,0xD9,0xC6,0x68,0xF8,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC9,0xA5,0x25,0xC9,0xA5,0xC6,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xC2,0xD9,0xE6,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC9,0xA5,0x5D,0xC9,0xC5,0xF5,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xF3,0xD9,0xE6,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0xAA,0x03,0xC9,0xC5,0x90,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0x8E,0xF8,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD1,0x45,0x06,0xC9,0xC5,0xAB,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xE1,0xE6,0xAB,0xDA,0x44,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD1,0x45,0x06,0xC9,0xC5,0xB7,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xE1,0xE6,0xB3,0xD1,0x45,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0xAA,0x03,0xC9,0xC5,0xAB,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xAC,0xF8,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC9,0xC5,0x90,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC9,0xA5,0x5D,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC9,0xA5,0x22,0xC9,0xC5,0xF3,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xE6,0xFF,0xDC,0xB2,0xFF,0xD6,0x38,0xFF,0xFF,0x3C,0xFF,0xED,0x13,0xFF,0xDA,0x06,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xF3,0xE1,0xE5,0x26,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAA,0xAA,0x03,0xC9,0xA5,0xC6,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xDC,0xB1,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE4,0x92,0xFF,0xD9,0xC5,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xC4,0xF8,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC9,0xA5,0x6B,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD5,0xF7,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xBA,0xFF,0xC1,0x24,0xFF,0xD9,0xC5,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE2,0x06,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD1,0xE5,0x11,0xC9,0xC5,0xEC,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD9,0xC5,0xFF,0xD6,0x59,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFF,0xB0,0xE3,0xFF,0xC1,0x24,0xFF,0xD9,0xC5,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xEB,0xE9,0xA6,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC9,0xA5,0x86,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xDA,0xEA,0xFF,0xD4,0xB2,0xFF,0xD6,0x99,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDC,0x92,0xFF,0xC2,0x28,0xFF,0xC1,0x24,0xFF,0xD9,0xE5,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE2,0x06,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xD1,0xE5,0x11,0xC9,0xC5,0xF1,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD2,0xCA,0xFF,0xD5,0x95,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xED,0xF7,0xFF,0xCA,0x48,0xFF,0xD9,0xE5,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xF1,0xE9,0xA6,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xC9,0xC5,0x76,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xDB,0xCE,0xFF,0xD6,0x79,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDB,0xAE,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE9,0xE6,0x6F,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xF8,0x00,0x01,0xC9,0xC5,0xD9,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD4,0x0F,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDB,0xCF,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xEA,0x06,0xD8,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xC9,0xC5,0x3B,0xC9,0xC5,0xFF,0xC9,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xDB,0x4B,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xD2,0xCA,0xFF,0xD9,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0x34,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xD1,0xC5,0x8C,0xC9,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xE6,0xFF,0xD5,0xF7,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xDB,0xFF,0xC1,0x64,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0x8C,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xC9,0xC5,0xDA,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xDC,0x0F,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD3,0x8E,0xFF,0xC9,0x44,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xD3,0x00,0x00,0x00,
-    0xC9,0xA5,0x18,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD9,0xC5,0xFF,0xD5,0xD6,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEE,0x59,0xFF,0xB9,0x03,0xFF,0xC9,0x44,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFE,0xE9,0xE6,0x19,
-    0xD1,0xC5,0x53,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD9,0xC5,0xFF,0xD2,0x88,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC1,0xC6,0xFF,0xB9,0x03,0xFF,0xC9,0x44,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0x50,
-    0xD1,0xC5,0x82,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xDB,0xCE,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD3,0x4D,0xFF,0xB9,0x03,0xFF,0xB9,0x04,0xFF,0xC9,0x64,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0x80,
-    0xD1,0xC5,0xAC,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xDC,0xB2,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDC,0x92,0xFF,0xB9,0x04,0xFF,0xC1,0x04,0xFF,0xC1,0x24,0xFF,0xC9,0x64,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xAA,
-    0xD1,0xC5,0xCC,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xE5,0xFF,0xD5,0x13,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE5,0x34,0xFF,0xC1,0x04,0xFF,0xC1,0x24,0xFF,0xC1,0x24,0xFF,0xC1,0x24,0xFF,0xD1,0x65,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xC8,
-    0xD1,0xC5,0xE3,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD5,0x54,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xED,0x96,0xFF,0xC1,0x24,0xFF,0xC1,0x24,0xFF,0xC1,0x24,0xFF,0xC1,0x24,0xFF,0xC1,0x24,0xFF,0xD1,0x85,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xE3,
-    0xD1,0xC5,0xF5,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD5,0x54,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xED,0xB6,0xFF,0xC1,0x24,0xFF,0xC1,0x24,0xFF,0xC1,0x24,0xFF,0xC1,0x24,0xFF,0xC1,0x44,0xFF,0xC9,0x44,0xFF,0xD1,0x85,0xFF,0xE9,0xE6,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xF0,
-    0xD1,0xC5,0xFB,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE6,0xFF,0xDD,0x54,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xED,0xB6,0xFF,0xC1,0x24,0xFF,0xC1,0x24,0xFF,0xC1,0x24,0xFF,0xC1,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xD1,0x85,0xFF,0xE9,0xE6,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFA,
-    0xD1,0xC5,0xFD,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xDD,0x54,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xED,0xB6,0xFF,0xC1,0x24,0xFF,0xC1,0x24,0xFF,0xC1,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x64,0xFF,0xD9,0x85,0xFF,0xE9,0xE6,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xF9,
-    0xD1,0xC5,0xF3,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xDD,0x54,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xED,0xB6,0xFF,0xC1,0x24,0xFF,0xC1,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x64,0xFF,0xC9,0x64,0xFF,0xC9,0x64,0xFF,0xD9,0xA5,0xFF,0xE9,0xE6,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xEC,
-    0xD1,0xC5,0xE4,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xDD,0x54,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xED,0xB6,0xFF,0xC1,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x64,0xFF,0xC9,0x64,0xFF,0xC9,0x64,0xFF,0xD1,0x65,0xFF,0xD1,0x65,0xFF,0xD9,0xA5,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xE0,
-    0xD1,0xC5,0xCB,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xDD,0x54,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xED,0xB6,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x64,0xFF,0xC9,0x64,0xFF,0xC9,0x64,0xFF,0xD1,0x65,0xFF,0xD1,0x65,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD9,0xA5,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xC9,
-    0xD1,0xC5,0xAA,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xDD,0x54,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xED,0xB6,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x64,0xFF,0xC9,0x64,0xFF,0xC9,0x64,0xFF,0xD1,0x65,0xFF,0xD1,0x65,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD9,0xC5,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xA4,
-    0xD1,0xC5,0x84,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xDD,0x54,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xED,0xB6,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x64,0xFF,0xC9,0x64,0xFF,0xC9,0x64,0xFF,0xD1,0x65,0xFF,0xD1,0x65,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD9,0x85,0xFF,0xD9,0xA5,0xFF,0xE1,0xC5,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0x81,
-    0xD1,0xE5,0x50,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xDD,0x54,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xED,0xB6,0xFF,0xC9,0x44,0xFF,0xC9,0x64,0xFF,0xC9,0x64,0xFF,0xC9,0x64,0xFF,0xD1,0x65,0xFF,0xD1,0x65,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD9,0x85,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xE1,0xC6,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xF2,0x06,0xFF,0xEA,0x06,0x51,
-    0xD9,0xC6,0x1A,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xDA,0x47,0xFF,0xD6,0x18,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xFB,0xFF,0xC9,0xC6,0xFF,0xC9,0x64,0xFF,0xC9,0x64,0xFF,0xD1,0x65,0xFF,0xD1,0x65,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD9,0x85,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xE1,0xA5,0xFF,0xE1,0xE6,0xFF,0xEA,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFE,0xF1,0xE6,0x15,
-    0x00,0x00,0x00,0xD1,0xC5,0xD4,0xD1,0xC5,0xFF,0xD1,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xDA,0x47,0xFF,0xD5,0xD7,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xBA,0xFF,0xD1,0xE6,0xFF,0xD1,0x65,0xFF,0xD1,0x65,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD9,0x85,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xE1,0xA5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC5,0xFF,0xE9,0xE6,0xFF,0xEA,0x06,0xFF,0xF2,0x06,0xD5,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xD1,0xC6,0x8B,0xD1,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xDA,0x47,0xFF,0xD5,0xD7,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xDA,0xFF,0xD1,0xE7,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD9,0x85,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xE1,0xA5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC6,0xFF,0xE1,0xC6,0xFF,0xE9,0xE6,0xFF,0xF2,0x06,0x88,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xD1,0xE5,0x37,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xC5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xDA,0x47,0xFF,0xD5,0xD7,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF6,0xDA,0xFF,0xD2,0x07,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD9,0x85,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xE1,0xA5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC6,0xFF,0xE1,0xC6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xEA,0x06,0x37,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xD9,0xE5,0xD6,0xD9,0xC5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xDC,0xD2,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEC,0xF3,0xFF,0xD1,0x85,0xFF,0xD9,0x85,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xE1,0xA5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC6,0xFF,0xE1,0xC6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xD9,0xC5,0x71,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE5,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xDC,0xD2,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xED,0x13,0xFF,0xD9,0x85,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xE1,0xA5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC6,0xFF,0xE1,0xC6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0x75,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xD9,0xC4,0x0D,0xD9,0xE5,0xEF,0xD9,0xE5,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xDA,0x27,0xFF,0xB9,0xE7,0xFF,0xB9,0xC7,0xFF,0xB9,0xE7,0xFF,0xB9,0xE7,0xFF,0xB9,0xE7,0xFF,0xC1,0xE7,0xFF,0xC1,0xE7,0xFF,0xC2,0x07,0xFF,0xC2,0x07,0xFF,0xC2,0x07,0xFF,0xC2,0x08,0xFF,0xC2,0x08,0xFF,0xC2,0x08,0xFF,0xCA,0x08,0xFF,0xCA,0x28,0xFF,0xCA,0x28,0xFF,0xCA,0x28,0xFF,0xCA,0x28,0xFF,0xD2,0x28,0xFF,0xD2,0x28,0xFF,0xD2,0x28,0xFF,0xD2,0x48,0xFF,0xD2,0x48,0xFF,0xD2,0x48,0xFF,0xD2,0x48,0xFF,0xDA,0x48,0xFF,0xDA,0x68,0xFF,0xDA,0x68,0xFF,0xDA,0x68,0xFF,0xDA,0x68,0xFF,0xDA,0x07,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xE1,0xA5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC6,0xFF,0xE1,0xC6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xF2,0xEA,0x26,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD9,0xE5,0x84,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD1,0xA5,0xFF,0xB9,0x03,0xFF,0xB8,0xE3,0xFF,0xB8,0xE3,0xFF,0xB9,0x03,0xFF,0xB9,0x03,0xFF,0xB9,0x03,0xFF,0xB9,0x03,0xFF,0xB9,0x04,0xFF,0xC1,0x04,0xFF,0xC1,0x24,0xFF,0xC1,0x24,0xFF,0xC1,0x24,0xFF,0xC1,0x24,0xFF,0xC1,0x24,0xFF,0xC1,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x64,0xFF,0xC9,0x64,0xFF,0xC9,0x64,0xFF,0xD1,0x65,0xFF,0xD1,0x65,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD9,0x85,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xE1,0xA5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC6,0xFF,0xE1,0xC6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xEA,0x06,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD9,0xC4,0x0D,0xD9,0xE6,0xE8,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xD9,0xA5,0xFF,0xB9,0x03,0xFF,0xB9,0x03,0xFF,0xB9,0x03,0xFF,0xB9,0x03,0xFF,0xB9,0x03,0xFF,0xB9,0x04,0xFF,0xC1,0x04,0xFF,0xC1,0x24,0xFF,0xC1,0x24,0xFF,0xD5,0xB6,0xFF,0xD6,0x59,0xFF,0xD6,0x59,0xFF,0xD6,0x59,0xFF,0xFF,0x9E,0xFF,0xFF,0x9E,0xFF,0xFF,0x9E,0xFF,0xF6,0x9A,0xFF,0xC9,0x64,0xFF,0xC9,0x64,0xFF,0xC9,0x64,0xFF,0xD1,0x65,0xFF,0xD1,0x65,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD9,0x85,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xE1,0xA5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC6,0xFF,0xE1,0xC6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xEA,0x06,0xEB,0xEA,0x26,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD9,0xC6,0x68,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xD9,0xC5,0xFF,0xB9,0x04,0xFF,0xB9,0x03,0xFF,0xB9,0x03,0xFF,0xB9,0x04,0xFF,0xC1,0x04,0xFF,0xC1,0x24,0xFF,0xC1,0x24,0xFF,0xC1,0x24,0xFF,0xD5,0x13,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xED,0x75,0xFF,0xC9,0x64,0xFF,0xC9,0x64,0xFF,0xD1,0x65,0xFF,0xD1,0x65,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD9,0x85,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xE1,0xA5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC6,0xFF,0xE1,0xC6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0x6B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x02,0xD9,0xC6,0xC1,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xD9,0xC5,0xFF,0xC1,0x04,0xFF,0xB9,0x04,0xFF,0xC1,0x04,0xFF,0xC1,0x24,0xFF,0xC1,0x24,0xFF,0xC1,0x24,0xFF,0xC1,0x24,0xFF,0xCA,0x28,0xFF,0xD6,0x79,0xFF,0xD6,0x9A,0xFF,0xD6,0x9A,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0xFF,0xD2,0x48,0xFF,0xC9,0x64,0xFF,0xD1,0x65,0xFF,0xD1,0x65,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD9,0x85,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xE1,0xA5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC6,0xFF,0xE1,0xC6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xC7,0xFA,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD9,0xE6,0x25,0xD9,0xE6,0xF3,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xD9,0xC5,0xFF,0xC1,0x24,0xFF,0xC1,0x24,0xFF,0xC1,0x24,0xFF,0xC1,0x24,0xFF,0xC1,0x24,0xFF,0xC1,0x24,0xFF,0xC1,0x44,0xFF,0xCA,0x07,0xFF,0xD5,0x13,0xFF,0xD6,0x18,0xFF,0xFF,0x1C,0xFF,0xED,0x75,0xFF,0xD2,0x27,0xFF,0xC9,0x64,0xFF,0xD1,0x65,0xFF,0xD1,0x65,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD9,0x85,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xE1,0xA5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC6,0xFF,0xE1,0xC6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xF3,0xF2,0x06,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD9,0xE6,0x59,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xD9,0xC5,0xFF,0xC1,0x24,0xFF,0xC1,0x24,0xFF,0xC1,0x24,0xFF,0xC1,0x24,0xFF,0xC1,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x64,0xFF,0xC9,0x64,0xFF,0xC9,0x64,0xFF,0xD1,0x65,0xFF,0xD1,0x65,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD9,0x85,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xE1,0xA5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC6,0xFF,0xE1,0xC6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xEA,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0x5E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD9,0xE6,0x8E,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xD9,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xD9,0xC5,0xFF,0xC1,0x44,0xFF,0xC1,0x24,0xFF,0xC1,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x64,0xFF,0xC9,0x64,0xFF,0xC9,0x64,0xFF,0xD1,0x65,0xFF,0xD1,0x65,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD9,0x85,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xE1,0xA5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC6,0xFF,0xE1,0xC6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xEA,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0x8C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x02,0xE1,0xE6,0xAB,0xD9,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xD9,0xC5,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x64,0xFF,0xC9,0x64,0xFF,0xC9,0x64,0xFF,0xD1,0x65,0xFF,0xD1,0x65,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD9,0x85,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xE1,0xA5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC6,0xFF,0xE1,0xC6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xEA,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xB1,0xFA,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xDA,0x44,0x07,0xE1,0xE6,0xB4,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xC6,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x44,0xFF,0xC9,0x64,0xFF,0xC9,0x64,0xFF,0xC9,0x64,0xFF,0xD1,0x65,0xFF,0xD1,0x65,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD9,0x85,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xE1,0xA5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC6,0xFF,0xE1,0xC6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xEA,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xB4,0xFA,0xA5,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD1,0x45,0x06,0xE1,0xE6,0xAC,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xC6,0xFF,0xC9,0x64,0xFF,0xC9,0x64,0xFF,0xC9,0x64,0xFF,0xC9,0x64,0xFF,0xD1,0x65,0xFF,0xD1,0x65,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD9,0x85,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xE1,0xA5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC6,0xFF,0xE1,0xC6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xEA,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xB0,0xFA,0xA5,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0xE1,0xE6,0x80,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xE1,0xE6,0xFF,0xD1,0x64,0xFF,0xC9,0x64,0xFF,0xD1,0x65,0xFF,0xD1,0x65,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD9,0x85,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xE1,0xA5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC6,0xFF,0xE1,0xC6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xEA,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0x93,0xFC,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE1,0xE6,0x5B,0xE1,0xE6,0xF1,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xE1,0xE6,0xFF,0xD1,0x65,0xFF,0xD1,0x65,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD9,0x85,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xE1,0xA5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC6,0xFF,0xE1,0xC6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xF3,0xF2,0x06,0x5F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0x06,0x23,0xE1,0xE6,0xC4,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xE1,0xE6,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD1,0x85,0xFF,0xD9,0x85,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xE1,0xA5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC6,0xFF,0xE1,0xC6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xEA,0x06,0xFF,0xF2,0x06,0xC7,0xF2,0x06,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0xE2,0x06,0x64,0xE1,0xE6,0xEC,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xE1,0xE6,0xFF,0xD9,0x85,0xFF,0xD1,0x85,0xFF,0xD9,0x85,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xE1,0xA5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC6,0xFF,0xE1,0xC6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xEA,0x06,0xEB,0xEA,0x06,0x6A,0xFA,0xAA,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE9,0xA6,0x0E,0xE2,0x06,0x80,0xE1,0xE6,0xF1,0xE1,0xE6,0xFF,0xE1,0xE6,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xE9,0xE6,0xFF,0xD9,0x85,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xE1,0xA5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC6,0xFF,0xE1,0xC6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xF0,0xEA,0x06,0x8B,0xEA,0x06,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE9,0xA6,0x0E,0xE9,0xE6,0x6F,0xEA,0x06,0xD8,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xE9,0xE6,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xD9,0xA5,0xFF,0xE1,0xA5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC6,0xFF,0xE1,0xC6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xFF,0xE9,0xE6,0xDD,0xE9,0xE6,0x77,0xE9,0xA6,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEA,0x06,0x34,0xEA,0x06,0x8C,0xEA,0x06,0xD3,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xEA,0x06,0xFF,0xE9,0xE6,0xFF,0xE1,0xA5,0xFF,0xE1,0xA5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC5,0xFF,0xE1,0xC6,0xFF,0xE1,0xC6,0xFE,0xE9,0xE6,0xDA,0xE9,0xE6,0x94,0xEA,0x06,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEA,0x06,0x18,0xEA,0x06,0x50,0xEA,0x06,0x80,0xEA,0x06,0xAB,0xEA,0x06,0xC7,0xEA,0x06,0xE5,0xEA,0x06,0xEE,0xEA,0x06,0xFD,0xEA,0x06,0xFA,0xEA,0x06,0xEE,0xEA,0x06,0xE0,0xE1,0xC5,0xD5,0xE1,0xC6,0xB3,0xE1,0xE5,0x8C,0xE1,0xE6,0x5B,0xE9,0xA5,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x97,0x00,0x00,0x00,0x06,0xC9,0xA5,0x18,0xD1,0xC5,0x53,0xD1,0xC5,0x82,0xC9,0xC5,0xAB,0xD1,0xC5,0xCD,0xD1,0xC5,0xE3,0xD1,0xC5,0xF7,0x81,0xD1,0xC5,0xFF,0x06,0xD1,0xC5,0xF2,0xD1,0xC5,0xE3,0xD1,0xC5,0xCB,0xD1,0xC5,0xAA,0xD1,0xC5,0x84,0xD1,0xE5,0x50,0xD9,0xC6,0x1A,0xAB,0x00,0x00,0x00,0x03,0xF8,0x00,0x01,0xC9,0xC5,0x3B,0xC9,0xC5,0x8B,0xC9,0xC5,0xD9,0x8F,0xD1,0xC5,0xFF,0x02,0xD1,0xC5,0xD4,0xD1,0xC6,0x8B,0xD1,0xE5,0x37,0xA6,0x00,0x00,0x00,0x02,0xD1,0xE5,0x11,0xC9,0xC5,0x76,0xC9,0xC5,0xDA,0x81,0xC9,0xC5,0xFF,0x92,0xD1,0xC5,0xFF,0x03,0xD9,0xC5,0xFF,0xD9,0xE5,0xD6,0xD9,0xC5,0x71,0xD9,0xC4,0x0D,0xA1,0x00,0x00,0x00,0x02,0xD1,0xE5,0x11,0xC9,0xC5,0x85,0xC9,0xC5,0xF1,0x82,0xC9,0xC5,0xFF,0x92,0xD1,0xC5,0xFF,0x82,0xD9,0xC5,0xFF,0x03,0xD9,0xE5,0xFF,0xD9,0xE5,0xEF,0xD9,0xE5,0x84,0xD9,0xA6,0x0E,0x9D,0x00,0x00,0x00,0x02,0xAA,0xAA,0x03,0xC9,0xA5,0x6A,0xC9,0xC5,0xEC,0x83,0xC9,0xC5,0xFF,0x92,0xD1,0xC5,0xFF,0x82,0xD9,0xC5,0xFF,0x82,0xD9,0xE5,0xFF,0x03,0xD9,0xE6,0xFF,0xD9,
+    0xE6,0xEA,0xD9,0xC6,0x68,0xF8,0x00,0x02,0x9A,0x00,0x00,0x00,0x01,0xC9,0xA5,0x25,0xC9,0xA5,0xC6,0x84,0xC9,0xC5,0xFF,0x92,0xD1,0xC5,0xFF,0x82,0xD9,0xC5,0xFF,0x82,0xD9,0xE5,0xFF,0x83,0xD9,0xE6,0xFF,0x01,0xD9,0xE6,0xC2,0xD9,0xE6,0x25,0x98,0x00,0x00,0x00,0x01,0xC9,0xA5,0x5D,0xC9,0xC5,0xF5,0x84,0xC9,0xC5,0xFF,0x92,0xD1,0xC5,0xFF,0x82,0xD9,0xC5,0xFF,0x82,0xD9,0xE5,0xFF,0x85,0xD9,0xE6,0xFF,0x01,0xD9,0xE6,0xF3,0xD9,0xE6,0x59,0x95,0x00,0x00,0x00,0x01,0xAA,0xAA,0x03,0xC9,0xC5,0x90,0x85,0xC9,0xC5,0xFF,0x92,0xD1,0xC5,0xFF,0x82,0xD9,0xC5,0xFF,0x82,0xD9,0xE5,0xFF,0x88,0xD9,0xE6,0xFF,0x01,0xD9,0xE6,0x8E,0xF8,0x00,0x02,0x92,0x00,0x00,0x00,0x01,0xD1,0x45,0x06,0xC9,0xC5,0xAB,0x85,0xC9,0xC5,0xFF,0x92,0xD1,0xC5,0xFF,0x82,0xD9,0xC5,0xFF,0x82,0xD9,0xE5,0xFF,0x8A,0xD9,0xE6,0xFF,0x01,0xE1,0xE6,0xAB,0xDA,0x44,0x07,0x90,0x00,0x00,0x00,0x01,0xD1,0x45,0x06,0xC9,0xC5,0xB7,0x85,0xC9,0xC5,0xFF,0x92,0xD1,0xC5,0xFF,0x82,0xD9,0xC5,0xFF,0x82,0xD9,0xE5,0xFF,0x8C,0xD9,0xE6,0xFF,0x01,
+    0xE1,0xE6,0xB3,0xD1,0x45,0x06,0x8E,0x00,0x00,0x00,0x01,0xAA,0xAA,0x03,0xC9,0xC5,0xAB,0x85,0xC9,0xC5,0xFF,0x92,0xD1,0xC5,0xFF,0x82,0xD9,0xC5,0xFF,0x82,0xD9,0xE5,0xFF,0x8C,0xD9,0xE6,0xFF,0x81,0xE1,0xE6,0xFF,0x01,0xE1,0xE6,0xAC,0xF8,0x00,0x02,0x8D,0x00,0x00,0x00,0x00,0xC9,0xC5,0x90,0x85,0xC9,0xC5,0xFF,0x92,0xD1,0xC5,0xFF,0x82,0xD9,0xC5,0xFF,0x82,0xD9,0xE5,0xFF,0x8C,0xD9,0xE6,0xFF,0x83,0xE1,0xE6,0xFF,0x00,0xE1,0xE6,0x8A,0x8C,0x00,0x00,0x00,0x00,0xC9,0xA5,0x5D,0x85,0xC9,0xC5,0xFF,0x92,0xD1,0xC5,0xFF,0x82,0xD9,0xC5,0xFF,0x82,0xD9,0xE5,0xFF,0x8C,0xD9,0xE6,0xFF,0x85,0xE1,0xE6,0xFF,0x00,0xE1,0xE6,0x5A,0x8A,0x00,0x00,0x00,0x01,0xC9,0xA5,0x22,0xC9,0xC5,0xF3,0x84,0xC9,0xC5,0xFF,0x90,0xD1,0xC5,0xFF,0x05,0xD1,0xE6,0xFF,0xDC,0xB2,0xFF,0xD6,0x38,0xFF,0xFF,0x3C,0xFF,0xED,0x13,0xFF,0xDA,0x06,0xFF,0x81,0xD9,0xE5,0xFF,0x8C,0xD9,0xE6,0xFF,0x86,0xE1,0xE6,0xFF,0x01,0xE1,0xE6,0xF3,0xE1,0xE5,0x26,0x88,0x00,0x00,0x00,0x01,0xAA,0xAA,0x03,0xC9,0xA5,0xC6,0x84,0xC9,0xC5,0xFF,
+    0x91,0xD1,0xC5,0xFF,0x00,0xDC,0xB1,0xFF,0x81,0xD6,0x9A,0xFF,0x81,0xFF,0xFF,0xFF,0x01,0xE4,0x92,0xFF,0xD9,0xC5,0xFF,0x8C,0xD9,0xE6,0xFF,0x88,0xE1,0xE6,0xFF,0x01,0xE1,0xE6,0xC4,0xF8,0x00,0x02,0x87,0x00,0x00,0x00,0x00,0xC9,0xA5,0x6B,0x84,0xC9,0xC5,0xFF,0x92,0xD1,0xC5,0xFF,0x00,0xD5,0xF7,0xFF,0x81,0xD6,0x9A,0xFF,0x81,0xFF,0xFF,0xFF,0x02,0xF6,0xBA,0xFF,0xC1,0x24,0xFF,0xD9,0xC5,0xFF,0x8A,0xD9,0xE6,0xFF,0x8A,0xE1,0xE6,0xFF,0x00,0xE2,0x06,0x64,0x86,0x00,0x00,0x00,0x01,0xD1,0xE5,0x11,0xC9,0xC5,0xEC,0x83,0xC9,0xC5,0xFF,0x92,0xD1,0xC5,0xFF,0x01,0xD9,0xC5,0xFF,0xD6,0x59,0xFF,0x81,0xD6,0x9A,0xFF,0x81,0xFF,0xFF,0xFF,0x03,0xFF,0x5D,0xFF,0xB0,0xE3,0xFF,0xC1,0x24,0xFF,0xD9,0xC5,0xFF,0x88,0xD9,0xE6,0xFF,0x8B,0xE1,0xE6,0xFF,0x01,0xE1,0xE6,0xEB,0xE9,0xA6,0x0E,0x85,0x00,0x00,0x00,0x00,0xC9,0xA5,0x86,0x83,0xC9,0xC5,0xFF,0x92,0xD1,0xC5,0xFF,0x02,0xDA,0xEA,0xFF,0xD4,0xB2,0xFF,0xD6,0x99,0xFF,0x81,0xD6,0x9A,0xFF,0x81,0xFF,0xFF,0xFF,0x04,0xFF,0xDF,0xFF,0xDC,0x92,0xFF,0xC2,
+    0x28,0xFF,0xC1,0x24,0xFF,0xD9,0xE5,0xFF,0x86,0xD9,0xE6,0xFF,0x8D,0xE1,0xE6,0xFF,0x00,0xE2,0x06,0x80,0x84,0x00,0x00,0x00,0x01,0xD1,0xE5,0x11,0xC9,0xC5,0xF1,0x82,0xC9,0xC5,0xFF,0x91,0xD1,0xC5,0xFF,0x01,0xD2,0xCA,0xFF,0xD5,0x95,0xFF,0x84,0xD6,0x9A,0xFF,0x84,0xFF,0xFF,0xFF,0x02,0xED,0xF7,0xFF,0xCA,0x48,0xFF,0xD9,0xE5,0xFF,0x84,0xD9,0xE6,0xFF,0x8E,0xE1,0xE6,0xFF,0x01,0xE1,0xE6,0xF1,0xE9,0xA6,0x0E,0x83,0x00,0x00,0x00,0x00,0xC9,0xC5,0x76,0x82,0xC9,0xC5,0xFF,0x91,0xD1,0xC5,0xFF,0x01,0xDB,0xCE,0xFF,0xD6,0x79,0xFF,0x85,0xD6,0x9A,0xFF,0x85,0xFF,0xFF,0xFF,0x01,0xFF,0xDF,0xFF,0xDB,0xAE,0xFF,0x83,0xD9,0xE6,0xFF,0x90,0xE1,0xE6,0xFF,0x00,0xE9,0xE6,0x6F,0x82,0x00,0x00,0x00,0x01,0xF8,0x00,0x01,0xC9,0xC5,0xD9,0x81,0xC9,0xC5,0xFF,0x91,0xD1,0xC5,0xFF,0x00,0xD4,0x0F,0xFF,0x87,0xD6,0x9A,0xFF,0x87,0xFF,0xFF,0xFF,0x00,0xDB,0xCF,0xFF,0x81,0xD9,0xE6,0xFF,0x91,0xE1,0xE6,0xFF,0x00,0xEA,0x06,0xD8,0x82,0x00,0x00,0x00,0x00,0xC9,0xC5,0x3B,0x81,0xC9,0xC5,0xFF,0x91,0xD1,0xC5,0xFF,
+    0x00,0xDB,0x4B,0xFF,0x88,0xD6,0x9A,0xFF,0x87,0xFF,0xFF,0xFF,0x02,0xFF,0xDF,0xFF,0xD2,0xCA,0xFF,0xD9,0xE6,0xFF,0x90,0xE1,0xE6,0xFF,0x81,0xEA,0x06,0xFF,0x00,0xEA,0x06,0x34,0x81,0x00,0x00,0x00,0x01,0xD1,0xC5,0x8C,0xC9,0xC5,0xFF,0x91,0xD1,0xC5,0xFF,0x01,0xD1,0xE6,0xFF,0xD5,0xF7,0xFF,0x88,0xD6,0x9A,0xFF,0x88,0xFF,0xFF,0xFF,0x01,0xF6,0xDB,0xFF,0xC1,0x64,0xFF,0x8F,0xE1,0xE6,0xFF,0x82,0xEA,0x06,0xFF,0x00,0xEA,0x06,0x8C,0x81,0x00,0x00,0x00,0x00,0xC9,0xC5,0xDA,0x92,0xD1,0xC5,0xFF,0x00,0xDC,0x0F,0xFF,0x89,0xD6,0x9A,0xFF,0x89,0xFF,0xFF,0xFF,0x01,0xD3,0x8E,0xFF,0xC9,0x44,0xFF,0x8D,0xE1,0xE6,0xFF,0x83,0xEA,0x06,0xFF,0x02,0xEA,0x06,0xD3,0x00,0x00,0x00,0xC9,0xA5,0x18,0x92,0xD1,0xC5,0xFF,0x01,0xD9,0xC5,0xFF,0xD5,0xD6,0xFF,0x89,0xD6,0x9A,0xFF,0x89,0xFF,0xFF,0xFF,0x02,0xEE,0x59,0xFF,0xB9,0x03,0xFF,0xC9,0x44,0xFF,0x8B,0xE1,0xE6,0xFF,0x84,0xEA,0x06,0xFF,0x02,0xEA,0x06,0xFE,0xE9,0xE6,0x19,0xD1,0xC5,0x53,0x91,0xD1,0xC5,0xFF,0x01,0xD9,0xC5,0xFF,0xD2,0x88,0xFF,0x8A,0xD6,
+    0x9A,0xFF,0x8A,0xFF,0xFF,0xFF,0x02,0xC1,0xC6,0xFF,0xB9,0x03,0xFF,0xC9,0x44,0xFF,0x89,0xE1,0xE6,0xFF,0x86,0xEA,0x06,0xFF,0x01,0xEA,0x06,0x50,0xD1,0xC5,0x82,0x90,0xD1,0xC5,0xFF,0x81,0xD9,0xC5,0xFF,0x00,0xDB,0xCE,0xFF,0x8A,0xD6,0x9A,0xFF,0x8A,0xFF,0xFF,0xFF,0x03,0xD3,0x4D,0xFF,0xB9,0x03,0xFF,0xB9,0x04,0xFF,0xC9,0x64,0xFF,0x87,0xE1,0xE6,0xFF,0x87,0xEA,0x06,0xFF,0x01,0xEA,0x06,0x80,0xD1,0xC5,0xAC,0x8F,0xD1,0xC5,0xFF,0x82,0xD9,0xC5,0xFF,0x00,0xDC,0xB2,0xFF,0x8A,0xD6,0x9A,0xFF,0x8A,0xFF,0xFF,0xFF,0x04,0xDC,0x92,0xFF,0xB9,0x04,0xFF,0xC1,0x04,0xFF,0xC1,0x24,0xFF,0xC9,0x64,0xFF,0x85,0xE1,0xE6,0xFF,0x88,0xEA,0x06,0xFF,0x01,0xEA,0x06,0xAA,0xD1,0xC5,0xCC,0x8E,0xD1,0xC5,0xFF,0x82,0xD9,0xC5,0xFF,0x01,0xD9,0xE5,0xFF,0xD5,0x13,0xFF,0x8A,0xD6,0x9A,0xFF,0x8A,0xFF,0xFF,0xFF,0x01,0xE5,0x34,0xFF,0xC1,0x04,0xFF,0x82,0xC1,0x24,0xFF,0x00,0xD1,0x65,0xFF,0x83,0xE1,0xE6,0xFF,0x89,0xEA,0x06,0xFF,0x01,0xEA,0x06,0xC8,0xD1,0xC5,0xE3,0x8D,0xD1,0xC5,0xFF,0x82,0xD9,0xC5,0xFF,0x81,
+    0xD9,0xE5,0xFF,0x00,0xD5,0x54,0xFF,0x8A,0xD6,0x9A,0xFF,0x8A,0xFF,0xFF,0xFF,0x00,0xED,0x96,0xFF,0x84,0xC1,0x24,0xFF,0x00,0xD1,0x85,0xFF,0x81,0xE1,0xE6,0xFF,0x8A,0xEA,0x06,0xFF,0x01,0xEA,0x06,0xE3,0xD1,0xC5,0xF5,0x8C,0xD1,0xC5,0xFF,0x82,0xD9,0xC5,0xFF,0x82,0xD9,0xE5,0xFF,0x00,0xD5,0x54,0xFF,0x8A,0xD6,0x9A,0xFF,0x8A,0xFF,0xFF,0xFF,0x00,0xED,0xB6,0xFF,0x83,0xC1,0x24,0xFF,0x03,0xC1,0x44,0xFF,0xC9,0x44,0xFF,0xD1,0x85,0xFF,0xE9,0xE6,0xFF,0x8A,0xEA,0x06,0xFF,0x01,0xEA,0x06,0xF0,0xD1,0xC5,0xFB,0x8B,0xD1,0xC5,0xFF,0x82,0xD9,0xC5,0xFF,0x82,0xD9,0xE5,0xFF,0x01,0xD9,0xE6,0xFF,0xDD,0x54,0xFF,0x8A,0xD6,0x9A,0xFF,0x8A,0xFF,0xFF,0xFF,0x00,0xED,0xB6,0xFF,0x82,0xC1,0x24,0xFF,0x00,0xC1,0x44,0xFF,0x82,0xC9,0x44,0xFF,0x01,0xD1,0x85,0xFF,0xE9,0xE6,0xFF,0x89,0xEA,0x06,0xFF,0x01,0xEA,0x06,0xFA,0xD1,0xC5,0xFD,0x8A,0xD1,0xC5,0xFF,0x82,0xD9,0xC5,0xFF,0x82,0xD9,0xE5,0xFF,0x81,0xD9,0xE6,0xFF,0x00,0xDD,0x54,0xFF,0x8A,0xD6,0x9A,0xFF,0x8A,0xFF,0xFF,0xFF,0x00,0xED,0xB6,0xFF,0x81,
+    0xC1,0x24,0xFF,0x00,0xC1,0x44,0xFF,0x83,0xC9,0x44,0xFF,0x02,0xC9,0x64,0xFF,0xD9,0x85,0xFF,0xE9,0xE6,0xFF,0x88,0xEA,0x06,0xFF,0x01,0xEA,0x06,0xF9,0xD1,0xC5,0xF3,0x89,0xD1,0xC5,0xFF,0x82,0xD9,0xC5,0xFF,0x82,0xD9,0xE5,0xFF,0x82,0xD9,0xE6,0xFF,0x00,0xDD,0x54,0xFF,0x8A,0xD6,0x9A,0xFF,0x8A,0xFF,0xFF,0xFF,0x02,0xED,0xB6,0xFF,0xC1,0x24,0xFF,0xC1,0x44,0xFF,0x83,0xC9,0x44,0xFF,0x82,0xC9,0x64,0xFF,0x01,0xD9,0xA5,0xFF,0xE9,0xE6,0xFF,0x87,0xEA,0x06,0xFF,0x01,0xEA,0x06,0xEC,0xD1,0xC5,0xE4,0x88,0xD1,0xC5,0xFF,0x82,0xD9,0xC5,0xFF,0x82,0xD9,0xE5,0xFF,0x83,0xD9,0xE6,0xFF,0x00,0xDD,0x54,0xFF,0x8A,0xD6,0x9A,0xFF,0x8A,0xFF,0xFF,0xFF,0x01,0xED,0xB6,0xFF,0xC1,0x44,0xFF,0x83,0xC9,0x44,0xFF,0x82,0xC9,0x64,0xFF,0x81,0xD1,0x65,0xFF,0x00,0xD9,0xA5,0xFF,0x87,0xEA,0x06,0xFF,0x01,0xEA,0x06,0xE0,0xD1,0xC5,0xCB,0x87,0xD1,0xC5,0xFF,0x82,0xD9,0xC5,0xFF,0x82,0xD9,0xE5,0xFF,0x84,0xD9,0xE6,0xFF,0x00,0xDD,0x54,0xFF,0x8A,0xD6,0x9A,0xFF,0x8A,0xFF,0xFF,0xFF,0x00,0xED,0xB6,0xFF,0x83,0xC9,
+    0x44,0xFF,0x82,0xC9,0x64,0xFF,0x81,0xD1,0x65,0xFF,0x81,0xD1,0x85,0xFF,0x00,0xD9,0xA5,0xFF,0x86,0xEA,0x06,0xFF,0x01,0xEA,0x06,0xC9,0xD1,0xC5,0xAA,0x86,0xD1,0xC5,0xFF,0x82,0xD9,0xC5,0xFF,0x82,0xD9,0xE5,0xFF,0x85,0xD9,0xE6,0xFF,0x00,0xDD,0x54,0xFF,0x8A,0xD6,0x9A,0xFF,0x8A,0xFF,0xFF,0xFF,0x00,0xED,0xB6,0xFF,0x82,0xC9,0x44,0xFF,0x82,0xC9,0x64,0xFF,0x81,0xD1,0x65,0xFF,0x83,0xD1,0x85,0xFF,0x00,0xD9,0xC5,0xFF,0x85,0xEA,0x06,0xFF,0x01,0xEA,0x06,0xA4,0xD1,0xC5,0x84,0x85,0xD1,0xC5,0xFF,0x82,0xD9,0xC5,0xFF,0x82,0xD9,0xE5,0xFF,0x86,0xD9,0xE6,0xFF,0x00,0xDD,0x54,0xFF,0x8A,0xD6,0x9A,0xFF,0x8A,0xFF,0xFF,0xFF,0x00,0xED,0xB6,0xFF,0x81,0xC9,0x44,0xFF,0x82,0xC9,0x64,0xFF,0x81,0xD1,0x65,0xFF,0x83,0xD1,0x85,0xFF,0x02,0xD9,0x85,0xFF,0xD9,0xA5,0xFF,0xE1,0xC5,0xFF,0x84,0xEA,0x06,0xFF,0x01,0xEA,0x06,0x81,0xD1,0xE5,0x50,0x84,0xD1,0xC5,0xFF,0x82,0xD9,0xC5,0xFF,0x82,0xD9,0xE5,0xFF,0x87,0xD9,0xE6,0xFF,0x00,0xDD,0x54,0xFF,0x8A,0xD6,0x9A,0xFF,0x8A,0xFF,0xFF,0xFF,0x01,0xED,0xB6,
+    0xFF,0xC9,0x44,0xFF,0x82,0xC9,0x64,0xFF,0x81,0xD1,0x65,0xFF,0x83,0xD1,0x85,0xFF,0x00,0xD9,0x85,0xFF,0x82,0xD9,0xA5,0xFF,0x00,0xE1,0xC6,0xFF,0x82,0xEA,0x06,0xFF,0x02,0xF2,0x06,0xFF,0xEA,0x06,0x51,0xD9,0xC6,0x1A,0x83,0xD1,0xC5,0xFF,0x82,0xD9,0xC5,0xFF,0x82,0xD9,0xE5,0xFF,0x87,0xD9,0xE6,0xFF,0x01,0xDA,0x47,0xFF,0xD6,0x18,0xFF,0x8A,0xD6,0x9A,0xFF,0x8A,0xFF,0xFF,0xFF,0x01,0xF6,0xFB,0xFF,0xC9,0xC6,0xFF,0x81,0xC9,0x64,0xFF,0x81,0xD1,0x65,0xFF,0x83,0xD1,0x85,0xFF,0x00,0xD9,0x85,0xFF,0x83,0xD9,0xA5,0xFF,0x07,0xE1,0xA5,0xFF,0xE1,0xE6,0xFF,0xEA,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xFE,0xF1,0xE6,0x15,0x00,0x00,0x00,0xD1,0xC5,0xD4,0x81,0xD1,0xC5,0xFF,0x82,0xD9,0xC5,0xFF,0x82,0xD9,0xE5,0xFF,0x87,0xD9,0xE6,0xFF,0x01,0xDA,0x47,0xFF,0xD5,0xD7,0xFF,0x8B,0xD6,0x9A,0xFF,0x8B,0xFF,0xFF,0xFF,0x01,0xF6,0xBA,0xFF,0xD1,0xE6,0xFF,0x81,0xD1,0x65,0xFF,0x83,0xD1,0x85,0xFF,0x00,0xD9,0x85,0xFF,0x83,0xD9,0xA5,0xFF,0x00,0xE1,0xA5,0xFF,0x81,0xE1,0xC5,0xFF,0x02,0xE9,0xE6,0xFF,0xEA,
+    0x06,0xFF,0xF2,0x06,0xD5,0x81,0x00,0x00,0x00,0x01,0xD1,0xC6,0x8B,0xD1,0xC5,0xFF,0x82,0xD9,0xC5,0xFF,0x82,0xD9,0xE5,0xFF,0x87,0xD9,0xE6,0xFF,0x01,0xDA,0x47,0xFF,0xD5,0xD7,0xFF,0x8C,0xD6,0x9A,0xFF,0x8C,0xFF,0xFF,0xFF,0x01,0xF6,0xDA,0xFF,0xD1,0xE7,0xFF,0x83,0xD1,0x85,0xFF,0x00,0xD9,0x85,0xFF,0x83,0xD9,0xA5,0xFF,0x00,0xE1,0xA5,0xFF,0x81,0xE1,0xC5,0xFF,0x81,0xE1,0xC6,0xFF,0x01,0xE9,0xE6,0xFF,0xF2,0x06,0x88,0x81,0x00,0x00,0x00,0x00,0xD1,0xE5,0x37,0x82,0xD9,0xC5,0xFF,0x82,0xD9,0xE5,0xFF,0x87,0xD9,0xE6,0xFF,0x01,0xDA,0x47,0xFF,0xD5,0xD7,0xFF,0x8D,0xD6,0x9A,0xFF,0x8D,0xFF,0xFF,0xFF,0x01,0xF6,0xDA,0xFF,0xD2,0x07,0xFF,0x81,0xD1,0x85,0xFF,0x00,0xD9,0x85,0xFF,0x83,0xD9,0xA5,0xFF,0x00,0xE1,0xA5,0xFF,0x81,0xE1,0xC5,0xFF,0x81,0xE1,0xC6,0xFF,0x81,0xE9,0xE6,0xFF,0x00,0xEA,0x06,0x37,0x82,0x00,0x00,0x00,0x01,0xD9,0xE5,0xD6,0xD9,0xC5,0xFF,0x82,0xD9,0xE5,0xFF,0x88,0xD9,0xE6,0xFF,0x00,0xDC,0xD2,0xFF,0x8E,0xD6,0x9A,0xFF,0x8E,0xFF,0xFF,0xFF,0x02,0xEC,0xF3,0xFF,0xD1,0x85,
+    0xFF,0xD9,0x85,0xFF,0x83,0xD9,0xA5,0xFF,0x00,0xE1,0xA5,0xFF,0x81,0xE1,0xC5,0xFF,0x81,0xE1,0xC6,0xFF,0x81,0xE9,0xE6,0xFF,0x00,0xE9,0xE6,0xDE,0x83,0x00,0x00,0x00,0x00,0xD9,0xC5,0x71,0x82,0xD9,0xE5,0xFF,0x89,0xD9,0xE6,0xFF,0x00,0xDC,0xD2,0xFF,0x8E,0xD6,0x9A,0xFF,0x8E,0xFF,0xFF,0xFF,0x01,0xED,0x13,0xFF,0xD9,0x85,0xFF,0x83,0xD9,0xA5,0xFF,0x00,0xE1,0xA5,0xFF,0x81,0xE1,0xC5,0xFF,0x81,0xE1,0xC6,0xFF,0x82,0xE9,0xE6,0xFF,0x00,0xE9,0xE6,0x75,0x83,0x00,0x00,0x00,0x02,0xD9,0xC4,0x0D,0xD9,0xE5,0xEF,0xD9,0xE5,0xFF,0x8A,0xD9,0xE6,0xFF,0x02,0xDA,0x27,0xFF,0xB9,0xE7,0xFF,0xB9,0xC7,0xFF,0x82,0xB9,0xE7,0xFF,0x81,0xC1,0xE7,0xFF,0x82,0xC2,0x07,0xFF,0x82,0xC2,0x08,0xFF,0x00,0xCA,0x08,0xFF,0x83,0xCA,0x28,0xFF,0x82,0xD2,0x28,0xFF,0x83,0xD2,0x48,0xFF,0x00,0xDA,0x48,0xFF,0x83,0xDA,0x68,0xFF,0x00,0xDA,0x07,0xFF,0x83,0xD9,0xA5,0xFF,0x00,0xE1,0xA5,0xFF,0x81,0xE1,0xC5,0xFF,0x81,0xE1,0xC6,0xFF,0x82,0xE9,0xE6,0xFF,0x01,0xE9,0xE6,0xF2,0xEA,0x26,0x0F,0x84,0x00,0x00,0x00,0x00,0xD9,
+    0xE5,0x84,0x8C,0xD9,0xE6,0xFF,0x01,0xD1,0xA5,0xFF,0xB9,0x03,0xFF,0x81,0xB8,0xE3,0xFF,0x83,0xB9,0x03,0xFF,0x01,0xB9,0x04,0xFF,0xC1,0x04,0xFF,0x84,0xC1,0x24,0xFF,0x00,0xC1,0x44,0xFF,0x83,0xC9,0x44,0xFF,0x82,0xC9,0x64,0xFF,0x81,0xD1,0x65,0xFF,0x83,0xD1,0x85,0xFF,0x00,0xD9,0x85,0xFF,0x83,0xD9,0xA5,0xFF,0x00,0xE1,0xA5,0xFF,0x81,0xE1,0xC5,0xFF,0x81,0xE1,0xC6,0xFF,0x83,0xE9,0xE6,0xFF,0x00,0xEA,0x06,0x89,0x85,0x00,0x00,0x00,0x01,0xD9,0xC4,0x0D,0xD9,0xE6,0xE8,0x8A,0xD9,0xE6,0xFF,0x81,0xE1,0xE6,0xFF,0x00,0xD9,0xA5,0xFF,0x84,0xB9,0x03,0xFF,0x01,0xB9,0x04,0xFF,0xC1,0x04,0xFF,0x81,0xC1,0x24,0xFF,0x00,0xD5,0xB6,0xFF,0x82,0xD6,0x59,0xFF,0x82,0xFF,0x9E,0xFF,0x00,0xF6,0x9A,0xFF,0x82,0xC9,0x64,0xFF,0x81,0xD1,0x65,0xFF,0x83,0xD1,0x85,0xFF,0x00,0xD9,0x85,0xFF,0x83,0xD9,0xA5,0xFF,0x00,0xE1,0xA5,0xFF,0x81,0xE1,0xC5,0xFF,0x81,0xE1,0xC6,0xFF,0x83,0xE9,0xE6,0xFF,0x01,0xEA,0x06,0xEB,0xEA,0x26,0x0F,0x86,0x00,0x00,0x00,0x00,0xD9,0xC6,0x68,0x89,0xD9,0xE6,0xFF,0x83,0xE1,0xE6,
+    0xFF,0x01,0xD9,0xC5,0xFF,0xB9,0x04,0xFF,0x81,0xB9,0x03,0xFF,0x01,0xB9,0x04,0xFF,0xC1,0x04,0xFF,0x82,0xC1,0x24,0xFF,0x00,0xD5,0x13,0xFF,0x82,0xD6,0x9A,0xFF,0x82,0xFF,0xFF,0xFF,0x00,0xED,0x75,0xFF,0x81,0xC9,0x64,0xFF,0x81,0xD1,0x65,0xFF,0x83,0xD1,0x85,0xFF,0x00,0xD9,0x85,0xFF,0x83,0xD9,0xA5,0xFF,0x00,0xE1,0xA5,0xFF,0x81,0xE1,0xC5,0xFF,0x81,0xE1,0xC6,0xFF,0x83,0xE9,0xE6,0xFF,0x01,0xEA,0x06,0xFF,0xEA,0x06,0x6B,0x87,0x00,0x00,0x00,0x01,0xF8,0x00,0x02,0xD9,0xC6,0xC1,0x87,0xD9,0xE6,0xFF,0x85,0xE1,0xE6,0xFF,0x03,0xD9,0xC5,0xFF,0xC1,0x04,0xFF,0xB9,0x04,0xFF,0xC1,0x04,0xFF,0x83,0xC1,0x24,0xFF,0x01,0xCA,0x28,0xFF,0xD6,0x79,0xFF,0x81,0xD6,0x9A,0xFF,0x81,0xFF,0xFF,0xFF,0x02,0xFF,0x9E,0xFF,0xD2,0x48,0xFF,0xC9,0x64,0xFF,0x81,0xD1,0x65,0xFF,0x83,0xD1,0x85,0xFF,0x00,0xD9,0x85,0xFF,0x83,0xD9,0xA5,0xFF,0x00,0xE1,0xA5,0xFF,0x81,0xE1,0xC5,0xFF,0x81,0xE1,0xC6,0xFF,0x83,0xE9,0xE6,0xFF,0x02,0xEA,0x06,0xFF,0xEA,0x06,0xC7,0xFA,0xAA,0x03,0x88,0x00,0x00,0x00,0x01,0xD9,0xE6,
+    0x25,0xD9,0xE6,0xF3,0x85,0xD9,0xE6,0xFF,0x87,0xE1,0xE6,0xFF,0x00,0xD9,0xC5,0xFF,0x85,0xC1,0x24,0xFF,0x07,0xC1,0x44,0xFF,0xCA,0x07,0xFF,0xD5,0x13,0xFF,0xD6,0x18,0xFF,0xFF,0x1C,0xFF,0xED,0x75,0xFF,0xD2,0x27,0xFF,0xC9,0x64,0xFF,0x81,0xD1,0x65,0xFF,0x83,0xD1,0x85,0xFF,0x00,0xD9,0x85,0xFF,0x83,0xD9,0xA5,0xFF,0x00,0xE1,0xA5,0xFF,0x81,0xE1,0xC5,0xFF,0x81,0xE1,0xC6,0xFF,0x83,0xE9,0xE6,0xFF,0x02,0xEA,0x06,0xFF,0xEA,0x06,0xF3,0xF2,0x06,0x23,0x8A,0x00,0x00,0x00,0x00,0xD9,0xE6,0x59,0x84,0xD9,0xE6,0xFF,0x89,0xE1,0xE6,0xFF,0x00,0xD9,0xC5,0xFF,0x83,0xC1,0x24,0xFF,0x00,0xC1,0x44,0xFF,0x83,0xC9,0x44,0xFF,0x82,0xC9,0x64,0xFF,0x81,0xD1,0x65,0xFF,0x83,0xD1,0x85,0xFF,0x00,0xD9,0x85,0xFF,0x83,0xD9,0xA5,0xFF,0x00,0xE1,0xA5,0xFF,0x81,0xE1,0xC5,0xFF,0x81,0xE1,0xC6,0xFF,0x83,0xE9,0xE6,0xFF,0x02,0xEA,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0x5E,0x8C,0x00,0x00,0x00,0x00,0xD9,0xE6,0x8E,0x82,0xD9,0xE6,0xFF,0x8B,0xE1,0xE6,0xFF,0x03,0xD9,0xC5,0xFF,0xC1,0x44,0xFF,0xC1,0x24,0xFF,0xC1,
+    0x44,0xFF,0x83,0xC9,0x44,0xFF,0x82,0xC9,0x64,0xFF,0x81,0xD1,0x65,0xFF,0x83,0xD1,0x85,0xFF,0x00,0xD9,0x85,0xFF,0x83,0xD9,0xA5,0xFF,0x00,0xE1,0xA5,0xFF,0x81,0xE1,0xC5,0xFF,0x81,0xE1,0xC6,0xFF,0x83,0xE9,0xE6,0xFF,0x02,0xEA,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0x8C,0x8D,0x00,0x00,0x00,0x02,0xF8,0x00,0x02,0xE1,0xE6,0xAB,0xD9,0xE6,0xFF,0x8D,0xE1,0xE6,0xFF,0x00,0xD9,0xC5,0xFF,0x84,0xC9,0x44,0xFF,0x82,0xC9,0x64,0xFF,0x81,0xD1,0x65,0xFF,0x83,0xD1,0x85,0xFF,0x00,0xD9,0x85,0xFF,0x83,0xD9,0xA5,0xFF,0x00,0xE1,0xA5,0xFF,0x81,0xE1,0xC5,0xFF,0x81,0xE1,0xC6,0xFF,0x83,0xE9,0xE6,0xFF,0x03,0xEA,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xB1,0xFA,0xAA,0x03,0x8E,0x00,0x00,0x00,0x01,0xDA,0x44,0x07,0xE1,0xE6,0xB4,0x8E,0xE1,0xE6,0xFF,0x00,0xE1,0xC6,0xFF,0x82,0xC9,0x44,0xFF,0x82,0xC9,0x64,0xFF,0x81,0xD1,0x65,0xFF,0x83,0xD1,0x85,0xFF,0x00,0xD9,0x85,0xFF,0x83,0xD9,0xA5,0xFF,0x00,0xE1,0xA5,0xFF,0x81,0xE1,0xC5,0xFF,0x81,0xE1,0xC6,0xFF,0x83,0xE9,0xE6,0xFF,0x03,0xEA,0x06,0xFF,0xF2,0x06,
+    0xFF,0xF2,0x06,0xB4,0xFA,0xA5,0x06,0x90,0x00,0x00,0x00,0x01,0xD1,0x45,0x06,0xE1,0xE6,0xAC,0x8E,0xE1,0xE6,0xFF,0x00,0xE1,0xC6,0xFF,0x83,0xC9,0x64,0xFF,0x81,0xD1,0x65,0xFF,0x83,0xD1,0x85,0xFF,0x00,0xD9,0x85,0xFF,0x83,0xD9,0xA5,0xFF,0x00,0xE1,0xA5,0xFF,0x81,0xE1,0xC5,0xFF,0x81,0xE1,0xC6,0xFF,0x83,0xE9,0xE6,0xFF,0x03,0xEA,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0xB0,0xFA,0xA5,0x06,0x92,0x00,0x00,0x00,0x01,0xF8,0x00,0x01,0xE1,0xE6,0x80,0x8C,0xE1,0xE6,0xFF,0x81,0xEA,0x06,0xFF,0x02,0xE1,0xE6,0xFF,0xD1,0x64,0xFF,0xC9,0x64,0xFF,0x81,0xD1,0x65,0xFF,0x83,0xD1,0x85,0xFF,0x00,0xD9,0x85,0xFF,0x83,0xD9,0xA5,0xFF,0x00,0xE1,0xA5,0xFF,0x81,0xE1,0xC5,0xFF,0x81,0xE1,0xC6,0xFF,0x83,0xE9,0xE6,0xFF,0x03,0xEA,0x06,0xFF,0xF2,0x06,0xFF,0xF2,0x06,0x93,0xFC,0x00,0x02,0x95,0x00,0x00,0x00,0x01,0xE1,0xE6,0x5B,0xE1,0xE6,0xF1,0x89,0xE1,0xE6,0xFF,0x83,0xEA,0x06,0xFF,0x00,0xE1,0xE6,0xFF,0x81,0xD1,0x65,0xFF,0x83,0xD1,0x85,0xFF,0x00,0xD9,0x85,0xFF,0x83,0xD9,0xA5,0xFF,0x00,0xE1,0xA5,0xFF,
+    0x81,0xE1,0xC5,0xFF,0x81,0xE1,0xC6,0xFF,0x83,0xE9,0xE6,0xFF,0x02,0xEA,0x06,0xFF,0xEA,0x06,0xF3,0xF2,0x06,0x5F,0x98,0x00,0x00,0x00,0x01,0xE2,0x06,0x23,0xE1,0xE6,0xC4,0x87,0xE1,0xE6,0xFF,0x85,0xEA,0x06,0xFF,0x00,0xE1,0xE6,0xFF,0x83,0xD1,0x85,0xFF,0x00,0xD9,0x85,0xFF,0x83,0xD9,0xA5,0xFF,0x00,0xE1,0xA5,0xFF,0x81,0xE1,0xC5,0xFF,0x81,0xE1,0xC6,0xFF,0x83,0xE9,0xE6,0xFF,0x02,0xEA,0x06,0xFF,0xF2,0x06,0xC7,0xF2,0x06,0x23,0x9A,0x00,0x00,0x00,0x02,0xF8,0x00,0x01,0xE2,0x06,0x64,0xE1,0xE6,0xEC,0x84,0xE1,0xE6,0xFF,0x87,0xEA,0x06,0xFF,0x03,0xE1,0xE6,0xFF,0xD9,0x85,0xFF,0xD1,0x85,0xFF,0xD9,0x85,0xFF,0x83,0xD9,0xA5,0xFF,0x00,0xE1,0xA5,0xFF,0x81,0xE1,0xC5,0xFF,0x81,0xE1,0xC6,0xFF,0x83,0xE9,0xE6,0xFF,0x02,0xEA,0x06,0xEB,0xEA,0x06,0x6A,0xFA,0xAA,0x03,0x9D,0x00,0x00,0x00,0x02,0xE9,0xA6,0x0E,0xE2,0x06,0x80,0xE1,0xE6,0xF1,0x81,0xE1,0xE6,0xFF,0x89,0xEA,0x06,0xFF,0x01,0xE9,0xE6,0xFF,0xD9,0x85,0xFF,0x83,0xD9,0xA5,0xFF,0x00,0xE1,0xA5,0xFF,0x81,0xE1,0xC5,0xFF,0x81,0xE1,0xC6,
+    0xFF,0x82,0xE9,0xE6,0xFF,0x02,0xE9,0xE6,0xF0,0xEA,0x06,0x8B,0xEA,0x06,0x10,0xA1,0x00,0x00,0x00,0x02,0xE9,0xA6,0x0E,0xE9,0xE6,0x6F,0xEA,0x06,0xD8,0x8A,0xEA,0x06,0xFF,0x00,0xE9,0xE6,0xFF,0x82,0xD9,0xA5,0xFF,0x00,0xE1,0xA5,0xFF,0x81,0xE1,0xC5,0xFF,0x81,0xE1,0xC6,0xFF,0x81,0xE9,0xE6,0xFF,0x02,0xE9,0xE6,0xDD,0xE9,0xE6,0x77,0xE9,0xA6,0x0E,0xA6,0x00,0x00,0x00,0x02,0xEA,0x06,0x34,0xEA,0x06,0x8C,0xEA,0x06,0xD3,0x88,0xEA,0x06,0xFF,0x00,0xE9,0xE6,0xFF,0x81,0xE1,0xA5,0xFF,0x81,0xE1,0xC5,0xFF,0x04,0xE1,0xC6,0xFF,0xE1,0xC6,0xFE,0xE9,0xE6,0xDA,0xE9,0xE6,0x94,0xEA,0x06,0x38,0xAC,0x00,0x00,0x00,0x0F,0xEA,0x06,0x18,0xEA,0x06,0x50,0xEA,0x06,0x80,0xEA,0x06,0xAB,0xEA,0x06,0xC7,0xEA,0x06,0xE5,0xEA,0x06,0xEE,0xEA,0x06,0xFD,0xEA,0x06,0xFA,0xEA,0x06,0xEE,0xEA,0x06,0xE0,0xE1,0xC5,0xD5,0xE1,0xC6,0xB3,0xE1,0xE5,0x8C,0xE1,0xE6,0x5B,0xE9,0xA5,0x18,0x97,0x00,0x00,0x00,
     };
 const lv_img_dsc_t ui_img_notify_png = {
    .header.always_zero = 0,
    .header.w = 64,
    .header.h = 64,
    .data_size = sizeof(ui_img_notify_png_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+   .header.cf = LV_IMG_CF_USER_ENCODED_1,
    .data = ui_img_notify_png_data};
 
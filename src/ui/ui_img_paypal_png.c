@@ -10,29 +10,17 @@
 #endif
 
 // IMAGE DATA: assets\paypal.png
+// Run length encoded LV_IMG_CF_TRUE_COLOR, decoded by src/img_cache.cpp
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_paypal_png_data[] = {
-0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x21,0xAD,0x21,0x8D,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0x8D,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0x8D,0x21,0xAD,0x22,0x90,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x22,0x90,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x21,0xAD,0x21,0x8D,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0x8D,0x22,0xD1,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0x8D,0x21,0xAD,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0x8C,0x21,0x4B,0x21,0x4A,0x21,0x4A,0x21,0x4A,0x21,0x4A,0x21,0x4A,0x21,0x4A,0x21,0x4A,0x21,0x4A,0x21,0x4A,0x21,0x4A,0x21,0x4B,0x21,0x6C,0x21,0x8D,0x22,0xD1,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0x6C,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x22,0x0D,0x24,0x78,0x22,0x90,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x22,0x90,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0x4B,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x22,0x90,0x24,0x98,0x24,0x78,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x22,0xD1,0x21,0x8D,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0x4A,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x4A,0x23,0x94,0x24,0x98,0x24,0x98,0x24,0x98,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0x8C,0x21,0x4A,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x21,0xAC,0x24,0x37,0x24,0x98,0x24,0x98,0x24,0x98,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0x8C,0x19,0x4A,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x22,0xF1,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0x6C,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x22,0x0D,0x24,0x37,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0x6C,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x21,0xAC,0x23,0xD5,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0x4B,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x22,0x0D,0x23,0xD5,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x22,0xD1,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0x4A,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x4A,0x21,0xAC,0x22,0xF1,0x24,0x37,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0x8C,0x21,0xAC,0x22,0x0D,0x22,0x0D,0x22,0x0D,0x22,0x0D,0x22,0x0D,0x22,0x4F,0x22,0xF1,0x23,0x94,0x24,0x37,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xEE,0x23,0x94,0x24,0x77,0x24,0x77,0x24,0x77,0x24,0x77,0x24,0x77,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x22,0x4F,0x24,0x77,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0x8C,0x22,0x90,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x22,0xD1,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x22,0xF1,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x22,0xD1,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x22,0x90,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x23,0x94,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x21,0xAD,0x21,0x8D,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x23,0xD5,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x22,0x90,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xEE,0x24,0x37,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x22,0x4F,0x24,0x77,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x22,0x90,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x22,0xD1,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x22,0xF1,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x21,0xAD,0x23,0xD5,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x24,0x98,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
+    0x85,0x43,0x89,0x01,0x21,0xAD,0x21,0x8D,0x8B,0x21,0xAD,0x00,0x21,0x8D,0x82,0x21,0xAD,0x8D,0x43,0x89,0x90,0x21,0xAD,0x02,0x21,0x8D,0x21,0xAD,0x22,0x90,0x8B,0x43,0x89,0x93,0x21,0xAD,0x8A,0x43,0x89,0x00,0x22,0x90,0x94,0x21,0xAD,0x89,0x43,0x89,0x01,0x21,0xAD,0x21,0x8D,0x93,0x21,0xAD,0x89,0x43,0x89,0x94,0x21,0xAD,0x01,0x21,0x8D,0x22,0xD1,0x88,0x43,0x89,0x94,0x21,0xAD,0x01,0x21,0x8D,0x21,0xAD,0x88,0x43,0x89,0x86,0x21,0xAD,0x01,0x21,0x8C,0x21,0x4B,0x89,0x21,0x4A,0x03,0x21,0x4B,0x21,0x6C,0x21,0x8D,0x22,0xD1,0x88,0x43,0x89,0x86,0x21,0xAD,0x00,0x21,0x6C,0x8C,0x19,0x29,0x02,0x22,0x0D,0x24,0x78,0x22,0x90,0x86,0x43,0x89,0x00,0x22,0x90,0x86,0x21,0xAD,0x00,0x21,0x4B,0x8C,0x19,0x29,0x02,0x22,0x90,0x24,0x98,0x24,0x78,0x86,0x43,0x89,0x01,0x22,0xD1,0x21,0x8D,0x85,0x21,0xAD,0x00,0x21,0x4A,0x8B,0x19,0x29,0x01,0x19,0x4A,0x23,0x94,0x82,0x24,0x98,0x85,0x43,0x89,0x86,0x21,0xAD,0x01,0x21,0x8C,0x21,0x4A,0x8B,0x19,0x29,0x01,0x21,0xAC,0x24,0x37,0x82,0x24,0x98,0x85,0x43,0x89,
+    0x86,0x21,0xAD,0x01,0x21,0x8C,0x19,0x4A,0x8B,0x19,0x29,0x00,0x22,0xF1,0x83,0x24,0x98,0x85,0x43,0x89,0x86,0x21,0xAD,0x00,0x21,0x6C,0x8B,0x19,0x29,0x01,0x22,0x0D,0x24,0x37,0x83,0x24,0x98,0x85,0x43,0x89,0x86,0x21,0xAD,0x00,0x21,0x6C,0x8A,0x19,0x29,0x01,0x21,0xAC,0x23,0xD5,0x84,0x24,0x98,0x85,0x43,0x89,0x86,0x21,0xAD,0x00,0x21,0x4B,0x89,0x19,0x29,0x01,0x22,0x0D,0x23,0xD5,0x85,0x24,0x98,0x84,0x43,0x89,0x00,0x22,0xD1,0x86,0x21,0xAD,0x00,0x21,0x4A,0x86,0x19,0x29,0x03,0x19,0x4A,0x21,0xAC,0x22,0xF1,0x24,0x37,0x86,0x24,0x98,0x84,0x43,0x89,0x86,0x21,0xAD,0x01,0x21,0x8C,0x21,0xAC,0x84,0x22,0x0D,0x03,0x22,0x4F,0x22,0xF1,0x23,0x94,0x24,0x37,0x87,0x24,0x98,0x85,0x43,0x89,0x86,0x21,0xAD,0x01,0x21,0xEE,0x23,0x94,0x84,0x24,0x77,0x8B,0x24,0x98,0x85,0x43,0x89,0x86,0x21,0xAD,0x01,0x22,0x4F,0x24,0x77,0x8F,0x24,0x98,0x86,0x43,0x89,0x85,0x21,0xAD,0x01,0x21,0x8C,0x22,0x90,0x8F,0x24,0x98,0x00,0x22,0xD1,0x86,0x43,0x89,0x86,0x21,0xAD,0x00,0x22,0xF1,0x8E,0x24,0x98,0x00,0x22,
+    0xD1,0x86,0x43,0x89,0x00,0x22,0x90,0x86,0x21,0xAD,0x00,0x23,0x94,0x8D,0x24,0x98,0x88,0x43,0x89,0x01,0x21,0xAD,0x21,0x8D,0x85,0x21,0xAD,0x00,0x23,0xD5,0x8A,0x24,0x98,0x00,0x22,0x90,0x8A,0x43,0x89,0x86,0x21,0xAD,0x01,0x21,0xEE,0x24,0x37,0x86,0x24,0x98,0x8F,0x43,0x89,0x86,0x21,0xAD,0x01,0x22,0x4F,0x24,0x77,0x86,0x24,0x98,0x8F,0x43,0x89,0x86,0x21,0xAD,0x00,0x22,0x90,0x86,0x24,0x98,0x00,0x22,0xD1,0x8F,0x43,0x89,0x86,0x21,0xAD,0x00,0x22,0xF1,0x86,0x24,0x98,0x90,0x43,0x89,0x86,0x21,0xAD,0x00,0x23,0xD5,0x86,0x24,0x98,0x97,0x43,0x89,0x87,0x24,0x98,0x96,0x43,0x89,0x88,0x24,0x98,0x96,0x43,0x89,0x88,0x24,0x98,0x8E,0x43,0x89,
     };
 const lv_img_dsc_t ui_img_paypal_png = {
    .header.always_zero = 0,
    .header.w = 32,
    .header.h = 32,
    .data_size = sizeof(ui_img_paypal_png_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR,
+   .header.cf = LV_IMG_CF_USER_ENCODED_0,
    .data = ui_img_paypal_png_data};
 
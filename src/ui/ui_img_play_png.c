@@ -10,77 +10,24 @@
 #endif
 
 // IMAGE DATA: assets\play.png
+// Run length encoded LV_IMG_CF_TRUE_COLOR_ALPHA, decoded by src/img_cache.cpp
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_play_png_data[] = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0xFE,0x12,0x24,0xBE,0x4E,0x24,0xDE,0x7E,0x24,0xDE,0xA3,0x24,0xBE,0xC8,0x24,0xBE,0xDD,0x24,0xBE,0xEE,0x24,0xBE,0xF8,0x24,0xBE,0xFA,0x24,0xBE,0xEE,0x24,0xBE,0xDF,0x24,0xBE,0xCB,0x24,0xBE,0xA7,0x24,0xBE,0x82,0x24,0xDE,0x54,0x24,0xDE,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xDE,0x2D,0x24,0xBE,0x86,0x24,0xBE,0xD2,0x24,0xBE,0xFD,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xD7,0x24,0xBE,0x90,0x24,0xDE,0x37,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x7F,0x09,0x24,0xDE,0x6A,0x24,0xBE,0xD3,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xDC,0x24,0xBE,0x77,0x24,0xDD,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0xBD,0x0C,0x24,0xBE,0x7D,0x24,0xBE,0xEA,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xF1,0x24,0xBE,0x89,0x2C,0xBE,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xDE,0x4D,0x24,0xBE,0xE1,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xEE,0x24,0xDE,0x6F,0x05,0x5F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xBE,0x1B,0x24,0xBE,0xBD,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xCC,0x24,0xBE,0x27,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xBE,0x46,0x24,0xBE,0xE8,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xF6,0x24,0xDE,0x6F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xBE,0x80,0x24,0xBE,0xFE,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0x96,0x05,0x5F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x5F,0x03,0x24,0xBE,0x97,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xB0,0x1C,0x7F,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x5F,0x03,0x24,0xBE,0xA8,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xDE,0xBE,0x1C,0x7F,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xBE,0x91,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xB2,0x44,0x1F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xBE,0x7D,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xDE,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xDE,0x48,0x24,0xBE,0xFE,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xDE,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xDE,0x17,0x24,0xBE,0xE7,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xF7,0x24,0xBE,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xBE,0xB8,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xD0,0x44,0x1F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xDE,0x54,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0x6E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x7F,0x09,0x24,0xBE,0xDF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x34,0xFE,0xFF,0x96,0x7F,0xFF,0xC7,0x1F,0xFF,0xAE,0xDF,0xFF,0x55,0x7E,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xF1,0x24,0xBE,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xBE,0x75,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x2C,0xDE,0xFF,0xDF,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xDF,0xFF,0x3D,0x1E,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x9F,0x07,0x24,0xBE,0xE5,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x7E,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0x96,0x5F,0xFF,0x2C,0xDE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xF5,0x24,0xDE,0x14,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xBE,0x62,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0xA6,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x9F,0xFF,0x6D,0xDE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xDE,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xBE,0xCA,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0xA6,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0x5F,0xFF,0x55,0x7E,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xE5,0x04,0x1F,0x02,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x24,0xDE,0x23,0x24,0xBE,0xFE,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0xA6,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAE,0xDF,0xFF,0x3D,0x1E,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0x3F,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x24,0xBE,0x7D,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0xA6,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0x96,0x5F,0xFF,0x2C,0xDE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0x98,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x24,0xBE,0xC6,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0xA6,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x9F,0xFF,0x6D,0xDE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xE2,0x00,0x00,0x00,
-    0x1C,0xDF,0x0A,0x24,0xBE,0xF9,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0xA6,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC7,0x3F,0xFF,0x4D,0x5E,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x2C,0xBD,0x20,
-    0x24,0xDE,0x43,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0xA6,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA6,0xBF,0xFF,0x35,0x1E,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xDE,0x5E,
-    0x24,0xDE,0x72,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0xA6,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0x86,0x3F,0xFF,0x24,0xDE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0x8D,
-    0x24,0xBE,0x97,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0xA6,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0x7F,0xFF,0x65,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xB1,
-    0x24,0xBE,0xBB,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0xA6,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0x1F,0xFF,0x45,0x3E,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xD6,
-    0x24,0xBE,0xD2,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0xA6,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7E,0x1F,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xED,
-    0x24,0xBE,0xDE,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0xA6,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x55,0x7E,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xF9,
-    0x24,0xBE,0xEB,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0xA6,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x96,0x7F,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,
-    0x24,0xBE,0xEA,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0xA6,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x96,0x7F,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,
-    0x24,0xBE,0xDE,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0xA6,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4D,0x5E,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xF9,
-    0x24,0xBE,0xD2,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0xA6,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7E,0x1F,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xED,
-    0x24,0xBE,0xBB,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0xA6,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0x1F,0xFF,0x45,0x3E,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xD6,
-    0x24,0xBE,0x97,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0xA6,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0x7F,0xFF,0x65,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xB1,
-    0x24,0xDE,0x72,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0xA6,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0x86,0x3F,0xFF,0x24,0xDE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0x8C,
-    0x24,0xBE,0x42,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0xA6,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA6,0xBF,0xFF,0x34,0xFE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xDE,0x5E,
-    0x1C,0xDF,0x0A,0x24,0xBE,0xF9,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0xA6,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC7,0x3F,0xFF,0x4D,0x5E,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0x1F,
-    0x00,0x00,0x00,0x24,0xBE,0xC5,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0xA6,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0x9F,0xFF,0x6D,0xDE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xE2,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x24,0xBE,0x7B,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0xA6,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0x96,0x5F,0xFF,0x2C,0xDE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0x97,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x24,0xBE,0x22,0x24,0xBE,0xFE,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0xA6,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAE,0xDF,0xFF,0x3D,0x1E,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0x3D,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xBE,0xC8,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0xA6,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0x5F,0xFF,0x55,0x7E,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xE2,0x04,0x1F,0x02,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xBE,0x61,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0xA6,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x9F,0xFF,0x6D,0xDE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0x7D,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xDF,0x05,0x24,0xBE,0xE2,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x7E,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0x96,0x5F,0xFF,0x2C,0xDE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xF4,0x2C,0xBE,0x13,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xDE,0x74,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x2C,0xDE,0xFF,0xD7,0x5F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xDF,0xFF,0x3D,0x1E,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xDE,0x8F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x7F,0x09,0x24,0xBE,0xDE,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x2C,0xFE,0xFF,0x96,0x7F,0xFF,0xC7,0x1F,0xFF,0xAE,0xDF,0xFF,0x55,0x7E,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xEE,0x24,0x9E,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xDE,0x52,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xDE,0x6D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xBE,0xB7,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xDE,0xCF,0x44,0x1F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xDE,0x17,0x24,0xBE,0xE7,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xF4,0x24,0xBE,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xBE,0x47,0x24,0xBE,0xFD,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xBE,0x7B,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0x96,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xBE,0x90,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xB1,0x44,0x1F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x1F,0x02,0x24,0xBE,0xA7,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xDE,0xBE,0x24,0xFF,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x5F,0x03,0x24,0xBE,0x96,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xDE,0xAF,0x1C,0x7F,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xBE,0x7D,0x24,0xBE,0xFE,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xDE,0x94,0x05,0x5F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xBE,0x44,0x24,0xBE,0xE7,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xF2,0x24,0xBE,0x5C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x9E,0x1A,0x24,0xBE,0xBB,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xCA,0x24,0xBE,0x26,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xDE,0x4D,0x24,0xBE,0xE0,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xED,0x24,0xDE,0x6F,0x05,0x5F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2D,0x1D,0x0B,0x24,0xBE,0x7A,0x24,0xBE,0xE8,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xF0,0x24,0xBE,0x86,0x2C,0xFE,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xFF,0x08,0x24,0xDE,0x68,0x24,0xBE,0xD1,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xDA,0x24,0xBE,0x75,0x24,0x9D,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xBE,0x2B,0x24,0xBE,0x84,0x24,0xBE,0xCE,0x24,0xBE,0xFD,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFF,0x24,0xBE,0xFE,0x24,0xBE,0xD5,0x24,0xBE,0x8D,0x24,0xDE,0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x7D,0x10,0x24,0xBE,0x4C,0x24,0xBE,0x7C,0x24,0xBE,0xA0,0x24,0xBE,0xC6,0x24,0xBE,0xDD,0x24,0xBE,0xEB,0x24,0xBE,0xF6,0x24,0xBE,0xF8,0x24,0xBE,0xED,0x24,0xBE,0xDD,0x24,0xBE,0xC9,0x24,0xBE,0xA5,0x24,0xBE,0x80,0x24,0xBE,0x51,0x24,0x9E,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x97,0x00,0x00,0x00,0x0F,0x2C,0xFE,0x12,0x24,0xBE,0x4E,0x24,0xDE,0x7E,0x24,0xDE,0xA3,0x24,0xBE,0xC8,0x24,0xBE,0xDD,0x24,0xBE,0xEE,0x24,0xBE,0xF8,0x24,0xBE,0xFA,0x24,0xBE,0xEE,0x24,0xBE,0xDF,0x24,0xBE,0xCB,0x24,0xBE,0xA7,0x24,0xBE,0x82,0x24,0xDE,0x54,0x24,0xDE,0x17,0xAC,0x00,0x00,0x00,0x03,0x24,0xDE,0x2D,0x24,0xBE,0x86,0x24,0xBE,0xD2,0x24,0xBE,0xFD,0x8E,0x24,0xBE,0xFF,0x02,0x24,0xBE,0xD7,0x24,0xBE,0x90,0x24,0xDE,0x37,0xA6,0x00,0x00,0x00,0x02,0x1C,0x7F,0x09,0x24,0xDE,0x6A,0x24,0xBE,0xD3,0x95,0x24,0xBE,0xFF,0x02,0x24,0xBE,0xDC,0x24,0xBE,0x77,0x24,0xDD,0x0F,0xA1,0x00,0x00,0x00,0x02,0x2C,0xBD,0x0C,0x24,0xBE,0x7D,0x24,0xBE,0xEA,0x99,0x24,0xBE,0xFF,0x02,0x24,0xBE,0xF1,0x24,0xBE,0x89,0x2C,0xBE,0x13,0x9E,0x00,0x00,0x00,0x01,0x24,0xDE,0x4D,0x24,0xBE,0xE1,0x9D,0x24,0xBE,0xFF,0x02,0x24,0xBE,0xEE,0x24,0xDE,0x6F,0x05,0x5F,0x03,0x9A,0x00,0x00,0x00,0x01,0x24,0xBE,0x1B,0x24,0xBE,0xBD,0xA1,0x24,0xBE,0xFF,0x01,0x24,0xBE,0xCC,0x24,0xBE,0x27,0x98,0x00,0x00,0x00,0x01,
+    0x24,0xBE,0x46,0x24,0xBE,0xE8,0xA3,0x24,0xBE,0xFF,0x01,0x24,0xBE,0xF6,0x24,0xDE,0x6F,0x96,0x00,0x00,0x00,0x01,0x24,0xBE,0x80,0x24,0xBE,0xFE,0xA6,0x24,0xBE,0xFF,0x01,0x24,0xBE,0x96,0x05,0x5F,0x03,0x92,0x00,0x00,0x00,0x01,0x05,0x5F,0x03,0x24,0xBE,0x97,0xA9,0x24,0xBE,0xFF,0x01,0x24,0xBE,0xB0,0x1C,0x7F,0x09,0x90,0x00,0x00,0x00,0x01,0x05,0x5F,0x03,0x24,0xBE,0xA8,0xAB,0x24,0xBE,0xFF,0x01,0x24,0xDE,0xBE,0x1C,0x7F,0x09,0x8F,0x00,0x00,0x00,0x00,0x24,0xBE,0x91,0xAD,0x24,0xBE,0xFF,0x01,0x24,0xBE,0xB2,0x44,0x1F,0x04,0x8D,0x00,0x00,0x00,0x00,0x24,0xBE,0x7D,0xAF,0x24,0xBE,0xFF,0x00,0x24,0xDE,0x99,0x8C,0x00,0x00,0x00,0x01,0x24,0xDE,0x48,0x24,0xBE,0xFE,0xB0,0x24,0xBE,0xFF,0x00,0x24,0xDE,0x63,0x8A,0x00,0x00,0x00,0x01,0x24,0xDE,0x17,0x24,0xBE,0xE7,0xB1,0x24,0xBE,0xFF,0x01,0x24,0xBE,0xF7,0x24,0xBE,0x2E,0x89,0x00,0x00,0x00,0x00,0x24,0xBE,0xB8,0xB3,0x24,0xBE,0xFF,0x01,0x24,0xBE,0xD0,0x44,0x1F,0x04,0x87,0x00,0x00,0x00,0x00,0x24,0xDE,0x54,0xB5,0x24,0xBE,0xFF,0x00,0x24,
+    0xBE,0x6E,0x86,0x00,0x00,0x00,0x01,0x1C,0x7F,0x09,0x24,0xBE,0xDF,0x90,0x24,0xBE,0xFF,0x04,0x34,0xFE,0xFF,0x96,0x7F,0xFF,0xC7,0x1F,0xFF,0xAE,0xDF,0xFF,0x55,0x7E,0xFF,0x9F,0x24,0xBE,0xFF,0x01,0x24,0xBE,0xF1,0x24,0xBE,0x18,0x85,0x00,0x00,0x00,0x00,0x24,0xBE,0x75,0x90,0x24,0xBE,0xFF,0x01,0x2C,0xDE,0xFF,0xDF,0x7F,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xB6,0xDF,0xFF,0x3D,0x1E,0xFF,0x9E,0x24,0xBE,0xFF,0x00,0x24,0xBE,0x90,0x84,0x00,0x00,0x00,0x01,0x24,0x9F,0x07,0x24,0xBE,0xE5,0x90,0x24,0xBE,0xFF,0x00,0x7E,0x1F,0xFF,0x85,0xFF,0xFF,0xFF,0x02,0xF7,0xDF,0xFF,0x96,0x5F,0xFF,0x2C,0xDE,0xFF,0x9C,0x24,0xBE,0xFF,0x01,0x24,0xBE,0xF5,0x24,0xDE,0x14,0x83,0x00,0x00,0x00,0x00,0x24,0xBE,0x62,0x91,0x24,0xBE,0xFF,0x00,0xA6,0x9F,0xFF,0x87,0xFF,0xFF,0xFF,0x01,0xE7,0x9F,0xFF,0x6D,0xDE,0xFF,0x9C,0x24,0xBE,0xFF,0x00,0x24,0xDE,0x7E,0x83,0x00,0x00,0x00,0x00,0x24,0xBE,0xCA,0x91,0x24,0xBE,0xFF,0x00,0xA6,0xBF,0xFF,0x89,0xFF,0xFF,0xFF,0x01,0xD7,0x5F,0xFF,0x55,0x7E,0xFF,0x9A,0x24,0xBE,0xFF,
+    0x01,0x24,0xBE,0xE5,0x04,0x1F,0x02,0x81,0x00,0x00,0x00,0x01,0x24,0xDE,0x23,0x24,0xBE,0xFE,0x91,0x24,0xBE,0xFF,0x00,0xA6,0xBF,0xFF,0x8B,0xFF,0xFF,0xFF,0x01,0xAE,0xDF,0xFF,0x3D,0x1E,0xFF,0x99,0x24,0xBE,0xFF,0x00,0x24,0xBE,0x3F,0x81,0x00,0x00,0x00,0x00,0x24,0xBE,0x7D,0x92,0x24,0xBE,0xFF,0x00,0xA6,0xBF,0xFF,0x8C,0xFF,0xFF,0xFF,0x02,0xF7,0xDF,0xFF,0x96,0x5F,0xFF,0x2C,0xDE,0xFF,0x97,0x24,0xBE,0xFF,0x00,0x24,0xBE,0x98,0x81,0x00,0x00,0x00,0x00,0x24,0xBE,0xC6,0x92,0x24,0xBE,0xFF,0x00,0xA6,0xBF,0xFF,0x8E,0xFF,0xFF,0xFF,0x01,0xE7,0x9F,0xFF,0x6D,0xDE,0xFF,0x96,0x24,0xBE,0xFF,0x03,0x24,0xBE,0xE2,0x00,0x00,0x00,0x1C,0xDF,0x0A,0x24,0xBE,0xF9,0x92,0x24,0xBE,0xFF,0x00,0xA6,0xBF,0xFF,0x90,0xFF,0xFF,0xFF,0x01,0xC7,0x3F,0xFF,0x4D,0x5E,0xFF,0x95,0x24,0xBE,0xFF,0x01,0x2C,0xBD,0x20,0x24,0xDE,0x43,0x93,0x24,0xBE,0xFF,0x00,0xA6,0xBF,0xFF,0x92,0xFF,0xFF,0xFF,0x01,0xA6,0xBF,0xFF,0x35,0x1E,0xFF,0x93,0x24,0xBE,0xFF,0x01,0x24,0xDE,0x5E,0x24,0xDE,0x72,0x93,0x24,0xBE,0xFF,0x00,
+    0xA6,0xBF,0xFF,0x93,0xFF,0xFF,0xFF,0x02,0xF7,0xDF,0xFF,0x86,0x3F,0xFF,0x24,0xDE,0xFF,0x91,0x24,0xBE,0xFF,0x01,0x24,0xBE,0x8D,0x24,0xBE,0x97,0x93,0x24,0xBE,0xFF,0x00,0xA6,0xBF,0xFF,0x95,0xFF,0xFF,0xFF,0x01,0xDF,0x7F,0xFF,0x65,0xBE,0xFF,0x90,0x24,0xBE,0xFF,0x01,0x24,0xBE,0xB1,0x24,0xBE,0xBB,0x93,0x24,0xBE,0xFF,0x00,0xA6,0xBF,0xFF,0x97,0xFF,0xFF,0xFF,0x01,0xBF,0x1F,0xFF,0x45,0x3E,0xFF,0x8E,0x24,0xBE,0xFF,0x01,0x24,0xBE,0xD6,0x24,0xBE,0xD2,0x93,0x24,0xBE,0xFF,0x00,0xA6,0xBF,0xFF,0x99,0xFF,0xFF,0xFF,0x00,0x7E,0x1F,0xFF,0x8D,0x24,0xBE,0xFF,0x01,0x24,0xBE,0xED,0x24,0xBE,0xDE,0x93,0x24,0xBE,0xFF,0x00,0xA6,0xBF,0xFF,0x9A,0xFF,0xFF,0xFF,0x00,0x55,0x7E,0xFF,0x8C,0x24,0xBE,0xFF,0x01,0x24,0xBE,0xF9,0x24,0xBE,0xEB,0x93,0x24,0xBE,0xFF,0x00,0xA6,0xBF,0xFF,0x9A,0xFF,0xFF,0xFF,0x00,0x96,0x7F,0xFF,0x8D,0x24,0xBE,0xFF,0x00,0x24,0xBE,0xEA,0x93,0x24,0xBE,0xFF,0x00,0xA6,0xBF,0xFF,0x9A,0xFF,0xFF,0xFF,0x00,0x96,0x7F,0xFF,0x8D,0x24,0xBE,0xFF,0x00,0x24,0xBE,0xDE,0x93,0x24,
+    0xBE,0xFF,0x00,0xA6,0xBF,0xFF,0x9A,0xFF,0xFF,0xFF,0x00,0x4D,0x5E,0xFF,0x8C,0x24,0xBE,0xFF,0x01,0x24,0xBE,0xF9,0x24,0xBE,0xD2,0x93,0x24,0xBE,0xFF,0x00,0xA6,0xBF,0xFF,0x99,0xFF,0xFF,0xFF,0x00,0x7E,0x1F,0xFF,0x8D,0x24,0xBE,0xFF,0x01,0x24,0xBE,0xED,0x24,0xBE,0xBB,0x93,0x24,0xBE,0xFF,0x00,0xA6,0xBF,0xFF,0x97,0xFF,0xFF,0xFF,0x01,0xBF,0x1F,0xFF,0x45,0x3E,0xFF,0x8E,0x24,0xBE,0xFF,0x01,0x24,0xBE,0xD6,0x24,0xBE,0x97,0x93,0x24,0xBE,0xFF,0x00,0xA6,0xBF,0xFF,0x95,0xFF,0xFF,0xFF,0x01,0xDF,0x7F,0xFF,0x65,0xBE,0xFF,0x90,0x24,0xBE,0xFF,0x01,0x24,0xBE,0xB1,0x24,0xDE,0x72,0x93,0x24,0xBE,0xFF,0x00,0xA6,0xBF,0xFF,0x93,0xFF,0xFF,0xFF,0x02,0xF7,0xDF,0xFF,0x86,0x3F,0xFF,0x24,0xDE,0xFF,0x91,0x24,0xBE,0xFF,0x01,0x24,0xBE,0x8C,0x24,0xBE,0x42,0x93,0x24,0xBE,0xFF,0x00,0xA6,0xBF,0xFF,0x92,0xFF,0xFF,0xFF,0x01,0xA6,0xBF,0xFF,0x34,0xFE,0xFF,0x93,0x24,0xBE,0xFF,0x02,0x24,0xDE,0x5E,0x1C,0xDF,0x0A,0x24,0xBE,0xF9,0x92,0x24,0xBE,0xFF,0x00,0xA6,0xBF,0xFF,0x90,0xFF,0xFF,0xFF,0x01,0xC7,
+    0x3F,0xFF,0x4D,0x5E,0xFF,0x95,0x24,0xBE,0xFF,0x02,0x24,0xBE,0x1F,0x00,0x00,0x00,0x24,0xBE,0xC5,0x92,0x24,0xBE,0xFF,0x00,0xA6,0xBF,0xFF,0x8E,0xFF,0xFF,0xFF,0x01,0xDF,0x9F,0xFF,0x6D,0xDE,0xFF,0x96,0x24,0xBE,0xFF,0x00,0x24,0xBE,0xE2,0x81,0x00,0x00,0x00,0x00,0x24,0xBE,0x7B,0x92,0x24,0xBE,0xFF,0x00,0xA6,0xBF,0xFF,0x8C,0xFF,0xFF,0xFF,0x02,0xF7,0xDF,0xFF,0x96,0x5F,0xFF,0x2C,0xDE,0xFF,0x97,0x24,0xBE,0xFF,0x00,0x24,0xBE,0x97,0x81,0x00,0x00,0x00,0x01,0x24,0xBE,0x22,0x24,0xBE,0xFE,0x91,0x24,0xBE,0xFF,0x00,0xA6,0xBF,0xFF,0x8B,0xFF,0xFF,0xFF,0x01,0xAE,0xDF,0xFF,0x3D,0x1E,0xFF,0x99,0x24,0xBE,0xFF,0x00,0x24,0xBE,0x3D,0x82,0x00,0x00,0x00,0x00,0x24,0xBE,0xC8,0x91,0x24,0xBE,0xFF,0x00,0xA6,0xBF,0xFF,0x89,0xFF,0xFF,0xFF,0x01,0xD7,0x5F,0xFF,0x55,0x7E,0xFF,0x9A,0x24,0xBE,0xFF,0x01,0x24,0xBE,0xE2,0x04,0x1F,0x02,0x82,0x00,0x00,0x00,0x00,0x24,0xBE,0x61,0x91,0x24,0xBE,0xFF,0x00,0xA6,0x9F,0xFF,0x87,0xFF,0xFF,0xFF,0x01,0xE7,0x9F,0xFF,0x6D,0xDE,0xFF,0x9C,0x24,0xBE,0xFF,0x00,
+    0x24,0xBE,0x7D,0x83,0x00,0x00,0x00,0x01,0x34,0xDF,0x05,0x24,0xBE,0xE2,0x90,0x24,0xBE,0xFF,0x00,0x7E,0x1F,0xFF,0x85,0xFF,0xFF,0xFF,0x02,0xF7,0xDF,0xFF,0x96,0x5F,0xFF,0x2C,0xDE,0xFF,0x9C,0x24,0xBE,0xFF,0x01,0x24,0xBE,0xF4,0x2C,0xBE,0x13,0x84,0x00,0x00,0x00,0x00,0x24,0xDE,0x74,0x90,0x24,0xBE,0xFF,0x01,0x2C,0xDE,0xFF,0xD7,0x5F,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xB6,0xDF,0xFF,0x3D,0x1E,0xFF,0x9E,0x24,0xBE,0xFF,0x00,0x24,0xDE,0x8F,0x85,0x00,0x00,0x00,0x01,0x1C,0x7F,0x09,0x24,0xBE,0xDE,0x90,0x24,0xBE,0xFF,0x04,0x2C,0xFE,0xFF,0x96,0x7F,0xFF,0xC7,0x1F,0xFF,0xAE,0xDF,0xFF,0x55,0x7E,0xFF,0x9F,0x24,0xBE,0xFF,0x01,0x24,0xBE,0xEE,0x24,0x9E,0x15,0x86,0x00,0x00,0x00,0x00,0x24,0xDE,0x52,0xB5,0x24,0xBE,0xFF,0x00,0x24,0xDE,0x6D,0x88,0x00,0x00,0x00,0x00,0x24,0xBE,0xB7,0xB3,0x24,0xBE,0xFF,0x01,0x24,0xDE,0xCF,0x44,0x1F,0x04,0x88,0x00,0x00,0x00,0x01,0x24,0xDE,0x17,0x24,0xBE,0xE7,0xB1,0x24,0xBE,0xFF,0x01,0x24,0xBE,0xF4,0x24,0xBE,0x29,0x8A,0x00,0x00,0x00,0x01,0x24,0xBE,0x47,
+    0x24,0xBE,0xFD,0xB0,0x24,0xBE,0xFF,0x00,0x24,0xBE,0x61,0x8C,0x00,0x00,0x00,0x00,0x24,0xBE,0x7B,0xAF,0x24,0xBE,0xFF,0x00,0x24,0xBE,0x96,0x8E,0x00,0x00,0x00,0x00,0x24,0xBE,0x90,0xAD,0x24,0xBE,0xFF,0x01,0x24,0xBE,0xB1,0x44,0x1F,0x04,0x8E,0x00,0x00,0x00,0x01,0x04,0x1F,0x02,0x24,0xBE,0xA7,0xAB,0x24,0xBE,0xFF,0x01,0x24,0xDE,0xBE,0x24,0xFF,0x08,0x90,0x00,0x00,0x00,0x01,0x05,0x5F,0x03,0x24,0xBE,0x96,0xA9,0x24,0xBE,0xFF,0x01,0x24,0xDE,0xAF,0x1C,0x7F,0x09,0x93,0x00,0x00,0x00,0x01,0x24,0xBE,0x7D,0x24,0xBE,0xFE,0xA6,0x24,0xBE,0xFF,0x01,0x24,0xDE,0x94,0x05,0x5F,0x03,0x95,0x00,0x00,0x00,0x01,0x24,0xBE,0x44,0x24,0xBE,0xE7,0xA3,0x24,0xBE,0xFF,0x01,0x24,0xBE,0xF2,0x24,0xBE,0x5C,0x98,0x00,0x00,0x00,0x01,0x24,0x9E,0x1A,0x24,0xBE,0xBB,0xA1,0x24,0xBE,0xFF,0x01,0x24,0xBE,0xCA,0x24,0xBE,0x26,0x9B,0x00,0x00,0x00,0x01,0x24,0xDE,0x4D,0x24,0xBE,0xE0,0x9D,0x24,0xBE,0xFF,0x02,0x24,0xBE,0xED,0x24,0xDE,0x6F,0x05,0x5F,0x03,0x9D,0x00,0x00,0x00,0x02,0x2D,0x1D,0x0B,0x24,0xBE,0x7A,
+    0x24,0xBE,0xE8,0x99,0x24,0xBE,0xFF,0x02,0x24,0xBE,0xF0,0x24,0xBE,0x86,0x2C,0xFE,0x12,0xA1,0x00,0x00,0x00,0x02,0x24,0xFF,0x08,0x24,0xDE,0x68,0x24,0xBE,0xD1,0x95,0x24,0xBE,0xFF,0x02,0x24,0xBE,0xDA,0x24,0xBE,0x75,0x24,0x9D,0x0E,0xA6,0x00,0x00,0x00,0x03,0x24,0xBE,0x2B,0x24,0xBE,0x84,0x24,0xBE,0xCE,0x24,0xBE,0xFD,0x8D,0x24,0xBE,0xFF,0x03,0x24,0xBE,0xFE,0x24,0xBE,0xD5,0x24,0xBE,0x8D,0x24,0xDE,0x34,0xAC,0x00,0x00,0x00,0x0F,0x24,0x7D,0x10,0x24,0xBE,0x4C,0x24,0xBE,0x7C,0x24,0xBE,0xA0,0x24,0xBE,0xC6,0x24,0xBE,0xDD,0x24,0xBE,0xEB,0x24,0xBE,0xF6,0x24,0xBE,0xF8,0x24,0xBE,0xED,0x24,0xBE,0xDD,0x24,0xBE,0xC9,0x24,0xBE,0xA5,0x24,0xBE,0x80,0x24,0xBE,0x51,0x24,0x9E,0x15,0x97,0x00,0x00,0x00,
     };
 const lv_img_dsc_t ui_img_play_png = {
    .header.always_zero = 0,
    .header.w = 64,
    .header.h = 64,
    .data_size = sizeof(ui_img_play_png_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+   .header.cf = LV_IMG_CF_USER_ENCODED_1,
    .data = ui_img_play_png_data};
 
@@ -10,77 +10,51 @@
 #endif
 
 // IMAGE DATA: assets\qr.png
+// Run length encoded LV_IMG_CF_TRUE_COLOR_ALPHA, decoded by src/img_cache.cpp
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_qr_png_data[] = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEA,0xE5,0x0B,0xF3,0x06,0x22,0xEB,0x26,0x2E,0xEB,0x06,0x39,0xF3,0x06,0x39,0xEB,0x25,0x2E,0xF3,0x45,0x22,0xEA,0xE5,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0xC7,0x11,0xEA,0xC7,0x50,0xEA,0xC7,0x91,0xEA,0xE7,0xBD,0xEA,0xE6,0xE4,0xEA,0xE6,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xF3,0x26,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xE4,0xF3,0x45,0xBD,0xF3,0x45,0x90,0xF3,0x45,0x4F,0xEB,0x86,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF2,0xC7,0x11,0xEA,0xA7,0x68,0xEA,0xA7,0xC5,0xEA,0xC7,0xFC,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xE7,0xFF,0xEA,0xE6,0xFF,0xEA,0xE6,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xF3,0x26,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFC,0xF3,0x45,0xC4,0xF3,0x64,0x68,0xF3,0x45,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEA,0xA8,0x2A,0xEA,0x88,0xA2,0xEA,0xA8,0xF8,0xEA,0xA8,0xFF,0xEA,0xA7,0xFF,0xEA,0xA7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xE7,0xFF,0xEA,0xE6,0xFF,0xEA,0xE6,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xF3,0x26,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x64,0xF8,0xF3,0x64,0xA1,0xF3,0x84,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEA,0x88,0x26,0xEA,0x88,0xAD,0xEA,0x88,0xFD,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0xA8,0xFF,0xEA,0xA8,0xFF,0xEA,0xA7,0xFF,0xEA,0xA7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xE7,0xFF,0xEA,0xE6,0xFF,0xEA,0xE6,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xF3,0x26,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xFD,0xF3,0x64,0xAB,0xF3,0x84,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0xAA,0x09,0xEA,0x69,0x80,0xEA,0x69,0xF7,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0xA8,0xFF,0xEA,0xA8,0xFF,0xEA,0xA7,0xFF,0xEA,0xA7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xE7,0xFF,0xEA,0xE6,0xFF,0xEA,0xE6,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xF3,0x26,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xFA,0xF3,0x64,0x91,0xEB,0xA2,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEA,0x69,0x2F,0xEA,0x49,0xD9,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0xA8,0xFF,0xEA,0xA8,0xFF,0xEA,0xA7,0xFF,0xEA,0xA7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xE7,0xFF,0xEA,0xE6,0xFF,0xEA,0xE6,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xF3,0x26,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xD7,0xF3,0x64,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEA,0x49,0x67,0xEA,0x49,0xF7,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0xA8,0xFF,0xEA,0xA8,0xFF,0xEA,0xA7,0xFF,0xEA,0xA7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xE7,0xFF,0xEA,0xE6,0xFF,0xEA,0xE6,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xF3,0x26,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xF6,0xF3,0x84,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0xEA,0x2A,0x89,0xEA,0x29,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0xA8,0xFF,0xEA,0xA8,0xFF,0xEA,0xA7,0xFF,0xEA,0xA7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xE7,0xFF,0xEA,0xE6,0xFF,0xEA,0xE6,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xF3,0x26,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xFF,0xF3,0x84,0x91,0xFC,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF9,0x8C,0x05,0xEA,0x2A,0xA2,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xEA,0x29,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0xA8,0xFF,0xEA,0xA8,0xFF,0xEA,0xA7,0xFF,0xEA,0xA7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xE7,0xFF,0xEA,0xE6,0xFF,0xEA,0xE6,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xF3,0x26,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xFF,0xF3,0x84,0xA1,0xFC,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0xEA,0x0A,0x9F,0xEA,0x0A,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xEA,0x29,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0xA8,0xFF,0xEA,0xA8,0xFF,0xEA,0xA7,0xFF,0xEA,0xA7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xE7,0xFF,0xEA,0xE6,0xFF,0xEA,0xE6,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xF3,0x26,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xA5,0xFC,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE2,0x0A,0x8C,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xEA,0x29,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0xA8,0xFF,0xEA,0xA8,0xFF,0xEA,0xA7,0xFF,0xEA,0xA7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xE7,0xFF,0xEA,0xE6,0xFF,0xEA,0xE6,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xF3,0x26,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xFF,0xF3,0x84,0x93,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE1,0xEB,0x67,0xE1,0xEB,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x4B,0xFF,0xF4,0x72,0xFF,0xF4,0x73,0xFF,0xF4,0x72,0xFF,0xF4,0x92,0xFF,0xF4,0x92,0xFF,0xF4,0x92,0xFF,0xF4,0x92,0xFF,0xF4,0x92,0xFF,0xF4,0x92,0xFF,0xF4,0xB2,0xFF,0xF4,0xB2,0xFF,0xF4,0xB2,0xFF,0xF3,0xCE,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xF3,0x8C,0xFF,0xF4,0xD1,0xFF,0xF5,0x95,0xFF,0xF4,0xD1,0xFF,0xF4,0xD1,0xFF,0xF4,0xD1,0xFF,0xF4,0xD1,0xFF,0xF4,0xD1,0xFF,0xF4,0xF1,0xFF,0xF3,0xCB,0xFF,0xEA,0xE7,0xFF,0xEA,0xE6,0xFF,0xF4,0x2C,0xFF,0xF5,0x10,0xFF,0xF5,0x10,0xFF,0xF5,0x10,0xFF,0xF5,0x10,0xFF,0xF5,0x10,0xFF,0xF5,0x10,0xFF,0xF5,0x10,0xFF,0xF5,0x30,0xFF,0xF5,0x30,0xFF,0xF5,0x2F,0xFF,0xF5,0x2F,0xFF,0xF5,0x2F,0xFF,0xF3,0x85,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xFF,0xF3,0x84,0x64,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD9,0xEB,0x2D,0xE1,0xEB,0xF6,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xEA,0x0A,0xFF,0xEB,0x0E,0xFF,0xFF,0x1C,0xFF,0xF4,0xD4,0xFF,0xF4,0xD4,0xFF,0xF4,0xF4,0xFF,0xF4,0xF4,0xFF,0xF4,0xF4,0xFF,0xF4,0xF4,0xFF,0xF4,0xF4,0xFF,0xF4,0xF4,0xFF,0xF4,0xF3,0xFF,0xF5,0x13,0xFF,0xF5,0x75,0xFF,0xFE,0x9A,0xFF,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xF3,0xCE,0xFF,0xF5,0x13,0xFF,0xFF,0x7D,0xFF,0xF5,0x54,0xFF,0xF5,0x33,0xFF,0xF5,0x33,0xFF,0xF5,0x33,0xFF,0xF5,0x32,0xFF,0xFD,0xF6,0xFF,0xFD,0xF6,0xFF,0xEA,0xC7,0xFF,0xEA,0xE7,0xFF,0xFE,0xB9,0xFF,0xFD,0xB4,0xFF,0xF5,0x52,0xFF,0xF5,0x52,0xFF,0xF5,0x52,0xFF,0xF5,0x72,0xFF,0xF5,0x72,0xFF,0xF5,0x72,0xFF,0xF5,0x71,0xFF,0xF5,0x71,0xFF,0xF5,0x71,0xFF,0xF5,0x71,0xFF,0xFF,0x5B,0xFF,0xF4,0x29,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xF7,0xF3,0x84,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE1,0xCA,0x09,0xD9,0xEB,0xD9,0xD9,0xEB,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xEB,0x0E,0xFF,0xFE,0x39,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xEA,0x29,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEB,0x0C,0xFF,0xFE,0x9A,0xFF,0xEA,0x69,0xFF,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xFE,0xFB,0xFF,0xEB,0x0A,0xFF,0xEA,0xA8,0xFF,0xEA,0xA8,0xFF,0xEA,0xA7,0xFF,0xEA,0xA7,0xFF,0xF4,0x2E,0xFF,0xFD,0xF6,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xFE,0xB9,0xFF,0xF3,0x8A,0xFF,0xEA,0xE6,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xF3,0x26,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x45,0xFF,0xFE,0x98,0xFF,0xF4,0x2A,0xFF,0xF3,0x45,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xD7,0xFC,0x04,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD9,0xCB,0x83,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xEB,0x0E,0xFF,0xFE,0x39,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xEA,0x29,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEB,0x0C,0xFF,0xFE,0x9A,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xFE,0xFB,0xFF,0xEA,0xEA,0xFF,0xEA,0x88,0xFF,0xEA,0xA8,0xFF,0xF4,0x0E,0xFF,0xF4,0x6F,0xFF,0xF5,0x74,0xFF,0xFD,0xF6,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xFE,0xB9,0xFF,0xF3,0x8A,0xFF,0xEA,0xE6,0xFF,0xEA,0xE6,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xF3,0x26,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xFE,0x98,0xFF,0xF4,0x2A,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xFF,0xF3,0x84,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD1,0xCC,0x24,0xD1,0xCC,0xF7,0xD9,0xCB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xE1,0xEB,0xFF,0xEB,0x0F,0xFF,0xFE,0x39,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xFE,0x9A,0xFF,0xFF,0x5D,0xFF,0xFF,0x3D,0xFF,0xFF,0x3D,0xFF,0xFF,0x3D,0xFF,0xFF,0x9E,0xFF,0xF4,0x31,0xFF,0xEA,0x49,0xFF,0xEB,0x0C,0xFF,0xFE,0x9A,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x68,0xFF,0xFE,0xFB,0xFF,0xEA,0xEA,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xFF,0x9E,0xFF,0xF5,0x94,0xFF,0xF5,0x94,0xFF,0xF4,0x2E,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xFE,0xB9,0xFF,0xF3,0x8A,0xFF,0xEA,0xE7,0xFF,0xF4,0x8F,0xFF,0xFF,0xBE,0xFF,0xFF,0x5C,0xFF,0xFF,0x5C,0xFF,0xFF,0x5C,0xFF,0xFF,0x7C,0xFF,0xFE,0xD9,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xFE,0x98,0xFF,0xF4,0x0A,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xF8,0xF3,0x84,0x26,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xD1,0xCC,0xAD,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD9,0xCB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xE3,0x0F,0xFF,0xF6,0x39,0xFF,0xE1,0xEB,0xFF,0xEA,0x0A,0xFF,0xFE,0xDB,0xFF,0xEA,0x8C,0xFF,0xEA,0x0A,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xF5,0x15,0xFF,0xF4,0x72,0xFF,0xEA,0x49,0xFF,0xEB,0x0C,0xFF,0xFE,0x9A,0xFF,0xEA,0x49,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xFE,0xFB,0xFF,0xEA,0xEA,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xFF,0x5D,0xFF,0xEA,0xA8,0xFF,0xEA,0xA8,0xFF,0xEA,0xA7,0xFF,0xEA,0xA7,0xFF,0xEA,0xC7,0xFF,0xFE,0xB9,0xFF,0xF3,0x6A,0xFF,0xEA,0xC7,0xFF,0xF4,0xD0,0xFF,0xF5,0x73,0xFF,0xEA,0xE6,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xF3,0x68,0xFF,0xFF,0x1A,0xFF,0xF3,0x26,0xFF,0xF3,0x25,0xFF,0xFE,0x98,0xFF,0xF4,0x0A,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xAA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC9,0xCC,0x29,0xD1,0xCC,0xFD,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD9,0xCB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xE3,0x0F,0xFF,0xF6,0x39,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xFE,0xDB,0xFF,0xEA,0x6C,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x2A,0xFF,0xF5,0x15,0xFF,0xF4,0x72,0xFF,0xEA,0x29,0xFF,0xEA,0xEC,0xFF,0xFE,0x9A,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xFE,0xFB,0xFF,0xEA,0xEA,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xFF,0x7D,0xFF,0xEB,0x4B,0xFF,0xEB,0x4B,0xFF,0xEA,0xC8,0xFF,0xEA,0xA7,0xFF,0xEA,0xA7,0xFF,0xFE,0xB9,0xFF,0xF3,0x6A,0xFF,0xEA,0xC7,0xFF,0xF4,0xD0,0xFF,0xF5,0x73,0xFF,0xEA,0xE6,0xFF,0xEA,0xE6,0xFF,0xEB,0x06,0xFF,0xF3,0x68,0xFF,0xFF,0x1B,0xFF,0xEB,0x06,0xFF,0xF3,0x26,0xFF,0xFE,0x98,0xFF,0xF4,0x0A,0xFF,0xF3,0x25,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xFD,0xF3,0x84,0x2B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC9,0xAC,0xA2,0xC9,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD9,0xCB,0xFF,0xD9,0xEB,0xFF,0xE2,0xEF,0xFF,0xF6,0x39,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xFE,0xDB,0xFF,0xEA,0x6C,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xF5,0x15,0xFF,0xF4,0x72,0xFF,0xEA,0x2A,0xFF,0xEA,0xEC,0xFF,0xFE,0x9A,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x69,0xFF,0xFE,0x38,0xFF,0xEA,0xAA,0xFF,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xFE,0x37,0xFF,0xFE,0x99,0xFF,0xFF,0x1B,0xFF,0xF5,0x74,0xFF,0xEA,0xA8,0xFF,0xEA,0xA7,0xFF,0xFE,0xB9,0xFF,0xEB,0x6A,0xFF,0xEA,0xC7,0xFF,0xF4,0xD0,0xFF,0xF5,0x73,0xFF,0xEA,0xE7,0xFF,0xEA,0xE6,0xFF,0xEA,0xE6,0xFF,0xF3,0x68,0xFF,0xFF,0x1B,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xFE,0x98,0xFF,0xF4,0x0A,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x64,0xFF,0xF3,0x64,0xA1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xED,0x11,0xC9,0xAC,0xF8,0xC9,0xAC,0xFF,0xC9,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD9,0xCB,0xFF,0xE2,0xEF,0xFF,0xF6,0x39,0xFF,0xD9,0xEB,0xFF,0xE1,0xEB,0xFF,0xFE,0xDB,0xFF,0xEA,0x6C,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xF5,0x15,0xFF,0xF4,0x72,0xFF,0xEA,0x2A,0xFF,0xEA,0xEC,0xFF,0xFE,0x9A,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xF4,0x70,0xFF,0xF5,0x74,0xFF,0xEA,0xA8,0xFF,0xEA,0xA8,0xFF,0xFE,0xB9,0xFF,0xEB,0x6A,0xFF,0xEA,0xC7,0xFF,0xF4,0xD0,0xFF,0xF5,0x73,0xFF,0xEA,0xC7,0xFF,0xEA,0xE7,0xFF,0xEA,0xE6,0xFF,0xF3,0x48,0xFF,0xFF,0x1B,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xFE,0x98,0xFF,0xF4,0x0A,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x64,0xF7,0xEB,0x84,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xAD,0x69,0xC1,0xAD,0xFF,0xC9,0xAC,0xFF,0xC9,0xAC,0xFF,0xC9,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xE2,0xEF,0xFF,0xF6,0x39,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xFE,0xDB,0xFF,0xF6,0x19,0xFF,0xF5,0xF9,0xFF,0xF5,0xF8,0xFF,0xFE,0x18,0xFF,0xFE,0xFC,0xFF,0xF4,0x52,0xFF,0xEA,0x2A,0xFF,0xEA,0xED,0xFF,0xFE,0x9A,0xFF,0xEA,0x29,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xF4,0x50,0xFF,0xF5,0x74,0xFF,0xEA,0x88,0xFF,0xEA,0xA8,0xFF,0xFE,0xBA,0xFF,0xEB,0x4A,0xFF,0xEA,0xA7,0xFF,0xF4,0xB0,0xFF,0xFF,0x1B,0xFF,0xFE,0x57,0xFF,0xFE,0x57,0xFF,0xFE,0x57,0xFF,0xFE,0x78,0xFF,0xFE,0xFA,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xFE,0x98,0xFF,0xF3,0xEA,0xFF,0xF3,0x26,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x65,0x66,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xC1,0xAD,0xC5,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC9,0xAC,0xFF,0xC9,0xAC,0xFF,0xC9,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xDA,0xEF,0xFF,0xF6,0x39,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xE2,0xAE,0xFF,0xE3,0x2F,0xFF,0xEB,0x2F,0xFF,0xEB,0x2F,0xFF,0xEB,0x2F,0xFF,0xEB,0x2F,0xFF,0xEA,0x4B,0xFF,0xEA,0x0A,0xFF,0xEA,0xCD,0xFF,0xFE,0x9A,0xFF,0xEA,0x2A,0xFF,0xEA,0x29,0xFF,0xEB,0x0C,0xFF,0xEA,0x8A,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x68,0xFF,0xEA,0xA9,0xFF,0xEA,0xC9,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xFE,0xBA,0xFF,0xEB,0x4B,0xFF,0xEA,0xA7,0xFF,0xEA,0xE8,0xFF,0xF3,0xCC,0xFF,0xF3,0xCC,0xFF,0xF3,0xCC,0xFF,0xF3,0xEC,0xFF,0xF3,0xEC,0xFF,0xF3,0x89,0xFF,0xEA,0xE6,0xFF,0xEB,0x06,0xFF,0xFE,0x98,0xFF,0xF3,0xEA,0xFF,0xEB,0x06,0xFF,0xF3,0x26,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x44,0xC2,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xB9,0x8E,0x10,0xC1,0x8D,0xFC,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC9,0xAC,0xFF,0xC9,0xAC,0xFF,0xC9,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xDA,0xEF,0xFF,0xF6,0x3A,0xFF,0xD9,0xCB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0xCD,0xFF,0xFE,0x9A,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xF5,0xD7,0xFF,0xF3,0xCF,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xFE,0xBA,0xFF,0xEB,0x4B,0xFF,0xEA,0xA8,0xFF,0xEA,0xA7,0xFF,0xEA,0xA7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xE7,0xFF,0xEA,0xE6,0xFF,0xEA,0xE6,0xFF,0xFE,0x98,0xFF,0xF3,0xEB,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xF3,0x26,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFC,0xEB,0x86,0x10,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xB9,0x8D,0x51,0xB9,0x8D,0xFF,0xC1,0x8D,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC9,0xAC,0xFF,0xC9,0xAC,0xFF,0xC9,0xCC,0xFF,0xD1,0xCC,0xFF,0xDA,0xEF,0xFF,0xF6,0xBB,0xFF,0xE3,0x71,0xFF,0xE3,0x71,0xFF,0xE3,0x91,0xFF,0xE3,0x91,0xFF,0xEB,0x90,0xFF,0xEB,0x90,0xFF,0xEB,0x90,0xFF,0xEB,0x90,0xFF,0xEB,0x90,0xFF,0xEB,0xB0,0xFF,0xF4,0x32,0xFF,0xFE,0x9A,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xF5,0xB7,0xFF,0xF4,0xF4,0xFF,0xF3,0xCF,0xFF,0xF3,0xCF,0xFF,0xF3,0xCF,0xFF,0xF3,0xCF,0xFF,0xF3,0xEF,0xFF,0xF3,0xEF,0xFF,0xF3,0xEF,0xFF,0xEA,0xA9,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xFE,0xBA,0xFF,0xF4,0x90,0xFF,0xF4,0x0E,0xFF,0xF4,0x0E,0xFF,0xF4,0x0E,0xFF,0xF4,0x2E,0xFF,0xF4,0x2E,0xFF,0xF4,0x2D,0xFF,0xF4,0x2D,0xFF,0xF4,0x2D,0xFF,0xF4,0x2D,0xFF,0xF4,0x4D,0xFF,0xFE,0xFA,0xFF,0xF3,0xEB,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xF3,0x26,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0x4D,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xB9,0x8E,0x90,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xC1,0x8D,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC9,0xAC,0xFF,0xC9,0xAC,0xFF,0xC9,0xCC,0xFF,0xD2,0x2D,0xFF,0xED,0x77,0xFF,0xED,0x98,0xFF,0xED,0x97,0xFF,0xF5,0x97,0xFF,0xF5,0x97,0xFF,0xF5,0x97,0xFF,0xF5,0x97,0xFF,0xF5,0x97,0xFF,0xF5,0x97,0xFF,0xF5,0x97,0xFF,0xF5,0x97,0xFF,0xF5,0x97,0xFF,0xF4,0x73,0xFF,0xEA,0x0A,0xFF,0xEA,0x2A,0xFF,0xF3,0xF1,0xFF,0xF5,0xB7,0xFF,0xF5,0xB7,0xFF,0xF5,0xB7,0xFF,0xF5,0xB7,0xFF,0xF5,0xB6,0xFF,0xF5,0xB6,0xFF,0xF5,0xB6,0xFF,0xF5,0xD6,0xFF,0xEB,0x2C,0xFF,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xF4,0xB1,0xFF,0xF5,0xD6,0xFF,0xFD,0xD6,0xFF,0xFD,0xD6,0xFF,0xFD,0xD6,0xFF,0xFD,0xD6,0xFF,0xFD,0xF6,0xFF,0xFD,0xF6,0xFF,0xFD,0xF6,0xFF,0xFD,0xF6,0xFF,0xFD,0xF6,0xFF,0xFD,0xF5,0xFF,0xFD,0xF5,0xFF,0xF3,0x48,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xF3,0x26,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x45,0xFF,0xF3,0x45,0x8E,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xB1,0x8D,0xBE,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xC1,0x8D,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC9,0xAC,0xFF,0xC9,0xAC,0xFF,0xC9,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD9,0xCB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xEA,0x29,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0xA8,0xFF,0xEA,0xA8,0xFF,0xEA,0xA7,0xFF,0xEA,0xA7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xE7,0xFF,0xEA,0xE6,0xFF,0xEA,0xE6,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xF3,0x26,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x45,0xBB,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xB1,0x8E,0xE5,0xB1,0x8E,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xC1,0x8D,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC9,0xAC,0xFF,0xC9,0xAC,0xFF,0xC9,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD9,0xCB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xEA,0x29,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0xA8,0xFF,0xEA,0xA8,0xFF,0xEA,0xA7,0xFF,0xEA,0xA7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xE7,0xFF,0xEA,0xE6,0xFF,0xEA,0xE6,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xF3,0x26,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xE2,0x00,0x00,0x00,
-    0xA9,0x4D,0x0C,0xB1,0x6E,0xFE,0xB1,0x8E,0xFF,0xB1,0x8E,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xC1,0x8D,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC9,0xAC,0xFF,0xD2,0x4E,0xFF,0xF6,0x5A,0xFF,0xF6,0x5A,0xFF,0xF6,0x5A,0xFF,0xF6,0x5A,0xFF,0xF6,0x3A,0xFF,0xD9,0xEC,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xF4,0x73,0xFF,0xFE,0x7A,0xFF,0xFE,0x7A,0xFF,0xFE,0x7A,0xFF,0xFE,0x7A,0xFF,0xFF,0x5D,0xFF,0xFE,0x7A,0xFF,0xFE,0x7A,0xFF,0xFE,0x79,0xFF,0xF4,0x92,0xFF,0xEA,0x69,0xFF,0xEA,0xCA,0xFF,0xFE,0x79,0xFF,0xFE,0x99,0xFF,0xFE,0x99,0xFF,0xFE,0x99,0xFF,0xFE,0x99,0xFF,0xFE,0x99,0xFF,0xF5,0x94,0xFF,0xEA,0xA8,0xFF,0xEA,0xA7,0xFF,0xEA,0xA7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xE7,0xFF,0xEA,0xE6,0xFF,0xEA,0xE6,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xF3,0x26,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFE,0xEA,0xE5,0x0B,
-    0xB1,0x6E,0x21,0xB1,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x8E,0xFF,0xB1,0x8E,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xC1,0x8D,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xD2,0xD0,0xFF,0xF6,0x7B,0xFF,0xD2,0x8F,0xFF,0xD2,0x8F,0xFF,0xDA,0x8F,0xFF,0xDA,0x6E,0xFF,0xDA,0xEF,0xFF,0xE3,0xF2,0xFF,0xE3,0xF2,0xFF,0xEB,0xF2,0xFF,0xEB,0xF2,0xFF,0xEB,0xF2,0xFF,0xEB,0xF2,0xFF,0xEA,0x6C,0xFF,0xEA,0x0A,0xFF,0xF5,0xB7,0xFF,0xF4,0x32,0xFF,0xEA,0xED,0xFF,0xEA,0xED,0xFF,0xEB,0x2E,0xFF,0xFF,0x1C,0xFF,0xEB,0x0C,0xFF,0xEB,0x0C,0xFF,0xEB,0x0C,0xFF,0xEA,0x8A,0xFF,0xEA,0x49,0xFF,0xEA,0x69,0xFF,0xEB,0x0B,0xFF,0xEB,0x2C,0xFF,0xEB,0x2B,0xFF,0xEB,0x2B,0xFF,0xEB,0x4B,0xFF,0xF3,0xAD,0xFF,0xFE,0xDA,0xFF,0xEA,0xA8,0xFF,0xEA,0xA8,0xFF,0xEA,0xA7,0xFF,0xEA,0xA7,0xFF,0xEB,0x29,0xFF,0xEA,0xE8,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xE7,0xFF,0xEA,0xE6,0xFF,0xEA,0xE6,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xF3,0x26,0xFF,0xF3,0x25,0xFF,0xEB,0x25,0x1E,
-    0xA9,0x6E,0x2D,0xA9,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x8E,0xFF,0xB1,0x8E,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xC1,0x8D,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xD2,0xD0,0xFF,0xEE,0x3A,0xFF,0xC9,0xAC,0xFF,0xC9,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xF5,0xD8,0xFF,0xF5,0xD8,0xFF,0xED,0x36,0xFF,0xED,0x36,0xFF,0xED,0x36,0xFF,0xF5,0x36,0xFF,0xF5,0x36,0xFF,0xE2,0xAD,0xFF,0xE1,0xEB,0xFF,0xF5,0xB7,0xFF,0xEB,0xB0,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x6B,0xFF,0xFE,0xFC,0xFF,0xEA,0x2A,0xFF,0xEA,0x29,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xEB,0x0A,0xFF,0xFE,0xDA,0xFF,0xEA,0x88,0xFF,0xEA,0xA8,0xFF,0xEA,0xA8,0xFF,0xEA,0xA7,0xFF,0xF5,0x95,0xFF,0xF4,0x6F,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xE7,0xFF,0xEA,0xE6,0xFF,0xEA,0xE6,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xF3,0x26,0xFF,0xEB,0x25,0x2B,
-    0xA1,0x6E,0x3A,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x8E,0xFF,0xB1,0x8E,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xC1,0x8D,0xFF,0xC1,0xAD,0xFF,0xC2,0x0E,0xFF,0xDB,0xB2,0xFF,0xC9,0xAC,0xFF,0xC9,0xAC,0xFF,0xC9,0xCC,0xFF,0xD1,0xCC,0xFF,0xED,0xD8,0xFF,0xDB,0x51,0xFF,0xD1,0xCC,0xFF,0xD9,0xCB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xF5,0xB7,0xFF,0xEB,0x90,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x6B,0xFF,0xFE,0xFC,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xEA,0x29,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x69,0xFF,0xEA,0x89,0xFF,0xEA,0xCA,0xFF,0xEA,0xCA,0xFF,0xEB,0x4C,0xFF,0xFE,0xDB,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0xA8,0xFF,0xEA,0xA8,0xFF,0xF5,0xB5,0xFF,0xF4,0x6F,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xE7,0xFF,0xEA,0xE6,0xFF,0xEA,0xE6,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xF3,0x06,0x39,
-    0xA1,0x6E,0x3A,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x8E,0xFF,0xB1,0x8E,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xC1,0x8D,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC9,0xAC,0xFF,0xC9,0xAC,0xFF,0xC9,0xCC,0xFF,0xED,0xD9,0xFF,0xDB,0x51,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD9,0xCB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xE1,0xEB,0xFF,0xF5,0xB7,0xFF,0xEB,0x90,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x6B,0xFF,0xFE,0xFC,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xEA,0x29,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xFE,0x59,0xFF,0xFF,0x1C,0xFF,0xFE,0xFB,0xFF,0xFE,0xFB,0xFF,0xFF,0x7D,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0xA8,0xFF,0xF5,0xB5,0xFF,0xF4,0x6F,0xFF,0xEA,0xA7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xE7,0xFF,0xEA,0xE6,0xFF,0xEA,0xE6,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0x39,
-    0xA1,0x6E,0x2D,0xA1,0x6F,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x8E,0xFF,0xB1,0x8E,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xC2,0x4F,0xFF,0xE4,0xF7,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC9,0xAC,0xFF,0xC9,0xAC,0xFF,0xED,0xD9,0xFF,0xDB,0x51,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD9,0xCB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xF5,0xB7,0xFF,0xEB,0x90,0xFF,0xE1,0xEB,0xFF,0xEA,0x0A,0xFF,0xEA,0x4B,0xFF,0xFF,0x9E,0xFF,0xF5,0xB7,0xFF,0xF5,0xB7,0xFF,0xF5,0xB7,0xFF,0xEB,0x6E,0xFF,0xEA,0x29,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xFE,0x79,0xFF,0xEB,0x2C,0xFF,0xEA,0x69,0xFF,0xEA,0xEB,0xFF,0xFE,0xDB,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xF5,0x95,0xFF,0xF4,0x6F,0xFF,0xEA,0xA7,0xFF,0xEA,0xA7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xE7,0xFF,0xEA,0xE6,0xFF,0xEA,0xE6,0xFF,0xEB,0x06,0xFF,0xEB,0x06,0xFF,0xEB,0x25,0x2B,
-    0xA1,0x6F,0x21,0xA1,0x4F,0xFF,0xA1,0x6F,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x8E,0xFF,0xB1,0x8E,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xCA,0xB0,0xFF,0xEE,0x5B,0xFF,0xCA,0x6F,0xFF,0xCA,0x8F,0xFF,0xCA,0x8F,0xFF,0xD2,0x8F,0xFF,0xEE,0x1A,0xFF,0xDB,0x51,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD9,0xCB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xF5,0xB8,0xFF,0xEB,0x90,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xEA,0x0A,0xFF,0xEB,0x6F,0xFF,0xEB,0xB0,0xFF,0xEB,0xB0,0xFF,0xF3,0xB0,0xFF,0xEA,0xAC,0xFF,0xEA,0x2A,0xFF,0xEA,0x4A,0xFF,0xEB,0x0C,0xFF,0xEB,0x0C,0xFF,0xFE,0xBA,0xFF,0xEB,0x2C,0xFF,0xEA,0x69,0xFF,0xEA,0xEB,0xFF,0xFE,0xFB,0xFF,0xEB,0x2B,0xFF,0xEB,0x2B,0xFF,0xEB,0x4B,0xFF,0xEB,0x4B,0xFF,0xFD,0xF6,0xFF,0xF4,0x6F,0xFF,0xEA,0xA8,0xFF,0xEA,0xA7,0xFF,0xEA,0xA7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xE7,0xFF,0xEA,0xE6,0xFF,0xEA,0xE6,0xFF,0xEB,0x06,0xFF,0xEA,0xE6,0x1E,
-    0xA9,0x50,0x0C,0xA1,0x4F,0xFE,0xA1,0x4F,0xFF,0xA1,0x6F,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x8E,0xFF,0xB1,0x8E,0xFF,0xB9,0x8D,0xFF,0xC2,0x2F,0xFF,0xEE,0x3A,0xFF,0xEE,0x5B,0xFF,0xEE,0x5B,0xFF,0xEE,0x5A,0xFF,0xF6,0x5A,0xFF,0xF6,0x5A,0xFF,0xD2,0x8F,0xFF,0xC9,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD9,0xCB,0xFF,0xD9,0xEB,0xFF,0xEC,0x73,0xFF,0xE2,0xCE,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xF3,0xF0,0xFF,0xFE,0x7A,0xFF,0xFE,0x7A,0xFF,0xFE,0x79,0xFF,0xEA,0xCB,0xFF,0xEA,0x49,0xFF,0xEA,0x8A,0xFF,0xFE,0x79,0xFF,0xFE,0x99,0xFF,0xFE,0x99,0xFF,0xFE,0x99,0xFF,0xFE,0x99,0xFF,0xFE,0x99,0xFF,0xF3,0xAC,0xFF,0xEA,0xA8,0xFF,0xEA,0xA8,0xFF,0xEA,0xA7,0xFF,0xEA,0xA7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xE7,0xFF,0xEA,0xE6,0xFF,0xEA,0xE6,0xFE,0xEA,0xE5,0x0B,
-    0x00,0x00,0x00,0xA1,0x4F,0xE5,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x6F,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x8E,0xFF,0xB1,0x8E,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xC1,0x8D,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC9,0xAC,0xFF,0xC9,0xAC,0xFF,0xC9,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD9,0xCB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xEA,0x29,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0xA8,0xFF,0xEA,0xA8,0xFF,0xEA,0xA7,0xFF,0xEA,0xA7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xE7,0xFF,0xEA,0xE6,0xE2,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x99,0x4F,0xBE,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x6F,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x8E,0xFF,0xB1,0x8E,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xC1,0x8D,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC9,0xAC,0xFF,0xC9,0xAC,0xFF,0xC9,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD9,0xCB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xEA,0x29,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0xA8,0xFF,0xEA,0xA8,0xFF,0xEA,0xA7,0xFF,0xEA,0xA7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xBB,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x99,0x4F,0x90,0x99,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x6F,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0xEF,0xFF,0xE5,0x58,0xFF,0xE5,0x78,0xFF,0xE5,0x78,0xFF,0xE5,0x78,0xFF,0xE5,0x78,0xFF,0xE5,0x78,0xFF,0xE5,0x78,0xFF,0xE5,0x78,0xFF,0xED,0x78,0xFF,0xED,0x78,0xFF,0xED,0x78,0xFF,0xED,0x78,0xFF,0xE4,0x54,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xE3,0x30,0xFF,0xF5,0x97,0xFF,0xF5,0x97,0xFF,0xF5,0x97,0xFF,0xFE,0x9A,0xFF,0xF5,0xB7,0xFF,0xF5,0x97,0xFF,0xF5,0x97,0xFF,0xF3,0xF1,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xF4,0x73,0xFF,0xF5,0xB7,0xFF,0xF5,0xB7,0xFF,0xF5,0xB7,0xFF,0xF5,0xB7,0xFF,0xF5,0xB7,0xFF,0xF5,0xB6,0xFF,0xF5,0xB6,0xFF,0xF5,0xB6,0xFF,0xF5,0xD6,0xFF,0xF5,0xD6,0xFF,0xF5,0xD6,0xFF,0xF5,0xB6,0xFF,0xEA,0xEA,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0xA8,0xFF,0xEA,0xA8,0xFF,0xEA,0xA7,0xFF,0xEA,0xA7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xE7,0x8E,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x99,0x50,0x50,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x6F,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xBA,0xB1,0xFF,0xEE,0x9C,0xFF,0xCB,0x32,0xFF,0xCB,0x52,0xFF,0xCB,0x52,0xFF,0xCB,0x52,0xFF,0xCB,0x52,0xFF,0xD3,0x52,0xFF,0xD3,0x52,0xFF,0xD3,0x52,0xFF,0xD3,0x52,0xFF,0xD3,0x72,0xFF,0xDB,0xF3,0xFF,0xF6,0x7B,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xDA,0x4D,0xFF,0xE3,0x71,0xFF,0xE3,0x91,0xFF,0xE3,0x91,0xFF,0xFE,0xFC,0xFF,0xEC,0x12,0xFF,0xEB,0x90,0xFF,0xF4,0xD4,0xFF,0xF5,0xB7,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xFE,0x9A,0xFF,0xF4,0x32,0xFF,0xF3,0xB0,0xFF,0xF3,0xAF,0xFF,0xF3,0xCF,0xFF,0xF3,0xCF,0xFF,0xF3,0xCF,0xFF,0xF3,0xCF,0xFF,0xF3,0xCF,0xFF,0xF3,0xEF,0xFF,0xF3,0xEF,0xFF,0xF3,0xEF,0xFF,0xFE,0xDA,0xFF,0xEB,0x8C,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0xA8,0xFF,0xEA,0xA8,0xFF,0xEA,0xA7,0xFF,0xEA,0xA7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0xFF,0xEA,0xC7,0x4D,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x89,0x10,0x10,0x99,0x50,0xFC,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x6F,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xBA,0xB1,0xFF,0xE6,0x1A,0xFF,0xB1,0x6E,0xFF,0xB1,0x8E,0xFF,0xB1,0x8E,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xC1,0x8D,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xD2,0x6F,0xFF,0xF6,0x7B,0xFF,0xC9,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD9,0xCB,0xFF,0xD9,0xEB,0xFF,0xF6,0x9B,0xFF,0xE2,0x8D,0xFF,0xE1,0xEB,0xFF,0xEB,0x90,0xFF,0xF5,0xB7,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xFE,0x9A,0xFF,0xEA,0xCD,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xEA,0x29,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xFE,0x59,0xFF,0xEB,0x6C,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0xA8,0xFF,0xEA,0xA8,0xFF,0xEA,0xA7,0xFF,0xEA,0xA7,0xFF,0xEA,0xC7,0xFB,0xEA,0xA6,0x0F,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x91,0x30,0xC4,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x6F,0xFF,0xA9,0x6E,0xFF,0xBA,0x91,0xFF,0xE6,0x1A,0xFF,0xB1,0x6E,0xFF,0xB1,0x6E,0xFF,0xBA,0x50,0xFF,0xC2,0xD1,0xFF,0xC2,0xD1,0xFF,0xCA,0xD1,0xFF,0xCA,0xF1,0xFF,0xCA,0xF1,0xFF,0xC1,0xEE,0xFF,0xC1,0xAD,0xFF,0xCA,0x6F,0xFF,0xF6,0x7B,0xFF,0xC9,0xAC,0xFF,0xC9,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD9,0xCB,0xFF,0xF6,0x9B,0xFF,0xE2,0x8D,0xFF,0xD9,0xEB,0xFF,0xEB,0x90,0xFF,0xF5,0xB7,0xFF,0xE1,0xEB,0xFF,0xEA,0x0A,0xFF,0xFE,0x9A,0xFF,0xEA,0xCD,0xFF,0xEA,0x0A,0xFF,0xEA,0x4B,0xFF,0xEB,0x4E,0xFF,0xEB,0x4E,0xFF,0xEB,0x6E,0xFF,0xEB,0x6E,0xFF,0xEB,0x6E,0xFF,0xEB,0x0C,0xFF,0xEA,0x49,0xFF,0xEA,0x69,0xFF,0xFE,0x59,0xFF,0xEB,0x6D,0xFF,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0xA8,0xFF,0xEA,0xA8,0xFF,0xEA,0xA7,0xFF,0xEA,0xA7,0xC1,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x91,0x30,0x68,0x91,0x30,0xFF,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x6F,0xFF,0xBA,0x92,0xFF,0xE6,0x1A,0xFF,0xA9,0x6E,0xFF,0xB1,0x6E,0xFF,0xF6,0xBC,0xFF,0xED,0xFA,0xFF,0xE5,0xD9,0xFF,0xED,0xD9,0xFF,0xED,0xD9,0xFF,0xF6,0xFC,0xFF,0xD3,0xF4,0xFF,0xC1,0xAD,0xFF,0xCA,0x6F,0xFF,0xF6,0x7B,0xFF,0xC9,0xAC,0xFF,0xC9,0xAC,0xFF,0xC9,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xF6,0x9B,0xFF,0xDA,0x8E,0xFF,0xD9,0xEB,0xFF,0xEB,0x90,0xFF,0xF5,0xB7,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xFE,0x9A,0xFF,0xEA,0xCD,0xFF,0xEA,0x0A,0xFF,0xF4,0x52,0xFF,0xFE,0xFC,0xFF,0xFE,0x18,0xFF,0xFE,0x18,0xFF,0xFE,0x18,0xFF,0xFE,0x39,0xFF,0xFE,0xDB,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xFE,0x59,0xFF,0xEB,0x6D,0xFF,0xEA,0x69,0xFF,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0xA8,0xFF,0xEA,0xA8,0xFF,0xEA,0xA7,0x65,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x91,0x70,0x11,0x91,0x30,0xF8,0x91,0x30,0xFF,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xB2,0x92,0xFF,0xE6,0x1A,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xF6,0xBC,0xFF,0xB9,0xEF,0xFF,0xB1,0x8E,0xFF,0xB1,0x8E,0xFF,0xB9,0x8D,0xFF,0xDC,0xD6,0xFF,0xD4,0x14,0xFF,0xC1,0x8D,0xFF,0xCA,0x6F,0xFF,0xF6,0x7B,0xFF,0xC1,0xAD,0xFF,0xC9,0xAC,0xFF,0xE4,0x74,0xFF,0xFF,0x3D,0xFF,0xFF,0x3D,0xFF,0xFF,0x3D,0xFF,0xFF,0x3D,0xFF,0xFF,0x5D,0xFF,0xDA,0x4D,0xFF,0xD9,0xEB,0xFF,0xE3,0x0F,0xFF,0xF5,0x16,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xFE,0x9A,0xFF,0xEA,0xCD,0xFF,0xEA,0x0A,0xFF,0xF4,0x52,0xFF,0xF5,0x15,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xEA,0xAB,0xFF,0xFE,0xFB,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xFE,0x59,0xFF,0xEB,0x6D,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0xA8,0xF7,0xEA,0x88,0x10,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x91,0x30,0xA1,0x91,0x30,0xFF,0x91,0x30,0xFF,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xB2,0x92,0xFF,0xE6,0x1A,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xEE,0xBC,0xFF,0xB1,0xEF,0xFF,0xB1,0x6E,0xFF,0xB1,0x8E,0xFF,0xB1,0x8E,0xFF,0xDC,0xD6,0xFF,0xD4,0x14,0xFF,0xB9,0x8D,0xFF,0xCA,0x6F,0xFF,0xF6,0x7B,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC9,0xAC,0xFF,0xC9,0xAC,0xFF,0xC9,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD9,0xCB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xE1,0xEB,0xFF,0xFE,0x7A,0xFF,0xEA,0xAD,0xFF,0xEA,0x0A,0xFF,0xF4,0x52,0xFF,0xF5,0x15,0xFF,0xEA,0x0A,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xEA,0xAB,0xFF,0xFE,0xFB,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xFE,0x59,0xFF,0xEB,0x4D,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xA0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x91,0x30,0x28,0x91,0x30,0xFD,0x91,0x30,0xFF,0x91,0x30,0xFF,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0xA1,0x4F,0xFF,0xB2,0x92,0xFF,0xE6,0x1A,0xFF,0xA1,0x6F,0xFF,0xA9,0x6E,0xFF,0xEE,0xBC,0xFF,0xB1,0xEF,0xFF,0xB1,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x8E,0xFF,0xDC,0xD6,0xFF,0xD4,0x14,0xFF,0xB9,0x8D,0xFF,0xC2,0x6F,0xFF,0xEE,0x7B,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC9,0xAC,0xFF,0xC9,0xAC,0xFF,0xC9,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD9,0xCB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xFE,0x7A,0xFF,0xE2,0xAD,0xFF,0xE1,0xEB,0xFF,0xF4,0x53,0xFF,0xF5,0x15,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x2A,0xFF,0xEA,0x8B,0xFF,0xFE,0xDB,0xFF,0xEA,0x29,0xFF,0xEA,0x49,0xFF,0xFE,0x59,0xFF,0xEB,0x4D,0xFF,0xEA,0x49,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFC,0xEA,0xA8,0x27,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x91,0x30,0xAB,0x91,0x30,0xFF,0x91,0x30,0xFF,0x91,0x30,0xFF,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0xB2,0x92,0xFF,0xE6,0x1B,0xFF,0xA1,0x4F,0xFF,0xA1,0x6F,0xFF,0xEE,0xBC,0xFF,0xB1,0xF0,0xFF,0xA9,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x6E,0xFF,0xDC,0xB7,0xFF,0xD4,0x14,0xFF,0xB9,0x8D,0xFF,0xC2,0x70,0xFF,0xEE,0x7B,0xFF,0xC1,0x8D,0xFF,0xC1,0xAD,0xFF,0xE4,0xF6,0xFF,0xD2,0xF0,0xFF,0xC9,0xAC,0xFF,0xC9,0xAC,0xFF,0xC9,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD9,0xCB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xF6,0x7A,0xFF,0xE2,0xAE,0xFF,0xE1,0xEB,0xFF,0xF4,0x53,0xFF,0xF4,0xF5,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x8C,0xFF,0xFE,0xDB,0xFF,0xEA,0x2A,0xFF,0xEA,0x29,0xFF,0xFE,0x59,0xFF,0xEB,0x4D,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x68,0xFF,0xEA,0x88,0xA8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x89,0x10,0x24,0x91,0x30,0xF7,0x91,0x30,0xFF,0x91,0x30,0xFF,0x91,0x30,0xFF,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0xAA,0x92,0xFF,0xE6,0x1B,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xEE,0x7B,0xFF,0xF7,0x3D,0xFF,0xF7,0x1D,0xFF,0xF7,0x1D,0xFF,0xF7,0x1D,0xFF,0xFF,0x9E,0xFF,0xCB,0xB4,0xFF,0xB1,0x8E,0xFF,0xC2,0x50,0xFF,0xEE,0x7B,0xFF,0xB9,0x8D,0xFF,0xC1,0x8D,0xFF,0xE5,0x98,0xFF,0xD3,0x52,0xFF,0xC1,0xAD,0xFF,0xC9,0xAC,0xFF,0xC9,0xAC,0xFF,0xD2,0x6E,0xFF,0xED,0x77,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD9,0xCB,0xFF,0xD9,0xEB,0xFF,0xF6,0x7A,0xFF,0xE2,0xAE,0xFF,0xE1,0xEB,0xFF,0xEB,0xF2,0xFF,0xFF,0x9E,0xFF,0xFF,0x3D,0xFF,0xFF,0x3D,0xFF,0xFF,0x3D,0xFF,0xFF,0x5D,0xFF,0xFE,0x9A,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xFE,0x59,0xFF,0xEB,0x4D,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0xF6,0xEA,0x88,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x89,0x30,0x81,0x91,0x30,0xFF,0x91,0x30,0xFF,0x91,0x30,0xFF,0x91,0x30,0xFF,0x99,0x4F,0xFF,0xAA,0x72,0xFF,0xE5,0xFB,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x6F,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x8E,0xFF,0xC2,0x50,0xFF,0xEE,0x7B,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xE5,0x98,0xFF,0xD3,0x52,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC9,0xAC,0xFF,0xD2,0xAF,0xFF,0xF6,0x3A,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD9,0xCB,0xFF,0xF6,0x7A,0xFF,0xE2,0xAE,0xFF,0xD9,0xEB,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xFE,0x59,0xFF,0xEB,0x4D,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x69,0xFF,0xEA,0x69,0x7D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x10,0x08,0x89,0x30,0xD7,0x91,0x30,0xFF,0x91,0x30,0xFF,0x91,0x30,0xFF,0x91,0x30,0xFF,0xAA,0x72,0xFF,0xE5,0xFB,0xFF,0x99,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x6F,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x6E,0xFF,0xBA,0x50,0xFF,0xEE,0x7B,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xE5,0x98,0xFF,0xD3,0x52,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xD2,0xAF,0xFF,0xF6,0x3A,0xFF,0xC9,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xF6,0x7A,0xFF,0xE2,0xAE,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x2A,0xFF,0xFE,0x59,0xFF,0xEB,0x2E,0xFF,0xEA,0x29,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xD5,0xDA,0x49,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x89,0x10,0x2C,0x89,0x30,0xF5,0x91,0x30,0xFF,0x91,0x30,0xFF,0x91,0x30,0xFF,0xAA,0x72,0xFF,0xEE,0xFD,0xFF,0xCC,0x77,0xFF,0xCC,0x77,0xFF,0xCC,0x77,0xFF,0xCC,0x77,0xFF,0xCC,0x77,0xFF,0xD4,0x76,0xFF,0xD4,0x76,0xFF,0xD4,0x76,0xFF,0xD4,0x96,0xFF,0xD4,0x96,0xFF,0xDC,0xF7,0xFF,0xEE,0x7B,0xFF,0xB1,0x8E,0xFF,0xB9,0x8D,0xFF,0xE5,0x78,0xFF,0xE5,0x78,0xFF,0xDC,0x96,0xFF,0xDC,0x96,0xFF,0xE4,0x96,0xFF,0xE5,0x37,0xFF,0xF7,0x1D,0xFF,0xE4,0xB5,0xFF,0xE4,0xB5,0xFF,0xDA,0xCF,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xF6,0x7B,0xFF,0xED,0x36,0xFF,0xEC,0xB5,0xFF,0xEC,0xB5,0xFF,0xEC,0xD5,0xFF,0xEC,0xD5,0xFF,0xF4,0xD4,0xFF,0xF4,0xD4,0xFF,0xF4,0xD4,0xFF,0xF4,0xD4,0xFF,0xF4,0xD4,0xFF,0xF4,0xD4,0xFF,0xFF,0x1C,0xFF,0xEB,0x2E,0xFF,0xEA,0x2A,0xFF,0xEA,0x29,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xF7,0xEA,0x69,0x2F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x89,0x30,0x64,0x89,0x30,0xFF,0x91,0x30,0xFF,0x91,0x30,0xFF,0x99,0x70,0xFF,0xBB,0xD6,0xFF,0xC3,0xF6,0xFF,0xC3,0xF6,0xFF,0xC3,0xF6,0xFF,0xC3,0xF6,0xFF,0xCC,0x16,0xFF,0xCC,0x15,0xFF,0xCC,0x15,0xFF,0xCC,0x15,0xFF,0xCC,0x15,0xFF,0xCC,0x15,0xFF,0xD4,0x15,0xFF,0xC3,0x12,0xFF,0xB1,0x8E,0xFF,0xB1,0x8E,0xFF,0xC2,0xD1,0xFF,0xD4,0x35,0xFF,0xDC,0x34,0xFF,0xDC,0x34,0xFF,0xDC,0x34,0xFF,0xDC,0x55,0xFF,0xE5,0x16,0xFF,0xDC,0x34,0xFF,0xE4,0x34,0xFF,0xD2,0x8F,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xDB,0x51,0xFF,0xE4,0x54,0xFF,0xEC,0x53,0xFF,0xEC,0x53,0xFF,0xEC,0x53,0xFF,0xEC,0x53,0xFF,0xEC,0x53,0xFF,0xEC,0x53,0xFF,0xF4,0x73,0xFF,0xF4,0x73,0xFF,0xF4,0x73,0xFF,0xF4,0x73,0xFF,0xF4,0x52,0xFF,0xEA,0x4B,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xEA,0x29,0xFF,0xEA,0x29,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x89,0x30,0x8B,0x89,0x30,0xFF,0x91,0x30,0xFF,0x91,0x30,0xFF,0x91,0x30,0xFF,0x91,0x30,0xFF,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x6F,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x8E,0xFF,0xB1,0x8E,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xC1,0x8D,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC9,0xAC,0xFF,0xC9,0xAC,0xFF,0xC9,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD9,0xCB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0xFF,0xEA,0x2A,0x87,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x1F,0x01,0x89,0x30,0x9E,0x89,0x30,0xFF,0x91,0x30,0xFF,0x91,0x30,0xFF,0x91,0x30,0xFF,0x91,0x30,0xFF,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x6F,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x8E,0xFF,0xB1,0x8E,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xC1,0x8D,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC9,0xAC,0xFF,0xC9,0xAC,0xFF,0xC9,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD9,0xCB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x2A,0xA4,0xF8,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x10,0x04,0x89,0x30,0xA1,0x89,0x30,0xFF,0x91,0x30,0xFF,0x91,0x30,0xFF,0x91,0x30,0xFF,0x91,0x30,0xFF,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x6F,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x8E,0xFF,0xB1,0x8E,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xC1,0x8D,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC9,0xAC,0xFF,0xC9,0xAC,0xFF,0xC9,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD9,0xCB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xFF,0xEA,0x0A,0xA0,0xFA,0x08,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x1F,0x01,0x89,0x30,0x80,0x89,0x30,0xFF,0x91,0x30,0xFF,0x91,0x30,0xFF,0x91,0x30,0xFF,0x91,0x30,0xFF,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x6F,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x8E,0xFF,0xB1,0x8E,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xC1,0x8D,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC9,0xAC,0xFF,0xC9,0xAC,0xFF,0xC9,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD9,0xCB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xE1,0xEB,0xFF,0xE9,0xEA,0x91,0xFC,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x89,0x30,0x63,0x89,0x30,0xF6,0x91,0x30,0xFF,0x91,0x30,0xFF,0x91,0x30,0xFF,0x91,0x30,0xFF,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x6F,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x8E,0xFF,0xB1,0x8E,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xC1,0x8D,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC9,0xAC,0xFF,0xC9,0xAC,0xFF,0xC9,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD9,0xCB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xFF,0xE1,0xEB,0xF5,0xE1,0xEB,0x61,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x89,0x11,0x2D,0x89,0x30,0xD7,0x91,0x30,0xFF,0x91,0x30,0xFF,0x91,0x30,0xFF,0x91,0x30,0xFF,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x6F,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x8E,0xFF,0xB1,0x8E,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xC1,0x8D,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC9,0xAC,0xFF,0xC9,0xAC,0xFF,0xC9,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD9,0xCB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xD5,0xE1,0xCB,0x2B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0x50,0x06,0x89,0x30,0x77,0x91,0x30,0xF7,0x91,0x30,0xFF,0x91,0x30,0xFF,0x91,0x30,0xFF,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x6F,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x8E,0xFF,0xB1,0x8E,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xC1,0x8D,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC9,0xAC,0xFF,0xC9,0xAC,0xFF,0xC9,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xFF,0xD1,0xCC,0xF6,0xD9,0xEC,0x80,0xDA,0x0C,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x89,0x10,0x24,0x91,0x30,0xAA,0x91,0x30,0xFD,0x91,0x30,0xFF,0x91,0x30,0xFF,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x6F,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x8E,0xFF,0xB1,0x8E,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xC1,0x8D,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC9,0xAC,0xFF,0xC9,0xAC,0xFF,0xC9,0xCC,0xFF,0xD1,0xCC,0xFD,0xD1,0xCC,0xA8,0xD1,0xEC,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x91,0x30,0x28,0x91,0x30,0xA1,0x91,0x30,0xF7,0x91,0x30,0xFF,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x6F,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x8E,0xFF,0xB1,0x8E,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xC1,0x8D,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC1,0xAD,0xFF,0xC9,0xAC,0xF7,0xC9,0xCC,0xA0,0xC9,0xCC,0x27,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x89,0x10,0x10,0x91,0x30,0x66,0x91,0x30,0xC2,0x99,0x50,0xFC,0x99,0x4F,0xFF,0x99,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x6F,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x8E,0xFF,0xB1,0x8E,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xB9,0x8D,0xFF,0xC1,0x8D,0xFB,0xC1,0xAD,0xC1,0xC1,0xAD,0x65,0xB9,0x8E,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x99,0x11,0x0F,0x99,0x4F,0x4D,0x99,0x2F,0x8F,0x99,0x4F,0xBB,0xA1,0x4F,0xE2,0xA1,0x4F,0xFF,0xA1,0x4F,0xFF,0xA1,0x6F,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xA9,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x6E,0xFF,0xB1,0x8E,0xE1,0xB1,0x8E,0xBB,0xB9,0x8D,0x8E,0xB9,0x8D,0x4D,0xB1,0xAD,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA8,0xEE,0x09,0xA1,0x6F,0x21,0xA1,0x6E,0x2D,0xA1,0x6F,0x39,0xA9,0x6F,0x39,0xA9,0x6E,0x2D,0xB1,0x6E,0x21,0xA9,0xCE,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x9B,0x00,0x00,0x00,0x07,0xEA,0xE5,0x0B,0xF3,0x06,0x22,0xEB,0x26,0x2E,0xEB,0x06,0x39,0xF3,0x06,0x39,0xEB,0x25,0x2E,0xF3,0x45,0x22,0xEA,0xE5,0x0B,0xB2,0x00,0x00,0x00,0x05,0xF2,0xC7,0x11,0xEA,0xC7,0x50,0xEA,0xC7,0x91,0xEA,0xE7,0xBD,0xEA,0xE6,0xE4,0xEA,0xE6,0xFF,0x83,0xEB,0x06,0xFF,0x00,0xF3,0x26,0xFF,0x81,0xF3,0x25,0xFF,0x04,0xF3,0x25,0xE4,0xF3,0x45,0xBD,0xF3,0x45,0x90,0xF3,0x45,0x4F,0xEB,0x86,0x10,0xAA,0x00,0x00,0x00,0x03,0xF2,0xC7,0x11,0xEA,0xA7,0x68,0xEA,0xA7,0xC5,0xEA,0xC7,0xFC,0x82,0xEA,0xC7,0xFF,0x00,0xEA,0xE7,0xFF,0x81,0xEA,0xE6,0xFF,0x83,0xEB,0x06,0xFF,0x00,0xF3,0x26,0xFF,0x82,0xF3,0x25,0xFF,0x81,0xF3,0x45,0xFF,0x03,0xF3,0x45,0xFC,0xF3,0x45,0xC4,0xF3,0x64,0x68,0xF3,0x45,0x11,0xA5,0x00,0x00,0x00,0x03,0xEA,0xA8,0x2A,0xEA,0x88,0xA2,0xEA,0xA8,0xF8,0xEA,0xA8,0xFF,0x81,0xEA,0xA7,0xFF,0x83,0xEA,0xC7,0xFF,0x00,0xEA,0xE7,0xFF,0x81,0xEA,0xE6,0xFF,0x83,0xEB,0x06,0xFF,0x00,0xF3,0x26,0xFF,0x82,0xF3,0x25,0xFF,0x83,0xF3,0x45,0xFF,0x02,0xF3,0x64,0xF8,0xF3,
+    0x64,0xA1,0xF3,0x84,0x29,0xA1,0x00,0x00,0x00,0x02,0xEA,0x88,0x26,0xEA,0x88,0xAD,0xEA,0x88,0xFD,0x81,0xEA,0x88,0xFF,0x81,0xEA,0xA8,0xFF,0x81,0xEA,0xA7,0xFF,0x83,0xEA,0xC7,0xFF,0x00,0xEA,0xE7,0xFF,0x81,0xEA,0xE6,0xFF,0x83,0xEB,0x06,0xFF,0x00,0xF3,0x26,0xFF,0x82,0xF3,0x25,0xFF,0x83,0xF3,0x45,0xFF,0x03,0xF3,0x64,0xFF,0xF3,0x64,0xFD,0xF3,0x64,0xAB,0xF3,0x84,0x24,0x9D,0x00,0x00,0x00,0x03,0xE2,0xAA,0x09,0xEA,0x69,0x80,0xEA,0x69,0xF7,0xEA,0x68,0xFF,0x83,0xEA,0x88,0xFF,0x81,0xEA,0xA8,0xFF,0x81,0xEA,0xA7,0xFF,0x83,0xEA,0xC7,0xFF,0x00,0xEA,0xE7,0xFF,0x81,0xEA,0xE6,0xFF,0x83,0xEB,0x06,0xFF,0x00,0xF3,0x26,0xFF,0x82,0xF3,0x25,0xFF,0x83,0xF3,0x45,0xFF,0x81,0xF3,0x64,0xFF,0x02,0xF3,0x64,0xFA,0xF3,0x64,0x91,0xEB,0xA2,0x0B,0x9A,0x00,0x00,0x00,0x01,0xEA,0x69,0x2F,0xEA,0x49,0xD9,0x82,0xEA,0x69,0xFF,0x00,0xEA,0x68,0xFF,0x83,0xEA,0x88,0xFF,0x81,0xEA,0xA8,0xFF,0x81,0xEA,0xA7,0xFF,0x83,0xEA,0xC7,0xFF,0x00,0xEA,0xE7,0xFF,0x81,0xEA,0xE6,0xFF,0x83,0xEB,0x06,0xFF,0x00,0xF3,
+    0x26,0xFF,0x82,0xF3,0x25,0xFF,0x83,0xF3,0x45,0xFF,0x82,0xF3,0x64,0xFF,0x01,0xF3,0x64,0xD7,0xF3,0x64,0x2E,0x98,0x00,0x00,0x00,0x01,0xEA,0x49,0x67,0xEA,0x49,0xF7,0x81,0xEA,0x49,0xFF,0x82,0xEA,0x69,0xFF,0x00,0xEA,0x68,0xFF,0x83,0xEA,0x88,0xFF,0x81,0xEA,0xA8,0xFF,0x81,0xEA,0xA7,0xFF,0x83,0xEA,0xC7,0xFF,0x00,0xEA,0xE7,0xFF,0x81,0xEA,0xE6,0xFF,0x83,0xEB,0x06,0xFF,0x00,0xF3,0x26,0xFF,0x82,0xF3,0x25,0xFF,0x83,0xF3,0x45,0xFF,0x82,0xF3,0x64,0xFF,0x01,0xF3,0x64,0xF6,0xF3,0x84,0x64,0x95,0x00,0x00,0x00,0x02,0xF8,0x00,0x01,0xEA,0x2A,0x89,0xEA,0x29,0xFF,0x83,0xEA,0x49,0xFF,0x82,0xEA,0x69,0xFF,0x00,0xEA,0x68,0xFF,0x83,0xEA,0x88,0xFF,0x81,0xEA,0xA8,0xFF,0x81,0xEA,0xA7,0xFF,0x83,0xEA,0xC7,0xFF,0x00,0xEA,0xE7,0xFF,0x81,0xEA,0xE6,0xFF,0x83,0xEB,0x06,0xFF,0x00,0xF3,0x26,0xFF,0x82,0xF3,0x25,0xFF,0x83,0xF3,0x45,0xFF,0x83,0xF3,0x64,0xFF,0x01,0xF3,0x84,0x91,0xFC,0x00,0x02,0x92,0x00,0x00,0x00,0x01,0xF9,0x8C,0x05,0xEA,0x2A,0xA2,0x81,0xEA,0x2A,0xFF,0x00,0xEA,0x29,0xFF,0x83,
+    0xEA,0x49,0xFF,0x82,0xEA,0x69,0xFF,0x00,0xEA,0x68,0xFF,0x83,0xEA,0x88,0xFF,0x81,0xEA,0xA8,0xFF,0x81,0xEA,0xA7,0xFF,0x83,0xEA,0xC7,0xFF,0x00,0xEA,0xE7,0xFF,0x81,0xEA,0xE6,0xFF,0x83,0xEB,0x06,0xFF,0x00,0xF3,0x26,0xFF,0x82,0xF3,0x25,0xFF,0x83,0xF3,0x45,0xFF,0x83,0xF3,0x64,0xFF,0x01,0xF3,0x84,0xA1,0xFC,0x08,0x04,0x90,0x00,0x00,0x00,0x02,0xF8,0x00,0x01,0xEA,0x0A,0x9F,0xEA,0x0A,0xFF,0x82,0xEA,0x2A,0xFF,0x00,0xEA,0x29,0xFF,0x83,0xEA,0x49,0xFF,0x82,0xEA,0x69,0xFF,0x00,0xEA,0x68,0xFF,0x83,0xEA,0x88,0xFF,0x81,0xEA,0xA8,0xFF,0x81,0xEA,0xA7,0xFF,0x83,0xEA,0xC7,0xFF,0x00,0xEA,0xE7,0xFF,0x81,0xEA,0xE6,0xFF,0x83,0xEB,0x06,0xFF,0x00,0xF3,0x26,0xFF,0x82,0xF3,0x25,0xFF,0x83,0xF3,0x45,0xFF,0x83,0xF3,0x64,0xFF,0x01,0xF3,0x64,0xA5,0xFC,0x00,0x02,0x8F,0x00,0x00,0x00,0x00,0xE2,0x0A,0x8C,0x82,0xEA,0x0A,0xFF,0x82,0xEA,0x2A,0xFF,0x00,0xEA,0x29,0xFF,0x83,0xEA,0x49,0xFF,0x82,0xEA,0x69,0xFF,0x00,0xEA,0x68,0xFF,0x83,0xEA,0x88,0xFF,0x81,0xEA,0xA8,0xFF,0x81,0xEA,0xA7,0xFF,0x83,
+    0xEA,0xC7,0xFF,0x00,0xEA,0xE7,0xFF,0x81,0xEA,0xE6,0xFF,0x83,0xEB,0x06,0xFF,0x00,0xF3,0x26,0xFF,0x82,0xF3,0x25,0xFF,0x83,0xF3,0x45,0xFF,0x83,0xF3,0x64,0xFF,0x00,0xF3,0x84,0x93,0x8E,0x00,0x00,0x00,0x01,0xE1,0xEB,0x67,0xE1,0xEB,0xFF,0x81,0xEA,0x0A,0xFF,0x03,0xEA,0x4B,0xFF,0xF4,0x72,0xFF,0xF4,0x73,0xFF,0xF4,0x72,0xFF,0x85,0xF4,0x92,0xFF,0x82,0xF4,0xB2,0xFF,0x00,0xF3,0xCE,0xFF,0x81,0xEA,0x88,0xFF,0x02,0xF3,0x8C,0xFF,0xF4,0xD1,0xFF,0xF5,0x95,0xFF,0x84,0xF4,0xD1,0xFF,0x04,0xF4,0xF1,0xFF,0xF3,0xCB,0xFF,0xEA,0xE7,0xFF,0xEA,0xE6,0xFF,0xF4,0x2C,0xFF,0x86,0xF5,0x10,0xFF,0x81,0xF5,0x30,0xFF,0x82,0xF5,0x2F,0xFF,0x00,0xF3,0x85,0xFF,0x82,0xF3,0x64,0xFF,0x00,0xF3,0x84,0x64,0x8C,0x00,0x00,0x00,0x01,0xD9,0xEB,0x2D,0xE1,0xEB,0xF6,0x81,0xE1,0xEB,0xFF,0x02,0xEA,0x0A,0xFF,0xEB,0x0E,0xFF,0xFF,0x1C,0xFF,0x81,0xF4,0xD4,0xFF,0x85,0xF4,0xF4,0xFF,0x09,0xF4,0xF3,0xFF,0xF5,0x13,0xFF,0xF5,0x75,0xFF,0xFE,0x9A,0xFF,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xF3,0xCE,0xFF,0xF5,0x13,0xFF,0xFF,
+    0x7D,0xFF,0xF5,0x54,0xFF,0x82,0xF5,0x33,0xFF,0x00,0xF5,0x32,0xFF,0x81,0xFD,0xF6,0xFF,0x03,0xEA,0xC7,0xFF,0xEA,0xE7,0xFF,0xFE,0xB9,0xFF,0xFD,0xB4,0xFF,0x82,0xF5,0x52,0xFF,0x82,0xF5,0x72,0xFF,0x83,0xF5,0x71,0xFF,0x01,0xFF,0x5B,0xFF,0xF4,0x29,0xFF,0x82,0xF3,0x64,0xFF,0x01,0xF3,0x64,0xF7,0xF3,0x84,0x30,0x8A,0x00,0x00,0x00,0x02,0xE1,0xCA,0x09,0xD9,0xEB,0xD9,0xD9,0xEB,0xFF,0x82,0xE1,0xEB,0xFF,0x01,0xEB,0x0E,0xFF,0xFE,0x39,0xFF,0x81,0xEA,0x0A,0xFF,0x82,0xEA,0x2A,0xFF,0x00,0xEA,0x29,0xFF,0x83,0xEA,0x49,0xFF,0x03,0xEB,0x0C,0xFF,0xFE,0x9A,0xFF,0xEA,0x69,0xFF,0xEA,0x68,0xFF,0x81,0xEA,0x88,0xFF,0x01,0xFE,0xFB,0xFF,0xEB,0x0A,0xFF,0x81,0xEA,0xA8,0xFF,0x81,0xEA,0xA7,0xFF,0x01,0xF4,0x2E,0xFF,0xFD,0xF6,0xFF,0x81,0xEA,0xC7,0xFF,0x02,0xFE,0xB9,0xFF,0xF3,0x8A,0xFF,0xEA,0xE6,0xFF,0x83,0xEB,0x06,0xFF,0x00,0xF3,0x26,0xFF,0x82,0xF3,0x25,0xFF,0x03,0xF3,0x45,0xFF,0xFE,0x98,0xFF,0xF4,0x2A,0xFF,0xF3,0x45,0xFF,0x82,0xF3,0x64,0xFF,0x01,0xF3,0x64,0xD7,0xFC,0x04,0x08,0x89,0x00,
+    0x00,0x00,0x00,0xD9,0xCB,0x83,0x82,0xD9,0xEB,0xFF,0x81,0xE1,0xEB,0xFF,0x01,0xEB,0x0E,0xFF,0xFE,0x39,0xFF,0x82,0xEA,0x0A,0xFF,0x82,0xEA,0x2A,0xFF,0x00,0xEA,0x29,0xFF,0x82,0xEA,0x49,0xFF,0x01,0xEB,0x0C,0xFF,0xFE,0x9A,0xFF,0x81,0xEA,0x69,0xFF,0x09,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xFE,0xFB,0xFF,0xEA,0xEA,0xFF,0xEA,0x88,0xFF,0xEA,0xA8,0xFF,0xF4,0x0E,0xFF,0xF4,0x6F,0xFF,0xF5,0x74,0xFF,0xFD,0xF6,0xFF,0x81,0xEA,0xC7,0xFF,0x01,0xFE,0xB9,0xFF,0xF3,0x8A,0xFF,0x81,0xEA,0xE6,0xFF,0x83,0xEB,0x06,0xFF,0x00,0xF3,0x26,0xFF,0x82,0xF3,0x25,0xFF,0x01,0xFE,0x98,0xFF,0xF4,0x2A,0xFF,0x81,0xF3,0x45,0xFF,0x82,0xF3,0x64,0xFF,0x00,0xF3,0x84,0x80,0x88,0x00,0x00,0x00,0x02,0xD1,0xCC,0x24,0xD1,0xCC,0xF7,0xD9,0xCB,0xFF,0x82,0xD9,0xEB,0xFF,0x02,0xE1,0xEB,0xFF,0xEB,0x0F,0xFF,0xFE,0x39,0xFF,0x81,0xEA,0x0A,0xFF,0x01,0xFE,0x9A,0xFF,0xFF,0x5D,0xFF,0x82,0xFF,0x3D,0xFF,0x04,0xFF,0x9E,0xFF,0xF4,0x31,0xFF,0xEA,0x49,0xFF,0xEB,0x0C,0xFF,0xFE,0x9A,0xFF,0x82,0xEA,0x69,0xFF,0x02,0xEA,0x68,0xFF,
+    0xFE,0xFB,0xFF,0xEA,0xEA,0xFF,0x81,0xEA,0x88,0xFF,0x00,0xFF,0x9E,0xFF,0x81,0xF5,0x94,0xFF,0x00,0xF4,0x2E,0xFF,0x81,0xEA,0xC7,0xFF,0x04,0xFE,0xB9,0xFF,0xF3,0x8A,0xFF,0xEA,0xE7,0xFF,0xF4,0x8F,0xFF,0xFF,0xBE,0xFF,0x82,0xFF,0x5C,0xFF,0x01,0xFF,0x7C,0xFF,0xFE,0xD9,0xFF,0x81,0xF3,0x25,0xFF,0x01,0xFE,0x98,0xFF,0xF4,0x0A,0xFF,0x82,0xF3,0x45,0xFF,0x81,0xF3,0x64,0xFF,0x01,0xF3,0x64,0xF8,0xF3,0x84,0x26,0x87,0x00,0x00,0x00,0x00,0xD1,0xCC,0xAD,0x81,0xD1,0xCC,0xFF,0x00,0xD9,0xCB,0xFF,0x82,0xD9,0xEB,0xFF,0x06,0xE3,0x0F,0xFF,0xF6,0x39,0xFF,0xE1,0xEB,0xFF,0xEA,0x0A,0xFF,0xFE,0xDB,0xFF,0xEA,0x8C,0xFF,0xEA,0x0A,0xFF,0x81,0xEA,0x2A,0xFF,0x05,0xF5,0x15,0xFF,0xF4,0x72,0xFF,0xEA,0x49,0xFF,0xEB,0x0C,0xFF,0xFE,0x9A,0xFF,0xEA,0x49,0xFF,0x82,0xEA,0x69,0xFF,0x01,0xFE,0xFB,0xFF,0xEA,0xEA,0xFF,0x81,0xEA,0x88,0xFF,0x00,0xFF,0x5D,0xFF,0x81,0xEA,0xA8,0xFF,0x81,0xEA,0xA7,0xFF,0x06,0xEA,0xC7,0xFF,0xFE,0xB9,0xFF,0xF3,0x6A,0xFF,0xEA,0xC7,0xFF,0xF4,0xD0,0xFF,0xF5,0x73,0xFF,0xEA,0xE6,
+    0xFF,0x81,0xEB,0x06,0xFF,0x05,0xF3,0x68,0xFF,0xFF,0x1A,0xFF,0xF3,0x26,0xFF,0xF3,0x25,0xFF,0xFE,0x98,0xFF,0xF4,0x0A,0xFF,0x83,0xF3,0x45,0xFF,0x81,0xF3,0x64,0xFF,0x00,0xF3,0x64,0xAA,0x86,0x00,0x00,0x00,0x01,0xC9,0xCC,0x29,0xD1,0xCC,0xFD,0x82,0xD1,0xCC,0xFF,0x00,0xD9,0xCB,0xFF,0x81,0xD9,0xEB,0xFF,0x01,0xE3,0x0F,0xFF,0xF6,0x39,0xFF,0x81,0xE1,0xEB,0xFF,0x01,0xFE,0xDB,0xFF,0xEA,0x6C,0xFF,0x81,0xEA,0x0A,0xFF,0x05,0xEA,0x2A,0xFF,0xF5,0x15,0xFF,0xF4,0x72,0xFF,0xEA,0x29,0xFF,0xEA,0xEC,0xFF,0xFE,0x9A,0xFF,0x81,0xEA,0x49,0xFF,0x81,0xEA,0x69,0xFF,0x01,0xFE,0xFB,0xFF,0xEA,0xEA,0xFF,0x81,0xEA,0x88,0xFF,0x00,0xFF,0x7D,0xFF,0x81,0xEB,0x4B,0xFF,0x00,0xEA,0xC8,0xFF,0x81,0xEA,0xA7,0xFF,0x04,0xFE,0xB9,0xFF,0xF3,0x6A,0xFF,0xEA,0xC7,0xFF,0xF4,0xD0,0xFF,0xF5,0x73,0xFF,0x81,0xEA,0xE6,0xFF,0x07,0xEB,0x06,0xFF,0xF3,0x68,0xFF,0xFF,0x1B,0xFF,0xEB,0x06,0xFF,0xF3,0x26,0xFF,0xFE,0x98,0xFF,0xF4,0x0A,0xFF,0xF3,0x25,0xFF,0x83,0xF3,0x45,0xFF,0x02,0xF3,0x64,0xFF,0xF3,0x64,0xFD,0xF3,
+    0x84,0x2B,0x85,0x00,0x00,0x00,0x01,0xC9,0xAC,0xA2,0xC9,0xCC,0xFF,0x83,0xD1,0xCC,0xFF,0x03,0xD9,0xCB,0xFF,0xD9,0xEB,0xFF,0xE2,0xEF,0xFF,0xF6,0x39,0xFF,0x81,0xE1,0xEB,0xFF,0x01,0xFE,0xDB,0xFF,0xEA,0x6C,0xFF,0x82,0xEA,0x0A,0xFF,0x04,0xF5,0x15,0xFF,0xF4,0x72,0xFF,0xEA,0x2A,0xFF,0xEA,0xEC,0xFF,0xFE,0x9A,0xFF,0x82,0xEA,0x49,0xFF,0x10,0xEA,0x69,0xFF,0xFE,0x38,0xFF,0xEA,0xAA,0xFF,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xFE,0x37,0xFF,0xFE,0x99,0xFF,0xFF,0x1B,0xFF,0xF5,0x74,0xFF,0xEA,0xA8,0xFF,0xEA,0xA7,0xFF,0xFE,0xB9,0xFF,0xEB,0x6A,0xFF,0xEA,0xC7,0xFF,0xF4,0xD0,0xFF,0xF5,0x73,0xFF,0xEA,0xE7,0xFF,0x81,0xEA,0xE6,0xFF,0x01,0xF3,0x68,0xFF,0xFF,0x1B,0xFF,0x81,0xEB,0x06,0xFF,0x01,0xFE,0x98,0xFF,0xF4,0x0A,0xFF,0x81,0xF3,0x25,0xFF,0x83,0xF3,0x45,0xFF,0x01,0xF3,0x64,0xFF,0xF3,0x64,0xA1,0x84,0x00,0x00,0x00,0x03,0xC1,0xED,0x11,0xC9,0xAC,0xF8,0xC9,0xAC,0xFF,0xC9,0xCC,0xFF,0x83,0xD1,0xCC,0xFF,0x06,0xD9,0xCB,0xFF,0xE2,0xEF,0xFF,0xF6,0x39,0xFF,0xD9,0xEB,0xFF,0xE1,0xEB,0xFF,0xFE,
+    0xDB,0xFF,0xEA,0x6C,0xFF,0x82,0xEA,0x0A,0xFF,0x04,0xF5,0x15,0xFF,0xF4,0x72,0xFF,0xEA,0x2A,0xFF,0xEA,0xEC,0xFF,0xFE,0x9A,0xFF,0x83,0xEA,0x49,0xFF,0x82,0xEA,0x69,0xFF,0x00,0xEA,0x68,0xFF,0x81,0xEA,0x88,0xFF,0x01,0xF4,0x70,0xFF,0xF5,0x74,0xFF,0x81,0xEA,0xA8,0xFF,0x09,0xFE,0xB9,0xFF,0xEB,0x6A,0xFF,0xEA,0xC7,0xFF,0xF4,0xD0,0xFF,0xF5,0x73,0xFF,0xEA,0xC7,0xFF,0xEA,0xE7,0xFF,0xEA,0xE6,0xFF,0xF3,0x48,0xFF,0xFF,0x1B,0xFF,0x81,0xEB,0x06,0xFF,0x01,0xFE,0x98,0xFF,0xF4,0x0A,0xFF,0x82,0xF3,0x25,0xFF,0x83,0xF3,0x45,0xFF,0x01,0xF3,0x64,0xF7,0xEB,0x84,0x10,0x83,0x00,0x00,0x00,0x01,0xC1,0xAD,0x69,0xC1,0xAD,0xFF,0x81,0xC9,0xAC,0xFF,0x00,0xC9,0xCC,0xFF,0x83,0xD1,0xCC,0xFF,0x01,0xE2,0xEF,0xFF,0xF6,0x39,0xFF,0x81,0xD9,0xEB,0xFF,0x0A,0xFE,0xDB,0xFF,0xF6,0x19,0xFF,0xF5,0xF9,0xFF,0xF5,0xF8,0xFF,0xFE,0x18,0xFF,0xFE,0xFC,0xFF,0xF4,0x52,0xFF,0xEA,0x2A,0xFF,0xEA,0xED,0xFF,0xFE,0x9A,0xFF,0xEA,0x29,0xFF,0x83,0xEA,0x49,0xFF,0x82,0xEA,0x69,0xFF,0x0A,0xEA,0x68,0xFF,0xEA,0x88,0xFF,
+    0xF4,0x50,0xFF,0xF5,0x74,0xFF,0xEA,0x88,0xFF,0xEA,0xA8,0xFF,0xFE,0xBA,0xFF,0xEB,0x4A,0xFF,0xEA,0xA7,0xFF,0xF4,0xB0,0xFF,0xFF,0x1B,0xFF,0x82,0xFE,0x57,0xFF,0x01,0xFE,0x78,0xFF,0xFE,0xFA,0xFF,0x81,0xEB,0x06,0xFF,0x02,0xFE,0x98,0xFF,0xF3,0xEA,0xFF,0xF3,0x26,0xFF,0x82,0xF3,0x25,0xFF,0x83,0xF3,0x45,0xFF,0x00,0xF3,0x65,0x66,0x83,0x00,0x00,0x00,0x00,0xC1,0xAD,0xC5,0x81,0xC1,0xAD,0xFF,0x81,0xC9,0xAC,0xFF,0x00,0xC9,0xCC,0xFF,0x82,0xD1,0xCC,0xFF,0x01,0xDA,0xEF,0xFF,0xF6,0x39,0xFF,0x81,0xD9,0xEB,0xFF,0x01,0xE2,0xAE,0xFF,0xE3,0x2F,0xFF,0x83,0xEB,0x2F,0xFF,0x07,0xEA,0x4B,0xFF,0xEA,0x0A,0xFF,0xEA,0xCD,0xFF,0xFE,0x9A,0xFF,0xEA,0x2A,0xFF,0xEA,0x29,0xFF,0xEB,0x0C,0xFF,0xEA,0x8A,0xFF,0x81,0xEA,0x49,0xFF,0x82,0xEA,0x69,0xFF,0x02,0xEA,0x68,0xFF,0xEA,0xA9,0xFF,0xEA,0xC9,0xFF,0x81,0xEA,0x88,0xFF,0x03,0xFE,0xBA,0xFF,0xEB,0x4B,0xFF,0xEA,0xA7,0xFF,0xEA,0xE8,0xFF,0x82,0xF3,0xCC,0xFF,0x81,0xF3,0xEC,0xFF,0x06,0xF3,0x89,0xFF,0xEA,0xE6,0xFF,0xEB,0x06,0xFF,0xFE,0x98,0xFF,0xF3,
+    0xEA,0xFF,0xEB,0x06,0xFF,0xF3,0x26,0xFF,0x82,0xF3,0x25,0xFF,0x82,0xF3,0x45,0xFF,0x00,0xF3,0x44,0xC2,0x82,0x00,0x00,0x00,0x01,0xB9,0x8E,0x10,0xC1,0x8D,0xFC,0x82,0xC1,0xAD,0xFF,0x81,0xC9,0xAC,0xFF,0x00,0xC9,0xCC,0xFF,0x81,0xD1,0xCC,0xFF,0x02,0xDA,0xEF,0xFF,0xF6,0x3A,0xFF,0xD9,0xCB,0xFF,0x82,0xD9,0xEB,0xFF,0x82,0xE1,0xEB,0xFF,0x82,0xEA,0x0A,0xFF,0x01,0xEA,0xCD,0xFF,0xFE,0x9A,0xFF,0x81,0xEA,0x2A,0xFF,0x01,0xF5,0xD7,0xFF,0xF3,0xCF,0xFF,0x82,0xEA,0x49,0xFF,0x82,0xEA,0x69,0xFF,0x00,0xEA,0x68,0xFF,0x82,0xEA,0x88,0xFF,0x02,0xFE,0xBA,0xFF,0xEB,0x4B,0xFF,0xEA,0xA8,0xFF,0x81,0xEA,0xA7,0xFF,0x83,0xEA,0xC7,0xFF,0x00,0xEA,0xE7,0xFF,0x81,0xEA,0xE6,0xFF,0x01,0xFE,0x98,0xFF,0xF3,0xEB,0xFF,0x81,0xEB,0x06,0xFF,0x00,0xF3,0x26,0xFF,0x82,0xF3,0x25,0xFF,0x81,0xF3,0x45,0xFF,0x01,0xF3,0x45,0xFC,0xEB,0x86,0x10,0x81,0x00,0x00,0x00,0x02,0xB9,0x8D,0x51,0xB9,0x8D,0xFF,0xC1,0x8D,0xFF,0x82,0xC1,0xAD,0xFF,0x81,0xC9,0xAC,0xFF,0x03,0xC9,0xCC,0xFF,0xD1,0xCC,0xFF,0xDA,0xEF,0xFF,0xF6,
+    0xBB,0xFF,0x81,0xE3,0x71,0xFF,0x81,0xE3,0x91,0xFF,0x84,0xEB,0x90,0xFF,0x02,0xEB,0xB0,0xFF,0xF4,0x32,0xFF,0xFE,0x9A,0xFF,0x81,0xEA,0x2A,0xFF,0x01,0xF5,0xB7,0xFF,0xF4,0xF4,0xFF,0x83,0xF3,0xCF,0xFF,0x82,0xF3,0xEF,0xFF,0x00,0xEA,0xA9,0xFF,0x81,0xEA,0x88,0xFF,0x01,0xFE,0xBA,0xFF,0xF4,0x90,0xFF,0x82,0xF4,0x0E,0xFF,0x81,0xF4,0x2E,0xFF,0x83,0xF4,0x2D,0xFF,0x02,0xF4,0x4D,0xFF,0xFE,0xFA,0xFF,0xF3,0xEB,0xFF,0x82,0xEB,0x06,0xFF,0x00,0xF3,0x26,0xFF,0x82,0xF3,0x25,0xFF,0x81,0xF3,0x45,0xFF,0x00,0xF3,0x45,0x4D,0x81,0x00,0x00,0x00,0x00,0xB9,0x8E,0x90,0x81,0xB9,0x8D,0xFF,0x00,0xC1,0x8D,0xFF,0x82,0xC1,0xAD,0xFF,0x81,0xC9,0xAC,0xFF,0x04,0xC9,0xCC,0xFF,0xD2,0x2D,0xFF,0xED,0x77,0xFF,0xED,0x98,0xFF,0xED,0x97,0xFF,0x88,0xF5,0x97,0xFF,0x03,0xF4,0x73,0xFF,0xEA,0x0A,0xFF,0xEA,0x2A,0xFF,0xF3,0xF1,0xFF,0x83,0xF5,0xB7,0xFF,0x82,0xF5,0xB6,0xFF,0x05,0xF5,0xD6,0xFF,0xEB,0x2C,0xFF,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xF4,0xB1,0xFF,0xF5,0xD6,0xFF,0x83,0xFD,0xD6,0xFF,0x84,0xFD,0xF6,0xFF,
+    0x81,0xFD,0xF5,0xFF,0x00,0xF3,0x48,0xFF,0x83,0xEB,0x06,0xFF,0x00,0xF3,0x26,0xFF,0x82,0xF3,0x25,0xFF,0x01,0xF3,0x45,0xFF,0xF3,0x45,0x8E,0x81,0x00,0x00,0x00,0x00,0xB1,0x8D,0xBE,0x82,0xB9,0x8D,0xFF,0x00,0xC1,0x8D,0xFF,0x82,0xC1,0xAD,0xFF,0x81,0xC9,0xAC,0xFF,0x00,0xC9,0xCC,0xFF,0x83,0xD1,0xCC,0xFF,0x00,0xD9,0xCB,0xFF,0x82,0xD9,0xEB,0xFF,0x82,0xE1,0xEB,0xFF,0x83,0xEA,0x0A,0xFF,0x82,0xEA,0x2A,0xFF,0x00,0xEA,0x29,0xFF,0x83,0xEA,0x49,0xFF,0x82,0xEA,0x69,0xFF,0x00,0xEA,0x68,0xFF,0x83,0xEA,0x88,0xFF,0x81,0xEA,0xA8,0xFF,0x81,0xEA,0xA7,0xFF,0x83,0xEA,0xC7,0xFF,0x00,0xEA,0xE7,0xFF,0x81,0xEA,0xE6,0xFF,0x83,0xEB,0x06,0xFF,0x00,0xF3,0x26,0xFF,0x82,0xF3,0x25,0xFF,0x00,0xF3,0x45,0xBB,0x81,0x00,0x00,0x00,0x01,0xB1,0x8E,0xE5,0xB1,0x8E,0xFF,0x82,0xB9,0x8D,0xFF,0x00,0xC1,0x8D,0xFF,0x82,0xC1,0xAD,0xFF,0x81,0xC9,0xAC,0xFF,0x00,0xC9,0xCC,0xFF,0x83,0xD1,0xCC,0xFF,0x00,0xD9,0xCB,0xFF,0x82,0xD9,0xEB,0xFF,0x82,0xE1,0xEB,0xFF,0x83,0xEA,0x0A,0xFF,0x82,0xEA,0x2A,0xFF,0x00,0xEA,
+    0x29,0xFF,0x83,0xEA,0x49,0xFF,0x82,0xEA,0x69,0xFF,0x00,0xEA,0x68,0xFF,0x83,0xEA,0x88,0xFF,0x81,0xEA,0xA8,0xFF,0x81,0xEA,0xA7,0xFF,0x83,0xEA,0xC7,0xFF,0x00,0xEA,0xE7,0xFF,0x81,0xEA,0xE6,0xFF,0x83,0xEB,0x06,0xFF,0x00,0xF3,0x26,0xFF,0x81,0xF3,0x25,0xFF,0x03,0xF3,0x25,0xE2,0x00,0x00,0x00,0xA9,0x4D,0x0C,0xB1,0x6E,0xFE,0x81,0xB1,0x8E,0xFF,0x82,0xB9,0x8D,0xFF,0x00,0xC1,0x8D,0xFF,0x82,0xC1,0xAD,0xFF,0x01,0xC9,0xAC,0xFF,0xD2,0x4E,0xFF,0x83,0xF6,0x5A,0xFF,0x01,0xF6,0x3A,0xFF,0xD9,0xEC,0xFF,0x82,0xD9,0xEB,0xFF,0x82,0xE1,0xEB,0xFF,0x81,0xEA,0x0A,0xFF,0x00,0xF4,0x73,0xFF,0x83,0xFE,0x7A,0xFF,0x00,0xFF,0x5D,0xFF,0x81,0xFE,0x7A,0xFF,0x04,0xFE,0x79,0xFF,0xF4,0x92,0xFF,0xEA,0x69,0xFF,0xEA,0xCA,0xFF,0xFE,0x79,0xFF,0x84,0xFE,0x99,0xFF,0x01,0xF5,0x94,0xFF,0xEA,0xA8,0xFF,0x81,0xEA,0xA7,0xFF,0x83,0xEA,0xC7,0xFF,0x00,0xEA,0xE7,0xFF,0x81,0xEA,0xE6,0xFF,0x83,0xEB,0x06,0xFF,0x04,0xF3,0x26,0xFF,0xF3,0x25,0xFF,0xF3,0x25,0xFE,0xEA,0xE5,0x0B,0xB1,0x6E,0x21,0x81,0xB1,0x6E,0xFF,
+    0x81,0xB1,0x8E,0xFF,0x82,0xB9,0x8D,0xFF,0x00,0xC1,0x8D,0xFF,0x82,0xC1,0xAD,0xFF,0x01,0xD2,0xD0,0xFF,0xF6,0x7B,0xFF,0x81,0xD2,0x8F,0xFF,0x02,0xDA,0x8F,0xFF,0xDA,0x6E,0xFF,0xDA,0xEF,0xFF,0x81,0xE3,0xF2,0xFF,0x83,0xEB,0xF2,0xFF,0x03,0xEA,0x6C,0xFF,0xEA,0x0A,0xFF,0xF5,0xB7,0xFF,0xF4,0x32,0xFF,0x81,0xEA,0xED,0xFF,0x01,0xEB,0x2E,0xFF,0xFF,0x1C,0xFF,0x82,0xEB,0x0C,0xFF,0x04,0xEA,0x8A,0xFF,0xEA,0x49,0xFF,0xEA,0x69,0xFF,0xEB,0x0B,0xFF,0xEB,0x2C,0xFF,0x81,0xEB,0x2B,0xFF,0x02,0xEB,0x4B,0xFF,0xF3,0xAD,0xFF,0xFE,0xDA,0xFF,0x81,0xEA,0xA8,0xFF,0x81,0xEA,0xA7,0xFF,0x01,0xEB,0x29,0xFF,0xEA,0xE8,0xFF,0x81,0xEA,0xC7,0xFF,0x00,0xEA,0xE7,0xFF,0x81,0xEA,0xE6,0xFF,0x83,0xEB,0x06,0xFF,0x04,0xF3,0x26,0xFF,0xF3,0x25,0xFF,0xEB,0x25,0x1E,0xA9,0x6E,0x2D,0xA9,0x6E,0xFF,0x81,0xB1,0x6E,0xFF,0x81,0xB1,0x8E,0xFF,0x82,0xB9,0x8D,0xFF,0x00,0xC1,0x8D,0xFF,0x81,0xC1,0xAD,0xFF,0x03,0xD2,0xD0,0xFF,0xEE,0x3A,0xFF,0xC9,0xAC,0xFF,0xC9,0xCC,0xFF,0x81,0xD1,0xCC,0xFF,0x81,0xF5,0xD8,0xFF,0x82,
+    0xED,0x36,0xFF,0x81,0xF5,0x36,0xFF,0x03,0xE2,0xAD,0xFF,0xE1,0xEB,0xFF,0xF5,0xB7,0xFF,0xEB,0xB0,0xFF,0x81,0xEA,0x0A,0xFF,0x03,0xEA,0x6B,0xFF,0xFE,0xFC,0xFF,0xEA,0x2A,0xFF,0xEA,0x29,0xFF,0x83,0xEA,0x49,0xFF,0x82,0xEA,0x69,0xFF,0x04,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xEB,0x0A,0xFF,0xFE,0xDA,0xFF,0xEA,0x88,0xFF,0x81,0xEA,0xA8,0xFF,0x02,0xEA,0xA7,0xFF,0xF5,0x95,0xFF,0xF4,0x6F,0xFF,0x82,0xEA,0xC7,0xFF,0x00,0xEA,0xE7,0xFF,0x81,0xEA,0xE6,0xFF,0x83,0xEB,0x06,0xFF,0x02,0xF3,0x26,0xFF,0xEB,0x25,0x2B,0xA1,0x6E,0x3A,0x81,0xA9,0x6E,0xFF,0x81,0xB1,0x6E,0xFF,0x81,0xB1,0x8E,0xFF,0x82,0xB9,0x8D,0xFF,0x03,0xC1,0x8D,0xFF,0xC1,0xAD,0xFF,0xC2,0x0E,0xFF,0xDB,0xB2,0xFF,0x81,0xC9,0xAC,0xFF,0x05,0xC9,0xCC,0xFF,0xD1,0xCC,0xFF,0xED,0xD8,0xFF,0xDB,0x51,0xFF,0xD1,0xCC,0xFF,0xD9,0xCB,0xFF,0x82,0xD9,0xEB,0xFF,0x81,0xE1,0xEB,0xFF,0x01,0xF5,0xB7,0xFF,0xEB,0x90,0xFF,0x81,0xEA,0x0A,0xFF,0x01,0xEA,0x6B,0xFF,0xFE,0xFC,0xFF,0x81,0xEA,0x2A,0xFF,0x00,0xEA,0x29,0xFF,0x83,0xEA,0x49,0xFF,0x01,
+    0xEA,0x69,0xFF,0xEA,0x89,0xFF,0x81,0xEA,0xCA,0xFF,0x01,0xEB,0x4C,0xFF,0xFE,0xDB,0xFF,0x81,0xEA,0x88,0xFF,0x81,0xEA,0xA8,0xFF,0x01,0xF5,0xB5,0xFF,0xF4,0x6F,0xFF,0x83,0xEA,0xC7,0xFF,0x00,0xEA,0xE7,0xFF,0x81,0xEA,0xE6,0xFF,0x83,0xEB,0x06,0xFF,0x01,0xF3,0x06,0x39,0xA1,0x6E,0x3A,0x82,0xA9,0x6E,0xFF,0x81,0xB1,0x6E,0xFF,0x81,0xB1,0x8E,0xFF,0x82,0xB9,0x8D,0xFF,0x00,0xC1,0x8D,0xFF,0x82,0xC1,0xAD,0xFF,0x81,0xC9,0xAC,0xFF,0x02,0xC9,0xCC,0xFF,0xED,0xD9,0xFF,0xDB,0x51,0xFF,0x81,0xD1,0xCC,0xFF,0x00,0xD9,0xCB,0xFF,0x82,0xD9,0xEB,0xFF,0x02,0xE1,0xEB,0xFF,0xF5,0xB7,0xFF,0xEB,0x90,0xFF,0x81,0xEA,0x0A,0xFF,0x01,0xEA,0x6B,0xFF,0xFE,0xFC,0xFF,0x82,0xEA,0x2A,0xFF,0x00,0xEA,0x29,0xFF,0x83,0xEA,0x49,0xFF,0x01,0xFE,0x59,0xFF,0xFF,0x1C,0xFF,0x81,0xFE,0xFB,0xFF,0x00,0xFF,0x7D,0xFF,0x82,0xEA,0x88,0xFF,0x03,0xEA,0xA8,0xFF,0xF5,0xB5,0xFF,0xF4,0x6F,0xFF,0xEA,0xA7,0xFF,0x83,0xEA,0xC7,0xFF,0x00,0xEA,0xE7,0xFF,0x81,0xEA,0xE6,0xFF,0x82,0xEB,0x06,0xFF,0x02,0xEB,0x06,0x39,0xA1,0x6E,
+    0x2D,0xA1,0x6F,0xFF,0x82,0xA9,0x6E,0xFF,0x81,0xB1,0x6E,0xFF,0x81,0xB1,0x8E,0xFF,0x82,0xB9,0x8D,0xFF,0x01,0xC2,0x4F,0xFF,0xE4,0xF7,0xFF,0x81,0xC1,0xAD,0xFF,0x81,0xC9,0xAC,0xFF,0x01,0xED,0xD9,0xFF,0xDB,0x51,0xFF,0x82,0xD1,0xCC,0xFF,0x00,0xD9,0xCB,0xFF,0x82,0xD9,0xEB,0xFF,0x05,0xF5,0xB7,0xFF,0xEB,0x90,0xFF,0xE1,0xEB,0xFF,0xEA,0x0A,0xFF,0xEA,0x4B,0xFF,0xFF,0x9E,0xFF,0x82,0xF5,0xB7,0xFF,0x01,0xEB,0x6E,0xFF,0xEA,0x29,0xFF,0x82,0xEA,0x49,0xFF,0x04,0xFE,0x79,0xFF,0xEB,0x2C,0xFF,0xEA,0x69,0xFF,0xEA,0xEB,0xFF,0xFE,0xDB,0xFF,0x83,0xEA,0x88,0xFF,0x01,0xF5,0x95,0xFF,0xF4,0x6F,0xFF,0x81,0xEA,0xA7,0xFF,0x83,0xEA,0xC7,0xFF,0x00,0xEA,0xE7,0xFF,0x81,0xEA,0xE6,0xFF,0x81,0xEB,0x06,0xFF,0x03,0xEB,0x25,0x2B,0xA1,0x6F,0x21,0xA1,0x4F,0xFF,0xA1,0x6F,0xFF,0x82,0xA9,0x6E,0xFF,0x81,0xB1,0x6E,0xFF,0x81,0xB1,0x8E,0xFF,0x81,0xB9,0x8D,0xFF,0x02,0xCA,0xB0,0xFF,0xEE,0x5B,0xFF,0xCA,0x6F,0xFF,0x81,0xCA,0x8F,0xFF,0x02,0xD2,0x8F,0xFF,0xEE,0x1A,0xFF,0xDB,0x51,0xFF,0x83,0xD1,0xCC,0xFF,
+    0x00,0xD9,0xCB,0xFF,0x81,0xD9,0xEB,0xFF,0x01,0xF5,0xB8,0xFF,0xEB,0x90,0xFF,0x81,0xE1,0xEB,0xFF,0x01,0xEA,0x0A,0xFF,0xEB,0x6F,0xFF,0x81,0xEB,0xB0,0xFF,0x03,0xF3,0xB0,0xFF,0xEA,0xAC,0xFF,0xEA,0x2A,0xFF,0xEA,0x4A,0xFF,0x81,0xEB,0x0C,0xFF,0x04,0xFE,0xBA,0xFF,0xEB,0x2C,0xFF,0xEA,0x69,0xFF,0xEA,0xEB,0xFF,0xFE,0xFB,0xFF,0x81,0xEB,0x2B,0xFF,0x81,0xEB,0x4B,0xFF,0x02,0xFD,0xF6,0xFF,0xF4,0x6F,0xFF,0xEA,0xA8,0xFF,0x81,0xEA,0xA7,0xFF,0x83,0xEA,0xC7,0xFF,0x00,0xEA,0xE7,0xFF,0x81,0xEA,0xE6,0xFF,0x05,0xEB,0x06,0xFF,0xEA,0xE6,0x1E,0xA9,0x50,0x0C,0xA1,0x4F,0xFE,0xA1,0x4F,0xFF,0xA1,0x6F,0xFF,0x82,0xA9,0x6E,0xFF,0x81,0xB1,0x6E,0xFF,0x81,0xB1,0x8E,0xFF,0x02,0xB9,0x8D,0xFF,0xC2,0x2F,0xFF,0xEE,0x3A,0xFF,0x81,0xEE,0x5B,0xFF,0x00,0xEE,0x5A,0xFF,0x81,0xF6,0x5A,0xFF,0x01,0xD2,0x8F,0xFF,0xC9,0xCC,0xFF,0x83,0xD1,0xCC,0xFF,0x03,0xD9,0xCB,0xFF,0xD9,0xEB,0xFF,0xEC,0x73,0xFF,0xE2,0xCE,0xFF,0x82,0xE1,0xEB,0xFF,0x83,0xEA,0x0A,0xFF,0x81,0xEA,0x2A,0xFF,0x00,0xF3,0xF0,0xFF,0x81,0xFE,
+    0x7A,0xFF,0x04,0xFE,0x79,0xFF,0xEA,0xCB,0xFF,0xEA,0x49,0xFF,0xEA,0x8A,0xFF,0xFE,0x79,0xFF,0x84,0xFE,0x99,0xFF,0x00,0xF3,0xAC,0xFF,0x81,0xEA,0xA8,0xFF,0x81,0xEA,0xA7,0xFF,0x83,0xEA,0xC7,0xFF,0x05,0xEA,0xE7,0xFF,0xEA,0xE6,0xFF,0xEA,0xE6,0xFE,0xEA,0xE5,0x0B,0x00,0x00,0x00,0xA1,0x4F,0xE5,0x81,0xA1,0x4F,0xFF,0x00,0xA1,0x6F,0xFF,0x82,0xA9,0x6E,0xFF,0x81,0xB1,0x6E,0xFF,0x81,0xB1,0x8E,0xFF,0x82,0xB9,0x8D,0xFF,0x00,0xC1,0x8D,0xFF,0x82,0xC1,0xAD,0xFF,0x81,0xC9,0xAC,0xFF,0x00,0xC9,0xCC,0xFF,0x83,0xD1,0xCC,0xFF,0x00,0xD9,0xCB,0xFF,0x82,0xD9,0xEB,0xFF,0x82,0xE1,0xEB,0xFF,0x83,0xEA,0x0A,0xFF,0x82,0xEA,0x2A,0xFF,0x00,0xEA,0x29,0xFF,0x83,0xEA,0x49,0xFF,0x82,0xEA,0x69,0xFF,0x00,0xEA,0x68,0xFF,0x83,0xEA,0x88,0xFF,0x81,0xEA,0xA8,0xFF,0x81,0xEA,0xA7,0xFF,0x83,0xEA,0xC7,0xFF,0x01,0xEA,0xE7,0xFF,0xEA,0xE6,0xE2,0x81,0x00,0x00,0x00,0x00,0x99,0x4F,0xBE,0x82,0xA1,0x4F,0xFF,0x00,0xA1,0x6F,0xFF,0x82,0xA9,0x6E,0xFF,0x81,0xB1,0x6E,0xFF,0x81,0xB1,0x8E,0xFF,0x82,0xB9,0x8D,0xFF,
+    0x00,0xC1,0x8D,0xFF,0x82,0xC1,0xAD,0xFF,0x81,0xC9,0xAC,0xFF,0x00,0xC9,0xCC,0xFF,0x83,0xD1,0xCC,0xFF,0x00,0xD9,0xCB,0xFF,0x82,0xD9,0xEB,0xFF,0x82,0xE1,0xEB,0xFF,0x83,0xEA,0x0A,0xFF,0x82,0xEA,0x2A,0xFF,0x00,0xEA,0x29,0xFF,0x83,0xEA,0x49,0xFF,0x82,0xEA,0x69,0xFF,0x00,0xEA,0x68,0xFF,0x83,0xEA,0x88,0xFF,0x81,0xEA,0xA8,0xFF,0x81,0xEA,0xA7,0xFF,0x83,0xEA,0xC7,0xFF,0x00,0xEA,0xC7,0xBB,0x81,0x00,0x00,0x00,0x01,0x99,0x4F,0x90,0x99,0x4F,0xFF,0x82,0xA1,0x4F,0xFF,0x00,0xA1,0x6F,0xFF,0x82,0xA9,0x6E,0xFF,0x02,0xB1,0x6E,0xFF,0xB1,0xEF,0xFF,0xE5,0x58,0xFF,0x86,0xE5,0x78,0xFF,0x83,0xED,0x78,0xFF,0x00,0xE4,0x54,0xFF,0x82,0xD1,0xCC,0xFF,0x00,0xE3,0x30,0xFF,0x82,0xF5,0x97,0xFF,0x01,0xFE,0x9A,0xFF,0xF5,0xB7,0xFF,0x81,0xF5,0x97,0xFF,0x00,0xF3,0xF1,0xFF,0x81,0xEA,0x0A,0xFF,0x00,0xF4,0x73,0xFF,0x84,0xF5,0xB7,0xFF,0x82,0xF5,0xB6,0xFF,0x82,0xF5,0xD6,0xFF,0x01,0xF5,0xB6,0xFF,0xEA,0xEA,0xFF,0x81,0xEA,0x88,0xFF,0x81,0xEA,0xA8,0xFF,0x81,0xEA,0xA7,0xFF,0x82,0xEA,0xC7,0xFF,0x00,
+    0xEA,0xE7,0x8E,0x81,0x00,0x00,0x00,0x00,0x99,0x50,0x50,0x81,0x99,0x4F,0xFF,0x82,0xA1,0x4F,0xFF,0x00,0xA1,0x6F,0xFF,0x82,0xA9,0x6E,0xFF,0x02,0xBA,0xB1,0xFF,0xEE,0x9C,0xFF,0xCB,0x32,0xFF,0x83,0xCB,0x52,0xFF,0x83,0xD3,0x52,0xFF,0x02,0xD3,0x72,0xFF,0xDB,0xF3,0xFF,0xF6,0x7B,0xFF,0x82,0xD1,0xCC,0xFF,0x01,0xDA,0x4D,0xFF,0xE3,0x71,0xFF,0x81,0xE3,0x91,0xFF,0x04,0xFE,0xFC,0xFF,0xEC,0x12,0xFF,0xEB,0x90,0xFF,0xF4,0xD4,0xFF,0xF5,0xB7,0xFF,0x81,0xEA,0x0A,0xFF,0x03,0xFE,0x9A,0xFF,0xF4,0x32,0xFF,0xF3,0xB0,0xFF,0xF3,0xAF,0xFF,0x84,0xF3,0xCF,0xFF,0x82,0xF3,0xEF,0xFF,0x01,0xFE,0xDA,0xFF,0xEB,0x8C,0xFF,0x82,0xEA,0x88,0xFF,0x81,0xEA,0xA8,0xFF,0x81,0xEA,0xA7,0xFF,0x81,0xEA,0xC7,0xFF,0x00,0xEA,0xC7,0x4D,0x81,0x00,0x00,0x00,0x01,0x89,0x10,0x10,0x99,0x50,0xFC,0x81,0x99,0x4F,0xFF,0x82,0xA1,0x4F,0xFF,0x00,0xA1,0x6F,0xFF,0x81,0xA9,0x6E,0xFF,0x02,0xBA,0xB1,0xFF,0xE6,0x1A,0xFF,0xB1,0x6E,0xFF,0x81,0xB1,0x8E,0xFF,0x82,0xB9,0x8D,0xFF,0x00,0xC1,0x8D,0xFF,0x82,0xC1,0xAD,0xFF,0x02,
+    0xD2,0x6F,0xFF,0xF6,0x7B,0xFF,0xC9,0xCC,0xFF,0x83,0xD1,0xCC,0xFF,0x06,0xD9,0xCB,0xFF,0xD9,0xEB,0xFF,0xF6,0x9B,0xFF,0xE2,0x8D,0xFF,0xE1,0xEB,0xFF,0xEB,0x90,0xFF,0xF5,0xB7,0xFF,0x81,0xEA,0x0A,0xFF,0x01,0xFE,0x9A,0xFF,0xEA,0xCD,0xFF,0x82,0xEA,0x2A,0xFF,0x00,0xEA,0x29,0xFF,0x83,0xEA,0x49,0xFF,0x81,0xEA,0x69,0xFF,0x01,0xFE,0x59,0xFF,0xEB,0x6C,0xFF,0x83,0xEA,0x88,0xFF,0x81,0xEA,0xA8,0xFF,0x81,0xEA,0xA7,0xFF,0x01,0xEA,0xC7,0xFB,0xEA,0xA6,0x0F,0x82,0x00,0x00,0x00,0x00,0x91,0x30,0xC4,0x82,0x99,0x4F,0xFF,0x82,0xA1,0x4F,0xFF,0x03,0xA1,0x6F,0xFF,0xA9,0x6E,0xFF,0xBA,0x91,0xFF,0xE6,0x1A,0xFF,0x81,0xB1,0x6E,0xFF,0x00,0xBA,0x50,0xFF,0x81,0xC2,0xD1,0xFF,0x00,0xCA,0xD1,0xFF,0x81,0xCA,0xF1,0xFF,0x05,0xC1,0xEE,0xFF,0xC1,0xAD,0xFF,0xCA,0x6F,0xFF,0xF6,0x7B,0xFF,0xC9,0xAC,0xFF,0xC9,0xCC,0xFF,0x83,0xD1,0xCC,0xFF,0x0B,0xD9,0xCB,0xFF,0xF6,0x9B,0xFF,0xE2,0x8D,0xFF,0xD9,0xEB,0xFF,0xEB,0x90,0xFF,0xF5,0xB7,0xFF,0xE1,0xEB,0xFF,0xEA,0x0A,0xFF,0xFE,0x9A,0xFF,0xEA,0xCD,0xFF,0xEA,
+    0x0A,0xFF,0xEA,0x4B,0xFF,0x81,0xEB,0x4E,0xFF,0x82,0xEB,0x6E,0xFF,0x05,0xEB,0x0C,0xFF,0xEA,0x49,0xFF,0xEA,0x69,0xFF,0xFE,0x59,0xFF,0xEB,0x6D,0xFF,0xEA,0x68,0xFF,0x83,0xEA,0x88,0xFF,0x81,0xEA,0xA8,0xFF,0x01,0xEA,0xA7,0xFF,0xEA,0xA7,0xC1,0x83,0x00,0x00,0x00,0x01,0x91,0x30,0x68,0x91,0x30,0xFF,0x82,0x99,0x4F,0xFF,0x82,0xA1,0x4F,0xFF,0x07,0xA1,0x6F,0xFF,0xBA,0x92,0xFF,0xE6,0x1A,0xFF,0xA9,0x6E,0xFF,0xB1,0x6E,0xFF,0xF6,0xBC,0xFF,0xED,0xFA,0xFF,0xE5,0xD9,0xFF,0x81,0xED,0xD9,0xFF,0x04,0xF6,0xFC,0xFF,0xD3,0xF4,0xFF,0xC1,0xAD,0xFF,0xCA,0x6F,0xFF,0xF6,0x7B,0xFF,0x81,0xC9,0xAC,0xFF,0x00,0xC9,0xCC,0xFF,0x83,0xD1,0xCC,0xFF,0x04,0xF6,0x9B,0xFF,0xDA,0x8E,0xFF,0xD9,0xEB,0xFF,0xEB,0x90,0xFF,0xF5,0xB7,0xFF,0x81,0xE1,0xEB,0xFF,0x04,0xFE,0x9A,0xFF,0xEA,0xCD,0xFF,0xEA,0x0A,0xFF,0xF4,0x52,0xFF,0xFE,0xFC,0xFF,0x82,0xFE,0x18,0xFF,0x01,0xFE,0x39,0xFF,0xFE,0xDB,0xFF,0x81,0xEA,0x49,0xFF,0x03,0xFE,0x59,0xFF,0xEB,0x6D,0xFF,0xEA,0x69,0xFF,0xEA,0x68,0xFF,0x83,0xEA,0x88,0xFF,0x81,
+    0xEA,0xA8,0xFF,0x00,0xEA,0xA7,0x65,0x83,0x00,0x00,0x00,0x02,0x91,0x70,0x11,0x91,0x30,0xF8,0x91,0x30,0xFF,0x82,0x99,0x4F,0xFF,0x82,0xA1,0x4F,0xFF,0x01,0xB2,0x92,0xFF,0xE6,0x1A,0xFF,0x81,0xA9,0x6E,0xFF,0x01,0xF6,0xBC,0xFF,0xB9,0xEF,0xFF,0x81,0xB1,0x8E,0xFF,0x08,0xB9,0x8D,0xFF,0xDC,0xD6,0xFF,0xD4,0x14,0xFF,0xC1,0x8D,0xFF,0xCA,0x6F,0xFF,0xF6,0x7B,0xFF,0xC1,0xAD,0xFF,0xC9,0xAC,0xFF,0xE4,0x74,0xFF,0x83,0xFF,0x3D,0xFF,0x04,0xFF,0x5D,0xFF,0xDA,0x4D,0xFF,0xD9,0xEB,0xFF,0xE3,0x0F,0xFF,0xF5,0x16,0xFF,0x81,0xE1,0xEB,0xFF,0x04,0xFE,0x9A,0xFF,0xEA,0xCD,0xFF,0xEA,0x0A,0xFF,0xF4,0x52,0xFF,0xF5,0x15,0xFF,0x82,0xEA,0x2A,0xFF,0x01,0xEA,0xAB,0xFF,0xFE,0xFB,0xFF,0x81,0xEA,0x49,0xFF,0x01,0xFE,0x59,0xFF,0xEB,0x6D,0xFF,0x81,0xEA,0x69,0xFF,0x00,0xEA,0x68,0xFF,0x83,0xEA,0x88,0xFF,0x01,0xEA,0xA8,0xF7,0xEA,0x88,0x10,0x84,0x00,0x00,0x00,0x00,0x91,0x30,0xA1,0x81,0x91,0x30,0xFF,0x82,0x99,0x4F,0xFF,0x81,0xA1,0x4F,0xFF,0x01,0xB2,0x92,0xFF,0xE6,0x1A,0xFF,0x81,0xA9,0x6E,0xFF,0x02,
+    0xEE,0xBC,0xFF,0xB1,0xEF,0xFF,0xB1,0x6E,0xFF,0x81,0xB1,0x8E,0xFF,0x04,0xDC,0xD6,0xFF,0xD4,0x14,0xFF,0xB9,0x8D,0xFF,0xCA,0x6F,0xFF,0xF6,0x7B,0xFF,0x81,0xC1,0xAD,0xFF,0x81,0xC9,0xAC,0xFF,0x00,0xC9,0xCC,0xFF,0x83,0xD1,0xCC,0xFF,0x00,0xD9,0xCB,0xFF,0x82,0xD9,0xEB,0xFF,0x06,0xE1,0xEB,0xFF,0xFE,0x7A,0xFF,0xEA,0xAD,0xFF,0xEA,0x0A,0xFF,0xF4,0x52,0xFF,0xF5,0x15,0xFF,0xEA,0x0A,0xFF,0x81,0xEA,0x2A,0xFF,0x01,0xEA,0xAB,0xFF,0xFE,0xFB,0xFF,0x81,0xEA,0x49,0xFF,0x01,0xFE,0x59,0xFF,0xEB,0x4D,0xFF,0x82,0xEA,0x69,0xFF,0x00,0xEA,0x68,0xFF,0x82,0xEA,0x88,0xFF,0x00,0xEA,0x88,0xA0,0x85,0x00,0x00,0x00,0x01,0x91,0x30,0x28,0x91,0x30,0xFD,0x81,0x91,0x30,0xFF,0x82,0x99,0x4F,0xFF,0x06,0xA1,0x4F,0xFF,0xB2,0x92,0xFF,0xE6,0x1A,0xFF,0xA1,0x6F,0xFF,0xA9,0x6E,0xFF,0xEE,0xBC,0xFF,0xB1,0xEF,0xFF,0x81,0xB1,0x6E,0xFF,0x05,0xB1,0x8E,0xFF,0xDC,0xD6,0xFF,0xD4,0x14,0xFF,0xB9,0x8D,0xFF,0xC2,0x6F,0xFF,0xEE,0x7B,0xFF,0x82,0xC1,0xAD,0xFF,0x81,0xC9,0xAC,0xFF,0x00,0xC9,0xCC,0xFF,0x83,0xD1,0xCC,
+    0xFF,0x00,0xD9,0xCB,0xFF,0x82,0xD9,0xEB,0xFF,0x04,0xFE,0x7A,0xFF,0xE2,0xAD,0xFF,0xE1,0xEB,0xFF,0xF4,0x53,0xFF,0xF5,0x15,0xFF,0x81,0xEA,0x0A,0xFF,0x07,0xEA,0x2A,0xFF,0xEA,0x8B,0xFF,0xFE,0xDB,0xFF,0xEA,0x29,0xFF,0xEA,0x49,0xFF,0xFE,0x59,0xFF,0xEB,0x4D,0xFF,0xEA,0x49,0xFF,0x82,0xEA,0x69,0xFF,0x03,0xEA,0x68,0xFF,0xEA,0x88,0xFF,0xEA,0x88,0xFC,0xEA,0xA8,0x27,0x86,0x00,0x00,0x00,0x00,0x91,0x30,0xAB,0x82,0x91,0x30,0xFF,0x82,0x99,0x4F,0xFF,0x06,0xB2,0x92,0xFF,0xE6,0x1B,0xFF,0xA1,0x4F,0xFF,0xA1,0x6F,0xFF,0xEE,0xBC,0xFF,0xB1,0xF0,0xFF,0xA9,0x6E,0xFF,0x81,0xB1,0x6E,0xFF,0x08,0xDC,0xB7,0xFF,0xD4,0x14,0xFF,0xB9,0x8D,0xFF,0xC2,0x70,0xFF,0xEE,0x7B,0xFF,0xC1,0x8D,0xFF,0xC1,0xAD,0xFF,0xE4,0xF6,0xFF,0xD2,0xF0,0xFF,0x81,0xC9,0xAC,0xFF,0x00,0xC9,0xCC,0xFF,0x83,0xD1,0xCC,0xFF,0x00,0xD9,0xCB,0xFF,0x81,0xD9,0xEB,0xFF,0x04,0xF6,0x7A,0xFF,0xE2,0xAE,0xFF,0xE1,0xEB,0xFF,0xF4,0x53,0xFF,0xF4,0xF5,0xFF,0x82,0xEA,0x0A,0xFF,0x05,0xEA,0x8C,0xFF,0xFE,0xDB,0xFF,0xEA,0x2A,0xFF,0xEA,
+    0x29,0xFF,0xFE,0x59,0xFF,0xEB,0x4D,0xFF,0x81,0xEA,0x49,0xFF,0x82,0xEA,0x69,0xFF,0x01,0xEA,0x68,0xFF,0xEA,0x88,0xA8,0x87,0x00,0x00,0x00,0x01,0x89,0x10,0x24,0x91,0x30,0xF7,0x82,0x91,0x30,0xFF,0x81,0x99,0x4F,0xFF,0x01,0xAA,0x92,0xFF,0xE6,0x1B,0xFF,0x81,0xA1,0x4F,0xFF,0x01,0xEE,0x7B,0xFF,0xF7,0x3D,0xFF,0x82,0xF7,0x1D,0xFF,0x09,0xFF,0x9E,0xFF,0xCB,0xB4,0xFF,0xB1,0x8E,0xFF,0xC2,0x50,0xFF,0xEE,0x7B,0xFF,0xB9,0x8D,0xFF,0xC1,0x8D,0xFF,0xE5,0x98,0xFF,0xD3,0x52,0xFF,0xC1,0xAD,0xFF,0x81,0xC9,0xAC,0xFF,0x01,0xD2,0x6E,0xFF,0xED,0x77,0xFF,0x82,0xD1,0xCC,0xFF,0x06,0xD9,0xCB,0xFF,0xD9,0xEB,0xFF,0xF6,0x7A,0xFF,0xE2,0xAE,0xFF,0xE1,0xEB,0xFF,0xEB,0xF2,0xFF,0xFF,0x9E,0xFF,0x82,0xFF,0x3D,0xFF,0x01,0xFF,0x5D,0xFF,0xFE,0x9A,0xFF,0x81,0xEA,0x2A,0xFF,0x01,0xFE,0x59,0xFF,0xEB,0x4D,0xFF,0x82,0xEA,0x49,0xFF,0x81,0xEA,0x69,0xFF,0x01,0xEA,0x69,0xF6,0xEA,0x88,0x22,0x88,0x00,0x00,0x00,0x00,0x89,0x30,0x81,0x83,0x91,0x30,0xFF,0x02,0x99,0x4F,0xFF,0xAA,0x72,0xFF,0xE5,0xFB,0xFF,0x82,
+    0xA1,0x4F,0xFF,0x00,0xA1,0x6F,0xFF,0x82,0xA9,0x6E,0xFF,0x81,0xB1,0x6E,0xFF,0x02,0xB1,0x8E,0xFF,0xC2,0x50,0xFF,0xEE,0x7B,0xFF,0x81,0xB9,0x8D,0xFF,0x01,0xE5,0x98,0xFF,0xD3,0x52,0xFF,0x81,0xC1,0xAD,0xFF,0x02,0xC9,0xAC,0xFF,0xD2,0xAF,0xFF,0xF6,0x3A,0xFF,0x83,0xD1,0xCC,0xFF,0x03,0xD9,0xCB,0xFF,0xF6,0x7A,0xFF,0xE2,0xAE,0xFF,0xD9,0xEB,0xFF,0x82,0xE1,0xEB,0xFF,0x83,0xEA,0x0A,0xFF,0x81,0xEA,0x2A,0xFF,0x01,0xFE,0x59,0xFF,0xEB,0x4D,0xFF,0x83,0xEA,0x49,0xFF,0x01,0xEA,0x69,0xFF,0xEA,0x69,0x7D,0x89,0x00,0x00,0x00,0x01,0x81,0x10,0x08,0x89,0x30,0xD7,0x83,0x91,0x30,0xFF,0x02,0xAA,0x72,0xFF,0xE5,0xFB,0xFF,0x99,0x4F,0xFF,0x82,0xA1,0x4F,0xFF,0x00,0xA1,0x6F,0xFF,0x82,0xA9,0x6E,0xFF,0x81,0xB1,0x6E,0xFF,0x01,0xBA,0x50,0xFF,0xEE,0x7B,0xFF,0x81,0xB9,0x8D,0xFF,0x01,0xE5,0x98,0xFF,0xD3,0x52,0xFF,0x82,0xC1,0xAD,0xFF,0x02,0xD2,0xAF,0xFF,0xF6,0x3A,0xFF,0xC9,0xCC,0xFF,0x83,0xD1,0xCC,0xFF,0x01,0xF6,0x7A,0xFF,0xE2,0xAE,0xFF,0x81,0xD9,0xEB,0xFF,0x82,0xE1,0xEB,0xFF,0x83,0xEA,0x0A,
+    0xFF,0x03,0xEA,0x2A,0xFF,0xFE,0x59,0xFF,0xEB,0x2E,0xFF,0xEA,0x29,0xFF,0x82,0xEA,0x49,0xFF,0x01,0xEA,0x49,0xD5,0xDA,0x49,0x07,0x8A,0x00,0x00,0x00,0x01,0x89,0x10,0x2C,0x89,0x30,0xF5,0x82,0x91,0x30,0xFF,0x01,0xAA,0x72,0xFF,0xEE,0xFD,0xFF,0x84,0xCC,0x77,0xFF,0x82,0xD4,0x76,0xFF,0x81,0xD4,0x96,0xFF,0x03,0xDC,0xF7,0xFF,0xEE,0x7B,0xFF,0xB1,0x8E,0xFF,0xB9,0x8D,0xFF,0x81,0xE5,0x78,0xFF,0x81,0xDC,0x96,0xFF,0x02,0xE4,0x96,0xFF,0xE5,0x37,0xFF,0xF7,0x1D,0xFF,0x81,0xE4,0xB5,0xFF,0x00,0xDA,0xCF,0xFF,0x81,0xD1,0xCC,0xFF,0x01,0xF6,0x7B,0xFF,0xED,0x36,0xFF,0x81,0xEC,0xB5,0xFF,0x81,0xEC,0xD5,0xFF,0x85,0xF4,0xD4,0xFF,0x06,0xFF,0x1C,0xFF,0xEB,0x2E,0xFF,0xEA,0x2A,0xFF,0xEA,0x29,0xFF,0xEA,0x49,0xFF,0xEA,0x49,0xF7,0xEA,0x69,0x2F,0x8C,0x00,0x00,0x00,0x01,0x89,0x30,0x64,0x89,0x30,0xFF,0x81,0x91,0x30,0xFF,0x01,0x99,0x70,0xFF,0xBB,0xD6,0xFF,0x83,0xC3,0xF6,0xFF,0x00,0xCC,0x16,0xFF,0x84,0xCC,0x15,0xFF,0x01,0xD4,0x15,0xFF,0xC3,0x12,0xFF,0x81,0xB1,0x8E,0xFF,0x01,0xC2,0xD1,0xFF,
+    0xD4,0x35,0xFF,0x82,0xDC,0x34,0xFF,0x04,0xDC,0x55,0xFF,0xE5,0x16,0xFF,0xDC,0x34,0xFF,0xE4,0x34,0xFF,0xD2,0x8F,0xFF,0x81,0xD1,0xCC,0xFF,0x01,0xDB,0x51,0xFF,0xE4,0x54,0xFF,0x85,0xEC,0x53,0xFF,0x83,0xF4,0x73,0xFF,0x01,0xF4,0x52,0xFF,0xEA,0x4B,0xFF,0x81,0xEA,0x2A,0xFF,0x01,0xEA,0x29,0xFF,0xEA,0x29,0x61,0x8E,0x00,0x00,0x00,0x01,0x89,0x30,0x8B,0x89,0x30,0xFF,0x83,0x91,0x30,0xFF,0x82,0x99,0x4F,0xFF,0x82,0xA1,0x4F,0xFF,0x00,0xA1,0x6F,0xFF,0x82,0xA9,0x6E,0xFF,0x81,0xB1,0x6E,0xFF,0x81,0xB1,0x8E,0xFF,0x82,0xB9,0x8D,0xFF,0x00,0xC1,0x8D,0xFF,0x82,0xC1,0xAD,0xFF,0x81,0xC9,0xAC,0xFF,0x00,0xC9,0xCC,0xFF,0x83,0xD1,0xCC,0xFF,0x00,0xD9,0xCB,0xFF,0x82,0xD9,0xEB,0xFF,0x82,0xE1,0xEB,0xFF,0x83,0xEA,0x0A,0xFF,0x81,0xEA,0x2A,0xFF,0x00,0xEA,0x2A,0x87,0x8F,0x00,0x00,0x00,0x02,0xF8,0x1F,0x01,0x89,0x30,0x9E,0x89,0x30,0xFF,0x83,0x91,0x30,0xFF,0x82,0x99,0x4F,0xFF,0x82,0xA1,0x4F,0xFF,0x00,0xA1,0x6F,0xFF,0x82,0xA9,0x6E,0xFF,0x81,0xB1,0x6E,0xFF,0x81,0xB1,0x8E,0xFF,0x82,0xB9,0x8D,
+    0xFF,0x00,0xC1,0x8D,0xFF,0x82,0xC1,0xAD,0xFF,0x81,0xC9,0xAC,0xFF,0x00,0xC9,0xCC,0xFF,0x83,0xD1,0xCC,0xFF,0x00,0xD9,0xCB,0xFF,0x82,0xD9,0xEB,0xFF,0x82,0xE1,0xEB,0xFF,0x83,0xEA,0x0A,0xFF,0x01,0xEA,0x2A,0xA4,0xF8,0x00,0x01,0x90,0x00,0x00,0x00,0x02,0x82,0x10,0x04,0x89,0x30,0xA1,0x89,0x30,0xFF,0x83,0x91,0x30,0xFF,0x82,0x99,0x4F,0xFF,0x82,0xA1,0x4F,0xFF,0x00,0xA1,0x6F,0xFF,0x82,0xA9,0x6E,0xFF,0x81,0xB1,0x6E,0xFF,0x81,0xB1,0x8E,0xFF,0x82,0xB9,0x8D,0xFF,0x00,0xC1,0x8D,0xFF,0x82,0xC1,0xAD,0xFF,0x81,0xC9,0xAC,0xFF,0x00,0xC9,0xCC,0xFF,0x83,0xD1,0xCC,0xFF,0x00,0xD9,0xCB,0xFF,0x82,0xD9,0xEB,0xFF,0x82,0xE1,0xEB,0xFF,0x81,0xEA,0x0A,0xFF,0x01,0xEA,0x0A,0xA0,0xFA,0x08,0x04,0x92,0x00,0x00,0x00,0x02,0xF8,0x1F,0x01,0x89,0x30,0x80,0x89,0x30,0xFF,0x83,0x91,0x30,0xFF,0x82,0x99,0x4F,0xFF,0x82,0xA1,0x4F,0xFF,0x00,0xA1,0x6F,0xFF,0x82,0xA9,0x6E,0xFF,0x81,0xB1,0x6E,0xFF,0x81,0xB1,0x8E,0xFF,0x82,0xB9,0x8D,0xFF,0x00,0xC1,0x8D,0xFF,0x82,0xC1,0xAD,0xFF,0x81,0xC9,0xAC,0xFF,0x00,
+    0xC9,0xCC,0xFF,0x83,0xD1,0xCC,0xFF,0x00,0xD9,0xCB,0xFF,0x82,0xD9,0xEB,0xFF,0x82,0xE1,0xEB,0xFF,0x01,0xE9,0xEA,0x91,0xFC,0x10,0x02,0x95,0x00,0x00,0x00,0x01,0x89,0x30,0x63,0x89,0x30,0xF6,0x83,0x91,0x30,0xFF,0x82,0x99,0x4F,0xFF,0x82,0xA1,0x4F,0xFF,0x00,0xA1,0x6F,0xFF,0x82,0xA9,0x6E,0xFF,0x81,0xB1,0x6E,0xFF,0x81,0xB1,0x8E,0xFF,0x82,0xB9,0x8D,0xFF,0x00,0xC1,0x8D,0xFF,0x82,0xC1,0xAD,0xFF,0x81,0xC9,0xAC,0xFF,0x00,0xC9,0xCC,0xFF,0x83,0xD1,0xCC,0xFF,0x00,0xD9,0xCB,0xFF,0x82,0xD9,0xEB,0xFF,0x01,0xE1,0xEB,0xF5,0xE1,0xEB,0x61,0x98,0x00,0x00,0x00,0x01,0x89,0x11,0x2D,0x89,0x30,0xD7,0x83,0x91,0x30,0xFF,0x82,0x99,0x4F,0xFF,0x82,0xA1,0x4F,0xFF,0x00,0xA1,0x6F,0xFF,0x82,0xA9,0x6E,0xFF,0x81,0xB1,0x6E,0xFF,0x81,0xB1,0x8E,0xFF,0x82,0xB9,0x8D,0xFF,0x00,0xC1,0x8D,0xFF,0x82,0xC1,0xAD,0xFF,0x81,0xC9,0xAC,0xFF,0x00,0xC9,0xCC,0xFF,0x83,0xD1,0xCC,0xFF,0x03,0xD9,0xCB,0xFF,0xD9,0xEB,0xFF,0xD9,0xEB,0xD5,0xE1,0xCB,0x2B,0x9A,0x00,0x00,0x00,0x02,0x81,0x50,0x06,0x89,0x30,0x77,0x91,
+    0x30,0xF7,0x82,0x91,0x30,0xFF,0x82,0x99,0x4F,0xFF,0x82,0xA1,0x4F,0xFF,0x00,0xA1,0x6F,0xFF,0x82,0xA9,0x6E,0xFF,0x81,0xB1,0x6E,0xFF,0x81,0xB1,0x8E,0xFF,0x82,0xB9,0x8D,0xFF,0x00,0xC1,0x8D,0xFF,0x82,0xC1,0xAD,0xFF,0x81,0xC9,0xAC,0xFF,0x00,0xC9,0xCC,0xFF,0x82,0xD1,0xCC,0xFF,0x02,0xD1,0xCC,0xF6,0xD9,0xEC,0x80,0xDA,0x0C,0x08,0x9D,0x00,0x00,0x00,0x02,0x89,0x10,0x24,0x91,0x30,0xAA,0x91,0x30,0xFD,0x81,0x91,0x30,0xFF,0x82,0x99,0x4F,0xFF,0x82,0xA1,0x4F,0xFF,0x00,0xA1,0x6F,0xFF,0x82,0xA9,0x6E,0xFF,0x81,0xB1,0x6E,0xFF,0x81,0xB1,0x8E,0xFF,0x82,0xB9,0x8D,0xFF,0x00,0xC1,0x8D,0xFF,0x82,0xC1,0xAD,0xFF,0x81,0xC9,0xAC,0xFF,0x03,0xC9,0xCC,0xFF,0xD1,0xCC,0xFD,0xD1,0xCC,0xA8,0xD1,0xEC,0x22,0xA1,0x00,0x00,0x00,0x03,0x91,0x30,0x28,0x91,0x30,0xA1,0x91,0x30,0xF7,0x91,0x30,0xFF,0x82,0x99,0x4F,0xFF,0x82,0xA1,0x4F,0xFF,0x00,0xA1,0x6F,0xFF,0x82,0xA9,0x6E,0xFF,0x81,0xB1,0x6E,0xFF,0x81,0xB1,0x8E,0xFF,0x82,0xB9,0x8D,0xFF,0x00,0xC1,0x8D,0xFF,0x82,0xC1,0xAD,0xFF,0x02,0xC9,0xAC,0xF7,
+    0xC9,0xCC,0xA0,0xC9,0xCC,0x27,0xA5,0x00,0x00,0x00,0x03,0x89,0x10,0x10,0x91,0x30,0x66,0x91,0x30,0xC2,0x99,0x50,0xFC,0x81,0x99,0x4F,0xFF,0x82,0xA1,0x4F,0xFF,0x00,0xA1,0x6F,0xFF,0x82,0xA9,0x6E,0xFF,0x81,0xB1,0x6E,0xFF,0x81,0xB1,0x8E,0xFF,0x82,0xB9,0x8D,0xFF,0x03,0xC1,0x8D,0xFB,0xC1,0xAD,0xC1,0xC1,0xAD,0x65,0xB9,0x8E,0x10,0xAA,0x00,0x00,0x00,0x04,0x99,0x11,0x0F,0x99,0x4F,0x4D,0x99,0x2F,0x8F,0x99,0x4F,0xBB,0xA1,0x4F,0xE2,0x81,0xA1,0x4F,0xFF,0x00,0xA1,0x6F,0xFF,0x82,0xA9,0x6E,0xFF,0x81,0xB1,0x6E,0xFF,0x04,0xB1,0x8E,0xE1,0xB1,0x8E,0xBB,0xB9,0x8D,0x8E,0xB9,0x8D,0x4D,0xB1,0xAD,0x0E,0xB2,0x00,0x00,0x00,0x07,0xA8,0xEE,0x09,0xA1,0x6F,0x21,0xA1,0x6E,0x2D,0xA1,0x6F,0x39,0xA9,0x6F,0x39,0xA9,0x6E,0x2D,0xB1,0x6E,0x21,0xA9,0xCE,0x09,0x9B,0x00,0x00,0x00,
     };
 const lv_img_dsc_t ui_img_qr_png = {
    .header.always_zero = 0,
    .header.w = 64,
    .header.h = 64,
    .data_size = sizeof(ui_img_qr_png_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+   .header.cf = LV_IMG_CF_USER_ENCODED_1,
    .data = ui_img_qr_png_data};
 
@@ -10,77 +10,34 @@
 #endif
 
 // IMAGE DATA: assets\search.png
+// Run length encoded LV_IMG_CF_TRUE_COLOR_ALPHA, decoded by src/img_cache.cpp
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_search_png_data[] = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x42,0x16,0xFB,0x42,0x54,0xFB,0x42,0x7F,0xFB,0x42,0xA7,0xFB,0x42,0xCD,0xFB,0x42,0xDE,0xFB,0x42,0xEE,0xFB,0x42,0xFA,0xFB,0x42,0xFA,0xFB,0x42,0xEE,0xFB,0x42,0xDE,0xFB,0x42,0xCD,0xFB,0x42,0xA6,0xFB,0x42,0x7E,0xFB,0x42,0x53,0xFB,0x42,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x43,0x35,0xFB,0x42,0x8E,0xFB,0x42,0xD3,0xFB,0x42,0xFE,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFE,0xFB,0x42,0xD3,0xFB,0x42,0x8D,0xFB,0x62,0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x62,0x0E,0xFB,0x42,0x74,0xFB,0x42,0xD6,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xD5,0xFB,0x42,0x74,0xFB,0x02,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x03,0x12,0xFB,0x42,0x81,0xFB,0x42,0xEE,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xEE,0xFB,0x42,0x80,0xFB,0x41,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0xFB,0x42,0x5E,0xFB,0x42,0xEA,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xED,0xFB,0x42,0x6F,0xFC,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x42,0x24,0xFB,0x42,0xC5,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xC4,0xFB,0x62,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x42,0x51,0xFB,0x42,0xEF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xF2,0xFB,0x42,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x02,0xFB,0x42,0x8F,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0x8D,0xFC,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFA,0xA5,0x06,0xFB,0x42,0xA6,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xA5,0xFB,0x20,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFA,0xA5,0x06,0xFB,0x42,0xB5,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x43,0xFF,0xDB,0x24,0xFF,0xDB,0x24,0xFF,0xDB,0x24,0xFF,0xDB,0x24,0xFF,0xDB,0x24,0xFF,0xDB,0x24,0xFF,0xDB,0x24,0xFF,0xDB,0x24,0xFF,0xDB,0x24,0xFF,0xBA,0xC4,0xFF,0xB2,0xC4,0xFF,0xB2,0xC4,0xFF,0xB2,0xC4,0xFF,0xB2,0xC4,0xFF,0xB2,0xC4,0xFF,0xB2,0xC4,0xFF,0xB2,0xC4,0xFF,0xB2,0xC4,0xFF,0xBA,0xC4,0xFF,0xEB,0x23,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xB4,0xFB,0x20,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0xFB,0x42,0xA1,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xBA,0xE5,0xFF,0x4A,0x49,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x29,0x86,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x45,0xFF,0x72,0x25,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xA6,0xFC,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x42,0x8F,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xE3,0x23,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x29,0x86,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0xA2,0x03,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0x8B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x42,0x55,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xAA,0xE5,0xFF,0x42,0x4A,0xFF,0x5B,0x0D,0xFF,0x94,0xD3,0xFF,0x94,0xD3,0xFF,0x94,0xD3,0xFF,0x94,0xD3,0xFF,0x94,0xD3,0xFF,0x94,0xD3,0xFF,0x94,0xD3,0xFF,0x94,0xD3,0xFF,0x94,0xD3,0xFF,0xA5,0x55,0xFF,0xB5,0x97,0xFF,0xB5,0x97,0xFF,0xB5,0x97,0xFF,0xB5,0x97,0xFF,0xB5,0x97,0xFF,0xB5,0x97,0xFF,0xB5,0x97,0xFF,0xB5,0x97,0xFF,0xB5,0x97,0xFF,0x6B,0x8E,0xFF,0x21,0x25,0xFF,0x51,0x85,0xFF,0xF2,0x61,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x62,0x23,0xFB,0x42,0xF0,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9F,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xB5,0xD7,0xFF,0x21,0x25,0xFF,0x41,0x85,0xFF,0xE9,0x80,0xFF,0xF2,0x61,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xF0,0xFB,0x42,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0xFB,0x42,0xC5,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9F,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xB5,0xD7,0xFF,0x21,0x25,0xFF,0x41,0x85,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x61,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xC2,0xF8,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x42,0x64,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9F,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xE7,0x5E,0xFF,0xC6,0xBE,0xFF,0xAE,0x1D,0xFF,0xC6,0x9E,0xFF,0xE7,0x3E,0xFF,0xEF,0x7E,0xFF,0xB5,0xD7,0xFF,0x21,0x25,0xFF,0x41,0x85,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x61,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0x5F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x03,0x12,0xFB,0x42,0xEB,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9F,0xFF,0xA5,0xFD,0xFF,0x4C,0x1B,0xFF,0x12,0xF9,0xFF,0x02,0x98,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x0A,0xD9,0xFF,0x33,0x79,0xFF,0x22,0x0F,0xFF,0x41,0x86,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x61,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xE9,0xFB,0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x42,0x82,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0x7E,0xFF,0x2B,0x7A,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x0A,0xD8,0xFF,0x7A,0x6F,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x61,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x62,0x0E,0xFB,0x42,0xEE,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x4C,0x1B,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x22,0xD7,0xFF,0xD1,0xC3,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x61,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xED,0xFB,0x02,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x42,0x74,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x9F,0xFF,0x23,0x5A,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x0A,0xF9,0xFF,0x1B,0x3A,0xFF,0x23,0x7B,0xFF,0x1B,0x5A,0xFF,0x13,0x19,0xFF,0x02,0xB8,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x0A,0xB8,0xFF,0xB2,0x08,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x61,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0x72,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x42,0xD3,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7C,0xFF,0xFF,0x23,0x3B,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0xB8,0xFF,0x33,0xDC,0xFF,0x5D,0x1E,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x5F,0xFF,0x3C,0x3D,0xFF,0x0A,0xD9,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x0A,0xB8,0xFF,0xC9,0xE5,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x61,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xD5,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xFB,0x43,0x35,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xBF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x23,0x3B,0xFF,0x02,0x97,0xFF,0x1B,0x5A,0xFF,0x5D,0x5F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x7F,0xFF,0x33,0xDC,0xFF,0x02,0x98,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x1A,0xD8,0xFF,0xE1,0xA1,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x61,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0x31,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xFB,0x42,0x8E,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCE,0xFF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4C,0x5D,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x44,0x5D,0xFF,0x02,0xB8,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x4A,0xB3,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x61,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0x8B,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xFB,0x42,0xD4,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x74,0xBF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x6C,0xFF,0xFF,0xA6,0xBF,0xFF,0x86,0x1F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x3C,0x1C,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0xB8,0xFF,0xC9,0xE4,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x61,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xCF,0x00,0x00,0x00,
-    0xFB,0x42,0x16,0xFB,0x42,0xFE,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCE,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x54,0x3F,0xFF,0xA6,0x9F,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0x86,0x1F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x1B,0x3A,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x4A,0xB4,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x61,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFE,0xFB,0x23,0x14,
-    0xFB,0x42,0x54,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x95,0x7F,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x85,0x9F,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0x86,0x1F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x54,0xDE,0xFF,0x02,0x98,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x12,0xB8,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x61,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0x52,
-    0xFB,0x42,0x80,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0x5F,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xFF,0xFF,0xA6,0x9F,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0x86,0x1F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x12,0xF9,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0xBA,0x07,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x61,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0x7D,
-    0xFB,0x42,0xA7,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xEF,0x7F,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x64,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0x86,0x1F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x33,0xDC,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x72,0x6F,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x61,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xA4,
-    0xFB,0x42,0xCC,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xDF,0x1F,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x75,0x3F,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0x86,0x1F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x44,0x5D,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x5A,0x92,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x61,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xCA,
-    0xFB,0x42,0xE0,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xCE,0xBF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x7D,0x7F,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0x86,0x1F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x4C,0xBE,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x42,0xB4,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x61,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xDE,
-    0xFB,0x42,0xED,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xD6,0xFF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x7D,0x5F,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0x86,0x1F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x44,0x9D,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x4A,0xB3,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x61,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xEB,
-    0xFB,0x42,0xF9,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xE7,0x5F,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x6C,0xFF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0x86,0x1F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x3C,0x1C,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x62,0x91,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x61,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xF8,
-    0xFB,0x42,0xF9,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0x4B,0xFF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x5C,0x5F,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0x86,0x1F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x23,0x7B,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x8A,0x4C,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x61,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xF8,
-    0xFB,0x42,0xED,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x74,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x96,0x3F,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0x86,0x1F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x7F,0xFF,0x0A,0xD8,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0xB8,0xFF,0xE1,0xA2,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x61,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xEB,
-    0xFB,0x42,0xE0,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAE,0x1F,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x6C,0xDF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0x86,0x1F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x65,0x9F,0xFF,0x33,0xFC,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x22,0xD7,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x61,0xFF,0xFB,0x42,0xDE,
-    0xFB,0x42,0xCC,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x9F,0xFF,0x54,0x1F,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x8E,0x1F,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0x86,0x1F,0xFF,0x65,0x9F,0xFF,0x5D,0x3E,0xFF,0x0A,0xD8,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x8A,0x4D,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x61,0xE3,
-    0xFB,0x42,0xA6,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x54,0x1F,0xFF,0x9E,0x5F,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0x7D,0xFF,0xFF,0x13,0x19,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x1B,0x18,0xFF,0xF2,0xC0,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x00,0xE0,
-    0xFB,0x42,0x7F,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBF,0xFF,0x5C,0x5F,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x54,0x3F,0xFF,0x96,0x3F,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0x9E,0x7F,0xFF,0x64,0x9F,0xFF,0x23,0x3B,0xFF,0x02,0x97,0xFF,0x02,0x97,0xFF,0x02,0x98,0xFF,0xAC,0xCB,0xFF,0xFD,0xC2,0xFF,0xF2,0xC0,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x21,0xBD,
-    0xFB,0x42,0x53,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0x3F,0xFF,0x53,0xFF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xFF,0xFF,0x7D,0x5F,0xFF,0xA6,0x9F,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0xBF,0xFF,0xA6,0x9F,0xFF,0x85,0xBF,0xFF,0x54,0x3F,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x23,0x3B,0xFF,0x02,0x97,0xFF,0x6C,0x12,0xFF,0xFD,0xC2,0xFF,0xFD,0xC2,0xFF,0xFD,0xC2,0xFF,0xF2,0xC0,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x41,0x89,
-    0xFB,0x42,0x16,0xFB,0x42,0xFE,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC6,0x9F,0xFF,0x4B,0xFF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x54,0x1F,0xFF,0x75,0x1F,0xFF,0x8D,0xDF,0xFF,0x96,0x3F,0xFF,0x9E,0x7F,0xFF,0x9E,0x5F,0xFF,0x8D,0xFF,0xFF,0x75,0x3F,0xFF,0x5C,0x5F,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x6C,0x34,0xFF,0xFD,0xC2,0xFF,0xFD,0xC2,0xFF,0xFD,0xC2,0xFF,0xFD,0xC2,0xFF,0xFD,0xC2,0xFF,0xF2,0xC0,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x41,0x2A,
-    0x00,0x00,0x00,0xFB,0x42,0xD3,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD6,0xFF,0xFF,0x5C,0x3F,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0xAD,0x50,0xFF,0xFE,0x82,0xFF,0xFE,0x22,0xFF,0xFD,0xC2,0xFF,0xFD,0xC2,0xFF,0xFD,0xC2,0xFF,0xFD,0xC2,0xFF,0xFD,0xC2,0xFF,0xF2,0xC0,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF1,0xE0,0xF6,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xFB,0x42,0x8E,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x7F,0xFF,0x7D,0x1F,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x6C,0x3A,0xFF,0xD5,0xCA,0xFF,0xFE,0x82,0xFF,0xFE,0x82,0xFF,0xFE,0x82,0xFF,0xFE,0x22,0xFF,0xFD,0xC2,0xFF,0xFD,0xC2,0xFF,0xFD,0xC2,0xFF,0xFD,0xC2,0xFF,0xFD,0xC2,0xFF,0xF2,0xC0,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x20,0xCA,0x00,0x00,0x00,
-    0x00,0x00,0x00,0xFB,0x62,0x34,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCE,0xBF,0xFF,0x7C,0xDF,0xFF,0x4B,0xFF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x4B,0xDF,0xFF,0x43,0x5A,0xFF,0x4A,0x4F,0xFF,0xF2,0x20,0xFF,0xFD,0xE2,0xFF,0xFE,0x82,0xFF,0xFE,0x82,0xFF,0xFE,0x82,0xFF,0xFE,0x82,0xFF,0xFE,0x22,0xFF,0xFD,0xC2,0xFF,0xFD,0xC2,0xFF,0xFD,0xC2,0xFF,0xFD,0xC2,0xFF,0xFD,0xC2,0xFF,0xF2,0xA0,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x41,0x59,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x42,0xD3,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9F,0xFF,0xEF,0x7E,0xFF,0xE7,0x5E,0xFF,0xB6,0x5F,0xFF,0x9D,0x9F,0xFF,0x8D,0x5F,0xFF,0x7C,0xFF,0xFF,0x85,0x3F,0xFF,0x95,0x9F,0xFF,0xAE,0x1F,0xFF,0xAD,0x98,0xFF,0x21,0x25,0xFF,0x41,0x85,0xFF,0xE9,0x80,0xFF,0xF2,0x20,0xFF,0xFD,0xE2,0xFF,0xFE,0x82,0xFF,0xFE,0x82,0xFF,0xFE,0x82,0xFF,0xFE,0x82,0xFF,0xFE,0x22,0xFF,0xFD,0xC2,0xFF,0xFD,0xC2,0xFF,0xFD,0xC2,0xFF,0xFD,0xC2,0xFF,0xFD,0xC2,0xFF,0xE9,0xA0,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF1,0xE0,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x42,0x74,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9F,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xB5,0xD7,0xFF,0x21,0x25,0xFF,0x41,0x85,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x20,0xFF,0xFD,0xC2,0xFF,0xFE,0x82,0xFF,0xFE,0x82,0xFF,0xFE,0x82,0xFF,0xFE,0x82,0xFF,0xFE,0x22,0xFF,0xFD,0xC2,0xFF,0xFD,0xC2,0xFF,0xFD,0xC2,0xFF,0xFD,0xC2,0xFF,0xF3,0x00,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x21,0xB0,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x02,0x0D,0xFB,0x42,0xEE,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9F,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xB5,0xD7,0xFF,0x21,0x25,0xFF,0x41,0x85,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x20,0xFF,0xFD,0xE2,0xFF,0xFE,0x82,0xFF,0xFE,0x82,0xFF,0xFE,0x82,0xFF,0xFE,0x82,0xFF,0xFE,0x22,0xFF,0xFD,0xC2,0xFF,0xFD,0xC2,0xFF,0xFD,0xC2,0xFF,0xF4,0x01,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF1,0xA0,0xFE,0xF2,0x81,0x19,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x42,0x81,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9F,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xB5,0xD7,0xFF,0x21,0x25,0xFF,0x41,0x85,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x20,0xFF,0xFD,0xE2,0xFF,0xFE,0x82,0xFF,0xFE,0x82,0xFF,0xFE,0x82,0xFF,0xFE,0x82,0xFF,0xFE,0x22,0xFF,0xFD,0xC2,0xFF,0xFD,0xC2,0xFF,0xF2,0xE0,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x20,0xBF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x41,0x11,0xFB,0x42,0xEA,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9F,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xB5,0xD7,0xFF,0x21,0x25,0xFF,0x41,0x85,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x20,0xFF,0xFD,0xE2,0xFF,0xFE,0x82,0xFF,0xFE,0x82,0xFF,0xFE,0x82,0xFF,0xFE,0x82,0xFF,0xFE,0x22,0xFF,0xFD,0xA2,0xFF,0xE9,0xA0,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF1,0xA0,0xFD,0xF2,0x61,0x1D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x42,0x62,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9F,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xB5,0xD7,0xFF,0x21,0x25,0xFF,0x41,0x85,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x20,0xFF,0xFD,0x62,0xFF,0xFE,0x82,0xFF,0xFE,0x82,0xFF,0xFE,0x82,0xFF,0xFD,0x42,0xFF,0xF2,0x40,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x41,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0xFB,0x42,0xC4,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9F,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xB5,0xD7,0xFF,0x21,0x25,0xFF,0x41,0x85,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0xA0,0xFF,0xF2,0x60,0xFF,0xF3,0x00,0xFF,0xF2,0x60,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF1,0xE0,0xF0,0xF8,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x62,0x23,0xFB,0x42,0xF0,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x7C,0x11,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xFF,0xDF,0xFF,0xEF,0x9E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xEF,0x7E,0xFF,0xB5,0x97,0xFF,0x21,0x25,0xFF,0x41,0x85,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF1,0xA0,0xFE,0xF2,0x41,0x3D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x42,0x54,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xA2,0xC6,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x29,0x86,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x49,0x85,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x41,0x8E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x42,0x8D,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xC3,0x05,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x29,0x86,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x69,0x84,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x21,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0xFB,0x42,0x9F,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0x72,0x47,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x42,0x4A,0xFF,0x29,0x86,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x21,0x25,0xFF,0x29,0x65,0xFF,0xE1,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x00,0xE0,0xFA,0xA0,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x20,0x05,0xFB,0x42,0xB5,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x22,0xFF,0xAA,0x24,0xFF,0x82,0x06,0xFF,0x7A,0x06,0xFF,0x7A,0x06,0xFF,0x7A,0x06,0xFF,0x7A,0x06,0xFF,0x7A,0x06,0xFF,0x7A,0x06,0xFF,0x7A,0x06,0xFF,0x7A,0x06,0xFF,0x51,0xA6,0xFF,0x41,0x85,0xFF,0x41,0x85,0xFF,0x41,0x85,0xFF,0x41,0x85,0xFF,0x41,0x85,0xFF,0x41,0x85,0xFF,0x41,0x85,0xFF,0x41,0x85,0xFF,0x41,0x85,0xFF,0x69,0x84,0xFF,0xE1,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x00,0xE8,0xFA,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x04,0xFB,0x42,0x9D,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x22,0xFF,0xF2,0x00,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x00,0xE0,0xFA,0x60,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0xFB,0x42,0x8B,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x22,0xFF,0xF2,0x00,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF2,0x21,0xC8,0xF8,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x42,0x50,0xFB,0x42,0xEE,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xF2,0x00,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF1,0xA0,0xFE,0xF2,0x41,0x8F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x42,0x22,0xFB,0x42,0xC2,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x22,0xFF,0xF2,0x00,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF1,0xE0,0xF1,0xF2,0x61,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x01,0xFB,0x42,0x5E,0xFB,0x42,0xE9,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xF2,0x00,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF1,0xA0,0xFD,0xF2,0x41,0xA2,0xF8,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x82,0x10,0xFB,0x42,0x7E,0xFB,0x42,0xED,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xF2,0x00,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF1,0xA0,0xFE,0xF2,0x20,0xBF,0xF2,0x61,0x1A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x42,0x0C,0xFB,0x42,0x72,0xFB,0x42,0xD4,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xFF,0xF2,0x00,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF1,0xC0,0xF8,0xF2,0x41,0xAE,0xF2,0x61,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x42,0x31,0xFB,0x42,0x8B,0xFB,0x42,0xD0,0xFB,0x42,0xFD,0xF2,0x00,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xE9,0x80,0xFF,0xF1,0xC0,0xF7,0xF2,0x21,0xC8,0xF2,0x41,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFB,0x23,0x14,0xFB,0x02,0x5B,0xF2,0x20,0xBE,0xF2,0x00,0xE0,0xF1,0xE0,0xF4,0xF1,0xC0,0xFB,0xF1,0xA0,0xFE,0xE9,0xA0,0xFF,0xE9,0xA0,0xFF,0xF1,0xA0,0xFE,0xF1,0xC0,0xFB,0xF1,0xE0,0xF4,0xF2,0x00,0xDF,0xF2,0x20,0xBE,0xF2,0x41,0x87,0xFA,0x41,0x26,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x97,0x00,0x00,0x00,0x06,0xFB,0x42,0x16,0xFB,0x42,0x54,0xFB,0x42,0x7F,0xFB,0x42,0xA7,0xFB,0x42,0xCD,0xFB,0x42,0xDE,0xFB,0x42,0xEE,0x81,0xFB,0x42,0xFA,0x06,0xFB,0x42,0xEE,0xFB,0x42,0xDE,0xFB,0x42,0xCD,0xFB,0x42,0xA6,0xFB,0x42,0x7E,0xFB,0x42,0x53,0xFB,0x42,0x16,0xAC,0x00,0x00,0x00,0x03,0xFB,0x43,0x35,0xFB,0x42,0x8E,0xFB,0x42,0xD3,0xFB,0x42,0xFE,0x8D,0xFB,0x42,0xFF,0x03,0xFB,0x42,0xFE,0xFB,0x42,0xD3,0xFB,0x42,0x8D,0xFB,0x62,0x34,0xA6,0x00,0x00,0x00,0x02,0xFB,0x62,0x0E,0xFB,0x42,0x74,0xFB,0x42,0xD6,0x95,0xFB,0x42,0xFF,0x02,0xFB,0x42,0xD5,0xFB,0x42,0x74,0xFB,0x02,0x0D,0xA1,0x00,0x00,0x00,0x02,0xFB,0x03,0x12,0xFB,0x42,0x81,0xFB,0x42,0xEE,0x99,0xFB,0x42,0xFF,0x02,0xFB,0x42,0xEE,0xFB,0x42,0x80,0xFB,0x41,0x11,0x9D,0x00,0x00,0x00,0x02,0xF8,0x00,0x01,0xFB,0x42,0x5E,0xFB,0x42,0xEA,0x9D,0xFB,0x42,0xFF,0x02,0xFB,0x42,0xED,0xFB,0x42,0x6F,0xFC,0x00,0x02,0x9A,0x00,0x00,0x00,0x01,0xFB,0x42,0x24,0xFB,0x42,0xC5,0xA1,0xFB,0x42,0xFF,0x01,0xFB,0x42,0xC4,0xFB,0x62,0x23,
+    0x98,0x00,0x00,0x00,0x01,0xFB,0x42,0x51,0xFB,0x42,0xEF,0xA3,0xFB,0x42,0xFF,0x01,0xFB,0x42,0xF2,0xFB,0x42,0x58,0x95,0x00,0x00,0x00,0x01,0xFC,0x00,0x02,0xFB,0x42,0x8F,0xA7,0xFB,0x42,0xFF,0x01,0xFB,0x42,0x8D,0xFC,0x00,0x02,0x92,0x00,0x00,0x00,0x01,0xFA,0xA5,0x06,0xFB,0x42,0xA6,0xA9,0xFB,0x42,0xFF,0x01,0xFB,0x42,0xA5,0xFB,0x20,0x05,0x90,0x00,0x00,0x00,0x01,0xFA,0xA5,0x06,0xFB,0x42,0xB5,0x86,0xFB,0x42,0xFF,0x00,0xFB,0x43,0xFF,0x88,0xDB,0x24,0xFF,0x00,0xBA,0xC4,0xFF,0x87,0xB2,0xC4,0xFF,0x01,0xBA,0xC4,0xFF,0xEB,0x23,0xFF,0x8F,0xFB,0x42,0xFF,0x01,0xFB,0x42,0xB4,0xFB,0x20,0x05,0x8E,0x00,0x00,0x00,0x01,0xF8,0x00,0x01,0xFB,0x42,0xA1,0x86,0xFB,0x42,0xFF,0x01,0xBA,0xE5,0xFF,0x4A,0x49,0xFF,0x88,0x42,0x4A,0xFF,0x00,0x29,0x86,0xFF,0x88,0x21,0x25,0xFF,0x01,0x21,0x45,0xFF,0x72,0x25,0xFF,0x8F,0xFB,0x42,0xFF,0x01,0xFB,0x42,0xA6,0xFC,0x00,0x02,0x8D,0x00,0x00,0x00,0x00,0xFB,0x42,0x8F,0x86,0xFB,0x42,0xFF,0x00,0xE3,0x23,0xFF,0x8A,0x42,0x4A,0xFF,0x00,0x29,0x86,0xFF,0x8A,
+    0x21,0x25,0xFF,0x00,0xA2,0x03,0xFF,0x8F,0xFB,0x42,0xFF,0x00,0xFB,0x42,0x8B,0x8C,0x00,0x00,0x00,0x00,0xFB,0x42,0x55,0x87,0xFB,0x42,0xFF,0x02,0xAA,0xE5,0xFF,0x42,0x4A,0xFF,0x5B,0x0D,0xFF,0x88,0x94,0xD3,0xFF,0x00,0xA5,0x55,0xFF,0x88,0xB5,0x97,0xFF,0x03,0x6B,0x8E,0xFF,0x21,0x25,0xFF,0x51,0x85,0xFF,0xF2,0x61,0xFF,0x8F,0xFB,0x42,0xFF,0x00,0xFB,0x42,0x59,0x8A,0x00,0x00,0x00,0x01,0xFB,0x62,0x23,0xFB,0x42,0xF0,0x87,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0x88,0xFF,0xFF,0xFF,0x00,0xF7,0x9F,0xFF,0x88,0xEF,0x7E,0xFF,0x04,0xB5,0xD7,0xFF,0x21,0x25,0xFF,0x41,0x85,0xFF,0xE9,0x80,0xFF,0xF2,0x61,0xFF,0x8E,0xFB,0x42,0xFF,0x01,0xFB,0x42,0xF0,0xFB,0x42,0x22,0x88,0x00,0x00,0x00,0x01,0xF8,0x00,0x01,0xFB,0x42,0xC5,0x88,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0x88,0xFF,0xFF,0xFF,0x00,0xF7,0x9F,0xFF,0x88,0xEF,0x7E,0xFF,0x02,0xB5,0xD7,0xFF,0x21,0x25,0xFF,0x41,0x85,0xFF,0x81,0xE9,0x80,0xFF,0x00,0xF2,0x61,0xFF,0x8E,0xFB,0x42,
+    0xFF,0x01,0xFB,0x42,0xC2,0xF8,0x00,0x01,0x87,0x00,0x00,0x00,0x00,0xFB,0x42,0x64,0x89,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0x88,0xFF,0xFF,0xFF,0x00,0xF7,0x9F,0xFF,0x82,0xEF,0x7E,0xFF,0x08,0xE7,0x5E,0xFF,0xC6,0xBE,0xFF,0xAE,0x1D,0xFF,0xC6,0x9E,0xFF,0xE7,0x3E,0xFF,0xEF,0x7E,0xFF,0xB5,0xD7,0xFF,0x21,0x25,0xFF,0x41,0x85,0xFF,0x82,0xE9,0x80,0xFF,0x00,0xF2,0x61,0xFF,0x8E,0xFB,0x42,0xFF,0x00,0xFB,0x42,0x5F,0x86,0x00,0x00,0x00,0x01,0xFB,0x03,0x12,0xFB,0x42,0xEB,0x89,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0x88,0xFF,0xFF,0xFF,0x04,0xF7,0x9F,0xFF,0xA5,0xFD,0xFF,0x4C,0x1B,0xFF,0x12,0xF9,0xFF,0x02,0x98,0xFF,0x83,0x02,0x97,0xFF,0x03,0x0A,0xD9,0xFF,0x33,0x79,0xFF,0x22,0x0F,0xFF,0x41,0x86,0xFF,0x83,0xE9,0x80,0xFF,0x00,0xF2,0x61,0xFF,0x8D,0xFB,0x42,0xFF,0x01,0xFB,0x42,0xE9,0xFB,0x82,0x10,0x85,0x00,0x00,0x00,0x00,0xFB,0x42,0x82,0x8A,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0x87,0xFF,0xFF,
+    0xFF,0x01,0xBE,0x7E,0xFF,0x2B,0x7A,0xFF,0x8A,0x02,0x97,0xFF,0x01,0x0A,0xD8,0xFF,0x7A,0x6F,0xFF,0x83,0xE9,0x80,0xFF,0x00,0xF2,0x61,0xFF,0x8D,0xFB,0x42,0xFF,0x00,0xFB,0x42,0x7E,0x84,0x00,0x00,0x00,0x01,0xFB,0x62,0x0E,0xFB,0x42,0xEE,0x8A,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0x85,0xFF,0xFF,0xFF,0x01,0xFF,0xDF,0xFF,0x4C,0x1B,0xFF,0x8E,0x02,0x97,0xFF,0x01,0x22,0xD7,0xFF,0xD1,0xC3,0xFF,0x82,0xE9,0x80,0xFF,0x00,0xF2,0x61,0xFF,0x8C,0xFB,0x42,0xFF,0x01,0xFB,0x42,0xED,0xFB,0x02,0x0D,0x83,0x00,0x00,0x00,0x00,0xFB,0x42,0x74,0x8B,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0x84,0xFF,0xFF,0xFF,0x01,0xEF,0x9F,0xFF,0x23,0x5A,0xFF,0x85,0x02,0x97,0xFF,0x05,0x0A,0xF9,0xFF,0x1B,0x3A,0xFF,0x23,0x7B,0xFF,0x1B,0x5A,0xFF,0x13,0x19,0xFF,0x02,0xB8,0xFF,0x84,0x02,0x97,0xFF,0x01,0x0A,0xB8,0xFF,0xB2,0x08,0xFF,0x82,0xE9,0x80,0xFF,0x00,0xF2,0x61,0xFF,0x8C,0xFB,0x42,0xFF,0x00,0xFB,0x42,0x72,0x83,0x00,0x00,0x00,0x00,0xFB,0x42,0xD3,
+    0x8B,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0x84,0xFF,0xFF,0xFF,0x01,0x7C,0xFF,0xFF,0x23,0x3B,0xFF,0x82,0x02,0x97,0xFF,0x02,0x02,0xB8,0xFF,0x33,0xDC,0xFF,0x5D,0x1E,0xFF,0x84,0x65,0x9F,0xFF,0x02,0x65,0x5F,0xFF,0x3C,0x3D,0xFF,0x0A,0xD9,0xFF,0x83,0x02,0x97,0xFF,0x01,0x0A,0xB8,0xFF,0xC9,0xE5,0xFF,0x82,0xE9,0x80,0xFF,0x00,0xF2,0x61,0xFF,0x8B,0xFB,0x42,0xFF,0x00,0xFB,0x42,0xD5,0x82,0x00,0x00,0x00,0x00,0xFB,0x43,0x35,0x8C,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0x83,0xFF,0xFF,0xFF,0x00,0x9D,0xBF,0xFF,0x81,0x4B,0xDF,0xFF,0x03,0x23,0x3B,0xFF,0x02,0x97,0xFF,0x1B,0x5A,0xFF,0x5D,0x5F,0xFF,0x88,0x65,0x9F,0xFF,0x02,0x65,0x7F,0xFF,0x33,0xDC,0xFF,0x02,0x98,0xFF,0x82,0x02,0x97,0xFF,0x01,0x1A,0xD8,0xFF,0xE1,0xA1,0xFF,0x82,0xE9,0x80,0xFF,0x00,0xF2,0x61,0xFF,0x8B,0xFB,0x42,0xFF,0x00,0xFB,0x42,0x31,0x81,0x00,0x00,0x00,0x00,0xFB,0x42,0x8E,0x8C,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0x82,0xFF,
+    0xFF,0xFF,0x00,0xCE,0xFF,0xFF,0x83,0x4B,0xDF,0xFF,0x00,0x4C,0x5D,0xFF,0x8C,0x65,0x9F,0xFF,0x01,0x44,0x5D,0xFF,0x02,0xB8,0xFF,0x82,0x02,0x97,0xFF,0x00,0x4A,0xB3,0xFF,0x83,0xE9,0x80,0xFF,0x00,0xF2,0x61,0xFF,0x8A,0xFB,0x42,0xFF,0x00,0xFB,0x42,0x8B,0x81,0x00,0x00,0x00,0x00,0xFB,0x42,0xD4,0x8C,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0x82,0xFF,0xFF,0xFF,0x00,0x74,0xBF,0xFF,0x82,0x4B,0xDF,0xFF,0x02,0x6C,0xFF,0xFF,0xA6,0xBF,0xFF,0x86,0x1F,0xFF,0x8C,0x65,0x9F,0xFF,0x00,0x3C,0x1C,0xFF,0x82,0x02,0x97,0xFF,0x01,0x02,0xB8,0xFF,0xC9,0xE4,0xFF,0x83,0xE9,0x80,0xFF,0x00,0xF2,0x61,0xFF,0x89,0xFB,0x42,0xFF,0x03,0xFB,0x42,0xCF,0x00,0x00,0x00,0xFB,0x42,0x16,0xFB,0x42,0xFE,0x8C,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0x81,0xFF,0xFF,0xFF,0x00,0xCE,0xDF,0xFF,0x82,0x4B,0xDF,0xFF,0x01,0x54,0x3F,0xFF,0xA6,0x9F,0xFF,0x81,0xA6,0xBF,0xFF,0x00,0x86,0x1F,0xFF,0x8C,0x65,0x9F,0xFF,0x00,0x1B,0x3A,0xFF,0x82,0x02,0x97,0xFF,0x00,0x4A,
+    0xB4,0xFF,0x84,0xE9,0x80,0xFF,0x00,0xF2,0x61,0xFF,0x88,0xFB,0x42,0xFF,0x02,0xFB,0x42,0xFE,0xFB,0x23,0x14,0xFB,0x42,0x54,0x8D,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0x81,0xFF,0xFF,0xFF,0x00,0x95,0x7F,0xFF,0x82,0x4B,0xDF,0xFF,0x00,0x85,0x9F,0xFF,0x83,0xA6,0xBF,0xFF,0x00,0x86,0x1F,0xFF,0x8B,0x65,0x9F,0xFF,0x01,0x54,0xDE,0xFF,0x02,0x98,0xFF,0x81,0x02,0x97,0xFF,0x00,0x12,0xB8,0xFF,0x85,0xE9,0x80,0xFF,0x00,0xF2,0x61,0xFF,0x88,0xFB,0x42,0xFF,0x01,0xFB,0x42,0x52,0xFB,0x42,0x80,0x8D,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0x81,0xFF,0xFF,0xFF,0x00,0x5C,0x5F,0xFF,0x81,0x4B,0xDF,0xFF,0x01,0x4B,0xFF,0xFF,0xA6,0x9F,0xFF,0x84,0xA6,0xBF,0xFF,0x00,0x86,0x1F,0xFF,0x8B,0x65,0x9F,0xFF,0x00,0x12,0xF9,0xFF,0x82,0x02,0x97,0xFF,0x00,0xBA,0x07,0xFF,0x85,0xE9,0x80,0xFF,0x00,0xF2,0x61,0xFF,0x87,0xFB,0x42,0xFF,0x01,0xFB,0x42,0x7D,0xFB,0x42,0xA7,0x8D,0xFB,0x42,0xFF,0x04,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,
+    0xFF,0xEF,0x7F,0xFF,0x82,0x4B,0xDF,0xFF,0x00,0x64,0xBF,0xFF,0x86,0xA6,0xBF,0xFF,0x00,0x86,0x1F,0xFF,0x8A,0x65,0x9F,0xFF,0x00,0x33,0xDC,0xFF,0x82,0x02,0x97,0xFF,0x00,0x72,0x6F,0xFF,0x86,0xE9,0x80,0xFF,0x00,0xF2,0x61,0xFF,0x86,0xFB,0x42,0xFF,0x01,0xFB,0x42,0xA4,0xFB,0x42,0xCC,0x8D,0xFB,0x42,0xFF,0x04,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xDF,0x1F,0xFF,0x82,0x4B,0xDF,0xFF,0x00,0x75,0x3F,0xFF,0x87,0xA6,0xBF,0xFF,0x00,0x86,0x1F,0xFF,0x89,0x65,0x9F,0xFF,0x00,0x44,0x5D,0xFF,0x82,0x02,0x97,0xFF,0x00,0x5A,0x92,0xFF,0x87,0xE9,0x80,0xFF,0x00,0xF2,0x61,0xFF,0x85,0xFB,0x42,0xFF,0x01,0xFB,0x42,0xCA,0xFB,0x42,0xE0,0x8D,0xFB,0x42,0xFF,0x04,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xCE,0xBF,0xFF,0x82,0x4B,0xDF,0xFF,0x00,0x7D,0x7F,0xFF,0x88,0xA6,0xBF,0xFF,0x00,0x86,0x1F,0xFF,0x88,0x65,0x9F,0xFF,0x00,0x4C,0xBE,0xFF,0x82,0x02,0x97,0xFF,0x00,0x42,0xB4,0xFF,0x88,0xE9,0x80,0xFF,0x00,0xF2,0x61,0xFF,0x84,0xFB,0x42,0xFF,0x01,0xFB,
+    0x42,0xDE,0xFB,0x42,0xED,0x8D,0xFB,0x42,0xFF,0x04,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xD6,0xFF,0xFF,0x82,0x4B,0xDF,0xFF,0x00,0x7D,0x5F,0xFF,0x89,0xA6,0xBF,0xFF,0x00,0x86,0x1F,0xFF,0x87,0x65,0x9F,0xFF,0x00,0x44,0x9D,0xFF,0x82,0x02,0x97,0xFF,0x00,0x4A,0xB3,0xFF,0x89,0xE9,0x80,0xFF,0x00,0xF2,0x61,0xFF,0x83,0xFB,0x42,0xFF,0x01,0xFB,0x42,0xEB,0xFB,0x42,0xF9,0x8D,0xFB,0x42,0xFF,0x04,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xE7,0x5F,0xFF,0x82,0x4B,0xDF,0xFF,0x00,0x6C,0xFF,0xFF,0x8A,0xA6,0xBF,0xFF,0x00,0x86,0x1F,0xFF,0x86,0x65,0x9F,0xFF,0x00,0x3C,0x1C,0xFF,0x82,0x02,0x97,0xFF,0x00,0x62,0x91,0xFF,0x8A,0xE9,0x80,0xFF,0x00,0xF2,0x61,0xFF,0x82,0xFB,0x42,0xFF,0x01,0xFB,0x42,0xF8,0xFB,0x42,0xF9,0x8D,0xFB,0x42,0xFF,0x05,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0x4B,0xFF,0xFF,0x81,0x4B,0xDF,0xFF,0x00,0x5C,0x5F,0xFF,0x8B,0xA6,0xBF,0xFF,0x00,0x86,0x1F,0xFF,0x85,0x65,0x9F,0xFF,0x00,0x23,
+    0x7B,0xFF,0x82,0x02,0x97,0xFF,0x00,0x8A,0x4C,0xFF,0x8B,0xE9,0x80,0xFF,0x00,0xF2,0x61,0xFF,0x81,0xFB,0x42,0xFF,0x01,0xFB,0x42,0xF8,0xFB,0x42,0xED,0x8D,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0x81,0xFF,0xFF,0xFF,0x00,0x74,0xDF,0xFF,0x82,0x4B,0xDF,0xFF,0x00,0x96,0x3F,0xFF,0x8B,0xA6,0xBF,0xFF,0x00,0x86,0x1F,0xFF,0x83,0x65,0x9F,0xFF,0x01,0x65,0x7F,0xFF,0x0A,0xD8,0xFF,0x81,0x02,0x97,0xFF,0x01,0x02,0xB8,0xFF,0xE1,0xA2,0xFF,0x8C,0xE9,0x80,0xFF,0x03,0xF2,0x61,0xFF,0xFB,0x42,0xFF,0xFB,0x42,0xEB,0xFB,0x42,0xE0,0x8D,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0x81,0xFF,0xFF,0xFF,0x00,0xAE,0x1F,0xFF,0x82,0x4B,0xDF,0xFF,0x00,0x6C,0xDF,0xFF,0x8C,0xA6,0xBF,0xFF,0x00,0x86,0x1F,0xFF,0x82,0x65,0x9F,0xFF,0x00,0x33,0xFC,0xFF,0x82,0x02,0x97,0xFF,0x00,0x22,0xD7,0xFF,0x8E,0xE9,0x80,0xFF,0x02,0xF2,0x61,0xFF,0xFB,0x42,0xDE,0xFB,0x42,0xCC,0x8D,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0x81,0xFF,0xFF,0xFF,
+    0x01,0xEF,0x9F,0xFF,0x54,0x1F,0xFF,0x82,0x4B,0xDF,0xFF,0x00,0x8E,0x1F,0xFF,0x8C,0xA6,0xBF,0xFF,0x03,0x86,0x1F,0xFF,0x65,0x9F,0xFF,0x5D,0x3E,0xFF,0x0A,0xD8,0xFF,0x82,0x02,0x97,0xFF,0x00,0x8A,0x4D,0xFF,0x8F,0xE9,0x80,0xFF,0x01,0xF2,0x61,0xE3,0xFB,0x42,0xA6,0x8D,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0x82,0xFF,0xFF,0xFF,0x00,0x9D,0xDF,0xFF,0x82,0x4B,0xDF,0xFF,0x01,0x54,0x1F,0xFF,0x9E,0x5F,0xFF,0x8C,0xA6,0xBF,0xFF,0x01,0x7D,0xFF,0xFF,0x13,0x19,0xFF,0x82,0x02,0x97,0xFF,0x01,0x1B,0x18,0xFF,0xF2,0xC0,0xFF,0x8F,0xE9,0x80,0xFF,0x01,0xF2,0x00,0xE0,0xFB,0x42,0x7F,0x8D,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0x82,0xFF,0xFF,0xFF,0x01,0xF7,0xBF,0xFF,0x5C,0x5F,0xFF,0x82,0x4B,0xDF,0xFF,0x01,0x54,0x3F,0xFF,0x96,0x3F,0xFF,0x8A,0xA6,0xBF,0xFF,0x02,0x9E,0x7F,0xFF,0x64,0x9F,0xFF,0x23,0x3B,0xFF,0x81,0x02,0x97,0xFF,0x03,0x02,0x98,0xFF,0xAC,0xCB,0xFF,0xFD,0xC2,0xFF,0xF2,0xC0,0xFF,0x8E,0xE9,0x80,0xFF,0x01,0xF2,0x21,0xBD,
+    0xFB,0x42,0x53,0x8D,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0x83,0xFF,0xFF,0xFF,0x01,0xDF,0x3F,0xFF,0x53,0xFF,0xFF,0x82,0x4B,0xDF,0xFF,0x02,0x4B,0xFF,0xFF,0x7D,0x5F,0xFF,0xA6,0x9F,0xFF,0x86,0xA6,0xBF,0xFF,0x02,0xA6,0x9F,0xFF,0x85,0xBF,0xFF,0x54,0x3F,0xFF,0x81,0x4B,0xDF,0xFF,0x02,0x23,0x3B,0xFF,0x02,0x97,0xFF,0x6C,0x12,0xFF,0x82,0xFD,0xC2,0xFF,0x00,0xF2,0xC0,0xFF,0x8D,0xE9,0x80,0xFF,0x02,0xF2,0x41,0x89,0xFB,0x42,0x16,0xFB,0x42,0xFE,0x8C,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0x84,0xFF,0xFF,0xFF,0x01,0xC6,0x9F,0xFF,0x4B,0xFF,0xFF,0x83,0x4B,0xDF,0xFF,0x08,0x54,0x1F,0xFF,0x75,0x1F,0xFF,0x8D,0xDF,0xFF,0x96,0x3F,0xFF,0x9E,0x7F,0xFF,0x9E,0x5F,0xFF,0x8D,0xFF,0xFF,0x75,0x3F,0xFF,0x5C,0x5F,0xFF,0x84,0x4B,0xDF,0xFF,0x00,0x6C,0x34,0xFF,0x84,0xFD,0xC2,0xFF,0x00,0xF2,0xC0,0xFF,0x8C,0xE9,0x80,0xFF,0x02,0xF2,0x41,0x2A,0x00,0x00,0x00,0xFB,0x42,0xD3,0x8C,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,
+    0xFF,0x85,0xFF,0xFF,0xFF,0x01,0xD6,0xFF,0xFF,0x5C,0x3F,0xFF,0x8F,0x4B,0xDF,0xFF,0x02,0xAD,0x50,0xFF,0xFE,0x82,0xFF,0xFE,0x22,0xFF,0x84,0xFD,0xC2,0xFF,0x00,0xF2,0xC0,0xFF,0x8A,0xE9,0x80,0xFF,0x00,0xF1,0xE0,0xF6,0x81,0x00,0x00,0x00,0x00,0xFB,0x42,0x8E,0x8C,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0x86,0xFF,0xFF,0xFF,0x01,0xEF,0x7F,0xFF,0x7D,0x1F,0xFF,0x8C,0x4B,0xDF,0xFF,0x01,0x6C,0x3A,0xFF,0xD5,0xCA,0xFF,0x82,0xFE,0x82,0xFF,0x00,0xFE,0x22,0xFF,0x84,0xFD,0xC2,0xFF,0x00,0xF2,0xC0,0xFF,0x89,0xE9,0x80,0xFF,0x00,0xF2,0x20,0xCA,0x81,0x00,0x00,0x00,0x00,0xFB,0x62,0x34,0x8C,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0x88,0xFF,0xFF,0xFF,0x02,0xCE,0xBF,0xFF,0x7C,0xDF,0xFF,0x4B,0xFF,0xFF,0x87,0x4B,0xDF,0xFF,0x03,0x43,0x5A,0xFF,0x4A,0x4F,0xFF,0xF2,0x20,0xFF,0xFD,0xE2,0xFF,0x83,0xFE,0x82,0xFF,0x00,0xFE,0x22,0xFF,0x84,0xFD,0xC2,0xFF,0x00,0xF2,0xA0,0xFF,0x88,0xE9,0x80,0xFF,0x00,0xF2,0x41,0x59,0x82,0x00,0x00,0x00,0x00,
+    0xFB,0x42,0xD3,0x8B,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0x88,0xFF,0xFF,0xFF,0x0F,0xF7,0x9F,0xFF,0xEF,0x7E,0xFF,0xE7,0x5E,0xFF,0xB6,0x5F,0xFF,0x9D,0x9F,0xFF,0x8D,0x5F,0xFF,0x7C,0xFF,0xFF,0x85,0x3F,0xFF,0x95,0x9F,0xFF,0xAE,0x1F,0xFF,0xAD,0x98,0xFF,0x21,0x25,0xFF,0x41,0x85,0xFF,0xE9,0x80,0xFF,0xF2,0x20,0xFF,0xFD,0xE2,0xFF,0x83,0xFE,0x82,0xFF,0x00,0xFE,0x22,0xFF,0x84,0xFD,0xC2,0xFF,0x00,0xE9,0xA0,0xFF,0x86,0xE9,0x80,0xFF,0x00,0xF1,0xE0,0xF8,0x83,0x00,0x00,0x00,0x00,0xFB,0x42,0x74,0x8B,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0x88,0xFF,0xFF,0xFF,0x00,0xF7,0x9F,0xFF,0x88,0xEF,0x7E,0xFF,0x02,0xB5,0xD7,0xFF,0x21,0x25,0xFF,0x41,0x85,0xFF,0x81,0xE9,0x80,0xFF,0x01,0xF2,0x20,0xFF,0xFD,0xC2,0xFF,0x83,0xFE,0x82,0xFF,0x00,0xFE,0x22,0xFF,0x83,0xFD,0xC2,0xFF,0x00,0xF3,0x00,0xFF,0x86,0xE9,0x80,0xFF,0x00,0xF2,0x21,0xB0,0x83,0x00,0x00,0x00,0x01,0xFB,0x02,0x0D,0xFB,0x42,0xEE,0x8A,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,
+    0x42,0x4A,0xFF,0x84,0x31,0xFF,0x88,0xFF,0xFF,0xFF,0x00,0xF7,0x9F,0xFF,0x88,0xEF,0x7E,0xFF,0x02,0xB5,0xD7,0xFF,0x21,0x25,0xFF,0x41,0x85,0xFF,0x82,0xE9,0x80,0xFF,0x01,0xF2,0x20,0xFF,0xFD,0xE2,0xFF,0x83,0xFE,0x82,0xFF,0x00,0xFE,0x22,0xFF,0x82,0xFD,0xC2,0xFF,0x00,0xF4,0x01,0xFF,0x85,0xE9,0x80,0xFF,0x01,0xF1,0xA0,0xFE,0xF2,0x81,0x19,0x84,0x00,0x00,0x00,0x00,0xFB,0x42,0x81,0x8A,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0x88,0xFF,0xFF,0xFF,0x00,0xF7,0x9F,0xFF,0x88,0xEF,0x7E,0xFF,0x02,0xB5,0xD7,0xFF,0x21,0x25,0xFF,0x41,0x85,0xFF,0x83,0xE9,0x80,0xFF,0x01,0xF2,0x20,0xFF,0xFD,0xE2,0xFF,0x83,0xFE,0x82,0xFF,0x00,0xFE,0x22,0xFF,0x81,0xFD,0xC2,0xFF,0x00,0xF2,0xE0,0xFF,0x85,0xE9,0x80,0xFF,0x00,0xF2,0x20,0xBF,0x85,0x00,0x00,0x00,0x01,0xFB,0x41,0x11,0xFB,0x42,0xEA,0x89,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0x88,0xFF,0xFF,0xFF,0x00,0xF7,0x9F,0xFF,0x88,0xEF,0x7E,0xFF,0x02,0xB5,0xD7,0xFF,0x21,0x25,0xFF,0x41,0x85,0xFF,
+    0x84,0xE9,0x80,0xFF,0x01,0xF2,0x20,0xFF,0xFD,0xE2,0xFF,0x83,0xFE,0x82,0xFF,0x02,0xFE,0x22,0xFF,0xFD,0xA2,0xFF,0xE9,0xA0,0xFF,0x84,0xE9,0x80,0xFF,0x01,0xF1,0xA0,0xFD,0xF2,0x61,0x1D,0x86,0x00,0x00,0x00,0x00,0xFB,0x42,0x62,0x89,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0x88,0xFF,0xFF,0xFF,0x00,0xF7,0x9F,0xFF,0x88,0xEF,0x7E,0xFF,0x02,0xB5,0xD7,0xFF,0x21,0x25,0xFF,0x41,0x85,0xFF,0x85,0xE9,0x80,0xFF,0x01,0xF2,0x20,0xFF,0xFD,0x62,0xFF,0x82,0xFE,0x82,0xFF,0x01,0xFD,0x42,0xFF,0xF2,0x40,0xFF,0x85,0xE9,0x80,0xFF,0x00,0xF2,0x41,0x99,0x87,0x00,0x00,0x00,0x01,0xF8,0x00,0x01,0xFB,0x42,0xC4,0x88,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x84,0x31,0xFF,0x88,0xFF,0xFF,0xFF,0x00,0xF7,0x9F,0xFF,0x88,0xEF,0x7E,0xFF,0x02,0xB5,0xD7,0xFF,0x21,0x25,0xFF,0x41,0x85,0xFF,0x86,0xE9,0x80,0xFF,0x03,0xE9,0xA0,0xFF,0xF2,0x60,0xFF,0xF3,0x00,0xFF,0xF2,0x60,0xFF,0x86,0xE9,0x80,0xFF,0x01,0xF1,0xE0,0xF0,0xF8,0x00,0x02,0x88,0x00,0x00,0x00,0x01,0xFB,0x62,
+    0x23,0xFB,0x42,0xF0,0x87,0xFB,0x42,0xFF,0x02,0x9A,0xC6,0xFF,0x42,0x4A,0xFF,0x7C,0x11,0xFF,0x88,0xFF,0xDF,0xFF,0x00,0xEF,0x9E,0xFF,0x88,0xEF,0x7E,0xFF,0x02,0xB5,0x97,0xFF,0x21,0x25,0xFF,0x41,0x85,0xFF,0x90,0xE9,0x80,0xFF,0x01,0xF1,0xA0,0xFE,0xF2,0x41,0x3D,0x8A,0x00,0x00,0x00,0x00,0xFB,0x42,0x54,0x87,0xFB,0x42,0xFF,0x00,0xA2,0xC6,0xFF,0x8A,0x42,0x4A,0xFF,0x00,0x29,0x86,0xFF,0x8A,0x21,0x25,0xFF,0x00,0x49,0x85,0xFF,0x90,0xE9,0x80,0xFF,0x00,0xF2,0x41,0x8E,0x8C,0x00,0x00,0x00,0x00,0xFB,0x42,0x8D,0x86,0xFB,0x42,0xFF,0x00,0xC3,0x05,0xFF,0x8A,0x42,0x4A,0xFF,0x00,0x29,0x86,0xFF,0x8A,0x21,0x25,0xFF,0x00,0x69,0x84,0xFF,0x8F,0xE9,0x80,0xFF,0x00,0xF2,0x21,0xC6,0x8D,0x00,0x00,0x00,0x01,0xF8,0x00,0x01,0xFB,0x42,0x9F,0x86,0xFB,0x42,0xFF,0x00,0x72,0x47,0xFF,0x89,0x42,0x4A,0xFF,0x00,0x29,0x86,0xFF,0x89,0x21,0x25,0xFF,0x01,0x29,0x65,0xFF,0xE1,0x80,0xFF,0x8E,0xE9,0x80,0xFF,0x01,0xF2,0x00,0xE0,0xFA,0xA0,0x03,0x8E,0x00,0x00,0x00,0x01,0xFB,0x20,0x05,0xFB,0x42,0xB5,0x85,
+    0xFB,0x42,0xFF,0x02,0xFB,0x22,0xFF,0xAA,0x24,0xFF,0x82,0x06,0xFF,0x87,0x7A,0x06,0xFF,0x00,0x51,0xA6,0xFF,0x88,0x41,0x85,0xFF,0x01,0x69,0x84,0xFF,0xE1,0x80,0xFF,0x8E,0xE9,0x80,0xFF,0x01,0xF2,0x00,0xE8,0xFA,0x00,0x0C,0x90,0x00,0x00,0x00,0x01,0xFC,0x00,0x04,0xFB,0x42,0x9D,0x85,0xFB,0x42,0xFF,0x01,0xFB,0x22,0xFF,0xF2,0x00,0xFF,0xA1,0xE9,0x80,0xFF,0x01,0xF2,0x00,0xE0,0xFA,0x60,0x0A,0x92,0x00,0x00,0x00,0x01,0xF8,0x00,0x01,0xFB,0x42,0x8B,0x85,0xFB,0x42,0xFF,0x01,0xFB,0x22,0xFF,0xF2,0x00,0xFF,0x9F,0xE9,0x80,0xFF,0x01,0xF2,0x21,0xC8,0xF8,0x00,0x03,0x95,0x00,0x00,0x00,0x01,0xFB,0x42,0x50,0xFB,0x42,0xEE,0x85,0xFB,0x42,0xFF,0x00,0xF2,0x00,0xFF,0x9C,0xE9,0x80,0xFF,0x01,0xF1,0xA0,0xFE,0xF2,0x41,0x8F,0x98,0x00,0x00,0x00,0x01,0xFB,0x42,0x22,0xFB,0x42,0xC2,0x84,0xFB,0x42,0xFF,0x01,0xFB,0x22,0xFF,0xF2,0x00,0xFF,0x9A,0xE9,0x80,0xFF,0x01,0xF1,0xE0,0xF1,0xF2,0x61,0x3F,0x9A,0x00,0x00,0x00,0x02,0xF8,0x00,0x01,0xFB,0x42,0x5E,0xFB,0x42,0xE9,0x84,0xFB,0x42,0xFF,0x00,0xF2,
+    0x00,0xFF,0x97,0xE9,0x80,0xFF,0x02,0xF1,0xA0,0xFD,0xF2,0x41,0xA2,0xF8,0x00,0x02,0x9D,0x00,0x00,0x00,0x02,0xFB,0x82,0x10,0xFB,0x42,0x7E,0xFB,0x42,0xED,0x83,0xFB,0x42,0xFF,0x00,0xF2,0x00,0xFF,0x94,0xE9,0x80,0xFF,0x02,0xF1,0xA0,0xFE,0xF2,0x20,0xBF,0xF2,0x61,0x1A,0xA1,0x00,0x00,0x00,0x02,0xFB,0x42,0x0C,0xFB,0x42,0x72,0xFB,0x42,0xD4,0x82,0xFB,0x42,0xFF,0x00,0xF2,0x00,0xFF,0x91,0xE9,0x80,0xFF,0x02,0xF1,0xC0,0xF8,0xF2,0x41,0xAE,0xF2,0x61,0x17,0xA6,0x00,0x00,0x00,0x04,0xFB,0x42,0x31,0xFB,0x42,0x8B,0xFB,0x42,0xD0,0xFB,0x42,0xFD,0xF2,0x00,0xFF,0x8D,0xE9,0x80,0xFF,0x02,0xF1,0xC0,0xF7,0xF2,0x21,0xC8,0xF2,0x41,0x59,0xAC,0x00,0x00,0x00,0x06,0xFB,0x23,0x14,0xFB,0x02,0x5B,0xF2,0x20,0xBE,0xF2,0x00,0xE0,0xF1,0xE0,0xF4,0xF1,0xC0,0xFB,0xF1,0xA0,0xFE,0x81,0xE9,0xA0,0xFF,0x06,0xF1,0xA0,0xFE,0xF1,0xC0,0xFB,0xF1,0xE0,0xF4,0xF2,0x00,0xDF,0xF2,0x20,0xBE,0xF2,0x41,0x87,0xFA,0x41,0x26,0x97,0x00,0x00,0x00,
     };
 const lv_img_dsc_t ui_img_search_png = {
    .header.always_zero = 0,
    .header.w = 64,
    .header.h = 64,
    .data_size = sizeof(ui_img_search_png_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+   .header.cf = LV_IMG_CF_USER_ENCODED_1,
    .data = ui_img_search_png_data};
 
@@ -10,77 +10,30 @@
 #endif
 
 // IMAGE DATA: assets\setting.png
+// Run length encoded LV_IMG_CF_TRUE_COLOR_ALPHA, decoded by src/img_cache.cpp
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_setting_png_data[] = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0x08,0x0E,0x3E,0x40,0x0E,0x5E,0x78,0x0E,0x3E,0x9E,0x0E,0x5E,0xC6,0x0E,0x3E,0xDE,0x0E,0x3E,0xEE,0x0E,0x3E,0xFA,0x0E,0x3E,0xFA,0x0E,0x3E,0xEE,0x0E,0x3E,0xDE,0x0E,0x5E,0xC6,0x0E,0x3E,0x9E,0x0E,0x5E,0x78,0x0E,0x3E,0x3F,0x05,0xBF,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x16,0x5F,0x0E,0x0E,0x3E,0x62,0x0E,0x3E,0xBB,0x0E,0x3E,0xF6,0x0E,0x3E,0xFF,0x0E,0x3E,0xFF,0x0E,0x3E,0xFF,0x0E,0x3E,0xFF,0x0E,0x3E,0xFF,0x0E,0x3E,0xFF,0x0E,0x3E,0xFF,0x0E,0x3E,0xFF,0x0E,0x3E,0xFF,0x0E,0x3E,0xFF,0x0E,0x3E,0xFF,0x0E,0x3E,0xFF,0x0E,0x3E,0xFF,0x0E,0x3E,0xFF,0x0E,0x3E,0xF6,0x0E,0x3E,0xBA,0x0E,0x3E,0x61,0x16,0x5F,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x3F,0x27,0x0E,0x1E,0x9E,0x0E,0x3E,0xF6,0x0E,0x3E,0xFF,0x0E,0x3E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xF6,0x0E,0x1E,0x9D,0x0E,0x3F,0x27,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x1F,0x22,0x0E,0x1E,0xA9,0x0E,0x1E,0xFD,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFD,0x0E,0x1E,0xA7,0x0E,0x1E,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xBF,0x07,0x0D,0xFE,0x7C,0x0E,0x1E,0xF6,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0E,0x1E,0xFF,0x0D,0xFE,0xF6,0x0D,0xFE,0x7B,0x05,0xBF,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0xFE,0x20,0x0D,0xFE,0xC8,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xFF,0x0D,0xFE,0xCE,0x0D,0xFF,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0D,0xFE,0x54,0x15,0xFE,0xF2,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xFF,0x15,0xFE,0xF1,0x15,0xDE,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0xDF,0x6B,0x15,0xDE,0xFD,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFE,0x15,0xDE,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0xDE,0x7E,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xDE,0xFF,0x15,0xBE,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0xBF,0x6A,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBF,0x6F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0xBE,0x54,0x15,0xBE,0xFD,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFF,0x15,0xBE,0xFD,0x15,0x9E,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x9F,0x24,0x15,0x9E,0xF1,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xF3,0x15,0x9F,0x27,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xBF,0x07,0x1D,0x9F,0xCE,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x46,0x1F,0xFF,0xCF,0x7F,0xFF,0xE7,0xBF,0xFF,0xF7,0xFF,0xFF,0xF7,0xFF,0xFF,0xE7,0xBF,0xFF,0xCF,0x7F,0xFF,0x45,0xFF,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9E,0xFF,0x15,0x9F,0xCD,0x2D,0x5F,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1D,0x7E,0x7D,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0xB7,0x3F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB7,0x3F,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x15,0x7E,0x79,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1D,0x7E,0x1F,0x1D,0x7E,0xF4,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x35,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3D,0xDF,0xFF,0x1D,0x7E,0xFF,0x25,0x9E,0xFF,0x3D,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x2D,0xBF,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xF6,0x15,0x5E,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1D,0x7E,0xA9,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x7E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x8E,0xBF,0xFF,0xFF,0xFF,0xFF,0xB7,0x3F,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0xB7,0x3F,0xFF,0xFF,0xFF,0xFF,0x8E,0xBF,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x7E,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1D,0x5F,0x27,0x1D,0x5E,0xFD,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x5E,0x1F,0xFF,0xC7,0x5F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5E,0x1F,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x5E,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC7,0x5F,0xFF,0x5E,0x1F,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFC,0x1D,0x5F,0x26,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1D,0x5E,0x9E,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5E,0xFF,0x1D,0x5F,0xFF,0x1D,0x5F,0xFF,0x1D,0x5F,0xFF,0x1D,0x5F,0xFF,0x2D,0x7F,0xFF,0xBF,0x3F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0x9E,0xDF,0xFF,0x1D,0x5F,0xFF,0x1D,0x5F,0xFF,0x1D,0x5F,0xFF,0x1D,0x5F,0xFF,0x1D,0x5F,0xFF,0x1D,0x5F,0xFF,0x9E,0xDF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB7,0x1F,0xFF,0x2D,0x7F,0xFF,0x1D,0x5F,0xFF,0x1D,0x5F,0xFF,0x1D,0x5F,0xFF,0x1D,0x5F,0xFF,0x1D,0x5F,0xFF,0x1D,0x5F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x3F,0x0E,0x1D,0x3F,0xF5,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x6E,0x3F,0xFF,0xFF,0xFF,0xFF,0xEF,0xDF,0xFF,0xCF,0x5F,0xFF,0xAE,0xFF,0xFF,0xEF,0xBF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0x86,0x7F,0xFF,0x2D,0x7F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x2D,0x7F,0xFF,0x86,0x9F,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xEF,0xBF,0xFF,0xAE,0xFF,0xFF,0xCF,0x5F,0xFF,0xEF,0xDF,0xFF,0xFF,0xFF,0xFF,0x6E,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xF5,0x24,0xFF,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1D,0x3E,0x63,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x35,0x7F,0xFF,0xEF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0x7F,0xFF,0x3D,0x9F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x3D,0x7F,0xFF,0xCF,0x5F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0x3D,0x7F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x1D,0x3F,0xFF,0x25,0x3E,0x5F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1D,0x3F,0xBB,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0xBF,0x1F,0xFF,0xFF,0xFF,0xFF,0xB7,0x1F,0xFF,0x35,0x5F,0xFF,0x55,0xDF,0xFF,0x76,0x3F,0xFF,0x76,0x3F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x4D,0xBF,0xFF,0x65,0xFF,0xFF,0x65,0xFF,0xFF,0x4D,0xBF,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x3F,0xFF,0x7E,0x3F,0xFF,0x76,0x3F,0xFF,0x55,0xDF,0xFF,0x35,0x5F,0xFF,0xB7,0x1F,0xFF,0xFF,0xFF,0xFF,0xBF,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xB7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x9F,0x07,0x25,0x1F,0xF6,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x4D,0xBF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0x35,0x5F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x35,0x5F,0xFF,0xA6,0xBF,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xDF,0xFF,0x9E,0xBF,0xFF,0x35,0x3F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x35,0x5F,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0x4D,0x9F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xFF,0x25,0x1F,0xF5,0x24,0x9F,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x1E,0x41,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0xBF,0x1F,0xFF,0xFF,0xFF,0xFF,0x96,0x9F,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x65,0xDF,0xFF,0xEF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x9F,0xFF,0xC7,0x3F,0xFF,0xBF,0x1F,0xFF,0xEF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xDF,0xFF,0x5D,0xBF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x96,0x7F,0xFF,0xFF,0xFF,0xFF,0xBF,0x1F,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFE,0x3D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xFF,0x78,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0xDF,0x7F,0xFF,0xFF,0xFF,0xFF,0x9E,0x9F,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x65,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCF,0x3F,0xFF,0x55,0x9F,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x55,0x9F,0xFF,0xCF,0x5F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xBF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x9E,0x9F,0xFF,0xFF,0xFF,0xFF,0xDF,0x7F,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0xFF,0x24,0xFF,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xFF,0x9F,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x55,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6D,0xFF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x3D,0x3F,0xFF,0xEF,0xDF,0xFF,0xFF,0xFF,0xFF,0xA6,0xBF,0xFF,0x2C,0xFF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0xA6,0xBF,0xFF,0xFF,0xFF,0xFF,0xEF,0xDF,0xFF,0x35,0x1F,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x6D,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0x9F,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xDF,0xC6,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x86,0x3F,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0x45,0x3F,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0xA6,0x9F,0xFF,0xFF,0xFF,0xFF,0xCF,0x3F,0xFF,0x2C,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x2C,0xDF,0xFF,0xC7,0x3F,0xFF,0xFF,0xFF,0xFF,0x9E,0x9F,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x45,0x3F,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0x86,0x3F,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xFF,0x24,0xDF,0xC3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0xDF,0xE1,0x24,0xDF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0xD7,0x5F,0xFF,0xFF,0xFF,0xFF,0x75,0xDF,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x2C,0xDF,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0x55,0x7F,0xFF,0x24,0xBF,0xFF,0x24,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x55,0x7F,0xFF,0xFF,0xFF,0xFF,0xEF,0xBF,0xFF,0x2C,0xDF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x75,0xDF,0xFF,0xFF,0xFF,0xFF,0xD7,0x5F,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0xBE,0xED,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0xD7,0x5F,0xFF,0xFF,0xFF,0xFF,0x5D,0x7F,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x55,0x5F,0xFF,0xFF,0xFF,0xFF,0xE7,0x9F,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0xE7,0x9F,0xFF,0xFF,0xFF,0xFF,0x55,0x5F,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x5D,0x9F,0xFF,0xFF,0xFF,0xFF,0xD7,0x5F,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xEB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0xBF,0xF9,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0xE7,0x9F,0xFF,0xFF,0xFF,0xFF,0x45,0x1F,0xFF,0x2C,0xBF,0xFF,0x2C,0xBF,0xFF,0x6D,0xBF,0xFF,0xFF,0xFF,0xFF,0xC7,0x1F,0xFF,0x2C,0xBF,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0xC7,0x1F,0xFF,0xFF,0xFF,0xFF,0x6D,0xBF,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x4D,0x1F,0xFF,0xFF,0xFF,0xFF,0xE7,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x9F,0xF9,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0xE7,0x9F,0xFF,0xFF,0xFF,0xFF,0x45,0x1F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x75,0xBF,0xFF,0xFF,0xFF,0xFF,0xC6,0xFF,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0x6D,0xBF,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x4D,0x1F,0xFF,0xFF,0xFF,0xFF,0xE7,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x9F,0xED,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0xD7,0x3F,0xFF,0xFF,0xFF,0xFF,0x5D,0x5F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x55,0x3F,0xFF,0xFF,0xFF,0xFF,0xEF,0xBF,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0xE7,0x7F,0xFF,0xFF,0xFF,0xFF,0x55,0x3F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x65,0x7F,0xFF,0xFF,0xFF,0xFF,0xD7,0x3F,0xFF,0x2C,0x9F,0xFF,0x2C,0x9F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xEB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x7F,0xE0,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0xD7,0x3F,0xFF,0xFF,0xFF,0xFF,0x75,0xBF,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x34,0x9F,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0x5D,0x3F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x55,0x3F,0xFF,0xFF,0xFF,0xFF,0xF7,0xBF,0xFF,0x34,0x9F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x75,0xBF,0xFF,0xFF,0xFF,0xFF,0xD7,0x3F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xDE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2C,0x7F,0xC6,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x85,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0x4C,0xDF,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0xA6,0x7F,0xFF,0xFF,0xFF,0xFF,0xCF,0x3F,0xFF,0x34,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x34,0x7F,0xFF,0xCF,0x1F,0xFF,0xFF,0xFF,0xFF,0xA6,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x4C,0xFF,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0x85,0xFF,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xFF,0x2C,0x7F,0xC3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x7F,0x9F,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x5D,0x3F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x75,0x9F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x44,0xBF,0xFF,0xF7,0xBF,0xFF,0xFF,0xFF,0xFF,0xAE,0x9F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0xA6,0x7F,0xFF,0xFF,0xFF,0xFF,0xF7,0xBF,0xFF,0x44,0x9F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x75,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x65,0x3F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x2C,0x5F,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x5F,0x77,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0xDF,0x5F,0xFF,0xFF,0xFF,0xFF,0xA6,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x6D,0x5F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCF,0x1F,0xFF,0x65,0x3F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x5C,0xFF,0xFF,0xCF,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6D,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0xA6,0x5F,0xFF,0xFF,0xFF,0xFF,0xDF,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x5F,0xFF,0x34,0x3F,0x75,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x3E,0x40,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0xBE,0xDF,0xFF,0xFF,0xFF,0xFF,0x9E,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x6D,0x3F,0xFF,0xF7,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x9F,0xFF,0xC6,0xFF,0xFF,0xC6,0xDF,0xFF,0xE7,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xBF,0xFF,0x6D,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x9E,0x3F,0xFF,0xFF,0xFF,0xFF,0xBE,0xDF,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0x3D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x9F,0x07,0x34,0x3F,0xF6,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x5C,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0x44,0x9F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x44,0x7F,0xFF,0xA6,0x5F,0xFF,0xF7,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBF,0xFF,0xA6,0x5F,0xFF,0x44,0x7F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x44,0x7F,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0x5C,0xFF,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xFF,0x34,0x3F,0xF5,0x24,0x9F,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x3F,0xBA,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0xC6,0xDF,0xFF,0xFF,0xFF,0xFF,0xBE,0xBF,0xFF,0x4C,0x9F,0xFF,0x6D,0x1F,0xFF,0x85,0xBF,0xFF,0x85,0xBF,0xFF,0x3C,0x3F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x3F,0xFF,0x5C,0xDF,0xFF,0x75,0x5F,0xFF,0x75,0x5F,0xFF,0x5C,0xDF,0xFF,0x3C,0x3F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x3C,0x3F,0xFF,0x85,0xBF,0xFF,0x85,0xBF,0xFF,0x6D,0x1F,0xFF,0x4C,0x9F,0xFF,0xBE,0xBF,0xFF,0xFF,0xFF,0xFF,0xC6,0xDF,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xB6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x1F,0x62,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x4C,0x7F,0xFF,0xF7,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0x3F,0xFF,0x54,0x9F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x4C,0x9F,0xFF,0xD7,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBF,0xFF,0x4C,0x7F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0xFF,0x34,0x1F,0x5E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x1F,0x0E,0x34,0x1F,0xF5,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x7D,0x5F,0xFF,0xFF,0xFF,0xFF,0xEF,0xBF,0xFF,0xD7,0x1F,0xFF,0xB6,0x9F,0xFF,0xEF,0x9F,0xFF,0xFF,0xFF,0xFF,0xF7,0xBF,0xFF,0x95,0xFF,0xFF,0x44,0x5F,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x44,0x5F,0xFF,0x95,0xFF,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xEF,0x9F,0xFF,0xB6,0x9F,0xFF,0xD7,0x1F,0xFF,0xEF,0xBF,0xFF,0xFF,0xFF,0xFF,0x7D,0x5F,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x33,0xFF,0xFF,0x34,0x1F,0xF4,0x44,0x1F,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3B,0xFF,0x9E,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x44,0x3F,0xFF,0xC6,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xAE,0x3F,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0xAE,0x3F,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xBF,0xFF,0x44,0x3F,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0x9C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x1F,0x24,0x3B,0xFF,0xFC,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x3B,0xFF,0xFF,0x6D,0x1F,0xFF,0xCE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x75,0x1F,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x75,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCE,0xFF,0xFF,0x6C,0xFF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFC,0x3B,0xDF,0x26,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3B,0xDF,0xA8,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x9D,0xDF,0xFF,0xFF,0xFF,0xFF,0xC6,0xBF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0xC6,0xBF,0xFF,0xFF,0xFF,0xFF,0x9D,0xFF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xA4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3B,0xBE,0x1E,0x3B,0xDF,0xF4,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x4C,0x3F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0x7F,0xFF,0x43,0xFF,0xFF,0x43,0xFF,0xFF,0x5C,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4C,0x3F,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xDF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xF5,0x43,0xDE,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3B,0xBF,0x7C,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0xC6,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC6,0x9F,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4B,0x7F,0x07,0x3B,0xBF,0xCD,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x64,0x7F,0xFF,0xD7,0x1F,0xFF,0xEF,0x7F,0xFF,0xF7,0xDF,0xFF,0xF7,0xDF,0xFF,0xEF,0x7F,0xFF,0xD7,0x1F,0xFF,0x64,0x7F,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xFF,0x3B,0xBF,0xCC,0x2C,0x1F,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0xBF,0x23,0x3B,0x9F,0xF0,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x3B,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xF2,0x43,0x9F,0x26,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x9F,0x52,0x3B,0x9F,0xFD,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFF,0x43,0x9F,0xFC,0x43,0x9F,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x7F,0x68,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0x6E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x7F,0x7C,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0xFF,0x43,0x7F,0x7B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x5F,0x6A,0x43,0x5F,0xFD,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFC,0x43,0x5F,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0x5F,0x51,0x43,0x5F,0xF1,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xFF,0x43,0x5F,0xF0,0x43,0x5F,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4B,0x5F,0x1F,0x43,0x3F,0xC7,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xFF,0x43,0x3F,0xCD,0x43,0x5F,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xBF,0x06,0x43,0x3F,0x7A,0x4B,0x3F,0xF5,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xF5,0x4B,0x3F,0x79,0x52,0xBF,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4B,0x1F,0x1F,0x4B,0x3F,0xA5,0x4B,0x3F,0xFC,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x3F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFC,0x4B,0x3F,0xA4,0x4B,0x3F,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4B,0x1F,0x25,0x4B,0x1F,0x9C,0x4B,0x1F,0xF4,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xF4,0x4B,0x1F,0x9C,0x43,0x1F,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4B,0x1F,0x0D,0x4B,0x1F,0x5F,0x4B,0x1F,0xB7,0x4B,0x1F,0xF5,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xFF,0x4B,0x1F,0xF4,0x4B,0x1F,0xB6,0x4A,0xFF,0x5E,0x53,0x5F,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xBF,0x06,0x4A,0xFF,0x3D,0x4A,0xFF,0x76,0x4A,0xFF,0x9C,0x4A,0xFF,0xC4,0x4A,0xFF,0xDD,0x4A,0xFF,0xED,0x4A,0xFF,0xF9,0x4A,0xFF,0xF9,0x4A,0xFF,0xED,0x4A,0xFF,0xDD,0x4A,0xFF,0xC3,0x4A,0xFF,0x9C,0x4A,0xFF,0x76,0x4A,0xFF,0x3D,0x52,0xBF,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xFF,0x00,0x00,0x00,0xD7,0x00,0x00,0x00,0x06,0x05,0xFF,0x08,0x0E,0x3E,0x40,0x0E,0x5E,0x78,0x0E,0x3E,0x9E,0x0E,0x5E,0xC6,0x0E,0x3E,0xDE,0x0E,0x3E,0xEE,0x81,0x0E,0x3E,0xFA,0x06,0x0E,0x3E,0xEE,0x0E,0x3E,0xDE,0x0E,0x5E,0xC6,0x0E,0x3E,0x9E,0x0E,0x5E,0x78,0x0E,0x3E,0x3F,0x05,0xBF,0x07,0xAC,0x00,0x00,0x00,0x03,0x16,0x5F,0x0E,0x0E,0x3E,0x62,0x0E,0x3E,0xBB,0x0E,0x3E,0xF6,0x8D,0x0E,0x3E,0xFF,0x03,0x0E,0x3E,0xF6,0x0E,0x3E,0xBA,0x0E,0x3E,0x61,0x16,0x5F,0x0E,0xA7,0x00,0x00,0x00,0x02,0x0E,0x3F,0x27,0x0E,0x1E,0x9E,0x0E,0x3E,0xF6,0x81,0x0E,0x3E,0xFF,0x91,0x0E,0x1E,0xFF,0x02,0x0E,0x1E,0xF6,0x0E,0x1E,0x9D,0x0E,0x3F,0x27,0xA3,0x00,0x00,0x00,0x02,0x0E,0x1F,0x22,0x0E,0x1E,0xA9,0x0E,0x1E,0xFD,0x97,0x0E,0x1E,0xFF,0x02,0x0E,0x1E,0xFD,0x0E,0x1E,0xA7,0x0E,0x1E,0x21,0x9F,0x00,0x00,0x00,0x02,0x05,0xBF,0x07,0x0D,0xFE,0x7C,0x0E,0x1E,0xF6,0x9B,0x0E,0x1E,0xFF,0x02,0x0D,0xFE,0xF6,0x0D,0xFE,0x7B,0x05,0xBF,0x07,0x9C,0x00,0x00,0x00,0x01,0x15,0xFE,0x20,0x0D,0xFE,0xC8,0x9F,0x0D,0xFE,
+    0xFF,0x01,0x0D,0xFE,0xCE,0x0D,0xFF,0x24,0x9A,0x00,0x00,0x00,0x01,0x0D,0xFE,0x54,0x15,0xFE,0xF2,0xA1,0x15,0xFE,0xFF,0x01,0x15,0xFE,0xF1,0x15,0xDE,0x52,0x98,0x00,0x00,0x00,0x01,0x15,0xDF,0x6B,0x15,0xDE,0xFD,0xA3,0x15,0xDE,0xFF,0x01,0x15,0xDE,0xFE,0x15,0xDE,0x72,0x96,0x00,0x00,0x00,0x00,0x15,0xDE,0x7E,0xA7,0x15,0xDE,0xFF,0x00,0x15,0xBE,0x7C,0x94,0x00,0x00,0x00,0x00,0x15,0xBF,0x6A,0xA9,0x15,0xBE,0xFF,0x00,0x15,0xBF,0x6F,0x92,0x00,0x00,0x00,0x01,0x15,0xBE,0x54,0x15,0xBE,0xFD,0xA9,0x15,0xBE,0xFF,0x01,0x15,0xBE,0xFD,0x15,0x9E,0x51,0x90,0x00,0x00,0x00,0x01,0x15,0x9F,0x24,0x15,0x9E,0xF1,0xAB,0x15,0x9E,0xFF,0x01,0x15,0x9E,0xF3,0x15,0x9F,0x27,0x8E,0x00,0x00,0x00,0x01,0x25,0xBF,0x07,0x1D,0x9F,0xCE,0x92,0x15,0x9E,0xFF,0x02,0x46,0x1F,0xFF,0xCF,0x7F,0xFF,0xE7,0xBF,0xFF,0x81,0xF7,0xFF,0xFF,0x02,0xE7,0xBF,0xFF,0xCF,0x7F,0xFF,0x45,0xFF,0xFF,0x92,0x15,0x9E,0xFF,0x01,0x15,0x9F,0xCD,0x2D,0x5F,0x06,0x8D,0x00,0x00,0x00,0x00,0x1D,0x7E,0x7D,0x93,0x1D,0x7E,0xFF,0x00,0xB7,
+    0x3F,0xFF,0x85,0xFF,0xFF,0xFF,0x00,0xB7,0x3F,0xFF,0x93,0x1D,0x7E,0xFF,0x00,0x15,0x7E,0x79,0x8C,0x00,0x00,0x00,0x01,0x1D,0x7E,0x1F,0x1D,0x7E,0xF4,0x92,0x1D,0x7E,0xFF,0x00,0x35,0xBF,0xFF,0x81,0xFF,0xFF,0xFF,0x03,0x3D,0xDF,0xFF,0x1D,0x7E,0xFF,0x25,0x9E,0xFF,0x3D,0xDF,0xFF,0x81,0xFF,0xFF,0xFF,0x00,0x2D,0xBF,0xFF,0x92,0x1D,0x7E,0xFF,0x01,0x1D,0x7E,0xF6,0x15,0x5E,0x21,0x8B,0x00,0x00,0x00,0x00,0x1D,0x7E,0xA9,0x91,0x1D,0x7E,0xFF,0x81,0x1D,0x5E,0xFF,0x02,0x8E,0xBF,0xFF,0xFF,0xFF,0xFF,0xB7,0x3F,0xFF,0x83,0x1D,0x5E,0xFF,0x02,0xB7,0x3F,0xFF,0xFF,0xFF,0xFF,0x8E,0xBF,0xFF,0x93,0x1D,0x5E,0xFF,0x00,0x1D,0x7E,0xA5,0x8A,0x00,0x00,0x00,0x01,0x1D,0x5F,0x27,0x1D,0x5E,0xFD,0x91,0x1D,0x5E,0xFF,0x01,0x5E,0x1F,0xFF,0xC7,0x5F,0xFF,0x81,0xFF,0xFF,0xFF,0x00,0x5E,0x1F,0xFF,0x83,0x1D,0x5E,0xFF,0x00,0x5E,0x1F,0xFF,0x81,0xFF,0xFF,0xFF,0x01,0xC7,0x5F,0xFF,0x5E,0x1F,0xFF,0x91,0x1D,0x5E,0xFF,0x01,0x1D,0x5E,0xFC,0x1D,0x5F,0x26,0x89,0x00,0x00,0x00,0x00,0x1D,0x5E,0x9E,0x8C,0x1D,0x5E,
+    0xFF,0x83,0x1D,0x5F,0xFF,0x01,0x2D,0x7F,0xFF,0xBF,0x3F,0xFF,0x81,0xFF,0xFF,0xFF,0x01,0xF7,0xDF,0xFF,0x9E,0xDF,0xFF,0x85,0x1D,0x5F,0xFF,0x01,0x9E,0xDF,0xFF,0xF7,0xFF,0xFF,0x81,0xFF,0xFF,0xFF,0x01,0xB7,0x1F,0xFF,0x2D,0x7F,0xFF,0x85,0x1D,0x5F,0xFF,0x8A,0x1D,0x3F,0xFF,0x00,0x1D,0x3F,0x9C,0x88,0x00,0x00,0x00,0x01,0x25,0x3F,0x0E,0x1D,0x3F,0xF5,0x8B,0x1D,0x3F,0xFF,0x09,0x6E,0x3F,0xFF,0xFF,0xFF,0xFF,0xEF,0xDF,0xFF,0xCF,0x5F,0xFF,0xAE,0xFF,0xFF,0xEF,0xBF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0x86,0x7F,0xFF,0x2D,0x7F,0xFF,0x87,0x1D,0x3F,0xFF,0x09,0x2D,0x7F,0xFF,0x86,0x9F,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xEF,0xBF,0xFF,0xAE,0xFF,0xFF,0xCF,0x5F,0xFF,0xEF,0xDF,0xFF,0xFF,0xFF,0xFF,0x6E,0x3F,0xFF,0x8B,0x1D,0x3F,0xFF,0x01,0x1D,0x3F,0xF5,0x24,0xFF,0x0D,0x87,0x00,0x00,0x00,0x00,0x1D,0x3E,0x63,0x8B,0x1D,0x3F,0xFF,0x01,0x35,0x7F,0xFF,0xEF,0xDF,0xFF,0x84,0xFF,0xFF,0xFF,0x01,0xD7,0x7F,0xFF,0x3D,0x9F,0xFF,0x8B,0x1D,0x3F,0xFF,0x01,0x3D,0x7F,0xFF,0xCF,0x5F,0xFF,0x84,0xFF,
+    0xFF,0xFF,0x01,0xF7,0xDF,0xFF,0x3D,0x7F,0xFF,0x8B,0x1D,0x3F,0xFF,0x00,0x25,0x3E,0x5F,0x87,0x00,0x00,0x00,0x00,0x1D,0x3F,0xBB,0x8B,0x25,0x1F,0xFF,0x04,0xBF,0x1F,0xFF,0xFF,0xFF,0xFF,0xB7,0x1F,0xFF,0x35,0x5F,0xFF,0x55,0xDF,0xFF,0x81,0x76,0x3F,0xFF,0x85,0x25,0x1F,0xFF,0x00,0x4D,0xBF,0xFF,0x81,0x65,0xFF,0xFF,0x00,0x4D,0xBF,0xFF,0x84,0x25,0x1F,0xFF,0x07,0x25,0x3F,0xFF,0x7E,0x3F,0xFF,0x76,0x3F,0xFF,0x55,0xDF,0xFF,0x35,0x5F,0xFF,0xB7,0x1F,0xFF,0xFF,0xFF,0xFF,0xBF,0x1F,0xFF,0x8B,0x25,0x1F,0xFF,0x00,0x25,0x1F,0xB7,0x86,0x00,0x00,0x00,0x01,0x24,0x9F,0x07,0x25,0x1F,0xF6,0x8A,0x25,0x1F,0xFF,0x03,0x4D,0xBF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0x35,0x5F,0xFF,0x86,0x25,0x1F,0xFF,0x02,0x35,0x5F,0xFF,0xA6,0xBF,0xFF,0xF7,0xDF,0xFF,0x83,0xFF,0xFF,0xFF,0x02,0xEF,0xDF,0xFF,0x9E,0xBF,0xFF,0x35,0x3F,0xFF,0x86,0x25,0x1F,0xFF,0x03,0x35,0x5F,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0x4D,0x9F,0xFF,0x8A,0x25,0x1F,0xFF,0x01,0x25,0x1F,0xF5,0x24,0x9F,0x07,0x85,0x00,0x00,0x00,0x00,0x25,
+    0x1E,0x41,0x8B,0x24,0xFF,0xFF,0x02,0xBF,0x1F,0xFF,0xFF,0xFF,0xFF,0x96,0x9F,0xFF,0x86,0x24,0xFF,0xFF,0x01,0x65,0xDF,0xFF,0xEF,0xDF,0xFF,0x81,0xFF,0xFF,0xFF,0x03,0xE7,0x9F,0xFF,0xC7,0x3F,0xFF,0xBF,0x1F,0xFF,0xEF,0xBF,0xFF,0x81,0xFF,0xFF,0xFF,0x01,0xEF,0xDF,0xFF,0x5D,0xBF,0xFF,0x86,0x24,0xFF,0xFF,0x02,0x96,0x7F,0xFF,0xFF,0xFF,0xFF,0xBF,0x1F,0xFF,0x8B,0x24,0xFF,0xFF,0x00,0x24,0xFE,0x3D,0x85,0x00,0x00,0x00,0x00,0x24,0xFF,0x78,0x8B,0x24,0xFF,0xFF,0x02,0xDF,0x7F,0xFF,0xFF,0xFF,0xFF,0x9E,0x9F,0xFF,0x85,0x24,0xFF,0xFF,0x00,0x65,0xDF,0xFF,0x81,0xFF,0xFF,0xFF,0x01,0xCF,0x3F,0xFF,0x55,0x9F,0xFF,0x83,0x24,0xFF,0xFF,0x01,0x55,0x9F,0xFF,0xCF,0x5F,0xFF,0x81,0xFF,0xFF,0xFF,0x00,0x5D,0xBF,0xFF,0x85,0x24,0xFF,0xFF,0x02,0x9E,0x9F,0xFF,0xFF,0xFF,0xFF,0xDF,0x7F,0xFF,0x8B,0x24,0xFF,0xFF,0x00,0x24,0xFF,0x76,0x85,0x00,0x00,0x00,0x00,0x24,0xFF,0x9F,0x8B,0x24,0xDF,0xFF,0x00,0x55,0x9F,0xFF,0x81,0xFF,0xFF,0xFF,0x00,0x6D,0xFF,0xFF,0x83,0x24,0xDF,0xFF,0x04,0x3D,0x3F,0xFF,0xEF,
+    0xDF,0xFF,0xFF,0xFF,0xFF,0xA6,0xBF,0xFF,0x2C,0xFF,0xFF,0x86,0x24,0xDF,0xFF,0x03,0xA6,0xBF,0xFF,0xFF,0xFF,0xFF,0xEF,0xDF,0xFF,0x35,0x1F,0xFF,0x83,0x24,0xDF,0xFF,0x00,0x6D,0xDF,0xFF,0x81,0xFF,0xFF,0xFF,0x00,0x5D,0x9F,0xFF,0x8B,0x24,0xDF,0xFF,0x00,0x24,0xDF,0x9C,0x85,0x00,0x00,0x00,0x00,0x24,0xDF,0xC6,0x8C,0x24,0xDF,0xFF,0x03,0x86,0x3F,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0x45,0x3F,0xFF,0x82,0x24,0xDF,0xFF,0x03,0xA6,0x9F,0xFF,0xFF,0xFF,0xFF,0xCF,0x3F,0xFF,0x2C,0xDF,0xFF,0x87,0x24,0xDF,0xFF,0x03,0x2C,0xDF,0xFF,0xC7,0x3F,0xFF,0xFF,0xFF,0xFF,0x9E,0x9F,0xFF,0x82,0x24,0xDF,0xFF,0x03,0x45,0x3F,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0x86,0x3F,0xFF,0x8C,0x24,0xDF,0xFF,0x00,0x24,0xDF,0xC3,0x85,0x00,0x00,0x00,0x01,0x24,0xDF,0xE1,0x24,0xDF,0xFF,0x8C,0x24,0xBF,0xFF,0x02,0xD7,0x5F,0xFF,0xFF,0xFF,0xFF,0x75,0xDF,0xFF,0x81,0x24,0xBF,0xFF,0x03,0x2C,0xDF,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0x55,0x7F,0xFF,0x81,0x24,0xBF,0xFF,0x87,0x2C,0xBF,0xFF,0x03,0x55,0x7F,0xFF,0xFF,0xFF,
+    0xFF,0xEF,0xBF,0xFF,0x2C,0xDF,0xFF,0x81,0x2C,0xBF,0xFF,0x02,0x75,0xDF,0xFF,0xFF,0xFF,0xFF,0xD7,0x5F,0xFF,0x8D,0x2C,0xBF,0xFF,0x00,0x2C,0xBF,0xDE,0x85,0x00,0x00,0x00,0x00,0x2C,0xBE,0xED,0x8D,0x2C,0xBF,0xFF,0x02,0xD7,0x5F,0xFF,0xFF,0xFF,0xFF,0x5D,0x7F,0xFF,0x81,0x2C,0xBF,0xFF,0x02,0x55,0x5F,0xFF,0xFF,0xFF,0xFF,0xE7,0x9F,0xFF,0x8B,0x2C,0xBF,0xFF,0x02,0xE7,0x9F,0xFF,0xFF,0xFF,0xFF,0x55,0x5F,0xFF,0x81,0x2C,0xBF,0xFF,0x02,0x5D,0x9F,0xFF,0xFF,0xFF,0xFF,0xD7,0x5F,0xFF,0x8D,0x2C,0xBF,0xFF,0x00,0x2C,0xBF,0xEB,0x85,0x00,0x00,0x00,0x00,0x2C,0xBF,0xF9,0x8D,0x2C,0xBF,0xFF,0x02,0xE7,0x9F,0xFF,0xFF,0xFF,0xFF,0x45,0x1F,0xFF,0x81,0x2C,0xBF,0xFF,0x03,0x6D,0xBF,0xFF,0xFF,0xFF,0xFF,0xC7,0x1F,0xFF,0x2C,0xBF,0xFF,0x8A,0x2C,0x9F,0xFF,0x02,0xC7,0x1F,0xFF,0xFF,0xFF,0xFF,0x6D,0xBF,0xFF,0x81,0x2C,0x9F,0xFF,0x02,0x4D,0x1F,0xFF,0xFF,0xFF,0xFF,0xE7,0x9F,0xFF,0x8D,0x2C,0x9F,0xFF,0x00,0x2C,0x9F,0xF8,0x85,0x00,0x00,0x00,0x00,0x2C,0x9F,0xF9,0x8D,0x2C,0x9F,0xFF,0x02,0xE7,0x9F,0xFF,
+    0xFF,0xFF,0xFF,0x45,0x1F,0xFF,0x81,0x2C,0x9F,0xFF,0x02,0x75,0xBF,0xFF,0xFF,0xFF,0xFF,0xC6,0xFF,0xFF,0x8B,0x2C,0x9F,0xFF,0x02,0xC6,0xFF,0xFF,0xFF,0xFF,0xFF,0x6D,0xBF,0xFF,0x81,0x2C,0x9F,0xFF,0x02,0x4D,0x1F,0xFF,0xFF,0xFF,0xFF,0xE7,0x9F,0xFF,0x8D,0x2C,0x9F,0xFF,0x00,0x2C,0x9F,0xF8,0x85,0x00,0x00,0x00,0x00,0x2C,0x9F,0xED,0x8D,0x2C,0x9F,0xFF,0x02,0xD7,0x3F,0xFF,0xFF,0xFF,0xFF,0x5D,0x5F,0xFF,0x81,0x2C,0x9F,0xFF,0x02,0x55,0x3F,0xFF,0xFF,0xFF,0xFF,0xEF,0xBF,0xFF,0x8B,0x2C,0x9F,0xFF,0x02,0xE7,0x7F,0xFF,0xFF,0xFF,0xFF,0x55,0x3F,0xFF,0x81,0x2C,0x9F,0xFF,0x02,0x65,0x7F,0xFF,0xFF,0xFF,0xFF,0xD7,0x3F,0xFF,0x81,0x2C,0x9F,0xFF,0x8B,0x2C,0x7F,0xFF,0x00,0x2C,0x7F,0xEB,0x85,0x00,0x00,0x00,0x00,0x2C,0x7F,0xE0,0x8D,0x2C,0x7F,0xFF,0x02,0xD7,0x3F,0xFF,0xFF,0xFF,0xFF,0x75,0xBF,0xFF,0x81,0x2C,0x7F,0xFF,0x03,0x34,0x9F,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0x5D,0x3F,0xFF,0x89,0x2C,0x7F,0xFF,0x03,0x55,0x3F,0xFF,0xFF,0xFF,0xFF,0xF7,0xBF,0xFF,0x34,0x9F,0xFF,0x81,0x2C,0x7F,0xFF,
+    0x02,0x75,0xBF,0xFF,0xFF,0xFF,0xFF,0xD7,0x3F,0xFF,0x8D,0x2C,0x7F,0xFF,0x00,0x2C,0x7F,0xDE,0x85,0x00,0x00,0x00,0x00,0x2C,0x7F,0xC6,0x8C,0x2C,0x7F,0xFF,0x03,0x85,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0x4C,0xDF,0xFF,0x82,0x2C,0x7F,0xFF,0x03,0xA6,0x7F,0xFF,0xFF,0xFF,0xFF,0xCF,0x3F,0xFF,0x34,0x7F,0xFF,0x87,0x2C,0x7F,0xFF,0x03,0x34,0x7F,0xFF,0xCF,0x1F,0xFF,0xFF,0xFF,0xFF,0xA6,0x7F,0xFF,0x82,0x2C,0x7F,0xFF,0x03,0x4C,0xFF,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0x85,0xFF,0xFF,0x8C,0x2C,0x7F,0xFF,0x00,0x2C,0x7F,0xC3,0x85,0x00,0x00,0x00,0x00,0x34,0x7F,0x9F,0x8B,0x34,0x5F,0xFF,0x00,0x5D,0x3F,0xFF,0x81,0xFF,0xFF,0xFF,0x00,0x75,0x9F,0xFF,0x83,0x34,0x5F,0xFF,0x03,0x44,0xBF,0xFF,0xF7,0xBF,0xFF,0xFF,0xFF,0xFF,0xAE,0x9F,0xFF,0x87,0x34,0x5F,0xFF,0x03,0xA6,0x7F,0xFF,0xFF,0xFF,0xFF,0xF7,0xBF,0xFF,0x44,0x9F,0xFF,0x83,0x34,0x5F,0xFF,0x00,0x75,0x7F,0xFF,0x81,0xFF,0xFF,0xFF,0x00,0x65,0x3F,0xFF,0x8B,0x34,0x5F,0xFF,0x00,0x2C,0x5F,0x9C,0x85,0x00,0x00,0x00,0x00,0x34,0x5F,0x77,
+    0x8B,0x34,0x5F,0xFF,0x02,0xDF,0x5F,0xFF,0xFF,0xFF,0xFF,0xA6,0x5F,0xFF,0x85,0x34,0x5F,0xFF,0x00,0x6D,0x5F,0xFF,0x81,0xFF,0xFF,0xFF,0x01,0xCF,0x1F,0xFF,0x65,0x3F,0xFF,0x83,0x34,0x5F,0xFF,0x01,0x5C,0xFF,0xFF,0xCF,0x1F,0xFF,0x81,0xFF,0xFF,0xFF,0x00,0x6D,0x5F,0xFF,0x85,0x34,0x5F,0xFF,0x02,0xA6,0x5F,0xFF,0xFF,0xFF,0xFF,0xDF,0x5F,0xFF,0x8B,0x34,0x5F,0xFF,0x00,0x34,0x3F,0x75,0x85,0x00,0x00,0x00,0x00,0x34,0x3E,0x40,0x8B,0x34,0x3F,0xFF,0x02,0xBE,0xDF,0xFF,0xFF,0xFF,0xFF,0x9E,0x3F,0xFF,0x86,0x34,0x3F,0xFF,0x01,0x6D,0x3F,0xFF,0xF7,0xBF,0xFF,0x81,0xFF,0xFF,0xFF,0x03,0xE7,0x9F,0xFF,0xC6,0xFF,0xFF,0xC6,0xDF,0xFF,0xE7,0x7F,0xFF,0x81,0xFF,0xFF,0xFF,0x01,0xEF,0xBF,0xFF,0x6D,0x3F,0xFF,0x86,0x34,0x3F,0xFF,0x02,0x9E,0x3F,0xFF,0xFF,0xFF,0xFF,0xBE,0xDF,0xFF,0x8B,0x34,0x3F,0xFF,0x00,0x34,0x3F,0x3D,0x85,0x00,0x00,0x00,0x01,0x24,0x9F,0x07,0x34,0x3F,0xF6,0x8A,0x34,0x3F,0xFF,0x03,0x5C,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0x44,0x9F,0xFF,0x86,0x34,0x3F,0xFF,0x02,0x44,0x7F,
+    0xFF,0xA6,0x5F,0xFF,0xF7,0xBF,0xFF,0x83,0xFF,0xFF,0xFF,0x02,0xF7,0xBF,0xFF,0xA6,0x5F,0xFF,0x44,0x7F,0xFF,0x86,0x34,0x3F,0xFF,0x03,0x44,0x7F,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0x5C,0xFF,0xFF,0x8A,0x34,0x3F,0xFF,0x01,0x34,0x3F,0xF5,0x24,0x9F,0x07,0x86,0x00,0x00,0x00,0x00,0x34,0x3F,0xBA,0x8B,0x34,0x1F,0xFF,0x04,0xC6,0xDF,0xFF,0xFF,0xFF,0xFF,0xBE,0xBF,0xFF,0x4C,0x9F,0xFF,0x6D,0x1F,0xFF,0x81,0x85,0xBF,0xFF,0x00,0x3C,0x3F,0xFF,0x83,0x34,0x1F,0xFF,0x01,0x34,0x3F,0xFF,0x5C,0xDF,0xFF,0x81,0x75,0x5F,0xFF,0x01,0x5C,0xDF,0xFF,0x3C,0x3F,0xFF,0x83,0x34,0x1F,0xFF,0x00,0x3C,0x3F,0xFF,0x81,0x85,0xBF,0xFF,0x04,0x6D,0x1F,0xFF,0x4C,0x9F,0xFF,0xBE,0xBF,0xFF,0xFF,0xFF,0xFF,0xC6,0xDF,0xFF,0x8B,0x34,0x1F,0xFF,0x00,0x34,0x1F,0xB6,0x87,0x00,0x00,0x00,0x00,0x34,0x1F,0x62,0x8B,0x34,0x1F,0xFF,0x01,0x4C,0x7F,0xFF,0xF7,0xBF,0xFF,0x84,0xFF,0xFF,0xFF,0x01,0xD7,0x3F,0xFF,0x54,0x9F,0xFF,0x8B,0x34,0x1F,0xFF,0x01,0x4C,0x9F,0xFF,0xD7,0x1F,0xFF,0x84,0xFF,0xFF,0xFF,0x01,0xF7,0xBF,0xFF,
+    0x4C,0x7F,0xFF,0x8B,0x34,0x1F,0xFF,0x00,0x34,0x1F,0x5E,0x87,0x00,0x00,0x00,0x01,0x34,0x1F,0x0E,0x34,0x1F,0xF5,0x8B,0x33,0xFF,0xFF,0x09,0x7D,0x5F,0xFF,0xFF,0xFF,0xFF,0xEF,0xBF,0xFF,0xD7,0x1F,0xFF,0xB6,0x9F,0xFF,0xEF,0x9F,0xFF,0xFF,0xFF,0xFF,0xF7,0xBF,0xFF,0x95,0xFF,0xFF,0x44,0x5F,0xFF,0x87,0x33,0xFF,0xFF,0x09,0x44,0x5F,0xFF,0x95,0xFF,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xEF,0x9F,0xFF,0xB6,0x9F,0xFF,0xD7,0x1F,0xFF,0xEF,0xBF,0xFF,0xFF,0xFF,0xFF,0x7D,0x5F,0xFF,0x8B,0x33,0xFF,0xFF,0x01,0x34,0x1F,0xF4,0x44,0x1F,0x0C,0x88,0x00,0x00,0x00,0x00,0x3B,0xFF,0x9E,0x90,0x3B,0xFF,0xFF,0x01,0x44,0x3F,0xFF,0xC6,0xBF,0xFF,0x81,0xFF,0xFF,0xFF,0x01,0xFF,0xDF,0xFF,0xAE,0x3F,0xFF,0x85,0x3B,0xFF,0xFF,0x01,0xAE,0x3F,0xFF,0xFF,0xDF,0xFF,0x81,0xFF,0xFF,0xFF,0x01,0xBE,0xBF,0xFF,0x44,0x3F,0xFF,0x90,0x3B,0xFF,0xFF,0x00,0x3B,0xFF,0x9C,0x89,0x00,0x00,0x00,0x01,0x3C,0x1F,0x24,0x3B,0xFF,0xFC,0x91,0x3B,0xFF,0xFF,0x01,0x6D,0x1F,0xFF,0xCE,0xFF,0xFF,0x81,0xFF,0xFF,0xFF,0x00,0x75,0x1F,
+    0xFF,0x83,0x3B,0xDF,0xFF,0x00,0x75,0x1F,0xFF,0x81,0xFF,0xFF,0xFF,0x01,0xCE,0xFF,0xFF,0x6C,0xFF,0xFF,0x91,0x3B,0xDF,0xFF,0x01,0x3B,0xDF,0xFC,0x3B,0xDF,0x26,0x8A,0x00,0x00,0x00,0x00,0x3B,0xDF,0xA8,0x93,0x3B,0xDF,0xFF,0x02,0x9D,0xDF,0xFF,0xFF,0xFF,0xFF,0xC6,0xBF,0xFF,0x83,0x3B,0xDF,0xFF,0x02,0xC6,0xBF,0xFF,0xFF,0xFF,0xFF,0x9D,0xFF,0xFF,0x93,0x3B,0xDF,0xFF,0x00,0x3B,0xDF,0xA4,0x8B,0x00,0x00,0x00,0x01,0x3B,0xBE,0x1E,0x3B,0xDF,0xF4,0x92,0x3B,0xDF,0xFF,0x00,0x4C,0x3F,0xFF,0x81,0xFF,0xFF,0xFF,0x00,0x5C,0x7F,0xFF,0x81,0x43,0xFF,0xFF,0x00,0x5C,0x7F,0xFF,0x81,0xFF,0xFF,0xFF,0x00,0x4C,0x3F,0xFF,0x8C,0x3B,0xDF,0xFF,0x85,0x3B,0xBF,0xFF,0x01,0x3B,0xBF,0xF5,0x43,0xDE,0x20,0x8C,0x00,0x00,0x00,0x00,0x3B,0xBF,0x7C,0x93,0x3B,0xBF,0xFF,0x00,0xC6,0x9F,0xFF,0x85,0xFF,0xFF,0xFF,0x00,0xC6,0x9F,0xFF,0x93,0x3B,0xBF,0xFF,0x00,0x3B,0xBF,0x78,0x8D,0x00,0x00,0x00,0x01,0x4B,0x7F,0x07,0x3B,0xBF,0xCD,0x92,0x3B,0xBF,0xFF,0x02,0x64,0x7F,0xFF,0xD7,0x1F,0xFF,0xEF,0x7F,0xFF,0x81,0xF7,
+    0xDF,0xFF,0x02,0xEF,0x7F,0xFF,0xD7,0x1F,0xFF,0x64,0x7F,0xFF,0x92,0x3B,0xBF,0xFF,0x01,0x3B,0xBF,0xCC,0x2C,0x1F,0x06,0x8E,0x00,0x00,0x00,0x01,0x43,0xBF,0x23,0x3B,0x9F,0xF0,0xA9,0x3B,0x9F,0xFF,0x81,0x43,0x9F,0xFF,0x01,0x43,0x9F,0xF2,0x43,0x9F,0x26,0x90,0x00,0x00,0x00,0x01,0x43,0x9F,0x52,0x3B,0x9F,0xFD,0xA9,0x43,0x9F,0xFF,0x01,0x43,0x9F,0xFC,0x43,0x9F,0x50,0x92,0x00,0x00,0x00,0x00,0x43,0x7F,0x68,0xA9,0x43,0x7F,0xFF,0x00,0x43,0x7F,0x6E,0x94,0x00,0x00,0x00,0x00,0x43,0x7F,0x7C,0xA7,0x43,0x7F,0xFF,0x00,0x43,0x7F,0x7B,0x96,0x00,0x00,0x00,0x01,0x43,0x5F,0x6A,0x43,0x5F,0xFD,0xA3,0x43,0x5F,0xFF,0x01,0x43,0x5F,0xFC,0x43,0x5F,0x69,0x98,0x00,0x00,0x00,0x01,0x43,0x5F,0x51,0x43,0x5F,0xF1,0xA1,0x43,0x5F,0xFF,0x01,0x43,0x5F,0xF0,0x43,0x5F,0x50,0x9A,0x00,0x00,0x00,0x01,0x4B,0x5F,0x1F,0x43,0x3F,0xC7,0x9F,0x43,0x3F,0xFF,0x01,0x43,0x3F,0xCD,0x43,0x5F,0x24,0x9C,0x00,0x00,0x00,0x02,0x52,0xBF,0x06,0x43,0x3F,0x7A,0x4B,0x3F,0xF5,0x9B,0x4B,0x3F,0xFF,0x02,0x4B,0x3F,0xF5,0x4B,
+    0x3F,0x79,0x52,0xBF,0x06,0x9F,0x00,0x00,0x00,0x02,0x4B,0x1F,0x1F,0x4B,0x3F,0xA5,0x4B,0x3F,0xFC,0x88,0x4B,0x3F,0xFF,0x8E,0x4B,0x1F,0xFF,0x02,0x4B,0x1F,0xFC,0x4B,0x3F,0xA4,0x4B,0x3F,0x1E,0xA3,0x00,0x00,0x00,0x02,0x4B,0x1F,0x25,0x4B,0x1F,0x9C,0x4B,0x1F,0xF4,0x93,0x4B,0x1F,0xFF,0x02,0x4B,0x1F,0xF4,0x4B,0x1F,0x9C,0x43,0x1F,0x24,0xA7,0x00,0x00,0x00,0x03,0x4B,0x1F,0x0D,0x4B,0x1F,0x5F,0x4B,0x1F,0xB7,0x4B,0x1F,0xF5,0x8D,0x4B,0x1F,0xFF,0x03,0x4B,0x1F,0xF4,0x4B,0x1F,0xB6,0x4A,0xFF,0x5E,0x53,0x5F,0x0C,0xAC,0x00,0x00,0x00,0x06,0x52,0xBF,0x06,0x4A,0xFF,0x3D,0x4A,0xFF,0x76,0x4A,0xFF,0x9C,0x4A,0xFF,0xC4,0x4A,0xFF,0xDD,0x4A,0xFF,0xED,0x81,0x4A,0xFF,0xF9,0x06,0x4A,0xFF,0xED,0x4A,0xFF,0xDD,0x4A,0xFF,0xC3,0x4A,0xFF,0x9C,0x4A,0xFF,0x76,0x4A,0xFF,0x3D,0x52,0xBF,0x06,0xFF,0x00,0x00,0x00,0xD7,0x00,0x00,0x00,
     };
 const lv_img_dsc_t ui_img_setting_png = {
    .header.always_zero = 0,
    .header.w = 64,
    .header.h = 64,
    .data_size = sizeof(ui_img_setting_png_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+   .header.cf = LV_IMG_CF_USER_ENCODED_1,
    .data = ui_img_setting_png_data};
 
@@ -11,28 +11,13 @@
 
 // IMAGE DATA: assets\skype.png
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_skype_png_data[] = {
-0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,
-    0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,
-    0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,
-    0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,
-    0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,
-    0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,
-    0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,
-    0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,
-    0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x05,0x5E,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
+    0xF7,0xAA,0x00,0xFF,0x4A,0x71,0x42,0xFF,0xF0,0x00,0x1F,0xFF,0xE0,0x00,0x03,0xFF,0xC0,0x00,0x00,0xFF,0x80,0x00,0x00,0x3F,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x0F,0x00,0x03,0xC0,0x07,0x00,0x1F,0xF8,0x03,0x00,0x7C,0x3C,0x03,0x00,0x70,0x0E,0x01,0x00,0xE0,0x0E,0x01,0x00,0xF0,0x06,0x00,0x00,0x70,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x3F,0xC0,0x00,0x00,0x1F,0xF8,0x00,0x00,0x01,0xFE,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x0F,0x00,0x00,0xC0,0x07,0x00,0x80,0xE0,0x07,0x00,0x80,0xE0,0x07,0x00,0x80,0x70,0x0F,0x00,0xC0,0x7C,0x3E,0x00,0xE0,0x1F,0xFC,0x00,0xE0,0x03,0xE0,0x00,0xF0,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0xFC,0x00,0x00,0x01,0xFE,0x00,0x00,0x03,0xFF,0x80,0x00,0x07,0xFF,0xF0,0x00,0x0F,
     };
 const lv_img_dsc_t ui_img_skype_png = {
    .header.always_zero = 0,
    .header.w = 32,
    .header.h = 32,
    .data_size = sizeof(ui_img_skype_png_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR,
+   .header.cf = LV_IMG_CF_INDEXED_1BIT,
    .data = ui_img_skype_png_data};
 
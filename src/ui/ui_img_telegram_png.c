@@ -10,29 +10,17 @@
 #endif
 
 // IMAGE DATA: assets\telegram.png
+// Run length encoded LV_IMG_CF_TRUE_COLOR, decoded by src/img_cache.cpp
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_telegram_png_data[] = {
-0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x43,0x89,0x43,0x89,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x0C,0xFC,0x45,0xBD,0x45,0xBD,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x43,0x89,
-    0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x25,0x5D,0x76,0x3E,0xCF,0x5F,0xF7,0xFF,0xCF,0x5F,0x0C,0xFC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x15,0x1C,0x5D,0xFD,0xA6,0xFE,0xEF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB7,0x1F,0x0C,0xFC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,
-    0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x0C,0xFC,0x35,0x7D,0x86,0x7E,0xCF,0x5F,0xF7,0xFF,0xFF,0xFF,0xCF,0x5F,0xB7,0x1F,0xFF,0xFF,0xFF,0xFF,0x86,0x7E,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x25,0x5D,0x5D,0xFD,0xB7,0x1F,0xEF,0xBF,0xFF,0xFF,0xFF,0xFF,0xEF,0xBF,0x86,0x7E,0x76,0x3E,0xEF,0xBF,0xFF,0xFF,0xFF,0xFF,0x5D,0xFD,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,
-    0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x0C,0xFC,0x45,0xBD,0x96,0xBE,0xDF,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB7,0x1F,0x45,0xBD,0x76,0x3E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xBF,0x35,0x7D,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x15,0x1C,0x76,0x3E,0xB7,0x1F,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0x9F,0x5D,0xFD,0x15,0x1C,0x86,0x7E,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCF,0x5F,0x15,0x1C,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,
-    0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x45,0xBD,0xDF,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0x96,0xBE,0x25,0x5D,0x0C,0xFC,0x96,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA6,0xFE,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x0C,0xFC,0x25,0x5D,0x5D,0xFD,0xA6,0xFE,0xDF,0x9F,0xCF,0x5F,0x5D,0xFD,0x04,0xDC,0x15,0x1C,0xA6,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x7E,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,
-    0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x25,0x5D,0x15,0x1C,0x04,0xDC,0x25,0x5D,0xB7,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0x45,0xBD,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x96,0xBE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xBF,0x25,0x5D,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,
-    0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x0C,0xFC,0xB7,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCF,0x5F,0x0C,0xFC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x0C,0xFC,0xCF,0x5F,0xF7,0xFF,0x76,0x3E,0x96,0xBE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x96,0xBE,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,
-    0x43,0x89,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x15,0x1C,0xB7,0x1F,0x5D,0xFD,0x04,0xDC,0x04,0xDC,0x5D,0xFD,0xDF,0x9F,0xFF,0xFF,0xFF,0xFF,0x76,0x3E,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x43,0x89,0x43,0x89,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x0C,0xFC,0x35,0x7D,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x35,0x7D,0xB7,0x1F,0xEF,0xBF,0x45,0xBD,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x15,0x1C,0x35,0x7D,0x0C,0xFC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x04,0xDC,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
+    0x89,0x43,0x89,0x8B,0x04,0xDC,0x91,0x43,0x89,0x8F,0x04,0xDC,0x8D,0x43,0x89,0x93,0x04,0xDC,0x8A,0x43,0x89,0x95,0x04,0xDC,0x88,0x43,0x89,0x97,0x04,0xDC,0x86,0x43,0x89,0x99,0x04,0xDC,0x84,0x43,0x89,0x9B,0x04,0xDC,0x83,0x43,0x89,0x9B,0x04,0xDC,0x82,0x43,0x89,0x9D,0x04,0xDC,0x81,0x43,0x89,0x93,0x04,0xDC,0x00,0x0C,0xFC,0x81,0x45,0xBD,0x86,0x04,0xDC,0x00,0x43,0x89,0x92,0x04,0xDC,0x05,0x25,0x5D,0x76,0x3E,0xCF,0x5F,0xF7,0xFF,0xCF,0x5F,0x0C,0xFC,0x96,0x04,0xDC,0x03,0x15,0x1C,0x5D,0xFD,0xA6,0xFE,0xEF,0xBF,0x82,0xFF,0xFF,0x01,0xB7,0x1F,0x0C,0xFC,0x93,0x04,0xDC,0x07,0x0C,0xFC,0x35,0x7D,0x86,0x7E,0xCF,0x5F,0xF7,0xFF,0xFF,0xFF,0xCF,0x5F,0xB7,0x1F,0x81,0xFF,0xFF,0x00,0x86,0x7E,0x92,0x04,0xDC,0x03,0x25,0x5D,0x5D,0xFD,0xB7,0x1F,0xEF,0xBF,0x81,0xFF,0xFF,0x03,0xEF,0xBF,0x86,0x7E,0x76,0x3E,0xEF,0xBF,0x81,0xFF,0xFF,0x00,0x5D,0xFD,0x8F,0x04,0xDC,0x03,0x0C,0xFC,0x45,0xBD,0x96,0xBE,0xDF,0x9F,0x83,0xFF,0xFF,0x03,0xB7,0x1F,0x45,0xBD,0x76,0x3E,0xF7,0xFF,0x81,0xFF,0xFF,0x01,
+    0xEF,0xBF,0x35,0x7D,0x8D,0x04,0xDC,0x03,0x15,0x1C,0x76,0x3E,0xB7,0x1F,0xF7,0xFF,0x83,0xFF,0xFF,0x04,0xDF,0x9F,0x5D,0xFD,0x15,0x1C,0x86,0x7E,0xF7,0xFF,0x82,0xFF,0xFF,0x01,0xCF,0x5F,0x15,0x1C,0x8D,0x04,0xDC,0x01,0x45,0xBD,0xDF,0x9F,0x83,0xFF,0xFF,0x04,0xF7,0xFF,0x96,0xBE,0x25,0x5D,0x0C,0xFC,0x96,0xBE,0x84,0xFF,0xFF,0x00,0xA6,0xFE,0x8E,0x04,0xDC,0x09,0x0C,0xFC,0x25,0x5D,0x5D,0xFD,0xA6,0xFE,0xDF,0x9F,0xCF,0x5F,0x5D,0xFD,0x04,0xDC,0x15,0x1C,0xA6,0xFE,0x85,0xFF,0xFF,0x00,0x86,0x7E,0x92,0x04,0xDC,0x04,0x25,0x5D,0x15,0x1C,0x04,0xDC,0x25,0x5D,0xB7,0x1F,0x85,0xFF,0xFF,0x01,0xF7,0xFF,0x45,0xBD,0x95,0x04,0xDC,0x00,0x96,0xBE,0x86,0xFF,0xFF,0x01,0xEF,0xBF,0x25,0x5D,0x94,0x04,0xDC,0x01,0x0C,0xFC,0xB7,0x1F,0x86,0xFF,0xFF,0x01,0xCF,0x5F,0x0C,0xFC,0x94,0x04,0xDC,0x05,0x0C,0xFC,0xCF,0x5F,0xF7,0xFF,0x76,0x3E,0x96,0xBE,0xF7,0xFF,0x82,0xFF,0xFF,0x00,0x96,0xBE,0x89,0x04,0xDC,0x00,0x43,0x89,0x8A,0x04,0xDC,0x02,0x15,0x1C,0xB7,0x1F,0x5D,0xFD,0x81,0x04,0xDC,0x01,0x5D,0xFD,
+    0xDF,0x9F,0x81,0xFF,0xFF,0x00,0x76,0x3E,0x88,0x04,0xDC,0x81,0x43,0x89,0x8A,0x04,0xDC,0x01,0x0C,0xFC,0x35,0x7D,0x83,0x04,0xDC,0x03,0x35,0x7D,0xB7,0x1F,0xEF,0xBF,0x45,0xBD,0x88,0x04,0xDC,0x82,0x43,0x89,0x90,0x04,0xDC,0x02,0x15,0x1C,0x35,0x7D,0x0C,0xFC,0x87,0x04,0xDC,0x83,0x43,0x89,0x9B,0x04,0xDC,0x84,0x43,0x89,0x99,0x04,0xDC,0x86,0x43,0x89,0x97,0x04,0xDC,0x88,0x43,0x89,0x95,0x04,0xDC,0x8A,0x43,0x89,0x93,0x04,0xDC,0x8D,0x43,0x89,0x8F,0x04,0xDC,0x91,0x43,0x89,0x8B,0x04,0xDC,0x89,0x43,0x89,
     };
 const lv_img_dsc_t ui_img_telegram_png = {
    .header.always_zero = 0,
    .header.w = 32,
    .header.h = 32,
    .data_size = sizeof(ui_img_telegram_png_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR,
+   .header.cf = LV_IMG_CF_USER_ENCODED_0,
    .data = ui_img_telegram_png_data};
 
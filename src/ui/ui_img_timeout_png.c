@@ -10,77 +10,28 @@
 #endif
 
 // IMAGE DATA: assets\timeout.png
+// Run length encoded LV_IMG_CF_TRUE_COLOR_ALPHA, decoded by src/img_cache.cpp
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_timeout_png_data[] = {
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x9F,0x51,0xAE,0x9F,0xD8,0xAE,0x9F,0xF1,0xAE,0x9F,0xA5,0xA6,0x9F,0x11,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x1F,0x02,0x03,0x3F,0x34,0x03,0x3F,0x53,0x03,0x3F,0x3E,0x03,0x1F,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xAE,0x3F,0x09,0xAE,0x9F,0x98,0xAE,0x9F,0xFF,0xAE,0x9F,0xFF,0xAE,0x9F,0xFF,0xAE,0x9F,0xFF,0xAE,0x9F,0xA5,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xDF,0x0F,0x04,0xFF,0x22,0x04,0xFF,0x30,0x05,0x1F,0x36,0x05,0x1F,0x33,0x05,0x1F,0x23,0x05,0x3F,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x3F,0x4A,0x03,0x3F,0xDC,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xEE,0x03,0x3F,0x6E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA6,0x9F,0x28,0xAE,0x7F,0xD1,0xAE,0x9F,0xFF,0xAE,0x9F,0xFF,0xAE,0x9F,0xFF,0xAE,0x9F,0xFF,0xAE,0x9F,0xFF,0xAE,0x9F,0xF1,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xFF,0x12,0x05,0x1F,0x50,0x05,0x1F,0x92,0x05,0x1F,0xC1,0x05,0x1F,0xE9,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xF1,0x05,0x1F,0xCB,0x05,0x1F,0x9F,0x05,0x1F,0x5F,0x04,0xFF,0x1D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x3F,0x69,0x03,0x3F,0xFD,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0x98,0x00,0x1F,0x01,0xAE,0x9F,0x5E,0xAE,0x9F,0xF3,0xAE,0x9F,0xFF,0xAE,0x9F,0xFF,0xAE,0x9F,0xFF,0xAE,0x9F,0xFF,0xAE,0x9F,0xFF,0xAE,0x9F,0xFF,0xAE,0x9F,0xD6,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x5F,0x0C,0x05,0x1F,0x5E,0x05,0x1F,0xBC,0x05,0x1F,0xFD,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xD0,0x05,0x1F,0x72,0x05,0x1F,0x19,0x03,0x3F,0x68,0x03,0x3F,0xFE,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x34,0x1F,0xDA,0xA6,0x7F,0xFF,0xAE,0x9F,0xFF,0xAE,0x9F,0xFF,0xAE,0x9F,0xFF,0xAE,0x9F,0xFF,0xAE,0x9F,0xFF,0xAE,0x9F,0xFF,0xAE,0x9F,0xFE,0xAE,0x7F,0x4F,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x3F,0x14,0x05,0x1F,0x80,0x05,0x1F,0xEF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFE,0x04,0x7F,0xFF,0x03,0x9F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x44,0x7F,0xFF,0xA6,0x7F,0xFF,0xAE,0x9F,0xFF,0xAE,0x9F,0xFF,0xAE,0x9F,0xFF,0xAE,0x9F,0xFF,0xAE,0x9F,0xFF,0xAE,0x9F,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x5F,0x09,0x05,0x1F,0x81,0x05,0x1F,0xF5,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x04,0x5F,0xFF,0x03,0x5F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x44,0x7F,0xFF,0xA6,0x7F,0xFF,0xAE,0x9F,0xFF,0xAE,0x9F,0xFF,0xAE,0x9F,0xFF,0xA6,0x9F,0xA9,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0x45,0x05,0x1F,0xDC,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x04,0xFF,0xFF,0x03,0xFF,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x44,0x9F,0xFF,0xA6,0x7F,0xFF,0xAE,0x9F,0xFF,0xAE,0x9F,0xCC,0xB6,0x7F,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0x04,0x05,0x1F,0x80,0x05,0x1F,0xFD,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x04,0x7F,0xFF,0x03,0x5F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x44,0x9F,0xFF,0xA6,0x7F,0xE5,0xAE,0x9F,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xFF,0x10,0x05,0x1F,0xC0,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x04,0xDF,0xFF,0x03,0x9F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x13,0x9F,0xAE,0x00,0x1F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xFF,0x18,0x05,0x1F,0xCF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x0D,0x3F,0xFF,0x15,0x3F,0xFF,0x0D,0x3F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x04,0xFF,0xFF,0x03,0x9F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0x91,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x3F,0x17,0x05,0x1F,0xDB,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x25,0x7F,0xFF,0x6E,0x5F,0xFF,0xAF,0x1F,0xFF,0xD7,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0x9F,0xFF,0xB7,0x3F,0xFF,0x7E,0x7F,0xFF,0x3D,0xBF,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x04,0xFF,0xFF,0x03,0x9F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0x4C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x3F,0x0E,0x05,0x1F,0xCD,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x0D,0x3F,0xFF,0x6E,0x3F,0xFF,0xCF,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0xBF,0xFF,0x86,0x9F,0xFF,0x15,0x5F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x04,0xFF,0xFF,0x03,0x9F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xBB,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x1F,0x02,0x05,0x1F,0xB6,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x6E,0x5F,0xFF,0xE7,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0x8E,0xBF,0xFF,0x0D,0x3F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x04,0xDF,0xFF,0x03,0x5F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0x78,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x25,0x7F,0xFF,0xCF,0x5F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0xBF,0xFF,0x45,0xDF,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x04,0x7F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xF3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0x34,0x05,0x1F,0xFB,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x56,0x1F,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x9F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x03,0xFF,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xC3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x1F,0x02,0x05,0x1F,0xC8,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x6E,0x5F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA6,0xFF,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x04,0xFF,0xFF,0x03,0x7F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0x5A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0x68,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x66,0x3F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA6,0xFF,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x04,0x5F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xA3,0x00,0x1F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x9F,0x07,0x05,0x1F,0xE4,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x4D,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0x5F,0xFF,0xDF,0x5F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x9F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x03,0x7F,0xFF,0x03,0x3F,0xA9,0x03,0x3F,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0x67,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x1D,0x7F,0xFF,0xEF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBF,0xFF,0x3C,0x5F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x3C,0x5F,0xFF,0xF7,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x45,0xDF,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x04,0x9F,0xDC,0x02,0xBF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0xD8,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0xB7,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0x7F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x8D,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0xBF,0xFF,0x0D,0x3F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFA,0x04,0xFF,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0x39,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x55,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x13,0x9F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x3C,0x5F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x86,0x9F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0x95,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0xCF,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x23,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0x15,0x5F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xCD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0xE0,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x45,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA6,0x5F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x1B,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7E,0x9F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0x1B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0x24,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0xA6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0x9F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x1B,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0x9F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0x5C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0x63,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x3F,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xDF,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x1B,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x35,0xBF,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0x9B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0x8F,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x45,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x34,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x1B,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7E,0x7F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xC7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0xB6,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x7E,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0B,0x7F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x1B,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB7,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xEE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0xD8,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0xA6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x7F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x1B,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0x9F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x04,0xFF,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0xE8,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0xC7,0x5F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBE,0xDF,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x1B,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0xF5,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0xCF,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x95,0xFF,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x1B,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0D,0x3F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0x2F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0xFC,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0xD7,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0x3F,0xFF,0x85,0xBF,0xFF,0x34,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x1B,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x15,0x5F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0x37,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0xF2,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0xCF,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0x8D,0xDF,0xFF,0x23,0xDF,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x1B,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0x2B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0xE5,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0xBF,0x3F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0x7F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x1B,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0xD1,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x9E,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0x5F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x2C,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0x7F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFE,0x05,0x1F,0x0B,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0xAC,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x6E,0x5F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0x5F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x7D,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xA6,0xFF,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0x85,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x2D,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0x5F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x03,0x3F,0xFF,0x34,0x1F,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6E,0x3F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xBD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0x54,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0xE7,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBF,0xFF,0x85,0xBF,0xFF,0x3C,0x5F,0xFF,0x23,0xFF,0xFF,0x23,0xDF,0xFF,0x23,0xDF,0xFF,0x23,0xDF,0xFF,0x23,0xDF,0xFF,0x23,0xDF,0xFF,0x23,0xDF,0xFF,0x34,0x1F,0xFF,0x85,0x9F,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x25,0x7F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0x8A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0x13,0x05,0x1F,0xFD,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x8E,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC7,0x5F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0x49,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0xD0,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x2D,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x66,0x3F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFA,0x04,0xFF,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0x7E,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0xB7,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0xBF,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xB2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x3F,0x1F,0x05,0x1F,0xFE,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x2D,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x66,0x3F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0x57,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0xBE,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x8E,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC7,0x5F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xEB,0x05,0x5F,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0x47,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x0D,0x3F,0xFF,0xCF,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xDF,0xFF,0x25,0x7F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0x7D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0xCB,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x25,0x7F,0xFF,0xEF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x4D,0xFF,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xF1,0x05,0x3F,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0x3E,0x05,0x1F,0xFE,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x35,0xBF,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x66,0x3F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0x75,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0xA5,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x35,0xBF,0xFF,0xEF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x66,0x3F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xDA,0x04,0x9F,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xFF,0x18,0x05,0x1F,0xEA,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x25,0x7F,0xFF,0xCF,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xBF,0xFF,0x45,0xDF,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFC,0x05,0x1F,0x3D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xFF,0x48,0x05,0x1F,0xFD,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x0D,0x3F,0xFF,0x8E,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xAF,0x1F,0xFF,0x1D,0x5F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0x83,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x2D,0x9F,0xFF,0xAF,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCF,0x5F,0xFF,0x45,0xDF,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xB7,0x04,0x1F,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x05,0x1F,0x9D,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x2D,0x9F,0xFF,0x8E,0xBF,0xFF,0xE7,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0xA6,0xFF,0xFF,0x45,0xDF,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xCB,0x05,0x5F,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xFF,0x04,0x05,0x1F,0xB0,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x2D,0x9F,0xFF,0x6E,0x5F,0xFF,0x96,0xDF,0xFF,0xB7,0x3F,0xFF,0xCF,0x5F,0xFF,0xD7,0x7F,0xFF,0xCF,0x7F,0xFF,0xBF,0x3F,0xFF,0x9E,0xDF,0xFF,0x76,0x7F,0xFF,0x3D,0xBF,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xD7,0x05,0x1F,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x5F,0x03,0x05,0x1F,0x9B,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xCA,0x04,0xFF,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x01,0x05,0x1F,0x82,0x05,0x1F,0xFD,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xAC,0x04,0xDF,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0x42,0x05,0x1F,0xE7,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xF8,0x05,0x1F,0x6F,0x07,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xFF,0x18,0x05,0x1F,0xA4,0x05,0x1F,0xFE,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xC3,0x04,0xFF,0x2D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xFF,0x40,0x05,0x1F,0xC9,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xDF,0x05,0x1F,0x5D,0x07,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x1F,0x45,0x05,0x1F,0xBD,0x05,0x1F,0xFD,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xD2,0x05,0x1F,0x5D,0x05,0xFF,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x3F,0x1F,0x05,0x1F,0x7B,0x05,0x1F,0xCD,0x05,0x1F,0xFD,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xFF,0x05,0x1F,0xDB,0x05,0x1F,0x8C,0x05,0x1F,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xFF,0x12,0x05,0x1F,0x50,0x05,0x1F,0x82,0x05,0x1F,0xA8,0x05,0x1F,0xCF,0x05,0x1F,0xE0,0x05,0x1F,0xEE,0x05,0x1F,0xFD,0x05,0x1F,0xF0,0x05,0x1F,0xE4,0x05,0x1F,0xD5,0x05,0x1F,0xAF,0x05,0x1F,0x8A,0x05,0x1F,0x5D,0x05,0x3F,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xFF,0x00,0x00,0x00,0xB8,0x00,0x00,0x00,0x04,0xA6,0x9F,0x51,0xAE,0x9F,0xD8,0xAE,0x9F,0xF1,0xAE,0x9F,0xA5,0xA6,0x9F,0x11,0xAE,0x00,0x00,0x00,0x04,0x04,0x1F,0x02,0x03,0x3F,0x34,0x03,0x3F,0x53,0x03,0x3F,0x3E,0x03,0x1F,0x08,0x84,0x00,0x00,0x00,0x01,0xAE,0x3F,0x09,0xAE,0x9F,0x98,0x83,0xAE,0x9F,0xFF,0x00,0xAE,0x9F,0xA5,0x9C,0x00,0x00,0x00,0x06,0x04,0xDF,0x0F,0x04,0xFF,0x22,0x04,0xFF,0x30,0x05,0x1F,0x36,0x05,0x1F,0x33,0x05,0x1F,0x23,0x05,0x3F,0x17,0x89,0x00,0x00,0x00,0x01,0x03,0x3F,0x4A,0x03,0x3F,0xDC,0x82,0x03,0x3F,0xFF,0x01,0x03,0x3F,0xEE,0x03,0x3F,0x6E,0x82,0x00,0x00,0x00,0x01,0xA6,0x9F,0x28,0xAE,0x7F,0xD1,0x84,0xAE,0x9F,0xFF,0x00,0xAE,0x9F,0xF1,0x97,0x00,0x00,0x00,0x04,0x04,0xFF,0x12,0x05,0x1F,0x50,0x05,0x1F,0x92,0x05,0x1F,0xC1,0x05,0x1F,0xE9,0x86,0x05,0x1F,0xFF,0x04,0x05,0x1F,0xF1,0x05,0x1F,0xCB,0x05,0x1F,0x9F,0x05,0x1F,0x5F,0x04,0xFF,0x1D,0x83,0x00,0x00,0x00,0x01,0x03,0x3F,0x69,0x03,0x3F,0xFD,0x85,0x03,0x3F,0xFF,0x03,0x03,0x3F,0x98,0x00,0x1F,0x01,
+    0xAE,0x9F,0x5E,0xAE,0x9F,0xF3,0x85,0xAE,0x9F,0xFF,0x00,0xAE,0x9F,0xD6,0x94,0x00,0x00,0x00,0x03,0x05,0x5F,0x0C,0x05,0x1F,0x5E,0x05,0x1F,0xBC,0x05,0x1F,0xFD,0x8F,0x05,0x1F,0xFF,0x04,0x05,0x1F,0xD0,0x05,0x1F,0x72,0x05,0x1F,0x19,0x03,0x3F,0x68,0x03,0x3F,0xFE,0x87,0x03,0x3F,0xFF,0x01,0x34,0x1F,0xDA,0xA6,0x7F,0xFF,0x85,0xAE,0x9F,0xFF,0x01,0xAE,0x9F,0xFE,0xAE,0x7F,0x4F,0x92,0x00,0x00,0x00,0x02,0x05,0x3F,0x14,0x05,0x1F,0x80,0x05,0x1F,0xEF,0x94,0x05,0x1F,0xFF,0x02,0x05,0x1F,0xFE,0x04,0x7F,0xFF,0x03,0x9F,0xFF,0x88,0x03,0x3F,0xFF,0x01,0x44,0x7F,0xFF,0xA6,0x7F,0xFF,0x84,0xAE,0x9F,0xFF,0x00,0xAE,0x9F,0x81,0x91,0x00,0x00,0x00,0x02,0x05,0x5F,0x09,0x05,0x1F,0x81,0x05,0x1F,0xF5,0x99,0x05,0x1F,0xFF,0x01,0x04,0x5F,0xFF,0x03,0x5F,0xFF,0x87,0x03,0x3F,0xFF,0x01,0x44,0x7F,0xFF,0xA6,0x7F,0xFF,0x82,0xAE,0x9F,0xFF,0x01,0xA6,0x9F,0xA9,0xFF,0xFF,0x01,0x90,0x00,0x00,0x00,0x01,0x05,0x1F,0x45,0x05,0x1F,0xDC,0x9C,0x05,0x1F,0xFF,0x01,0x04,0xFF,0xFF,0x03,0xFF,0xFF,0x87,0x03,0x3F,
+    0xFF,0x04,0x44,0x9F,0xFF,0xA6,0x7F,0xFF,0xAE,0x9F,0xFF,0xAE,0x9F,0xCC,0xB6,0x7F,0x0A,0x8F,0x00,0x00,0x00,0x02,0x05,0xFF,0x04,0x05,0x1F,0x80,0x05,0x1F,0xFD,0x9F,0x05,0x1F,0xFF,0x01,0x04,0x7F,0xFF,0x03,0x5F,0xFF,0x86,0x03,0x3F,0xFF,0x02,0x44,0x9F,0xFF,0xA6,0x7F,0xE5,0xAE,0x9F,0x1B,0x8F,0x00,0x00,0x00,0x01,0x04,0xFF,0x10,0x05,0x1F,0xC0,0xA2,0x05,0x1F,0xFF,0x01,0x04,0xDF,0xFF,0x03,0x9F,0xFF,0x86,0x03,0x3F,0xFF,0x01,0x13,0x9F,0xAE,0x00,0x1F,0x01,0x8E,0x00,0x00,0x00,0x01,0x04,0xFF,0x18,0x05,0x1F,0xCF,0x90,0x05,0x1F,0xFF,0x02,0x0D,0x3F,0xFF,0x15,0x3F,0xFF,0x0D,0x3F,0xFF,0x90,0x05,0x1F,0xFF,0x01,0x04,0xFF,0xFF,0x03,0x9F,0xFF,0x86,0x03,0x3F,0xFF,0x00,0x03,0x3F,0x91,0x8D,0x00,0x00,0x00,0x01,0x05,0x3F,0x17,0x05,0x1F,0xDB,0x8C,0x05,0x1F,0xFF,0x03,0x25,0x7F,0xFF,0x6E,0x5F,0xFF,0xAF,0x1F,0xFF,0xD7,0x9F,0xFF,0x84,0xFF,0xFF,0xFF,0x03,0xDF,0x9F,0xFF,0xB7,0x3F,0xFF,0x7E,0x7F,0xFF,0x3D,0xBF,0xFF,0x8C,0x05,0x1F,0xFF,0x01,0x04,0xFF,0xFF,0x03,0x9F,0xFF,0x86,0x03,0x3F,
+    0xFF,0x00,0x03,0x3F,0x4C,0x8B,0x00,0x00,0x00,0x01,0x05,0x3F,0x0E,0x05,0x1F,0xCD,0x8A,0x05,0x1F,0xFF,0x02,0x0D,0x3F,0xFF,0x6E,0x3F,0xFF,0xCF,0x7F,0xFF,0x8C,0xFF,0xFF,0xFF,0x02,0xE7,0xBF,0xFF,0x86,0x9F,0xFF,0x15,0x5F,0xFF,0x8A,0x05,0x1F,0xFF,0x01,0x04,0xFF,0xFF,0x03,0x9F,0xFF,0x85,0x03,0x3F,0xFF,0x00,0x03,0x3F,0xBB,0x8A,0x00,0x00,0x00,0x01,0x04,0x1F,0x02,0x05,0x1F,0xB6,0x8A,0x05,0x1F,0xFF,0x01,0x6E,0x5F,0xFF,0xE7,0xBF,0xFF,0x90,0xFF,0xFF,0xFF,0x02,0xF7,0xDF,0xFF,0x8E,0xBF,0xFF,0x0D,0x3F,0xFF,0x89,0x05,0x1F,0xFF,0x01,0x04,0xDF,0xFF,0x03,0x5F,0xFF,0x84,0x03,0x3F,0xFF,0x00,0x03,0x3F,0xF0,0x8A,0x00,0x00,0x00,0x00,0x05,0x1F,0x78,0x89,0x05,0x1F,0xFF,0x01,0x25,0x7F,0xFF,0xCF,0x5F,0xFF,0x94,0xFF,0xFF,0xFF,0x01,0xE7,0xBF,0xFF,0x45,0xDF,0xFF,0x89,0x05,0x1F,0xFF,0x00,0x04,0x7F,0xFF,0x84,0x03,0x3F,0xFF,0x00,0x03,0x3F,0xF3,0x89,0x00,0x00,0x00,0x01,0x05,0x1F,0x34,0x05,0x1F,0xFB,0x88,0x05,0x1F,0xFF,0x01,0x56,0x1F,0xFF,0xF7,0xDF,0xFF,0x97,0xFF,0xFF,0xFF,0x00,0x86,
+    0x9F,0xFF,0x89,0x05,0x1F,0xFF,0x00,0x03,0xFF,0xFF,0x83,0x03,0x3F,0xFF,0x00,0x03,0x3F,0xC3,0x88,0x00,0x00,0x00,0x01,0x04,0x1F,0x02,0x05,0x1F,0xC8,0x88,0x05,0x1F,0xFF,0x00,0x6E,0x5F,0xFF,0x9A,0xFF,0xFF,0xFF,0x00,0xA6,0xFF,0xFF,0x88,0x05,0x1F,0xFF,0x01,0x04,0xFF,0xFF,0x03,0x7F,0xFF,0x82,0x03,0x3F,0xFF,0x00,0x03,0x3F,0x5A,0x88,0x00,0x00,0x00,0x00,0x05,0x1F,0x68,0x88,0x05,0x1F,0xFF,0x00,0x66,0x3F,0xFF,0x9C,0xFF,0xFF,0xFF,0x00,0xA6,0xFF,0xFF,0x88,0x05,0x1F,0xFF,0x00,0x04,0x5F,0xFF,0x81,0x03,0x3F,0xFF,0x01,0x03,0x3F,0xA3,0x00,0x1F,0x01,0x87,0x00,0x00,0x00,0x01,0x04,0x9F,0x07,0x05,0x1F,0xE4,0x87,0x05,0x1F,0xFF,0x00,0x4D,0xFF,0xFF,0x8F,0xFF,0xFF,0xFF,0x81,0xDF,0x5F,0xFF,0x8C,0xFF,0xFF,0xFF,0x00,0x86,0x9F,0xFF,0x88,0x05,0x1F,0xFF,0x02,0x03,0x7F,0xFF,0x03,0x3F,0xA9,0x03,0x3F,0x05,0x88,0x00,0x00,0x00,0x00,0x05,0x1F,0x67,0x87,0x05,0x1F,0xFF,0x01,0x1D,0x7F,0xFF,0xEF,0xDF,0xFF,0x8D,0xFF,0xFF,0xFF,0x01,0xF7,0xBF,0xFF,0x3C,0x5F,0xFF,0x81,0x03,0x3F,0xFF,0x01,0x3C,
+    0x5F,0xFF,0xF7,0xBF,0xFF,0x8B,0xFF,0xFF,0xFF,0x00,0x45,0xDF,0xFF,0x87,0x05,0x1F,0xFF,0x01,0x04,0x9F,0xDC,0x02,0xBF,0x03,0x89,0x00,0x00,0x00,0x00,0x05,0x1F,0xD8,0x87,0x05,0x1F,0xFF,0x00,0xB7,0x1F,0xFF,0x8E,0xFF,0xFF,0xFF,0x00,0x7D,0x7F,0xFF,0x83,0x03,0x3F,0xFF,0x00,0x8D,0xDF,0xFF,0x8B,0xFF,0xFF,0xFF,0x01,0xE7,0xBF,0xFF,0x0D,0x3F,0xFF,0x86,0x05,0x1F,0xFF,0x01,0x05,0x1F,0xFA,0x04,0xFF,0x18,0x88,0x00,0x00,0x00,0x00,0x05,0x1F,0x39,0x87,0x05,0x1F,0xFF,0x00,0x55,0xFF,0xFF,0x8F,0xFF,0xFF,0xFF,0x00,0x13,0x9F,0xFF,0x83,0x03,0x3F,0xFF,0x00,0x3C,0x5F,0xFF,0x8C,0xFF,0xFF,0xFF,0x00,0x86,0x9F,0xFF,0x87,0x05,0x1F,0xFF,0x00,0x05,0x1F,0x70,0x88,0x00,0x00,0x00,0x00,0x05,0x1F,0x95,0x87,0x05,0x1F,0xFF,0x00,0xCF,0x7F,0xFF,0x8E,0xFF,0xFF,0xFF,0x00,0xD7,0x3F,0xFF,0x84,0x03,0x3F,0xFF,0x00,0x23,0xDF,0xFF,0x8C,0xFF,0xFF,0xFF,0x01,0xF7,0xDF,0xFF,0x15,0x5F,0xFF,0x86,0x05,0x1F,0xFF,0x00,0x05,0x1F,0xCD,0x88,0x00,0x00,0x00,0x00,0x05,0x1F,0xE0,0x86,0x05,0x1F,0xFF,0x00,0x45,0xDF,
+    0xFF,0x8F,0xFF,0xFF,0xFF,0x00,0xA6,0x5F,0xFF,0x84,0x03,0x3F,0xFF,0x00,0x1B,0xBF,0xFF,0x8D,0xFF,0xFF,0xFF,0x00,0x7E,0x9F,0xFF,0x87,0x05,0x1F,0xFF,0x00,0x05,0x1F,0x1B,0x86,0x00,0x00,0x00,0x00,0x05,0x1F,0x24,0x87,0x05,0x1F,0xFF,0x00,0xA6,0xFF,0xFF,0x8F,0xFF,0xFF,0xFF,0x00,0x7D,0x9F,0xFF,0x84,0x03,0x3F,0xFF,0x00,0x1B,0xBF,0xFF,0x8D,0xFF,0xFF,0xFF,0x00,0xDF,0x9F,0xFF,0x87,0x05,0x1F,0xFF,0x00,0x05,0x1F,0x5C,0x86,0x00,0x00,0x00,0x00,0x05,0x1F,0x63,0x86,0x05,0x1F,0xFF,0x01,0x05,0x3F,0xFF,0xF7,0xDF,0xFF,0x8F,0xFF,0xFF,0xFF,0x00,0x5C,0xDF,0xFF,0x84,0x03,0x3F,0xFF,0x00,0x1B,0xBF,0xFF,0x8E,0xFF,0xFF,0xFF,0x00,0x35,0xBF,0xFF,0x86,0x05,0x1F,0xFF,0x00,0x05,0x1F,0x9B,0x86,0x00,0x00,0x00,0x00,0x05,0x1F,0x8F,0x86,0x05,0x1F,0xFF,0x00,0x45,0xDF,0xFF,0x90,0xFF,0xFF,0xFF,0x00,0x34,0x3F,0xFF,0x84,0x03,0x3F,0xFF,0x00,0x1B,0xBF,0xFF,0x8E,0xFF,0xFF,0xFF,0x00,0x7E,0x7F,0xFF,0x86,0x05,0x1F,0xFF,0x00,0x05,0x1F,0xC7,0x86,0x00,0x00,0x00,0x00,0x05,0x1F,0xB6,0x86,0x05,0x1F,0xFF,
+    0x00,0x7E,0x7F,0xFF,0x90,0xFF,0xFF,0xFF,0x00,0x0B,0x7F,0xFF,0x84,0x03,0x3F,0xFF,0x00,0x1B,0xBF,0xFF,0x8E,0xFF,0xFF,0xFF,0x00,0xB7,0x1F,0xFF,0x86,0x05,0x1F,0xFF,0x00,0x05,0x1F,0xEE,0x86,0x00,0x00,0x00,0x00,0x05,0x1F,0xD8,0x86,0x05,0x1F,0xFF,0x00,0xA6,0xFF,0xFF,0x8F,0xFF,0xFF,0xFF,0x00,0xE7,0x7F,0xFF,0x85,0x03,0x3F,0xFF,0x00,0x1B,0xBF,0xFF,0x8E,0xFF,0xFF,0xFF,0x00,0xDF,0x9F,0xFF,0x87,0x05,0x1F,0xFF,0x00,0x04,0xFF,0x12,0x85,0x00,0x00,0x00,0x00,0x05,0x1F,0xE8,0x86,0x05,0x1F,0xFF,0x00,0xC7,0x5F,0xFF,0x8F,0xFF,0xFF,0xFF,0x00,0xBE,0xDF,0xFF,0x85,0x03,0x3F,0xFF,0x00,0x1B,0xBF,0xFF,0x8F,0xFF,0xFF,0xFF,0x87,0x05,0x1F,0xFF,0x00,0x05,0x1F,0x21,0x85,0x00,0x00,0x00,0x00,0x05,0x1F,0xF5,0x86,0x05,0x1F,0xFF,0x00,0xCF,0x7F,0xFF,0x8F,0xFF,0xFF,0xFF,0x00,0x95,0xFF,0xFF,0x85,0x03,0x3F,0xFF,0x00,0x1B,0xBF,0xFF,0x8F,0xFF,0xFF,0xFF,0x00,0x0D,0x3F,0xFF,0x86,0x05,0x1F,0xFF,0x00,0x05,0x1F,0x2F,0x85,0x00,0x00,0x00,0x00,0x05,0x1F,0xFC,0x86,0x05,0x1F,0xFF,0x00,0xD7,0x9F,0xFF,
+    0x8C,0xFF,0xFF,0xFF,0x02,0xD7,0x3F,0xFF,0x85,0xBF,0xFF,0x34,0x3F,0xFF,0x86,0x03,0x3F,0xFF,0x00,0x1B,0xBF,0xFF,0x8F,0xFF,0xFF,0xFF,0x00,0x15,0x5F,0xFF,0x86,0x05,0x1F,0xFF,0x00,0x05,0x1F,0x37,0x85,0x00,0x00,0x00,0x00,0x05,0x1F,0xF2,0x86,0x05,0x1F,0xFF,0x00,0xCF,0x7F,0xFF,0x89,0xFF,0xFF,0xFF,0x02,0xF7,0xDF,0xFF,0x8D,0xDF,0xFF,0x23,0xDF,0xFF,0x89,0x03,0x3F,0xFF,0x00,0x1B,0xBF,0xFF,0x8F,0xFF,0xFF,0xFF,0x87,0x05,0x1F,0xFF,0x00,0x05,0x1F,0x2B,0x85,0x00,0x00,0x00,0x00,0x05,0x1F,0xE5,0x86,0x05,0x1F,0xFF,0x00,0xBF,0x3F,0xFF,0x89,0xFF,0xFF,0xFF,0x00,0x3C,0x7F,0xFF,0x8B,0x03,0x3F,0xFF,0x00,0x1B,0xBF,0xFF,0x8E,0xFF,0xFF,0xFF,0x00,0xF7,0xDF,0xFF,0x87,0x05,0x1F,0xFF,0x00,0x05,0x1F,0x1E,0x85,0x00,0x00,0x00,0x00,0x05,0x1F,0xD1,0x86,0x05,0x1F,0xFF,0x00,0x9E,0xDF,0xFF,0x88,0xFF,0xFF,0xFF,0x00,0xDF,0x5F,0xFF,0x8C,0x03,0x3F,0xFF,0x00,0x2C,0x1F,0xFF,0x8E,0xFF,0xFF,0xFF,0x00,0xD7,0x7F,0xFF,0x86,0x05,0x1F,0xFF,0x01,0x05,0x1F,0xFE,0x05,0x1F,0x0B,0x85,0x00,0x00,0x00,0x00,
+    0x05,0x1F,0xAC,0x86,0x05,0x1F,0xFF,0x00,0x6E,0x5F,0xFF,0x88,0xFF,0xFF,0xFF,0x00,0xDF,0x5F,0xFF,0x8C,0x03,0x3F,0xFF,0x00,0x7D,0x9F,0xFF,0x8E,0xFF,0xFF,0xFF,0x00,0xA6,0xFF,0xFF,0x86,0x05,0x1F,0xFF,0x00,0x05,0x1F,0xE3,0x86,0x00,0x00,0x00,0x00,0x05,0x1F,0x85,0x86,0x05,0x1F,0xFF,0x00,0x2D,0x9F,0xFF,0x89,0xFF,0xFF,0xFF,0x00,0x3C,0x5F,0xFF,0x8A,0x03,0x3F,0xFF,0x01,0x34,0x1F,0xFF,0xF7,0xDF,0xFF,0x8E,0xFF,0xFF,0xFF,0x00,0x6E,0x3F,0xFF,0x86,0x05,0x1F,0xFF,0x00,0x05,0x1F,0xBD,0x86,0x00,0x00,0x00,0x00,0x05,0x1F,0x54,0x87,0x05,0x1F,0xFF,0x00,0xE7,0xBF,0xFF,0x88,0xFF,0xFF,0xFF,0x03,0xF7,0xBF,0xFF,0x85,0xBF,0xFF,0x3C,0x5F,0xFF,0x23,0xFF,0xFF,0x85,0x23,0xDF,0xFF,0x02,0x34,0x1F,0xFF,0x85,0x9F,0xFF,0xF7,0xDF,0xFF,0x8F,0xFF,0xFF,0xFF,0x00,0x25,0x7F,0xFF,0x86,0x05,0x1F,0xFF,0x00,0x05,0x1F,0x8A,0x86,0x00,0x00,0x00,0x01,0x05,0x1F,0x13,0x05,0x1F,0xFD,0x86,0x05,0x1F,0xFF,0x00,0x8E,0xBF,0xFF,0xA4,0xFF,0xFF,0xFF,0x00,0xC7,0x5F,0xFF,0x87,0x05,0x1F,0xFF,0x00,0x05,0x1F,0x49,
+    0x87,0x00,0x00,0x00,0x00,0x05,0x1F,0xD0,0x86,0x05,0x1F,0xFF,0x00,0x2D,0x9F,0xFF,0xA4,0xFF,0xFF,0xFF,0x00,0x66,0x3F,0xFF,0x86,0x05,0x1F,0xFF,0x01,0x05,0x1F,0xFA,0x04,0xFF,0x0D,0x87,0x00,0x00,0x00,0x00,0x05,0x1F,0x7E,0x87,0x05,0x1F,0xFF,0x00,0xB7,0x1F,0xFF,0xA2,0xFF,0xFF,0xFF,0x00,0xE7,0xBF,0xFF,0x87,0x05,0x1F,0xFF,0x00,0x05,0x1F,0xB2,0x88,0x00,0x00,0x00,0x01,0x05,0x3F,0x1F,0x05,0x1F,0xFE,0x86,0x05,0x1F,0xFF,0x00,0x2D,0x9F,0xFF,0xA2,0xFF,0xFF,0xFF,0x00,0x66,0x3F,0xFF,0x87,0x05,0x1F,0xFF,0x00,0x05,0x1F,0x57,0x89,0x00,0x00,0x00,0x00,0x05,0x1F,0xBE,0x87,0x05,0x1F,0xFF,0x00,0x8E,0xBF,0xFF,0xA0,0xFF,0xFF,0xFF,0x00,0xC7,0x5F,0xFF,0x87,0x05,0x1F,0xFF,0x01,0x05,0x1F,0xEB,0x05,0x5F,0x09,0x89,0x00,0x00,0x00,0x00,0x05,0x1F,0x47,0x87,0x05,0x1F,0xFF,0x01,0x0D,0x3F,0xFF,0xCF,0x7F,0xFF,0x9E,0xFF,0xFF,0xFF,0x01,0xEF,0xDF,0xFF,0x25,0x7F,0xFF,0x87,0x05,0x1F,0xFF,0x00,0x05,0x1F,0x7D,0x8B,0x00,0x00,0x00,0x00,0x05,0x1F,0xCB,0x87,0x05,0x1F,0xFF,0x01,0x25,0x7F,0xFF,0xEF,
+    0xDF,0xFF,0x9D,0xFF,0xFF,0xFF,0x00,0x4D,0xFF,0xFF,0x87,0x05,0x1F,0xFF,0x01,0x05,0x1F,0xF1,0x05,0x3F,0x11,0x8B,0x00,0x00,0x00,0x01,0x05,0x1F,0x3E,0x05,0x1F,0xFE,0x87,0x05,0x1F,0xFF,0x01,0x35,0xBF,0xFF,0xF7,0xDF,0xFF,0x9B,0xFF,0xFF,0xFF,0x00,0x66,0x3F,0xFF,0x88,0x05,0x1F,0xFF,0x00,0x05,0x1F,0x75,0x8D,0x00,0x00,0x00,0x00,0x05,0x1F,0xA5,0x88,0x05,0x1F,0xFF,0x01,0x35,0xBF,0xFF,0xEF,0xBF,0xFF,0x99,0xFF,0xFF,0xFF,0x00,0x66,0x3F,0xFF,0x88,0x05,0x1F,0xFF,0x01,0x05,0x1F,0xDA,0x04,0x9F,0x07,0x8D,0x00,0x00,0x00,0x01,0x04,0xFF,0x18,0x05,0x1F,0xEA,0x88,0x05,0x1F,0xFF,0x01,0x25,0x7F,0xFF,0xCF,0x7F,0xFF,0x96,0xFF,0xFF,0xFF,0x01,0xEF,0xBF,0xFF,0x45,0xDF,0xFF,0x88,0x05,0x1F,0xFF,0x01,0x05,0x1F,0xFC,0x05,0x1F,0x3D,0x8F,0x00,0x00,0x00,0x01,0x04,0xFF,0x48,0x05,0x1F,0xFD,0x88,0x05,0x1F,0xFF,0x01,0x0D,0x3F,0xFF,0x8E,0xBF,0xFF,0x94,0xFF,0xFF,0xFF,0x01,0xAF,0x1F,0xFF,0x1D,0x5F,0xFF,0x89,0x05,0x1F,0xFF,0x00,0x05,0x1F,0x7C,0x91,0x00,0x00,0x00,0x00,0x05,0x1F,0x83,0x8A,0x05,
+    0x1F,0xFF,0x01,0x2D,0x9F,0xFF,0xAF,0x1F,0xFF,0x90,0xFF,0xFF,0xFF,0x01,0xCF,0x5F,0xFF,0x45,0xDF,0xFF,0x8A,0x05,0x1F,0xFF,0x01,0x05,0x1F,0xB7,0x04,0x1F,0x02,0x91,0x00,0x00,0x00,0x01,0x07,0xFF,0x01,0x05,0x1F,0x9D,0x8B,0x05,0x1F,0xFF,0x02,0x2D,0x9F,0xFF,0x8E,0xBF,0xFF,0xE7,0xBF,0xFF,0x8A,0xFF,0xFF,0xFF,0x02,0xF7,0xDF,0xFF,0xA6,0xFF,0xFF,0x45,0xDF,0xFF,0x8B,0x05,0x1F,0xFF,0x01,0x05,0x1F,0xCB,0x05,0x5F,0x0C,0x93,0x00,0x00,0x00,0x01,0x05,0xFF,0x04,0x05,0x1F,0xB0,0x8D,0x05,0x1F,0xFF,0x0A,0x2D,0x9F,0xFF,0x6E,0x5F,0xFF,0x96,0xDF,0xFF,0xB7,0x3F,0xFF,0xCF,0x5F,0xFF,0xD7,0x7F,0xFF,0xCF,0x7F,0xFF,0xBF,0x3F,0xFF,0x9E,0xDF,0xFF,0x76,0x7F,0xFF,0x3D,0xBF,0xFF,0x8D,0x05,0x1F,0xFF,0x01,0x05,0x1F,0xD7,0x05,0x1F,0x16,0x95,0x00,0x00,0x00,0x01,0x05,0x5F,0x03,0x05,0x1F,0x9B,0xA4,0x05,0x1F,0xFF,0x01,0x05,0x1F,0xCA,0x04,0xFF,0x15,0x97,0x00,0x00,0x00,0x02,0x07,0xFF,0x01,0x05,0x1F,0x82,0x05,0x1F,0xFD,0xA1,0x05,0x1F,0xFF,0x01,0x05,0x1F,0xAC,0x04,0xDF,0x0A,0x9A,0x00,0x00,0x00,
+    0x01,0x05,0x1F,0x42,0x05,0x1F,0xE7,0x9E,0x05,0x1F,0xFF,0x02,0x05,0x1F,0xF8,0x05,0x1F,0x6F,0x07,0xFF,0x01,0x9C,0x00,0x00,0x00,0x02,0x04,0xFF,0x18,0x05,0x1F,0xA4,0x05,0x1F,0xFE,0x9B,0x05,0x1F,0xFF,0x01,0x05,0x1F,0xC3,0x04,0xFF,0x2D,0xA0,0x00,0x00,0x00,0x01,0x04,0xFF,0x40,0x05,0x1F,0xC9,0x98,0x05,0x1F,0xFF,0x02,0x05,0x1F,0xDF,0x05,0x1F,0x5D,0x07,0xFF,0x01,0xA3,0x00,0x00,0x00,0x02,0x05,0x1F,0x45,0x05,0x1F,0xBD,0x05,0x1F,0xFD,0x93,0x05,0x1F,0xFF,0x02,0x05,0x1F,0xD2,0x05,0x1F,0x5D,0x05,0xFF,0x04,0xA7,0x00,0x00,0x00,0x03,0x05,0x3F,0x1F,0x05,0x1F,0x7B,0x05,0x1F,0xCD,0x05,0x1F,0xFD,0x8D,0x05,0x1F,0xFF,0x02,0x05,0x1F,0xDB,0x05,0x1F,0x8C,0x05,0x1F,0x31,0xAD,0x00,0x00,0x00,0x0E,0x04,0xFF,0x12,0x05,0x1F,0x50,0x05,0x1F,0x82,0x05,0x1F,0xA8,0x05,0x1F,0xCF,0x05,0x1F,0xE0,0x05,0x1F,0xEE,0x05,0x1F,0xFD,0x05,0x1F,0xF0,0x05,0x1F,0xE4,0x05,0x1F,0xD5,0x05,0x1F,0xAF,0x05,0x1F,0x8A,0x05,0x1F,0x5D,0x05,0x3F,0x1C,0xFF,0x00,0x00,0x00,0x99,0x00,0x00,0x00,
     };
 const lv_img_dsc_t ui_img_timeout_png = {
    .header.always_zero = 0,
    .header.w = 64,
    .header.h = 64,
    .data_size = sizeof(ui_img_timeout_png_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+   .header.cf = LV_IMG_CF_USER_ENCODED_1,
    .data = ui_img_timeout_png_data};
 
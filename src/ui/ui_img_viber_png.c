@@ -10,29 +10,19 @@
 #endif
 
 // IMAGE DATA: assets\viber.png
+// Run length encoded LV_IMG_CF_TRUE_COLOR, decoded by src/img_cache.cpp
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_viber_png_data[] = {
-0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x69,0xD4,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xD4,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x69,0xD4,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xD4,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x69,0xD4,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xD4,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x69,0xD4,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x72,0x55,0x82,0xD6,0x8B,0x37,0x8B,0x37,0x8B,0x37,0x8B,0x37,0x82,0xD6,0x72,0x55,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xD4,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x72,0x35,0x9B,0xF7,0xCE,0x1B,0xE6,0xFD,0xF7,0x5E,0xF7,0x9F,0xFF,0xDF,0xFF,0xDF,0xF7,0x9F,0xF7,0x5E,0xE6,0xFD,0xCE,0x1B,0x9B,0xF7,0x72,0x35,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x72,0x55,0xC5,0x7A,0xFF,0xDF,0xEF,0x3E,0xCE,0x1B,0xB5,0x39,0xA4,0xB7,0x9C,0x76,0x9C,0x76,0xA4,0xB7,0xB5,0x39,0xCE,0x1B,0xEF,0x3E,0xFF,0xDF,0xB5,0x39,0x72,0x35,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x43,0x89,0x43,0x89,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0xC5,0x7A,0xFF,0xDF,0xB5,0x39,0x6A,0x52,0x51,0x70,0x49,0x50,0x49,0x50,0x49,0x50,0x49,0x50,0x49,0x50,0x49,0x50,0x51,0x90,0x6A,0x52,0xAC,0xF8,0xD6,0xBA,0xA4,0xB7,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x43,0x89,
-    0x69,0xD4,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x8B,0x37,0xF7,0x9F,0xC5,0x7A,0x59,0xB1,0x49,0x50,0x62,0x11,0x59,0xF1,0x49,0x50,0x6A,0x52,0x9C,0x36,0x83,0x75,0x62,0x11,0x49,0x50,0x49,0x50,0x51,0x90,0xA4,0xB7,0xCE,0x79,0x7A,0xF4,0x69,0xF4,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xD4,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0xB5,0x39,0xF7,0x9F,0x72,0xF3,0x49,0x50,0x7A,0xF4,0xE6,0xFD,0xC5,0x7A,0x59,0xB1,0x59,0xB1,0x9C,0x36,0xA4,0xB7,0xA4,0xB7,0x6A,0x52,0x49,0x50,0x49,0x50,0x6A,0x92,0xCE,0x79,0x93,0xF5,0x59,0x92,0x69,0xF4,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,
-    0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0xCE,0x1B,0xE6,0xFD,0x59,0xF1,0x49,0x50,0xAC,0xF8,0xFF,0xDF,0xFF,0xDF,0x9C,0x36,0x51,0x70,0x83,0x75,0xA4,0xB7,0x9C,0x36,0x93,0xF5,0x59,0xB1,0x49,0x50,0x59,0xF1,0xC5,0xD8,0xAD,0x17,0x51,0x70,0x59,0x92,0x69,0xF4,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x72,0x35,0xDE,0x9D,0xD6,0x7C,0x51,0x90,0x49,0x50,0x83,0x74,0xFF,0xDF,0xFF,0xDF,0x93,0xF5,0x49,0x50,0x6A,0x52,0x93,0xF5,0x93,0xF5,0x93,0xF5,0x6A,0x92,0x49,0x50,0x51,0x90,0xB5,0x78,0xB5,0x78,0x51,0x90,0x51,0x70,0x59,0x92,0x69,0xF4,0x69,0xF5,0x69,0xF5,0x69,0xF5,
-    0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x72,0x55,0xE6,0xFD,0xCE,0x1B,0x51,0x90,0x51,0x70,0x59,0xB1,0xCE,0x1B,0xE6,0xFD,0x62,0x11,0x49,0x50,0x49,0x50,0x62,0x11,0x72,0xF3,0x83,0x74,0x72,0xF3,0x49,0x50,0x51,0x90,0xAD,0x17,0xBD,0x98,0x59,0xB1,0x51,0x70,0x51,0x70,0x59,0x92,0x69,0xF4,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x72,0x35,0xE6,0xFD,0xCE,0x1B,0x51,0x90,0x51,0x70,0x49,0x50,0x7A,0xF4,0xEF,0x3E,0x93,0xF5,0x49,0x50,0x49,0x50,0x49,0x50,0x51,0x70,0x59,0xB1,0x62,0x11,0x51,0x70,0x51,0x90,0xAD,0x17,0xBD,0x98,0x59,0xB1,0x51,0x70,0x51,0x70,0x51,0x70,0x59,0x92,0x69,0xF4,0x69,0xF5,
-    0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x72,0x35,0xDE,0x9D,0xD6,0x7C,0x59,0xB1,0x51,0x70,0x51,0x70,0x51,0x70,0x93,0xF5,0xC6,0x19,0x83,0x74,0x59,0xF1,0x83,0x74,0x83,0x74,0x51,0x90,0x49,0x50,0x51,0x70,0x59,0xB1,0xB5,0x78,0xB5,0x78,0x51,0x90,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x59,0x92,0x69,0xF4,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0xCE,0x1B,0xEF,0x3E,0x62,0x11,0x49,0x50,0x51,0x70,0x51,0x70,0x51,0x70,0x8B,0xD4,0xC6,0x19,0xC5,0xD8,0xCE,0x79,0xCE,0x79,0xA4,0xB7,0x59,0xB1,0x49,0x50,0x59,0xF1,0xC5,0xD8,0xA4,0xB7,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x59,0x92,
-    0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0xAC,0x99,0xFF,0xDF,0x83,0x74,0x49,0x50,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x6A,0x92,0xAD,0x17,0xCE,0x79,0xD6,0xBA,0xBD,0x98,0x59,0xF1,0x49,0x50,0x72,0xF3,0xCE,0x79,0x8B,0xD4,0x49,0x50,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x8B,0x37,0xF7,0x5E,0xCE,0x1B,0x62,0x11,0x49,0x50,0x51,0x70,0x51,0x70,0x51,0x70,0x49,0x50,0x59,0xB1,0x72,0xF3,0x9C,0x36,0x6A,0x92,0x49,0x50,0x62,0x11,0xB5,0x78,0xC6,0x19,0x6A,0x52,0x49,0x50,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,
-    0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0xAC,0x99,0xD6,0xBA,0xB5,0x78,0x72,0xF3,0x51,0x90,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x90,0x59,0xF1,0x72,0xF3,0xB5,0x78,0xCE,0x79,0x83,0x74,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x69,0xD4,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x9B,0xF7,0xC6,0x19,0xC6,0x19,0x6A,0x52,0x49,0x50,0x62,0x11,0x9C,0x76,0xAD,0x17,0xAD,0x17,0xB5,0x78,0xC5,0xD8,0xCE,0x79,0xC6,0x19,0x83,0x74,0x51,0x90,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x69,0xD4,
-    0x43,0x89,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x82,0xD6,0xAC,0xF8,0x6A,0x52,0x59,0xF1,0x9C,0x76,0xC5,0xD8,0xC5,0xD8,0xBD,0x98,0xB5,0x78,0xA4,0xB7,0x8B,0xD4,0x6A,0x52,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x43,0x89,0x43,0x89,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF4,0x9B,0xF7,0x72,0xF3,0x9C,0x36,0x72,0xF3,0x59,0xF1,0x59,0xF1,0x59,0xB1,0x51,0x90,0x51,0x70,0x49,0x50,0x49,0x50,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x9B,0xF7,0xAD,0x17,0x72,0xF3,0x49,0x50,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x69,0xD4,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x72,0x35,0x6A,0x92,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x69,0xD4,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF4,0x59,0x92,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x69,0xD4,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF4,0x59,0x92,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x69,0xD4,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF4,0x59,0x92,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x69,0xD4,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF4,0x59,0x92,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x69,0xD4,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF4,0x59,0x92,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x51,0x70,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x69,0xD4,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x69,0xF5,0x51,0x70,0x51,0x70,0x51,0x70,0x69,0xD4,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
+    0x89,0x43,0x89,0x00,0x69,0xD4,0x89,0x69,0xF5,0x00,0x69,0xD4,0x91,0x43,0x89,0x8F,0x69,0xF5,0x8D,0x43,0x89,0x00,0x69,0xD4,0x91,0x69,0xF5,0x00,0x69,0xD4,0x8A,0x43,0x89,0x95,0x69,0xF5,0x88,0x43,0x89,0x00,0x69,0xD4,0x95,0x69,0xF5,0x00,0x69,0xD4,0x86,0x43,0x89,0x99,0x69,0xF5,0x84,0x43,0x89,0x00,0x69,0xD4,0x88,0x69,0xF5,0x01,0x72,0x55,0x82,0xD6,0x83,0x8B,0x37,0x01,0x82,0xD6,0x72,0x55,0x88,0x69,0xF5,0x00,0x69,0xD4,0x83,0x43,0x89,0x86,0x69,0xF5,0x05,0x72,0x35,0x9B,0xF7,0xCE,0x1B,0xE6,0xFD,0xF7,0x5E,0xF7,0x9F,0x81,0xFF,0xDF,0x05,0xF7,0x9F,0xF7,0x5E,0xE6,0xFD,0xCE,0x1B,0x9B,0xF7,0x72,0x35,0x86,0x69,0xF5,0x82,0x43,0x89,0x86,0x69,0xF5,0x06,0x72,0x55,0xC5,0x7A,0xFF,0xDF,0xEF,0x3E,0xCE,0x1B,0xB5,0x39,0xA4,0xB7,0x81,0x9C,0x76,0x06,0xA4,0xB7,0xB5,0x39,0xCE,0x1B,0xEF,0x3E,0xFF,0xDF,0xB5,0x39,0x72,0x35,0x86,0x69,0xF5,0x81,0x43,0x89,0x86,0x69,0xF5,0x04,0xC5,0x7A,0xFF,0xDF,0xB5,0x39,0x6A,0x52,0x51,0x70,0x85,0x49,0x50,0x04,0x51,0x90,0x6A,0x52,0xAC,0xF8,0xD6,0xBA,0xA4,
+    0xB7,0x86,0x69,0xF5,0x01,0x43,0x89,0x69,0xD4,0x85,0x69,0xF5,0x0B,0x8B,0x37,0xF7,0x9F,0xC5,0x7A,0x59,0xB1,0x49,0x50,0x62,0x11,0x59,0xF1,0x49,0x50,0x6A,0x52,0x9C,0x36,0x83,0x75,0x62,0x11,0x81,0x49,0x50,0x04,0x51,0x90,0xA4,0xB7,0xCE,0x79,0x7A,0xF4,0x69,0xF4,0x84,0x69,0xF5,0x00,0x69,0xD4,0x86,0x69,0xF5,0x06,0xB5,0x39,0xF7,0x9F,0x72,0xF3,0x49,0x50,0x7A,0xF4,0xE6,0xFD,0xC5,0x7A,0x81,0x59,0xB1,0x00,0x9C,0x36,0x81,0xA4,0xB7,0x00,0x6A,0x52,0x81,0x49,0x50,0x04,0x6A,0x92,0xCE,0x79,0x93,0xF5,0x59,0x92,0x69,0xF4,0x8B,0x69,0xF5,0x04,0xCE,0x1B,0xE6,0xFD,0x59,0xF1,0x49,0x50,0xAC,0xF8,0x81,0xFF,0xDF,0x0D,0x9C,0x36,0x51,0x70,0x83,0x75,0xA4,0xB7,0x9C,0x36,0x93,0xF5,0x59,0xB1,0x49,0x50,0x59,0xF1,0xC5,0xD8,0xAD,0x17,0x51,0x70,0x59,0x92,0x69,0xF4,0x89,0x69,0xF5,0x05,0x72,0x35,0xDE,0x9D,0xD6,0x7C,0x51,0x90,0x49,0x50,0x83,0x74,0x81,0xFF,0xDF,0x02,0x93,0xF5,0x49,0x50,0x6A,0x52,0x82,0x93,0xF5,0x02,0x6A,0x92,0x49,0x50,0x51,0x90,0x81,0xB5,0x78,0x03,0x51,0x90,0x51,0x70,0x59,
+    0x92,0x69,0xF4,0x88,0x69,0xF5,0x08,0x72,0x55,0xE6,0xFD,0xCE,0x1B,0x51,0x90,0x51,0x70,0x59,0xB1,0xCE,0x1B,0xE6,0xFD,0x62,0x11,0x81,0x49,0x50,0x08,0x62,0x11,0x72,0xF3,0x83,0x74,0x72,0xF3,0x49,0x50,0x51,0x90,0xAD,0x17,0xBD,0x98,0x59,0xB1,0x81,0x51,0x70,0x01,0x59,0x92,0x69,0xF4,0x87,0x69,0xF5,0x08,0x72,0x35,0xE6,0xFD,0xCE,0x1B,0x51,0x90,0x51,0x70,0x49,0x50,0x7A,0xF4,0xEF,0x3E,0x93,0xF5,0x82,0x49,0x50,0x07,0x51,0x70,0x59,0xB1,0x62,0x11,0x51,0x70,0x51,0x90,0xAD,0x17,0xBD,0x98,0x59,0xB1,0x82,0x51,0x70,0x01,0x59,0x92,0x69,0xF4,0x86,0x69,0xF5,0x03,0x72,0x35,0xDE,0x9D,0xD6,0x7C,0x59,0xB1,0x82,0x51,0x70,0x03,0x93,0xF5,0xC6,0x19,0x83,0x74,0x59,0xF1,0x81,0x83,0x74,0x03,0x51,0x90,0x49,0x50,0x51,0x70,0x59,0xB1,0x81,0xB5,0x78,0x00,0x51,0x90,0x83,0x51,0x70,0x01,0x59,0x92,0x69,0xF4,0x86,0x69,0xF5,0x03,0xCE,0x1B,0xEF,0x3E,0x62,0x11,0x49,0x50,0x82,0x51,0x70,0x02,0x8B,0xD4,0xC6,0x19,0xC5,0xD8,0x81,0xCE,0x79,0x05,0xA4,0xB7,0x59,0xB1,0x49,0x50,0x59,0xF1,0xC5,0xD8,0xA4,
+    0xB7,0x85,0x51,0x70,0x00,0x59,0x92,0x86,0x69,0xF5,0x03,0xAC,0x99,0xFF,0xDF,0x83,0x74,0x49,0x50,0x83,0x51,0x70,0x0A,0x6A,0x92,0xAD,0x17,0xCE,0x79,0xD6,0xBA,0xBD,0x98,0x59,0xF1,0x49,0x50,0x72,0xF3,0xCE,0x79,0x8B,0xD4,0x49,0x50,0x85,0x51,0x70,0x86,0x69,0xF5,0x04,0x8B,0x37,0xF7,0x5E,0xCE,0x1B,0x62,0x11,0x49,0x50,0x82,0x51,0x70,0x0A,0x49,0x50,0x59,0xB1,0x72,0xF3,0x9C,0x36,0x6A,0x92,0x49,0x50,0x62,0x11,0xB5,0x78,0xC6,0x19,0x6A,0x52,0x49,0x50,0x85,0x51,0x70,0x87,0x69,0xF5,0x04,0xAC,0x99,0xD6,0xBA,0xB5,0x78,0x72,0xF3,0x51,0x90,0x84,0x51,0x70,0x05,0x51,0x90,0x59,0xF1,0x72,0xF3,0xB5,0x78,0xCE,0x79,0x83,0x74,0x87,0x51,0x70,0x00,0x69,0xD4,0x87,0x69,0xF5,0x00,0x9B,0xF7,0x81,0xC6,0x19,0x03,0x6A,0x52,0x49,0x50,0x62,0x11,0x9C,0x76,0x81,0xAD,0x17,0x05,0xB5,0x78,0xC5,0xD8,0xCE,0x79,0xC6,0x19,0x83,0x74,0x51,0x90,0x86,0x51,0x70,0x01,0x69,0xD4,0x43,0x89,0x88,0x69,0xF5,0x04,0x82,0xD6,0xAC,0xF8,0x6A,0x52,0x59,0xF1,0x9C,0x76,0x81,0xC5,0xD8,0x04,0xBD,0x98,0xB5,0x78,0xA4,
+    0xB7,0x8B,0xD4,0x6A,0x52,0x88,0x51,0x70,0x81,0x43,0x89,0x88,0x69,0xF5,0x04,0x69,0xF4,0x9B,0xF7,0x72,0xF3,0x9C,0x36,0x72,0xF3,0x81,0x59,0xF1,0x02,0x59,0xB1,0x51,0x90,0x51,0x70,0x81,0x49,0x50,0x88,0x51,0x70,0x82,0x43,0x89,0x88,0x69,0xF5,0x03,0x9B,0xF7,0xAD,0x17,0x72,0xF3,0x49,0x50,0x8E,0x51,0x70,0x83,0x43,0x89,0x00,0x69,0xD4,0x87,0x69,0xF5,0x01,0x72,0x35,0x6A,0x92,0x8F,0x51,0x70,0x00,0x69,0xD4,0x84,0x43,0x89,0x88,0x69,0xF5,0x01,0x69,0xF4,0x59,0x92,0x8E,0x51,0x70,0x86,0x43,0x89,0x00,0x69,0xD4,0x87,0x69,0xF5,0x01,0x69,0xF4,0x59,0x92,0x8B,0x51,0x70,0x00,0x69,0xD4,0x88,0x43,0x89,0x88,0x69,0xF5,0x01,0x69,0xF4,0x59,0x92,0x8A,0x51,0x70,0x8A,0x43,0x89,0x00,0x69,0xD4,0x87,0x69,0xF5,0x01,0x69,0xF4,0x59,0x92,0x87,0x51,0x70,0x00,0x69,0xD4,0x8D,0x43,0x89,0x87,0x69,0xF5,0x01,0x69,0xF4,0x59,0x92,0x85,0x51,0x70,0x91,0x43,0x89,0x00,0x69,0xD4,0x86,0x69,0xF5,0x82,0x51,0x70,0x00,0x69,0xD4,0x89,0x43,0x89,
     };
 const lv_img_dsc_t ui_img_viber_png = {
    .header.always_zero = 0,
    .header.w = 32,
    .header.h = 32,
    .data_size = sizeof(ui_img_viber_png_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR,
+   .header.cf = LV_IMG_CF_USER_ENCODED_0,
    .data = ui_img_viber_png_data};
 
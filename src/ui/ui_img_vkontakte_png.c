@@ -10,29 +10,18 @@
 #endif
 
 // IMAGE DATA: assets\vkontakte.png
+// Run length encoded LV_IMG_CF_TRUE_COLOR, decoded by src/img_cache.cpp
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_vkontakte_png_data[] = {
-0x43,0x89,0x43,0x89,0x43,0x89,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x43,0x89,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,
-    0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,
-    0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,
-    0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x2C,0x7F,0x4D,0x1F,0x4D,0x1F,0x44,0xDF,0x0B,0xFF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x0B,0xFF,0x44,0xDF,0x4D,0x1F,0x4D,0x1F,0x1C,0x3F,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x2C,0x7F,0x4D,0x1F,0x4D,0x1F,0x44,0xDF,0x0B,0xFF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,
-    0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x85,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xBF,0x2C,0x7F,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x1C,0x3F,0xDF,0x5F,0xFF,0xFF,0xFF,0xFF,0x6D,0x9F,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x0B,0xFF,0xB6,0xBF,0xFF,0xFF,0xFF,0xFF,0xB6,0xBF,0x0B,0xFF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x7D,0xDF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0x44,0xDF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x1C,0x3F,0xE7,0x9F,0xFF,0xFF,0xFF,0xFF,0x6D,0x9F,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x4D,0x1F,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0x6D,0x9F,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,
-    0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x6D,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0x3F,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x1C,0x3F,0xE7,0x9F,0xFF,0xFF,0xFF,0xFF,0x6D,0x9F,0x03,0xBF,0x03,0xBF,0x1C,0x3F,0xC7,0x1F,0xFF,0xFF,0xFF,0xFF,0xDF,0x5F,0x1C,0x3F,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x44,0xDF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0x85,0xFF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x1C,0x3F,0xE7,0x9F,0xFF,0xFF,0xFF,0xFF,0x6D,0x9F,0x03,0xBF,0x1C,0x3F,0xB6,0xBF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0x5D,0x3F,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,
-    0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x1C,0x3F,0xDF,0x5F,0xFF,0xFF,0xFF,0xFF,0xC7,0x1F,0x14,0x1F,0x03,0xBF,0x03,0xBF,0x1C,0x3F,0xE7,0x9F,0xFF,0xFF,0xFF,0xFF,0x85,0xFF,0x5D,0x3F,0xC7,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x85,0xFF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x0B,0xFF,0x9E,0x7F,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0x4D,0x1F,0x03,0xBF,0x03,0xBF,0x1C,0x3F,0xE7,0x9F,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xEF,0xBF,0x7D,0xDF,0x0B,0xFF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,
-    0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x5D,0x3F,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xC7,0x1F,0x14,0x1F,0x03,0xBF,0x1C,0x3F,0xE7,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xBF,0x1C,0x3F,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x0B,0xFF,0xC7,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0x7F,0x0B,0xFF,0x1C,0x3F,0xE7,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC7,0x1F,0x44,0xDF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,
-    0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x4D,0x1F,0xEF,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB6,0xBF,0x5D,0x3F,0xE7,0x9F,0xFF,0xFF,0xFF,0xFF,0x9E,0x7F,0x7D,0xDF,0xC7,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0x9F,0x44,0xDF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x7D,0xDF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6D,0x9F,0x03,0xBF,0x14,0x1F,0x85,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xDF,0x5F,0x2C,0x7F,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,
-    0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x0B,0xFF,0x7D,0xDF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6D,0x9F,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x7D,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x9E,0x7F,0x0B,0xFF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x4D,0x1F,0xC7,0x1F,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x6D,0x9F,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x0B,0xFF,0xB6,0xBF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0x44,0xDF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,
-    0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x14,0x1F,0x4D,0x1F,0x9E,0x7F,0xC7,0x1F,0xDF,0x5F,0xEF,0xBF,0x6D,0x9F,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x4D,0x1F,0xE7,0x9F,0xEF,0xBF,0xEF,0xBF,0x7D,0xDF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x0B,0xFF,0x1C,0x3F,0x2C,0x7F,0x14,0x1F,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x0B,0xFF,0x1C,0x3F,0x2C,0x7F,0x2C,0x7F,0x1C,0x3F,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,
-    0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,
-    0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,
-    0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x43,0x89,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x03,0xBF,0x43,0x89,0x43,0x89,0x43,0x89,
+    0x82,0x43,0x89,0x99,0x03,0xBF,0x84,0x43,0x89,0x9B,0x03,0xBF,0x82,0x43,0x89,0x9D,0x03,0xBF,0x00,0x43,0x89,0xFF,0x03,0xBF,0xC4,0x03,0xBF,0x00,0x2C,0x7F,0x81,0x4D,0x1F,0x01,0x44,0xDF,0x0B,0xFF,0x82,0x03,0xBF,0x01,0x0B,0xFF,0x44,0xDF,0x81,0x4D,0x1F,0x00,0x1C,0x3F,0x83,0x03,0xBF,0x00,0x2C,0x7F,0x81,0x4D,0x1F,0x01,0x44,0xDF,0x0B,0xFF,0x89,0x03,0xBF,0x00,0x85,0xFF,0x81,0xFF,0xFF,0x01,0xEF,0xBF,0x2C,0x7F,0x82,0x03,0xBF,0x01,0x1C,0x3F,0xDF,0x5F,0x81,0xFF,0xFF,0x00,0x6D,0x9F,0x82,0x03,0xBF,0x01,0x0B,0xFF,0xB6,0xBF,0x81,0xFF,0xFF,0x01,0xB6,0xBF,0x0B,0xFF,0x89,0x03,0xBF,0x00,0x7D,0xDF,0x81,0xFF,0xFF,0x01,0xF7,0xDF,0x44,0xDF,0x82,0x03,0xBF,0x01,0x1C,0x3F,0xE7,0x9F,0x81,0xFF,0xFF,0x00,0x6D,0x9F,0x82,0x03,0xBF,0x01,0x4D,0x1F,0xF7,0xDF,0x81,0xFF,0xFF,0x00,0x6D,0x9F,0x8A,0x03,0xBF,0x00,0x6D,0x9F,0x82,0xFF,0xFF,0x00,0x5D,0x3F,0x82,0x03,0xBF,0x01,0x1C,0x3F,0xE7,0x9F,0x81,0xFF,0xFF,0x00,0x6D,0x9F,0x81,0x03,0xBF,0x01,0x1C,0x3F,0xC7,0x1F,0x81,0xFF,0xFF,0x01,0xDF,0x5F,
+    0x1C,0x3F,0x8A,0x03,0xBF,0x01,0x44,0xDF,0xF7,0xDF,0x81,0xFF,0xFF,0x00,0x85,0xFF,0x82,0x03,0xBF,0x01,0x1C,0x3F,0xE7,0x9F,0x81,0xFF,0xFF,0x03,0x6D,0x9F,0x03,0xBF,0x1C,0x3F,0xB6,0xBF,0x81,0xFF,0xFF,0x01,0xF7,0xDF,0x5D,0x3F,0x8B,0x03,0xBF,0x01,0x1C,0x3F,0xDF,0x5F,0x81,0xFF,0xFF,0x01,0xC7,0x1F,0x14,0x1F,0x81,0x03,0xBF,0x01,0x1C,0x3F,0xE7,0x9F,0x81,0xFF,0xFF,0x02,0x85,0xFF,0x5D,0x3F,0xC7,0x1F,0x82,0xFF,0xFF,0x00,0x85,0xFF,0x8C,0x03,0xBF,0x01,0x0B,0xFF,0x9E,0x7F,0x81,0xFF,0xFF,0x01,0xF7,0xDF,0x4D,0x1F,0x81,0x03,0xBF,0x01,0x1C,0x3F,0xE7,0x9F,0x81,0xFF,0xFF,0x81,0xF7,0xDF,0x81,0xFF,0xFF,0x02,0xEF,0xBF,0x7D,0xDF,0x0B,0xFF,0x8D,0x03,0xBF,0x01,0x5D,0x3F,0xF7,0xDF,0x81,0xFF,0xFF,0x04,0xC7,0x1F,0x14,0x1F,0x03,0xBF,0x1C,0x3F,0xE7,0x9F,0x85,0xFF,0xFF,0x01,0xB6,0xBF,0x1C,0x3F,0x8E,0x03,0xBF,0x01,0x0B,0xFF,0xC7,0x1F,0x82,0xFF,0xFF,0x03,0x9E,0x7F,0x0B,0xFF,0x1C,0x3F,0xE7,0x9F,0x86,0xFF,0xFF,0x01,0xC7,0x1F,0x44,0xDF,0x8E,0x03,0xBF,0x01,0x4D,0x1F,0xEF,0xBF,0x82,0xFF,
+    0xFF,0x02,0xB6,0xBF,0x5D,0x3F,0xE7,0x9F,0x81,0xFF,0xFF,0x02,0x9E,0x7F,0x7D,0xDF,0xC7,0x1F,0x82,0xFF,0xFF,0x01,0xE7,0x9F,0x44,0xDF,0x8E,0x03,0xBF,0x01,0x7D,0xDF,0xF7,0xDF,0x82,0xFF,0xFF,0x00,0xF7,0xDF,0x82,0xFF,0xFF,0x04,0x6D,0x9F,0x03,0xBF,0x14,0x1F,0x85,0xFF,0xF7,0xDF,0x81,0xFF,0xFF,0x01,0xDF,0x5F,0x2C,0x7F,0x8D,0x03,0xBF,0x02,0x0B,0xFF,0x7D,0xDF,0xF7,0xDF,0x85,0xFF,0xFF,0x00,0x6D,0x9F,0x82,0x03,0xBF,0x00,0x7D,0xDF,0x82,0xFF,0xFF,0x01,0x9E,0x7F,0x0B,0xFF,0x8E,0x03,0xBF,0x02,0x4D,0x1F,0xC7,0x1F,0xF7,0xDF,0x83,0xFF,0xFF,0x00,0x6D,0x9F,0x82,0x03,0xBF,0x01,0x0B,0xFF,0xB6,0xBF,0x81,0xFF,0xFF,0x01,0xF7,0xDF,0x44,0xDF,0x8F,0x03,0xBF,0x06,0x14,0x1F,0x4D,0x1F,0x9E,0x7F,0xC7,0x1F,0xDF,0x5F,0xEF,0xBF,0x6D,0x9F,0x83,0x03,0xBF,0x01,0x4D,0x1F,0xE7,0x9F,0x81,0xEF,0xBF,0x00,0x7D,0xDF,0x92,0x03,0xBF,0x03,0x0B,0xFF,0x1C,0x3F,0x2C,0x7F,0x14,0x1F,0x83,0x03,0xBF,0x01,0x0B,0xFF,0x1C,0x3F,0x81,0x2C,0x7F,0x00,0x1C,0x3F,0xFF,0x03,0xBF,0xA4,0x03,0xBF,0x00,0x43,0x89,0x9D,
+    0x03,0xBF,0x82,0x43,0x89,0x9B,0x03,0xBF,0x84,0x43,0x89,0x99,0x03,0xBF,0x82,0x43,0x89,
     };
 const lv_img_dsc_t ui_img_vkontakte_png = {
    .header.always_zero = 0,
    .header.w = 32,
    .header.h = 32,
    .data_size = sizeof(ui_img_vkontakte_png_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR,
+   .header.cf = LV_IMG_CF_USER_ENCODED_0,
    .data = ui_img_vkontakte_png_data};
 
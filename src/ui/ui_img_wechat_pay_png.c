@@ -11,26 +11,15 @@
 
 // IMAGE DATA: assets\wechat_pay.png
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_wechat_pay_png_data[] = {
-0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x0E,0x41,0x0E,0x41,0x06,0x40,0x06,0x40,0x0E,0x41,0x26,0x64,0x26,0x64,0x06,0x40,0x06,0x40,0x06,0x40,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x06,0x60,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x60,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x16,0x62,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x60,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x06,0x60,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x0E,0x61,0x06,0x40,0x26,0xA4,0x26,0xA4,0x43,0x89,0x43,0x89,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x60,0x43,0x89,0x06,0x40,0x06,0x40,0x0E,0x61,0x43,0x89,
-    0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x16,0x62,0x26,0xA4,0x43,0x89,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x0E,0x41,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x43,0x89,0x43,0x89,0x06,0x60,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,
-    0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x36,0x86,0x46,0xA8,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x43,0x89,0x43,0x89,0x43,0x89,0x3E,0x87,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x26,0xA4,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x60,0x43,0x89,0x43,0x89,0x43,0x89,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,
-    0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x43,0x89,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x26,0xA4,0x43,0x89,0x43,0x89,0x43,0x89,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x43,0x89,0x43,0x89,0x26,0xA4,0x06,0x60,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x06,0x60,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,
-    0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x16,0x62,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,
-    0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x43,0x89,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x0E,0x61,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,
-    0x26,0xA4,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x26,0xA4,0x43,0x89,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x0E,0x61,0x0E,0x41,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x0E,0x61,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xEF,0xDD,0x16,0x62,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x26,0xA4,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x26,0xA4,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x26,0xA4,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x16,0x62,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x26,0xA4,0x06,0x40,0x06,0x40,0x0E,0x41,0x06,0x40,0x06,0x40,0x26,0xA4,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x06,0x40,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x06,0x60,0x06,0x40,0x06,0x40,0x16,0x62,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
+    0x00,0xCB,0x00,0xFF,0x00,0xCF,0x00,0xFF,0x08,0xCB,0x08,0xFF,0x08,0xCF,0x08,0xFF,0x10,0xCF,0x10,0xFF,0x21,0xCF,0x21,0xFF,0x21,0xD7,0x21,0xFF,0x31,0xD3,0x31,0xFF,0x39,0xD3,0x39,0xFF,0x4A,0x71,0x42,0xFF,0x42,0xD7,0x42,0xFF,0xEF,0xFB,0xEF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x99,0x99,0x99,0x99,0x90,0x00,0x02,0x20,0x02,0x55,0x00,0x09,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x99,0x99,0x99,0x99,0x99,0x91,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x99,0x99,0x99,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x99,0x99,0x99,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0x99,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x99,0x91,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x06,0x69,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,0x00,0x39,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x69,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x99,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xA0,0x00,0x00,0x00,0x00,0x00,0x99,0x98,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x99,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x06,0x99,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x96,0x19,0x99,0x91,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x99,0x99,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x99,0x99,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,
+    0x99,0x32,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x99,0x99,0xB4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x99,0x99,0x96,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x99,0x99,0x99,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x99,0x99,0x99,0x99,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x99,0x99,0x99,0x99,0x99,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x99,0x99,0x99,0x99,0x99,0x99,0x60,0x02,0x00,0x60,0x00,0x00,0x00,0x00,0x09,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x10,0x04,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x99,
     };
 const lv_img_dsc_t ui_img_wechat_pay_png = {
    .header.always_zero = 0,
    .header.w = 32,
    .header.h = 28,
    .data_size = sizeof(ui_img_wechat_pay_png_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR,
+   .header.cf = LV_IMG_CF_INDEXED_4BIT,
    .data = ui_img_wechat_pay_png_data};
 
@@ -11,28 +11,15 @@
 
 // IMAGE DATA: assets\wechat.png
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_wechat_png_data[] = {
-0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x96,0x2A,0xB6,0xD1,0xB6,0xD1,0x96,0x2A,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x96,0x2A,0xB6,0xD1,0xB6,0xD1,0x96,0x2A,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0xB6,0xD1,0xFF,0xDF,0xFF,0xDF,0xB6,0xD1,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0xB6,0xD1,0xFF,0xDF,0xFF,0xDF,0xB6,0xD1,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0xB6,0xD1,0xFF,0xDF,0xFF,0xDF,0xB6,0xD1,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0xB6,0xD1,0xFF,0xDF,0xFF,0xDF,0xB6,0xD1,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x96,0x2A,0xB6,0xD1,0xB6,0xD1,0x96,0x2A,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x96,0x2A,0xB6,0xD1,0xB6,0xD1,0x96,0x2A,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,
-    0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x96,0x2A,0xB6,0xD1,0xB6,0xD1,0x96,0x2A,0x8E,0x09,0x8E,0x09,0x96,0x2A,0xB6,0xD1,0xB6,0xD1,0x96,0x2A,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0xB6,0xD1,0xFF,0xDF,0xFF,0xDF,0xB6,0xD1,0x8E,0x09,0x8E,0x09,0xB6,0xD1,0xFF,0xDF,0xFF,0xDF,0xB6,0xD1,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,
-    0x43,0x89,0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0xB6,0xD1,0xFF,0xDF,0xFF,0xDF,0xB6,0xD1,0x8E,0x09,0x8E,0x09,0xB6,0xD1,0xFF,0xDF,0xFF,0xDF,0xB6,0xD1,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,0x43,0x89,0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x96,0x2A,0xB6,0xD1,0xB6,0xD1,0x96,0x2A,0x8E,0x09,0x8E,0x09,0x96,0x2A,0xB6,0xD1,0xB6,0xD1,0x96,0x2A,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,0x43,0x89,0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,
-    0x43,0x89,0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,0x43,0x89,0x43,0x89,0x8E,0x09,0x8E,0x09,0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,0x43,0x89,0x8E,0x09,0x8E,0x09,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x8E,0x09,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x8E,0x09,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
+    0x4A,0x71,0x42,0xFF,0x4A,0xC3,0x8C,0xFF,0x52,0xC7,0x94,0xFF,0x8C,0xDB,0xB5,0xFF,0xFF,0xFB,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x11,0x11,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00,0x00,0x01,0x11,0x11,0x23,0x32,0x11,0x11,0x23,0x32,0x11,0x11,0x10,0x00,0x00,0x00,0x00,0x11,0x11,0x11,0x34,0x43,0x11,0x11,0x34,0x43,0x11,0x11,0x11,0x00,0x00,0x00,0x00,
+    0x11,0x11,0x11,0x34,0x43,0x11,0x11,0x34,0x43,0x11,0x11,0x11,0x00,0x00,0x00,0x00,0x11,0x11,0x11,0x23,0x32,0x11,0x11,0x23,0x32,0x11,0x11,0x11,0x00,0x00,0x00,0x00,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x00,0x11,0x11,0x10,0x00,0x00,0x00,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x10,0x01,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x01,0x11,0x11,0x11,0x11,0x11,0x11,0x10,0x00,0x11,0x11,0x11,0x11,0x11,0x11,0x10,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x00,0x11,0x11,0x11,0x11,0x11,0x11,0x01,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x10,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x12,0x33,0x21,0x12,0x33,0x21,0x11,0x11,0x01,0x11,0x11,0x11,0x11,0x10,0x11,0x11,0x13,0x44,0x31,0x13,0x44,0x31,0x11,0x11,0x00,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x13,0x44,0x31,0x13,0x44,0x31,0x11,0x11,0x00,0x01,0x11,0x11,0x11,0x11,0x11,0x11,0x12,0x33,0x21,0x12,0x33,0x21,0x11,0x11,
+    0x00,0x01,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x00,0x01,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x00,0x11,0x11,0x00,0x01,0x10,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x00,0x11,0x00,0x00,0x00,0x00,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x11,0x11,0x11,0x11,0x11,0x11,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x11,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
     };
 const lv_img_dsc_t ui_img_wechat_png = {
    .header.always_zero = 0,
    .header.w = 32,
    .header.h = 32,
    .data_size = sizeof(ui_img_wechat_png_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR,
+   .header.cf = LV_IMG_CF_INDEXED_4BIT,
    .data = ui_img_wechat_png_data};
 
@@ -11,28 +11,13 @@
 
 // IMAGE DATA: assets\weibo.png
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_weibo_png_data[] = {
-0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,
-    0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,
-    0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0x43,0x89,
-    0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,
-    0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,
-    0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0xD8,0x82,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
+    0x4A,0x71,0x42,0xFF,0x10,0x10,0xDE,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xF0,0x00,0x00,0x0F,0xFC,0x00,0x00,0x0F,0xFE,0x00,0x1E,0x00,0x7E,0x00,0x7F,0x07,0xDF,0x01,0xFF,0x87,0xEF,0x03,0xFF,0x87,0xF7,0x07,0xFF,0xFF,0xF7,0x0F,0xFF,0xFF,0x77,0x1F,0xFF,0xFF,0xF7,0x3F,0xFF,0xFF,0xF7,0x7F,0xFF,0xFF,0x07,0x7F,0xE0,0xFF,0xC6,0xFF,0x3E,0x1F,0xE0,0xFC,0xFF,0x8F,0xF0,0xF9,0xFF,0x87,0xF8,0xF1,0xFF,0xC3,0xF8,0xF3,0xFF,0xC3,0xF8,0xF3,0xFF,0xC7,0xF8,0xF3,0xDF,0xC7,0xF0,0xF9,0xFF,0x8F,0xF0,0x7D,0xFF,0x9F,0xE0,0x7F,0xFE,0xFF,0xC0,0x1F,0xFF,0xFF,0x00,0x0F,0xFF,0xFC,0x00,0x01,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
     };
 const lv_img_dsc_t ui_img_weibo_png = {
    .header.always_zero = 0,
    .header.w = 32,
    .header.h = 32,
    .data_size = sizeof(ui_img_weibo_png_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR,
+   .header.cf = LV_IMG_CF_INDEXED_1BIT,
    .data = ui_img_weibo_png_data};
 
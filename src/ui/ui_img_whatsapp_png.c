@@ -10,29 +10,17 @@
 #endif
 
 // IMAGE DATA: assets\whatsapp.png
+// Run length encoded LV_IMG_CF_TRUE_COLOR, decoded by src/img_cache.cpp
 const LV_ATTRIBUTE_MEM_ALIGN uint8_t ui_img_whatsapp_png_data[] = {
-0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x69,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x69,0x7E,0x30,0xBE,0xF7,0xBE,0xF7,0x75,0xEE,0x4D,0x69,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x69,0x7E,0x30,0xEF,0xBD,0xFF,0xFF,0xFF,0xFF,0xBE,0xF7,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x43,0x89,0x43,0x89,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x55,0x8A,0xCF,0x39,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xEF,0xBD,0x75,0xEE,0x4D,0x69,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x43,0x89,
-    0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x69,0x75,0xEE,0xEF,0xBD,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xA6,0xB4,0x4D,0x69,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x69,0x7E,0x30,0xF7,0xDE,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xDF,0x7B,0x5D,0xAB,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,
-    0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x69,0x7E,0x30,0xF7,0xDE,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xDF,0x7B,0x5D,0xAB,0x4D,0x69,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x69,0x65,0xCC,0xE7,0x9C,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xEF,0xBD,0x7E,0x30,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,
-    0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0xBE,0xF7,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xBE,0xF7,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x69,0x75,0xEE,0xEF,0xBD,0xFF,0xDF,0xFF,0xDF,0xDF,0x7B,0x65,0xCC,0x4D,0x69,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,
-    0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0xA6,0xB4,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xBE,0xF7,0x55,0x8A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x55,0x8A,0xC7,0x18,0xFF,0xDF,0xFF,0xDF,0xF7,0xDE,0xAE,0xD5,0x55,0x8A,0x4D,0x69,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x69,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,
-    0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x69,0x65,0xCC,0xDF,0x7B,0xFF,0xDF,0xFF,0xDF,0xF7,0xDE,0xAE,0xD5,0x5D,0xAB,0x4D,0x69,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x8E,0x72,0xBE,0xF7,0x7E,0x30,0x55,0x8A,0x4D,0x69,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x75,0xEE,0xE7,0x9C,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xCF,0x39,0x7E,0x30,0x55,0x8A,0x4D,0x69,0x7E,0x30,0xEF,0xBD,0xFF,0xFF,0xF7,0xDE,0xC7,0x18,0x7E,0x30,0x55,0x8A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,
-    0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x69,0x7E,0x30,0xDF,0x7B,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xEF,0xBD,0xC7,0x18,0xA6,0xB4,0xE7,0x9C,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xF7,0xDE,0xA6,0xB4,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x69,0x4D,0x69,0x75,0xEE,0xCF,0x39,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xAE,0xD5,0x4D,0x69,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,
-    0x43,0x89,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x69,0x5D,0xAB,0xAE,0xD5,0xEF,0xBD,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xF7,0xDE,0x8E,0x72,0x4D,0x69,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x43,0x89,0x43,0x89,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x69,0x4D,0x6A,0x75,0xEE,0xAE,0xD5,0xE7,0x9C,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xFF,0xDF,0xF7,0xDE,0xBE,0xF7,0x55,0x8A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x69,0x4D,0x6A,0x65,0xCC,0x8E,0x72,0xBE,0xF7,0xDF,0x7B,0xDF,0x7B,0xC7,0x18,0x8E,0x72,0x55,0x8A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x69,0x4D,0x69,0x4D,0x6A,0x5D,0xAB,0x5D,0xAB,0x55,0x8A,0x4D,0x69,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x43,0x89,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x43,0x89,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
-    0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x43,0x89,0x43,0x89,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x4D,0x6A,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,0x43,0x89,
+    0x89,0x43,0x89,0x8B,0x4D,0x6A,0x91,0x43,0x89,0x8F,0x4D,0x6A,0x8D,0x43,0x89,0x93,0x4D,0x6A,0x8A,0x43,0x89,0x95,0x4D,0x6A,0x88,0x43,0x89,0x97,0x4D,0x6A,0x86,0x43,0x89,0x99,0x4D,0x6A,0x84,0x43,0x89,0x85,0x4D,0x6A,0x00,0x4D,0x69,0x94,0x4D,0x6A,0x83,0x43,0x89,0x84,0x4D,0x6A,0x01,0x4D,0x69,0x7E,0x30,0x81,0xBE,0xF7,0x01,0x75,0xEE,0x4D,0x69,0x90,0x4D,0x6A,0x82,0x43,0x89,0x84,0x4D,0x6A,0x02,0x4D,0x69,0x7E,0x30,0xEF,0xBD,0x81,0xFF,0xFF,0x00,0xBE,0xF7,0x92,0x4D,0x6A,0x81,0x43,0x89,0x84,0x4D,0x6A,0x01,0x55,0x8A,0xCF,0x39,0x82,0xFF,0xDF,0x02,0xEF,0xBD,0x75,0xEE,0x4D,0x69,0x90,0x4D,0x6A,0x00,0x43,0x89,0x84,0x4D,0x6A,0x02,0x4D,0x69,0x75,0xEE,0xEF,0xBD,0x83,0xFF,0xDF,0x01,0xA6,0xB4,0x4D,0x69,0x96,0x4D,0x6A,0x02,0x4D,0x69,0x7E,0x30,0xF7,0xDE,0x83,0xFF,0xDF,0x01,0xDF,0x7B,0x5D,0xAB,0x96,0x4D,0x6A,0x02,0x4D,0x69,0x7E,0x30,0xF7,0xDE,0x83,0xFF,0xDF,0x02,0xDF,0x7B,0x5D,0xAB,0x4D,0x69,0x95,0x4D,0x6A,0x02,0x4D,0x69,0x65,0xCC,0xE7,0x9C,0x82,0xFF,0xDF,0x01,0xEF,0xBD,0x7E,
+    0x30,0x99,0x4D,0x6A,0x00,0xBE,0xF7,0x82,0xFF,0xDF,0x00,0xBE,0xF7,0x99,0x4D,0x6A,0x02,0x4D,0x69,0x75,0xEE,0xEF,0xBD,0x81,0xFF,0xDF,0x02,0xDF,0x7B,0x65,0xCC,0x4D,0x69,0x99,0x4D,0x6A,0x00,0xA6,0xB4,0x82,0xFF,0xDF,0x01,0xBE,0xF7,0x55,0x8A,0x99,0x4D,0x6A,0x01,0x55,0x8A,0xC7,0x18,0x81,0xFF,0xDF,0x03,0xF7,0xDE,0xAE,0xD5,0x55,0x8A,0x4D,0x69,0x85,0x4D,0x6A,0x00,0x4D,0x69,0x90,0x4D,0x6A,0x02,0x4D,0x69,0x65,0xCC,0xDF,0x7B,0x81,0xFF,0xDF,0x03,0xF7,0xDE,0xAE,0xD5,0x5D,0xAB,0x4D,0x69,0x82,0x4D,0x6A,0x04,0x8E,0x72,0xBE,0xF7,0x7E,0x30,0x55,0x8A,0x4D,0x69,0x90,0x4D,0x6A,0x01,0x75,0xEE,0xE7,0x9C,0x82,0xFF,0xDF,0x0A,0xCF,0x39,0x7E,0x30,0x55,0x8A,0x4D,0x69,0x7E,0x30,0xEF,0xBD,0xFF,0xFF,0xF7,0xDE,0xC7,0x18,0x7E,0x30,0x55,0x8A,0x8F,0x4D,0x6A,0x02,0x4D,0x69,0x7E,0x30,0xDF,0x7B,0x82,0xFF,0xDF,0x03,0xEF,0xBD,0xC7,0x18,0xA6,0xB4,0xE7,0x9C,0x83,0xFF,0xDF,0x01,0xF7,0xDE,0xA6,0xB4,0x8F,0x4D,0x6A,0x81,0x4D,0x69,0x01,0x75,0xEE,0xCF,0x39,0x8A,0xFF,0xDF,0x01,0xAE,0xD5,0x4D,0x69,
+    0x84,0x4D,0x6A,0x00,0x43,0x89,0x8A,0x4D,0x6A,0x03,0x4D,0x69,0x5D,0xAB,0xAE,0xD5,0xEF,0xBD,0x87,0xFF,0xDF,0x02,0xF7,0xDE,0x8E,0x72,0x4D,0x69,0x83,0x4D,0x6A,0x81,0x43,0x89,0x8B,0x4D,0x6A,0x04,0x4D,0x69,0x4D,0x6A,0x75,0xEE,0xAE,0xD5,0xE7,0x9C,0x84,0xFF,0xDF,0x02,0xF7,0xDE,0xBE,0xF7,0x55,0x8A,0x84,0x4D,0x6A,0x82,0x43,0x89,0x8C,0x4D,0x6A,0x04,0x4D,0x69,0x4D,0x6A,0x65,0xCC,0x8E,0x72,0xBE,0xF7,0x81,0xDF,0x7B,0x02,0xC7,0x18,0x8E,0x72,0x55,0x8A,0x84,0x4D,0x6A,0x83,0x43,0x89,0x8E,0x4D,0x6A,0x81,0x4D,0x69,0x00,0x4D,0x6A,0x81,0x5D,0xAB,0x01,0x55,0x8A,0x4D,0x69,0x85,0x4D,0x6A,0x83,0x43,0x89,0x9A,0x4D,0x6A,0x84,0x43,0x89,0x99,0x4D,0x6A,0x84,0x43,0x89,0x99,0x4D,0x6A,0x85,0x43,0x89,0x98,0x4D,0x6A,0x85,0x43,0x89,0x85,0x4D,0x6A,0x81,0x43,0x89,0x8F,0x4D,0x6A,0x87,0x43,0x89,0x82,0x4D,0x6A,0x86,0x43,0x89,0x8B,0x4D,0x6A,0x89,0x43,0x89,
     };
 const lv_img_dsc_t ui_img_whatsapp_png = {
    .header.always_zero = 0,
    .header.w = 32,
    .header.h = 32,
    .data_size = sizeof(ui_img_whatsapp_png_data),
-   .header.cf = LV_IMG_CF_TRUE_COLOR,
+   .header.cf = LV_IMG_CF_USER_ENCODED_0,
    .data = ui_img_whatsapp_png_data};
 
@@ -0,0 +1,284 @@
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include <lvgl.h>
+#include "blend.h"
+
+#define BUF_W 101 // odd, rows start at both alignments
+#define BUF_H 40
+
+static lv_disp_t *disp;
+static lv_draw_ctx_t *drawCtx;
+static const lv_area_t bufArea = {0, 0, BUF_W - 1, BUF_H - 1};
+static uint32_t seed = 1;
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+static uint32_t rnd()
+{
+  seed = seed * 1103515245 + 12345;
+  return seed >> 8;
+}
+
+/* Backgrounds like the UI draws on: runs of one color, often black */
+static void randomPixels(uint16_t *px, size_t count)
+{
+  for (size_t i = 0; i < count;)
+  {
+    uint16_t color = rnd() % 4 ? rnd() : 0;
+    for (size_t run = 1 + rnd() % 16; run && i < count; run--, i++)
+    {
+      px[i] = color;
+    }
+  }
+}
+
+/* Masks like anti-aliased edges and glyphs: runs of transparent, covered and partial pixels */
+static void randomMask(lv_opa_t *mask, size_t count)
+{
+  for (size_t i = 0; i < count;)
+  {
+    uint32_t kind = rnd() % 3;
+    for (size_t run = 1 + rnd() % 8; run && i < count; run--, i++)
+    {
+      mask[i] = kind == 0 ? LV_OPA_TRANSP : kind == 1 ? LV_OPA_COVER : rnd();
+    }
+  }
+}
+
+static lv_opa_t randomOpa()
+{
+  switch (rnd() % 4)
+  {
+  case 0:
+    return LV_OPA_COVER;
+  case 1:
+    return LV_OPA_MAX + rnd() % 2; // lvgl's own kernel
+  default:
+    return LV_OPA_MIN + 1 + rnd() % (LV_OPA_MAX - LV_OPA_MIN - 1);
+  }
+}
+
+static uint16_t lvMix(uint16_t fg, uint16_t bg, lv_opa_t mix)
+{
+  lv_color_t c1, c2;
+  c1.full = fg;
+  c2.full = bg;
+  return lv_color_mix(c1, c2, mix).full;
+}
+
+/* lvgl's per pixel rule for a mask without an opacity */
+static uint16_t lvMaskPx(uint16_t fg, uint16_t bg, lv_opa_t mask)
+{
+  return mask == LV_OPA_COVER ? fg : mask ? lvMix(fg, bg, mask) : bg;
+}
+
+static void test_kernels_match_lv_color_mix()
+{
+  std::vector<uint16_t> dest(BUF_W * BUF_H), expected(BUF_W * BUF_H), src(BUF_W * BUF_H);
+  std::vector<lv_opa_t> mask(BUF_W * BUF_H);
+  uint32_t mismatches = 0;
+
+  for (int opa = LV_OPA_MIN + 1; opa <= LV_OPA_COVER; opa++)
+  {
+    if (opa >= LV_OPA_MAX && opa < LV_OPA_COVER)
+    {
+      continue;
+    }
+    for (int kernel = 0; kernel < 3; kernel++)
+    {
+      randomPixels(dest.data(), dest.size());
+      randomPixels(src.data(), src.size());
+      randomMask(mask.data(), mask.size());
+      uint16_t color = rnd();
+      int32_t x1 = rnd() % 4, y1 = rnd() % 4;
+      int32_t w = 1 + rnd() % (BUF_W - x1), h = 1 + rnd() % (BUF_H - y1);
+      int32_t srcStride = w + rnd() % 2; // images may start off by a pixel from the buffer
+      expected = dest;
+
+      uint16_t *d = dest.data() + y1 * BUF_W + x1;
+      for (int32_t y = 0; y < h; y++)
+      {
+        for (int32_t x = 0; x < w; x++)
+        {
+          uint16_t &e = expected[(y1 + y) * BUF_W + x1 + x];
+          uint16_t s = src[y * srcStride + x];
+          lv_opa_t m = mask[y * w + x];
+          e = kernel == 0 ? (opa == LV_OPA_COVER ? s : lvMix(s, e, opa)) : lvMaskPx(kernel == 1 ? s : color, e, m);
+        }
+      }
+
+      if (kernel == 0)
+      {
+        blendMap(d, BUF_W, w, h, src.data(), srcStride, opa);
+      }
+      else if (kernel == 1)
+      {
+        blendMapMask(d, BUF_W, w, h, src.data(), srcStride, mask.data(), w);
+      }
+      else
+      {
+        blendFillMask(d, BUF_W, w, h, color, mask.data(), w);
+      }
+      mismatches += dest != expected;
+    }
+  }
+  TEST_ASSERT_EQUAL(0, mismatches);
+}
+
+static void blendSetup(uint16_t *buf, const lv_area_t *clip)
+{
+  drawCtx->buf = buf;
+  drawCtx->buf_area = &bufArea;
+  drawCtx->clip_area = clip;
+}
+
+/* The installed blend callback against lv_draw_sw_blend_basic, whole draw descriptors */
+static void test_blend_matches_lvgl()
+{
+  std::vector<uint16_t> ours(BUF_W * BUF_H), theirs(BUF_W * BUF_H), src(BUF_W * BUF_H);
+  std::vector<lv_opa_t> mask(BUF_W * BUF_H);
+  uint32_t mismatches = 0;
+
+  for (int i = 0; i < 20000; i++)
+  {
+    randomPixels(ours.data(), ours.size());
+    theirs = ours;
+    randomPixels(src.data(), src.size());
+    randomMask(mask.data(), mask.size());
+
+    lv_area_t clip;
+    clip.x1 = rnd() % BUF_W;
+    clip.y1 = rnd() % BUF_H;
+    clip.x2 = clip.x1 + rnd() % (BUF_W - clip.x1);
+    clip.y2 = clip.y1 + rnd() % (BUF_H - clip.y1);
+    // blend areas stick out of the clip area, mask areas are the blend area
+    lv_area_t area;
+    area.x1 = (int32_t)(rnd() % BUF_W) - 4;
+    area.y1 = (int32_t)(rnd() % BUF_H) - 4;
+    area.x2 = area.x1 + rnd() % (BUF_W / 2);
+    area.y2 = area.y1 + rnd() % (BUF_H / 2);
+
+    lv_draw_sw_blend_dsc_t dsc;
+    memset(&dsc, 0, sizeof(dsc));
+    dsc.blend_area = &area;
+    dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+    dsc.opa = randomOpa();
+    dsc.color.full = rnd();
+    dsc.src_buf = rnd() % 2 ? (const lv_color_t *)src.data() : NULL;
+    if (rnd() % 2)
+    {
+      dsc.mask_buf = mask.data();
+      dsc.mask_area = &area;
+      uint32_t res = rnd() % 8;
+      dsc.mask_res = res == 0 ? LV_DRAW_MASK_RES_TRANSP : res == 1 ? LV_DRAW_MASK_RES_FULL_COVER : LV_DRAW_MASK_RES_CHANGED;
+    }
+    else
+    {
+      dsc.mask_res = LV_DRAW_MASK_RES_FULL_COVER;
+    }
+
+    // lv_draw_sw_blend drops what is almost transparent before the callback
+    if (dsc.opa > LV_OPA_MIN)
+    {
+      blendSetup(ours.data(), &clip);
+      ((lv_draw_sw_ctx_t *)drawCtx)->blend(drawCtx, &dsc);
+      blendSetup(theirs.data(), &clip);
+      lv_draw_sw_blend_basic(drawCtx, &dsc);
+    }
+    mismatches += ours != theirs;
+  }
+  TEST_ASSERT_EQUAL(0, mismatches);
+}
+
+/* [us] per blend of a 480 x 40 draw buffer strip */
+static double timeBlend(void (*blend)(lv_draw_ctx_t *, const lv_draw_sw_blend_dsc_t *), const lv_draw_sw_blend_dsc_t &dsc,
+                        uint16_t *buf, const std::vector<uint16_t> &background)
+{
+  const int rounds = 200;
+  double total = 0;
+  for (int i = 0; i < rounds; i++)
+  {
+    memcpy(buf, background.data(), background.size() * sizeof(uint16_t));
+    auto start = std::chrono::steady_clock::now();
+    blend(drawCtx, &dsc);
+    total += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+  }
+  return total / rounds;
+}
+
+static void test_benchmark()
+{
+  const lv_area_t strip = {0, 0, 479, 39};
+  std::vector<uint16_t> buf(480 * 40), background(480 * 40), src(480 * 40);
+  std::vector<lv_opa_t> mask(480 * 40);
+  randomPixels(background.data(), background.size());
+  randomPixels(src.data(), src.size());
+  randomMask(mask.data(), mask.size());
+  drawCtx->buf = buf.data();
+  drawCtx->buf_area = &strip;
+  drawCtx->clip_area = &strip;
+
+  static const char *names[] = {"fill, opa 50%", "fill, mask", "image, opa 50%", "image, mask"};
+  for (int i = 0; i < 4; i++)
+  {
+    lv_draw_sw_blend_dsc_t dsc;
+    memset(&dsc, 0, sizeof(dsc));
+    dsc.blend_area = &strip;
+    dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+    dsc.color.full = 0x1234;
+    dsc.src_buf = i >= 2 ? (const lv_color_t *)src.data() : NULL;
+    dsc.opa = i % 2 ? LV_OPA_COVER : LV_OPA_50;
+    dsc.mask_res = LV_DRAW_MASK_RES_FULL_COVER;
+    if (i % 2)
+    {
+      dsc.mask_buf = mask.data();
+      dsc.mask_area = &strip;
+      dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+    }
+
+    double pair = timeBlend(((lv_draw_sw_ctx_t *)drawCtx)->blend, dsc, buf.data(), background);
+    double lvgl = timeBlend(lv_draw_sw_blend_basic, dsc, buf.data(), background);
+    char line[96];
+    snprintf(line, sizeof(line), "480x40 %s: %.1f us, lvgl %.1f us", names[i], pair, lvgl);
+    TEST_MESSAGE(line);
+  }
+}
+
+static void flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *pixels)
+{
+  lv_disp_flush_ready(drv);
+}
+
+int main(int argc, char **argv)
+{
+  // a display with the kernels installed, lv_draw_sw_blend_basic reads the refreshing one
+  static lv_color_t pixels[480 * 10];
+  static lv_disp_draw_buf_t drawBuf;
+  static lv_disp_drv_t drv;
+  lv_init();
+  lv_disp_draw_buf_init(&drawBuf, pixels, NULL, 480 * 10);
+  lv_disp_drv_init(&drv);
+  drv.hor_res = 480;
+  drv.ver_res = 320;
+  drv.flush_cb = flush;
+  drv.draw_buf = &drawBuf;
+  blendAttach(&drv);
+  disp = lv_disp_drv_register(&drv);
+  _lv_refr_set_disp_refreshing(disp);
+  drawCtx = disp->driver->draw_ctx;
+
+  UNITY_BEGIN();
+  RUN_TEST(test_kernels_match_lv_color_mix);
+  RUN_TEST(test_blend_matches_lvgl);
+  RUN_TEST(test_benchmark);
+  return UNITY_END();
+}
@@ -0,0 +1,98 @@
+#include <unity.h>
+#include "clock_face.h"
+
+#define DAY_MS (24UL * 3600 * 1000)
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+/* The angle the RTC time asks for, computed independently of the frame schedule */
+static uint32_t exactAngle(uint64_t t, uint32_t resolution)
+{
+  uint64_t tenths = t % 60000 * 3600 / 60000;
+  return (uint32_t)(tenths / resolution * resolution);
+}
+
+struct DayRun
+{
+  uint32_t frames;
+  uint32_t drifted; // frames whose angle is not the RTC's
+  uint32_t idle;    // frames that changed nothing on screen
+  uint32_t missed;  // deadlines past the next visible step
+};
+
+/*
+  Runs the render loop against a virtual RTC for a day: each frame sets the hand from the time and
+  sleeps until the returned deadline, woken up to `late` ms after it.
+*/
+static DayRun runDay(uint32_t resolution, uint32_t late)
+{
+  DayRun run = {};
+  uint64_t t = 0;
+  uint32_t shown = 0;
+  uint32_t seed = 1;
+  while (t < DAY_MS)
+  {
+    uint32_t ms = t % 60000;
+    uint32_t angle = sweepAngle(ms, resolution);
+    run.drifted += angle != exactAngle(t, resolution);
+    run.idle += run.frames && ms && angle == shown;
+    shown = angle;
+    run.frames++;
+
+    uint32_t next = sweepNextMs(angle, resolution);
+    run.missed += next <= ms || sweepAngle(next - 1, resolution) != angle;
+    seed = seed * 1103515245 + 12345;
+    t += next - ms + (late ? (seed >> 16) % (late + 1) : 0);
+  }
+  return run;
+}
+
+static void test_frame_per_step()
+{
+  // one frame per visible step, 3600 / resolution per minute rounded up, and none in between
+  const uint32_t resolutions[] = {1, 6, 10, 60, 7};
+  for (uint32_t resolution : resolutions)
+  {
+    DayRun run = runDay(resolution, 0);
+    TEST_ASSERT_EQUAL_UINT32((3600 + resolution - 1) / resolution * 24 * 60, run.frames);
+    TEST_ASSERT_EQUAL_UINT32(0, run.drifted);
+    TEST_ASSERT_EQUAL_UINT32(0, run.idle);
+    TEST_ASSERT_EQUAL_UINT32(0, run.missed);
+  }
+}
+
+static void test_late_frames_do_not_drift()
+{
+  // woken up to 15 ms late, the hand still shows the RTC angle every frame
+  const uint32_t resolutions[] = {1, 10};
+  for (uint32_t resolution : resolutions)
+  {
+    DayRun run = runDay(resolution, 15);
+    TEST_ASSERT_EQUAL_UINT32(0, run.drifted);
+    TEST_ASSERT_EQUAL_UINT32(0, run.missed);
+  }
+}
+
+static void test_minute_wraps()
+{
+  TEST_ASSERT_EQUAL_UINT32(0, sweepAngle(0, 10));
+  TEST_ASSERT_EQUAL_UINT32(3590, sweepAngle(59999, 10));
+  TEST_ASSERT_EQUAL_UINT32(60000, sweepNextMs(3590, 10));
+  TEST_ASSERT_EQUAL_UINT32(60000, sweepNextMs(3598, 7)); // a step that would pass the minute
+  TEST_ASSERT_EQUAL_UINT32(167, sweepNextMs(0, 10));     // 1 degree after 166.67 ms
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_frame_per_step);
+  RUN_TEST(test_late_frames_do_not_drift);
+  RUN_TEST(test_minute_wraps);
+  return UNITY_END();
+}
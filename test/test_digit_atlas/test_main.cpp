@@ -0,0 +1,77 @@
+#include <unity.h>
+#include <stdio.h>
+#include <vector>
+#include "rle.h"
+#include "digit_atlas.h"
+
+extern "C" const lv_img_dsc_t ui_img_zero_png, ui_img_one_png, ui_img_two_png, ui_img_three_png, ui_img_four_png,
+    ui_img_five_png, ui_img_six_png, ui_img_seven_png, ui_img_eight_png, ui_img_nine_png;
+
+static const lv_img_dsc_t *const digits[10] = {
+    &ui_img_zero_png, &ui_img_one_png, &ui_img_two_png, &ui_img_three_png, &ui_img_four_png,
+    &ui_img_five_png, &ui_img_six_png, &ui_img_seven_png, &ui_img_eight_png, &ui_img_nine_png,
+};
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+/*
+  The SquareLine digits are white true color alpha images, run length encoded (img_cache.h). Drawn in
+  white from the atlas they give the same pixels when every visible pixel is white and the atlas holds
+  the same alpha.
+*/
+static void test_atlas_matches_images()
+{
+  for (int d = 0; d < 10; d++)
+  {
+    const lv_img_dsc_t *img = digits[d];
+    const lv_img_dsc_t *atlas = &digit_atlas[d];
+    char name[16];
+    snprintf(name, sizeof(name), "digit %d", d);
+
+    TEST_ASSERT_EQUAL_MESSAGE(LV_IMG_CF_USER_ENCODED_1, img->header.cf, name);
+    TEST_ASSERT_EQUAL_MESSAGE(LV_IMG_CF_ALPHA_8BIT, atlas->header.cf, name);
+    TEST_ASSERT_EQUAL_MESSAGE(img->header.w, atlas->header.w, name);
+    TEST_ASSERT_EQUAL_MESSAGE(img->header.h, atlas->header.h, name);
+
+    uint32_t pixels = (uint32_t)img->header.w * img->header.h;
+    TEST_ASSERT_EQUAL_MESSAGE(pixels, atlas->data_size, name);
+    std::vector<uint8_t> decoded(pixels * 3); // color low byte, high byte, alpha
+    TEST_ASSERT_EQUAL_MESSAGE(decoded.size(),
+                              rleDecode(img->data, img->data + img->data_size, decoded.data(), decoded.size(), 3),
+                              name);
+
+    uint32_t alphaDiffs = 0;
+    uint32_t notWhite = 0;
+    for (uint32_t i = 0; i < pixels; i++)
+    {
+      uint8_t alpha = decoded[i * 3 + 2];
+      alphaDiffs += alpha != atlas->data[i];
+      notWhite += alpha && (decoded[i * 3] != 0xFF || decoded[i * 3 + 1] != 0xFF);
+    }
+    TEST_ASSERT_EQUAL_MESSAGE(0, alphaDiffs, name);
+    TEST_ASSERT_EQUAL_MESSAGE(0, notWhite, name);
+  }
+}
+
+static void test_atlas_is_contiguous()
+{
+  // one A8 block, the digits back to back
+  for (int d = 1; d < 10; d++)
+  {
+    TEST_ASSERT_TRUE(digit_atlas[d].data == digit_atlas[d - 1].data + digit_atlas[d - 1].data_size);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_atlas_matches_images);
+  RUN_TEST(test_atlas_is_contiguous);
+  return UNITY_END();
+}
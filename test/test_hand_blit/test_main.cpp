@@ -0,0 +1,321 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <chrono>
+#include "hand_blit.h"
+
+extern "C" const lv_img_dsc_t ui_img_hour_h_png, ui_img_minute_h_png, ui_img_second_h_png;
+
+/* The hands in ui.c, all rotated about (7, 90) */
+static const lv_img_dsc_t *const images[] = {&ui_img_hour_h_png, &ui_img_minute_h_png, &ui_img_second_h_png};
+static const lv_point_t pivot = {7, 90};
+#define RADIUS 110 // [px] beyond the farthest corner of a hand image from the pivot
+
+static AlphaPlane planes[3];
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+/* Same as getPlane in hand_cache.cpp */
+static void makePlane(AlphaPlane *plane, const lv_img_dsc_t *src)
+{
+  lv_area_t bounds;
+  handImageBounds(src, &bounds);
+  plane->src = src;
+  plane->x = bounds.x1 - 1;
+  plane->y = bounds.y1 - 1;
+  plane->w = lv_area_get_width(&bounds) + 2;
+  plane->h = lv_area_get_height(&bounds) + 2;
+  plane->data = (uint8_t *)malloc(plane->w * plane->h);
+  handPlaneFill(plane);
+}
+
+static float planeAt(const AlphaPlane *plane, int32_t x, int32_t y)
+{
+  if (x < 0 || y < 0 || x >= plane->w || y >= plane->h)
+  {
+    return 0;
+  }
+  return plane->data[y * plane->w + x];
+}
+
+/* The rotation in floating point, pixel (u, v) relative to the pivot */
+static uint8_t reference(const AlphaPlane *plane, float c, float s, int32_t u, int32_t v)
+{
+  float x = u * c + v * s + pivot.x - plane->x;
+  float y = -u * s + v * c + pivot.y - plane->y;
+#if HAND_ANTIALIAS
+  int32_t x0 = floorf(x), y0 = floorf(y);
+  float fx = x - x0, fy = y - y0;
+  float top = planeAt(plane, x0, y0) * (1 - fx) + planeAt(plane, x0 + 1, y0) * fx;
+  float bottom = planeAt(plane, x0, y0 + 1) * (1 - fx) + planeAt(plane, x0 + 1, y0 + 1) * fx;
+  return (uint8_t)(top * (1 - fy) + bottom * fy + 0.5f);
+#else
+  return planeAt(plane, lroundf(x), lroundf(y));
+#endif
+}
+
+static void test_matches_float_rotation()
+{
+  static uint8_t row[2 * RADIUS + 1];
+  int worst = 0;
+  uint32_t rounded = 0; // nearest samples that picked the neighbour, the fixed point lands on the other side of .5
+  uint32_t missed = 0;
+  uint32_t covered = 0;
+
+  for (const AlphaPlane &plane : planes)
+  {
+    for (int32_t angle = 0; angle < 3600; angle += 7)
+    {
+      float rad = angle * 3.14159265358979f / 1800;
+      int32_t c, s;
+      handFixedRotation(rad, &c, &s);
+      for (int32_t v = -RADIUS; v <= RADIUS; v++)
+      {
+        int32_t u1 = -RADIUS, u2 = RADIUS;
+        bool any = handRowSpan(&plane, pivot, c, s, v, &u1, &u2);
+        if (any)
+        {
+          handSampleRow(&plane, pivot, c, s, u1, v, row, u2 - u1 + 1);
+        }
+        for (int32_t u = -RADIUS; u <= RADIUS; u++)
+        {
+          uint8_t expected = reference(&plane, cosf(rad), sinf(rad), u, v);
+          if (any && u >= u1 && u <= u2)
+          {
+            int difference = abs(expected - row[u - u1]);
+            worst = std::max(worst, difference);
+            rounded += difference > 2;
+            covered++;
+          }
+          else if (expected > 1)
+          {
+            missed++; // visible, but outside the span
+          }
+        }
+      }
+    }
+  }
+
+  char line[80];
+  snprintf(line, sizeof(line), "%u pixels sampled, worst difference %d, %u rounded the other way", covered, worst,
+           rounded);
+  TEST_MESSAGE(line);
+  TEST_ASSERT_EQUAL(0, missed);
+#if HAND_ANTIALIAS
+  TEST_ASSERT_LESS_OR_EQUAL(2, worst);
+#else
+  TEST_ASSERT_LESS_OR_EQUAL(covered / 1000, rounded);
+#endif
+}
+
+/* The buffer both draw into, the pivot in the middle */
+#define FRAME_SIZE (2 * RADIUS + 4)
+static lv_disp_t *disp;
+static lv_draw_ctx_t *drawCtx;
+static lv_color_t canvas[FRAME_SIZE * FRAME_SIZE];
+static const lv_area_t frameArea = {0, 0, FRAME_SIZE - 1, FRAME_SIZE - 1};
+static const lv_point_t center = {FRAME_SIZE / 2, FRAME_SIZE / 2};
+
+/*
+  The hands as SquareLine exported them, white true color alpha, the format lvgl 8 transforms (alpha only
+  images are not rotated by lv_img). Drawn with lv_draw_img at an angle about (7, 90), which runs
+  lv_draw_sw_transform on the whole rotated image box.
+*/
+static lv_img_dsc_t argb[3];
+
+static void makeArgb(lv_img_dsc_t *img, const lv_img_dsc_t *src)
+{
+  uint32_t pixels = src->header.w * src->header.h;
+  uint8_t *data = (uint8_t *)malloc(pixels * LV_IMG_PX_SIZE_ALPHA_BYTE);
+  for (uint32_t i = 0; i < pixels; i++)
+  {
+    lv_color_t white = lv_color_white();
+    memcpy(data + i * LV_IMG_PX_SIZE_ALPHA_BYTE, &white, sizeof(white));
+    data[i * LV_IMG_PX_SIZE_ALPHA_BYTE + LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = src->data[i]; // A8, one byte per pixel
+  }
+  *img = *src;
+  img->header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+  img->data_size = pixels * LV_IMG_PX_SIZE_ALPHA_BYTE;
+  img->data = data;
+}
+
+static void transformHand(const lv_img_dsc_t *img, int32_t angle)
+{
+  lv_draw_img_dsc_t dsc;
+  lv_draw_img_dsc_init(&dsc);
+  dsc.angle = angle;
+  dsc.pivot = pivot;
+  dsc.antialias = HAND_ANTIALIAS;
+
+  lv_area_t coords;
+  coords.x1 = center.x - pivot.x;
+  coords.y1 = center.y - pivot.y;
+  coords.x2 = coords.x1 + img->header.w - 1;
+  coords.y2 = coords.y1 + img->header.h - 1;
+  lv_draw_img(drawCtx, &dsc, &coords, img);
+}
+
+/* The blitter like handBlitEvent in hand_cache.cpp: spans for the angle, then their rows blended as masks */
+static void blitHand(const AlphaPlane *plane, int32_t angle)
+{
+  static uint8_t row[2 * RADIUS + 1];
+  float rad = angle * 3.14159265358979f / 1800;
+  int32_t c, s;
+  handFixedRotation(rad, &c, &s);
+
+  lv_area_t area;
+  lv_draw_sw_blend_dsc_t dsc;
+  memset(&dsc, 0, sizeof(dsc));
+  dsc.blend_area = &area;
+  dsc.mask_area = &area;
+  dsc.mask_buf = row;
+  dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+  dsc.color = lv_color_white();
+  dsc.opa = LV_OPA_COVER;
+  dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+
+  lv_area_t box;
+  handRotateBox(plane->x - pivot.x, plane->y - pivot.y, plane->x + plane->w - 1 - pivot.x,
+                plane->y + plane->h - 1 - pivot.y, rad, &box);
+  for (int32_t v = box.y1; v <= box.y2; v++)
+  {
+    int32_t u1 = box.x1, u2 = box.x2;
+    if (handRowSpan(plane, pivot, c, s, v, &u1, &u2))
+    {
+      handSampleRow(plane, pivot, c, s, u1, v, row, u2 - u1 + 1);
+      lv_area_set(&area, center.x + u1, center.y + v, center.x + u2, center.y + v);
+      lv_draw_sw_blend(drawCtx, &dsc);
+    }
+  }
+}
+
+/* Pixels of the canvas that are not black */
+static uint32_t drawn()
+{
+  uint32_t count = 0;
+  for (const lv_color_t &px : canvas)
+  {
+    count += px.full != 0;
+  }
+  return count;
+}
+
+static void test_frame_cost()
+{
+  // the six hands of the two clock screens, at the angles in ui.c and a few more
+  static const int32_t angles[] = {270, 900, 0, 450, 1350, 2250};
+  const int frames = 2000;
+
+  drawCtx->buf = canvas;
+  drawCtx->buf_area = &frameArea;
+  drawCtx->clip_area = &frameArea;
+
+  double us[2] = {0, 0};
+  uint32_t pixels[2] = {0, 0};
+  for (int method = 0; method < 2; method++)
+  {
+    double total = 0;
+    for (int frame = 0; frame < frames; frame++)
+    {
+      memset(canvas, 0, sizeof(canvas));
+      auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < 6; i++)
+      {
+        int32_t angle = (angles[i] + frame % 60 * 60) % 3600;
+        if (method == 0)
+        {
+          transformHand(&argb[i % 3], angle);
+        }
+        else
+        {
+          blitHand(&planes[i % 3], angle);
+        }
+      }
+      total += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+      if (frame == 0)
+      {
+        pixels[method] = drawn();
+      }
+    }
+    us[method] = total / frames;
+  }
+
+  char line[128];
+  snprintf(line, sizeof(line), "six hands per frame: lv_draw_img %.1f us (%u px), span blit %.1f us (%u px)", us[0],
+           pixels[0], us[1], pixels[1]);
+  TEST_MESSAGE(line);
+  TEST_ASSERT_TRUE(pixels[0] > 0);
+  TEST_ASSERT_TRUE(pixels[1] > 0);
+  TEST_ASSERT_TRUE(us[1] < us[0]);
+}
+
+/* A hand leaving a sprite for the transform, like showTransformed in hand_cache.cpp, keeps the pivot of ui.c */
+static void test_pivot_after_sprite()
+{
+  static uint8_t alpha[24 * 96];
+  lv_img_dsc_t sprite = {}; // an A8 sprite like renderSprite makes, not the size of the hand image
+  sprite.header.cf = LV_IMG_CF_ALPHA_8BIT;
+  sprite.header.w = 24;
+  sprite.header.h = 96;
+  sprite.data_size = sizeof(alpha);
+  sprite.data = alpha;
+
+  for (const lv_img_dsc_t *src : images)
+  {
+    lv_obj_t *hand = lv_img_create(lv_scr_act());
+    lv_img_set_src(hand, src);
+    lv_img_set_pivot(hand, pivot.x, pivot.y);
+
+    lv_img_set_src(hand, &sprite);
+    handShowSource(hand, src, pivot);
+    lv_img_set_angle(hand, 450);
+
+    lv_point_t shown;
+    lv_img_get_pivot(hand, &shown);
+    TEST_ASSERT_EQUAL(pivot.x, shown.x);
+    TEST_ASSERT_EQUAL(pivot.y, shown.y);
+    lv_obj_del(hand);
+  }
+}
+
+static void flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *pixels)
+{
+  lv_disp_flush_ready(drv);
+}
+
+int main(int argc, char **argv)
+{
+  static lv_color_t pixels[480 * 10];
+  static lv_disp_draw_buf_t drawBuf;
+  static lv_disp_drv_t drv;
+  lv_init();
+  lv_disp_draw_buf_init(&drawBuf, pixels, NULL, 480 * 10);
+  lv_disp_drv_init(&drv);
+  drv.hor_res = 480;
+  drv.ver_res = 320;
+  drv.flush_cb = flush;
+  drv.draw_buf = &drawBuf;
+  disp = lv_disp_drv_register(&drv);
+  _lv_refr_set_disp_refreshing(disp); // lv_draw_sw_blend_basic reads the refreshing display
+  drawCtx = disp->driver->draw_ctx;
+
+  for (int i = 0; i < 3; i++)
+  {
+    makePlane(&planes[i], images[i]);
+    makeArgb(&argb[i], images[i]);
+  }
+  UNITY_BEGIN();
+  RUN_TEST(test_matches_float_rotation);
+  RUN_TEST(test_frame_cost);
+  RUN_TEST(test_pivot_after_sprite);
+  return UNITY_END();
+}
@@ -0,0 +1,245 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include "rle.h"
+#include "assets.h"
+
+#define ASSET_DECLARE(id, img) extern "C" const lv_img_dsc_t img;
+ASSET_LIST(ASSET_DECLARE)
+
+extern "C" const lv_img_dsc_t ui_img_zero_png, ui_img_one_png, ui_img_two_png, ui_img_three_png, ui_img_four_png,
+    ui_img_five_png, ui_img_six_png, ui_img_seven_png, ui_img_eight_png, ui_img_nine_png;
+
+typedef std::vector<uint8_t> Bytes;
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+/* Same encoding as rle() in tools/asset_compiler.py */
+static Bytes encode(const Bytes &data, uint8_t px)
+{
+  Bytes out;
+  size_t count = data.size() / px;
+  size_t literal = 0; // first pixel of the pending literals
+  auto flush = [&](size_t end) {
+    while (literal < end)
+    {
+      size_t n = end - literal < 128 ? end - literal : 128;
+      out.push_back(n - 1);
+      out.insert(out.end(), data.begin() + literal * px, data.begin() + (literal + n) * px);
+      literal += n;
+    }
+  };
+  size_t i = 0;
+  while (i < count)
+  {
+    size_t j = i;
+    while (j < count && j - i < 128 && !memcmp(&data[j * px], &data[i * px], px))
+    {
+      j++;
+    }
+    if (j - i >= 2)
+    {
+      flush(i);
+      out.push_back(0x80 | (j - i - 1));
+      out.insert(out.end(), data.begin() + i * px, data.begin() + (i + 1) * px);
+      i = j;
+      literal = j;
+    }
+    else
+    {
+      i++;
+    }
+  }
+  flush(count);
+  return out;
+}
+
+static Bytes decode(const Bytes &encoded, uint32_t size, uint8_t px, uint32_t *written = NULL)
+{
+  Bytes out(size, 0xEE);
+  uint32_t n = rleDecode(encoded.data(), encoded.data() + encoded.size(), out.data(), size, px);
+  if (written)
+  {
+    *written = n;
+  }
+  return out;
+}
+
+static Bytes repeat(Bytes pixel, size_t count)
+{
+  Bytes out;
+  for (size_t i = 0; i < count; i++)
+  {
+    out.insert(out.end(), pixel.begin(), pixel.end());
+  }
+  return out;
+}
+
+static Bytes concat(std::initializer_list<Bytes> parts)
+{
+  Bytes out;
+  for (const Bytes &part : parts)
+  {
+    out.insert(out.end(), part.begin(), part.end());
+  }
+  return out;
+}
+
+/* Output of tools/asset_compiler.py rle() for the same inputs */
+static void test_asset_compiler_vectors()
+{
+  struct Vector
+  {
+    Bytes raw;
+    uint8_t px;
+    Bytes encoded;
+  };
+  Bytes ramp;
+  for (uint8_t i = 0; i < 20; i++)
+  {
+    ramp.push_back(i);
+  }
+  Bytes rampEncoded = concat({{0x09}, ramp});
+
+  const Vector vectors[] = {
+      {concat({repeat({1, 2}, 3), {3, 4, 5, 6}}), 2, {0x82, 0x01, 0x02, 0x01, 0x03, 0x04, 0x05, 0x06}},
+      {repeat({0xAA, 0xBB, 0xCC}, 200), 3, {0xFF, 0xAA, 0xBB, 0xCC, 0xC7, 0xAA, 0xBB, 0xCC}},
+      {concat({{1, 2, 3, 4, 5, 6, 7, 8, 9}, repeat({9, 9, 9}, 4), {7, 7, 7}}), 3,
+       {0x02, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0x83, 9, 9, 9, 0x00, 7, 7, 7}},
+      {ramp, 2, rampEncoded},
+      {concat({repeat({5, 5}, 129), {6, 6}}), 2, {0xFF, 5, 5, 0x01, 5, 5, 6, 6}},
+  };
+
+  for (const Vector &v : vectors)
+  {
+    Bytes encoded = encode(v.raw, v.px);
+    TEST_ASSERT_EQUAL(v.encoded.size(), encoded.size());
+    TEST_ASSERT_EQUAL_MEMORY(v.encoded.data(), encoded.data(), encoded.size());
+
+    uint32_t written;
+    Bytes decoded = decode(v.encoded, v.raw.size(), v.px, &written);
+    TEST_ASSERT_EQUAL(v.raw.size(), written);
+    TEST_ASSERT_EQUAL_MEMORY(v.raw.data(), decoded.data(), v.raw.size());
+  }
+}
+
+static void test_round_trip()
+{
+  srand(12);
+  for (int round = 0; round < 200; round++)
+  {
+    uint8_t px = round % 2 ? 3 : 2;
+    Bytes raw;
+    // runs of 1 to 300 pixels from a small palette, so neighbouring runs sometimes match
+    while (raw.size() < 20000)
+    {
+      Bytes pixel(px);
+      for (uint8_t &b : pixel)
+      {
+        b = rand() % 3;
+      }
+      int run = rand() % 4 ? rand() % 3 + 1 : rand() % 300 + 1;
+      Bytes part = repeat(pixel, run);
+      raw.insert(raw.end(), part.begin(), part.end());
+    }
+
+    Bytes encoded = encode(raw, px);
+    uint32_t written;
+    Bytes decoded = decode(encoded, raw.size(), px, &written);
+    TEST_ASSERT_EQUAL(raw.size(), written);
+    TEST_ASSERT_EQUAL_MEMORY(raw.data(), decoded.data(), raw.size());
+  }
+}
+
+static void test_bounds()
+{
+  // the output is never overrun, however long the runs
+  Bytes encoded = {0xFF, 1, 2};
+  uint32_t written;
+  Bytes decoded = decode(encoded, 10, 2, &written);
+  TEST_ASSERT_EQUAL(10, written);
+
+  // truncated input stops short
+  Bytes truncated = {0x03, 1, 2, 3, 4};
+  decode(truncated, 8, 2, &written);
+  TEST_ASSERT_EQUAL(4, written);
+  Bytes noPixel = {0x85, 1};
+  decode(noPixel, 12, 2, &written);
+  TEST_ASSERT_EQUAL(0, written);
+}
+
+/* Decodes every encoded runtime image, prints the time per image */
+static void test_decode_assets()
+{
+  struct Named
+  {
+    const char *name;
+    const lv_img_dsc_t *img;
+  };
+#define ASSET_NAMED(id, img) {#img, &img},
+  const Named images[] = {
+      ASSET_LIST(ASSET_NAMED)
+      {"ui_img_zero_png", &ui_img_zero_png}, {"ui_img_one_png", &ui_img_one_png}, {"ui_img_two_png", &ui_img_two_png},
+      {"ui_img_three_png", &ui_img_three_png}, {"ui_img_four_png", &ui_img_four_png},
+      {"ui_img_five_png", &ui_img_five_png}, {"ui_img_six_png", &ui_img_six_png},
+      {"ui_img_seven_png", &ui_img_seven_png}, {"ui_img_eight_png", &ui_img_eight_png},
+      {"ui_img_nine_png", &ui_img_nine_png},
+  };
+
+  uint32_t decodedImages = 0;
+  for (const Named &n : images)
+  {
+    const lv_img_dsc_t *img = n.img;
+    uint8_t px;
+    if (img->header.cf == LV_IMG_CF_USER_ENCODED_0)
+    {
+      px = 2; // LV_IMG_CF_TRUE_COLOR at 16 bit
+    }
+    else if (img->header.cf == LV_IMG_CF_USER_ENCODED_1)
+    {
+      px = 3; // LV_IMG_CF_TRUE_COLOR_ALPHA
+    }
+    else
+    {
+      continue;
+    }
+    uint32_t size = (uint32_t)img->header.w * img->header.h * px;
+    Bytes out(size);
+
+    const int runs = 20;
+    uint32_t written = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < runs; i++)
+    {
+      written = rleDecode(img->data, img->data + img->data_size, out.data(), size, px);
+    }
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(size, written, n.name);
+
+    char line[128];
+    snprintf(line, sizeof(line), "%s %ux%u: %u -> %u bytes, %.1f us per decode", n.name, (unsigned)img->header.w,
+             (unsigned)img->header.h, (unsigned)img->data_size, (unsigned)size, (double)us / runs);
+    TEST_MESSAGE(line);
+    decodedImages++;
+  }
+  TEST_ASSERT_GREATER_THAN(0, decodedImages);
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_asset_compiler_vectors);
+  RUN_TEST(test_round_trip);
+  RUN_TEST(test_bounds);
+  RUN_TEST(test_decode_assets);
+  return UNITY_END();
+}
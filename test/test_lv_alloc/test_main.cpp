@@ -0,0 +1,270 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <map>
+#include <string>
+#include <vector>
+#include "lv_alloc.h"
+
+/* Same layout as BlockHeader in src/lv_alloc.cpp, in front of internal and psram blocks */
+struct BlockHeader
+{
+  uint32_t size;
+  uint32_t tier;
+};
+
+#define TIER_INTERNAL 1
+#define TIER_PSRAM 2
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+static uint32_t inUse()
+{
+  uint32_t used, peak;
+  lvAllocUsage(&used, &peak);
+  return used;
+}
+
+static uint32_t peak()
+{
+  uint32_t used, peak;
+  lvAllocUsage(&used, &peak);
+  return peak;
+}
+
+static const BlockHeader *header(void *p)
+{
+  return (const BlockHeader *)p - 1;
+}
+
+static void test_tier_selection()
+{
+  TEST_ASSERT_EQUAL(0, inUse());
+
+  // the slab hands out neighbouring blocks of the size class
+  uint8_t *a = (uint8_t *)lvAlloc(20);
+  uint8_t *b = (uint8_t *)lvAlloc(32);
+  TEST_ASSERT_EQUAL(32, labs(a - b));
+  uint8_t *c = (uint8_t *)lvAlloc(LV_ALLOC_SLAB_MAX);
+  uint8_t *d = (uint8_t *)lvAlloc(LV_ALLOC_SLAB_MAX);
+  TEST_ASSERT_EQUAL(LV_ALLOC_SLAB_MAX, labs(c - d));
+  TEST_ASSERT_EQUAL(20 + 32 + 2 * LV_ALLOC_SLAB_MAX, inUse());
+
+  void *internal = lvAlloc(LV_ALLOC_SLAB_MAX + 1);
+  TEST_ASSERT_EQUAL(TIER_INTERNAL, header(internal)->tier);
+  TEST_ASSERT_EQUAL(LV_ALLOC_SLAB_MAX + 1, header(internal)->size);
+  void *largeInternal = lvAlloc(LV_ALLOC_PSRAM_MIN - 1);
+  TEST_ASSERT_EQUAL(TIER_INTERNAL, header(largeInternal)->tier);
+  void *psram = lvAlloc(LV_ALLOC_PSRAM_MIN);
+  TEST_ASSERT_EQUAL(TIER_PSRAM, header(psram)->tier);
+  TEST_ASSERT_EQUAL(LV_ALLOC_PSRAM_MIN, header(psram)->size);
+
+  TEST_ASSERT_EQUAL(20 + 32 + 2 * LV_ALLOC_SLAB_MAX + LV_ALLOC_SLAB_MAX + 1 + LV_ALLOC_PSRAM_MIN - 1 + LV_ALLOC_PSRAM_MIN,
+                    inUse());
+
+  // a freed slab block is the next one handed out
+  lvFree(a);
+  TEST_ASSERT_TRUE(lvAlloc(24) == a);
+
+  for (void *p : {(void *)a, (void *)b, (void *)c, (void *)d, internal, largeInternal, psram})
+  {
+    lvFree(p);
+  }
+  lvFree(NULL);
+  TEST_ASSERT_EQUAL(0, inUse());
+}
+
+static void test_full_class_moves_up()
+{
+  // fill every class a 200 byte request fits in, 32 blocks of 256 bytes
+  std::vector<void *> blocks;
+  for (int i = 0; i < 32; i++)
+  {
+    blocks.push_back(lvAlloc(200));
+  }
+  void *overflow = lvAlloc(200);
+  TEST_ASSERT_EQUAL(TIER_INTERNAL, header(overflow)->tier);
+  TEST_ASSERT_EQUAL(200, header(overflow)->size);
+  lvFree(overflow);
+
+  // a full small class borrows from the next bigger one
+  std::vector<void *> small;
+  for (int i = 0; i < 256; i++)
+  {
+    small.push_back(lvAlloc(16));
+  }
+  uint8_t *borrowed = (uint8_t *)lvAlloc(16);
+  uint8_t *next = (uint8_t *)lvAlloc(32);
+  TEST_ASSERT_EQUAL(32, labs(borrowed - next));
+  TEST_ASSERT_EQUAL(32 * 200 + 256 * 16 + 16 + 32, inUse());
+
+  lvFree(borrowed);
+  lvFree(next);
+  for (void *p : blocks)
+  {
+    lvFree(p);
+  }
+  for (void *p : small)
+  {
+    lvFree(p);
+  }
+  TEST_ASSERT_EQUAL(0, inUse());
+}
+
+static void test_realloc()
+{
+  // grows in place while the size class has room
+  char *text = (char *)lvRealloc(NULL, 10);
+  strcpy(text, "123456789");
+  TEST_ASSERT_TRUE(lvRealloc(text, 16) == text);
+  TEST_ASSERT_EQUAL(16, inUse());
+  TEST_ASSERT_TRUE(lvRealloc(text, 4) == text);
+  TEST_ASSERT_EQUAL(4, inUse());
+
+  // out of the slab into the internal heap, the asked for bytes move along
+  text = (char *)lvRealloc(text, 16);
+  text = (char *)lvRealloc(text, 1000);
+  TEST_ASSERT_EQUAL_STRING("123456789", text);
+  TEST_ASSERT_EQUAL(TIER_INTERNAL, header(text)->tier);
+  TEST_ASSERT_EQUAL(1000, header(text)->size);
+  TEST_ASSERT_EQUAL(1000, inUse());
+
+  // heap blocks stay in their tier
+  text = (char *)lvRealloc(text, 2 * LV_ALLOC_PSRAM_MIN);
+  TEST_ASSERT_EQUAL_STRING("123456789", text);
+  TEST_ASSERT_EQUAL(TIER_INTERNAL, header(text)->tier);
+  TEST_ASSERT_EQUAL(2 * LV_ALLOC_PSRAM_MIN, inUse());
+  text = (char *)lvRealloc(text, 100);
+  TEST_ASSERT_EQUAL(TIER_INTERNAL, header(text)->tier);
+  TEST_ASSERT_EQUAL(100, inUse());
+
+  lvFree(text);
+  TEST_ASSERT_EQUAL(0, inUse());
+}
+
+static void test_peak()
+{
+  uint32_t before = peak();
+  void *big = lvAlloc(before + 1000);
+  TEST_ASSERT_EQUAL(before + 1000, peak());
+  lvFree(big);
+  void *small = lvAlloc(100);
+  TEST_ASSERT_EQUAL(before + 1000, peak());
+  lvFree(small);
+}
+
+/*
+  Replay of test/test_lv_alloc/boot_trace.txt, lvgl's allocations while booting and changing between
+  the home and the clock screens, recorded on the board (tools/alloc_trace.py). Every block is filled
+  with a pattern that must survive until it is freed or moved.
+*/
+struct Block
+{
+  uint8_t *p;
+  uint32_t size;
+  uint8_t fill;
+};
+
+static bool intact(const Block &b, uint32_t size)
+{
+  for (uint32_t i = 0; i < size; i++)
+  {
+    if (b.p[i] != (uint8_t)(b.fill + i))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void fill(Block &b)
+{
+  b.fill++;
+  for (uint32_t i = 0; i < b.size; i++)
+  {
+    b.p[i] = b.fill + i;
+  }
+}
+
+static void test_trace_replay()
+{
+  std::string path = __FILE__;
+  path = path.substr(0, path.find_last_of("/\\") + 1) + "boot_trace.txt";
+  FILE *trace = fopen(path.c_str(), "r");
+  if (!trace)
+  {
+    TEST_IGNORE_MESSAGE("no boot_trace.txt, record one with LV_ALLOC_TRACE (tools/alloc_trace.py)");
+  }
+
+  std::map<uint32_t, Block> blocks;
+  uint32_t expected = 0;
+  uint32_t calls = 0;
+  uint32_t broken = 0;
+  char op;
+  uint32_t id, size;
+  while (fscanf(trace, " %c %u", &op, &id) == 2)
+  {
+    calls++;
+    if (op == 'f')
+    {
+      Block &b = blocks[id];
+      broken += !intact(b, b.size);
+      expected -= b.size;
+      lvFree(b.p);
+      blocks.erase(id);
+    }
+    else if (fscanf(trace, "%u", &size) == 1)
+    {
+      Block &b = blocks[id];
+      if (op == 'a')
+      {
+        b.p = (uint8_t *)lvAlloc(size);
+      }
+      else
+      {
+        broken += !intact(b, b.size);
+        expected -= b.size;
+        b.p = (uint8_t *)lvRealloc(b.p, size);
+        broken += !intact(b, b.size < size ? b.size : size); // the bytes that fit moved along
+      }
+      TEST_ASSERT_NOT_NULL(b.p);
+      b.size = size;
+      expected += size;
+      fill(b);
+    }
+    broken += inUse() != expected;
+  }
+  fclose(trace);
+
+  char line[64];
+  snprintf(line, sizeof(line), "%u calls, %u blocks left", calls, (uint32_t)blocks.size());
+  TEST_MESSAGE(line);
+  lvAllocPrintStats();
+  TEST_ASSERT_EQUAL(0, broken);
+  TEST_ASSERT_TRUE(calls > 0);
+
+  for (auto &entry : blocks)
+  {
+    TEST_ASSERT_TRUE(intact(entry.second, entry.second.size));
+    lvFree(entry.second.p);
+  }
+  TEST_ASSERT_EQUAL(0, inUse());
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_tier_selection);
+  RUN_TEST(test_full_class_moves_up);
+  RUN_TEST(test_realloc);
+  RUN_TEST(test_peak);
+  RUN_TEST(test_trace_replay);
+  return UNITY_END();
+}
@@ -0,0 +1,221 @@
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <deque>
+#include <string>
+#include "notify_store.h"
+
+#define RECORD_HEADER 16 // bytes, RecordHeader in notify_store.cpp
+
+static NotifyStore store;
+static uint8_t arena[4096];
+
+void setUp()
+{
+  memset(arena, 0xA5, sizeof(arena));
+}
+
+void tearDown()
+{
+}
+
+/* Arena bytes of a record whose title and text fit */
+static uint32_t recordBytes(const char *title, const char *text)
+{
+  return (RECORD_HEADER + strlen(title) + 1 + strlen(text) + 1 + 3) & ~3U;
+}
+
+static void test_newest_first()
+{
+  store.begin(arena, sizeof(arena), 3600);
+  TEST_ASSERT_TRUE(store.add(1, "Mail", "first", 100, 60));
+  TEST_ASSERT_TRUE(store.add(2, "SMS", "second", 101, 61));
+
+  NotifyEntry entry;
+  TEST_ASSERT_TRUE(store.get(0, entry));
+  TEST_ASSERT_EQUAL_STRING("SMS", entry.title);
+  TEST_ASSERT_EQUAL_STRING("second", entry.text);
+  TEST_ASSERT_EQUAL(2, entry.icon);
+  TEST_ASSERT_EQUAL(101, entry.time);
+  TEST_ASSERT_EQUAL(61, entry.clock);
+  uint32_t seq = entry.seq;
+  TEST_ASSERT_TRUE(store.get(1, entry));
+  TEST_ASSERT_EQUAL_STRING("Mail", entry.title);
+  TEST_ASSERT_EQUAL(seq - 1, entry.seq);
+  TEST_ASSERT_FALSE(store.get(2, entry));
+
+  TEST_ASSERT_EQUAL(2, store.count());
+  TEST_ASSERT_EQUAL(recordBytes("Mail", "first") + recordBytes("SMS", "second"), store.bytes());
+  store.clear();
+  TEST_ASSERT_EQUAL(0, store.count());
+  TEST_ASSERT_EQUAL(0, store.bytes());
+  TEST_ASSERT_FALSE(store.get(0, entry));
+}
+
+static void test_evicts_oldest_for_room()
+{
+  // room for three of these records, not four
+  char text[64];
+  memset(text, 'x', 50);
+  text[50] = '\0';
+  uint32_t bytes = recordBytes("T", text);
+  store.begin(arena, bytes * 3 + bytes / 2, 3600);
+
+  for (uint32_t i = 0; i < 10; i++)
+  {
+    TEST_ASSERT_TRUE(store.add(i, "T", text, i, 0));
+    TEST_ASSERT_EQUAL(i < 3 ? i + 1 : 3, store.count());
+    TEST_ASSERT_TRUE(store.bytes() <= store.size());
+  }
+  TEST_ASSERT_EQUAL(7, store.evicted());
+
+  NotifyEntry entry;
+  for (uint32_t i = 0; i < 3; i++)
+  {
+    TEST_ASSERT_TRUE(store.get(i, entry));
+    TEST_ASSERT_EQUAL(9 - i, entry.icon);
+    TEST_ASSERT_EQUAL_STRING(text, entry.text);
+  }
+
+  // a record larger than the whole arena is refused and evicts nothing
+  store.begin(arena, 32, 3600);
+  TEST_ASSERT_TRUE(store.add(0, "a", "b", 0, 0));
+  TEST_ASSERT_FALSE(store.add(0, "title", "a text too long for the arena", 0, 0));
+  TEST_ASSERT_EQUAL(1, store.count());
+}
+
+static void test_record_cap()
+{
+  store.begin(arena, sizeof(arena), 3600);
+  uint32_t evictedBefore = store.evicted();
+  for (uint32_t i = 0; i < NOTIFY_MAX_RECORDS + 50; i++)
+  {
+    TEST_ASSERT_TRUE(store.add(0, "", "", i, 0));
+  }
+  TEST_ASSERT_EQUAL(NOTIFY_MAX_RECORDS, store.count());
+  TEST_ASSERT_EQUAL(50, store.evicted() - evictedBefore);
+
+  NotifyEntry entry;
+  TEST_ASSERT_TRUE(store.get(0, entry));
+  TEST_ASSERT_EQUAL(NOTIFY_MAX_RECORDS + 49, entry.time);
+  TEST_ASSERT_TRUE(store.get(NOTIFY_MAX_RECORDS - 1, entry));
+  TEST_ASSERT_EQUAL(50, entry.time);
+}
+
+static void test_prune_by_age()
+{
+  store.begin(arena, sizeof(arena), 600);
+  store.add(0, "a", "", 1000, 0);
+  store.add(0, "b", "", 1300, 0);
+  store.add(0, "c", "", 1700, 0);
+
+  store.prune(1600);
+  TEST_ASSERT_EQUAL(3, store.count());
+  store.prune(1601);
+  TEST_ASSERT_EQUAL(2, store.count());
+  store.prune(2000);
+  TEST_ASSERT_EQUAL(1, store.count());
+
+  NotifyEntry entry;
+  TEST_ASSERT_TRUE(store.get(0, entry));
+  TEST_ASSERT_EQUAL_STRING("c", entry.title);
+
+  // the clock moved back, records from the future stay
+  store.prune(100);
+  TEST_ASSERT_EQUAL(1, store.count());
+  store.prune(5000);
+  TEST_ASSERT_EQUAL(0, store.count());
+  TEST_ASSERT_EQUAL(0, store.bytes());
+}
+
+static void test_utf8_limits()
+{
+  store.begin(arena, sizeof(arena), 3600);
+
+  // NOTIFY_TITLE_MAX - 1 ASCII bytes and a 2 byte character: the character does not fit
+  std::string title(NOTIFY_TITLE_MAX - 1, 'a');
+  std::string text(NOTIFY_TEXT_MAX - 2, 'b');
+  TEST_ASSERT_TRUE(store.add(0, (title + "\xC3\xA9").c_str(), (text + "\xE2\x82\xAC").c_str(), 0, 0));
+  NotifyEntry entry;
+  store.get(0, entry);
+  TEST_ASSERT_EQUAL_STRING(title.c_str(), entry.title);
+  TEST_ASSERT_EQUAL_STRING(text.c_str(), entry.text);
+  uint32_t firstBytes = store.bytes();
+
+  // a character ending exactly at the limit stays
+  title = std::string(NOTIFY_TITLE_MAX - 2, 'a') + "\xC3\xA9";
+  text = std::string(NOTIFY_TEXT_MAX - 3, 'b') + "\xE2\x82\xAC";
+  TEST_ASSERT_TRUE(store.add(0, (title + "zz").c_str(), (text + "zz").c_str(), 0, 0));
+  store.get(0, entry);
+  TEST_ASSERT_EQUAL_STRING(title.c_str(), entry.title);
+  TEST_ASSERT_EQUAL_STRING(text.c_str(), entry.text);
+  TEST_ASSERT_EQUAL(recordBytes(title.c_str(), text.c_str()), store.bytes() - firstBytes);
+}
+
+/* Random sizes and ages against a copy of what should be kept, the records must never overlap */
+static void test_random_against_model()
+{
+  struct Kept
+  {
+    std::string title;
+    std::string text;
+    uint32_t time;
+  };
+  std::deque<Kept> model;
+  uint32_t seed = 7;
+  auto rnd = [&seed]() {
+    seed = seed * 1103515245 + 12345;
+    return seed >> 8;
+  };
+
+  store.begin(arena, 1000, 300);
+  uint32_t now = 0;
+  bool ok = true;
+  for (int i = 0; i < 20000 && ok; i++)
+  {
+    now += rnd() % 20;
+    if (rnd() % 50 == 0)
+    {
+      store.prune(now);
+      while (!model.empty() && now - model.front().time > 300)
+      {
+        model.pop_front();
+      }
+    }
+    else
+    {
+      Kept k = {std::string(rnd() % (NOTIFY_TITLE_MAX + 1), 'A' + i % 26),
+                std::string(rnd() % (NOTIFY_TEXT_MAX + 1), 'a' + i % 26), now};
+      ok &= store.add(i % 7, k.title.c_str(), k.text.c_str(), now, 0);
+      model.push_back(k);
+      // the oldest go first, more than the bytes need when the free space is split by the wrap
+      while (model.size() > store.count())
+      {
+        model.pop_front();
+      }
+    }
+
+    ok &= model.size() == store.count() && store.bytes() <= store.size();
+    for (uint32_t j = 0; j < store.count() && ok; j++)
+    {
+      NotifyEntry entry;
+      const Kept &m = model[model.size() - 1 - j];
+      ok &= store.get(j, entry) && m.title == entry.title && m.text == entry.text && m.time == entry.time;
+      ok &= (const uint8_t *)entry.title >= arena && (const uint8_t *)entry.text + m.text.size() < arena + 1000;
+    }
+  }
+  TEST_ASSERT_TRUE(ok);
+  TEST_ASSERT_EQUAL(0xA5, arena[1000]); // nothing written past the arena
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_newest_first);
+  RUN_TEST(test_evicts_oldest_for_room);
+  RUN_TEST(test_record_cap);
+  RUN_TEST(test_prune_by_age);
+  RUN_TEST(test_utf8_limits);
+  RUN_TEST(test_random_against_model);
+  return UNITY_END();
+}
@@ -0,0 +1,185 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+#include "res_pack.h"
+#include "assets.h"
+
+extern "C" const lv_img_dsc_t ui_img_sms_png, ui_img_mail_png, ui_img_clock_round_bg_png;
+
+// PACK_FORMATS in tools/asset_compiler.py
+static const lv_img_cf_t formats[] = {
+    LV_IMG_CF_TRUE_COLOR, LV_IMG_CF_TRUE_COLOR_ALPHA,
+    LV_IMG_CF_INDEXED_1BIT, LV_IMG_CF_INDEXED_2BIT, LV_IMG_CF_INDEXED_4BIT, LV_IMG_CF_INDEXED_8BIT,
+    LV_IMG_CF_ALPHA_1BIT, LV_IMG_CF_ALPHA_2BIT, LV_IMG_CF_ALPHA_4BIT, LV_IMG_CF_ALPHA_8BIT,
+    LV_IMG_CF_USER_ENCODED_0, LV_IMG_CF_USER_ENCODED_1,
+};
+
+struct PackImage
+{
+  std::string name;
+  const lv_img_dsc_t *img;
+};
+
+static std::vector<std::string> files;
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+static void put(std::vector<uint8_t> &out, size_t at, uint32_t value, int bytes)
+{
+  for (int i = 0; i < bytes; i++)
+  {
+    out[at + i] = value >> (8 * i);
+  }
+}
+
+/* Same layout as resource_pack() in tools/asset_compiler.py, `images` sorted by name */
+static std::vector<uint8_t> buildPack(const std::vector<PackImage> &images)
+{
+  size_t offset = 16 + 48 * images.size();
+  std::vector<uint32_t> offsets;
+  for (const PackImage &p : images)
+  {
+    offset = (offset + 3) & ~(size_t)3;
+    offsets.push_back(offset);
+    offset += p.img->data_size;
+  }
+
+  std::vector<uint8_t> pack(offset);
+  memcpy(&pack[0], "WTAP", 4);
+  put(pack, 4, 1, 2);
+  put(pack, 6, images.size(), 2);
+  put(pack, 8, pack.size(), 4);
+  for (size_t i = 0; i < images.size(); i++)
+  {
+    const lv_img_dsc_t *img = images[i].img;
+    size_t at = 16 + 48 * i;
+    memcpy(&pack[at], images[i].name.c_str(), images[i].name.size());
+    uint8_t format = 0;
+    while (formats[format] != img->header.cf)
+    {
+      format++;
+    }
+    pack[at + 32] = format;
+    put(pack, at + 34, img->header.w, 2);
+    put(pack, at + 36, img->header.h, 2);
+    put(pack, at + 40, offsets[i], 4);
+    put(pack, at + 44, img->data_size, 4);
+    memcpy(&pack[offsets[i]], img->data, img->data_size);
+  }
+  return pack;
+}
+
+static std::string writeFile(const std::vector<uint8_t> &data)
+{
+  char path[] = "/tmp/res_pack_XXXXXX";
+  int fd = mkstemp(path);
+  if (fd >= 0)
+  {
+    // a short write shows up as a rejected or missing pack in the tests
+    if (write(fd, data.data(), data.size()) != (ssize_t)data.size())
+    {
+      perror(path);
+    }
+    close(fd);
+  }
+  files.push_back(path);
+  return path;
+}
+
+static std::vector<PackImage> sampleImages()
+{
+  // the SMS icon is replaced by the mail icon, like a pack with another icon set
+  return {{"ui_img_clock_round_bg_png", &ui_img_clock_round_bg_png}, {"ui_img_sms_png", &ui_img_mail_png}};
+}
+
+static void test_rejects_bad_packs()
+{
+  TEST_ASSERT_FALSE(resPackBegin("/tmp/no_such_pack.bin"));
+
+  std::vector<uint8_t> pack = buildPack(sampleImages());
+  std::vector<uint8_t> bad = pack;
+  bad[0] = 'X';
+  TEST_ASSERT_FALSE(resPackBegin(writeFile(bad).c_str()));
+
+  bad = pack;
+  put(bad, 4, 2, 2); // version
+  TEST_ASSERT_FALSE(resPackBegin(writeFile(bad).c_str()));
+
+  bad = pack;
+  bad.resize(bad.size() - 1); // the header claims more than the file has
+  TEST_ASSERT_FALSE(resPackBegin(writeFile(bad).c_str()));
+
+  bad = pack;
+  put(bad, 16 + 48 + 44, pack.size(), 4); // data past the end
+  TEST_ASSERT_FALSE(resPackBegin(writeFile(bad).c_str()));
+
+  bad = pack;
+  bad[16 + 48 + 32] = sizeof(formats); // unknown format
+  TEST_ASSERT_FALSE(resPackBegin(writeFile(bad).c_str()));
+
+  std::vector<PackImage> unsorted = sampleImages();
+  std::swap(unsorted[0], unsorted[1]);
+  TEST_ASSERT_FALSE(resPackBegin(writeFile(buildPack(unsorted)).c_str()));
+
+  TEST_ASSERT_TRUE(resPackImage("ui_img_sms_png") == NULL); // nothing was loaded
+}
+
+static void test_maps_pack_file()
+{
+  std::vector<uint8_t> pack = buildPack(sampleImages());
+  TEST_ASSERT_TRUE(resPackBegin(writeFile(pack).c_str()));
+
+  for (const PackImage &p : sampleImages())
+  {
+    const lv_img_dsc_t *img = resPackImage(p.name.c_str());
+    TEST_ASSERT_NOT_NULL(img);
+    TEST_ASSERT_TRUE(img != p.img); // a descriptor into the mapping, not the compiled one
+    TEST_ASSERT_EQUAL(p.img->header.cf, img->header.cf);
+    TEST_ASSERT_EQUAL(p.img->header.w, img->header.w);
+    TEST_ASSERT_EQUAL(p.img->header.h, img->header.h);
+    TEST_ASSERT_EQUAL(p.img->data_size, img->data_size);
+    TEST_ASSERT_EQUAL_MEMORY(p.img->data, img->data, img->data_size);
+    TEST_ASSERT_EQUAL(0, (uintptr_t)img->data % 4);
+  }
+
+  TEST_ASSERT_TRUE(resPackImage("ui_img_mail_png") == NULL);
+  TEST_ASSERT_TRUE(resPackImage("ui_img_mail_png", &ui_img_mail_png) == &ui_img_mail_png);
+  TEST_ASSERT_TRUE(resPackImage("ui_img_a") == NULL);
+  TEST_ASSERT_TRUE(resPackImage("ui_img_zzz") == NULL);
+}
+
+static void test_assets_prefer_the_pack()
+{
+  TEST_ASSERT_TRUE(resPackBegin(writeFile(buildPack(sampleImages())).c_str()));
+  assetsBegin();
+
+  const lv_img_dsc_t *sms = assetImage(ASSET_SMS);
+  TEST_ASSERT_TRUE(sms == resPackImage("ui_img_sms_png"));
+  TEST_ASSERT_EQUAL_MEMORY(ui_img_mail_png.data, sms->data, ui_img_mail_png.data_size);
+  TEST_ASSERT_TRUE(assetImage(ASSET_MAIL) == &ui_img_mail_png); // not in the pack
+  TEST_ASSERT_TRUE(assetImage(ASSET_CLOCK_ROUND_BG) == resPackImage("ui_img_clock_round_bg_png"));
+  TEST_ASSERT_NULL(assetImage(ASSET_COUNT));
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_rejects_bad_packs);
+  RUN_TEST(test_maps_pack_file);
+  RUN_TEST(test_assets_prefer_the_pack);
+  for (const std::string &path : files)
+  {
+    unlink(path.c_str());
+  }
+  return UNITY_END();
+}
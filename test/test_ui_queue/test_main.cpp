@@ -0,0 +1,157 @@
+#include <unity.h>
+#include <thread>
+#include "ui_queue.h"
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+static void test_fifo_order()
+{
+  SpscQueue<int, 4> queue;
+  TEST_ASSERT_TRUE(queue.push(1));
+  TEST_ASSERT_TRUE(queue.push(2));
+  TEST_ASSERT_EQUAL(2, queue.size());
+
+  int item;
+  TEST_ASSERT_TRUE(queue.pop(item));
+  TEST_ASSERT_EQUAL(1, item);
+  TEST_ASSERT_TRUE(queue.pop(item));
+  TEST_ASSERT_EQUAL(2, item);
+  TEST_ASSERT_FALSE(queue.pop(item));
+  TEST_ASSERT_EQUAL(0, queue.size());
+}
+
+static void test_wraparound()
+{
+  SpscQueue<int, 4> queue;
+  int next = 0;
+  int expected = 0;
+  // fill levels of 1 to 3 items walk the indices around the ring many times
+  for (int round = 0; round < 1000; round++)
+  {
+    int fill = round % 3 + 1;
+    for (int i = 0; i < fill; i++)
+    {
+      TEST_ASSERT_TRUE(queue.push(next++));
+    }
+    int item;
+    for (int i = 0; i < fill; i++)
+    {
+      TEST_ASSERT_TRUE(queue.pop(item));
+      TEST_ASSERT_EQUAL(expected++, item);
+    }
+    TEST_ASSERT_FALSE(queue.pop(item));
+  }
+  TEST_ASSERT_EQUAL(0, queue.dropped());
+}
+
+static void test_full_drops_newest()
+{
+  SpscQueue<int, 4> queue;
+  for (int i = 0; i < 4; i++)
+  {
+    TEST_ASSERT_TRUE(queue.push(i));
+  }
+  TEST_ASSERT_FALSE(queue.push(100));
+  TEST_ASSERT_FALSE(queue.push(101));
+  TEST_ASSERT_EQUAL(4, queue.size());
+  TEST_ASSERT_EQUAL(2, queue.dropped());
+
+  // the queued items survive, the dropped ones never show up
+  int item;
+  for (int i = 0; i < 4; i++)
+  {
+    TEST_ASSERT_TRUE(queue.pop(item));
+    TEST_ASSERT_EQUAL(i, item);
+  }
+  TEST_ASSERT_FALSE(queue.pop(item));
+
+  // room again after draining, the drop count only grows
+  TEST_ASSERT_TRUE(queue.push(5));
+  TEST_ASSERT_EQUAL(2, queue.dropped());
+}
+
+static void test_two_threads()
+{
+  static SpscQueue<uint32_t, 8> queue;
+  const uint32_t count = 200000;
+
+  std::thread producer([&]() {
+    for (uint32_t i = 0; i < count; i++)
+    {
+      while (!queue.push(i))
+      {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  uint32_t expected = 0;
+  bool ordered = true;
+  while (expected < count)
+  {
+    uint32_t item;
+    if (queue.pop(item))
+    {
+      ordered &= item == expected;
+      expected++;
+    }
+  }
+  producer.join();
+
+  TEST_ASSERT_TRUE(ordered);
+  TEST_ASSERT_EQUAL(0, queue.size());
+}
+
+static void test_command_strings()
+{
+  UiCommand cmd;
+  uiCopyText(cmd.caller.name, sizeof(cmd.caller.name), "Felix");
+  TEST_ASSERT_EQUAL_STRING("Felix", cmd.caller.name);
+
+  char longName[100];
+  memset(longName, 'a', sizeof(longName) - 1);
+  longName[sizeof(longName) - 1] = '\0';
+  uiCopyText(cmd.caller.name, sizeof(cmd.caller.name), longName);
+  TEST_ASSERT_EQUAL(UI_NAME_LEN - 1, strlen(cmd.caller.name));
+}
+
+static void test_utf8_truncation()
+{
+  char dest[6];
+  // "aé€" is 1 + 2 + 3 bytes, 5 bytes fit and the euro sign would be cut
+  uiCopyText(dest, sizeof(dest), "a\xC3\xA9\xE2\x82\xAC");
+  TEST_ASSERT_EQUAL_STRING("a\xC3\xA9", dest);
+
+  // cut inside a 4 byte sequence
+  uiCopyText(dest, sizeof(dest), "ab\xF0\x9F\x98\x80");
+  TEST_ASSERT_EQUAL_STRING("ab", dest);
+
+  // a sequence ending exactly at the limit stays
+  uiCopyText(dest, sizeof(dest), "ab\xE2\x82\xAC" "c");
+  TEST_ASSERT_EQUAL_STRING("ab\xE2\x82\xAC", dest);
+
+  TEST_ASSERT_EQUAL(0, uiTextLength("\xC3\xA9", 1));
+  TEST_ASSERT_EQUAL(2, uiTextLength("\xC3\xA9", 2));
+  TEST_ASSERT_EQUAL(3, uiTextLength("abc", 10));
+
+  uiCopyText(dest, 1, "abc");
+  TEST_ASSERT_EQUAL_STRING("", dest);
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_fifo_order);
+  RUN_TEST(test_wraparound);
+  RUN_TEST(test_full_drops_newest);
+  RUN_TEST(test_two_threads);
+  RUN_TEST(test_command_strings);
+  RUN_TEST(test_utf8_truncation);
+  return UNITY_END();
+}
@@ -0,0 +1,141 @@
+#!/usr/bin/env python3
+"""
+Turn the allocations printed with LV_ALLOC_TRACE (lib/lv_alloc.h) into the replay fixture of
+test/test_lv_alloc, and report how many blocks each slab size class of src/lv_alloc.cpp needs.
+
+Record on the board with LV_ALLOC_TRACE uncommented: boot, go between the home and the clock screens
+a few times and save the serial output. Lines that are not "lvmem" records are skipped:
+
+  python tools/alloc_trace.py capture.log -o test/test_lv_alloc/boot_trace.txt
+  python tools/alloc_trace.py test/test_lv_alloc/boot_trace.txt                   report only
+
+The fixture numbers the blocks instead of keeping the addresses, one call per line:
+
+  a <block> <size>    lvAlloc, or lvRealloc of NULL
+  r <block> <size>    lvRealloc, the block keeps its number when it moves
+  f <block>           lvFree
+
+The report replays the trace over the slab classes, each block taking the smallest class it fits,
+and prints the most blocks each class held at once next to the configured count.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+RECORD = re.compile(r"lvmem ([afr]) (\S+)(?: (\S+))?(?: (\d+))?")
+
+
+def parse_log(lines):
+    """Fixture lines from the serial log, addresses renumbered"""
+    blocks = {}
+    next_block = 1
+    out = []
+    for line in lines:
+        m = RECORD.search(line)
+        if not m:
+            continue
+        op, a, b, size = m.groups()
+        if op == "a":
+            if a in ("0", "0x0", "(nil)"):
+                continue  # failed, nothing to replay
+            blocks[a] = next_block
+            out.append("a %d %s" % (next_block, b))
+            next_block += 1
+        elif op == "f":
+            if a in blocks:
+                out.append("f %d" % blocks.pop(a))
+        else:
+            if b in ("0", "0x0", "(nil)"):
+                continue  # failed, the old block stays
+            if a in blocks:
+                block = blocks.pop(a)
+                out.append("r %d %s" % (block, size))
+            else:
+                block = next_block
+                next_block += 1
+                out.append("a %d %s" % (block, size))
+            blocks[b] = block
+    return out
+
+
+def slab_classes():
+    """(size, blocks) of the slabs table in src/lv_alloc.cpp"""
+    with open(os.path.join(ROOT, "src", "lv_alloc.cpp")) as f:
+        src = f.read()
+    with open(os.path.join(ROOT, "lib", "lv_alloc.h")) as f:
+        slab_max = re.search(r"#define LV_ALLOC_SLAB_MAX (\d+)", f.read()).group(1)
+    table = re.search(r"slabs\[\] = \{(.*?)\};", src, re.S).group(1).replace("LV_ALLOC_SLAB_MAX", slab_max)
+    return [(int(size), int(blocks)) for size, blocks in re.findall(r"\{(\d+), (\d+)\}", table)]
+
+
+def report(fixture):
+    classes = slab_classes()
+    live = [0] * len(classes)
+    peak = [0] * len(classes)
+    sizes = {}
+    larger = 0
+    larger_peak = 0
+
+    def slot(size):
+        for i, (class_size, _) in enumerate(classes):
+            if size <= class_size:
+                return i
+        return None
+
+    def add(size, n):
+        nonlocal larger, larger_peak
+        i = slot(size)
+        if i is None:
+            larger += n * size
+            larger_peak = max(larger_peak, larger)
+        else:
+            live[i] += n
+            peak[i] = max(peak[i], live[i])
+
+    for line in fixture:
+        fields = line.split()
+        block = int(fields[1])
+        if fields[0] == "a":
+            sizes[block] = int(fields[2])
+            add(sizes[block], 1)
+        elif fields[0] == "f":
+            add(sizes.pop(block), -1)
+        else:
+            size = int(fields[2])
+            if slot(size) != slot(sizes[block]) or slot(size) is None:
+                add(sizes[block], -1)
+                add(size, 1)
+            sizes[block] = size
+
+    print("%d calls, %d blocks left at the end" % (len(fixture), len(sizes)))
+    print("%8s %10s %10s" % ("class", "peak", "configured"))
+    for (size, blocks), most in zip(classes, peak):
+        print("%6d B %10d %10d%s" % (size, most, blocks, "  too few" if most > blocks else ""))
+    print("larger blocks: %d bytes at most" % larger_peak)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("-o", "--output", help="fixture to write")
+    parser.add_argument("log", help="serial log or fixture")
+    args = parser.parse_args()
+
+    with open(args.log, errors="replace") as f:
+        lines = f.read().splitlines()
+    if any(RECORD.search(line) for line in lines):
+        fixture = parse_log(lines)
+    else:
+        fixture = [line for line in lines if line and not line.startswith("#")]
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write("\n".join(fixture) + "\n")
+        print("%s: %d calls" % (args.output, len(fixture)))
+    report(fixture)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,532 @@
+#!/usr/bin/env python3
+"""
+Re-encode the SquareLine images (src/ui/ui_img_*.c) in the smallest format lvgl draws exactly.
+
+SquareLine exports every image as LV_IMG_CF_TRUE_COLOR_ALPHA. For each image this picks the
+smallest of the formats that reproduce it pixel for pixel and rewrites the file in place,
+keeping the lv_img_dsc_t symbol, so nothing else has to change:
+
+  LV_IMG_CF_TRUE_COLOR          opaque images, lvgl copies them without blending
+  LV_IMG_CF_INDEXED_1/2/4/8BIT  up to 2/4/16/256 distinct color+alpha pairs
+  LV_IMG_CF_TRUE_COLOR_ALPHA    everything else
+  LV_IMG_CF_USER_ENCODED_0/1    run length encoded true color / true color alpha, decoded once into
+                                the PSRAM image cache (src/img_cache.cpp) and drawn from there, used
+                                when it saves at least RLE_MIN_SAVING bytes of flash
+
+Indexed images are always alpha blended and decoded line by line when drawn, so a format can
+be forced per image in tools/assets.json:
+
+  "true-color"  keep opaque images copyable (large backgrounds redrawn under moving parts),
+                plain or run length encoded
+  "alpha"       single color images drawn with an img_recolor style, LV_IMG_CF_ALPHA_1/2/4/8BIT
+
+Images with the same pixels share one data array, the other descriptors point to it. Files that
+were already compiled are decoded again, so running this twice gives the same result.
+SquareLine overwrites the files on every export, run this again afterwards:
+
+  python tools/asset_compiler.py src/ui/ui_img_*.c
+  python tools/asset_compiler.py --dry-run src/ui/ui_img_*.c       report only
+  python tools/asset_compiler.py --atlas digit_atlas -o src/digit_atlas.c src/ui/ui_img_zero_png.c ...
+
+An atlas packs single color images of the same size into one A8 array with a descriptor per
+image pointing into it (declared by hand, see include/digit_atlas.h).
+
+A resource pack holds compiled images for the "assets" flash partition (assets_4MB.csv,
+assets_8MB.csv), where src/res_pack.cpp maps it and finds images by symbol name, so a watch face
+or icon set can be flashed without rebuilding the firmware:
+
+  python tools/asset_compiler.py --pack assets.bin src/ui/ui_img_*.c
+  esptool.py write_flash 0x670000 assets.bin                        0x210000 on the WT32-SC01
+
+Layout, little endian: a 16 byte header (magic "WTAP", version, image count, pack size, reserved)
+followed by a 48 byte index entry per image (NUL padded name[32], format, reserved, w, h, reserved,
+data offset, data size) sorted by name, then the image data, each array 4 byte aligned.
+Format is an index into PACK_FORMATS.
+
+Images that nothing uses are not in the firmware, --gc-sections drops them. tools/prune_assets.py
+also removes the files nothing mentions from the build, which only saves compile time, and prints the
+image data of the linked firmware after the build. Code picks images through include/assets.h.
+To see the unused images without building:
+
+  python tools/asset_compiler.py --unused src/ui/ui_img_*.c
+"""
+
+import argparse
+import glob
+import json
+import os
+import re
+import struct
+import sys
+
+BYTES_PER_LINE = 192
+RLE_MIN_SAVING = 1024
+
+# run length encoded formats, with the format they decode to and its pixel size
+RLE = {
+    "USER_ENCODED_0": ("TRUE_COLOR", 2),
+    "USER_ENCODED_1": ("TRUE_COLOR_ALPHA", 3),
+}
+# pack format codes, in the order of the table in src/res_pack.cpp
+PACK_FORMATS = [
+    "TRUE_COLOR", "TRUE_COLOR_ALPHA",
+    "INDEXED_1BIT", "INDEXED_2BIT", "INDEXED_4BIT", "INDEXED_8BIT",
+    "ALPHA_1BIT", "ALPHA_2BIT", "ALPHA_4BIT", "ALPHA_8BIT",
+    "USER_ENCODED_0", "USER_ENCODED_1",
+]
+PACK_MAGIC = b"WTAP"
+PACK_VERSION = 1
+PACK_NAME_SIZE = 32
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SOURCES = ["src/*.c", "src/*.cpp", "src/ui/ui.c", "src/ui/ui_helpers.c", "include/*.h"]
+
+# how an image is referenced, see image_usage()
+USED = "used"
+IMGSET = "imgset"
+UNREFERENCED = "unreferenced"
+
+OVERRIDES = os.path.join(os.path.dirname(os.path.abspath(__file__)), "assets.json")
+
+# how lvgl draws each format
+DRAW = {
+    "TRUE_COLOR": "copy",
+    "TRUE_COLOR_ALPHA": "blend",
+    "ALPHA": "recolor mask",
+    "INDEXED": "decode + blend",
+}
+
+ATLAS_HEADER = """// Generated by tools/asset_compiler.py, do not edit, declared in include/%s.h
+// %s
+
+#include <lvgl.h>
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+"""
+
+
+class Image:
+    """One ui_img_*.c file, decoded to (color, alpha) pixels. color is None for alpha only images."""
+
+    def __init__(self, path):
+        self.path = path
+        with open(path) as f:
+            self.text = f.read()
+
+        self.name = re.search(r"const\s+lv_img_dsc_t\s+(\w+)\s*=", self.text).group(1)
+        self.cf = re.search(r"\.header\.cf\s*=\s*LV_IMG_CF_(\w+)", self.text).group(1)
+        self.w = int(re.search(r"\.header\.w\s*=\s*(\d+)", self.text).group(1))
+        self.h = int(re.search(r"\.header\.h\s*=\s*(\d+)", self.text).group(1))
+
+        data = re.search(r"(\w+)_data\[\]\s*=\s*\{(.*?)\};", self.text, re.S)
+        shared = re.search(r"extern const uint8_t (\w+)_data\[\];", self.text)
+        self.owner = shared.group(1) if shared else None
+        self.data = bytes(int(v, 16) for v in re.findall(r"0x([0-9A-Fa-f]{2})", data.group(2))) if data else None
+        self.pixels = None
+
+    def decode(self):
+        d = self.data
+        n = self.w * self.h
+        cf = self.cf
+        if cf in RLE:
+            cf, size = RLE[cf]
+            d = unrle(d, size, n)
+
+        if cf == "TRUE_COLOR_ALPHA":
+            self.pixels = [(d[i:i + 2], d[i + 2]) for i in range(0, n * 3, 3)]
+        elif cf == "TRUE_COLOR":
+            self.pixels = [(d[i:i + 2], 0xFF) for i in range(0, n * 2, 2)]
+        elif self.cf.startswith("INDEXED_"):
+            bpp = int(self.cf[8])
+            colors = 1 << bpp
+            palette = [(color32_to_rgb565(d[i * 4:i * 4 + 4]), d[i * 4 + 3]) for i in range(colors)]
+            self.pixels = [palette[v] for v in unpack(d[colors * 4:], self.w, self.h, bpp)]
+        elif self.cf.startswith("ALPHA_"):
+            bpp = int(self.cf[6])
+            scale = 255 // ((1 << bpp) - 1)
+            self.pixels = [(None, v * scale) for v in unpack(d, self.w, self.h, bpp)]
+        else:
+            raise ValueError("%s: LV_IMG_CF_%s is not supported" % (self.path, self.cf))
+
+        # color does not matter where the pixel is transparent
+        self.pixels = [(c if a else b"\0\0", a) for c, a in self.pixels]
+
+
+def color32_to_rgb565(c):
+    # lv_color32_t is b, g, r, a, LV_COLOR_16_SWAP puts the high byte first
+    v = (c[2] >> 3) << 11 | (c[1] >> 2) << 5 | c[0] >> 3
+    return bytes((v >> 8, v & 0xFF))
+
+
+def rgb565_to_color32(c, a):
+    v = c[0] << 8 | c[1]
+    r = (v >> 11) & 0x1F
+    g = (v >> 5) & 0x3F
+    b = v & 0x1F
+    return bytes((b << 3 | b >> 2, g << 2 | g >> 4, r << 3 | r >> 2, a))
+
+
+def rle(data, size):
+    """
+    Runs of 2 to 128 equal pixels are a control byte 0x80 | (count - 1) and the pixel,
+    anything else is a control byte (count - 1) and up to 128 literal pixels.
+    """
+    pixels = [data[i:i + size] for i in range(0, len(data), size)]
+    out = bytearray()
+    literal = []
+
+    def flush():
+        while literal:
+            chunk = literal[:128]
+            del literal[:128]
+            out.append(len(chunk) - 1)
+            out.extend(b"".join(chunk))
+
+    i = 0
+    while i < len(pixels):
+        j = i
+        while j < len(pixels) and j - i < 128 and pixels[j] == pixels[i]:
+            j += 1
+        if j - i >= 2:
+            flush()
+            out.append(0x80 | (j - i - 1))
+            out.extend(pixels[i])
+            i = j
+        else:
+            literal.append(pixels[i])
+            i += 1
+    flush()
+    return bytes(out)
+
+
+def unrle(data, size, count):
+    out = bytearray()
+    i = 0
+    while len(out) < count * size:
+        n = (data[i] & 0x7F) + 1
+        if data[i] & 0x80:
+            out.extend(data[i + 1:i + 1 + size] * n)
+            i += 1 + size
+        else:
+            out.extend(data[i + 1:i + 1 + n * size])
+            i += 1 + n * size
+    return bytes(out)
+
+
+def pack(values, w, h, bpp):
+    # rows start on a byte, the first pixel is in the most significant bits
+    if bpp == 8:
+        return bytes(values)
+    out = bytearray()
+    per_byte = 8 // bpp
+    for y in range(h):
+        row = values[y * w:(y + 1) * w]
+        for x in range(0, w, per_byte):
+            byte = 0
+            for i, v in enumerate(row[x:x + per_byte]):
+                byte |= v << (8 - bpp * (i + 1))
+            out.append(byte)
+    return bytes(out)
+
+
+def unpack(data, w, h, bpp):
+    if bpp == 8:
+        return list(data[:w * h])
+    stride = (w * bpp + 7) // 8
+    mask = (1 << bpp) - 1
+    values = []
+    for y in range(h):
+        for x in range(w):
+            byte = data[y * stride + x * bpp // 8]
+            values.append(byte >> (8 - bpp - x * bpp % 8) & mask)
+    return values
+
+
+def encodings(img, mode):
+    """Every exact encoding allowed for the image, as (cf, data)"""
+    pixels = img.pixels
+    alphas = set(a for _, a in pixels)
+    colors = set(c for c, a in pixels if a)
+
+    if mode == "alpha":
+        if len(colors) > 1:
+            raise ValueError("%s: %d colors, can not be alpha only" % (img.path, len(colors)))
+        for bpp in (1, 2, 4, 8):
+            scale = 255 // ((1 << bpp) - 1)
+            if all(a % scale == 0 for a in alphas):
+                yield "ALPHA_%dBIT" % bpp, pack([a // scale for _, a in pixels], img.w, img.h, bpp)
+        return
+
+    if None in colors:
+        raise ValueError("%s: alpha only image, only \"alpha\" is possible" % img.path)
+
+    if alphas == {0xFF}:
+        data = b"".join(c for c, _ in pixels)
+        yield "TRUE_COLOR", data
+        yield "USER_ENCODED_0", rle(data, 2)
+    if mode == "true-color":
+        return
+
+    data = b"".join(c + bytes((a,)) for c, a in pixels)
+    yield "TRUE_COLOR_ALPHA", data
+    yield "USER_ENCODED_1", rle(data, 3)
+
+    palette = sorted(set(pixels))
+    index = {p: i for i, p in enumerate(palette)}
+    for bpp in (1, 2, 4, 8):
+        if len(palette) <= 1 << bpp:
+            table = b"".join(rgb565_to_color32(c, a) for c, a in palette)
+            table += bytes(4 * ((1 << bpp) - len(palette)))
+            yield "INDEXED_%dBIT" % bpp, table + pack([index[p] for p in pixels], img.w, img.h, bpp)
+            break
+
+
+def choose(img, mode):
+    """Smallest encoding, run length encoded only if it saves enough to pay for the decoded copy"""
+    plain = [e for e in encodings(img, mode) if e[0] not in RLE]
+    encoded = [e for e in encodings(img, mode) if e[0] in RLE]
+    best = min(plain, key=lambda e: len(e[1]))
+    if encoded:
+        smallest = min(encoded, key=lambda e: len(e[1]))
+        if len(smallest[1]) + RLE_MIN_SAVING <= len(best[1]):
+            return smallest
+    return best
+
+
+def draw_path(cf):
+    if cf in RLE:
+        return DRAW[RLE[cf][0]] + ", decoded once"
+    return DRAW[cf if cf.startswith("TRUE_COLOR") else cf.split("_")[0]]
+
+
+def format_data(values):
+    lines = []
+    for i in range(0, len(values), BYTES_PER_LINE):
+        lines.append("    " + ",".join("0x%02X" % v for v in values[i:i + BYTES_PER_LINE]) + ",")
+    return "\n".join(lines)
+
+
+def write(img, cf, data, owner):
+    # keep the SquareLine header up to and including the IMAGE DATA line
+    head = re.match(r"(.*?// IMAGE DATA:[^\n]*\n)", img.text, re.S)
+    head = head.group(1) if head else '#include "ui.h"\n\n'
+    lines = [head.rstrip("\n")]
+    if cf in RLE:
+        lines.append("// Run length encoded LV_IMG_CF_%s, decoded by src/img_cache.cpp" % RLE[cf][0])
+
+    if owner:
+        lines.append("// Same pixels as %s" % owner.name)
+        lines.append("extern const uint8_t %s_data[];" % owner.name)
+        data_name = owner.name + "_data"
+        data_size = str(len(data))
+    else:
+        lines.append("const LV_ATTRIBUTE_MEM_ALIGN uint8_t %s_data[] = {" % img.name)
+        lines.append(format_data(data))
+        lines.append("    };")
+        data_name = img.name + "_data"
+        data_size = "sizeof(%s)" % data_name
+
+    lines.append("const lv_img_dsc_t %s = {" % img.name)
+    lines.append("   .header.always_zero = 0,")
+    lines.append("   .header.w = %d," % img.w)
+    lines.append("   .header.h = %d," % img.h)
+    lines.append("   .data_size = %s," % data_size)
+    lines.append("   .header.cf = LV_IMG_CF_%s," % cf)
+    lines.append("   .data = %s};" % data_name)
+
+    with open(img.path, "w") as f:
+        f.write("\n".join(lines) + "\n\n")
+
+
+def compile_images(paths, overrides, dry_run):
+    images = [Image(p) for p in paths]
+    by_name = {img.name: img for img in images}
+    for img in images:
+        if img.owner:
+            if img.owner not in by_name:
+                raise ValueError("%s: shares data with %s, compile them together" % (img.path, img.owner))
+            img.data = by_name[img.owner].data
+            img.cf = by_name[img.owner].cf
+    for img in images:
+        img.decode()
+
+    owners = {}
+    rows = []
+    total_before = total_after = 0
+    for img in images:
+        before = len(img.data) if not img.owner else 0
+        cf, data = choose(img, overrides.get(img.name))
+
+        owner = owners.setdefault((cf, img.w, img.h, data), img)
+        owner = owner if owner is not img else None
+        after = 0 if owner else len(data)
+
+        total_before += before
+        total_after += after
+        rows.append((img.name, "%dx%d" % (img.w, img.h), before, cf, after,
+                     "= " + owner.name if owner else draw_path(cf), "%.2f" % (len(data) / (img.w * img.h))))
+        if not dry_run and (owner or img.owner or cf != img.cf or data != img.data):
+            write(img, cf, data, owner)
+
+    print("%-26s %8s %7s  %-18s %7s  %-5s %s" % ("image", "size", "before", "format", "after", "B/px", "draw"))
+    for name, size, before, cf, after, draw, bpp in rows:
+        print("%-26s %8s %7d  %-18s %7d  %-5s %s" % (name, size, before, cf, after, bpp, draw))
+    print("total %d -> %d bytes, %d saved" % (total_before, total_after, total_before - total_after))
+
+
+def atlas(name, out, paths):
+    glyphs = []
+    for path in paths:
+        img = Image(path)
+        if img.owner:
+            raise ValueError("%s: shares data, use the file of %s" % (path, img.owner))
+        img.decode()
+        if glyphs and (img.w, img.h) != (glyphs[0].w, glyphs[0].h):
+            raise ValueError("%s: %dx%d, the atlas is %dx%d" % (path, img.w, img.h, glyphs[0].w, glyphs[0].h))
+        cf, data = list(encodings(img, "alpha"))[-1]
+        img.atlas = data
+        glyphs.append(img)
+
+    w, h = glyphs[0].w, glyphs[0].h
+    lines = [ATLAS_HEADER % (name, " ".join(os.path.basename(p) for p in paths))]
+    lines.append("const LV_ATTRIBUTE_MEM_ALIGN uint8_t %s_data[] = {" % name)
+    lines.append(format_data(b"".join(g.atlas for g in glyphs)))
+    lines.append("};\n")
+    lines.append("const lv_img_dsc_t %s[%d] = {" % (name, len(glyphs)))
+    for i in range(len(glyphs)):
+        lines.append("    {.header.always_zero = 0, .header.w = %d, .header.h = %d, .header.cf = LV_IMG_CF_ALPHA_8BIT,"
+                     % (w, h))
+        lines.append("     .data_size = %d, .data = %s_data + %d}," % (w * h, name, i * w * h))
+    lines.append("};")
+
+    with open(out, "w") as f:
+        f.write("\n".join(lines) + "\n")
+
+    print("%s: %d images, %d bytes" % (out, len(glyphs), len(glyphs) * w * h))
+
+
+def resource_pack(out, paths):
+    """Pack compiled images as they are, images with the same data share it"""
+    images = [Image(p) for p in paths]
+    by_name = {img.name: img for img in images}
+    for img in images:
+        if img.owner:
+            if img.owner not in by_name:
+                raise ValueError("%s: shares data with %s, pack them together" % (img.path, img.owner))
+            img.data = by_name[img.owner].data
+            img.cf = by_name[img.owner].cf
+        if img.cf not in PACK_FORMATS:
+            raise ValueError("%s: LV_IMG_CF_%s can not be packed" % (img.path, img.cf))
+        if len(img.name) >= PACK_NAME_SIZE:
+            raise ValueError("%s: name %s is too long" % (img.path, img.name))
+    images.sort(key=lambda img: img.name)
+
+    header = struct.Struct("<4sHHII")
+    entry = struct.Struct("<%dsBBHHHII" % PACK_NAME_SIZE)
+    offset = header.size + entry.size * len(images)
+    offsets = {}
+    blobs = []
+    for img in images:
+        if img.data not in offsets:
+            offset = (offset + 3) & ~3
+            offsets[img.data] = offset
+            blobs.append((offset, img.data))
+            offset += len(img.data)
+
+    pack_data = bytearray(offset)
+    header.pack_into(pack_data, 0, PACK_MAGIC, PACK_VERSION, len(images), len(pack_data), 0)
+    for i, img in enumerate(images):
+        entry.pack_into(pack_data, header.size + i * entry.size, img.name.encode(), PACK_FORMATS.index(img.cf), 0,
+                        img.w, img.h, 0, offsets[img.data], len(img.data))
+    for offset, data in blobs:
+        pack_data[offset:offset + len(data)] = data
+
+    with open(out, "wb") as f:
+        f.write(pack_data)
+
+    print("%s: %d images, %d bytes" % (out, len(images), len(pack_data)))
+
+
+def image_usage(images, root=ROOT):
+    """
+    USED, IMGSET when only an unused ui_imgset array in ui.c lists it (the linker drops it), or
+    UNREFERENCED when nothing mentions it. Images owning data that a used image shares are used.
+    """
+    text = ""
+    for pattern in SOURCES:
+        for path in sorted(glob.glob(os.path.join(root, pattern))):
+            with open(path) as f:
+                text += f.read() + "\n"
+    text = re.sub(r"//[^\n]*|/\*.*?\*/", "", text, flags=re.S)
+    text = re.sub(r"LV_IMG_DECLARE\(\s*\w+\s*\);", "", text)
+
+    imgsets = ""
+    for m in re.finditer(r"const\s+lv_img_dsc_t\s*\*\s*(ui_imgset_\w+)\s*\[\d*\]\s*=\s*\{.*?\};", text, re.S):
+        if len(re.findall(r"\b%s\b" % m.group(1), text)) == 1:
+            imgsets += m.group(0)
+            text = text.replace(m.group(0), "")
+
+    usage = {}
+    for img in images:
+        if re.search(r"\b%s\b" % img.name, text):
+            usage[img.name] = USED
+        elif re.search(r"\b%s\b" % img.name, imgsets):
+            usage[img.name] = IMGSET
+        else:
+            usage[img.name] = UNREFERENCED
+    for img in images:
+        if img.owner and usage[img.name] == USED:
+            usage[img.owner] = USED
+    return usage
+
+
+def print_usage(images, usage):
+    """
+    The unused images by source size. None of them is in the firmware, --gc-sections drops them with or
+    without the build filter, so the sizes are not flash savings: see the linked sizes after the build.
+    """
+    print("%-26s %-18s %7s  %s" % ("unused image", "format", "bytes", "left out by"))
+    unused = 0
+    for img in images:
+        if usage[img.name] == USED:
+            continue
+        size = 0 if img.owner else len(img.data)
+        unused += size
+        print("%-26s %-18s %7d  %s" % (img.name, img.cf, size,
+                                       "build filter and linker" if usage[img.name] == UNREFERENCED else "linker"))
+    used = sum(len(img.data) for img in images if usage[img.name] == USED and not img.owner)
+    print("%d bytes of unused image data (not linked either way), %d bytes used" % (unused, used))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--dry-run", action="store_true", help="only print the report")
+    parser.add_argument("--atlas", metavar="NAME", help="write one A8 atlas named NAME instead")
+    parser.add_argument("-o", "--output", help="atlas source file")
+    parser.add_argument("--pack", metavar="FILE", help="write the images to a resource pack instead")
+    parser.add_argument("--unused", action="store_true", help="only report the images nothing uses")
+    parser.add_argument("files", nargs="+")
+    args = parser.parse_args()
+
+    try:
+        if args.unused:
+            images = [Image(p) for p in args.files]
+            print_usage(images, image_usage(images))
+        elif args.pack:
+            resource_pack(args.pack, args.files)
+        elif args.atlas:
+            atlas(args.atlas, args.output or args.atlas + ".c", args.files)
+        else:
+            with open(OVERRIDES) as f:
+                overrides = json.load(f)
+            compile_images(args.files, overrides, args.dry_run)
+    except ValueError as e:
+        print(e, file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,472 @@
+#!/usr/bin/env python3
+"""
+Subset lvgl's built in Montserrat fonts to the glyphs the UI can show.
+
+The screens (src/ui/ui.c) and the runtime label updates (src/*.cpp) are scanned for the fonts each
+label uses and the text it can get:
+
+  string literals          their characters, "%d" adds the digits and '-'
+  anything else            printable ASCII and the degree sign (Chronos texts, city names)
+
+LV_FONT_DEFAULT stays complete, lvgl's widgets (calendar arrows, ...) draw symbols with it.
+For every other font a subset is written from lvgl's lv_font_montserrat_<size>.c to
+src/fonts/lv_font_montserrat_<size>.c under the same name, and lib/lv_font_subset.h turns the full
+font off in lv_conf.h. Both only take effect with FONT_SUBSET defined, which tools/subset_fonts.py
+does for PlatformIO builds once the subsets were written, so a failed subset keeps the full fonts:
+
+  python tools/font_subset.py                                   report the glyph sets only
+  python tools/font_subset.py --lvgl .pio/libdeps/wt32-sc01-plus/lvgl
+
+Subsets keep lvgl's plain bitmap format, compressed fonts are decompressed on every glyph draw.
+Consecutive code points get a direct lookup cmap, the rest share one sparse cmap.
+"""
+
+import argparse
+import glob
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SCREENS = "src/ui/ui.c"
+RUNTIME = ["src/*.cpp", "src/*.c"]
+OUT_DIR = "src/fonts"
+HEADER = "lib/lv_font_subset.h"
+LV_CONF = "lib/lv_conf.h"
+
+DEGREE = 0xB0
+DYNAMIC = set(range(0x20, 0x7F)) | {DEGREE}
+DIGITS = set(map(ord, "-0123456789"))
+
+FONT_REF = r"&lv_font_montserrat_(\d+)\b"
+
+CMAP_FORMAT0_TINY = "LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY"
+CMAP_SPARSE_TINY = "LV_FONT_FMT_TXT_CMAP_SPARSE_TINY"
+
+# bytes in flash per element, lv_font_fmt_txt.h on a 32 bit target
+GLYPH_DSC_SIZE = 8
+CMAP_SIZE = 20
+
+
+def c_string(literal):
+    """Characters of adjacent C string literals"""
+    text = "".join(re.findall(r'"((?:[^"\\]|\\.)*)"', literal))
+    return re.sub(r"\\(.)", lambda m: {"n": "\n", "t": "\t"}.get(m.group(1), m.group(1)), text)
+
+
+def format_chars(text):
+    """Characters a printf format can produce, None when an argument can be any text"""
+    chars = set()
+    for part in re.split(r"(%[-+ #0-9.]*[a-zA-Z%])", text):
+        if not part.startswith("%"):
+            chars |= set(map(ord, part))
+        elif part[-1] in "diu":
+            chars |= DIGITS
+        elif part[-1] == "%":
+            chars.add(ord("%"))
+        else:
+            return None
+    return chars
+
+
+def default_font(root):
+    with open(os.path.join(root, LV_CONF)) as f:
+        m = re.search(r"#define\s+LV_FONT_DEFAULT\s+" + FONT_REF, f.read())
+    return int(m.group(1)) if m else None
+
+
+def font_usage(root=ROOT):
+    """{size: set of code points}, None for fonts that must stay complete"""
+    with open(os.path.join(root, SCREENS), encoding="utf-8") as f:
+        screens = f.read()
+    runtime = ""
+    for pattern in RUNTIME:
+        for path in sorted(glob.glob(os.path.join(root, pattern))):
+            with open(path, encoding="utf-8") as f:
+                runtime += f.read() + "\n"
+
+    label_font = {}
+    for m in re.finditer(r"lv_obj_set_style_text_font\(\s*(\w+)\s*,\s*" + FONT_REF, screens):
+        label_font[m.group(1)] = int(m.group(2))
+
+    usage = {}
+    for text in (screens, runtime):
+        for size in map(int, re.findall(FONT_REF, text)):
+            usage.setdefault(size, set())
+
+    for text in (screens, runtime):
+        for m in re.finditer(r"lv_label_set_text(_fmt)?\(\s*(\w+)\s*,\s*(.*?)\)\s*;", text, re.S):
+            size = label_font.get(m.group(2))
+            if size is None:
+                continue
+            arg = m.group(3).strip()
+            chars = None
+            if arg.startswith('"'):
+                literal = re.match(r'("(?:[^"\\]|\\.)*"\s*)+', arg).group(0)
+                text_arg = c_string(literal)
+                chars = format_chars(text_arg) if m.group(1) else set(map(ord, text_arg))
+            if usage[size] is not None:
+                usage[size] |= DYNAMIC if chars is None else chars
+
+    # fonts no label of ours uses (styles, lvgl widgets) stay complete
+    for size in usage:
+        if size not in label_font.values():
+            usage[size] = None
+    default = default_font(root)
+    if default is not None:
+        usage[default] = None
+    for size in usage:
+        if usage[size] is not None:
+            usage[size] -= {ord("\n"), ord("\t")}
+    return usage
+
+
+class LvFont:
+    """An lv_font_fmt_txt font source as written by lv_font_conv"""
+
+    def __init__(self, path):
+        with open(path, encoding="utf-8") as f:
+            text = f.read()
+        self.path = path
+
+        def array(name):
+            m = re.search(r"\b%s\[\]\s*=\s*\{(.*?)\};" % name, text, re.S)
+            if not m:
+                return None
+            body = re.sub(r"/\*.*?\*/", "", m.group(1), flags=re.S)
+            return [int(v, 0) for v in re.findall(r"-?(?:0x[0-9a-fA-F]+|\d+)", body)]
+
+        def field(name, body=text):
+            m = re.search(r"\.%s\s*=\s*&?(-?\w+)" % name, body)
+            return m.group(1) if m else None
+
+        self.name = re.search(r"const\s+lv_font_t\s+(\w+)\s*=", text).group(1)
+        self.bitmap = bytes(array("glyph_bitmap"))
+
+        dsc = re.search(r"glyph_dsc\[\]\s*=\s*\{(.*?)\};", text, re.S).group(1)
+        self.glyphs = []
+        for entry in re.findall(r"\{([^{}]*)\}", dsc):
+            self.glyphs.append({k: int(field(k, entry)) for k in
+                                ("bitmap_index", "adv_w", "box_w", "box_h", "ofs_x", "ofs_y")})
+
+        font_dsc = re.search(r"lv_font_fmt_txt_dsc_t\s+font_dsc\s*=\s*\{(.*?)\};", text, re.S).group(1)
+        self.bpp = int(field("bpp", font_dsc))
+        self.bitmap_format = int(field("bitmap_format", font_dsc))
+        self.kern_scale = int(field("kern_scale", font_dsc))
+        self.kern_classes = int(field("kern_classes", font_dsc))
+        self.has_kern = field("kern_dsc", font_dsc) not in (None, "NULL")
+
+        font = re.search(r"lv_font_t\s+%s\s*=\s*\{(.*?)\};" % self.name, text, re.S).group(1)
+        self.line_height = int(field("line_height", font))
+        self.base_line = int(field("base_line", font))
+        self.subpx = field("subpx", font) or "LV_FONT_SUBPX_NONE"
+        self.underline_position = int(field("underline_position", font) or 0)
+        self.underline_thickness = int(field("underline_thickness", font) or 0)
+
+        # code point -> glyph id
+        self.cmap = {}
+        cmaps = re.search(r"cmaps\[\]\s*=\s*\{(.*?)\};", text, re.S).group(1)
+        for entry in re.findall(r"\{([^{}]*)\}", cmaps):
+            start = int(field("range_start", entry))
+            length = int(field("range_length", entry))
+            first = int(field("glyph_id_start", entry))
+            kind = field("type", entry)
+            unicode_list = field("unicode_list", entry)
+            ofs_list = field("glyph_id_ofs_list", entry)
+            unicodes = array(unicode_list) if unicode_list != "NULL" else None
+            offsets = array(ofs_list) if ofs_list != "NULL" else None
+            if kind == CMAP_FORMAT0_TINY:
+                for i in range(length):
+                    self.cmap[start + i] = first + i
+            elif kind == "LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL":
+                for i, ofs in enumerate(offsets):
+                    if ofs or i == 0:
+                        self.cmap[start + i] = first + ofs
+            elif kind == CMAP_SPARSE_TINY:
+                for i, u in enumerate(unicodes):
+                    self.cmap[start + u] = first + i
+            elif kind == "LV_FONT_FMT_TXT_CMAP_SPARSE_FULL":
+                for u, ofs in zip(unicodes, offsets):
+                    self.cmap[start + u] = first + ofs
+            else:
+                raise ValueError("%s: cmap type %s" % (path, kind))
+        self.cmap_count = len(re.findall(r"\{([^{}]*)\}", cmaps))
+        self.unicode_count = sum(len(array(n) or []) for n in re.findall(r"\b(unicode_list_\d+)\[\]", text))
+
+        self.kern_left = self.kern_right = self.kern_values = self.kern_pairs = None
+        if self.has_kern and self.kern_classes:
+            self.kern_left = array("kern_left_class_mapping")
+            self.kern_right = array("kern_right_class_mapping")
+            self.kern_values = array("kern_class_values")
+            classes = re.search(r"kern_classes\s*=\s*\{(.*?)\};", text, re.S).group(1)
+            self.left_classes = int(field("left_class_cnt", classes))
+            self.right_classes = int(field("right_class_cnt", classes))
+        elif self.has_kern:
+            ids = array("kern_pair_glyph_ids")
+            self.kern_pairs = list(zip(zip(ids[0::2], ids[1::2]), array("kern_pair_values")))
+
+        # glyph bitmaps are stored in glyph order, each one up to the start of the next
+        order = sorted(range(1, len(self.glyphs)), key=lambda g: self.glyphs[g]["bitmap_index"])
+        self.glyph_bytes = {}
+        for i, g in enumerate(order):
+            start = self.glyphs[g]["bitmap_index"]
+            end = self.glyphs[order[i + 1]]["bitmap_index"] if i + 1 < len(order) else len(self.bitmap)
+            if self.bitmap_format == 0:
+                end = start + (self.glyphs[g]["box_w"] * self.glyphs[g]["box_h"] * self.bpp + 7) // 8
+            self.glyph_bytes[g] = self.bitmap[start:end]
+
+    def size(self):
+        """[bytes] glyph data in flash"""
+        kern = 0
+        if self.kern_values is not None:
+            kern = len(self.kern_left) + len(self.kern_right) + len(self.kern_values)
+        elif self.kern_pairs is not None:
+            kern = len(self.kern_pairs) * 3
+        return (len(self.bitmap) + len(self.glyphs) * GLYPH_DSC_SIZE + self.cmap_count * CMAP_SIZE +
+                self.unicode_count * 2 + kern)
+
+    def subset(self, code_points):
+        """A copy with only `code_points`, the ones the font does not have are left out"""
+        keep = sorted(cp for cp in code_points if cp in self.cmap)
+        runs = []
+        singles = []
+        i = 0
+        while i < len(keep):
+            j = i
+            while j + 1 < len(keep) and keep[j + 1] == keep[j] + 1:
+                j += 1
+            if j > i:
+                runs.append(keep[i:j + 1])
+            else:
+                singles.append(keep[i])
+            i = j + 1
+
+        sub = LvFont.__new__(LvFont)
+        sub.__dict__.update(self.__dict__)
+        sub.cmaps = []
+        order = []
+        for run in runs:
+            sub.cmaps.append((run[0], len(run), len(order) + 1, CMAP_FORMAT0_TINY, None))
+            order += run
+        if singles:
+            sub.cmaps.append((singles[0], singles[-1] - singles[0] + 1, len(order) + 1, CMAP_SPARSE_TINY,
+                              [cp - singles[0] for cp in singles]))
+            order += singles
+
+        old_ids = [0] + [self.cmap[cp] for cp in order]
+        new_id = {old: new for new, old in enumerate(old_ids)}
+        sub.cmap = {cp: new_id[self.cmap[cp]] for cp in order}
+        sub.code_points = order
+
+        sub.glyphs = [dict(self.glyphs[0])]
+        sub.glyph_bytes = {}
+        bitmap = bytearray()
+        for new, old in enumerate(old_ids[1:], 1):
+            glyph = dict(self.glyphs[old])
+            glyph["bitmap_index"] = len(bitmap)
+            bitmap += self.glyph_bytes[old]
+            sub.glyph_bytes[new] = self.glyph_bytes[old]
+            sub.glyphs.append(glyph)
+        sub.bitmap = bytes(bitmap)
+        sub.cmap_count = len(sub.cmaps)
+        sub.unicode_count = len(singles)
+
+        if self.kern_values is not None:
+            sub.kern_left = [self.kern_left[g] for g in old_ids]
+            sub.kern_right = [self.kern_right[g] for g in old_ids]
+        elif self.kern_pairs is not None:
+            sub.kern_pairs = sorted(((new_id[l], new_id[r]), v) for (l, r), v in self.kern_pairs
+                                    if l in new_id and r in new_id and l and r)
+        return sub
+
+    def write(self, path, source):
+        def values(items, per_line=16):
+            items = list(items)
+            return "\n".join("    " + ", ".join(items[i:i + per_line]) + ","
+                             for i in range(0, len(items), per_line))
+
+        chars = "".join(chr(cp) if cp != DEGREE else "deg" for cp in self.code_points)
+        lines = [
+            "/* Generated by tools/font_subset.py from lvgl's %s, do not edit" % os.path.basename(source),
+            " * %d glyphs: %s" % (len(self.code_points), chars.replace("*/", "* /")),
+            " */",
+            "",
+            "#ifdef FONT_SUBSET",
+            "",
+            '#include "lvgl.h"',
+            "",
+            "static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {",
+            values(("0x%02x" % b for b in self.bitmap)) if self.bitmap else "    0,",
+            "};",
+            "",
+            "static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {",
+        ]
+        for i, g in enumerate(self.glyphs):
+            lines.append("    {.bitmap_index = %d, .adv_w = %d, .box_w = %d, .box_h = %d, .ofs_x = %d, .ofs_y = %d},%s"
+                         % (g["bitmap_index"], g["adv_w"], g["box_w"], g["box_h"], g["ofs_x"], g["ofs_y"],
+                            " /* id = 0 reserved */" if i == 0 else ""))
+        lines.append("};")
+        lines.append("")
+
+        for i, cmap in enumerate(self.cmaps):
+            if cmap[4] is not None:
+                lines.append("static const uint16_t unicode_list_%d[] = {" % i)
+                lines.append(values("0x%x" % u for u in cmap[4]))
+                lines.append("};")
+                lines.append("")
+        lines.append("static const lv_font_fmt_txt_cmap_t cmaps[] = {")
+        for i, (start, length, first, kind, unicodes) in enumerate(self.cmaps):
+            lines.append("    {.range_start = %d, .range_length = %d, .glyph_id_start = %d," % (start, length, first))
+            lines.append("     .unicode_list = %s, .glyph_id_ofs_list = NULL, .list_length = %d, .type = %s},"
+                         % ("unicode_list_%d" % i if unicodes is not None else "NULL",
+                            len(unicodes) if unicodes is not None else 0, kind))
+        lines.append("};")
+        lines.append("")
+
+        kern_dsc = "NULL"
+        kern_classes = 0
+        if self.kern_values is not None:
+            kern_dsc = "&kern_classes"
+            kern_classes = 1
+            lines.append("static const uint8_t kern_left_class_mapping[] = {")
+            lines.append(values(map(str, self.kern_left)))
+            lines.append("};")
+            lines.append("")
+            lines.append("static const uint8_t kern_right_class_mapping[] = {")
+            lines.append(values(map(str, self.kern_right)))
+            lines.append("};")
+            lines.append("")
+            lines.append("static const int8_t kern_class_values[] = {")
+            lines.append(values(map(str, self.kern_values)))
+            lines.append("};")
+            lines.append("")
+            lines.append("static const lv_font_fmt_txt_kern_classes_t kern_classes = {")
+            lines.append("    .class_pair_values = kern_class_values,")
+            lines.append("    .left_class_mapping = kern_left_class_mapping,")
+            lines.append("    .right_class_mapping = kern_right_class_mapping,")
+            lines.append("    .left_class_cnt = %d," % self.left_classes)
+            lines.append("    .right_class_cnt = %d," % self.right_classes)
+            lines.append("};")
+            lines.append("")
+        elif self.kern_pairs:
+            kern_dsc = "&kern_pairs"
+            lines.append("static const uint8_t kern_pair_glyph_ids[] = {")
+            lines.append(values("%d, %d" % ids for ids, _ in self.kern_pairs))
+            lines.append("};")
+            lines.append("")
+            lines.append("static const int8_t kern_pair_values[] = {")
+            lines.append(values(str(v) for _, v in self.kern_pairs))
+            lines.append("};")
+            lines.append("")
+            lines.append("static const lv_font_fmt_txt_kern_pair_t kern_pairs = {")
+            lines.append("    .glyph_ids = kern_pair_glyph_ids,")
+            lines.append("    .values = kern_pair_values,")
+            lines.append("    .pair_cnt = %d," % len(self.kern_pairs))
+            lines.append("    .glyph_ids_size = 0,")
+            lines.append("};")
+            lines.append("")
+
+        lines += [
+            "static lv_font_fmt_txt_glyph_cache_t cache;",
+            "static const lv_font_fmt_txt_dsc_t font_dsc = {",
+            "    .glyph_bitmap = glyph_bitmap,",
+            "    .glyph_dsc = glyph_dsc,",
+            "    .cmaps = cmaps,",
+            "    .kern_dsc = %s," % kern_dsc,
+            "    .kern_scale = %d," % self.kern_scale,
+            "    .cmap_num = %d," % len(self.cmaps),
+            "    .bpp = %d," % self.bpp,
+            "    .kern_classes = %d," % kern_classes,
+            "    .bitmap_format = %d," % self.bitmap_format,
+            "    .cache = &cache,",
+            "};",
+            "",
+            "const lv_font_t %s = {" % self.name,
+            "    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,",
+            "    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,",
+            "    .line_height = %d," % self.line_height,
+            "    .base_line = %d," % self.base_line,
+            "    .subpx = %s," % self.subpx,
+            "    .underline_position = %d," % self.underline_position,
+            "    .underline_thickness = %d," % self.underline_thickness,
+            "    .dsc = &font_dsc,",
+            "};",
+            "",
+            "#endif",
+        ]
+        with open(path, "w", encoding="utf-8") as f:
+            f.write("\n".join(lines) + "\n")
+
+
+def find_fonts(lvgl):
+    for candidate in (os.path.join(lvgl, "src", "font"), os.path.join(lvgl, "font"), lvgl):
+        if glob.glob(os.path.join(candidate, "lv_font_montserrat_*.c")):
+            return candidate
+    raise ValueError("%s: no lv_font_montserrat_*.c" % lvgl)
+
+
+def describe(code_points):
+    if code_points is None:
+        return "complete"
+    text = "".join(chr(c) for c in sorted(code_points))
+    return "%d glyphs: %s" % (len(code_points), text if len(text) < 40 else text[:37] + "...")
+
+
+def subset_fonts(root, lvgl):
+    """Write the subsets and the lv_conf.h header, returns the flash saved in bytes"""
+    usage = font_usage(root)
+    fonts = find_fonts(lvgl)
+    out_dir = os.path.join(root, OUT_DIR)
+    os.makedirs(out_dir, exist_ok=True)
+
+    print("%-22s %8s %8s  %s" % ("font", "before", "after", "glyphs"))
+    subsets = []
+    before_total = after_total = 0
+    for size in sorted(usage):
+        source = os.path.join(fonts, "lv_font_montserrat_%d.c" % size)
+        if usage[size] is None or not os.path.exists(source):
+            print("%-22s %8s %8s  %s" % ("lv_font_montserrat_%d" % size, "-", "-", describe(None)))
+            continue
+        font = LvFont(source)
+        sub = font.subset(usage[size])
+        sub.write(os.path.join(out_dir, "lv_font_montserrat_%d.c" % size), source)
+        subsets.append(size)
+        before_total += font.size()
+        after_total += sub.size()
+        print("%-22s %8d %8d  %s" % (font.name, font.size(), sub.size(), describe(sub.code_points)))
+
+    # lvgl's copy of a subset font must not be built as well
+    lines = ["/* Generated by tools/font_subset.py, do not edit, included by lv_conf.h with FONT_SUBSET */", ""]
+    for size in subsets:
+        lines.append("#undef LV_FONT_MONTSERRAT_%d" % size)
+        lines.append("#define LV_FONT_MONTSERRAT_%d 0" % size)
+    lines.append("")
+    lines.append("#undef LV_FONT_CUSTOM_DECLARE")
+    lines.append("#define LV_FONT_CUSTOM_DECLARE %s" % " ".join("LV_FONT_DECLARE(lv_font_montserrat_%d)" % s
+                                                              for s in subsets))
+    with open(os.path.join(root, HEADER), "w") as f:
+        f.write("\n".join(lines) + "\n")
+
+    print("font data %d -> %d bytes, %d saved" % (before_total, after_total, before_total - after_total))
+    return before_total - after_total
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--lvgl", help="lvgl library folder to subset the fonts of")
+    args = parser.parse_args()
+
+    try:
+        if args.lvgl:
+            subset_fonts(ROOT, args.lvgl)
+        else:
+            for size, code_points in sorted(font_usage().items()):
+                print("lv_font_montserrat_%-3d %s" % (size, describe(code_points)))
+    except (ValueError, AttributeError, OSError) as e:
+        print(e, file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,55 @@
+"""
+PlatformIO pre script: leave the SquareLine images that nothing refers to out of the build and print
+them (tools/asset_compiler.py --unused prints the same without building). --gc-sections already keeps
+every unused image out of the firmware, so this only shortens the compile, flash and OTA image sizes
+do not change. Images only listed in ui.c's unused ui_imgset arrays stay in the build for ui.c to link.
+
+After linking it prints what the firmware really carries: the size of firmware.bin, the OTA image, and
+the image data linked into it. Build with PRUNE_ASSETS=0 in the environment to compare without the
+filter.
+"""
+
+import glob
+import os
+import subprocess
+import sys
+
+Import("env")  # noqa: F821, provided by PlatformIO
+
+root = env.subst("$PROJECT_DIR")  # noqa: F821
+sys.path.insert(0, os.path.join(root, "tools"))
+import asset_compiler  # noqa: E402
+
+images = [asset_compiler.Image(p) for p in sorted(glob.glob(os.path.join(root, "src", "ui", "ui_img_*.c")))]
+usage = asset_compiler.image_usage(images, root)
+asset_compiler.print_usage(images, usage)
+
+if os.environ.get("PRUNE_ASSETS", "1") != "0":
+    env.Append(SRC_FILTER=["-<ui/%s>" % os.path.basename(img.path)  # noqa: F821
+                           for img in images if usage[img.name] == asset_compiler.UNREFERENCED])
+
+
+def linked_images(elf):
+    """Bytes of ui_img_* symbols in the linked firmware, descriptors and pixel data"""
+    nm = env.subst("$SIZETOOL")[:-len("size")] + "nm"  # noqa: F821, xtensa-*-elf-size of the same toolchain
+    out = subprocess.run([nm, "--print-size", elf], capture_output=True, text=True, check=True).stdout
+    total = 0
+    count = 0
+    for line in out.splitlines():
+        fields = line.split()
+        if len(fields) == 4 and fields[3].startswith("ui_img_"):
+            total += int(fields[1], 16)
+            count += not fields[3].endswith("_data")
+    return count, total
+
+
+def report_size(source, target, env):
+    bin_path = str(target[0])
+    elf = os.path.splitext(bin_path)[0] + ".elf"
+    count, total = linked_images(elf)
+    print("%s: %d bytes, %d images with %d bytes linked, asset pruning %s" % (
+        os.path.basename(bin_path), os.path.getsize(bin_path), count, total,
+        "off" if os.environ.get("PRUNE_ASSETS", "1") == "0" else "on"))
+
+
+env.AddPostAction("$BUILD_DIR/${PROGNAME}.bin", report_size)  # noqa: F821
@@ -0,0 +1,22 @@
+"""
+PlatformIO pre script: subset the Montserrat fonts the UI uses to the glyphs it can show
+(tools/font_subset.py) and build with FONT_SUBSET. lvgl is installed to libdeps before the first
+build runs the script, until then and whenever subsetting fails the build keeps lvgl's full fonts.
+"""
+
+import os
+import sys
+
+Import("env")  # noqa: F821, provided by PlatformIO
+
+root = env.subst("$PROJECT_DIR")  # noqa: F821
+sys.path.insert(0, os.path.join(root, "tools"))
+import font_subset  # noqa: E402
+
+lvgl = os.path.join(env.subst("$PROJECT_LIBDEPS_DIR"), env.subst("$PIOENV"), "lvgl")  # noqa: F821
+
+try:
+    font_subset.subset_fonts(root, lvgl)
+    env.Append(CPPDEFINES=["FONT_SUBSET"])  # noqa: F821
+except (ValueError, AttributeError, OSError) as e:
+    print("font subset skipped, using lvgl's fonts: %s" % e)
@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+"""
+Decode the telemetry records streamed by src/telemetry.cpp and optionally plot them.
+
+Reads a serial port (needs pyserial) and asks for binary records, or decodes a capture file
+holding binary or CSV records mixed with the log output. Writes one CSV row per record:
+
+  python tools/telemetry.py --port /dev/ttyUSB0 -o telemetry.csv
+  python tools/telemetry.py capture.bin --plot                      needs matplotlib
+
+The rows add the rates derived from the counters: fps, average render and loop time, flush
+throughput and bus load.
+"""
+
+import argparse
+import csv
+import struct
+import sys
+
+# TELEMETRY_FIELDS in include/telemetry.h
+FIELDS = [
+    "timeMs", "intervalMs", "refreshes", "renderUs", "renderUsMax", "flushes", "flushBytes", "flushUs",
+    "loops", "loopUs", "loopUsMax", "bleEvents", "uiDropped", "lvMemUsed", "lvMemPeak",
+    "heapInternal", "heapInternalMin", "heapPsram", "heapDma",
+]
+SYNC = b"\xA5\x5A"
+VERSION = 1
+DERIVED = ["fps", "renderAvgUs", "loopAvgUs", "flushKBps", "busLoad"]
+
+
+def derive(record):
+    interval = record["intervalMs"] or 1
+    record["fps"] = round(record["refreshes"] * 1000 / interval, 1)
+    record["renderAvgUs"] = record["renderUs"] // record["refreshes"] if record["refreshes"] else 0
+    record["loopAvgUs"] = record["loopUs"] // record["loops"] if record["loops"] else 0
+    record["flushKBps"] = round(record["flushBytes"] / interval * 1000 / 1024, 1)
+    record["busLoad"] = round(record["flushUs"] / (interval * 10), 1)  # [%]
+    return record
+
+
+def decode(data):
+    """Records found in `data`, and the bytes left over that may start a record"""
+    records = []
+    i = 0
+    while True:
+        binary = data.find(SYNC, i)
+        text = data.find(b"T,", i)
+        if binary < 0 and text < 0:
+            return records, data[max(i, len(data) - 256):]
+
+        if text >= 0 and (binary < 0 or text < binary):
+            end = data.find(b"\n", text)
+            if end < 0:
+                return records, data[text:]
+            values = data[text + 2:end].strip().split(b",")
+            if len(values) == len(FIELDS) and all(v.isdigit() for v in values):
+                records.append(derive(dict(zip(FIELDS, map(int, values)))))
+            i = end + 1
+            continue
+
+        size = 4 + 4 * len(FIELDS) + 1
+        if len(data) - binary < size:
+            return records, data[binary:]
+        frame = data[binary:binary + size]
+        if frame[2] == VERSION and frame[3] == len(FIELDS) and sum(frame[4:-1]) & 0xFF == frame[-1]:
+            values = struct.unpack_from("<%dI" % len(FIELDS), frame, 4)
+            records.append(derive(dict(zip(FIELDS, values))))
+            i = binary + size
+        else:
+            i = binary + 1
+
+
+def read_port(port, baud):
+    import serial
+
+    with serial.Serial(port, baud, timeout=1) as ser:
+        ser.write(b"b")
+        rest = b""
+        try:
+            while True:
+                records, rest = decode(rest + ser.read(4096))
+                yield from records
+        finally:
+            ser.write(b"x")
+
+
+def read_file(path):
+    with open(path, "rb") as f:
+        records, _ = decode(f.read())
+    return records
+
+
+def plot(records):
+    import matplotlib.pyplot as plt
+
+    t = [(r["timeMs"] - records[0]["timeMs"]) / 1000 for r in records]
+    panels = [
+        ("frames", ["fps"]),
+        ("time [us]", ["renderAvgUs", "renderUsMax", "loopAvgUs", "loopUsMax"]),
+        ("flush", ["flushKBps", "busLoad"]),
+        ("memory [bytes]", ["lvMemUsed", "heapInternal", "heapPsram", "heapDma"]),
+        ("events", ["bleEvents", "uiDropped"]),
+    ]
+    fig, axes = plt.subplots(len(panels), 1, sharex=True, figsize=(10, 2.5 * len(panels)))
+    for ax, (title, keys) in zip(axes, panels):
+        for key in keys:
+            ax.plot(t, [r[key] for r in records], label=key)
+        ax.set_ylabel(title)
+        ax.legend(loc="upper right", fontsize="small")
+    axes[-1].set_xlabel("time [s]")
+    plt.tight_layout()
+    plt.show()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("capture", nargs="?", help="file with the captured serial output")
+    parser.add_argument("--port", help="serial port to stream from, until interrupted")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("-o", "--output", help="CSV file, stdout by default")
+    parser.add_argument("--plot", action="store_true", help="plot the records at the end")
+    args = parser.parse_args()
+    if not args.capture and not args.port:
+        parser.error("give a capture file or --port")
+
+    out = open(args.output, "w", newline="") if args.output else sys.stdout
+    writer = csv.DictWriter(out, FIELDS + DERIVED)
+    writer.writeheader()
+    records = []
+    try:
+        for record in read_port(args.port, args.baud) if args.port else read_file(args.capture):
+            writer.writerow(record)
+            out.flush()
+            records.append(record)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        if args.output:
+            out.close()
+
+    if args.plot and records:
+        plot(records)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())